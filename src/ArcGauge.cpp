@@ -0,0 +1,227 @@
+#include "ArcGauge.h"
+#include "TrigTable.h"
+#include "HistoryGraph.h"
+#include "NativePush.h"
+#include "Profiler.h"
+#include "Theme.h"
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+// External display object
+extern TFT_eSPI display;
+
+#define FULL_TURN 720             // Half-degrees
+#define QUARTER_TURN 180
+#define GAUGE_START 450           // Sweep start as a compass angle (225 deg, clockwise from 12 o'clock)
+#define NEEDLE_HALF_WIDTH 1       // Pixels either side of the needle line
+
+// Pixels of one run within a row, true-colour RGB565
+static uint16_t runColors[2 * GAUGE_MAX_RADIUS + 4];
+
+// sin of a compass angle in half-degrees, Q14, folded onto the quarter table
+static int32_t isin(int32_t a) {
+  a %= FULL_TURN;
+  if (a < 0) {
+    a += FULL_TURN;
+  }
+  if (a <= QUARTER_TURN) return sinQuarterTable[a];
+  if (a <= 2 * QUARTER_TURN) return sinQuarterTable[2 * QUARTER_TURN - a];
+  if (a <= 3 * QUARTER_TURN) return -sinQuarterTable[a - 2 * QUARTER_TURN];
+  return -sinQuarterTable[FULL_TURN - a];
+}
+
+// A ray from the center at a gauge angle. side() is the signed distance
+// of a pixel from the ray's line in Q14 pixels, positive on the clockwise side.
+struct GaugeRay {
+  int32_t s;
+  int32_t c;
+};
+
+static GaugeRay gaugeRay(int32_t angle) {
+  GaugeRay ray = {isin(GAUGE_START + angle), isin(GAUGE_START + angle + QUARTER_TURN)};
+  return ray;
+}
+
+static inline int32_t side(const GaugeRay &ray, int32_t dx, int32_t dy) {
+  return ray.s * dy + ray.c * dx;
+}
+
+// Q14 pixel distance to alpha: 128 on the edge, 255 half a pixel inside
+static inline int32_t edgeAlpha(int32_t q14Inside) {
+  int32_t alpha = 128 + q14Inside / 64;
+  return alpha < 0 ? 0 : (alpha > 255 ? 255 : alpha);
+}
+
+// Everything needed to color one pixel of the ring, resolved per wedge
+struct GaugeShade {
+  int32_t rO2, rI2;
+  uint8_t rO, rI;
+  GaugeRay start, end, needle;
+  bool startNear, endNear;  // Caps close enough to the wedge to need their edge
+  bool needleNear;          // Needle within a quarter turn: use its line
+  bool allFilled;           // Otherwise the whole wedge is fill (or all track)
+  uint16_t fill, track, needleColor, background;
+};
+
+static uint16_t shadePixel(const GaugeShade &shade, int32_t dx, int32_t dy) {
+  int32_t d2 = dx * dx + dy * dy;
+  // Distance to a circle of radius r is ~(d^2 - r^2) / 2r near the edge
+  int32_t ring = min(edgeAlpha(((shade.rO2 - d2) << 13) / shade.rO), edgeAlpha(((d2 - shade.rI2) << 13) / shade.rI));
+  if (shade.startNear) {
+    ring = min(ring, edgeAlpha(side(shade.start, dx, dy)));
+  }
+  if (shade.endNear) {
+    ring = min(ring, edgeAlpha(-side(shade.end, dx, dy)));
+  }
+  if (ring == 0) {
+    return shade.background;
+  }
+
+  uint16_t color;
+  if (shade.needleNear) {
+    int32_t offset = side(shade.needle, dx, dy);
+    int32_t fill = edgeAlpha(-offset);
+    color = fill == 255 ? shade.fill : (fill == 0 ? shade.track : display.alphaBlend(fill, shade.fill, shade.track));
+    int32_t needle = edgeAlpha((NEEDLE_HALF_WIDTH << TRIG_SHIFT) - abs(offset));
+    if (needle > 0) {
+      color = display.alphaBlend(needle, shade.needleColor, color);
+    }
+  } else {
+    color = shade.allFilled ? shade.fill : shade.track;
+  }
+  return ring == 255 ? color : display.alphaBlend(ring, color, shade.background);
+}
+
+static uint32_t flushRun(int32_t x, int32_t y, int32_t count) {
+  beginNativeWindow(x, y, count, 1);
+  pushNativeLine(runColors, count);
+  endNativeWindow();
+  PROFILE_SPI(count);
+  return count;
+}
+
+// Repaint the ring pixels inside the wedge [from, to] (at most a quarter turn)
+static uint32_t paintWedge(const ArcGaugeView &view, GaugeShade &shade, int16_t from, int16_t to) {
+  GaugeRay first = gaugeRay(from);
+  GaugeRay last = gaugeRay(to);
+  shade.startNear = from < QUARTER_TURN;
+  shade.endNear = to > GAUGE_SWEEP - QUARTER_TURN;
+  shade.needleNear = view.angle >= from - QUARTER_TURN && view.angle <= to + QUARTER_TURN;
+  shade.allFilled = view.angle > to;
+
+  // Bounding box: the wedge's four corners plus any compass extreme it spans
+  int32_t outer = view.rOuter + 1;
+  int32_t inner = max(0, view.rInner - 1);
+  int32_t left = outer, right = -outer, top = outer, bottom = -outer;
+  const GaugeRay corners[2] = {first, last};
+  for (uint8_t i = 0; i < 2; i++) {
+    int32_t radii[2] = {outer, inner};
+    for (uint8_t j = 0; j < 2; j++) {
+      int32_t px = (corners[i].s * radii[j]) >> TRIG_SHIFT;
+      int32_t py = -((corners[i].c * radii[j]) >> TRIG_SHIFT);
+      left = min(left, px - 1);
+      right = max(right, px + 1);
+      top = min(top, py - 1);
+      bottom = max(bottom, py + 1);
+    }
+  }
+  for (int32_t compass = 0; compass < FULL_TURN; compass += QUARTER_TURN) {
+    int32_t angle = (compass - GAUGE_START + FULL_TURN) % FULL_TURN;
+    if (angle > (GAUGE_SWEEP + FULL_TURN) / 2) {
+      angle -= FULL_TURN; // Just before the start, inside the cap margin
+    }
+    if (angle < from || angle > to) {
+      continue;
+    }
+    switch (compass) {
+      case 0: top = -outer; break;
+      case QUARTER_TURN: right = outer; break;
+      case 2 * QUARTER_TURN: bottom = outer; break;
+      default: left = -outer; break;
+    }
+  }
+
+  int32_t outer2 = outer * outer;
+  int32_t inner2 = inner * inner;
+  uint32_t pixels = 0;
+  for (int32_t dy = top; dy <= bottom; dy++) {
+    int32_t y = view.cy + dy;
+    if (y < 0 || y >= display.height()) {
+      continue;
+    }
+    int32_t runStart = 0;
+    int32_t count = 0;
+    for (int32_t dx = left; dx <= right; dx++) {
+      int32_t x = view.cx + dx;
+      int32_t d2 = dx * dx + dy * dy;
+      bool inside = x >= 0 && x < display.width() && d2 <= outer2 && d2 >= inner2 &&
+                    side(first, dx, dy) >= 0 && side(last, dx, dy) <= 0;
+      if (inside) {
+        if (count == 0) {
+          runStart = x;
+        }
+        runColors[count++] = shadePixel(shade, dx, dy);
+      } else if (count > 0) {
+        pixels += flushRun(runStart, y, count);
+        count = 0;
+      }
+    }
+    if (count > 0) {
+      pixels += flushRun(runStart, y, count);
+    }
+  }
+  return pixels;
+}
+
+void initArcGauge(ArcGaugeView &view, uint8_t channel, int16_t cx, int16_t cy, uint8_t rOuter, uint8_t thickness) {
+  view.cx = cx;
+  view.cy = cy;
+  view.rOuter = min((int)rOuter, GAUGE_MAX_RADIUS);
+  view.rInner = view.rOuter > thickness + 1 ? view.rOuter - thickness : 1;
+  view.channel = channel;
+  view.angle = -1;
+  view.fillColor = 0;
+}
+
+uint32_t drawArcGauge(ArcGaugeView &view, float value, uint16_t fillColor, bool full) {
+  int16_t low, high;
+  getChannelRange(view.channel, low, high);
+  int32_t angle = (int32_t)((value - low) * GAUGE_SWEEP / (high - low));
+  angle = constrain(angle, 0, GAUGE_SWEEP);
+
+  // Anti-aliased pixels around the needle and caps reach ~2px past the
+  // geometric edge; as an angle that is widest at the inner radius
+  int16_t margin = (2 * 115 + view.rInner - 1) / view.rInner + 1;
+  int16_t from, to;
+  if (full || view.angle < 0 || fillColor != view.fillColor) {
+    from = -margin;
+    to = GAUGE_SWEEP + margin;
+  } else if (angle != view.angle) {
+    from = max(min((int32_t)view.angle, angle) - margin, (int32_t)-margin);
+    to = min(max((int32_t)view.angle, angle) + margin, (int32_t)GAUGE_SWEEP + margin);
+  } else {
+    return 0;
+  }
+  view.angle = angle;
+  view.fillColor = fillColor;
+
+  GaugeShade shade;
+  shade.rO = view.rOuter;
+  shade.rI = view.rInner;
+  shade.rO2 = (int32_t)view.rOuter * view.rOuter;
+  shade.rI2 = (int32_t)view.rInner * view.rInner;
+  shade.start = gaugeRay(0);
+  shade.end = gaugeRay(GAUGE_SWEEP);
+  shade.needle = gaugeRay(angle);
+  shade.fill = fillColor;
+  shade.track = themeColor(THEME_INACTIVE);
+  shade.needleColor = themeColor(THEME_HIGHLIGHT);
+  shade.background = themeColor(THEME_BACKGROUND);
+
+  // Half-plane wedge tests only hold below half a turn
+  uint32_t pixels = 0;
+  for (int16_t wedge = from; wedge < to; wedge += QUARTER_TURN) {
+    pixels += paintWedge(view, shade, wedge, min((int16_t)(wedge + QUARTER_TURN), to));
+  }
+  return pixels;
+}
@@ -0,0 +1,29 @@
+#ifndef ARC_GAUGE_H
+#define ARC_GAUGE_H
+
+#include <stdint.h>
+#include "DisplayConfig.h"
+
+#define GAUGE_SWEEP 540          // Needle travel in half-degrees (270 deg, gap at the bottom)
+#define GAUGE_MAX_RADIUS 120
+
+// Ring gauge: the arc from the start up to the needle is filled, the rest
+// is track. Angles are half-degrees from the start of the sweep. Only the
+// wedge between the old and new needle angle is repainted; edges are
+// anti-aliased with alpha blending against the theme background.
+struct ArcGaugeView {
+  int16_t cx, cy;           // Center
+  uint8_t rOuter;           // Outer edge of the ring
+  uint8_t rInner;           // Inner edge of the ring
+  uint8_t channel;          // DataSource (range from getChannelRange())
+  int16_t angle;            // Needle angle on the panel, -1 until the first draw
+  uint16_t fillColor;       // Fill color on the panel
+};
+
+void initArcGauge(ArcGaugeView &view, uint8_t channel, int16_t cx, int16_t cy, uint8_t rOuter, uint8_t thickness);
+
+// Move the needle to value. Repaints the whole ring on the first draw,
+// when full is set or when fillColor changed. Returns pixels pushed.
+uint32_t drawArcGauge(ArcGaugeView &view, float value, uint16_t fillColor, bool full);
+
+#endif // ARC_GAUGE_H
@@ -0,0 +1,103 @@
+#include "BootSequencer.h"
+#include "Config.h"
+#include "DisplayManager.h"
+#include <Arduino.h>
+#if ENABLE_SIMULATOR
+#include "Simulator.h"
+#endif
+
+struct BootMark {
+  const char *phase;
+  uint32_t ms;
+};
+
+static BootMark bootMarks[BOOT_MAX_MARKS];
+static uint8_t bootMarkCount = 0;
+static volatile uint32_t firstFrameMs = 0;
+static uint32_t splashShownMs = 0;
+static uint32_t lastSweepMs = 0;
+static uint8_t bootState = BOOT_SPLASH;
+
+void bootMark(const char *phase) {
+  if (bootMarkCount < BOOT_MAX_MARKS) {
+    bootMarks[bootMarkCount].phase = phase;
+    bootMarks[bootMarkCount].ms = millis();
+    bootMarkCount++;
+  }
+}
+
+void bootNoteEcuFrame() {
+  if (firstFrameMs == 0) {
+    firstFrameMs = millis() | 1; // Never 0 once set
+  }
+}
+
+bool bootEcuFrameSeen() {
+#if ENABLE_SIMULATOR
+  if (getSimulatorMode() != SIMULATOR_MODE_OFF) {
+    return true;
+  }
+#endif
+  return firstFrameMs != 0;
+}
+
+void bootSplashShown() {
+  splashShownMs = millis();
+  bootMark("splash on screen");
+}
+
+bool bootUpdate() {
+  uint32_t now = millis();
+  switch (bootState) {
+    case BOOT_SPLASH: {
+      uint32_t held = now - splashShownMs;
+      bool dataReady = bootEcuFrameSeen() && held >= SPLASH_MIN_HOLD_MS;
+      if (!dataReady && held < SPLASH_MAX_HOLD_MS) {
+        return false;
+      }
+      bootMark(dataReady ? "splash released (ECU data)" : "splash released (timeout)");
+      startUpDisplay();
+      bootMark("dashboard drawn");
+      bootState = BOOT_SWEEP;
+      lastSweepMs = now;
+      return false;
+    }
+
+    case BOOT_SWEEP:
+      // Live data cuts the sweep short
+      if (!bootEcuFrameSeen()) {
+        if (now - lastSweepMs < RPM_BAR_FRAME_MS) {
+          return false;
+        }
+        lastSweepMs = now;
+        if (!startupSweepStep()) {
+          return false;
+        }
+      }
+      bootMark("live");
+      bootState = BOOT_RUNNING;
+      printBootTimeline();
+      return true;
+
+    default:
+      return true;
+  }
+}
+
+uint8_t getBootState() {
+  return bootState;
+}
+
+void printBootTimeline() {
+  Serial.println("=== BOOT TIMELINE ===");
+  for (uint8_t i = 0; i < bootMarkCount; i++) {
+    uint32_t delta = i ? bootMarks[i].ms - bootMarks[i - 1].ms : bootMarks[i].ms;
+    Serial.printf("%6u ms (+%5u)  %s\n", bootMarks[i].ms, delta, bootMarks[i].phase);
+  }
+  if (firstFrameMs != 0) {
+    Serial.printf("%6u ms          first ECU frame\n", firstFrameMs);
+  } else {
+    Serial.println("     -            no ECU frame yet");
+  }
+  Serial.println("=====================");
+}
@@ -0,0 +1,32 @@
+#ifndef BOOT_SEQUENCER_H
+#define BOOT_SEQUENCER_H
+
+#include <stdint.h>
+
+#define BOOT_MAX_MARKS 16
+
+// Boot phases after setup() returns
+enum BootState {
+  BOOT_SPLASH,    // Splash on screen, comms already running
+  BOOT_SWEEP,     // Dashboard drawn, RPM sweep until live data arrives
+  BOOT_RUNNING    // Live dashboard
+};
+
+// Record a timestamped boot phase (kept for printBootTimeline)
+void bootMark(const char *phase);
+
+// Called from the CAN/serial tasks for every valid frame; only the first
+// one is timestamped
+void bootNoteEcuFrame();
+bool bootEcuFrameSeen();
+
+// Call once when the splash is on screen, then bootUpdate() every loop.
+// bootUpdate() releases the splash, runs the sweep without blocking and
+// returns true once the dashboard is live.
+void bootSplashShown();
+bool bootUpdate();
+uint8_t getBootState();
+
+void printBootTimeline();
+
+#endif // BOOT_SEQUENCER_H
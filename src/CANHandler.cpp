@@ -2,6 +2,9 @@
 #include "DisplayConfig.h"
 #include "Config.h"
 #include "DataTypes.h"
+#include "Profiler.h"
+#include "BootSequencer.h"
+#include "Metrics.h"
 #include <esp32_can.h>
 #include "Arduino.h"
 
@@ -29,6 +32,79 @@ void canTask(void *pvParameters) {
   }
 }
 
+// Read one frame and update the decoded values
+static void decodeCANFrame() {
+  CAN_FRAME can_message;
+  if (CAN0.read(can_message)) {
+    countMetric(METRIC_CAN_FRAMES);
+    bootNoteEcuFrame();
+    // Process data based on ID
+    switch (can_message.id) {
+      case 0x360: {
+        rpm = (can_message.data.byte[0] << 8) | can_message.data.byte[1];
+        uint16_t map = (can_message.data.byte[2] << 8) | can_message.data.byte[3];
+        uint16_t tps_raw = (can_message.data.byte[4] << 8) | can_message.data.byte[5];
+        mapData = map / 10.0;
+        tps = tps_raw / 10.0;
+        break;
+      }
+      case 0x361: {
+        uint16_t fuel_pressure = (can_message.data.byte[0] << 8) | can_message.data.byte[1];
+        fp = fuel_pressure / 10 - 101.3;
+        break;
+      }
+      case 0x368: {
+        uint16_t afr_raw = (can_message.data.byte[0] << 8) | can_message.data.byte[1];
+        float lambda = afr_raw / 1000.0;
+        afrConv = lambda * 14.7;
+        break;
+      }
+      case 0x369: {
+        uint16_t trigger_raw = (can_message.data.byte[0] << 8) | can_message.data.byte[1];
+        triggerError = trigger_raw;
+        break;
+      }
+      case 0x370: {
+        uint16_t vss_raw = (can_message.data.byte[0] << 8) | can_message.data.byte[1];
+        vss = vss_raw / 10.0;
+        break;
+      }
+      case 0x372: {
+        uint16_t voltage = (can_message.data.byte[0] << 8) | can_message.data.byte[1];
+        bat = voltage / 10.0;
+        break;
+      }
+      case 0x3E0: {
+        uint16_t clt_raw = (can_message.data.byte[0] << 8) | can_message.data.byte[1];
+        uint16_t iat_raw = (can_message.data.byte[2] << 8) | can_message.data.byte[3];
+        float clt_k = clt_raw / 10.0;
+        float iat_k = iat_raw / 10.0;
+        clt = clt_k - 273.15;
+        iat = iat_k - 273.15;
+        break;
+      }
+      case 0x3E4: {
+        dfco = (can_message.data.byte[1] << 8) | can_message.data.byte[4];
+        launch = (can_message.data.byte[2] << 8) | can_message.data.byte[6];
+        airCon = (can_message.data.byte[3] << 8) | can_message.data.byte[4];
+        fan = (can_message.data.byte[3] << 8) | can_message.data.byte[0];
+        rev = (can_message.data.byte[2] << 8) | can_message.data.byte[5];
+        break;
+      }
+      case 0x362: {
+        uint16_t adv_raw = (can_message.data.byte[4] << 8) | can_message.data.byte[5];
+        adv = adv_raw / 10.0;
+        break;
+      }
+      default:
+        break;
+    }
+  } else {
+    countMetric(METRIC_CAN_ERRORS);
+    Serial.println("Error reading CAN message.");
+  }
+}
+
 void handleCANCommunication() {
   static uint32_t lastRefresh = millis();
   uint32_t elapsed = millis() - lastRefresh;
@@ -39,72 +115,7 @@ void handleCANCommunication() {
   isCANMode = true;  // We're in CAN mode when this function is called
   
   if (CAN0.available()) {
-    CAN_FRAME can_message;
-    if (CAN0.read(can_message)) {
-      // Process data based on ID
-      switch (can_message.id) {
-        case 0x360: {
-          rpm = (can_message.data.byte[0] << 8) | can_message.data.byte[1];
-          uint16_t map = (can_message.data.byte[2] << 8) | can_message.data.byte[3];
-          uint16_t tps_raw = (can_message.data.byte[4] << 8) | can_message.data.byte[5];
-          mapData = map / 10.0;
-          tps = tps_raw / 10.0;
-          break;
-        }
-        case 0x361: {
-          uint16_t fuel_pressure = (can_message.data.byte[0] << 8) | can_message.data.byte[1];
-          fp = fuel_pressure / 10 - 101.3;
-          break;
-        }
-        case 0x368: {
-          uint16_t afr_raw = (can_message.data.byte[0] << 8) | can_message.data.byte[1];
-          float lambda = afr_raw / 1000.0;
-          afrConv = lambda * 14.7;
-          break;
-        }
-        case 0x369: {
-          uint16_t trigger_raw = (can_message.data.byte[0] << 8) | can_message.data.byte[1];
-          triggerError = trigger_raw;
-          break;
-        }
-        case 0x370: {
-          uint16_t vss_raw = (can_message.data.byte[0] << 8) | can_message.data.byte[1];
-          vss = vss_raw / 10.0;
-          break;
-        }
-        case 0x372: {
-          uint16_t voltage = (can_message.data.byte[0] << 8) | can_message.data.byte[1];
-          bat = voltage / 10.0;
-          break;
-        }
-        case 0x3E0: {
-          uint16_t clt_raw = (can_message.data.byte[0] << 8) | can_message.data.byte[1];
-          uint16_t iat_raw = (can_message.data.byte[2] << 8) | can_message.data.byte[3];
-          float clt_k = clt_raw / 10.0;
-          float iat_k = iat_raw / 10.0;
-          clt = clt_k - 273.15;
-          iat = iat_k - 273.15;
-          break;
-        }
-        case 0x3E4: {
-          dfco = (can_message.data.byte[1] << 8) | can_message.data.byte[4];
-          launch = (can_message.data.byte[2] << 8) | can_message.data.byte[6];
-          airCon = (can_message.data.byte[3] << 8) | can_message.data.byte[4];
-          fan = (can_message.data.byte[3] << 8) | can_message.data.byte[0];
-          rev = (can_message.data.byte[2] << 8) | can_message.data.byte[5];
-          break;
-        }
-        case 0x362: {
-          uint16_t adv_raw = (can_message.data.byte[4] << 8) | can_message.data.byte[5];
-          adv = adv_raw / 10.0;
-          break;
-        }
-        default:
-          break;
-      }
-    } else {
-      Serial.println("Error reading CAN message.");
-    }
+    PROFILE_CALL(PROF_DECODE, decodeCANFrame());
   }
 
 //   if (currentTime - lastPrintTime >= 1000) {
@@ -0,0 +1,164 @@
+#include "ChannelBands.h"
+#include "Theme.h"
+#include "ConfigStore.h"
+#include "text_utils.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Defaults from the old hard-coded coloring: AFR lean/rich, coolant
+// overheating, charging voltage window and hot intake air
+const ChannelBandTable defaultChannelBands = {{
+  {1, 20, {600},      {THEME_TEXT, THEME_WARN}},                    // DATA_SOURCE_IAT: > 60 C
+  {1, 20, {950},      {THEME_TEXT, THEME_CRITICAL}},                // DATA_SOURCE_COOLANT: > 95 C
+  {2, 2,  {130, 148}, {THEME_WARN, THEME_NORMAL, THEME_CRITICAL}},  // DATA_SOURCE_AFR: 13.0..14.7
+  {0, 0,  {},         {THEME_TEXT}},                                // DATA_SOURCE_ADV
+  {0, 0,  {},         {THEME_TEXT}},                                // DATA_SOURCE_TRIGGER
+  {0, 0,  {},         {THEME_TEXT}},                                // DATA_SOURCE_TPS
+  {2, 2,  {115, 146}, {THEME_WARN, THEME_NORMAL, THEME_WARN}},      // DATA_SOURCE_VOLTAGE: 11.5..14.5
+  {0, 0,  {},         {THEME_TEXT}},                                // DATA_SOURCE_MAP
+  {0, 0,  {},         {THEME_TEXT}},                                // DATA_SOURCE_RPM
+  {0, 0,  {},         {THEME_TEXT}},                                // DATA_SOURCE_FP
+  {0, 0,  {},         {THEME_TEXT}},                                // DATA_SOURCE_VSS
+}};
+
+ChannelBandTable channelBands = defaultChannelBands;
+
+static uint8_t currentBand[DATA_SOURCE_COUNT] = {
+  BAND_NONE, BAND_NONE, BAND_NONE, BAND_NONE, BAND_NONE, BAND_NONE,
+  BAND_NONE, BAND_NONE, BAND_NONE, BAND_NONE, BAND_NONE
+};
+
+static void resetCurrentBands() {
+  memset(currentBand, BAND_NONE, sizeof(currentBand));
+}
+
+void loadChannelBands() {
+  configLoad(CONFIG_RECORD_BANDS);
+  resetCurrentBands(); // Re-evaluate from the next sample
+}
+
+void saveChannelBands() {
+  configMarkDirty(CONFIG_RECORD_BANDS);
+}
+
+void updateChannelBand(uint8_t dataSource, float value) {
+  if (dataSource >= DATA_SOURCE_COUNT) {
+    return;
+  }
+  const ChannelBands &bands = channelBands.channels[dataSource];
+  int32_t fixed = toFixed(value, BAND_DECIMALS);
+
+  // Band the value falls in without hysteresis
+  uint8_t band = 0;
+  while (band < bands.count && fixed >= bands.edge[band]) {
+    band++;
+  }
+
+  uint8_t current = currentBand[dataSource];
+  if (current != BAND_NONE && band < current) {
+    // Falling: only leave the edges the value has cleared by the hysteresis
+    band = 0;
+    while (band < current && fixed >= bands.edge[band] - bands.hysteresis) {
+      band++;
+    }
+  }
+  currentBand[dataSource] = band;
+}
+
+uint8_t getChannelBand(uint8_t dataSource) {
+  if (dataSource >= DATA_SOURCE_COUNT || currentBand[dataSource] == BAND_NONE) {
+    return 0;
+  }
+  return currentBand[dataSource];
+}
+
+uint8_t getChannelBandRole(uint8_t dataSource) {
+  if (dataSource >= DATA_SOURCE_COUNT) {
+    return THEME_TEXT;
+  }
+  return channelBands.channels[dataSource].role[getChannelBand(dataSource)];
+}
+
+const ChannelBands &getChannelBands(uint8_t dataSource) {
+  return channelBands.channels[dataSource < DATA_SOURCE_COUNT ? dataSource : 0];
+}
+
+bool validChannelBands(const ChannelBands &bands) {
+  if (bands.count > BAND_MAX_EDGES || bands.hysteresis < 0) {
+    return false;
+  }
+  for (uint8_t i = 1; i < bands.count; i++) {
+    if (bands.edge[i] <= bands.edge[i - 1]) {
+      return false;
+    }
+  }
+  for (uint8_t i = 0; i <= bands.count; i++) {
+    if (bands.role[i] >= THEME_COLOR_COUNT) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool validChannelBandTable(const ChannelBandTable &table) {
+  for (uint8_t i = 0; i < DATA_SOURCE_COUNT; i++) {
+    if (!validChannelBands(table.channels[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool setChannelBands(uint8_t dataSource, const ChannelBands &bands) {
+  if (dataSource >= DATA_SOURCE_COUNT || !validChannelBands(bands)) {
+    return false;
+  }
+  channelBands.channels[dataSource] = bands;
+  currentBand[dataSource] = BAND_NONE; // Re-evaluate from the next sample
+  return true;
+}
+
+const char *getBandRoleName(uint8_t role) {
+  switch (role) {
+    case THEME_TEXT: return "text";
+    case THEME_NORMAL: return "normal";
+    case THEME_WARN: return "warn";
+    case THEME_CRITICAL: return "critical";
+    default: return "unknown";
+  }
+}
+
+// edges "13.0,14.8" (empty or "-" for none), roles "warn,normal,critical".
+// Both strings are split in place.
+bool parseBandLists(char *edges, char *roles, ChannelBands &bands) {
+  char *save;
+  uint8_t count = 0;
+  if (strcmp(edges, "-") != 0) {
+    for (char *item = strtok_r(edges, ",", &save); item != NULL; item = strtok_r(NULL, ",", &save)) {
+      if (count >= BAND_MAX_EDGES) {
+        return false;
+      }
+      bands.edge[count++] = toFixed(atof(item), BAND_DECIMALS);
+    }
+  }
+  bands.count = count;
+  uint8_t roleCount = 0;
+  for (char *item = strtok_r(roles, ",", &save); item != NULL; item = strtok_r(NULL, ",", &save)) {
+    if (roleCount > count || !parseBandRole(item, bands.role[roleCount])) {
+      return false;
+    }
+    roleCount++;
+  }
+  return roleCount == count + 1 && validChannelBands(bands);
+}
+
+bool parseBandRole(const char *name, uint8_t &role) {
+  static const uint8_t roles[] = {THEME_TEXT, THEME_NORMAL, THEME_WARN, THEME_CRITICAL};
+  for (uint8_t i = 0; i < sizeof(roles); i++) {
+    if (strcmp(name, getBandRoleName(roles[i])) == 0) {
+      role = roles[i];
+      return true;
+    }
+  }
+  return false;
+}
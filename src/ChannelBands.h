@@ -0,0 +1,56 @@
+#ifndef CHANNEL_BANDS_H
+#define CHANNEL_BANDS_H
+
+#include <stdint.h>
+#include "DisplayConfig.h"
+
+#define BAND_MAX_EDGES 4         // Up to five bands per channel
+#define BAND_DECIMALS 1          // Edges and hysteresis are stored x10
+#define BAND_NONE 0xFF           // No band evaluated yet
+
+// Sorted band table for one channel. edge[] splits the value range into
+// count + 1 bands, each drawn in its own ThemeColor role:
+//   value < edge[0] -> role[0], edge[0] <= value < edge[1] -> role[1], ...
+// Rising moves happen at the edge; falling back needs value < edge - hysteresis.
+struct ChannelBands {
+  uint8_t count;                      // Edges in use (0 = single band)
+  int16_t hysteresis;                 // Fixed-point, BAND_DECIMALS
+  int32_t edge[BAND_MAX_EDGES];       // Fixed-point, strictly ascending
+  uint8_t role[BAND_MAX_EDGES + 1];   // ThemeColor per band
+};
+
+// Every channel's table. Persisted through ConfigStore (CONFIG_RECORD_BANDS)
+struct ChannelBandTable {
+  ChannelBands channels[DATA_SOURCE_COUNT];
+};
+
+extern ChannelBandTable channelBands;
+extern const ChannelBandTable defaultChannelBands;
+
+// Load the saved tables, or the defaults. Call before the first frame.
+void loadChannelBands();
+// Note a table edit; the config store commits it once edits settle
+void saveChannelBands();
+
+// Re-evaluate a channel's band from its displayed value. Called by the
+// channel filter for every sample; integer compares only.
+void updateChannelBand(uint8_t dataSource, float value);
+
+// Current band index and its color role. The renderer redraws a panel's
+// colors only when the band index changes.
+uint8_t getChannelBand(uint8_t dataSource);
+uint8_t getChannelBandRole(uint8_t dataSource);
+
+const ChannelBands &getChannelBands(uint8_t dataSource);
+// Rejects tables whose edges are not strictly ascending
+bool validChannelBands(const ChannelBands &bands);
+bool validChannelBandTable(const ChannelBandTable &table);
+bool setChannelBands(uint8_t dataSource, const ChannelBands &bands);
+// Fill count/edge/role from comma lists; false unless one role per band
+bool parseBandLists(char *edges, char *roles, ChannelBands &bands);
+
+// Roles a band may use, by name (text, normal, warn, critical)
+const char *getBandRoleName(uint8_t role);
+bool parseBandRole(const char *name, uint8_t &role);
+
+#endif // CHANNEL_BANDS_H
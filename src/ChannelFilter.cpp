@@ -0,0 +1,172 @@
+#include "ChannelFilter.h"
+#include "ChannelBands.h"
+#include "text_utils.h"
+#include <Arduino.h>
+#include <string.h>
+
+// Defaults tuned to the noise seen on each sensor: AFR jitters +-0.1,
+// MAP +-1 kPa, temperatures drift slowly, RPM/VSS feed their own widgets.
+// Integer channels that dither by one count (MAP, FP) are averaged: a
+// median of such values is itself an integer and flips with them. The
+// deadbands only stop a value sitting on a rounding edge from flickering.
+static ChannelFilterConfig filterConfig[DATA_SOURCE_COUNT] = {
+  {FILTER_EMA,    500, 0.3f},   // DATA_SOURCE_IAT
+  {FILTER_EMA,    500, 0.3f},   // DATA_SOURCE_COOLANT
+  {FILTER_EMA,    150, 0.03f},  // DATA_SOURCE_AFR
+  {FILTER_MEDIAN, 3,   0.3f},   // DATA_SOURCE_ADV
+  {FILTER_NONE,   0,   0.0f},   // DATA_SOURCE_TRIGGER
+  {FILTER_MEDIAN, 3,   0.3f},   // DATA_SOURCE_TPS
+  {FILTER_EMA,    300, 0.03f},  // DATA_SOURCE_VOLTAGE
+  {FILTER_EMA,    150, 0.3f},   // DATA_SOURCE_MAP
+  {FILTER_NONE,   0,   0.0f},   // DATA_SOURCE_RPM
+  {FILTER_EMA,    300, 0.3f},   // DATA_SOURCE_FP
+  {FILTER_NONE,   0,   0.0f},   // DATA_SOURCE_VSS
+};
+
+// Display precision per channel, matching the default panels until a
+// layout is compiled
+static uint8_t channelDecimals[DATA_SOURCE_COUNT] = {
+  0,  // DATA_SOURCE_IAT
+  0,  // DATA_SOURCE_COOLANT
+  1,  // DATA_SOURCE_AFR
+  0,  // DATA_SOURCE_ADV
+  0,  // DATA_SOURCE_TRIGGER
+  0,  // DATA_SOURCE_TPS
+  1,  // DATA_SOURCE_VOLTAGE
+  0,  // DATA_SOURCE_MAP
+  0,  // DATA_SOURCE_RPM
+  0,  // DATA_SOURCE_FP
+  0,  // DATA_SOURCE_VSS
+};
+
+static const float decimalScale[] = {1.0f, 10.0f, 100.0f, 1000.0f, 10000.0f};
+
+struct ChannelState {
+  float filtered;
+  float shown;                        // Value handed to the renderer
+  float window[FILTER_MEDIAN_MAX];    // Median history (ring)
+  uint8_t windowFill;
+  uint8_t windowPos;
+  bool primed;
+};
+
+static ChannelState channels[DATA_SOURCE_COUNT];
+static uint32_t lastSampleMs = 0;
+
+static float medianOf(const float *values, uint8_t count) {
+  float sorted[FILTER_MEDIAN_MAX];
+  memcpy(sorted, values, count * sizeof(float));
+  for (uint8_t i = 1; i < count; i++) {
+    float key = sorted[i];
+    int j = i - 1;
+    while (j >= 0 && sorted[j] > key) {
+      sorted[j + 1] = sorted[j];
+      j--;
+    }
+    sorted[j + 1] = key;
+  }
+  return sorted[count / 2];
+}
+
+static void sampleChannel(uint8_t source, float raw) {
+  const ChannelFilterConfig &config = filterConfig[source];
+  ChannelState &state = channels[source];
+
+  uint8_t decimals = channelDecimals[source];
+  if (!state.primed) {
+    state.filtered = raw;
+    state.shown = toFixed(raw, decimals) / decimalScale[decimals];
+    state.window[0] = raw;
+    state.windowFill = 1;
+    state.windowPos = 1;
+    state.primed = true;
+    return;
+  }
+
+  switch (config.mode) {
+    case FILTER_EMA: {
+      float alpha = (float)FILTER_SAMPLE_MS / (config.param + FILTER_SAMPLE_MS);
+      state.filtered += alpha * (raw - state.filtered);
+      break;
+    }
+    case FILTER_MEDIAN: {
+      uint8_t size = constrain(config.param, 1, FILTER_MEDIAN_MAX);
+      state.window[state.windowPos % size] = raw;
+      state.windowPos = (state.windowPos + 1) % size;
+      if (state.windowFill < size) {
+        state.windowFill++;
+      }
+      state.filtered = medianOf(state.window, state.windowFill);
+      break;
+    }
+    default:
+      state.filtered = raw;
+      break;
+  }
+
+  // Hysteresis in display units: the shown value snaps to the next digit
+  // once the filtered value is the deadband past the rounding midpoint.
+  // The cap keeps that short of a whole unit, so a filter settling on a
+  // one-digit step always gets there.
+  int32_t target = toFixed(state.filtered, decimals);
+  if (target != toFixed(state.shown, decimals)) {
+    float unit = 1.0f / decimalScale[decimals];
+    float deadband = min(config.deadband, unit * FILTER_DEADBAND_MAX);
+    if (fabsf(state.filtered - state.shown) >= unit * 0.5f + deadband) {
+      state.shown = target / decimalScale[decimals];
+    }
+  }
+}
+
+void updateChannelFilters(uint32_t now) {
+  if (now - lastSampleMs < FILTER_SAMPLE_MS) {
+    return;
+  }
+  lastSampleMs = now;
+  for (uint8_t i = 0; i < DATA_SOURCE_COUNT; i++) {
+    sampleChannel(i, getDataValue(i));
+    updateChannelBand(i, channels[i].shown); // Color follows what is displayed
+  }
+}
+
+float getDisplayValue(uint8_t dataSource) {
+  if (dataSource >= DATA_SOURCE_COUNT || !channels[dataSource].primed) {
+    return getDataValue(dataSource);
+  }
+  return channels[dataSource].shown;
+}
+
+void setChannelDecimals(uint8_t dataSource, uint8_t decimals) {
+  if (dataSource >= DATA_SOURCE_COUNT) {
+    return;
+  }
+  channelDecimals[dataSource] = min(decimals, (uint8_t)(sizeof(decimalScale) / sizeof(decimalScale[0]) - 1));
+}
+
+uint8_t getChannelDecimals(uint8_t dataSource) {
+  return channelDecimals[dataSource < DATA_SOURCE_COUNT ? dataSource : 0];
+}
+
+const ChannelFilterConfig &getChannelFilter(uint8_t dataSource) {
+  return filterConfig[dataSource < DATA_SOURCE_COUNT ? dataSource : 0];
+}
+
+void setChannelFilter(uint8_t dataSource, const ChannelFilterConfig &config) {
+  if (dataSource >= DATA_SOURCE_COUNT) {
+    return;
+  }
+  filterConfig[dataSource] = config;
+  if (config.mode == FILTER_MEDIAN) {
+    filterConfig[dataSource].param = constrain(config.param, 1, FILTER_MEDIAN_MAX);
+  }
+  channels[dataSource].primed = false; // Restart from the next raw sample
+}
+
+const char *getFilterModeName(uint8_t mode) {
+  switch (mode) {
+    case FILTER_NONE: return "none";
+    case FILTER_EMA: return "ema";
+    case FILTER_MEDIAN: return "median";
+    default: return "unknown";
+  }
+}
@@ -0,0 +1,45 @@
+#ifndef CHANNEL_FILTER_H
+#define CHANNEL_FILTER_H
+
+#include <stdint.h>
+#include "DisplayConfig.h"
+
+#define FILTER_SAMPLE_MS 10      // Channels are sampled at 100 Hz
+#define FILTER_MEDIAN_MAX 7      // Largest median window
+#define FILTER_DEADBAND_MAX 0.4f // Deadband cap, as a share of one display unit
+
+// Smoothing applied to a channel before display
+enum FilterMode {
+  FILTER_NONE,
+  FILTER_EMA,       // Exponential moving average, param = time constant in ms
+  FILTER_MEDIAN     // Median of the last param samples (3..FILTER_MEDIAN_MAX)
+};
+
+struct ChannelFilterConfig {
+  uint8_t mode;       // FilterMode
+  uint16_t param;     // EMA time constant (ms) or median window
+  float deadband;     // Hysteresis past the rounding midpoint, capped below half a display unit
+};
+
+// Sits between the decoded ECU values and the renderer. Call once per loop;
+// it samples every channel at FILTER_SAMPLE_MS, smooths it and applies the
+// display deadband, then re-evaluates the channel's color band.
+// Panels read getDisplayValue() instead of getDataValue().
+//
+// The shown value is the filtered value rounded to the channel's display
+// decimals. It steps to a new digit once the filtered value is past the
+// rounding midpoint by the deadband, so a settled one-unit change always
+// reaches the panel.
+void updateChannelFilters(uint32_t now);
+float getDisplayValue(uint8_t dataSource);
+
+// Precision the channel is displayed at; compileLayout() sets it from the
+// widgets bound to the channel
+void setChannelDecimals(uint8_t dataSource, uint8_t decimals);
+uint8_t getChannelDecimals(uint8_t dataSource);
+
+const ChannelFilterConfig &getChannelFilter(uint8_t dataSource);
+void setChannelFilter(uint8_t dataSource, const ChannelFilterConfig &config);
+const char *getFilterModeName(uint8_t mode);
+
+#endif // CHANNEL_FILTER_H
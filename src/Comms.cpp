@@ -1,13 +1,16 @@
 #include "Arduino.h"
 #include "Comms.h"
+#include "Metrics.h"
 
-void requestData(uint16_t timeout)
+// Returns true when a complete response was read into the buffer
+bool requestData(uint16_t timeout)
 {
   Serial1.setTimeout(timeout);
 
   while (Serial1.available()) Serial1.read(); // Flush buffer
 
   Serial1.write('n');
+  countMetric(METRIC_SERIAL_POLLS);
 
   uint32_t start = millis();
   uint32_t end = start;
@@ -29,11 +32,14 @@ void requestData(uint16_t timeout)
         Serial.printf("[SERIAL] Data received: %d bytes\n", dataLen);
         lastDebugPrint = millis();
       }
+      return true;
     } else {
+      countMetric(METRIC_SERIAL_ERRORS);
       Serial.println("[SERIAL] Data overflow: Invalid data length");
       Serial.println(dataLen);
     }
   } else {
+    countMetric(METRIC_SERIAL_TIMEOUTS);
     // Debug: Print timeout or no data
     static uint32_t lastTimeoutPrint = 0;
     if (millis() - lastTimeoutPrint > 10000) { // Print every 10 seconds
@@ -42,6 +48,7 @@ void requestData(uint16_t timeout)
       lastTimeoutPrint = millis();
     }
   }
+  return false;
 }
 
 bool getBit(uint16_t address, uint8_t bit) {
@@ -0,0 +1,73 @@
+#include "CompressedImage.h"
+#include "NativePush.h"
+#include <Arduino.h>
+
+#define Q565_HEADER_SIZE 8
+#define Q565_OP_RGB 0xFE
+
+static inline uint8_t cacheIndex(uint16_t color) {
+  return ((color >> 11) * 3 + ((color >> 5) & 0x3F) * 5 + (color & 0x1F) * 7) % 64;
+}
+
+bool drawCompressedImage(int32_t x, int32_t y, const uint8_t *data, uint32_t size) {
+  if (size < Q565_HEADER_SIZE || pgm_read_byte(data) != 'Q' || pgm_read_byte(data + 1) != '5' ||
+      pgm_read_byte(data + 2) != '6' || pgm_read_byte(data + 3) != '5') {
+    return false;
+  }
+  uint16_t width = pgm_read_byte(data + 4) | (pgm_read_byte(data + 5) << 8);
+  uint16_t height = pgm_read_byte(data + 6) | (pgm_read_byte(data + 7) << 8);
+  if (width == 0 || width > 480) {
+    return false;
+  }
+
+  static uint16_t line[480];
+  uint16_t cache[64] = {0};
+  uint16_t prev = 0;
+  uint8_t run = 0;            // Pending repeats of prev carried across lines
+  uint32_t pos = Q565_HEADER_SIZE;
+
+  beginNativeWindow(x, y, width, height);
+  for (uint16_t row = 0; row < height; row++) {
+    for (uint16_t col = 0; col < width; col++) {
+      if (run > 0) {
+        run--;
+        line[col] = prev;
+        continue;
+      }
+      if (pos >= size) {
+        line[col] = prev; // Truncated stream: pad with the last colour
+        continue;
+      }
+      uint8_t op = pgm_read_byte(data + pos++);
+      uint16_t color;
+      if (op == Q565_OP_RGB) {
+        color = (pgm_read_byte(data + pos) << 8) | pgm_read_byte(data + pos + 1);
+        pos += 2;
+      } else if (op >= 0xC0) {
+        run = op & 0x3F; // This pixel plus run more
+        line[col] = prev;
+        continue;
+      } else if (op < 0x40) {
+        color = cache[op];
+      } else if (op < 0x80) {
+        int8_t r = (prev >> 11) + ((op >> 4) & 3) - 2;
+        int8_t g = ((prev >> 5) & 0x3F) + ((op >> 2) & 3) - 2;
+        int8_t b = (prev & 0x1F) + (op & 3) - 2;
+        color = ((r & 0x1F) << 11) | ((g & 0x3F) << 5) | (b & 0x1F);
+      } else {
+        int8_t dg = (op & 0x3F) - 32;
+        uint8_t rb = pgm_read_byte(data + pos++);
+        int8_t r = (prev >> 11) + dg + (rb >> 4) - 8;
+        int8_t g = ((prev >> 5) & 0x3F) + dg;
+        int8_t b = (prev & 0x1F) + dg + (rb & 0x0F) - 8;
+        color = ((r & 0x1F) << 11) | ((g & 0x3F) << 5) | (b & 0x1F);
+      }
+      cache[cacheIndex(color)] = color;
+      line[col] = color;
+      prev = color;
+    }
+    pushNativeLine(line, width);
+  }
+  endNativeWindow();
+  return true;
+}
@@ -0,0 +1,12 @@
+#ifndef COMPRESSED_IMAGE_H
+#define COMPRESSED_IMAGE_H
+
+#include <stdint.h>
+
+// Draw a Q565 image (QOI-style compressed RGB565, see
+// tools/compress_splash.py for the format). Decodes one line at a time
+// straight into the panel window, so only a single line buffer is needed.
+// Returns false if the data is not a valid Q565 stream.
+bool drawCompressedImage(int32_t x, int32_t y, const uint8_t *data, uint32_t size);
+
+#endif // COMPRESSED_IMAGE_H
@@ -27,8 +27,53 @@ extern const char *password;
 // RPM Configuration
 #define DEFAULT_MAX_RPM 8000
 
-// Other constants
-#define EEPROM_SIZE 512
+// RPM bar rendering
+#define RPM_BAR_FRAME_MS 16        // Bar render interval (~60 Hz)
+#define RPM_BAR_SMOOTHING_MS 60    // Time constant for interpolating between RPM samples
+#define RPM_PEAK_HOLD_MS 1500      // How long the peak marker holds before falling back
+#define RPM_SHIFT_POINT 6500       // RPM at which the bar starts flashing (0 = disabled)
+#define RPM_SHIFT_FLASH_MS 100     // Shift flash on/off period
+
+// Settings persistence (ConfigStore)
+#define CONFIG_COMMIT_DELAY_MS 2000  // Quiet time before edits are written to flash
+#define EEPROM_SIZE 512              // Legacy EEPROM layout, only read once to import it
+
+// Web server task (core 0, below the comm tasks)
+#define WEB_TASK_STACK 8192
+#define WEB_TASK_PRIORITY 0
+#define WEB_SERVER_START_DELAY_MS 15000 // AP comes up late to keep boot current low
+#define WEB_RESTART_DELAY_MS 1000       // Lets the response reach the browser before a restart
+#define DISPLAY_STATE_HANDOFF_MS 5      // Longest the render loop waits for a handler to take the display state
+#define JSON_BUFFER_SIZE 2048           // Shared by all JSON endpoints; largest is /bands
+#define METRICS_BUFFER_SIZE 4096        // /metrics text exposition
+#define LAYOUT_DOC_SIZE 2048            // /layout document, either direction
+#define OTA_VERIFY_TIMEOUT_MS 120000    // New firmware must see the ECU and render within this, or it rolls back
+
+// Datalogger (DataLogger.h)
+#define LOG_MAX_HZ 100                // Highest sample rate, about the ECU broadcast rate
+#define LOG_RING_RECORDS 1024         // Preallocated ring (~28 KB), holds the pre-trigger history
+#define LOG_WRITE_BYTES 4096          // Writer waits for this much before touching flash
+#define LOG_FLUSH_MAX_AGE_MS 2000     // ...or for this long at low sample rates
+#define LOG_SYNC_MS 5000              // File metadata committed this often (power loss)
+#define LOG_STOP_HOLD_MS 5000         // Auto recording stops once triggers are quiet this long
+#define LOG_MIN_FREE_BYTES 32768      // Oldest logs are deleted to keep this free
+#define LOG_MAX_FILES 32
+#define LOG_FRAME_WAIT_MS 50          // Writer waits this long for a frame push before writing anyway
+#define LOG_FRAME_DEADLINE_MS RPM_BAR_FRAME_MS // Frames slower than this while recording count as late
+#define LOG_TASK_STACK 4096
+#define LOG_TASK_PRIORITY 0
+#define LOG_STORAGE_SD 0              // 1 = SD card on its own SPI bus instead of LittleFS
+#define LOG_SD_CS 5
+#define LOG_SD_SCK 14
+#define LOG_SD_MISO 27
+#define LOG_SD_MOSI 13
+#define MLG_STREAM_RECORDS 32         // Records encoded per write to the client in /log.mlg
+
+// Live telemetry WebSocket (served by the web task)
+#define TELEMETRY_PORT 81
+#define TELEMETRY_DEFAULT_HZ 10
+#define TELEMETRY_MAX_HZ 50
+#define TELEMETRY_KEYFRAME_MS 2000     // Full frame interval, deltas in between
 
 // Simulator configuration
 #define ENABLE_SIMULATOR 1  // Set to 0 to disable simulator completely
@@ -36,10 +81,28 @@ extern const char *password;
 // Debug configuration
 #define ENABLE_DEBUG_MODE 1  // Set to 0 to disable debug mode completely
 
+// Profiler configuration
+#define ENABLE_PROFILER 1    // Set to 0 to compile out all profiling scopes
+
+// Widget scheduler: pixels that non-critical widgets may push per frame.
+// ~36KB of SPI (~11ms at 27MHz); the RPM bar is never charged.
+#define SCHED_FRAME_PIXEL_BUDGET 12000
+
+// Theme switch: widgets repainted in the new palette per frame
+#define THEME_RESTYLE_PER_FRAME 2
+
+// Panel push path
+#define ENABLE_NATIVE_PUSH 1 // Push sprites as pre-expanded 18-bit lines (ILI9488 SPI), 0 = TFT_eSPI pushSprite
+
 // Font definitions
 #define AA_FONT_SMALL NotoSansBold15
 #define AA_FONT_LARGE NotoSansBold36
 
+// Boot: the splash stays up until the first ECU frame (but at least
+// SPLASH_MIN_HOLD_MS) or SPLASH_MAX_HOLD_MS without data
+#define SPLASH_MIN_HOLD_MS 800
+#define SPLASH_MAX_HOLD_MS 3000
+
 // Splash screen options
 #define SPLASH_MAZDUINO 0
 #define SPLASH_MERCY 1
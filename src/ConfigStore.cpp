@@ -0,0 +1,255 @@
+#include "ConfigStore.h"
+#include "Config.h"
+#include "DisplayConfig.h"
+#include "DataLogger.h"
+#include "ChannelBands.h"
+#include "Metrics.h"
+#include <Arduino.h>
+#include <Preferences.h>
+#include <EEPROM.h>
+#include <string.h>
+
+SystemSettings systemSettings;
+
+static const SystemSettings defaultSystemSettings = {
+  COMM_CAN,               // commMode
+  0,                      // displayToggle
+  DEFAULT_SPLASH_SCREEN   // splashScreen
+};
+
+struct RecordHeader {
+  uint16_t schema;
+  uint16_t length;
+  uint32_t crc;
+};
+
+struct RecordInfo {
+  const char *key;
+  void *data;
+  const void *defaults;
+  uint16_t size;
+  bool (*validate)(const void *data);
+};
+
+static bool validSystemSettingsRecord(const void *data) {
+  const SystemSettings &settings = *(const SystemSettings *)data;
+  return (settings.commMode == COMM_CAN || settings.commMode == COMM_SERIAL) &&
+         settings.displayToggle <= 1 &&
+         settings.splashScreen <= SPLASH_BIIES;
+}
+
+static bool validDisplayConfigRecord(const void *data) {
+  return validDisplayConfig(*(const DisplayConfiguration *)data);
+}
+
+static bool validLoggerSettingsRecord(const void *data) {
+  return validLoggerSettings(*(const LoggerSettings *)data);
+}
+
+static bool validChannelBandsRecord(const void *data) {
+  return validChannelBandTable(*(const ChannelBandTable *)data);
+}
+
+static const RecordInfo records[CONFIG_RECORD_COUNT] = {
+  {"system", &systemSettings, &defaultSystemSettings, sizeof(SystemSettings), validSystemSettingsRecord},
+  {"display", &currentDisplayConfig, &defaultDisplayConfig, sizeof(DisplayConfiguration), validDisplayConfigRecord},
+  {"logger", &loggerSettings, &defaultLoggerSettings, sizeof(LoggerSettings), validLoggerSettingsRecord},
+  {"bands", &channelBands, &defaultChannelBands, sizeof(ChannelBandTable), validChannelBandsRecord},
+};
+
+// Every record's payload type. The staging buffer is sized by the largest,
+// so a new record type goes here as well as into records[].
+union RecordPayload {
+  SystemSettings system;
+  DisplayConfiguration display;
+  LoggerSettings logger;
+  ChannelBandTable bands;
+};
+
+#define CONFIG_RECORD_MAX sizeof(RecordPayload)
+
+static_assert(sizeof(SystemSettings) <= CONFIG_RECORD_MAX, "SystemSettings outgrows the record buffer");
+static_assert(sizeof(DisplayConfiguration) <= CONFIG_RECORD_MAX, "DisplayConfiguration outgrows the record buffer");
+static_assert(sizeof(DisplayConfigurationV1) <= CONFIG_RECORD_MAX, "schema 1 display record outgrows the record buffer");
+static_assert(sizeof(LoggerSettings) <= CONFIG_RECORD_MAX, "LoggerSettings outgrows the record buffer");
+static_assert(sizeof(ChannelBandTable) <= CONFIG_RECORD_MAX, "ChannelBandTable outgrows the record buffer");
+static_assert(CONFIG_RECORD_MAX <= UINT16_MAX, "record length is stored as u16");
+
+// Staging for one record on its way to or from flash. Loads happen in
+// setup(), commits in the web task, never both at once.
+static uint8_t recordBuffer[sizeof(RecordHeader) + CONFIG_RECORD_MAX];
+
+static Preferences prefs;
+static bool storeOpen = false;
+static uint8_t dirtyMask = 0;
+static uint32_t lastChange = 0;
+static uint32_t committedCrc[CONFIG_RECORD_COUNT];
+static uint8_t committedMask = 0;   // Records whose flash copy matches committedCrc
+
+static uint32_t crc32(const uint8_t *data, size_t length) {
+  uint32_t crc = 0xFFFFFFFF;
+  while (length--) {
+    crc ^= *data++;
+    for (uint8_t bit = 0; bit < 8; bit++) {
+      crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+    }
+  }
+  return ~crc;
+}
+
+// Upgrade a payload written by an older schema, in place. Each case turns
+// one version into the next and falls through to the current one; a
+// version this firmware does not know (e.g. after an OTA rollback) fails
+// and the record loads its defaults without touching flash.
+static bool migrateRecord(ConfigRecordId id, uint16_t schema, uint8_t *payload, uint16_t &length) {
+  switch (schema) {
+    case 1:
+      if (id == CONFIG_RECORD_DISPLAY) {
+        if (length != sizeof(DisplayConfigurationV1)) {
+          return false;
+        }
+        DisplayConfigurationV1 old;
+        DisplayConfiguration config;
+        memcpy(&old, payload, sizeof(old));
+        upgradeDisplayConfigV1(old, config);
+        memcpy(payload, &config, sizeof(config));
+        length = sizeof(config);
+      }
+      // fall through
+    case CONFIG_SCHEMA_VERSION:
+      return true;
+    default:
+      return false;
+  }
+}
+
+static bool commitRecord(ConfigRecordId id) {
+  const RecordInfo &record = records[id];
+  if (record.size > CONFIG_RECORD_MAX) {
+    Serial.printf("[CONFIG] %s does not fit the record buffer\n", record.key);
+    return false;
+  }
+  uint32_t crc = crc32((const uint8_t *)record.data, record.size);
+  if ((committedMask & (1 << id)) && committedCrc[id] == crc) {
+    return true;   // Edited back to what flash already holds
+  }
+  RecordHeader header = {CONFIG_SCHEMA_VERSION, record.size, crc};
+  memcpy(recordBuffer, &header, sizeof(header));
+  memcpy(recordBuffer + sizeof(header), record.data, record.size);
+  size_t total = sizeof(header) + record.size;
+  if (prefs.putBytes(record.key, recordBuffer, total) != total) {
+    Serial.printf("[CONFIG] Writing %s failed\n", record.key);
+    return false;
+  }
+  committedCrc[id] = crc;
+  committedMask |= 1 << id;
+  countMetric(METRIC_CONFIG_COMMITS);
+  Serial.printf("[CONFIG] %s saved (%u bytes)\n", record.key, (unsigned)total);
+  return true;
+}
+
+// The EEPROM layout kept the toggle at 0, comm mode at 1, and both the
+// splash selection and the whole DisplayConfiguration at 10, so the splash
+// byte doubled as panel 0's data source. Import what that firmware would
+// have used; the old EEPROM blob is left alone so a rollback still finds it.
+static void importLegacyEeprom() {
+  if (!EEPROM.begin(EEPROM_SIZE)) {
+    return;
+  }
+  SystemSettings settings = defaultSystemSettings;
+  uint8_t toggle = EEPROM.read(0);
+  uint8_t mode = EEPROM.read(1);
+  uint8_t splash = EEPROM.read(10);
+  if (toggle <= 1) settings.displayToggle = toggle;
+  if (mode == COMM_CAN || mode == COMM_SERIAL) settings.commMode = mode;
+  if (splash <= SPLASH_BIIES) settings.splashScreen = splash;
+  systemSettings = settings;
+  commitRecord(CONFIG_RECORD_SYSTEM);
+
+  DisplayConfigurationV1 legacy;
+  DisplayConfiguration config;
+  EEPROM.get(10, legacy);
+  if (importLegacyDisplayConfig(legacy, config)) {
+    currentDisplayConfig = config;
+    commitRecord(CONFIG_RECORD_DISPLAY);
+  } else {
+    Serial.println("[CONFIG] EEPROM display configuration unusable, using defaults");
+  }
+  EEPROM.end();
+  Serial.println("[CONFIG] Imported settings from EEPROM");
+}
+
+void configStoreBegin() {
+  storeOpen = prefs.begin("dash", false);
+  if (!storeOpen) {
+    Serial.println("[CONFIG] NVS unavailable, using defaults");
+    return;
+  }
+  bool empty = true;
+  for (uint8_t i = 0; i < CONFIG_RECORD_COUNT; i++) {
+    if (prefs.isKey(records[i].key)) {
+      empty = false;
+    }
+  }
+  if (empty) {
+    importLegacyEeprom();
+  }
+}
+
+bool configLoad(ConfigRecordId id) {
+  const RecordInfo &record = records[id];
+  const char *problem = "missing";
+  size_t stored = storeOpen && prefs.isKey(record.key) ? prefs.getBytesLength(record.key) : 0;
+  if (stored >= sizeof(RecordHeader) && stored <= sizeof(recordBuffer) &&
+      prefs.getBytes(record.key, recordBuffer, stored) == stored) {
+    RecordHeader header;
+    memcpy(&header, recordBuffer, sizeof(header));
+    uint8_t *payload = recordBuffer + sizeof(header);
+    uint16_t length = header.length;
+    if (length != stored - sizeof(header) || crc32(payload, length) != header.crc) {
+      problem = "corrupt";
+    } else if (!migrateRecord(id, header.schema, payload, length) || length != record.size) {
+      problem = "unknown schema";
+    } else if (!record.validate(payload)) {
+      problem = "invalid";
+    } else {
+      memcpy(record.data, payload, record.size);
+      // Only an unmigrated record matches flash byte for byte
+      if (header.schema == CONFIG_SCHEMA_VERSION) {
+        committedCrc[id] = header.crc;
+        committedMask |= 1 << id;
+      }
+      return true;
+    }
+  } else if (stored != 0) {
+    problem = "corrupt";
+  }
+  memcpy(record.data, record.defaults, record.size);
+  Serial.printf("[CONFIG] %s %s, using defaults\n", record.key, problem);
+  return false;
+}
+
+void configMarkDirty(ConfigRecordId id) {
+  dirtyMask |= 1 << id;
+  lastChange = millis();
+}
+
+void configStoreService(uint32_t now) {
+  if (dirtyMask != 0 && now - lastChange >= CONFIG_COMMIT_DELAY_MS) {
+    configStoreFlush();
+  }
+}
+
+void configStoreFlush() {
+  if (!storeOpen) {
+    dirtyMask = 0;
+    return;
+  }
+  for (uint8_t i = 0; i < CONFIG_RECORD_COUNT; i++) {
+    if ((dirtyMask & (1 << i)) && commitRecord((ConfigRecordId)i)) {
+      dirtyMask &= ~(1 << i);
+    }
+  }
+  // A failed write is retried after another quiet period
+  lastChange = millis();
+}
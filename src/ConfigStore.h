@@ -0,0 +1,52 @@
+#ifndef CONFIG_STORE_H
+#define CONFIG_STORE_H
+
+#include <stdint.h>
+
+// Persistent settings, stored as typed records in NVS (Preferences). NVS
+// appends entries to its pages instead of rewriting a sector per change,
+// and records are only written after CONFIG_COMMIT_DELAY_MS without further
+// edits, so a burst of web changes costs one write per record.
+//
+// Each record is [schema u16][length u16][crc32 u32][payload]. A record
+// from an older schema goes through migrateRecord() before validation; a
+// missing, corrupt or invalid record loads the defaults instead.
+#define CONFIG_SCHEMA_VERSION 2   // 2: DISPLAY_MAX_PANELS panel slots
+
+enum ConfigRecordId {
+  CONFIG_RECORD_SYSTEM,   // SystemSettings
+  CONFIG_RECORD_DISPLAY,  // currentDisplayConfig
+  CONFIG_RECORD_LOGGER,   // loggerSettings
+  CONFIG_RECORD_BANDS,    // channelBands
+  CONFIG_RECORD_COUNT
+};
+
+// Small boot-time settings that used to live at fixed EEPROM addresses
+struct SystemSettings {
+  uint8_t commMode;       // COMM_CAN / COMM_SERIAL, applied on restart
+  uint8_t displayToggle;  // Web "toggle" switch state
+  uint8_t splashScreen;   // SPLASH_* selection
+};
+
+extern SystemSettings systemSettings;
+
+// Open the store. On the first boot after the EEPROM layout, imports the
+// old values (comm mode, toggle, splash, display configuration).
+void configStoreBegin();
+
+// Load one record into its live struct, or its defaults. Returns false
+// when the defaults were used.
+bool configLoad(ConfigRecordId id);
+
+// Note that a record's live struct changed. The write happens later from
+// configStoreService(); call from the web task.
+void configMarkDirty(ConfigRecordId id);
+
+// Commits records that have been quiet for CONFIG_COMMIT_DELAY_MS. Runs in
+// the web task.
+void configStoreService(uint32_t now);
+
+// Commit everything pending now, e.g. right before a restart
+void configStoreFlush();
+
+#endif // CONFIG_STORE_H
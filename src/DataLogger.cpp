@@ -0,0 +1,452 @@
+#include "DataLogger.h"
+#include "Config.h"
+#include "DataTypes.h"
+#include "ConfigStore.h"
+#include "Metrics.h"
+#include "text_utils.h"
+#include <Arduino.h>
+#include <esp_timer.h>
+#include <atomic>
+#include <stdlib.h>
+#include <string.h>
+#if LOG_STORAGE_SD
+#include <SD.h>
+#include <SPI.h>
+#define LOG_FS SD
+#else
+#include <LittleFS.h>
+#define LOG_FS LittleFS
+#endif
+
+#define LOG_DIR "/logs"
+#define LOG_WRITE_RECORDS (LOG_WRITE_BYTES / sizeof(LogRecord))
+
+static_assert(LOG_RING_RECORDS > 2 * LOG_WRITE_RECORDS, "ring must hold pre-trigger history plus write headroom");
+
+const LoggerSettings defaultLoggerSettings = {
+  20,     // rateHz
+  5,      // preTriggerSec
+  0,      // rpmStart (off)
+  0       // tpsStart (off)
+};
+
+LoggerSettings loggerSettings;
+
+// The ring. head is only advanced by the sampler. tail belongs to the
+// sampler while armed (it trims history to the pre-trigger window) and to
+// the writer while recording or draining; the state switch hands it over.
+static LogRecord ring[LOG_RING_RECORDS];
+static std::atomic<uint32_t> head(0);
+static std::atomic<uint32_t> tail(0);
+static std::atomic<uint8_t> state(LOGGER_OFF);
+static std::atomic<uint32_t> dropped(0);
+static volatile bool startRequest = false;
+static volatile bool stopRequest = false;
+static volatile uint32_t preTriggerRecords = 0;
+static volatile uint32_t triggerRecord = 0;   // head when the recording started
+
+// Sampler-only state
+static bool manualRecording = false;
+static uint32_t lastTriggerHigh = 0;
+static int64_t lastSampleUs = 0;
+static volatile uint32_t samplePeriodUs = 0;
+
+// Deadline misses for the current recording. Each is written by one side
+// (sampler, render loop, writer) and reset when a recording starts.
+static volatile uint32_t lateSamples = 0;
+static volatile uint32_t maxSampleGapUs = 0;
+static std::atomic<uint32_t> lateFrames(0);
+static volatile uint32_t maxWriteUs = 0;
+
+// Writer-only state, read by getLoggerStatus()
+static volatile uint32_t fileNumber = 0;
+static volatile uint32_t fileRecords = 0;
+static uint32_t nextFileNumber = 1;
+
+static esp_timer_handle_t sampleTimer = NULL;
+static TaskHandle_t writerTask = NULL;
+
+static int16_t sampleChannel(uint8_t source) {
+  int32_t value = toFixed(getDataValue(source), getLogChannel(source).decimals);
+  if (value > INT16_MAX) return INT16_MAX;
+  if (value < INT16_MIN) return INT16_MIN;
+  return (int16_t)value;
+}
+
+// esp_timer callback (esp_timer task, core 0): a few microseconds per sample
+static void sampleChannels(void *arg) {
+  uint8_t current = state.load(std::memory_order_acquire);
+  if (current != LOGGER_ARMED && current != LOGGER_RECORDING) {
+    return;
+  }
+  uint32_t now = millis();
+  int64_t nowUs = esp_timer_get_time();
+  if (current == LOGGER_RECORDING) {
+    // Flash writes stall the caches; a late callback is the sign
+    uint32_t gap = (uint32_t)(nowUs - lastSampleUs);
+    if (gap > samplePeriodUs + samplePeriodUs / 2) {
+      lateSamples++;
+    }
+    if (gap > maxSampleGapUs) {
+      maxSampleGapUs = gap;
+    }
+  }
+  lastSampleUs = nowUs;
+
+  uint32_t h = head.load(std::memory_order_relaxed);
+  if (current == LOGGER_RECORDING && h - tail.load(std::memory_order_acquire) >= LOG_RING_RECORDS) {
+    // Writer fell behind; never overwrite what it has not written yet
+    dropped.fetch_add(1, std::memory_order_relaxed);
+  } else {
+    LogRecord &record = ring[h % LOG_RING_RECORDS];
+    record.timeMs = now;
+    for (uint8_t i = 0; i < DATA_SOURCE_COUNT; i++) {
+      record.values[i] = sampleChannel(i);
+    }
+    head.store(++h, std::memory_order_release);
+  }
+
+  bool triggered = (loggerSettings.rpmStart != 0 && rpm >= loggerSettings.rpmStart) ||
+                   (loggerSettings.tpsStart != 0 && tps >= loggerSettings.tpsStart);
+  if (current == LOGGER_ARMED) {
+    if (h - tail.load(std::memory_order_relaxed) > preTriggerRecords) {
+      tail.store(h - preTriggerRecords, std::memory_order_relaxed);
+    }
+    if (startRequest || triggered) {
+      manualRecording = startRequest;
+      startRequest = false;
+      stopRequest = false;
+      lastTriggerHigh = now;
+      triggerRecord = h;
+      lateSamples = 0;
+      maxSampleGapUs = 0;
+      lateFrames.store(0, std::memory_order_relaxed);
+      state.store(LOGGER_RECORDING, std::memory_order_release);
+    }
+  } else {
+    if (triggered) {
+      lastTriggerHigh = now;
+    }
+    if (stopRequest || (!manualRecording && now - lastTriggerHigh >= LOG_STOP_HOLD_MS)) {
+      stopRequest = false;
+      state.store(LOGGER_DRAINING, std::memory_order_release);
+    }
+  }
+}
+
+static bool mountStorage() {
+#if LOG_STORAGE_SD
+  static SPIClass sdSpi(HSPI);
+  sdSpi.begin(LOG_SD_SCK, LOG_SD_MISO, LOG_SD_MOSI, LOG_SD_CS);
+  return SD.begin(LOG_SD_CS, sdSpi);
+#else
+  return LittleFS.begin(true);
+#endif
+}
+
+static uint32_t storageTotal() {
+  return (uint32_t)LOG_FS.totalBytes();
+}
+
+static uint32_t storageUsed() {
+  return (uint32_t)LOG_FS.usedBytes();
+}
+
+void getLogFilePath(uint32_t number, char *path, size_t size) {
+  snprintf(path, size, LOG_DIR "/%05u.mzl", (unsigned)number);
+}
+
+static uint32_t logNumberFromName(const char *name) {
+  const char *base = strrchr(name, '/');
+  return (uint32_t)strtoul(base != NULL ? base + 1 : name, NULL, 10);
+}
+
+uint8_t listLogFiles(LogFileInfo *files, uint8_t max) {
+  uint8_t count = 0;
+  File dir = LOG_FS.open(LOG_DIR);
+  if (!dir || !dir.isDirectory()) {
+    return 0;
+  }
+  for (File entry = dir.openNextFile(); entry; entry = dir.openNextFile()) {
+    uint32_t number = logNumberFromName(entry.name());
+    uint32_t size = entry.size();
+    entry.close();
+    if (number == 0) {
+      continue;
+    }
+    // Insertion sort by number; directory order is not guaranteed
+    uint8_t slot = count;
+    while (slot > 0 && files[slot - 1].number > number) {
+      if (slot < max) files[slot] = files[slot - 1];
+      slot--;
+    }
+    if (slot < max) {
+      files[slot].number = number;
+      files[slot].size = size;
+      if (count < max) count++;
+    }
+  }
+  dir.close();
+  return count;
+}
+
+// Make room by deleting the oldest logs
+static bool reserveSpace() {
+  LogFileInfo oldest;
+  while (storageTotal() - storageUsed() < LOG_MIN_FREE_BYTES) {
+    if (listLogFiles(&oldest, 1) == 0) {
+      return false;
+    }
+    char path[24];
+    getLogFilePath(oldest.number, path, sizeof(path));
+    LOG_FS.remove(path);
+    Serial.printf("[LOG] Deleted %s to free space\n", path);
+  }
+  return true;
+}
+
+static File openLogFile(uint32_t firstRecord, uint32_t historyRecords) {
+  File file;
+  if (!reserveSpace()) {
+    Serial.println("[LOG] Storage full");
+    return file;
+  }
+  char path[24];
+  getLogFilePath(nextFileNumber, path, sizeof(path));
+  file = LOG_FS.open(path, "w");
+  if (!file) {
+    Serial.printf("[LOG] Could not create %s\n", path);
+    return file;
+  }
+  LogFileHeader header;
+  memcpy(header.magic, LOG_FILE_MAGIC, sizeof(header.magic));
+  header.version = LOG_FILE_VERSION;
+  header.channelCount = DATA_SOURCE_COUNT;
+  header.recordSize = sizeof(LogRecord);
+  header.rateHz = loggerSettings.rateHz;
+  header.preTriggerRecords = historyRecords;
+  header.startMs = ring[firstRecord % LOG_RING_RECORDS].timeMs;
+  file.write((const uint8_t *)&header, sizeof(header));
+  fileNumber = nextFileNumber++;
+  fileRecords = 0;
+  maxWriteUs = 0;
+  Serial.printf("[LOG] Recording to %s (%u records of history)\n", path, (unsigned)historyRecords);
+  return file;
+}
+
+// Low-priority writer on core 0. Flash writes stall the caches of both
+// cores, so each one is started right after a frame push (loggerFrameDone)
+// to give it the whole gap before the next render deadline, and writes
+// are batched to LOG_WRITE_BYTES so they happen rarely.
+static void logWriterTask(void *parameter) {
+  File file;
+  bool failed = false;
+  uint32_t lastWrite = 0;
+  uint32_t lastSync = 0;
+  while (1) {
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(LOG_FRAME_WAIT_MS));
+    uint8_t current = state.load(std::memory_order_acquire);
+    if (current != LOGGER_RECORDING && current != LOGGER_DRAINING) {
+      continue;
+    }
+    uint32_t now = millis();
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    uint32_t h = head.load(std::memory_order_acquire);
+
+    if (!file && !failed) {
+      file = openLogFile(t, triggerRecord - t);
+      failed = !file;
+      lastWrite = lastSync = now;
+    }
+    if (failed) {
+      // Nothing to write to: drop the data and let the sampler stop
+      tail.store(h, std::memory_order_release);
+      stopRequest = true;
+    } else if (h - t >= LOG_WRITE_RECORDS ||
+               (h != t && (current == LOGGER_DRAINING || now - lastWrite >= LOG_FLUSH_MAX_AGE_MS))) {
+      // One contiguous run per pass; a wrapped remainder goes next pass
+      uint32_t start = t % LOG_RING_RECORDS;
+      uint32_t count = h - t;
+      if (count > LOG_WRITE_RECORDS) count = LOG_WRITE_RECORDS;
+      if (count > LOG_RING_RECORDS - start) count = LOG_RING_RECORDS - start;
+      size_t bytes = count * sizeof(LogRecord);
+      int64_t writeStart = esp_timer_get_time();
+      if (file.write((const uint8_t *)&ring[start], bytes) != bytes) {
+        Serial.println("[LOG] Write failed, stopping");
+        failed = true;
+        continue;
+      }
+      tail.store(t + count, std::memory_order_release);
+      fileRecords += count;
+      lastWrite = now;
+      if (now - lastSync >= LOG_SYNC_MS) {
+        file.flush();
+        lastSync = now;
+      }
+      uint32_t writeUs = (uint32_t)(esp_timer_get_time() - writeStart);
+      if (writeUs > maxWriteUs) {
+        maxWriteUs = writeUs;
+      }
+      continue;
+    }
+
+    if (current == LOGGER_DRAINING && tail.load(std::memory_order_relaxed) == h) {
+      if (file) {
+        file.close();
+        Serial.printf("[LOG] Log %u closed, %u records; %u late samples (max gap %u us), %u late frames, slowest write %u us\n",
+                      (unsigned)fileNumber, (unsigned)fileRecords, (unsigned)lateSamples, (unsigned)maxSampleGapUs,
+                      (unsigned)lateFrames.load(std::memory_order_relaxed), (unsigned)maxWriteUs);
+      }
+      failed = false;
+      state.store(LOGGER_ARMED, std::memory_order_release);
+    }
+  }
+}
+
+void loggerApplySettings() {
+  uint32_t history = (uint32_t)loggerSettings.preTriggerSec * loggerSettings.rateHz;
+  if (history > LOG_RING_RECORDS - 2 * LOG_WRITE_RECORDS) {
+    history = LOG_RING_RECORDS - 2 * LOG_WRITE_RECORDS;
+  }
+  preTriggerRecords = history;
+  samplePeriodUs = 1000000UL / loggerSettings.rateHz;
+  if (sampleTimer != NULL) {
+    esp_timer_stop(sampleTimer);
+    esp_timer_start_periodic(sampleTimer, samplePeriodUs);
+  }
+}
+
+bool validLoggerSettings(const LoggerSettings &settings) {
+  return settings.rateHz >= 1 && settings.rateHz <= LOG_MAX_HZ &&
+         settings.preTriggerSec <= 60 && settings.tpsStart <= 100;
+}
+
+void setupDataLogger() {
+  configLoad(CONFIG_RECORD_LOGGER);
+  if (!mountStorage()) {
+    Serial.println("[LOG] No log storage, datalogger off");
+    return;
+  }
+  LOG_FS.mkdir(LOG_DIR);
+  LogFileInfo files[LOG_MAX_FILES];
+  uint8_t count = listLogFiles(files, LOG_MAX_FILES);
+  for (uint8_t i = 0; i < count; i++) {
+    if (files[i].number >= nextFileNumber) {
+      nextFileNumber = files[i].number + 1;
+    }
+  }
+
+  xTaskCreatePinnedToCore(logWriterTask, "Log Task", LOG_TASK_STACK, NULL, LOG_TASK_PRIORITY, &writerTask, 0);
+  metricsRegisterTask("log", writerTask);
+
+  esp_timer_create_args_t timerArgs = {};
+  timerArgs.callback = sampleChannels;
+  timerArgs.name = "log sample";
+  esp_timer_create(&timerArgs, &sampleTimer);
+  state.store(LOGGER_ARMED, std::memory_order_release);
+  loggerApplySettings();
+  Serial.printf("[LOG] Armed at %u Hz, %u/%u KB used\n", loggerSettings.rateHz,
+                (unsigned)(storageUsed() / 1024), (unsigned)(storageTotal() / 1024));
+}
+
+void loggerStart() {
+  startRequest = true;
+}
+
+void loggerStop() {
+  stopRequest = true;
+}
+
+void loggerFrameDone(uint32_t frameUs) {
+  uint8_t current = state.load(std::memory_order_relaxed);
+  if (writerTask != NULL && (current == LOGGER_RECORDING || current == LOGGER_DRAINING)) {
+    if (frameUs > LOG_FRAME_DEADLINE_MS * 1000UL) {
+      lateFrames.fetch_add(1, std::memory_order_relaxed);
+    }
+    xTaskNotifyGive(writerTask);
+  }
+}
+
+void getLoggerStatus(LoggerStatus &status) {
+  status.state = state.load(std::memory_order_acquire);
+  status.manual = manualRecording;
+  status.fileNumber = fileNumber;
+  status.records = fileRecords;
+  status.dropped = dropped.load(std::memory_order_relaxed);
+  status.pending = status.state == LOGGER_ARMED ? 0 :
+                   head.load(std::memory_order_relaxed) - tail.load(std::memory_order_relaxed);
+  status.storageUsed = status.state == LOGGER_OFF ? 0 : storageUsed();
+  status.storageTotal = status.state == LOGGER_OFF ? 0 : storageTotal();
+  status.lateSamples = lateSamples;
+  status.maxSampleGapUs = maxSampleGapUs;
+  status.lateFrames = lateFrames.load(std::memory_order_relaxed);
+  status.maxWriteUs = maxWriteUs;
+}
+
+const char *getLoggerStateName(uint8_t state) {
+  switch (state) {
+    case LOGGER_ARMED: return "armed";
+    case LOGGER_RECORDING: return "recording";
+    case LOGGER_DRAINING: return "draining";
+    default: return "off";
+  }
+}
+
+bool deleteAllLogs() {
+  if (state.load(std::memory_order_acquire) != LOGGER_ARMED) {
+    return false;
+  }
+  // Listing is capped at LOG_MAX_FILES, so repeat while that makes progress
+  LogFileInfo files[LOG_MAX_FILES];
+  uint8_t count;
+  bool removed = true;
+  while (removed && (count = listLogFiles(files, LOG_MAX_FILES)) > 0) {
+    removed = false;
+    char path[24];
+    for (uint8_t i = 0; i < count; i++) {
+      getLogFilePath(files[i].number, path, sizeof(path));
+      removed |= LOG_FS.remove(path);
+    }
+  }
+  return true;
+}
+
+static File reader;
+
+bool openLogForRead(uint32_t number, LogFileHeader &header, uint32_t &records) {
+  closeLogForRead();
+  if (state.load(std::memory_order_acquire) == LOGGER_OFF || number == 0) {
+    return false;
+  }
+  char path[24];
+  getLogFilePath(number, path, sizeof(path));
+  if (!LOG_FS.exists(path)) {
+    return false;
+  }
+  reader = LOG_FS.open(path, "r");
+  if (!reader) {
+    return false;
+  }
+  if (reader.read((uint8_t *)&header, sizeof(header)) != sizeof(header) ||
+      memcmp(header.magic, LOG_FILE_MAGIC, sizeof(header.magic)) != 0 ||
+      header.version != LOG_FILE_VERSION || header.channelCount != DATA_SOURCE_COUNT ||
+      header.recordSize != sizeof(LogRecord)) {
+    closeLogForRead();
+    return false;
+  }
+  records = (reader.size() - sizeof(header)) / sizeof(LogRecord);
+  return true;
+}
+
+size_t readLogRecords(LogRecord *records, size_t max) {
+  if (!reader) {
+    return 0;
+  }
+  return reader.read((uint8_t *)records, max * sizeof(LogRecord)) / sizeof(LogRecord);
+}
+
+void closeLogForRead() {
+  if (reader) {
+    reader.close();
+  }
+}
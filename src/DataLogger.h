@@ -0,0 +1,115 @@
+#ifndef DATA_LOGGER_H
+#define DATA_LOGGER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "DisplayConfig.h"
+
+// On-device datalogger. An esp_timer callback samples every channel at the
+// configured rate into a preallocated RAM ring, so the last few seconds
+// are always there as pre-trigger history. Once a trigger fires, a
+// priority-0 task on core 0 drains the ring into a log file in large
+// sequential writes, each started right after the render loop pushes a
+// frame. Nothing runs on the render core except that notification.
+//
+// Log file: LogFileHeader followed by LogRecord entries, one per sample.
+
+#define LOG_FILE_MAGIC "MZLG"
+#define LOG_FILE_VERSION 1
+
+// How a channel is scaled into a record, also used by the log exporters.
+// The channel name is getDataSourceName().
+struct LogChannel {
+  const char *unit;
+  uint8_t decimals;   // Stored value = round(value * 10^decimals)
+};
+
+struct LogRecord {
+  uint32_t timeMs;                      // millis() when sampled
+  int16_t values[DATA_SOURCE_COUNT];    // Fixed-point per LogChannel.decimals
+};
+
+struct LogFileHeader {
+  char magic[4];
+  uint8_t version;
+  uint8_t channelCount;     // DATA_SOURCE_COUNT when written
+  uint16_t recordSize;      // sizeof(LogRecord) when written
+  uint16_t rateHz;
+  uint16_t preTriggerRecords;
+  uint32_t startMs;         // Time of the first record
+};
+
+// Persisted through ConfigStore (CONFIG_RECORD_LOGGER)
+struct LoggerSettings {
+  uint8_t rateHz;           // 1..LOG_MAX_HZ
+  uint8_t preTriggerSec;    // History kept ahead of a trigger
+  uint16_t rpmStart;        // Start when RPM reaches this (0 = off)
+  uint8_t tpsStart;         // Start when TPS reaches this % (0 = off)
+};
+
+enum LoggerState {
+  LOGGER_OFF,         // No storage
+  LOGGER_ARMED,       // Sampling into the ring, waiting for a trigger
+  LOGGER_RECORDING,   // Ring is being written to a file
+  LOGGER_DRAINING     // Stopped; writing what is left, then closing
+};
+
+struct LoggerStatus {
+  uint8_t state;            // LoggerState
+  bool manual;              // Current recording was started by hand
+  uint32_t fileNumber;      // File being (or last) written, 0 = none yet
+  uint32_t records;         // Records written to that file
+  uint32_t dropped;         // Samples lost because the ring was full
+  uint32_t pending;         // Records in the ring waiting for the writer
+  uint32_t storageUsed;
+  uint32_t storageTotal;
+  // Deadline misses during the current (or last) recording, to see what
+  // the file writes cost the sampler and the render loop
+  uint32_t lateSamples;     // Sampler ran more than half a period late
+  uint32_t maxSampleGapUs;  // Longest time between two samples
+  uint32_t lateFrames;      // Frames slower than LOG_FRAME_DEADLINE_MS
+  uint32_t maxWriteUs;      // Slowest write (and sync) of one run
+};
+
+extern LoggerSettings loggerSettings;
+extern const LoggerSettings defaultLoggerSettings;
+
+// Mount storage, start the sampler and the writer task (setup())
+void setupDataLogger();
+
+// Manual trigger; a manual recording runs until loggerStop()
+void loggerStart();
+void loggerStop();
+
+// Apply loggerSettings after a change (rate, thresholds, pre-trigger)
+void loggerApplySettings();
+bool validLoggerSettings(const LoggerSettings &settings);
+
+// Render loop hook: a frame was just pushed, a good moment to write.
+// frameUs is how long it took to render, counted against the deadline.
+void loggerFrameDone(uint32_t frameUs);
+
+void getLoggerStatus(LoggerStatus &status);
+const LogChannel &getLogChannel(uint8_t dataSource);
+const char *getLoggerStateName(uint8_t state);
+
+// Log files are /logs/<number>.mzl, numbered from 1
+struct LogFileInfo {
+  uint32_t number;
+  uint32_t size;
+};
+
+void getLogFilePath(uint32_t number, char *path, size_t size);
+// Oldest first. Returns how many entries were filled.
+uint8_t listLogFiles(LogFileInfo *files, uint8_t max);
+// Only while no recording is in progress
+bool deleteAllLogs();
+
+// Sequential read access for exporters (web task, one log at a time).
+// Fails for a missing log or one written by a build with another record
+// layout; records is the number of whole records in the file.
+bool openLogForRead(uint32_t number, LogFileHeader &header, uint32_t &records);
+size_t readLogRecords(LogRecord *records, size_t max);
+void closeLogForRead();
+
+#endif // DATA_LOGGER_H
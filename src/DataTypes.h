@@ -39,9 +39,6 @@ extern bool clientConnected;
 extern bool debugMode;
 extern float cpuUsage;
 extern float fps;
-extern uint32_t frameCount;
-extern uint32_t lastFpsUpdate;
-extern uint32_t lastCpuMeasure;
 extern uint32_t loopStartTime;
 
 #endif // DATATYPES_H
@@ -0,0 +1,163 @@
+#include "DigitRenderer.h"
+#include "Profiler.h"
+#include "NativePush.h"
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <string.h>
+
+// External display objects
+extern TFT_eSPI display;
+extern TFT_eSprite spr;
+
+static DigitRenderStats digitStats = {0, 0, 0, 0};
+
+void initDigitField(DigitField &field, int16_t rightX, int16_t y, uint8_t cells, uint8_t cellHeight, uint8_t maxWidth, const uint8_t *font, uint16_t fgColor, uint16_t bgColor) {
+  field.x = rightX;
+  field.y = y;
+  field.cells = (cells > DIGIT_FIELD_MAX_CELLS) ? DIGIT_FIELD_MAX_CELLS : cells;
+  field.maxWidth = maxWidth;
+  field.cellWidth = 0;
+  field.pointWidth = 0;
+  field.cellHeight = cellHeight;
+  field.fgColor = fgColor;
+  field.bgColor = bgColor;
+  field.font = font;
+  field.valid = false;
+  memset(field.shown, ' ', field.cells);
+  field.shown[field.cells] = '\0';
+}
+
+void setDigitFieldColors(DigitField &field, uint16_t fgColor, uint16_t bgColor) {
+  if (field.fgColor != fgColor || field.bgColor != bgColor) {
+    field.fgColor = fgColor;
+    field.bgColor = bgColor;
+    field.valid = false;
+  }
+}
+
+void invalidateDigitField(DigitField &field) {
+  field.valid = false;
+}
+
+static uint8_t slotWidth(const DigitField &field, char c) {
+  return (c == '.') ? field.pointWidth : field.cellWidth;
+}
+
+static int8_t pointIndex(const char *cells) {
+  const char *point = strchr(cells, '.');
+  return point ? (int8_t)(point - cells) : -1;
+}
+
+static int16_t fieldWidth(const DigitField &field, const char *cells) {
+  int16_t width = 0;
+  for (uint8_t i = 0; i < field.cells; i++) {
+    width += slotWidth(field, cells[i]);
+  }
+  return width;
+}
+
+// Draw text right-aligned into the field. Only cells whose character differs
+// from what is already on the panel are pushed. Returns the number of cells
+// that were redrawn.
+uint8_t drawDigitField(DigitField &field, const char *text) {
+  char next[DIGIT_FIELD_MAX_CELLS + 1];
+  uint8_t len = strlen(text);
+  if (len > field.cells) {
+    text += len - field.cells; // Keep the least significant characters
+    len = field.cells;
+  }
+  uint8_t pad = field.cells - len;
+  memset(next, ' ', pad);
+  memcpy(next + pad, text, len);
+  next[field.cells] = '\0';
+
+  // Slots only keep their positions while the decimal point stays put;
+  // otherwise the whole field has to be laid out again
+  if (field.valid && pointIndex(next) != pointIndex(field.shown)) {
+    field.valid = false;
+  }
+
+  uint8_t changed = 0;
+  for (uint8_t i = 0; i < field.cells; i++) {
+    if (!field.valid || next[i] != field.shown[i]) {
+      changed++;
+    }
+  }
+  if (changed == 0) {
+    return 0;
+  }
+
+  spr.loadFont(field.font);
+  if (field.cellWidth == 0) {
+    field.cellWidth = spr.textWidth("8");
+    field.pointWidth = spr.textWidth(".");
+    if (field.maxWidth && field.cellWidth * field.cells > field.maxWidth) {
+      field.cellWidth = field.maxWidth / field.cells;
+    }
+  }
+
+  if (!field.valid) {
+    // Clear the widest possible footprint so no stale glyphs survive a re-layout
+    int16_t clearWidth = max(fieldWidth(field, field.shown), (int16_t)(field.cellWidth * field.cells));
+    display.fillRect(field.x - clearWidth, field.y, clearWidth, field.cellHeight, field.bgColor);
+    PROFILE_SPI(clearWidth * field.cellHeight);
+  }
+
+  spr.createSprite(field.cellWidth, field.cellHeight);
+  spr.setTextColor(field.fgColor, field.bgColor, true);
+  spr.setTextDatum(TC_DATUM);
+
+  // Left to right: a narrow '.' slot still pushes a full cell-wide sprite,
+  // and the digit after it is drawn on top of the overlap
+  uint32_t pushed = 0;
+  int16_t left = field.x - fieldWidth(field, next);
+  char glyph[2] = {0, 0};
+  for (uint8_t i = 0; i < field.cells; i++) {
+    uint8_t w = slotWidth(field, next[i]);
+    bool redraw = !field.valid || next[i] != field.shown[i];
+    field.shown[i] = next[i];
+    if (redraw && !(next[i] == ' ' && !field.valid)) { // Blank cells were already cleared above
+      spr.fillSprite(field.bgColor);
+      if (next[i] != ' ') {
+        glyph[0] = next[i];
+        spr.drawString(glyph, w / 2, 0);
+      }
+      pushSpriteNative(spr, left, field.y);
+      PROFILE_SPI(field.cellWidth * field.cellHeight);
+      pushed += (uint32_t)field.cellWidth * field.cellHeight;
+    }
+    left += w;
+  }
+  spr.deleteSprite();
+
+  digitStats.updates++;
+  digitStats.cellsDrawn += changed;
+  digitStats.pixelsPushed += pushed;
+  digitStats.fullPixels += (uint32_t)fieldWidth(field, next) * field.cellHeight;
+
+  field.valid = true;
+  return changed;
+}
+
+const DigitRenderStats &getDigitRenderStats() {
+  return digitStats;
+}
+
+void resetDigitRenderStats() {
+  memset(&digitStats, 0, sizeof(digitStats));
+}
+
+void printDigitRenderStats() {
+  Serial.println("=== DIGIT RENDER STATS ===");
+  Serial.printf("Updates: %u\n", digitStats.updates);
+  Serial.printf("Cells drawn: %u\n", digitStats.cellsDrawn);
+  Serial.printf("Pixels pushed: %u (full redraw: %u)\n", digitStats.pixelsPushed, digitStats.fullPixels);
+  if (digitStats.updates > 0) {
+    Serial.printf("Pixels/update: %u (full redraw: %u)\n",
+                  digitStats.pixelsPushed / digitStats.updates, digitStats.fullPixels / digitStats.updates);
+  }
+  if (digitStats.fullPixels > 0) {
+    Serial.printf("Saved: %.1f%%\n", 100.0f - (100.0f * digitStats.pixelsPushed / digitStats.fullPixels));
+  }
+  Serial.println("==========================");
+}
@@ -0,0 +1,43 @@
+#ifndef DIGIT_RENDERER_H
+#define DIGIT_RENDERER_H
+
+#include <stdint.h>
+
+#define DIGIT_FIELD_MAX_CELLS 8
+
+// A right-aligned run of fixed-advance character cells. The field remembers
+// what is on the panel and only redraws the cells whose character changed.
+// Digits and signs share one slot width; a decimal point gets a narrow slot.
+struct DigitField {
+  int16_t x;                // Right edge of the field
+  int16_t y;                // Top edge of the field
+  uint8_t cells;            // Number of character slots
+  uint8_t maxWidth;         // Width budget for the whole field (0 = unlimited)
+  uint8_t cellWidth;        // Slot width for digits (measured on first draw)
+  uint8_t pointWidth;       // Slot width for '.' (measured on first draw)
+  uint8_t cellHeight;       // Height of each slot
+  uint16_t fgColor;
+  uint16_t bgColor;
+  const uint8_t *font;      // Smooth font used for the digits
+  char shown[DIGIT_FIELD_MAX_CELLS + 1]; // Characters currently on the panel
+  bool valid;               // false until the first draw / after invalidate
+};
+
+// Pixel accounting so the saving over full-sprite redraws can be checked
+struct DigitRenderStats {
+  uint32_t updates;          // drawDigitField() calls that changed something
+  uint32_t cellsDrawn;       // Cells pushed to the panel
+  uint32_t pixelsPushed;     // Pixels actually pushed
+  uint32_t fullPixels;       // Pixels a full-field redraw would have pushed
+};
+
+void initDigitField(DigitField &field, int16_t rightX, int16_t y, uint8_t cells, uint8_t cellHeight, uint8_t maxWidth, const uint8_t *font, uint16_t fgColor, uint16_t bgColor);
+void setDigitFieldColors(DigitField &field, uint16_t fgColor, uint16_t bgColor);
+void invalidateDigitField(DigitField &field);
+uint8_t drawDigitField(DigitField &field, const char *text);
+
+const DigitRenderStats &getDigitRenderStats();
+void resetDigitRenderStats();
+void printDigitRenderStats();
+
+#endif // DIGIT_RENDERER_H
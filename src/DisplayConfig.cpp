@@ -1,21 +1,24 @@
 #include "DisplayConfig.h"
 #include "DataTypes.h"
 #include "Config.h"
-#include <EEPROM.h>
+#include "Theme.h"
+#include "ConfigStore.h"
+#include <Arduino.h>
 #include <TFT_eSPI.h>
+#include <string.h>
 
 // Default display configuration
 DisplayConfiguration defaultDisplayConfig = {
   // Default panels configuration - New layout to avoid RPM bar collision
   {
-    {DATA_SOURCE_AFR, DATA_TYPE_FLOAT, 0, 1, true, "AFR", "", TFT_GREEN},      // Position 0: Left-Top
-    {DATA_SOURCE_TPS, DATA_TYPE_INT, 1, 0, true, "TPS", "%", TFT_WHITE},       // Position 1: Left-Middle  
-    {DATA_SOURCE_IAT, DATA_TYPE_UINT, 2, 0, true, "IAT", "°C", TFT_WHITE},     // Position 2: Left-Bottom
-    {DATA_SOURCE_MAP, DATA_TYPE_INT, 3, 0, true, "MAP", "kPa", TFT_WHITE},     // Position 3: Right-Top
-    {DATA_SOURCE_ADV, DATA_TYPE_INT, 4, 0, true, "ADV", "°", TFT_RED},         // Position 4: Right-Middle
-    {DATA_SOURCE_FP, DATA_TYPE_INT, 5, 0, true, "FP", "psi", TFT_WHITE},       // Position 5: Right-Bottom
-    {DATA_SOURCE_COOLANT, DATA_TYPE_UINT, 6, 0, true, "Coolant", "°C", TFT_WHITE}, // Position 6: Bottom-Left
-    {DATA_SOURCE_VOLTAGE, DATA_TYPE_FLOAT, 7, 1, true, "Voltage", "V", TFT_GREEN}  // Position 7: Bottom-Right
+    {DATA_SOURCE_AFR, DATA_TYPE_FLOAT, 0, 1, true, "AFR", "", THEME_NORMAL},      // Position 0: Left-Top
+    {DATA_SOURCE_TPS, DATA_TYPE_INT, 1, 0, true, "TPS", "%", THEME_TEXT},       // Position 1: Left-Middle  
+    {DATA_SOURCE_IAT, DATA_TYPE_UINT, 2, 0, true, "IAT", "°C", THEME_TEXT},     // Position 2: Left-Bottom
+    {DATA_SOURCE_MAP, DATA_TYPE_INT, 3, 0, true, "MAP", "kPa", THEME_TEXT},     // Position 3: Right-Top
+    {DATA_SOURCE_ADV, DATA_TYPE_INT, 4, 0, true, "ADV", "°", THEME_CRITICAL},         // Position 4: Right-Middle
+    {DATA_SOURCE_FP, DATA_TYPE_INT, 5, 0, true, "FP", "psi", THEME_TEXT},       // Position 5: Right-Bottom
+    {DATA_SOURCE_COOLANT, DATA_TYPE_UINT, 6, 0, true, "Coolant", "°C", THEME_TEXT}, // Position 6: Bottom-Left
+    {DATA_SOURCE_VOLTAGE, DATA_TYPE_FLOAT, 7, 1, true, "Voltage", "V", THEME_NORMAL}  // Position 7: Bottom-Right
   },
   // Default indicators configuration
   {
@@ -38,29 +41,19 @@ DisplayConfiguration defaultDisplayConfig = {
 DisplayConfiguration currentDisplayConfig;
 
 void initializeDisplayConfig() {
-  // Load configuration from EEPROM or use default
+  // Load configuration from the config store or use default
   loadDisplayConfig();
 }
 
 void saveDisplayConfig() {
-  // Save to EEPROM starting from address 10 (avoid conflict with existing settings)
-  EEPROM.put(10, currentDisplayConfig);
-  EEPROM.commit();
-  Serial.println("Display configuration saved to EEPROM");
+  // Coalesced: the config store writes it once edits have settled
+  configMarkDirty(CONFIG_RECORD_DISPLAY);
 }
 
 void loadDisplayConfig() {
-  // Try to load from EEPROM
-  DisplayConfiguration tempConfig;
-  EEPROM.get(10, tempConfig);
-  
-  // Check if loaded config is valid (simple validation)
-  if (tempConfig.activePanelCount <= 8 && tempConfig.activeIndicatorCount <= 8) {
-    currentDisplayConfig = tempConfig;
-    Serial.println("Display configuration loaded from EEPROM");
+  if (configLoad(CONFIG_RECORD_DISPLAY)) {
+    Serial.println("Display configuration loaded");
   } else {
-    // Use default configuration
-    currentDisplayConfig = defaultDisplayConfig;
     Serial.println("Using default display configuration");
   }
 }
@@ -71,6 +64,70 @@ void resetDisplayConfigToDefault() {
   Serial.println("Display configuration reset to default");
 }
 
+static bool terminated(const char *text, size_t size) {
+  return memchr(text, '\0', size) != NULL;
+}
+
+bool validDisplayConfig(const DisplayConfiguration &config) {
+  if (config.activePanelCount > DISPLAY_MAX_PANELS || config.activeIndicatorCount > DISPLAY_MAX_INDICATORS ||
+      config.rpmDisplayMode > 1 ||
+      (config.canSpeed != 500000 && config.canSpeed != 1000000)) {
+    return false;
+  }
+  for (uint8_t i = 0; i < config.activePanelCount; i++) {
+    const DisplayPanel &panel = config.panels[i];
+    if (panel.dataSource >= DATA_SOURCE_COUNT || panel.dataType > DATA_TYPE_GAUGE ||
+        panel.position >= DISPLAY_MAX_PANELS || panel.decimals > 3 ||
+        panel.color >= THEME_COLOR_COUNT ||
+        !terminated(panel.label, sizeof(panel.label)) || !terminated(panel.unit, sizeof(panel.unit))) {
+      return false;
+    }
+  }
+  for (uint8_t i = 0; i < config.activeIndicatorCount; i++) {
+    const IndicatorConfig &indicator = config.indicators[i];
+    if (indicator.indicator >= INDICATOR_COUNT || indicator.position >= DISPLAY_MAX_INDICATORS ||
+        !terminated(indicator.label, sizeof(indicator.label))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void upgradeDisplayConfigV1(const DisplayConfigurationV1 &old, DisplayConfiguration &config) {
+  memset(&config, 0, sizeof(config));
+  memcpy(config.panels, old.panels, sizeof(old.panels));
+  memcpy(config.indicators, old.indicators, sizeof(old.indicators));
+  config.activePanelCount = old.activePanelCount;
+  config.activeIndicatorCount = old.activeIndicatorCount;
+  config.rpmDisplayMode = old.rpmDisplayMode;
+  config.showSystemIndicators = old.showSystemIndicators;
+  config.canSpeed = old.canSpeed;
+}
+
+// Panel text colours the EEPROM firmware stored, by the role that took
+// their place in the default layout
+static uint16_t legacyColorRole(uint16_t color) {
+  switch (color) {
+    case TFT_GREEN: return THEME_NORMAL;
+    case TFT_RED: return THEME_CRITICAL;
+    case TFT_YELLOW:
+    case TFT_ORANGE: return THEME_WARN;
+    default: return THEME_TEXT;
+  }
+}
+
+bool importLegacyDisplayConfig(const DisplayConfigurationV1 &legacy, DisplayConfiguration &config) {
+  upgradeDisplayConfigV1(legacy, config);
+  for (uint8_t i = 0; i < 8; i++) {
+    config.panels[i].color = legacyColorRole(config.panels[i].color);
+  }
+  // getCanSpeed() used to fall back to 500 kbps for anything else
+  if (config.canSpeed != 500000 && config.canSpeed != 1000000) {
+    config.canSpeed = 500000;
+  }
+  return validDisplayConfig(config);
+}
+
 float getDataValue(uint8_t dataSource) {
   switch (dataSource) {
     case DATA_SOURCE_IAT:
@@ -154,22 +211,6 @@ const char* getIndicatorName(uint8_t indicator) {
   }
 }
 
-uint16_t getDataSourceColor(uint8_t dataSource, float value) {
-  // switch (dataSource) {
-  //   case DATA_SOURCE_AFR:
-  //     return (value < 13.0) ? TFT_ORANGE : ((value > 14.7) ? TFT_RED : TFT_GREEN);
-  //   case DATA_SOURCE_COOLANT:
-  //     return (value > 95) ? TFT_RED : TFT_WHITE;
-  //   case DATA_SOURCE_VOLTAGE:
-  //     return (value < 11.5 || value > 14.5) ? TFT_ORANGE : TFT_GREEN;
-  //   case DATA_SOURCE_ADV:
-  //     return TFT_RED;
-  //   default:
-  //     return TFT_WHITE;
-  // }
-  return TFT_WHITE;
-}
-
 uint32_t getCanSpeed() {
   if (currentDisplayConfig.canSpeed == 500000 || currentDisplayConfig.canSpeed == 1000000) {
     return currentDisplayConfig.canSpeed;
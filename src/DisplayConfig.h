@@ -8,7 +8,9 @@ enum DisplayDataType {
   DATA_TYPE_FLOAT,
   DATA_TYPE_INT,
   DATA_TYPE_UINT,
-  DATA_TYPE_BOOL
+  DATA_TYPE_BOOL,
+  DATA_TYPE_GRAPH,  // Panel shows a history strip chart of the data source
+  DATA_TYPE_GAUGE   // Panel shows an arc gauge of the data source
 };
 
 // Data sources available
@@ -40,16 +42,22 @@ enum IndicatorSource {
   INDICATOR_COUNT
 };
 
+// Street page panel slots: 0-7 around the RPM bar, 8-10 in its place
+// when RPM is shown digitally (rpmDisplayMode 1). See Layout.cpp.
+#define DISPLAY_MAX_PANELS 11
+#define DISPLAY_BAR_SLOTS 8           // Slots usable next to the RPM bar
+#define DISPLAY_MAX_INDICATORS 8
+
 // Display panel configuration
 struct DisplayPanel {
   uint8_t dataSource;     // DataSource enum
   uint8_t dataType;       // DisplayDataType enum
-  uint8_t position;       // Position on screen (0-7)
+  uint8_t position;       // Street slot (0 to DISPLAY_MAX_PANELS - 1)
   uint8_t decimals;       // Number of decimal places for float
   bool enabled;           // Whether to display this panel
   char label[10];         // Label to display
   char unit[5];           // Unit string (°C, V, etc.)
-  uint16_t color;         // Text color
+  uint16_t color;         // Text color as a ThemeColor role
 };
 
 // Indicator configuration
@@ -62,8 +70,8 @@ struct IndicatorConfig {
 
 // Main display configuration
 struct DisplayConfiguration {
-  DisplayPanel panels[8];           // 8 data panels
-  IndicatorConfig indicators[8];    // 8 indicators
+  DisplayPanel panels[DISPLAY_MAX_PANELS];
+  IndicatorConfig indicators[DISPLAY_MAX_INDICATORS];
   uint8_t activePanelCount;         // Number of active panels
   uint8_t activeIndicatorCount;     // Number of active indicators
   uint8_t rpmDisplayMode;           // RPM display mode (0=bar, 1=digital)
@@ -71,6 +79,19 @@ struct DisplayConfiguration {
   uint32_t canSpeed;                // CAN speed in bps (e.g. 500000, 1000000)
 };
 
+// Schema 1 of the display record: eight panel slots. The EEPROM layout
+// before the config store was the same struct, with panel colours as
+// raw RGB565 instead of ThemeColor roles.
+struct DisplayConfigurationV1 {
+  DisplayPanel panels[8];
+  IndicatorConfig indicators[8];
+  uint8_t activePanelCount;
+  uint8_t activeIndicatorCount;
+  uint8_t rpmDisplayMode;
+  bool showSystemIndicators;
+  uint32_t canSpeed;
+};
+
 // Default configuration
 extern DisplayConfiguration defaultDisplayConfig;
 extern DisplayConfiguration currentDisplayConfig;
@@ -80,11 +101,18 @@ void initializeDisplayConfig();
 void saveDisplayConfig();
 void loadDisplayConfig();
 void resetDisplayConfigToDefault();
+// Every field in range and every string terminated
+bool validDisplayConfig(const DisplayConfiguration &config);
+// Widen a schema 1 record to the current panel count, fields unchanged
+void upgradeDisplayConfigV1(const DisplayConfigurationV1 &old, DisplayConfiguration &config);
+// Read the EEPROM blob the way that firmware did: TFT_* colours become
+// theme roles and an unset CAN speed means 500 kbps. False if the result
+// is still invalid (e.g. erased EEPROM).
+bool importLegacyDisplayConfig(const DisplayConfigurationV1 &legacy, DisplayConfiguration &config);
 float getDataValue(uint8_t dataSource);
 bool getIndicatorValue(uint8_t indicator);
 const char* getDataSourceName(uint8_t dataSource);
 const char* getIndicatorName(uint8_t indicator);
-uint16_t getDataSourceColor(uint8_t dataSource, float value);
 // New CAN speed accessors
 uint32_t getCanSpeed();
 void setCanSpeed(uint32_t speed);
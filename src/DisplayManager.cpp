@@ -3,10 +3,19 @@
 #include "DataTypes.h"
 #include "DisplayConfig.h"
 #include "drawing_utils.h"
+#include "text_utils.h"
+#include "Profiler.h"
+#include "NativePush.h"
+#include "Scheduler.h"
+#include "ChannelFilter.h"
+#include "ChannelBands.h"
+#include "HistoryGraph.h"
+#include "ArcGauge.h"
+#include "Theme.h"
 #include "SplashScreen.h"
 #include "NotoSansBold15.h"
 #include "NotoSansBold36.h"
-#include <EEPROM.h>
+#include <atomic>
 #if ENABLE_SIMULATOR
 #include "Simulator.h"
 #endif
@@ -14,7 +23,32 @@
 TFT_eSPI display = TFT_eSPI();
 TFT_eSprite spr = TFT_eSprite(&display);
 
+static SemaphoreHandle_t displayStateMutex = NULL;
+static SemaphoreHandle_t displayStateHandoff = NULL;  // Given by a handler once it holds the state
+static std::atomic<uint8_t> displayStateWaiters(0);
+
+void lockDisplayState() {
+  displayStateWaiters++;
+  xSemaphoreTake(displayStateMutex, portMAX_DELAY);
+  displayStateWaiters--;
+  xSemaphoreGive(displayStateHandoff);
+}
+
+void unlockDisplayState() {
+  xSemaphoreGive(displayStateMutex);
+}
+
+void releaseDisplayState() {
+  xSemaphoreTake(displayStateHandoff, 0); // Drop a token from a handoff that timed out
+  unlockDisplayState();
+  if (displayStateWaiters > 0) {
+    xSemaphoreTake(displayStateHandoff, pdMS_TO_TICKS(DISPLAY_STATE_HANDOFF_MS));
+  }
+}
+
 void setupDisplay() {
+  displayStateMutex = xSemaphoreCreateMutex();
+  displayStateHandoff = xSemaphoreCreateBinary();
   display.init();
   display.setRotation(3);
   // Initialize display configuration
@@ -26,278 +60,511 @@ void drawSplashScreenWithImage() {
   showAnimatedSplashScreen();
 }
 
-void drawConfigurablePanels(bool setup) {
-  // Draw each enabled panel
-  for (int i = 0; i < currentDisplayConfig.activePanelCount; i++) {
-    DisplayPanel &panel = currentDisplayConfig.panels[i];
-    if (panel.enabled && panel.position < 8) {
-      drawModularDataPanel(panel, setup);
-    }
+// Boxed panel: label drawn at setup, value digits redrawn on change. The
+// color comes from the channel's band (widget thresholds override); a band
+// change repaints the whole panel, a value change only the digits.
+static bool drawPanelWidget(DrawCommand &cmd, bool setup) {
+  float currentValue = getDisplayValue(cmd.binding); // Filtered + deadbanded
+  int32_t fixedValue = toFixed(currentValue, cmd.decimals);
+
+  uint8_t role = getChannelBandRole(cmd.binding);
+  if (cmd.warnLow < cmd.warnHigh && (fixedValue < cmd.warnLow || fixedValue > cmd.warnHigh)) {
+    role = THEME_CRITICAL;
+  }
+  uint16_t color = themeColor(role);
+  if (role != cmd.lastRole) {
+    setup = true; // Border, label and digits all carry the band color
   }
-}
 
-void drawModularDataPanel(const DisplayPanel &panel, bool setup) {
-  // New panel positions to avoid RPM bar collision
-  // RPM bar occupies roughly Y=40 to Y=150, so panels moved to avoid collision
-  // Each panel is 80px tall, fitting 2 main panels per column + 1 bottom panel each
-  int panelPositions[8][2] = {
-    {0, 20},   // Position 0: Left-Top (AFR) - Y=160 to Y=240
-    {0, 110},   // Position 1: Left-Middle (TPS) - Y=245 to Y=325
-    {0, 200},   // Position 2: Left-Bottom (IAT) - Y=280 to Y=360, will be clipped but user requested
-    {390, 20}, // Position 3: Right-Top (MAP) - Y=160 to Y=240
-    {390, 110}, // Position 4: Right-Middle (ADV) - Y=245 to Y=325
-    {390, 200}, // Position 5: Right-Bottom (FP) - Y=280 to Y=360, will be clipped but user requested
-    {130, 200}, // Position 6: Center-Left (Coolant) - moved to center to avoid overlap
-    {250, 200}  // Position 7: Center-Right (Voltage) - moved to center to avoid overlap
-  };
-  
-  if (panel.position >= 8) return;
-  
-  int x = panelPositions[panel.position][0];
-  int y = panelPositions[panel.position][1];
-  
-  // Get current value
-  float currentValue = getDataValue(panel.dataSource);
-  
-  // Get color based on data source and value
-  uint16_t color = getDataSourceColor(panel.dataSource, currentValue);
-  
-  // Use existing drawDataBox function with enhanced parameters
-  static float lastValues[8] = {-999, -999, -999, -999, -999, -999, -999, -999};
-  
-  if (setup || lastValues[panel.position] != currentValue) {
-    drawDataBox(x, y, panel.label, currentValue, color, lastValues[panel.position], panel.decimals, setup);
-    lastValues[panel.position] = currentValue;
+  if (setup) {
+    // Value digits sit inside the box borders, just below the label
+    initDigitField(cmd.field, cmd.x + cmd.w - 2, cmd.y + 30, 4, 36, cmd.w - 4, AA_FONT_LARGE, color, themeColor(THEME_BACKGROUND));
   }
-}
 
-void drawConfigurableIndicators() {
-  // Draw indicators based on configuration
-  // Position indicators in the middle area between left/right columns
-  // IAT and FP panels are at Y=280-360, center panels at Y=285-365
-  // Place indicators between the main columns at Y=330
-  int indicatorX = 5;  // Positioned between left and right columns
-  int indicatorY = 290;  // Positioned in the middle area
-  int indicatorWidth = 60; // Made slightly smaller to fit better
-  
-  // Pack enabled indicators without gaps
-  int currentPosition = 0;
-  for (int i = 0; i < currentDisplayConfig.activeIndicatorCount; i++) {
-    IndicatorConfig &indicator = currentDisplayConfig.indicators[i];
-    if (indicator.enabled && indicator.position < 8) {
-      bool state = getIndicatorValue(indicator.indicator);
-      // Use currentPosition instead of indicator.position to pack without gaps
-      drawSmallButton(indicatorX + (indicatorWidth * currentPosition), indicatorY, indicator.label, state);
-      currentPosition++; // Increment position for next enabled indicator
-    }
+  if (setup || fixedValue != cmd.lastValue) {
+    int labelOffset = cmd.binding == DATA_SOURCE_AFR ? -10 : 0;
+    drawDataBox(cmd.x, cmd.y, cmd.label, currentValue, color, 0, cmd.decimals, setup, &cmd.field, labelOffset);
+    cmd.lastValue = fixedValue;
+    cmd.lastRole = role;
+    return true;
   }
+  return false;
 }
 
-// New function to replace itemDraw with configurable panels
-void drawConfigurableData(bool setup) {
-  // Draw RPM and VSS with reduced frequency update (only when changed or setup)
-  static uint32_t lastRpmUpdate = 0;
-  static unsigned int lastVss = 999; // Different initial value to force first update
-  if (lastRpm != rpm || lastVss != vss || setup || (millis() - lastRpmUpdate > 100)) {
-    drawRPMBarBlocks(rpm); // Use default maxRPM from config
-    
-    // Draw RPM value with background and border
+// Small RPM readout: static label sprite plus a right-aligned digit field
+static bool drawRpmTextWidget(DrawCommand &cmd, bool setup) {
+  if (setup) {
     spr.loadFont(AA_FONT_SMALL);
-    spr.createSprite(90, 30);
-    spr_width = spr.textWidth("8888");
-    spr.setTextColor(TFT_WHITE, TFT_BLACK, true);
+    spr.createSprite(cmd.w, cmd.h);
+    spr.setTextColor(themeColor(THEME_LABEL), themeColor(THEME_BACKGROUND), true);
     spr.setTextDatum(BR_DATUM);
     spr.drawString("RPM", 80, 2); // Label at top
-    spr.setTextDatum(BR_DATUM);
-    spr.loadFont(AA_FONT_SMALL); // Use smaller font for RPM value to match existing pattern
-    spr.drawNumber(rpm, 80, 30); // Value at bottom with smaller font
-    spr.pushSprite(275, 15);
+    pushSpriteNative(spr, cmd.x, cmd.y);
+    PROFILE_SPI(cmd.w * cmd.h);
     spr.deleteSprite();
-    
-    // Draw VSS value with background and border
-    spr.createSprite(120, 50);
-    spr_width = spr.textWidth("888");
-    spr.setTextColor(TFT_WHITE, TFT_BLACK, true);
-    
-    // Draw the numeric value with large font
-    spr.setTextDatum(BR_DATUM);
-    spr.loadFont(AA_FONT_LARGE);
-    spr.drawNumber(vss, 60, 46); // Value positioned to left
-    
-    // Draw "kph" unit with smaller font
-    spr.setTextDatum(BL_DATUM);
+    initDigitField(cmd.field, cmd.x + 80, cmd.y + 15, 5, 15, 0, AA_FONT_SMALL, themeColor(THEME_TEXT), themeColor(THEME_BACKGROUND));
+  }
+
+  char valueText[FORMAT_BUFFER_SIZE];
+  formatFixed(valueText, rpm, 0);
+  return drawDigitField(cmd.field, valueText) > 0 || setup;
+}
+
+// Large speed readout with "kph" unit
+static bool drawSpeedWidget(DrawCommand &cmd, bool setup) {
+  if (setup) {
     spr.loadFont(AA_FONT_SMALL);
+    spr.createSprite(cmd.w, cmd.h);
+    spr.setTextColor(themeColor(THEME_LABEL), themeColor(THEME_BACKGROUND), true);
+    spr.setTextDatum(BL_DATUM);
     spr.drawString("kph", 62, 42); // Unit positioned to right of value
-    
-    spr.pushSprite(250, 135);
+    pushSpriteNative(spr, cmd.x, cmd.y);
+    PROFILE_SPI(cmd.w * cmd.h);
     spr.deleteSprite();
-    
-    lastRpm = rpm;
-    lastVss = vss;
-    lastRpmUpdate = millis();
+    initDigitField(cmd.field, cmd.x + 60, cmd.y + 10, 3, 36, 0, AA_FONT_LARGE, themeColor(THEME_TEXT), themeColor(THEME_BACKGROUND));
   }
-  
-  // Draw configurable panels with reduced frequency
-  static uint32_t lastPanelUpdate = 0;
-  if (setup || (millis() - lastPanelUpdate > 50)) { // Update panels every 50ms max
-    drawConfigurablePanels(setup);
-    lastPanelUpdate = millis();
+
+  char valueText[FORMAT_BUFFER_SIZE];
+  formatFixed(valueText, vss, 0);
+  return drawDigitField(cmd.field, valueText) > 0 || setup;
+}
+
+static bool drawIndicatorWidget(DrawCommand &cmd, bool setup) {
+  bool state = getIndicatorValue(cmd.binding);
+  if (setup || state != cmd.lastState) {
+    drawSmallButton(cmd.x, cmd.y, cmd.label, state);
+    cmd.lastState = state;
+    return true;
   }
-  
-  // Draw configurable indicators with reduced frequency
-  static uint32_t lastIndicatorUpdate = 0;
-  if (setup || (millis() - lastIndicatorUpdate > 100)) { // Update indicators every 100ms max
-    drawConfigurableIndicators();
-    lastIndicatorUpdate = millis();
+  return false;
+}
+
+// Strip chart: frame and label at setup, then one new column per completed
+// group of history samples
+static bool drawGraphWidget(DrawCommand &cmd, bool setup) {
+  if (setup) {
+    display.fillRect(cmd.x, cmd.y, cmd.w, cmd.h, themeColor(THEME_BACKGROUND));
+    display.drawRoundRect(cmd.x, cmd.y, cmd.w, cmd.h, 5, themeColor(THEME_BORDER));
+    display.loadFont(AA_FONT_SMALL);
+    display.setTextColor(themeColor(THEME_LABEL), themeColor(THEME_BACKGROUND));
+    display.setTextDatum(TL_DATUM);
+    display.drawString(cmd.label, cmd.x + 5, cmd.y + 3);
+    PROFILE_SPI(cmd.w * cmd.h + 2 * (cmd.w + cmd.h));
+    initHistoryGraph(cmd.graph, cmd.binding, cmd.x + 3, cmd.y + 19, cmd.w - 6, cmd.h - 22);
   }
+  return drawHistoryGraph(cmd.graph, themeColor(THEME_NORMAL)) > 0 || setup;
 }
 
+// Arc gauge: label in the gap at the bottom, value digits in the middle.
+// The ring fill follows the channel's band; a plain band fills in the
+// normal color.
+static bool drawGaugeWidget(DrawCommand &cmd, bool setup) {
+  float currentValue = getDisplayValue(cmd.binding);
+  int32_t fixedValue = toFixed(currentValue, cmd.decimals);
+  uint8_t role = getChannelBandRole(cmd.binding);
+  if (cmd.warnLow < cmd.warnHigh && (fixedValue < cmd.warnLow || fixedValue > cmd.warnHigh)) {
+    role = THEME_CRITICAL;
+  }
+  int16_t cx = cmd.x + cmd.w / 2;
+  int16_t cy = cmd.y + cmd.h / 2;
+
+  if (setup) {
+    display.fillRect(cmd.x, cmd.y, cmd.w, cmd.h, themeColor(THEME_BACKGROUND));
+    display.loadFont(AA_FONT_SMALL);
+    display.setTextColor(themeColor(THEME_LABEL), themeColor(THEME_BACKGROUND));
+    display.setTextDatum(BC_DATUM);
+    display.drawString(cmd.label, cx, cmd.y + cmd.h - 1);
+    PROFILE_SPI(cmd.w * cmd.h);
+    int16_t radius = min(cmd.w, cmd.h) / 2 - 2;
+    initArcGauge(cmd.gauge, cmd.binding, cx, cy, radius, max(4, radius / 5));
+    initDigitField(cmd.field, cx + radius * 2 / 3, cy - 8, 5, 15, 0, AA_FONT_SMALL, themeColor(role), themeColor(THEME_BACKGROUND));
+  }
+
+  uint16_t fillColor = themeColor(role == THEME_TEXT ? THEME_NORMAL : role);
+  bool drew = drawArcGauge(cmd.gauge, currentValue, fillColor, setup) > 0;
+
+  if (setup || fixedValue != cmd.lastValue || role != cmd.lastRole) {
+    char valueText[FORMAT_BUFFER_SIZE];
+    formatFixed(valueText, fixedValue, cmd.decimals);
+    setDigitFieldColors(cmd.field, themeColor(role), themeColor(THEME_BACKGROUND));
+    drew = drawDigitField(cmd.field, valueText) > 0 || drew;
+    cmd.lastValue = fixedValue;
+    cmd.lastRole = role;
+  }
+  return drew || setup;
+}
+
+static bool renderWidget(DrawCommand &cmd, bool setup) {
+  switch (cmd.type) {
+    case WIDGET_RPM_BAR:
+      // RPM bar paces itself at frame rate and only touches blocks that change
+      if (setup) {
+        configureRPMBar(cmd.x, cmd.y);
+      }
+      drawRPMBarBlocks(rpm); // Use default maxRPM from config
+      return true;
+    case WIDGET_RPM_TEXT:
+      return drawRpmTextWidget(cmd, setup);
+    case WIDGET_SPEED:
+      return drawSpeedWidget(cmd, setup);
+    case WIDGET_PANEL:
+      return drawPanelWidget(cmd, setup);
+    case WIDGET_INDICATOR:
+      return drawIndicatorWidget(cmd, setup);
+    case WIDGET_GRAPH:
+      return drawGraphWidget(cmd, setup);
+    case WIDGET_GAUGE:
+      return drawGaugeWidget(cmd, setup);
+  }
+  return false;
+}
+
+static uint8_t widgetProfileScope(uint8_t type) {
+  switch (type) {
+    case WIDGET_RPM_BAR: return PROF_RPM_BAR;
+    case WIDGET_RPM_TEXT:
+    case WIDGET_SPEED: return PROF_READOUTS;
+    case WIDGET_INDICATOR: return PROF_INDICATORS;
+    default: return PROF_PANELS;
+  }
+}
+
+// Draw one widget. Returns true if it pushed anything to the panel.
+static bool drawWidget(DrawCommand &cmd, bool setup) {
+  bool drew;
+  PROFILE_CALL(widgetProfileScope(cmd.type), drew = renderWidget(cmd, setup));
+  return drew;
+}
+
+// Status overlay items are scheduled alongside the layout widgets
+enum OverlayItem {
+  OVERLAY_SIM = LAYOUT_MAX_COMMANDS,  // Tags after the layout command indices
+  OVERLAY_COMM,
+  OVERLAY_DEBUG,
+  OVERLAY_END
+};
+
+static ScheduleSlot overlaySlots[OVERLAY_END - OVERLAY_SIM];
+static uint8_t overlayThemeEpoch[OVERLAY_END - OVERLAY_SIM];
+static bool overlaySlotsReady = false;
+
+static bool drawOverlayItem(uint8_t item, bool setup);
+
+static void initOverlaySlots() {
+  initScheduleSlot(overlaySlots[OVERLAY_SIM - OVERLAY_SIM], PRIO_LOW, 100, 500, 750);
+  initScheduleSlot(overlaySlots[OVERLAY_COMM - OVERLAY_SIM], PRIO_LOW, 100, 1000, 1200);
+  initScheduleSlot(overlaySlots[OVERLAY_DEBUG - OVERLAY_SIM], PRIO_LOW, 250, 1000, 9600);
+  overlaySlotsReady = true;
+}
+
+// After a theme switch every widget still shows the old palette. Rather than
+// repainting the screen in one frame, up to THEME_RESTYLE_PER_FRAME stale
+// widgets (layout order, so the RPM bar and readouts go first) get a full
+// setup draw per frame, which also rebuilds their label sprites and digit
+// cells in the new colors.
+static void restyleStaleWidgets(CompiledLayout &layout, uint32_t now) {
+  uint8_t epoch = getThemeEpoch();
+  uint8_t budget = THEME_RESTYLE_PER_FRAME;
+  for (uint8_t i = 0; i < layout.count && budget > 0; i++) {
+    DrawCommand &cmd = layout.commands[i];
+    if (cmd.themeEpoch != epoch) {
+      drawWidget(cmd, true);
+      scheduleMarkServiced(cmd.sched, now);
+      cmd.themeEpoch = epoch;
+      budget--;
+    }
+  }
+  for (uint8_t item = OVERLAY_SIM; item < OVERLAY_END && budget > 0; item++) {
+    if (overlayThemeEpoch[item - OVERLAY_SIM] != epoch) {
+      PROFILE_CALL(PROF_OVERLAY, drawOverlayItem(item, true));
+      scheduleMarkServiced(overlaySlots[item - OVERLAY_SIM], now);
+      overlayThemeEpoch[item - OVERLAY_SIM] = epoch;
+      budget--;
+    }
+  }
+}
+
+// Setup draws every widget and the overlay. Otherwise one scheduled frame:
+// pending theme restyles, the RPM bar every pass, then the most overdue
+// widgets by priority class until the frame's pixel budget is spent.
+void drawConfigurableData(bool setup) {
+  if (!overlaySlotsReady) {
+    initOverlaySlots();
+  }
+  uint32_t now = millis();
+  CompiledLayout &layout = getCompiledLayout();
+
+  if (setup) {
+    for (uint8_t i = 0; i < layout.count; i++) {
+      drawWidget(layout.commands[i], true);
+      scheduleMarkServiced(layout.commands[i].sched, now);
+      layout.commands[i].themeEpoch = getThemeEpoch();
+    }
+    for (uint8_t item = OVERLAY_SIM; item < OVERLAY_END; item++) {
+      drawOverlayItem(item, true);
+      scheduleMarkServiced(overlaySlots[item - OVERLAY_SIM], now);
+      overlayThemeEpoch[item - OVERLAY_SIM] = getThemeEpoch();
+    }
+    return;
+  }
+
+  restyleStaleWidgets(layout, now);
+
+  scheduleBegin(now);
+  for (uint8_t i = 0; i < layout.count; i++) {
+    scheduleAdd(layout.commands[i].sched, i);
+  }
+  for (uint8_t item = OVERLAY_SIM; item < OVERLAY_END; item++) {
+    scheduleAdd(overlaySlots[item - OVERLAY_SIM], item);
+  }
+
+  uint8_t tag;
+  while (scheduleNext(tag)) {
+    bool drew;
+    if (tag < OVERLAY_SIM) {
+      drew = drawWidget(layout.commands[tag], false);
+    } else {
+      PROFILE_CALL(PROF_OVERLAY, drew = drawOverlayItem(tag, false));
+    }
+    scheduleDone(drew);
+  }
+}
+
+static const char *widgetName(const DrawCommand &cmd) {
+  switch (cmd.type) {
+    case WIDGET_RPM_BAR: return "RPM bar";
+    case WIDGET_RPM_TEXT: return "RPM text";
+    case WIDGET_SPEED: return "Speed";
+    default: return cmd.label;
+  }
+}
+
+// Achieved update intervals per widget since the last call
+void printSchedulerStats() {
+  CompiledLayout &layout = getCompiledLayout();
+  Serial.printf("=== SCHEDULER (%s page, budget %d px/frame) ===\n", getPageName(layout.page), SCHED_FRAME_PIXEL_BUDGET);
+  for (uint8_t i = 0; i < layout.count; i++) {
+    printScheduleStats(layout.commands[i].sched, widgetName(layout.commands[i]));
+    resetScheduleStats(layout.commands[i].sched);
+  }
+  const char *overlayNames[] = {"SIM", "CAN/SER", "Debug HUD"};
+  for (uint8_t item = OVERLAY_SIM; item < OVERLAY_END; item++) {
+    printScheduleStats(overlaySlots[item - OVERLAY_SIM], overlayNames[item - OVERLAY_SIM]);
+    resetScheduleStats(overlaySlots[item - OVERLAY_SIM]);
+  }
+}
+
+static bool layoutHasRPMBar() {
+  CompiledLayout &layout = getCompiledLayout();
+  for (uint8_t i = 0; i < layout.count; i++) {
+    if (layout.commands[i].type == WIDGET_RPM_BAR) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Work that does not touch the panel, done while the splash is still shown
+void prepareDisplay() {
+  spr.setColorDepth(16);
+  compileLayout(getActivePage());
+  consumeLayoutChange();
+}
+
+// Replace the splash with the full dashboard
 void startUpDisplay() {
-  display.fillScreen(TFT_BLACK);
+  display.fillScreen(themeColor(THEME_BACKGROUND));
   display.loadFont(AA_FONT_SMALL);
-  spr.setColorDepth(16);
-  display.setTextColor(TFT_WHITE, TFT_BLACK);
-  
-  // Use configurable display system
+  display.setTextColor(themeColor(THEME_TEXT), themeColor(THEME_BACKGROUND));
+  if (consumeLayoutChange()) {
+    compileLayout(getActivePage()); // Page/config changed since prepareDisplay()
+  }
   drawConfigurableData(true);
-  
-  // Animation with both RPM and VSS values
-  spr.loadFont(AA_FONT_SMALL);
-  for (int i = DEFAULT_MAX_RPM; i >= 0; i -= 250) {
-    drawRPMBarBlocks(i); // Use default maxRPM from config
+}
+
+// One step of the startup RPM sweep (full bar down to zero). Call every
+// RPM_BAR_FRAME_MS; returns true when the sweep is finished.
+bool startupSweepStep() {
+  static int sweepRpm = DEFAULT_MAX_RPM;
+  if (sweepRpm < 0 || !layoutHasRPMBar()) {
+    return true;
   }
+  drawRPMBarBlocks(sweepRpm); // Use default maxRPM from config
+  sweepRpm -= 250;
+  return false;
 }
 
-void drawDataBox(int x, int y, const char *label, const float value, uint16_t labelColor, const float valueToCompare, const int decimal, bool setup) {
+void drawDataBox(int x, int y, const char *label, const float value, uint16_t labelColor, const float valueToCompare, const int decimal, bool setup, DigitField *valueField, int labelOffset) {
   const int BOX_WIDTH = 80;
   const int BOX_HEIGHT = 80;
   const int LABEL_HEIGHT = BOX_HEIGHT / 2;
 
   if (setup) {
     // Clear the entire data box area first only during setup
-    display.fillRect(x, y, BOX_WIDTH, BOX_HEIGHT, TFT_BLACK);
+    display.fillRect(x, y, BOX_WIDTH, BOX_HEIGHT, themeColor(THEME_BACKGROUND));
     
     // Draw border around the entire panel
-    display.drawRoundRect(x, y, BOX_WIDTH, BOX_HEIGHT, 5, TFT_DARKGREY);      // Outer border
+    display.drawRoundRect(x, y, BOX_WIDTH, BOX_HEIGHT, 5, themeColor(THEME_BORDER)); // Outer border
     display.drawRoundRect(x + 1, y + 1, BOX_WIDTH - 2, BOX_HEIGHT - 2, 4, labelColor); // Inner border with label color
+    PROFILE_SPI(BOX_WIDTH * BOX_HEIGHT + 4 * (BOX_WIDTH + BOX_HEIGHT));
     
     spr.loadFont(AA_FONT_SMALL);
     spr.createSprite(BOX_WIDTH, LABEL_HEIGHT);
-    spr.fillSprite(TFT_BLACK);  // Clear sprite background
-    spr.setTextColor(labelColor, TFT_BLACK, true);
+    spr.fillSprite(themeColor(THEME_BACKGROUND));  // Clear sprite background
+    spr.setTextColor(labelColor, themeColor(THEME_BACKGROUND), true);
     spr.setTextDatum(TC_DATUM);
-    spr.drawString(label, 40, 5);
-    if (label == "AFR") {
-      spr.pushSprite(x - 10, y);
-    } else {
-      spr.pushSprite(x, y);
-    }
+    spr.drawString(label, BOX_WIDTH / 2 + labelOffset, 5);
+    pushSpriteNative(spr, x, y);
+    PROFILE_SPI(BOX_WIDTH * LABEL_HEIGHT);
     spr.deleteSprite();
   }
   
-  if (setup || valueToCompare != value) {
+  if (valueField != nullptr) {
+    // Only the digit cells that differ from the last value are pushed
+    char valueText[FORMAT_BUFFER_SIZE];
+    formatFixed(valueText, toFixed(value, decimal), decimal);
+    if (setup) {
+      invalidateDigitField(*valueField);
+    }
+    setDigitFieldColors(*valueField, labelColor, themeColor(THEME_BACKGROUND));
+    drawDigitField(*valueField, valueText);
+  } else if (setup || valueToCompare != value) {
     spr.loadFont(AA_FONT_LARGE);
     spr.createSprite(BOX_WIDTH, LABEL_HEIGHT);
-    spr.fillSprite(TFT_BLACK);  // Clear sprite background
+    spr.fillSprite(themeColor(THEME_BACKGROUND));  // Clear sprite background
     spr.setTextDatum(TC_DATUM);
     spr_width = spr.textWidth("333");
-    spr.setTextColor(labelColor, TFT_BLACK, true);
-    if (decimal > 0) {
-      spr.drawFloat(value, decimal, 40, 5);
-    } else {
-      spr.drawNumber(value, 40, 5);
-    }
-    spr.pushSprite(x, y + LABEL_HEIGHT - 15);
+    spr.setTextColor(labelColor, themeColor(THEME_BACKGROUND), true);
+    // Integer formatting instead of drawFloat()/drawNumber()
+    char valueText[FORMAT_BUFFER_SIZE];
+    formatFixed(valueText, toFixed(value, decimal), decimal);
+    spr.drawString(valueText, 40, 5);
+    pushSpriteNative(spr, x, y + LABEL_HEIGHT - 15);
+    PROFILE_SPI(BOX_WIDTH * LABEL_HEIGHT);
     spr.deleteSprite();
   }
 }
 
+// Configuration edit: clear widgets that went away and set up the new ones;
+// everything else stays on screen untouched
+static void applyLayoutUpdate() {
+  LayoutDiff diff;
+  recompileLayout(diff);
+  for (uint8_t i = 0; i < diff.staleCount; i++) {
+    const LayoutRect &rect = diff.stale[i];
+    display.fillRect(rect.x, rect.y, rect.w, rect.h, themeColor(THEME_BACKGROUND));
+    PROFILE_SPI(rect.w * rect.h);
+  }
+  CompiledLayout &layout = getCompiledLayout();
+  uint32_t now = millis();
+  for (uint8_t i = 0; i < diff.freshCount; i++) {
+    DrawCommand &cmd = layout.commands[diff.fresh[i]];
+    drawWidget(cmd, true);
+    scheduleMarkServiced(cmd.sched, now);
+  }
+}
+
 void drawData() {
-  // Use configurable display system with performance optimizations
+  // Page switch or theme background change: rebuild the layout and redraw everything
+  if (consumeLayoutChange()) {
+    compileLayout(getActivePage());
+    display.fillScreen(themeColor(THEME_BACKGROUND));
+    drawConfigurableData(true);
+  } else if (consumeLayoutUpdate()) {
+    applyLayoutUpdate();
+  }
+
+  // One scheduled frame of widgets and overlay
   drawConfigurableData(false);
-  
+}
+
+// CAN/SER label, SIM marker and the debug HUD. Each item redraws only when
+// its content changed (or after a full redraw); how often it is checked is
+// up to the scheduler.
+static bool drawOverlayItem(uint8_t item, bool setup) {
+  switch (item) {
 #if ENABLE_SIMULATOR
-  // Draw simulator indicator if simulator is active (with reduced update frequency)
-  static uint8_t lastSimMode = SIMULATOR_MODE_OFF;
-  static uint32_t lastSimUpdate = 0;
-  uint8_t currentSimMode = getSimulatorMode();
-  
-  // Only redraw if simulator mode has changed or every 500ms
-  if (currentSimMode != lastSimMode || (millis() - lastSimUpdate > 500)) {
-    if (currentSimMode != SIMULATOR_MODE_OFF) {
+    case OVERLAY_SIM: {
+      static uint8_t lastSimMode = SIMULATOR_MODE_OFF;
+      uint8_t currentSimMode = getSimulatorMode();
+      if (!setup && currentSimMode == lastSimMode) {
+        return false;
+      }
       // Clear the SIM area first
-      display.fillRect(display.width() - 30, 5, 25, 15, TFT_BLACK);
-      
-      // Draw SIM indicator
-      display.loadFont(AA_FONT_SMALL);
-      display.setTextColor(TFT_YELLOW, TFT_BLACK);
-      display.setTextDatum(TR_DATUM);
-      display.drawString("SIM", display.width() - 5, 5);
-    } else {
-      // Clear the SIM indicator when simulator is turned off
-      display.fillRect(display.width() - 30, 5, 25, 15, TFT_BLACK);
+      display.fillRect(display.width() - 30, 5, 25, 15, themeColor(THEME_BACKGROUND));
+      if (currentSimMode != SIMULATOR_MODE_OFF) {
+        // Draw SIM indicator
+        display.loadFont(AA_FONT_SMALL);
+        display.setTextColor(themeColor(THEME_NOTICE), themeColor(THEME_BACKGROUND));
+        display.setTextDatum(TR_DATUM);
+        display.drawString("SIM", display.width() - 5, 5);
+        PROFILE_SPI(2 * 25 * 15);
+      } else {
+        PROFILE_SPI(25 * 15);
+      }
+      lastSimMode = currentSimMode;
+      return true;
     }
-    
-    lastSimMode = currentSimMode;
-    lastSimUpdate = millis();
-  }
 #endif
 
-  // Draw communication mode indicator (top left) with reduced update frequency
-  static bool lastCommMode = true;  // Track changes
-  static String lastCommText = "";
-  static uint32_t lastCommUpdate = 0;
-  
-  String currentCommText = isCANMode ? "CAN" : "SER";
-  
-  // Only redraw if communication mode has changed or every 1000ms
-  if (isCANMode != lastCommMode || currentCommText != lastCommText || (millis() - lastCommUpdate > 1000)) {
-    // Clear the comm mode area first
-    display.fillRect(5, 5, 40, 15, TFT_BLACK);
-    
-    // Draw new communication mode
-    display.loadFont(AA_FONT_SMALL);
-    display.setTextColor(isCANMode ? TFT_GREEN : TFT_ORANGE, TFT_BLACK);
-    display.setTextDatum(TL_DATUM);
-    display.drawString(currentCommText, 5, 5);
-    
-    lastCommMode = isCANMode;
-    lastCommText = currentCommText;
-    lastCommUpdate = millis();
-  }
-
-#if ENABLE_DEBUG_MODE
-  static bool lastDebugMode = false;
-  static String lastDebugInfo = "";
-  
-  if (debugMode) {
-    // Create debug info string - show only essential info in one line
-    String debugInfo = "CPU:" + String(cpuUsage, 1) + "% FPS:" + String(fps, 1) + " Heap:" + String(ESP.getFreeHeap()/1024) + "K";
-    
-    if (debugInfo != lastDebugInfo || !lastDebugMode) {
-      int centerX = display.width() / 2;
-      
-      // Clear the debug area first to prevent font overlap
-      display.fillRect(centerX - 120, 5, 240, 20, TFT_BLACK);
-      
-      // Draw debug info
+    case OVERLAY_COMM: {
+      // Communication mode indicator (top left)
+      static bool lastCommMode = true;
+      if (!setup && isCANMode == lastCommMode) {
+        return false;
+      }
+      // Clear the comm mode area first
+      display.fillRect(5, 5, 40, 15, themeColor(THEME_BACKGROUND));
       display.loadFont(AA_FONT_SMALL);
-      display.setTextColor(TFT_CYAN, TFT_BLACK);
-      display.setTextDatum(TC_DATUM);
-      display.drawString(debugInfo, centerX, 5);
-      
-      lastDebugInfo = debugInfo;
+      display.setTextColor(themeColor(isCANMode ? THEME_NORMAL : THEME_WARN), themeColor(THEME_BACKGROUND));
+      display.setTextDatum(TL_DATUM);
+      display.drawString(isCANMode ? "CAN" : "SER", 5, 5);
+      PROFILE_SPI(2 * 40 * 15);
+      lastCommMode = isCANMode;
+      return true;
     }
-    
-    lastDebugMode = true;
-  } else {
-    // Clear debug area when debug mode is turned off
-    if (lastDebugMode) {
-      // Clear the top center area where debug info was displayed
-      display.fillRect(0, 5, display.width(), 20, TFT_BLACK);
-      lastDebugMode = false;
-      lastDebugInfo = "";
+
+#if ENABLE_DEBUG_MODE
+    case OVERLAY_DEBUG: {
+      static bool lastDebugMode = false;
+      static char lastDebugInfo[48] = "";
+
+      if (debugMode) {
+        // Profiler HUD in one line: real CPU share, rendered FPS, p99 frame time, SPI load
+        const ProfileReport &report = getProfileReport();
+        char debugInfo[48];
+        snprintf(debugInfo, sizeof(debugInfo), "CPU:%.0f%% FPS:%.0f p99:%.1fms SPI:%uK/s",
+                 cpuUsage, fps, report.p99FrameUs / 1000.0f, report.spiBytesPerSecond / 1024);
+        if (!setup && lastDebugMode && strcmp(debugInfo, lastDebugInfo) == 0) {
+          return false;
+        }
+        int centerX = display.width() / 2;
+
+        // Clear the debug area first to prevent font overlap
+        display.fillRect(centerX - 120, 5, 240, 20, themeColor(THEME_BACKGROUND));
+
+        // Draw debug info
+        display.loadFont(AA_FONT_SMALL);
+        display.setTextColor(themeColor(THEME_ACCENT), themeColor(THEME_BACKGROUND));
+        display.setTextDatum(TC_DATUM);
+        display.drawString(debugInfo, centerX, 5);
+        PROFILE_SPI(2 * 240 * 20);
+
+        strcpy(lastDebugInfo, debugInfo);
+        lastDebugMode = true;
+        return true;
+      }
+      if (lastDebugMode) {
+        // Clear the top center area where debug info was displayed
+        display.fillRect(0, 5, display.width(), 20, themeColor(THEME_BACKGROUND));
+        PROFILE_SPI(display.width() * 20);
+        lastDebugMode = false;
+        lastDebugInfo[0] = '\0';
+        return true;
+      }
+      return false;
     }
-  }
 #endif
+  }
+  return false;
 }
@@ -3,6 +3,8 @@
 
 #include <TFT_eSPI.h>
 #include "DisplayConfig.h"
+#include "DigitRenderer.h"
+#include "Layout.h"
 
 // External display objects
 extern TFT_eSPI display;
@@ -11,12 +13,29 @@ extern TFT_eSprite spr;
 // Function declarations
 void setupDisplay();
 void drawSplashScreenWithImage();
+void prepareDisplay();
 void startUpDisplay();
-void drawDataBox(int x, int y, const char *label, const float value, uint16_t labelColor, const float valueToCompare, const int decimal, bool setup);
+bool startupSweepStep();
+void drawDataBox(int x, int y, const char *label, const float value, uint16_t labelColor, const float valueToCompare, const int decimal, bool setup, DigitField *valueField = nullptr, int labelOffset = 0);
 void drawData();
 void drawConfigurableData(bool setup);
-void drawConfigurablePanels(bool setup);
-void drawConfigurableIndicators();
-void drawModularDataPanel(const DisplayPanel &panel, bool setup);
+void printSchedulerStats();
+
+// Held by the render loop for a frame and by the web task while it changes
+// anything the renderer reads (layout, panel config, filters, bands, theme).
+// Web handlers take it only around the change, never while sending.
+void lockDisplayState();
+void unlockDisplayState();
+// Render loop side of unlockDisplayState(): if a handler is waiting, hand
+// the state over and give it up to DISPLAY_STATE_HANDOFF_MS to take it,
+// so the loop cannot re-take the mutex first. A handler waits at most one
+// frame plus the handoff.
+void releaseDisplayState();
+
+class DisplayStateGuard {
+public:
+  DisplayStateGuard() { lockDisplayState(); }
+  ~DisplayStateGuard() { unlockDisplayState(); }
+};
 
 #endif // DISPLAY_MANAGER_H
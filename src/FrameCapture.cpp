@@ -0,0 +1,43 @@
+#include "FrameCapture.h"
+#include "Profiler.h"
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+// External display object
+extern TFT_eSPI display;
+
+void captureFrame() {
+  static uint16_t line[480];
+  static uint8_t rgb[480 * 3];
+
+  int16_t width = display.width();
+  int16_t height = display.height();
+  if (width > 480) {
+    width = 480;
+  }
+
+  uint32_t spiBytes = 0;
+  uint32_t spiTransactions = 0;
+  getLastFrameSpi(spiBytes, spiTransactions);
+
+  Serial.printf("FRAME_BEGIN %d %d %u %u\n", width, height, spiBytes, spiTransactions);
+  Serial.printf("P6\n%d %d\n255\n", width, height);
+
+  for (int16_t y = 0; y < height; y++) {
+    display.readRect(0, y, width, 1, line);
+    for (int16_t x = 0; x < width; x++) {
+      // readRect returns byte-swapped RGB565 (pushRect order)
+      uint16_t color = (line[x] << 8) | (line[x] >> 8);
+      uint8_t r = (color >> 11) & 0x1F;
+      uint8_t g = (color >> 5) & 0x3F;
+      uint8_t b = color & 0x1F;
+      rgb[x * 3] = (r << 3) | (r >> 2);
+      rgb[x * 3 + 1] = (g << 2) | (g >> 4);
+      rgb[x * 3 + 2] = (b << 3) | (b >> 2);
+    }
+    Serial.write(rgb, width * 3);
+  }
+
+  Serial.println();
+  Serial.println("FRAME_END");
+}
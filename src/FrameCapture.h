@@ -0,0 +1,18 @@
+#ifndef FRAME_CAPTURE_H
+#define FRAME_CAPTURE_H
+
+#include <stdint.h>
+
+// Read the panel back over SPI (needs TFT_MISO wired) and stream it over
+// Serial as a binary PPM, framed by text marker lines:
+//
+//   FRAME_BEGIN <width> <height> <spiBytesLastFrame> <spiTransactionsLastFrame>
+//   P6\n<width> <height>\n255\n<width*height*3 bytes>
+//   FRAME_END
+//
+// tools/frame_capture.py saves the image and compares it to a golden frame.
+// A full 480x320 frame is ~460KB, so this takes ~40s at 115200 baud and
+// blocks rendering while it runs.
+void captureFrame();
+
+#endif // FRAME_CAPTURE_H
@@ -42,7 +42,4 @@ bool clientConnected = true;
 bool debugMode = false;
 float cpuUsage = 0.0;
 float fps = 0.0;
-uint32_t frameCount = 0;
-uint32_t lastFpsUpdate = 0;
-uint32_t lastCpuMeasure = 0;
 uint32_t loopStartTime = 0;
@@ -0,0 +1,117 @@
+#include "HistoryGraph.h"
+#include "Profiler.h"
+#include "Theme.h"
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+// External display object
+extern TFT_eSPI display;
+
+// Samples are stored as int16 in channel units x historyScale
+static int16_t historyRing[DATA_SOURCE_COUNT][HISTORY_SAMPLES];
+static uint32_t historyCount = 0;   // Total samples recorded (ring index = count % size)
+static uint32_t lastHistoryMs = 0;
+
+// Fixed plot range per channel (display units) and storage scale. A fixed
+// range keeps old columns valid, so nothing has to be repainted.
+struct HistoryRange {
+  int16_t low;
+  int16_t high;
+  uint8_t scale;
+};
+
+static const HistoryRange historyRange[DATA_SOURCE_COUNT] = {
+  {-20, 80,   10}, // DATA_SOURCE_IAT
+  {-20, 120,  10}, // DATA_SOURCE_COOLANT
+  {10,  20,   10}, // DATA_SOURCE_AFR
+  {-10, 50,   10}, // DATA_SOURCE_ADV
+  {0,   100,  10}, // DATA_SOURCE_TRIGGER
+  {0,   100,  10}, // DATA_SOURCE_TPS
+  {8,   16,   10}, // DATA_SOURCE_VOLTAGE
+  {0,   250,  10}, // DATA_SOURCE_MAP
+  {0,   8000, 1},  // DATA_SOURCE_RPM
+  {0,   100,  10}, // DATA_SOURCE_FP
+  {0,   250,  10}, // DATA_SOURCE_VSS
+};
+
+void recordHistory(uint32_t now) {
+  if (now - lastHistoryMs < HISTORY_SAMPLE_MS) {
+    return;
+  }
+  lastHistoryMs = now;
+  uint16_t index = historyCount % HISTORY_SAMPLES;
+  for (uint8_t i = 0; i < DATA_SOURCE_COUNT; i++) {
+    float value = getDataValue(i) * historyRange[i].scale;
+    historyRing[i][index] = (int16_t)constrain(value, -32768.0f, 32767.0f);
+  }
+  historyCount++;
+}
+
+void getChannelRange(uint8_t channel, int16_t &low, int16_t &high) {
+  const HistoryRange &range = historyRange[channel < DATA_SOURCE_COUNT ? channel : 0];
+  low = range.low;
+  high = range.high;
+}
+
+void initHistoryGraph(HistoryGraphView &view, uint8_t channel, int16_t x, int16_t y, int16_t w, int16_t h) {
+  view.channel = channel < DATA_SOURCE_COUNT ? channel : 0;
+  view.x = x;
+  view.y = y;
+  view.w = w;
+  view.h = h;
+  view.samplesPerColumn = max(1, HISTORY_SAMPLES / max((int16_t)1, w));
+  view.cursor = 0;
+  // Backfill as much of the plot as the ring still holds
+  uint32_t visible = (uint32_t)view.samplesPerColumn * w;
+  uint32_t available = min(historyCount, (uint32_t)HISTORY_SAMPLES);
+  uint32_t start = historyCount - min(visible, available);
+  view.nextSample = start - start % view.samplesPerColumn;
+}
+
+// Map a stored sample to a plot row (0 = top)
+static int16_t sampleToRow(const HistoryGraphView &view, int32_t sample) {
+  const HistoryRange &range = historyRange[view.channel];
+  int32_t low = (int32_t)range.low * range.scale;
+  int32_t high = (int32_t)range.high * range.scale;
+  sample = constrain(sample, low, high);
+  return (view.h - 1) - (int16_t)((sample - low) * (view.h - 1) / (high - low));
+}
+
+uint16_t drawHistoryGraph(HistoryGraphView &view, uint16_t color) {
+  // Fell further behind than the ring holds: resume at the oldest sample
+  if (historyCount - view.nextSample > HISTORY_SAMPLES) {
+    view.nextSample = historyCount - HISTORY_SAMPLES;
+  }
+
+  uint16_t columns = 0;
+  const int16_t *ring = historyRing[view.channel];
+  while (historyCount - view.nextSample >= view.samplesPerColumn) {
+    int16_t lo = 32767;
+    int16_t hi = -32768;
+    for (uint8_t i = 0; i < view.samplesPerColumn; i++) {
+      int16_t sample = ring[(view.nextSample + i) % HISTORY_SAMPLES];
+      lo = min(lo, sample);
+      hi = max(hi, sample);
+    }
+    view.nextSample += view.samplesPerColumn;
+
+    // Min/max envelope as one vertical run, background above and below
+    int16_t column = view.x + view.cursor;
+    int16_t top = sampleToRow(view, hi);
+    int16_t bottom = sampleToRow(view, lo);
+    if (top > 0) {
+      display.drawFastVLine(column, view.y, top, themeColor(THEME_BACKGROUND));
+    }
+    display.drawFastVLine(column, view.y + top, bottom - top + 1, color);
+    if (bottom < view.h - 1) {
+      display.drawFastVLine(column, view.y + bottom + 1, view.h - 1 - bottom, themeColor(THEME_BACKGROUND));
+    }
+
+    // Gap ahead of the cursor marks where the newest data is
+    view.cursor = (view.cursor + 1) % view.w;
+    display.drawFastVLine(view.x + view.cursor, view.y, view.h, themeColor(THEME_BORDER));
+    PROFILE_SPI(2 * view.h);
+    columns++;
+  }
+  return columns;
+}
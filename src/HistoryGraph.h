@@ -0,0 +1,34 @@
+#ifndef HISTORY_GRAPH_H
+#define HISTORY_GRAPH_H
+
+#include <stdint.h>
+#include "DisplayConfig.h"
+
+#define HISTORY_SAMPLE_MS 20     // 50 Hz history, matches the serial poll rate
+#define HISTORY_SAMPLES 512      // Per channel, ~10s of history
+
+// Sweep-cursor strip chart state for one graph widget. The plot is never
+// scrolled: each new column is drawn at the cursor, which wraps around, and
+// the column ahead of it is cleared so the newest data is easy to spot.
+struct HistoryGraphView {
+  int16_t x, y, w, h;       // Plot area
+  uint8_t channel;          // DataSource
+  uint8_t samplesPerColumn; // Samples min/max-decimated into one pixel column
+  uint16_t cursor;          // Next column to draw
+  uint32_t nextSample;      // First sample of the next column
+};
+
+// Call once per loop; records every channel at HISTORY_SAMPLE_MS into
+// fixed, preallocated rings.
+void recordHistory(uint32_t now);
+
+// Fixed plot range of a channel in display units (also used by gauges)
+void getChannelRange(uint8_t channel, int16_t &low, int16_t &high);
+
+void initHistoryGraph(HistoryGraphView &view, uint8_t channel, int16_t x, int16_t y, int16_t w, int16_t h);
+
+// Draw the columns that have completed since the last call (all of the
+// visible history on the first call). Returns the number of columns drawn.
+uint16_t drawHistoryGraph(HistoryGraphView &view, uint16_t color);
+
+#endif // HISTORY_GRAPH_H
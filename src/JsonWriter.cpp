@@ -0,0 +1,148 @@
+#include "JsonWriter.h"
+#include "text_utils.h"
+#include <string.h>
+
+JsonWriter::JsonWriter(char *buf, size_t size)
+  : buf(buf), size(size), len(0), overflow(size == 0), depth(0), hasItems(0) {
+  if (size > 0) {
+    buf[0] = '\0';
+  }
+}
+
+// Keep one byte for the terminator, which is rewritten after every put
+void JsonWriter::put(char c) {
+  if (len + 1 >= size) {
+    overflow = true;
+    return;
+  }
+  buf[len++] = c;
+  buf[len] = '\0';
+}
+
+// Copies as much of the run as fits, then terminates once
+void JsonWriter::put(const char *s, size_t count) {
+  size_t room = len + 1 < size ? size - len - 1 : 0;
+  if (count > room) {
+    count = room;
+    overflow = true;
+  }
+  if (count > 0) {
+    memcpy(buf + len, s, count);
+    len += count;
+    buf[len] = '\0';
+  }
+}
+
+void JsonWriter::put(const char *s) {
+  put(s, strlen(s));
+}
+
+// Plain characters go out in runs; only the escapes are written singly
+void JsonWriter::putString(const char *s) {
+  static const char hex[] = "0123456789abcdef";
+  put('"');
+  const char *run = s;
+  for (; *s; s++) {
+    char c = *s;
+    if (c != '"' && c != '\\' && (uint8_t)c >= 0x20) {
+      continue;
+    }
+    put(run, s - run);
+    if (c == '"' || c == '\\') {
+      put('\\');
+      put(c);
+    } else {
+      put("\\u00", 4);
+      put(hex[(c >> 4) & 0xF]);
+      put(hex[c & 0xF]);
+    }
+    run = s + 1;
+  }
+  put(run, s - run);
+  put('"');
+}
+
+void JsonWriter::separator(const char *key) {
+  uint16_t bit = 1 << depth;
+  if (hasItems & bit) {
+    put(',');
+  }
+  hasItems |= bit;
+  if (key) {
+    putString(key);
+    put(':');
+  }
+}
+
+// Enter an object/array; its first member gets no comma
+void JsonWriter::push(char open, const char *key) {
+  separator(key);
+  put(open);
+  if (depth < JSON_MAX_DEPTH) {
+    depth++;
+    hasItems &= ~(1 << depth);
+  } else {
+    overflow = true;
+  }
+}
+
+void JsonWriter::pop(char close) {
+  if (depth > 0) {
+    depth--;
+  }
+  put(close);
+}
+
+void JsonWriter::beginObject(const char *key) {
+  push('{', key);
+}
+
+void JsonWriter::endObject() {
+  pop('}');
+}
+
+void JsonWriter::beginArray(const char *key) {
+  push('[', key);
+}
+
+void JsonWriter::endArray() {
+  pop(']');
+}
+
+void JsonWriter::addString(const char *key, const char *value) {
+  separator(key);
+  putString(value ? value : "");
+}
+
+void JsonWriter::addBool(const char *key, bool value) {
+  separator(key);
+  put(value ? "true" : "false");
+}
+
+void JsonWriter::addInt(const char *key, int32_t value) {
+  addFixed(key, value, 0);
+}
+
+void JsonWriter::addUInt(const char *key, uint32_t value) {
+  // Digits back to front, as in formatFixed()
+  char tmp[FORMAT_BUFFER_SIZE];
+  char *p = tmp + sizeof(tmp);
+  *--p = '\0';
+  do {
+    *--p = '0' + (value % 10);
+    value /= 10;
+  } while (value);
+  separator(key);
+  put(p);
+}
+
+void JsonWriter::addFloat(const char *key, float value, uint8_t decimals) {
+  addFixed(key, toFixed(value, decimals), decimals);
+}
+
+void JsonWriter::addFixed(const char *key, int32_t value, uint8_t decimals) {
+  char tmp[FORMAT_BUFFER_SIZE];
+  formatFixed(tmp, value, decimals);
+  separator(key);
+  put(tmp);
+}
@@ -0,0 +1,56 @@
+#ifndef JSON_WRITER_H
+#define JSON_WRITER_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define JSON_MAX_DEPTH 8
+
+// Serializes JSON into a caller-owned buffer; never allocates. Commas are
+// inserted automatically. Writes past the end are dropped and flagged, so
+// callers check overflowed() once instead of every step.
+//
+//   JsonWriter json(buf, sizeof(buf));
+//   json.beginObject();
+//   json.addFloat("fps", fps, 1);
+//   json.beginArray("panels"); ... json.endArray();
+//   json.endObject();
+class JsonWriter {
+public:
+  JsonWriter(char *buf, size_t size);
+
+  void beginObject(const char *key = NULL);
+  void endObject();
+  void beginArray(const char *key = NULL);
+  void endArray();
+
+  // Object members (key != NULL) or array elements (key == NULL)
+  void addString(const char *key, const char *value);
+  void addBool(const char *key, bool value);
+  void addInt(const char *key, int32_t value);
+  void addUInt(const char *key, uint32_t value);
+  void addFloat(const char *key, float value, uint8_t decimals);
+  void addFixed(const char *key, int32_t value, uint8_t decimals);
+
+  const char *c_str() const { return buf; }
+  size_t length() const { return len; }
+  bool overflowed() const { return overflow; }
+
+private:
+  void separator(const char *key);
+  void push(char open, const char *key);
+  void pop(char close);
+  void put(char c);
+  void put(const char *s);
+  void put(const char *s, size_t count);
+  void putString(const char *s);
+
+  char *buf;
+  size_t size;
+  size_t len;
+  bool overflow;
+  uint8_t depth;
+  uint16_t hasItems;  // Bit per nesting level: a value was already written
+};
+
+#endif // JSON_WRITER_H
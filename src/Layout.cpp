@@ -0,0 +1,314 @@
+#include "Layout.h"
+#include "Config.h"
+#include "DisplayConfig.h"
+#include "Theme.h"
+#include "ChannelFilter.h"
+#include <stdio.h>
+#include <string.h>
+
+// Panel slots used by the street page. Each panel is 80x80; the RPM bar
+// occupies roughly Y=40 to Y=150 so the columns sit left and right of it.
+// With RPM shown digitally the bar is left out and its area holds 8-10.
+static const int16_t streetPanelSlots[DISPLAY_MAX_PANELS][2] = {
+  {0, 20},    // Position 0: Left-Top
+  {0, 110},   // Position 1: Left-Middle
+  {0, 200},   // Position 2: Left-Bottom
+  {390, 20},  // Position 3: Right-Top
+  {390, 110}, // Position 4: Right-Middle
+  {390, 200}, // Position 5: Right-Bottom
+  {130, 200}, // Position 6: Center-Left
+  {250, 200}, // Position 7: Center-Right
+  {120, 50},  // Position 8: Bar area left (digital RPM only)
+  {200, 50},  // Position 9: Bar area middle
+  {280, 50}   // Position 10: Bar area right
+};
+
+// Widgets shared by the pages that show the RPM bar
+#define RPM_BAR_WIDGET   {WIDGET_RPM_BAR, DATA_SOURCE_RPM, 0, 120, 40, 240, 150, NULL, 0, 0}
+#define RPM_TEXT_WIDGET  {WIDGET_RPM_TEXT, DATA_SOURCE_RPM, 0, 275, 15, 90, 30, NULL, 0, 0}
+#define SPEED_WIDGET     {WIDGET_SPEED, DATA_SOURCE_VSS, 0, 250, 135, 120, 50, NULL, 0, 0}
+
+#define INDICATOR_Y 290
+#define INDICATOR_PITCH 60
+#define STREET_FIXED_WIDGETS 3
+
+// A full street page always fits the compiled command array
+static_assert(STREET_FIXED_WIDGETS + DISPLAY_MAX_PANELS + DISPLAY_MAX_INDICATORS <= LAYOUT_MAX_COMMANDS,
+              "street page exceeds LAYOUT_MAX_COMMANDS");
+
+static const WidgetDesc trackPage[] = {
+  RPM_BAR_WIDGET,
+  RPM_TEXT_WIDGET,
+  SPEED_WIDGET,
+  {WIDGET_PANEL, DATA_SOURCE_AFR, 1, 0, 20, 80, 80, NULL, 110, 150},
+  {WIDGET_PANEL, DATA_SOURCE_MAP, 0, 0, 110, 80, 80, NULL, 0, 0},
+  {WIDGET_PANEL, DATA_SOURCE_IAT, 0, 0, 200, 80, 80, NULL, 0, 60},
+  {WIDGET_PANEL, DATA_SOURCE_COOLANT, 0, 390, 20, 80, 80, NULL, 0, 100},
+  {WIDGET_PANEL, DATA_SOURCE_VOLTAGE, 1, 390, 110, 80, 80, NULL, 120, 150},
+  {WIDGET_PANEL, DATA_SOURCE_FP, 0, 390, 200, 80, 80, NULL, 0, 0},
+  {WIDGET_INDICATOR, INDICATOR_SYNC, 0, 5, INDICATOR_Y, 50, 30, NULL, 0, 0},
+  {WIDGET_INDICATOR, INDICATOR_REV, 0, 5 + INDICATOR_PITCH, INDICATOR_Y, 50, 30, NULL, 0, 0},
+  {WIDGET_INDICATOR, INDICATOR_LCH, 0, 5 + 2 * INDICATOR_PITCH, INDICATOR_Y, 50, 30, NULL, 0, 0},
+  {WIDGET_INDICATOR, INDICATOR_FAN, 0, 5 + 3 * INDICATOR_PITCH, INDICATOR_Y, 50, 30, NULL, 0, 0}
+};
+
+// Two rows of six panels across the full width, RPM/MAP history graphs
+// and indicators underneath
+static const WidgetDesc diagnosticsPage[] = {
+  {WIDGET_PANEL, DATA_SOURCE_RPM, 0, 0, 20, 80, 80, NULL, 0, 0},
+  {WIDGET_PANEL, DATA_SOURCE_VSS, 0, 80, 20, 80, 80, NULL, 0, 0},
+  {WIDGET_PANEL, DATA_SOURCE_MAP, 0, 160, 20, 80, 80, NULL, 0, 0},
+  {WIDGET_PANEL, DATA_SOURCE_TPS, 0, 240, 20, 80, 80, NULL, 0, 0},
+  {WIDGET_PANEL, DATA_SOURCE_AFR, 1, 320, 20, 80, 80, NULL, 110, 150},
+  {WIDGET_PANEL, DATA_SOURCE_ADV, 0, 400, 20, 80, 80, NULL, 0, 0},
+  {WIDGET_PANEL, DATA_SOURCE_IAT, 0, 0, 110, 80, 80, NULL, 0, 60},
+  {WIDGET_PANEL, DATA_SOURCE_COOLANT, 0, 80, 110, 80, 80, NULL, 0, 100},
+  {WIDGET_PANEL, DATA_SOURCE_VOLTAGE, 1, 160, 110, 80, 80, NULL, 120, 150},
+  {WIDGET_PANEL, DATA_SOURCE_FP, 0, 240, 110, 80, 80, NULL, 0, 0},
+  {WIDGET_PANEL, DATA_SOURCE_TRIGGER, 0, 320, 110, 80, 80, NULL, 0, 1},
+  {WIDGET_GRAPH, DATA_SOURCE_AFR, 1, 400, 110, 80, 80, NULL, 0, 0},
+  {WIDGET_GRAPH, DATA_SOURCE_RPM, 0, 0, 200, 240, 85, NULL, 0, 0},
+  {WIDGET_GRAPH, DATA_SOURCE_MAP, 0, 240, 200, 240, 85, NULL, 0, 0},
+  {WIDGET_INDICATOR, INDICATOR_SYNC, 0, 5, INDICATOR_Y, 50, 30, NULL, 0, 0},
+  {WIDGET_INDICATOR, INDICATOR_FAN, 0, 5 + INDICATOR_PITCH, INDICATOR_Y, 50, 30, NULL, 0, 0},
+  {WIDGET_INDICATOR, INDICATOR_ASE, 0, 5 + 2 * INDICATOR_PITCH, INDICATOR_Y, 50, 30, NULL, 0, 0},
+  {WIDGET_INDICATOR, INDICATOR_WUE, 0, 5 + 3 * INDICATOR_PITCH, INDICATOR_Y, 50, 30, NULL, 0, 0},
+  {WIDGET_INDICATOR, INDICATOR_REV, 0, 5 + 4 * INDICATOR_PITCH, INDICATOR_Y, 50, 30, NULL, 0, 0},
+  {WIDGET_INDICATOR, INDICATOR_LCH, 0, 5 + 5 * INDICATOR_PITCH, INDICATOR_Y, 50, 30, NULL, 0, 0},
+  {WIDGET_INDICATOR, INDICATOR_AC, 0, 5 + 6 * INDICATOR_PITCH, INDICATOR_Y, 50, 30, NULL, 0, 0},
+  {WIDGET_INDICATOR, INDICATOR_DFCO, 0, 5 + 7 * INDICATOR_PITCH, INDICATOR_Y, 50, 30, NULL, 0, 0}
+};
+
+static CompiledLayout compiledLayout;
+static uint8_t activePage = PAGE_STREET;
+static bool layoutChanged = true;
+static bool layoutUpdated = false;
+static DrawCommand previousCommands[LAYOUT_MAX_COMMANDS];
+
+// Update contract per widget type: priority class, minimum interval,
+// maximum staleness (ms) and the pixels a typical redraw pushes
+struct WidgetTiming {
+  uint8_t priority;
+  uint16_t minIntervalMs;
+  uint16_t maxStaleMs;
+  uint16_t cost;
+};
+
+static const WidgetTiming widgetTiming[] = {
+  {PRIO_NORMAL,   50,  250,              2 * 21 * 36}, // WIDGET_PANEL: ~2 large digit cells
+  {PRIO_CRITICAL, 0,   RPM_BAR_FRAME_MS, 0},           // WIDGET_RPM_BAR: paces itself
+  {PRIO_HIGH,     0,   100,              2 * 9 * 15},  // WIDGET_RPM_TEXT: ~2 small digit cells
+  {PRIO_HIGH,     0,   200,              2 * 21 * 36}, // WIDGET_SPEED
+  {PRIO_LOW,      100, 500,              50 * 30},     // WIDGET_INDICATOR: whole button
+  {PRIO_NORMAL,   100, 250,              2 * 80},      // WIDGET_GRAPH: ~one column + cursor
+  {PRIO_HIGH,     0,   RPM_BAR_FRAME_MS, 300},         // WIDGET_GAUGE: needle wedge, ~60 Hz
+};
+
+static void addCommand(const WidgetDesc &desc) {
+  if (compiledLayout.count >= LAYOUT_MAX_COMMANDS) {
+    return;
+  }
+  DrawCommand &cmd = compiledLayout.commands[compiledLayout.count++];
+  cmd.type = desc.type;
+  cmd.binding = desc.binding;
+  cmd.decimals = desc.decimals;
+  cmd.x = desc.x;
+  cmd.y = desc.y;
+  cmd.w = desc.w;
+  cmd.h = desc.h;
+  const char *label = desc.label;
+  if (label == NULL) {
+    label = desc.type == WIDGET_INDICATOR ? getIndicatorName(desc.binding) : getDataSourceName(desc.binding);
+  }
+  snprintf(cmd.label, sizeof(cmd.label), "%s", label);
+  cmd.warnLow = desc.warnLow;
+  cmd.warnHigh = desc.warnHigh;
+  cmd.lastValue = INT32_MIN;
+  cmd.lastRole = THEME_TEXT;
+  cmd.lastState = false;
+  memset(&cmd.field, 0, sizeof(cmd.field));
+  memset(&cmd.graph, 0, sizeof(cmd.graph));
+  memset(&cmd.gauge, 0, sizeof(cmd.gauge));
+  const WidgetTiming &timing = widgetTiming[desc.type];
+  initScheduleSlot(cmd.sched, timing.priority, timing.minIntervalMs, timing.maxStaleMs, timing.cost);
+  cmd.themeEpoch = getThemeEpoch();
+}
+
+static void compileStreetPage() {
+  const WidgetDesc fixedWidgets[STREET_FIXED_WIDGETS] = {RPM_BAR_WIDGET, RPM_TEXT_WIDGET, SPEED_WIDGET};
+  bool digitalRpm = currentDisplayConfig.rpmDisplayMode == 1;
+  for (uint8_t i = digitalRpm ? 1 : 0; i < STREET_FIXED_WIDGETS; i++) {
+    addCommand(fixedWidgets[i]);
+  }
+
+  // The counts are validated against the arrays, which the static_assert
+  // above keeps within the compiled layout
+  uint8_t slots = digitalRpm ? DISPLAY_MAX_PANELS : DISPLAY_BAR_SLOTS;
+  for (uint8_t i = 0; i < currentDisplayConfig.activePanelCount; i++) {
+    const DisplayPanel &panel = currentDisplayConfig.panels[i];
+    if (!panel.enabled || panel.position >= slots) {
+      continue;
+    }
+    uint8_t type = WIDGET_PANEL;
+    if (panel.dataType == DATA_TYPE_GRAPH) {
+      type = WIDGET_GRAPH;
+    } else if (panel.dataType == DATA_TYPE_GAUGE) {
+      type = WIDGET_GAUGE;
+    }
+    WidgetDesc desc = {type, panel.dataSource, panel.decimals,
+                       streetPanelSlots[panel.position][0], streetPanelSlots[panel.position][1], 80, 80,
+                       panel.label, 0, 0};
+    addCommand(desc);
+  }
+
+  // Pack enabled indicators without gaps
+  int slot = 0;
+  for (uint8_t i = 0; i < currentDisplayConfig.activeIndicatorCount; i++) {
+    const IndicatorConfig &indicator = currentDisplayConfig.indicators[i];
+    if (!indicator.enabled || indicator.position >= DISPLAY_MAX_INDICATORS) {
+      continue;
+    }
+    WidgetDesc desc = {WIDGET_INDICATOR, indicator.indicator, 0,
+                       (int16_t)(5 + INDICATOR_PITCH * slot), INDICATOR_Y, 50, 30,
+                       indicator.label, 0, 0};
+    addCommand(desc);
+    slot++;
+  }
+}
+
+static void compileStaticPage(const WidgetDesc *widgets, uint8_t count) {
+  for (uint8_t i = 0; i < count; i++) {
+    addCommand(widgets[i]);
+  }
+}
+
+// Turn a page description into a flat array of draw commands. Runs only
+// when the page or configuration changes; drawing just walks the array.
+void compileLayout(uint8_t page) {
+  if (page >= PAGE_COUNT) {
+    page = PAGE_STREET;
+  }
+  compiledLayout.page = page;
+  compiledLayout.count = 0;
+
+  switch (page) {
+    case PAGE_TRACK:
+      compileStaticPage(trackPage, sizeof(trackPage) / sizeof(trackPage[0]));
+      break;
+    case PAGE_DIAGNOSTICS:
+      compileStaticPage(diagnosticsPage, sizeof(diagnosticsPage) / sizeof(diagnosticsPage[0]));
+      break;
+    case PAGE_STREET:
+    default:
+      compileStreetPage();
+      break;
+  }
+
+  // Channels are rounded at the finest precision any widget shows them at
+  int8_t decimals[DATA_SOURCE_COUNT];
+  memset(decimals, -1, sizeof(decimals));
+  for (uint8_t i = 0; i < compiledLayout.count; i++) {
+    const DrawCommand &cmd = compiledLayout.commands[i];
+    if (cmd.type != WIDGET_INDICATOR && cmd.binding < DATA_SOURCE_COUNT && cmd.decimals > decimals[cmd.binding]) {
+      decimals[cmd.binding] = cmd.decimals;
+    }
+  }
+  for (uint8_t source = 0; source < DATA_SOURCE_COUNT; source++) {
+    if (decimals[source] >= 0) {
+      setChannelDecimals(source, decimals[source]);
+    }
+  }
+}
+
+static bool sameWidget(const DrawCommand &a, const DrawCommand &b) {
+  return a.type == b.type && a.binding == b.binding && a.decimals == b.decimals &&
+         a.x == b.x && a.y == b.y && a.w == b.w && a.h == b.h &&
+         a.warnLow == b.warnLow && a.warnHigh == b.warnHigh &&
+         strcmp(a.label, b.label) == 0;
+}
+
+void recompileLayout(LayoutDiff &diff) {
+  uint8_t previousCount = compiledLayout.count;
+  bool kept[LAYOUT_MAX_COMMANDS] = {false};
+  memcpy(previousCommands, compiledLayout.commands, previousCount * sizeof(DrawCommand));
+  compileLayout(compiledLayout.page);
+
+  // Carry the drawn state (digits, graph cursor, gauge angle, schedule)
+  // over to every widget that is still there
+  diff.freshCount = 0;
+  for (uint8_t i = 0; i < compiledLayout.count; i++) {
+    DrawCommand &cmd = compiledLayout.commands[i];
+    uint8_t j = 0;
+    while (j < previousCount && (kept[j] || !sameWidget(cmd, previousCommands[j]))) {
+      j++;
+    }
+    if (j < previousCount) {
+      cmd = previousCommands[j];
+      kept[j] = true;
+    } else {
+      diff.fresh[diff.freshCount++] = i;
+    }
+  }
+
+  diff.staleCount = 0;
+  for (uint8_t j = 0; j < previousCount; j++) {
+    if (!kept[j]) {
+      const DrawCommand &old = previousCommands[j];
+      LayoutRect rect = {old.x, old.y, old.w, old.h};
+      diff.stale[diff.staleCount++] = rect;
+    }
+  }
+}
+
+CompiledLayout &getCompiledLayout() {
+  return compiledLayout;
+}
+
+uint8_t getActivePage() {
+  return activePage;
+}
+
+void setActivePage(uint8_t page) {
+  if (page >= PAGE_COUNT) {
+    return;
+  }
+  activePage = page;
+  layoutChanged = true;
+}
+
+// Rebuild the current page, e.g. after the display configuration changed
+void requestLayoutRebuild() {
+  layoutChanged = true;
+}
+
+// Returns true once after a page switch or rebuild request
+bool consumeLayoutChange() {
+  if (!layoutChanged) {
+    return false;
+  }
+  layoutChanged = false;
+  layoutUpdated = false; // A full rebuild covers any pending edit
+  return true;
+}
+
+// Configuration edit on the current page; see recompileLayout()
+void requestLayoutUpdate() {
+  layoutUpdated = true;
+}
+
+bool consumeLayoutUpdate() {
+  if (!layoutUpdated) {
+    return false;
+  }
+  layoutUpdated = false;
+  return true;
+}
+
+const char *getPageName(uint8_t page) {
+  switch (page) {
+    case PAGE_STREET: return "Street";
+    case PAGE_TRACK: return "Track";
+    case PAGE_DIAGNOSTICS: return "Diagnostics";
+    default: return "Unknown";
+  }
+}
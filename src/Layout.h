@@ -0,0 +1,96 @@
+#ifndef LAYOUT_H
+#define LAYOUT_H
+
+#include <stdint.h>
+#include "DigitRenderer.h"
+#include "Scheduler.h"
+#include "HistoryGraph.h"
+#include "ArcGauge.h"
+
+// Maximum number of draw commands in one compiled page
+#define LAYOUT_MAX_COMMANDS 32
+#define LAYOUT_LABEL_MAX 10     // Matches DisplayPanel::label
+
+// Display pages
+enum LayoutPage {
+  PAGE_STREET,        // User layout from DisplayConfiguration
+  PAGE_TRACK,         // Large speed, RPM bar and the essentials
+  PAGE_DIAGNOSTICS,   // Every channel as a panel, no RPM bar
+  PAGE_COUNT
+};
+
+// Widget types a layout can place
+enum WidgetType {
+  WIDGET_PANEL,       // Boxed label + value (drawDataBox)
+  WIDGET_RPM_BAR,     // Block RPM bar
+  WIDGET_RPM_TEXT,    // Small RPM readout
+  WIDGET_SPEED,       // Large VSS readout with unit
+  WIDGET_INDICATOR,   // On/off status button
+  WIDGET_GRAPH,       // History strip chart of one channel
+  WIDGET_GAUGE        // Arc gauge of one channel
+};
+
+// Layout description of a single widget
+struct WidgetDesc {
+  uint8_t type;           // WidgetType
+  uint8_t binding;        // DataSource for values, IndicatorSource for indicators
+  uint8_t decimals;       // Decimal places for values
+  int16_t x, y, w, h;     // Screen rect
+  const char *label;      // NULL = channel name
+  int16_t warnLow;        // Value outside [warnLow, warnHigh] is drawn in warning
+  int16_t warnHigh;       // color (fixed-point, same decimals). warnLow >= warnHigh disables
+};
+
+// Precomputed draw command produced by compileLayout()
+struct DrawCommand {
+  uint8_t type;
+  uint8_t binding;
+  uint8_t decimals;
+  int16_t x, y, w, h;
+  char label[LAYOUT_LABEL_MAX]; // Own copy, so config edits cannot change it mid-frame
+  int32_t warnLow;        // Fixed-point bounds, warnLow >= warnHigh disables
+  int32_t warnHigh;
+  int32_t lastValue;      // Fixed-point value last drawn
+  uint8_t lastRole;       // ThemeColor role last drawn
+  bool lastState;         // Last indicator state drawn
+  DigitField field;       // Value digits for panels and readouts
+  HistoryGraphView graph; // Strip chart state for graph widgets
+  ArcGaugeView gauge;     // Ring state for gauge widgets
+  ScheduleSlot sched;     // Priority, deadline and achieved update stats
+  uint8_t themeEpoch;     // Theme epoch of the last full (setup) draw
+};
+
+struct CompiledLayout {
+  uint8_t page;
+  uint8_t count;
+  DrawCommand commands[LAYOUT_MAX_COMMANDS];
+};
+
+// What an in-place recompile changed: commands that need a setup draw and
+// screen areas of removed widgets that must be cleared
+struct LayoutRect {
+  int16_t x, y, w, h;
+};
+
+struct LayoutDiff {
+  uint8_t freshCount;
+  uint8_t fresh[LAYOUT_MAX_COMMANDS];
+  uint8_t staleCount;
+  LayoutRect stale[LAYOUT_MAX_COMMANDS];
+};
+
+void compileLayout(uint8_t page);
+// Recompile the current page after a configuration edit. Widgets whose
+// type, binding, format, rect and label are unchanged keep their drawn
+// state and are not redrawn.
+void recompileLayout(LayoutDiff &diff);
+CompiledLayout &getCompiledLayout();
+uint8_t getActivePage();
+void setActivePage(uint8_t page);
+void requestLayoutRebuild();
+bool consumeLayoutChange();
+void requestLayoutUpdate();
+bool consumeLayoutUpdate();
+const char *getPageName(uint8_t page);
+
+#endif // LAYOUT_H
@@ -0,0 +1,232 @@
+#include "LayoutDocument.h"
+#include "Layout.h"
+#include "Theme.h"
+#include "text_utils.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define LAYOUT_MAX_FIELDS 8
+
+static void appendLine(char *buf, size_t size, size_t &len, const char *format, ...) __attribute__((format(printf, 4, 5)));
+static void appendLine(char *buf, size_t size, size_t &len, const char *format, ...) {
+  if (len + 1 >= size) {
+    return;
+  }
+  va_list args;
+  va_start(args, format);
+  int written = vsnprintf(buf + len, size - len, format, args);
+  va_end(args);
+  if (written > 0) {
+    len += ((size_t)written < size - len) ? (size_t)written : size - len - 1;
+  }
+}
+
+// Labels travel as single tokens: spaces are written as '_' and read back
+static void copyToken(char *dest, size_t size, const char *src, char from, char to) {
+  size_t i = 0;
+  for (; src[i] && i + 1 < size; i++) {
+    dest[i] = src[i] == from ? to : src[i];
+  }
+  dest[i] = '\0';
+}
+
+size_t writeLayoutDocument(char *buf, size_t size) {
+  size_t len = 0;
+  char label[sizeof(((DisplayPanel *)0)->label)];
+  char unit[sizeof(((DisplayPanel *)0)->unit)];
+  if (size > 0) {
+    buf[0] = '\0';
+  }
+
+  for (uint8_t i = 0; i < currentDisplayConfig.activePanelCount; i++) {
+    const DisplayPanel &panel = currentDisplayConfig.panels[i];
+    copyToken(label, sizeof(label), panel.label[0] ? panel.label : getDataSourceName(panel.dataSource), ' ', '_');
+    copyToken(unit, sizeof(unit), panel.unit, ' ', '_');
+    appendLine(buf, size, len, "panel %u %u %u %u %u %s%s%s\n", panel.position, panel.dataSource, panel.dataType,
+               panel.decimals, panel.enabled ? 1 : 0, label, unit[0] ? " " : "", unit);
+  }
+  for (uint8_t i = 0; i < currentDisplayConfig.activeIndicatorCount; i++) {
+    const IndicatorConfig &indicator = currentDisplayConfig.indicators[i];
+    copyToken(label, sizeof(label), indicator.label[0] ? indicator.label : getIndicatorName(indicator.indicator), ' ', '_');
+    appendLine(buf, size, len, "indicator %u %u %u %s\n", indicator.position, indicator.indicator,
+               indicator.enabled ? 1 : 0, label);
+  }
+  for (uint8_t source = 0; source < DATA_SOURCE_COUNT; source++) {
+    const ChannelBands &bands = getChannelBands(source);
+    char number[FORMAT_BUFFER_SIZE];
+    formatFixed(number, bands.hysteresis, BAND_DECIMALS);
+    appendLine(buf, size, len, "band %u %s ", source, number);
+    if (bands.count == 0) {
+      appendLine(buf, size, len, "-");
+    }
+    for (uint8_t e = 0; e < bands.count; e++) {
+      formatFixed(number, bands.edge[e], BAND_DECIMALS);
+      appendLine(buf, size, len, "%s%s", e ? "," : "", number);
+    }
+    for (uint8_t r = 0; r <= bands.count; r++) {
+      appendLine(buf, size, len, "%c%s", r ? ',' : ' ', getBandRoleName(bands.role[r]));
+    }
+    appendLine(buf, size, len, "\n");
+  }
+  appendLine(buf, size, len, "rpm %u\nsystem %u\n", currentDisplayConfig.rpmDisplayMode,
+             currentDisplayConfig.showSystemIndicators ? 1 : 0);
+  return len;
+}
+
+// Whole-token unsigned integer no larger than max
+static bool parseNumber(const char *text, uint32_t max, uint8_t &value) {
+  char *end;
+  unsigned long parsed = strtoul(text, &end, 10);
+  if (end == text || *end != '\0' || parsed > max) {
+    return false;
+  }
+  value = (uint8_t)parsed;
+  return true;
+}
+
+static bool parseLine(char **field, uint8_t fields, LayoutDocument &doc, const char *&reason) {
+  const char *keyword = field[0];
+  uint8_t value;
+
+  if (strcmp(keyword, "panel") == 0) {
+    DisplayConfiguration &config = doc.config;
+    if (fields < 7 || fields > 8) { reason = "panel needs position source type decimals enabled label [unit]"; return false; }
+    if (config.activePanelCount >= DISPLAY_MAX_PANELS) { reason = "too many panels"; return false; }
+    DisplayPanel &panel = config.panels[config.activePanelCount];
+    memset(&panel, 0, sizeof(panel));
+    if (!parseNumber(field[1], DISPLAY_MAX_PANELS - 1, panel.position)) { reason = "position out of range"; return false; }
+    if (!parseNumber(field[2], DATA_SOURCE_COUNT - 1, panel.dataSource)) { reason = "unknown source"; return false; }
+    if (!parseNumber(field[3], DATA_TYPE_GAUGE, panel.dataType)) { reason = "unknown type"; return false; }
+    if (!parseNumber(field[4], 3, panel.decimals)) { reason = "decimals must be 0..3"; return false; }
+    if (!parseNumber(field[5], 1, value)) { reason = "enabled must be 0 or 1"; return false; }
+    panel.enabled = value;
+    if (strlen(field[6]) >= sizeof(panel.label)) { reason = "label too long"; return false; }
+    copyToken(panel.label, sizeof(panel.label), field[6], '_', ' ');
+    if (fields == 8) {
+      if (strlen(field[7]) >= sizeof(panel.unit)) { reason = "unit too long"; return false; }
+      copyToken(panel.unit, sizeof(panel.unit), field[7], '_', ' ');
+    }
+    panel.color = THEME_TEXT;
+    config.activePanelCount++;
+    return true;
+  }
+
+  if (strcmp(keyword, "indicator") == 0) {
+    DisplayConfiguration &config = doc.config;
+    if (fields < 4 || fields > 5) { reason = "indicator needs position indicator enabled [label]"; return false; }
+    if (config.activeIndicatorCount >= DISPLAY_MAX_INDICATORS) { reason = "too many indicators"; return false; }
+    IndicatorConfig &indicator = config.indicators[config.activeIndicatorCount];
+    memset(&indicator, 0, sizeof(indicator));
+    if (!parseNumber(field[1], DISPLAY_MAX_INDICATORS - 1, indicator.position)) { reason = "position out of range"; return false; }
+    if (!parseNumber(field[2], INDICATOR_COUNT - 1, indicator.indicator)) { reason = "unknown indicator"; return false; }
+    if (!parseNumber(field[3], 1, value)) { reason = "enabled must be 0 or 1"; return false; }
+    indicator.enabled = value;
+    const char *label = fields == 5 ? field[4] : getIndicatorName(indicator.indicator);
+    if (strlen(label) >= sizeof(indicator.label)) { reason = "label too long"; return false; }
+    copyToken(indicator.label, sizeof(indicator.label), label, '_', ' ');
+    config.activeIndicatorCount++;
+    return true;
+  }
+
+  if (strcmp(keyword, "band") == 0) {
+    if (fields != 5) { reason = "band needs source hysteresis edges roles"; return false; }
+    uint8_t source;
+    if (!parseNumber(field[1], DATA_SOURCE_COUNT - 1, source)) { reason = "unknown source"; return false; }
+    ChannelBands &bands = doc.bands[source];
+    memset(&bands, 0, sizeof(bands));
+    bands.hysteresis = toFixed(atof(field[2]), BAND_DECIMALS);
+    if (!parseBandLists(field[3], field[4], bands)) { reason = "edges must ascend, with one role per band"; return false; }
+    doc.bandMask |= 1 << source;
+    return true;
+  }
+
+  if (strcmp(keyword, "rpm") == 0) {
+    if (fields != 2 || !parseNumber(field[1], 1, doc.config.rpmDisplayMode)) { reason = "rpm must be 0 or 1"; return false; }
+    return true;
+  }
+
+  if (strcmp(keyword, "system") == 0) {
+    if (fields != 2 || !parseNumber(field[1], 1, value)) { reason = "system must be 0 or 1"; return false; }
+    doc.config.showSystemIndicators = value;
+    return true;
+  }
+
+  reason = "unknown item";
+  return false;
+}
+
+bool parseLayoutDocument(char *text, LayoutDocument &doc, char *error, size_t errorSize) {
+  // Settings the document does not carry (CAN speed) are kept
+  doc.config = currentDisplayConfig;
+  doc.config.activePanelCount = 0;
+  doc.config.activeIndicatorCount = 0;
+  doc.bandMask = 0;
+
+  uint16_t lineNumber = 0;
+  char *line = text;
+  while (line != NULL) {
+    char *next = strchr(line, '\n');
+    if (next != NULL) {
+      *next++ = '\0';
+    }
+    lineNumber++;
+    char *comment = strchr(line, '#');
+    if (comment != NULL) {
+      *comment = '\0';
+    }
+
+    char *field[LAYOUT_MAX_FIELDS + 1];
+    uint8_t fields = 0;
+    char *save;
+    for (char *token = strtok_r(line, " \t\r", &save); token != NULL; token = strtok_r(NULL, " \t\r", &save)) {
+      if (fields > LAYOUT_MAX_FIELDS) {
+        break;
+      }
+      field[fields++] = token;
+    }
+
+    const char *reason = NULL;
+    if (fields > LAYOUT_MAX_FIELDS) {
+      reason = "too many fields";
+    } else if (fields > 0) {
+      parseLine(field, fields, doc, reason);
+    }
+    if (reason != NULL) {
+      snprintf(error, errorSize, "line %u: %s", lineNumber, reason);
+      return false;
+    }
+    line = next;
+  }
+
+  // Two enabled panels cannot share a screen slot, and the slots in the
+  // RPM bar's area only exist without the bar
+  uint16_t usedSlots = 0;
+  for (uint8_t i = 0; i < doc.config.activePanelCount; i++) {
+    const DisplayPanel &panel = doc.config.panels[i];
+    if (!panel.enabled) {
+      continue;
+    }
+    if (panel.position >= DISPLAY_BAR_SLOTS && doc.config.rpmDisplayMode != 1) {
+      snprintf(error, errorSize, "panel position %u needs rpm 1", panel.position);
+      return false;
+    }
+    if (usedSlots & (1 << panel.position)) {
+      snprintf(error, errorSize, "panel position %u used twice", panel.position);
+      return false;
+    }
+    usedSlots |= 1 << panel.position;
+  }
+  return true;
+}
+
+void applyLayoutDocument(const LayoutDocument &doc) {
+  currentDisplayConfig = doc.config;
+  for (uint8_t source = 0; source < DATA_SOURCE_COUNT; source++) {
+    if (doc.bandMask & (1 << source)) {
+      setChannelBands(source, doc.bands[source]);
+    }
+  }
+  requestLayoutUpdate();
+}
@@ -0,0 +1,42 @@
+#ifndef LAYOUT_DOCUMENT_H
+#define LAYOUT_DOCUMENT_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "DisplayConfig.h"
+#include "ChannelBands.h"
+
+// The whole street layout plus value-color bands as one text document,
+// one item per line, fields separated by spaces ('#' starts a comment):
+//
+//   panel <position> <source> <type> <decimals> <enabled> <label> [unit]
+//   indicator <position> <indicator> <enabled> [label]
+//   band <source> <hysteresis> <edges|-> <roles>
+//   rpm <mode>
+//   system <enabled>
+//
+// Numbers are the DataSource / DisplayDataType / IndicatorSource values,
+// enabled is 0/1, edges and roles are comma lists as for /bands. Panel and
+// indicator lines replace the whole list (up to DISPLAY_MAX_PANELS and
+// DISPLAY_MAX_INDICATORS, in order); bands not listed keep their current
+// table. Panel positions from DISPLAY_BAR_SLOTS up need "rpm 1", which
+// swaps the RPM bar for the digital readout. Labels and units cannot
+// contain spaces. GET /layout returns a document PUT /layout accepts
+// unchanged.
+struct LayoutDocument {
+  DisplayConfiguration config;
+  ChannelBands bands[DATA_SOURCE_COUNT];
+  uint16_t bandMask;                  // Bit per DataSource listed in the document
+};
+
+// Serialize the current configuration. Returns the length written.
+size_t writeLayoutDocument(char *buf, size_t size);
+
+// Parse and fully validate a document (text is split in place). On error
+// returns false with a "line N: reason" message and leaves doc unusable.
+bool parseLayoutDocument(char *text, LayoutDocument &doc, char *error, size_t errorSize);
+
+// Install a parsed document. Cannot fail; call between frames.
+void applyLayoutDocument(const LayoutDocument &doc);
+
+#endif // LAYOUT_DOCUMENT_H
@@ -0,0 +1,21 @@
+#include "DataLogger.h"
+
+// Kept apart from DataLogger.cpp so the exporters build without the
+// logger's file system and task code
+static const LogChannel logChannels[DATA_SOURCE_COUNT] = {
+  {"C", 0},       // DATA_SOURCE_IAT
+  {"C", 0},       // DATA_SOURCE_COOLANT
+  {"AFR", 2},     // DATA_SOURCE_AFR
+  {"deg", 0},     // DATA_SOURCE_ADV
+  {"", 0},        // DATA_SOURCE_TRIGGER
+  {"%", 0},       // DATA_SOURCE_TPS
+  {"V", 2},       // DATA_SOURCE_VOLTAGE
+  {"kPa", 0},     // DATA_SOURCE_MAP
+  {"rpm", 0},     // DATA_SOURCE_RPM
+  {"psi", 0},     // DATA_SOURCE_FP
+  {"km/h", 0}     // DATA_SOURCE_VSS
+};
+
+const LogChannel &getLogChannel(uint8_t dataSource) {
+  return logChannels[dataSource < DATA_SOURCE_COUNT ? dataSource : 0];
+}
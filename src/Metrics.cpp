@@ -0,0 +1,119 @@
+#include "Metrics.h"
+#include "Telemetry.h"
+#include <Arduino.h>
+#include <WiFi.h>
+#include <stdarg.h>
+#include <stdio.h>
+
+// Render time histogram bucket upper bounds, in microseconds. The last
+// bucket is +Inf.
+static const uint32_t frameBucketUs[] = {2000, 5000, 10000, 20000, 33000, 50000, 100000};
+#define FRAME_BUCKETS (sizeof(frameBucketUs) / sizeof(frameBucketUs[0]) + 1)
+
+std::atomic<uint32_t> metricCounters[METRIC_COUNTER_COUNT];
+
+static std::atomic<uint32_t> frameCount(0);
+static std::atomic<uint32_t> frameBuckets[FRAME_BUCKETS];
+static std::atomic<uint64_t> frameUsSum(0);
+
+struct MetricsTask {
+  const char *name;
+  TaskHandle_t handle;
+};
+static MetricsTask tasks[METRICS_MAX_TASKS];
+static uint8_t taskCount = 0;
+
+static const char *const counterNames[METRIC_COUNTER_COUNT][2] = {
+  {"mazduino_can_frames_total", "CAN frames received"},
+  {"mazduino_can_errors_total", "CAN read errors"},
+  {"mazduino_serial_polls_total", "Serial data requests sent to the ECU"},
+  {"mazduino_serial_timeouts_total", "Serial data requests that timed out"},
+  {"mazduino_serial_errors_total", "Serial replies with an invalid length"},
+  {"mazduino_web_requests_total", "HTTP requests served"},
+  {"mazduino_config_commits_total", "Settings records written to flash"},
+};
+
+void metricsRecordFrame(uint32_t elapsedUs) {
+  uint8_t bucket = 0;
+  while (bucket < FRAME_BUCKETS - 1 && elapsedUs > frameBucketUs[bucket]) {
+    bucket++;
+  }
+  frameBuckets[bucket].fetch_add(1, std::memory_order_relaxed);
+  frameUsSum.fetch_add(elapsedUs, std::memory_order_relaxed);
+  frameCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+void metricsRegisterTask(const char *name, TaskHandle_t task) {
+  if (task && taskCount < METRICS_MAX_TASKS) {
+    tasks[taskCount].name = name;
+    tasks[taskCount].handle = task;
+    taskCount++;
+  }
+}
+
+// Appends to buf; len stops growing once the buffer is full
+static void appendf(char *buf, size_t size, size_t &len, const char *format, ...) __attribute__((format(printf, 4, 5)));
+static void appendf(char *buf, size_t size, size_t &len, const char *format, ...) {
+  if (len + 1 >= size) {
+    return;
+  }
+  va_list args;
+  va_start(args, format);
+  int written = vsnprintf(buf + len, size - len, format, args);
+  va_end(args);
+  if (written > 0) {
+    len += ((size_t)written < size - len) ? (size_t)written : size - len - 1;
+  }
+}
+
+static void appendGauge(char *buf, size_t size, size_t &len, const char *name, const char *help, uint32_t value) {
+  appendf(buf, size, len, "# HELP %s %s\n# TYPE %s gauge\n%s %u\n", name, help, name, name, value);
+}
+
+size_t formatMetrics(char *buf, size_t size) {
+  size_t len = 0;
+  if (size > 0) {
+    buf[0] = '\0';
+  }
+
+  for (uint8_t i = 0; i < METRIC_COUNTER_COUNT; i++) {
+    const char *name = counterNames[i][0];
+    appendf(buf, size, len, "# HELP %s %s\n# TYPE %s counter\n%s %u\n",
+            name, counterNames[i][1], name, name, metricCounters[i].load(std::memory_order_relaxed));
+  }
+
+  // Histogram buckets are cumulative in the exposition format
+  appendf(buf, size, len, "# HELP mazduino_render_seconds Render passes that pushed pixels\n"
+                          "# TYPE mazduino_render_seconds histogram\n");
+  uint32_t cumulative = 0;
+  for (uint8_t i = 0; i < FRAME_BUCKETS; i++) {
+    cumulative += frameBuckets[i].load(std::memory_order_relaxed);
+    if (i < FRAME_BUCKETS - 1) {
+      appendf(buf, size, len, "mazduino_render_seconds_bucket{le=\"%u.%03u\"} %u\n",
+              frameBucketUs[i] / 1000000, (frameBucketUs[i] / 1000) % 1000, cumulative);
+    } else {
+      appendf(buf, size, len, "mazduino_render_seconds_bucket{le=\"+Inf\"} %u\n", cumulative);
+    }
+  }
+  uint64_t sumUs = frameUsSum.load(std::memory_order_relaxed);
+  appendf(buf, size, len, "mazduino_render_seconds_sum %u.%06u\nmazduino_render_seconds_count %u\n",
+          (uint32_t)(sumUs / 1000000), (uint32_t)(sumUs % 1000000), frameCount.load(std::memory_order_relaxed));
+  appendf(buf, size, len, "# HELP mazduino_frames_total Frames rendered, rate() gives the frame rate\n"
+                          "# TYPE mazduino_frames_total counter\nmazduino_frames_total %u\n",
+          frameCount.load(std::memory_order_relaxed));
+
+  appendGauge(buf, size, len, "mazduino_heap_free_bytes", "Free heap", ESP.getFreeHeap());
+  appendGauge(buf, size, len, "mazduino_heap_min_free_bytes", "Lowest free heap since boot", ESP.getMinFreeHeap());
+  appendGauge(buf, size, len, "mazduino_heap_max_alloc_bytes", "Largest free heap block", ESP.getMaxAllocHeap());
+  appendGauge(buf, size, len, "mazduino_wifi_clients", "Stations connected to the access point", WiFi.softAPgetStationNum());
+  appendGauge(buf, size, len, "mazduino_telemetry_clients", "Live telemetry WebSocket clients", getTelemetryClientCount());
+  appendGauge(buf, size, len, "mazduino_uptime_seconds", "Seconds since boot", millis() / 1000);
+
+  appendf(buf, size, len, "# HELP mazduino_task_stack_free_bytes Stack high-water mark per task\n"
+                          "# TYPE mazduino_task_stack_free_bytes gauge\n");
+  for (uint8_t i = 0; i < taskCount; i++) {
+    appendf(buf, size, len, "mazduino_task_stack_free_bytes{task=\"%s\"} %u\n",
+            tasks[i].name, (uint32_t)uxTaskGetStackHighWaterMark(tasks[i].handle));
+  }
+  return len;
+}
@@ -0,0 +1,41 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+// Always-on pipeline counters, exported at /metrics in Prometheus text
+// format. Hot paths only do a relaxed atomic increment; all formatting
+// happens in the web task when the endpoint is scraped.
+enum MetricCounterId {
+  METRIC_CAN_FRAMES,        // CAN frames read
+  METRIC_CAN_ERRORS,        // CAN reads that failed
+  METRIC_SERIAL_POLLS,      // Serial 'n' requests sent to the ECU
+  METRIC_SERIAL_TIMEOUTS,   // Serial requests with no reply in time
+  METRIC_SERIAL_ERRORS,     // Serial replies with an invalid length
+  METRIC_WEB_REQUESTS,      // HTTP requests served
+  METRIC_CONFIG_COMMITS,    // Settings records written to flash
+  METRIC_COUNTER_COUNT
+};
+
+#define METRICS_MAX_TASKS 4
+
+extern std::atomic<uint32_t> metricCounters[METRIC_COUNTER_COUNT];
+
+static inline void countMetric(uint8_t id) {
+  metricCounters[id].fetch_add(1, std::memory_order_relaxed);
+}
+
+// One render pass that pushed pixels, for the frame counter and histogram
+void metricsRecordFrame(uint32_t elapsedUs);
+
+// Tasks whose stack high-water mark is exported
+void metricsRegisterTask(const char *name, TaskHandle_t task);
+
+// Format every metric. Returns the length written (truncated at size - 1).
+size_t formatMetrics(char *buf, size_t size);
+
+#endif // METRICS_H
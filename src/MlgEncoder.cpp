@@ -0,0 +1,111 @@
+#include "MlgEncoder.h"
+#include <string.h>
+
+#define MLG_VERSION 1
+#define MLG_FIXED_HEADER 22
+#define MLG_NAME_SIZE 34
+#define MLG_UNITS_SIZE 10
+
+// Field types and display styles from the MLVLG format
+enum MlgFieldType {
+  MLG_U08,
+  MLG_S08,
+  MLG_U16,
+  MLG_S16,
+  MLG_U32,
+  MLG_S32,
+  MLG_S64,
+  MLG_F32
+};
+
+#define MLG_STYLE_FLOAT 0
+
+static uint8_t *putU16(uint8_t *out, uint16_t value) {
+  out[0] = value >> 8;
+  out[1] = value & 0xFF;
+  return out + 2;
+}
+
+static uint8_t *putU32(uint8_t *out, uint32_t value) {
+  out[0] = value >> 24;
+  out[1] = (value >> 16) & 0xFF;
+  out[2] = (value >> 8) & 0xFF;
+  out[3] = value & 0xFF;
+  return out + 4;
+}
+
+static uint8_t *putF32(uint8_t *out, float value) {
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  return putU32(out, bits);
+}
+
+static uint8_t *putText(uint8_t *out, const char *text, size_t size) {
+  memset(out, 0, size);
+  size_t length = strlen(text);
+  memcpy(out, text, length < size - 1 ? length : size - 1);
+  return out + size;
+}
+
+static uint8_t *putField(uint8_t *out, uint8_t type, const char *name, const char *units, uint8_t decimals) {
+  float scale = 1.0f;
+  for (uint8_t i = 0; i < decimals; i++) {
+    scale /= 10.0f;
+  }
+  *out++ = type;
+  out = putText(out, name, MLG_NAME_SIZE);
+  out = putText(out, units, MLG_UNITS_SIZE);
+  *out++ = MLG_STYLE_FLOAT;
+  out = putF32(out, scale);
+  out = putF32(out, 0.0f);   // transform
+  *out++ = decimals;
+  return out;
+}
+
+size_t mlgHeaderSize(const char *info) {
+  return MLG_FIXED_HEADER + (1 + DATA_SOURCE_COUNT) * MLG_FIELD_SIZE + strlen(info) + 1;
+}
+
+size_t mlgWriteHeader(uint8_t *out, size_t size, uint32_t timestamp, const char *info) {
+  size_t total = mlgHeaderSize(info);
+  if (size < total) {
+    return 0;
+  }
+  uint16_t infoStart = MLG_FIXED_HEADER + (1 + DATA_SOURCE_COUNT) * MLG_FIELD_SIZE;
+  uint8_t *p = out;
+  memcpy(p, "MLVLG", 6);   // includes the NUL
+  p += 6;
+  p = putU16(p, MLG_VERSION);
+  p = putU32(p, timestamp);
+  p = putU16(p, infoStart);
+  p = putU32(p, total);
+  p = putU16(p, MLG_RECORD_SIZE);
+  p = putU16(p, 1 + DATA_SOURCE_COUNT);
+
+  p = putField(p, MLG_U32, "Time", "s", 3);
+  for (uint8_t i = 0; i < DATA_SOURCE_COUNT; i++) {
+    const LogChannel &channel = getLogChannel(i);
+    p = putField(p, MLG_S16, getDataSourceName(i), channel.unit, channel.decimals);
+  }
+  memcpy(p, info, strlen(info) + 1);
+  return total;
+}
+
+size_t mlgWriteBlock(uint8_t *out, const LogRecord &record, uint32_t startMs, uint8_t counter) {
+  uint32_t elapsedMs = record.timeMs - startMs;
+  uint8_t *p = out;
+  *p++ = 0;   // data block
+  *p++ = counter;
+  p = putU16(p, (uint16_t)(elapsedMs * 100));
+  uint8_t *data = p;
+  p = putU32(p, elapsedMs);
+  for (uint8_t i = 0; i < DATA_SOURCE_COUNT; i++) {
+    p = putU16(p, (uint16_t)record.values[i]);
+  }
+  uint8_t sum = 0;
+  for (uint8_t *b = data; b < p; b++) {
+    sum += *b;
+  }
+  *p++ = sum;
+  return p - out;
+}
@@ -0,0 +1,37 @@
+#ifndef MLG_ENCODER_H
+#define MLG_ENCODER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "DataLogger.h"
+
+// MegaLogViewer binary log (MLVLG format version 1), big-endian:
+//
+//   header   "MLVLG\0", u16 version, u32 timestamp, u16 info offset,
+//            u32 data offset, u16 record length, u16 field count
+//   fields   55 bytes each: u8 type, name[34], units[10], i8 style,
+//            f32 scale, f32 transform, i8 digits
+//   info     NUL-terminated text
+//   blocks   u8 type (0 = data), u8 counter, u16 timestamp (10 us units,
+//            wraps), record, u8 sum of the record bytes
+//
+// Fields come from the channel registry: a "Time" field (ms since the
+// first record) followed by every DataSource with its LogChannel unit and
+// decimals. Records are the on-device LogRecord values unchanged, so the
+// encoder never rescales.
+#define MLG_FIELD_SIZE 55
+#define MLG_RECORD_SIZE (4 + DATA_SOURCE_COUNT * 2)
+#define MLG_BLOCK_SIZE (4 + MLG_RECORD_SIZE + 1)
+
+// Size of everything ahead of the first data block
+size_t mlgHeaderSize(const char *info);
+
+// Write the header, field table and info text. Returns the bytes written,
+// or 0 if size is smaller than mlgHeaderSize(info).
+size_t mlgWriteHeader(uint8_t *out, size_t size, uint32_t timestamp, const char *info);
+
+// Write one data block (MLG_BLOCK_SIZE bytes). startMs is the first
+// record's timeMs; counter increments per block and wraps.
+size_t mlgWriteBlock(uint8_t *out, const LogRecord &record, uint32_t startMs, uint8_t counter);
+
+#endif // MLG_ENCODER_H
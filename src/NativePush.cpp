@@ -0,0 +1,105 @@
+#include "NativePush.h"
+#include "Config.h"
+#include "Profiler.h"
+#include <Arduino.h>
+
+// External display object
+extern TFT_eSPI display;
+
+#define NATIVE_LINE_MAX 480
+
+bool nativePushEnabled = ENABLE_NATIVE_PUSH;
+
+// One panel line in native RGB666 byte order (R, G, B, top 6 bits used)
+static uint8_t lineBuffer[NATIVE_LINE_MAX * 3];
+
+// Expand one line of RGB565 pixels (byte-swapped as stored in sprites, or
+// true colour). Runs of the same colour reuse the previous expansion.
+// Returns true if the line is solid.
+static bool expandLine(const uint16_t *src, int32_t count, uint8_t *dst, bool swapped = true) {
+  uint16_t runColor = ~src[0];
+  uint8_t r = 0, g = 0, b = 0;
+  bool solid = true;
+  for (int32_t i = 0; i < count; i++) {
+    uint16_t pixel = src[i];
+    if (pixel != runColor) {
+      solid = solid && i == 0;
+      runColor = pixel;
+      uint16_t color = swapped ? (pixel << 8) | (pixel >> 8) : pixel; // Sprite buffers store swapped bytes
+      r = (color & 0xF800) >> 8;
+      g = (color & 0x07E0) >> 3;
+      b = (color & 0x001F) << 3;
+    }
+    *dst++ = r;
+    *dst++ = g;
+    *dst++ = b;
+  }
+  return solid;
+}
+
+static void pushSpriteLines(TFT_eSprite &sprite, int32_t x, int32_t y) {
+  const uint16_t *pixels = (const uint16_t *)sprite.getPointer();
+  if (!nativePushEnabled || pixels == nullptr || sprite.getColorDepth() != 16) {
+    sprite.pushSprite(x, y);
+    return;
+  }
+
+  // Clip to the panel the same way pushSprite() does
+  int32_t w = sprite.width();
+  int32_t h = sprite.height();
+  int32_t srcX = 0;
+  int32_t srcY = 0;
+  if (x < 0) { srcX = -x; w += x; x = 0; }
+  if (y < 0) { srcY = -y; h += y; y = 0; }
+  if (x + w > display.width()) w = display.width() - x;
+  if (y + h > display.height()) h = display.height() - y;
+  if (w <= 0 || h <= 0) {
+    return;
+  }
+  if (w > NATIVE_LINE_MAX) {
+    sprite.pushSprite(x - srcX, y - srcY);
+    return;
+  }
+
+  SPIClass &spi = display.getSPIinstance();
+  int32_t stride = sprite.width();
+  display.startWrite();
+  display.setWindow(x, y, x + w - 1, y + h - 1);
+  for (int32_t row = 0; row < h; row++) {
+    const uint16_t *src = pixels + (srcY + row) * stride + srcX;
+    if (expandLine(src, w, lineBuffer)) {
+      spi.writePattern(lineBuffer, 3, w);
+    } else {
+      spi.writeBytes(lineBuffer, w * 3);
+    }
+  }
+  display.endWrite();
+}
+
+void pushSpriteNative(TFT_eSprite &sprite, int32_t x, int32_t y) {
+  PROFILE_CALL(PROF_SPI_FLUSH, pushSpriteLines(sprite, x, y));
+}
+
+void beginNativeWindow(int32_t x, int32_t y, int32_t w, int32_t h) {
+  display.startWrite();
+  display.setWindow(x, y, x + w - 1, y + h - 1);
+}
+
+void pushNativeLine(const uint16_t *colors, int32_t count) {
+  if (!nativePushEnabled || count > NATIVE_LINE_MAX) {
+    display.setSwapBytes(true); // TFT_eSPI sends true-colour data as-is with swapping on
+    display.pushPixels(colors, count);
+    display.setSwapBytes(false);
+    return;
+  }
+  SPIClass &spi = display.getSPIinstance();
+  if (expandLine(colors, count, lineBuffer, false)) {
+    spi.writePattern(lineBuffer, 3, count);
+  } else {
+    spi.writeBytes(lineBuffer, count * 3);
+  }
+}
+
+void endNativeWindow() {
+  display.endWrite();
+}
@@ -0,0 +1,27 @@
+#ifndef NATIVE_PUSH_H
+#define NATIVE_PUSH_H
+
+#include <stdint.h>
+#include <TFT_eSPI.h>
+
+// The ILI9488 in SPI mode only accepts 18-bit colour. TFT_eSPI's
+// pushSprite() expands every RGB565 pixel with three blocking
+// spi.transfer() calls; this path expands a whole sprite line into the
+// panel's native 3-byte format once and sends it with a single writeBytes().
+// Lines that are one solid colour (the background above/below glyphs) are
+// sent as a repeated 3-byte pattern.
+//
+// Only 16-bit sprites are supported; anything else falls back to
+// TFT_eSprite::pushSprite().
+
+extern bool nativePushEnabled; // Runtime A/B switch for profiling
+
+void pushSpriteNative(TFT_eSprite &sprite, int32_t x, int32_t y);
+
+// Stream true-colour RGB565 lines (not byte-swapped, as in image headers)
+// into a window, e.g. from a decoder that produces one line at a time.
+void beginNativeWindow(int32_t x, int32_t y, int32_t w, int32_t h);
+void pushNativeLine(const uint16_t *colors, int32_t count);
+void endNativeWindow();
+
+#endif // NATIVE_PUSH_H
@@ -0,0 +1,177 @@
+#include "OtaUpdate.h"
+#include "Config.h"
+#include "BootSequencer.h"
+#include <Arduino.h>
+#include <esp_ota_ops.h>
+#include <mbedtls/sha256.h>
+#include <mbedtls/version.h>
+#include <string.h>
+
+// mbedtls 3 dropped the _ret suffix
+#if MBEDTLS_VERSION_NUMBER >= 0x03000000
+#define sha256Starts mbedtls_sha256_starts
+#define sha256Update mbedtls_sha256_update
+#define sha256Finish mbedtls_sha256_finish
+#else
+#define sha256Starts mbedtls_sha256_starts_ret
+#define sha256Update mbedtls_sha256_update_ret
+#define sha256Finish mbedtls_sha256_finish_ret
+#endif
+
+static const esp_partition_t *target = NULL;
+static esp_ota_handle_t handle = 0;
+static mbedtls_sha256_context sha;
+static uint8_t expected[32];
+static size_t written = 0;
+static bool active = false;
+static const char *error = "";
+
+static bool pendingVerify = false;
+static uint32_t verifyStart = 0;
+
+// The Arduino core confirms a pending image before setup() unless this
+// returns true; we confirm it ourselves once the dash is healthy
+extern "C" bool verifyRollbackLater() {
+  return true;
+}
+
+static int hexNibble(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+static bool fail(const char *reason) {
+  error = reason;
+  Serial.printf("[OTA] %s\n", reason);
+  otaAbort();
+  return false;
+}
+
+bool otaBegin(const char *expectedSha256Hex) {
+  if (active) {
+    otaAbort();
+  }
+  error = "";
+  written = 0;
+  if (expectedSha256Hex == NULL || strlen(expectedSha256Hex) != OTA_SHA256_HEX_LEN) {
+    error = "Missing or malformed sha256";
+    return false;
+  }
+  for (uint8_t i = 0; i < 32; i++) {
+    int hi = hexNibble(expectedSha256Hex[2 * i]);
+    int lo = hexNibble(expectedSha256Hex[2 * i + 1]);
+    if (hi < 0 || lo < 0) {
+      error = "Missing or malformed sha256";
+      return false;
+    }
+    expected[i] = (hi << 4) | lo;
+  }
+
+  target = esp_ota_get_next_update_partition(NULL);
+  if (target == NULL) {
+    error = "No OTA partition";
+    return false;
+  }
+  // Sequential writes erase sector by sector as data arrives instead of
+  // wiping the whole slot up front, which would stall both cores for seconds
+  if (esp_ota_begin(target, OTA_WITH_SEQUENTIAL_WRITES, &handle) != ESP_OK) {
+    error = "Could not start OTA";
+    return false;
+  }
+  mbedtls_sha256_init(&sha);
+  sha256Starts(&sha, 0);
+  active = true;
+  Serial.printf("[OTA] Writing to %s\n", target->label);
+  return true;
+}
+
+bool otaWrite(const uint8_t *data, size_t length) {
+  if (!active) {
+    return false;
+  }
+  sha256Update(&sha, data, length);
+  if (esp_ota_write(handle, data, length) != ESP_OK) {
+    return fail("Flash write failed");
+  }
+  written += length;
+  return true;
+}
+
+bool otaEnd() {
+  if (!active) {
+    if (error[0] == '\0') {
+      error = "No upload in progress";
+    }
+    return false;
+  }
+  uint8_t digest[32];
+  sha256Finish(&sha, digest);
+  mbedtls_sha256_free(&sha);
+  active = false;
+  if (memcmp(digest, expected, sizeof(digest)) != 0) {
+    esp_ota_abort(handle);
+    error = "SHA-256 mismatch, image discarded";
+    Serial.printf("[OTA] %s\n", error);
+    return false;
+  }
+  // esp_ota_end() also checks the image header and its appended checksum
+  if (esp_ota_end(handle) != ESP_OK) {
+    error = "Image validation failed";
+    return false;
+  }
+  if (esp_ota_set_boot_partition(target) != ESP_OK) {
+    error = "Could not select the new image";
+    return false;
+  }
+  Serial.printf("[OTA] %u bytes verified, boots from %s next\n", written, target->label);
+  return true;
+}
+
+void otaAbort() {
+  if (error[0] == '\0') {
+    error = "Upload aborted";
+  }
+  if (active) {
+    esp_ota_abort(handle);
+    mbedtls_sha256_free(&sha);
+    active = false;
+  }
+}
+
+const char *otaError() {
+  return error;
+}
+
+size_t otaBytesWritten() {
+  return written;
+}
+
+void otaCheckBoot() {
+  esp_ota_img_states_t state;
+  if (esp_ota_get_state_partition(esp_ota_get_running_partition(), &state) == ESP_OK &&
+      state == ESP_OTA_IMG_PENDING_VERIFY) {
+    pendingVerify = true;
+    verifyStart = millis();
+    Serial.printf("[OTA] New image pending verification (%u s)\n", OTA_VERIFY_TIMEOUT_MS / 1000);
+  }
+}
+
+void otaHealthTick(bool frameRendered) {
+  if (!pendingVerify) {
+    return;
+  }
+  if (bootEcuFrameSeen() && frameRendered) {
+    esp_ota_mark_app_valid_cancel_rollback();
+    pendingVerify = false;
+    Serial.println("[OTA] New image confirmed");
+  } else if (millis() - verifyStart > OTA_VERIFY_TIMEOUT_MS) {
+    Serial.println("[OTA] New image not healthy, rolling back");
+    esp_ota_mark_app_invalid_rollback_and_reboot();
+  }
+}
+
+bool otaPendingVerify() {
+  return pendingVerify;
+}
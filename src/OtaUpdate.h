@@ -0,0 +1,30 @@
+#ifndef OTA_UPDATE_H
+#define OTA_UPDATE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define OTA_SHA256_HEX_LEN 64
+
+// Firmware upload into the inactive OTA slot. Called from the web task's
+// upload callback chunk by chunk, so the render loop keeps running; the
+// image is hashed as it streams and only made bootable when its SHA-256
+// matches the one the client sent.
+bool otaBegin(const char *expectedSha256Hex);
+bool otaWrite(const uint8_t *data, size_t length);
+bool otaEnd();
+void otaAbort();
+// Last error, or "" after a good upload
+const char *otaError();
+size_t otaBytesWritten();
+
+// Rollback guard for a freshly flashed image. The bootloader starts it as
+// pending-verify; it is confirmed once an ECU frame has arrived and a
+// frame was rendered, and rolled back if that does not happen within
+// OTA_VERIFY_TIMEOUT_MS. Call otaCheckBoot() in setup(), otaHealthTick()
+// after every render pass.
+void otaCheckBoot();
+void otaHealthTick(bool frameRendered);
+bool otaPendingVerify();
+
+#endif // OTA_UPDATE_H
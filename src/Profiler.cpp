@@ -0,0 +1,230 @@
+#include "Profiler.h"
+#include "Arduino.h"
+#include <string.h>
+
+// ILI9488 in SPI mode takes 3 bytes per pixel; every push also costs a
+// column/row address window and a memory write command
+#define SPI_BYTES_PER_PIXEL 3
+#define SPI_WINDOW_OVERHEAD_BYTES 11
+
+// Frame time histogram: 200us buckets up to 51.2ms, last bucket catches the rest
+#define FRAME_HIST_BUCKETS 256
+#define FRAME_HIST_BUCKET_US 200
+
+#define PROFILE_WINDOW_MS 1000
+
+bool profilerEnabled = false;
+bool framePushed = false;
+
+// Running totals. Each scope is only written from the task that owns it
+// (decode from the comm task, web requests from the web task, everything
+// else from loop()), and the window logic works on deltas so nothing is
+// reset across cores.
+static volatile uint32_t scopeTotalUs[PROF_SCOPE_COUNT];
+static volatile uint32_t scopeCalls[PROF_SCOPE_COUNT];
+static volatile uint32_t scopeMaxUs[PROF_SCOPE_COUNT];
+static uint32_t windowTotalUs[PROF_SCOPE_COUNT];
+static uint32_t windowCalls[PROF_SCOPE_COUNT];
+
+static uint32_t lastFrameUs = 0;
+static uint32_t framePixels = 0;
+static uint32_t frameSpiBytes = 0;
+static uint32_t frameSpiTransactions = 0;
+static uint32_t lastFrameSpiBytes = 0;
+static uint32_t lastFrameSpiTransactions = 0;
+static uint32_t spiBytes = 0;
+static uint32_t spiTransactions = 0;
+static uint32_t renderedFrames = 0;
+static uint32_t frameUsSum = 0;
+static uint32_t frameUsMax = 0;
+static uint32_t loopCount = 0;
+static uint16_t frameHistogram[FRAME_HIST_BUCKETS];
+static uint32_t windowStart = 0;
+
+static ProfileReport report;
+
+void profilerRecord(uint8_t scope, uint32_t elapsedUs) {
+  scopeTotalUs[scope] += elapsedUs;
+  scopeCalls[scope]++;
+  if (elapsedUs > scopeMaxUs[scope]) {
+    scopeMaxUs[scope] = elapsedUs;
+  }
+  if (scope == PROF_FRAME) {
+    lastFrameUs = elapsedUs;
+  }
+}
+
+// Account for one address window + pixel push to the panel
+void profilerCountSpi(uint32_t pixels) {
+  uint32_t bytes = pixels * SPI_BYTES_PER_PIXEL + SPI_WINDOW_OVERHEAD_BYTES;
+  framePixels += pixels;
+  frameSpiBytes += bytes;
+  frameSpiTransactions++;
+  spiBytes += bytes;
+  spiTransactions++;
+}
+
+// Called after each drawData() pass. Only passes that pushed pixels count
+// as rendered frames.
+void profilerEndFrame() {
+  if (!profilerEnabled || framePixels == 0) {
+    return;
+  }
+  renderedFrames++;
+  frameUsSum += lastFrameUs;
+  if (lastFrameUs > frameUsMax) {
+    frameUsMax = lastFrameUs;
+  }
+  uint32_t bucket = lastFrameUs / FRAME_HIST_BUCKET_US;
+  if (bucket >= FRAME_HIST_BUCKETS) {
+    bucket = FRAME_HIST_BUCKETS - 1;
+  }
+  frameHistogram[bucket]++;
+  lastFrameSpiBytes = frameSpiBytes;
+  lastFrameSpiTransactions = frameSpiTransactions;
+  framePixels = 0;
+  frameSpiBytes = 0;
+  frameSpiTransactions = 0;
+}
+
+static uint32_t frameTimePercentile(uint32_t frames, uint8_t percent) {
+  if (frames == 0) {
+    return 0;
+  }
+  uint32_t target = (frames * percent + 99) / 100;
+  uint32_t seen = 0;
+  for (int i = 0; i < FRAME_HIST_BUCKETS; i++) {
+    seen += frameHistogram[i];
+    if (seen >= target) {
+      return (i + 1) * FRAME_HIST_BUCKET_US; // Upper edge of the bucket
+    }
+  }
+  return FRAME_HIST_BUCKETS * FRAME_HIST_BUCKET_US;
+}
+
+// Start an empty window: what was counted before the profiler was last
+// switched off does not belong in the next report
+static void restartWindow(uint32_t now) {
+  for (int i = 0; i < PROF_SCOPE_COUNT; i++) {
+    windowTotalUs[i] = scopeTotalUs[i];
+    windowCalls[i] = scopeCalls[i];
+    scopeMaxUs[i] = 0;
+  }
+  renderedFrames = 0;
+  frameUsSum = 0;
+  frameUsMax = 0;
+  loopCount = 0;
+  spiBytes = 0;
+  spiTransactions = 0;
+  memset(frameHistogram, 0, sizeof(frameHistogram));
+  windowStart = now;
+}
+
+// Call once per loop() in every build, so /profile never serves a stale
+// report. Rolls the aggregation window every second while enabled; when
+// disabled it is a single branch.
+void profilerUpdate() {
+  if (!profilerEnabled) {
+    windowStart = 0;
+    return;
+  }
+  loopCount++;
+  uint32_t now = millis();
+  if (windowStart == 0) {
+    restartWindow(now);
+    return;
+  }
+  uint32_t windowMs = now - windowStart;
+  if (windowMs < PROFILE_WINDOW_MS) {
+    return;
+  }
+
+  float seconds = windowMs / 1000.0f;
+  report.fps = renderedFrames / seconds;
+  report.loopsPerSecond = loopCount / seconds;
+  report.avgFrameUs = renderedFrames ? frameUsSum / renderedFrames : 0;
+  report.p50FrameUs = frameTimePercentile(renderedFrames, 50);
+  report.p99FrameUs = frameTimePercentile(renderedFrames, 99);
+  report.maxFrameUs = frameUsMax;
+  report.spiBytesPerSecond = spiBytes / seconds;
+  report.spiTransactionsPerSecond = spiTransactions / seconds;
+
+  uint32_t busyUs = 0;
+  for (int i = 0; i < PROF_SCOPE_COUNT; i++) {
+    uint32_t totalUs = scopeTotalUs[i];
+    uint32_t calls = scopeCalls[i];
+    uint32_t deltaUs = totalUs - windowTotalUs[i];
+    uint32_t deltaCalls = calls - windowCalls[i];
+    report.scopeAvgUs[i] = deltaCalls ? deltaUs / deltaCalls : 0;
+    report.scopeCallsPerSecond[i] = deltaCalls / seconds;
+    report.scopeMaxUs[i] = scopeMaxUs[i];
+    scopeMaxUs[i] = 0; // A racing write from the other core only loses one sample
+    windowTotalUs[i] = totalUs;
+    windowCalls[i] = calls;
+    if (i == PROF_FRAME) {
+      busyUs += deltaUs; // Render core only; web and decode run on core 0
+    }
+  }
+  report.cpuUsage = min(100.0f, busyUs / (windowMs * 10.0f));
+
+  renderedFrames = 0;
+  frameUsSum = 0;
+  frameUsMax = 0;
+  loopCount = 0;
+  spiBytes = 0;
+  spiTransactions = 0;
+  memset(frameHistogram, 0, sizeof(frameHistogram));
+  windowStart = now;
+}
+
+// SPI cost of the most recent rendered frame
+void getLastFrameSpi(uint32_t &bytes, uint32_t &transactions) {
+  bytes = lastFrameSpiBytes;
+  transactions = lastFrameSpiTransactions;
+}
+
+const ProfileReport &getProfileReport() {
+  return report;
+}
+
+const char *getProfileScopeName(uint8_t scope) {
+  switch (scope) {
+    case PROF_FRAME: return "frame";
+    case PROF_RPM_BAR: return "rpmBar";
+    case PROF_READOUTS: return "readouts";
+    case PROF_PANELS: return "panels";
+    case PROF_INDICATORS: return "indicators";
+    case PROF_OVERLAY: return "overlay";
+    case PROF_SPI_FLUSH: return "spiFlush";
+    case PROF_DECODE: return "decode";
+    case PROF_WEB: return "web";
+    default: return "unknown";
+  }
+}
+
+// Serialize the last report as one JSON object
+void writeProfileJson(JsonWriter &json) {
+  json.beginObject();
+  json.addBool("enabled", profilerEnabled);
+  json.addFloat("fps", report.fps, 1);
+  json.addFloat("loopsPerSec", report.loopsPerSecond, 0);
+  json.addFloat("cpu", report.cpuUsage, 1);
+  json.beginObject("frameUs");
+  json.addUInt("avg", report.avgFrameUs);
+  json.addUInt("p50", report.p50FrameUs);
+  json.addUInt("p99", report.p99FrameUs);
+  json.addUInt("max", report.maxFrameUs);
+  json.endObject();
+  json.addUInt("spiBytesPerSec", report.spiBytesPerSecond);
+  json.addUInt("spiTransactionsPerSec", report.spiTransactionsPerSecond);
+  json.beginObject("scopes");
+  for (int i = 0; i < PROF_SCOPE_COUNT; i++) {
+    json.beginObject(getProfileScopeName(i));
+    json.addUInt("avgUs", report.scopeAvgUs[i]);
+    json.addUInt("maxUs", report.scopeMaxUs[i]);
+    json.addUInt("callsPerSec", report.scopeCallsPerSecond[i]);
+    json.endObject();
+  }
+  json.endObject();
+  json.endObject();
+}
@@ -0,0 +1,81 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <stdint.h>
+#include "Config.h"
+#include "JsonWriter.h"
+
+// Profiled scopes
+enum ProfileScopeId {
+  PROF_FRAME,           // Whole drawData() pass
+  PROF_RPM_BAR,         // RPM bar widget
+  PROF_READOUTS,        // RPM / speed readouts
+  PROF_PANELS,          // Data panels
+  PROF_INDICATORS,      // Indicator buttons
+  PROF_OVERLAY,         // CAN/SER, SIM and debug overlay
+  PROF_SPI_FLUSH,       // Sprite pushes to the panel
+  PROF_DECODE,          // CAN / serial decode (comm task)
+  PROF_WEB,             // One HTTP request, parse to response sent (web task)
+  PROF_SCOPE_COUNT
+};
+
+// Aggregated results, refreshed once per second
+struct ProfileReport {
+  float fps;                 // Frames that actually pushed pixels
+  float loopsPerSecond;      // loop() iterations
+  float cpuUsage;            // Share of the window the render loop spent drawing
+  uint32_t avgFrameUs;
+  uint32_t p50FrameUs;
+  uint32_t p99FrameUs;
+  uint32_t maxFrameUs;
+  uint32_t spiBytesPerSecond;
+  uint32_t spiTransactionsPerSecond;
+  uint32_t scopeAvgUs[PROF_SCOPE_COUNT];
+  uint32_t scopeMaxUs[PROF_SCOPE_COUNT];
+  uint32_t scopeCallsPerSecond[PROF_SCOPE_COUNT];
+};
+
+extern bool profilerEnabled;
+// Set by every panel push whether or not the profiler is on; loop() clears
+// it before drawData() to tell rendered frames from idle passes
+extern bool framePushed;
+
+void profilerRecord(uint8_t scope, uint32_t elapsedUs);
+void profilerCountSpi(uint32_t pixels);
+void profilerEndFrame();
+void profilerUpdate();
+void getLastFrameSpi(uint32_t &bytes, uint32_t &transactions);
+const ProfileReport &getProfileReport();
+const char *getProfileScopeName(uint8_t scope);
+void writeProfileJson(JsonWriter &json);
+
+#if ENABLE_PROFILER
+#include <esp_timer.h>
+
+// Times its own lifetime. Only ever constructed once the profiler flag has
+// been tested (PROFILE_CALL), so it records unconditionally.
+class ProfileTimer {
+public:
+  explicit ProfileTimer(uint8_t scope) : scope(scope), start((uint32_t)esp_timer_get_time()) {}
+  ~ProfileTimer() {
+    profilerRecord(scope, (uint32_t)esp_timer_get_time() - start);
+  }
+private:
+  uint8_t scope;
+  uint32_t start;
+};
+
+// Run a statement, timed against scope while the profiler is on. The flag
+// is tested once; the disabled path is the bare statement.
+#define PROFILE_CALL(scope, ...) \
+  do { \
+    if (profilerEnabled) { ProfileTimer profileTimer(scope); __VA_ARGS__; } \
+    else { __VA_ARGS__; } \
+  } while (0)
+#define PROFILE_SPI(pixels) do { framePushed = true; if (profilerEnabled) profilerCountSpi(pixels); } while (0)
+#else
+#define PROFILE_CALL(scope, ...) do { __VA_ARGS__; } while (0)
+#define PROFILE_SPI(pixels) do { framePushed = true; } while (0)
+#endif
+
+#endif // PROFILER_H
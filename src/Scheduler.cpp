@@ -0,0 +1,134 @@
+#include "Scheduler.h"
+#include "Config.h"
+#include <Arduino.h>
+
+struct ScheduleCandidate {
+  ScheduleSlot *slot;
+  uint8_t tag;
+  uint8_t rank;        // Effective priority class
+  uint16_t urgency;    // Time since last service relative to the deadline, x256
+};
+
+static ScheduleCandidate candidates[SCHED_MAX_CANDIDATES];
+static uint8_t candidateCount = 0;
+static uint8_t nextCandidate = 0;
+static bool sorted = false;
+static int32_t budgetLeft = 0;
+static uint32_t frameNow = 0;
+static ScheduleCandidate *current = nullptr;
+
+void initScheduleSlot(ScheduleSlot &slot, uint8_t priority, uint16_t minIntervalMs, uint16_t maxStaleMs, uint16_t cost) {
+  slot.priority = priority;
+  slot.minIntervalMs = minIntervalMs;
+  slot.maxStaleMs = maxStaleMs;
+  slot.cost = cost;
+  slot.lastServiceMs = 0;
+  resetScheduleStats(slot);
+}
+
+void resetScheduleStats(ScheduleSlot &slot) {
+  slot.services = 0;
+  slot.draws = 0;
+  slot.deferrals = 0;
+  slot.missed = 0;
+  slot.intervalSumMs = 0;
+  slot.intervalMaxMs = 0;
+}
+
+void scheduleBegin(uint32_t now) {
+  frameNow = now;
+  candidateCount = 0;
+  nextCandidate = 0;
+  sorted = false;
+  budgetLeft = SCHED_FRAME_PIXEL_BUDGET;
+  current = nullptr;
+}
+
+void scheduleAdd(ScheduleSlot &slot, uint8_t tag) {
+  uint32_t age = frameNow - slot.lastServiceMs;
+  if (candidateCount >= SCHED_MAX_CANDIDATES || age < slot.minIntervalMs) {
+    return;
+  }
+  ScheduleCandidate &candidate = candidates[candidateCount++];
+  candidate.slot = &slot;
+  candidate.tag = tag;
+  candidate.rank = slot.priority;
+  uint32_t deadline = slot.maxStaleMs ? slot.maxStaleMs : 1;
+  uint32_t urgency = (age * 256) / deadline;
+  candidate.urgency = urgency > 0xFFFF ? 0xFFFF : urgency;
+  // Past the deadline: promote one class so low priorities cannot starve
+  if (age >= slot.maxStaleMs && candidate.rank > PRIO_HIGH) {
+    candidate.rank--;
+  }
+}
+
+// Class first, most overdue first within a class. At most a few dozen
+// candidates, so an insertion sort is plenty.
+static void sortCandidates() {
+  for (uint8_t i = 1; i < candidateCount; i++) {
+    ScheduleCandidate key = candidates[i];
+    int j = i - 1;
+    while (j >= 0 && (candidates[j].rank > key.rank ||
+                      (candidates[j].rank == key.rank && candidates[j].urgency < key.urgency))) {
+      candidates[j + 1] = candidates[j];
+      j--;
+    }
+    candidates[j + 1] = key;
+  }
+  sorted = true;
+}
+
+bool scheduleNext(uint8_t &tag) {
+  if (!sorted) {
+    sortCandidates();
+  }
+  while (nextCandidate < candidateCount) {
+    ScheduleCandidate &candidate = candidates[nextCandidate++];
+    if (candidate.rank != PRIO_CRITICAL && budgetLeft < (int32_t)candidate.slot->cost) {
+      candidate.slot->deferrals++;
+      continue;
+    }
+    current = &candidate;
+    tag = candidate.tag;
+    return true;
+  }
+  current = nullptr;
+  return false;
+}
+
+void scheduleDone(bool drew) {
+  if (current == nullptr) {
+    return;
+  }
+  ScheduleSlot &slot = *current->slot;
+  if (drew && current->rank != PRIO_CRITICAL) {
+    budgetLeft -= slot.cost;
+  }
+  if (drew) {
+    slot.draws++;
+  }
+  scheduleMarkServiced(slot, frameNow);
+  current = nullptr;
+}
+
+void scheduleMarkServiced(ScheduleSlot &slot, uint32_t now) {
+  if (slot.lastServiceMs != 0) {
+    uint32_t interval = now - slot.lastServiceMs;
+    slot.intervalSumMs += interval;
+    if (interval > slot.intervalMaxMs) {
+      slot.intervalMaxMs = interval > 0xFFFF ? 0xFFFF : interval;
+    }
+    if (interval > slot.maxStaleMs) {
+      slot.missed++;
+    }
+    slot.services++;
+  }
+  slot.lastServiceMs = now;
+}
+
+void printScheduleStats(const ScheduleSlot &slot, const char *name) {
+  uint32_t avg = slot.services ? slot.intervalSumMs / slot.services : 0;
+  Serial.printf("%-10s P%u  avg:%4ums max:%5ums (limit %ums)  draws:%u deferred:%u late:%u\n",
+                name, slot.priority, avg, slot.intervalMaxMs, slot.maxStaleMs,
+                slot.draws, slot.deferrals, slot.missed);
+}
@@ -0,0 +1,53 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <stdint.h>
+
+#define SCHED_MAX_CANDIDATES 40
+
+// Priority classes, most important first
+enum SchedulePriority {
+  PRIO_CRITICAL,   // Serviced every frame, never charged against the budget
+  PRIO_HIGH,       // Driver-critical readouts (RPM, speed)
+  PRIO_NORMAL,     // Data panels
+  PRIO_LOW,        // Indicators and status overlay
+  PRIO_COUNT
+};
+
+// Timing contract and statistics for one scheduled widget
+struct ScheduleSlot {
+  uint8_t priority;         // SchedulePriority
+  uint16_t minIntervalMs;   // Never serviced more often than this
+  uint16_t maxStaleMs;      // Deadline: should be serviced at least this often
+  uint16_t cost;            // Estimated pixels pushed when the widget redraws
+  uint32_t lastServiceMs;
+
+  // Achieved update statistics (reset by resetScheduleStats)
+  uint32_t services;        // Times the widget was serviced
+  uint32_t draws;           // Services that actually pushed pixels
+  uint32_t deferrals;       // Frames the widget was due but the budget ran out
+  uint32_t missed;          // Services that happened after maxStaleMs
+  uint32_t intervalSumMs;
+  uint16_t intervalMaxMs;
+};
+
+void initScheduleSlot(ScheduleSlot &slot, uint8_t priority, uint16_t minIntervalMs, uint16_t maxStaleMs, uint16_t cost);
+void resetScheduleStats(ScheduleSlot &slot);
+
+// One frame: scheduleBegin(), scheduleAdd() every widget, then
+//   while (scheduleNext(tag)) { drew = draw(tag); scheduleDone(drew); }
+// Critical widgets come first, then each class in order with the most
+// overdue widgets first. A widget past its deadline is promoted one class.
+// Non-critical widgets stop being serviced once the frame's pixel budget is
+// used up; they are counted as deferred and move up next frame.
+void scheduleBegin(uint32_t now);
+void scheduleAdd(ScheduleSlot &slot, uint8_t tag);
+bool scheduleNext(uint8_t &tag);
+void scheduleDone(bool drew);
+
+// Mark a slot as serviced outside the scheduler (full redraws)
+void scheduleMarkServiced(ScheduleSlot &slot, uint32_t now);
+
+void printScheduleStats(const ScheduleSlot &slot, const char *name);
+
+#endif // SCHEDULER_H
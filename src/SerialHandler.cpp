@@ -3,6 +3,8 @@
 #include "DataTypes.h"
 #include "Comms.h"
 #include "GlobalVariables.h"
+#include "Profiler.h"
+#include "BootSequencer.h"
 #include "Arduino.h"
 
 void setupSerial() {
@@ -19,17 +21,9 @@ void serialTask(void *pvParameters) {
   }
 }
 
-void handleSerialCommunication() {
-  static uint32_t lastUpdate = millis();
+// Update the decoded values from the last realtime data response
+static void decodeSerialData() {
   static uint32_t lastRefresh = millis();
-  
-  // Request data every 15ms for faster response (was 20ms)
-  if (millis() - lastUpdate > 15) {
-    requestData(30); // Reduced timeout from 50ms to 30ms
-    lastUpdate = millis();
-  }
-
-  isCANMode = false;  // We're in Serial mode when this function is called
 
   uint32_t currentTime = millis();
   uint32_t elapsed = currentTime - lastRefresh;
@@ -73,3 +67,19 @@ void handleSerialCommunication() {
     lastDataDebug = currentTime;
   }
 }
+
+void handleSerialCommunication() {
+  static uint32_t lastUpdate = millis();
+  
+  // Request data every 15ms for faster response (was 20ms)
+  if (millis() - lastUpdate > 15) {
+    if (requestData(30)) { // Reduced timeout from 50ms to 30ms
+      bootNoteEcuFrame();
+    }
+    lastUpdate = millis();
+  }
+
+  isCANMode = false;  // We're in Serial mode when this function is called
+
+  PROFILE_CALL(PROF_DECODE, decodeSerialData());
+}
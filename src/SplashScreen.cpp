@@ -3,11 +3,13 @@
 #include "GlobalVariables.h"
 #include "NotoSansBold15.h"
 #include "NotoSansBold36.h"
-#include "splash_image/mercy.h"
+#include "CompressedImage.h"
+#include "splash_image/mercy_q565.h"
 #include "splash_image/mazduino.h"
-#include "splash_image/hedon.h"
-#include "splash_image/biies.h"
-#include <EEPROM.h>
+#include "splash_image/hedon_q565.h"
+#include "splash_image/biies_q565.h"
+#include "ConfigStore.h"
+#include <esp_timer.h>
 
 // External display object
 extern TFT_eSPI display;
@@ -18,39 +20,26 @@ int selectedSplashScreen = DEFAULT_SPLASH_SCREEN;
 void showAnimatedSplashScreen() {
   display.fillScreen(TFT_BLACK);
   
-  // Load splash screen preference from EEPROM
-  selectedSplashScreen = EEPROM.read(10); // Use EEPROM address 10 for splash selection
-  if (selectedSplashScreen != SPLASH_MAZDUINO && selectedSplashScreen != SPLASH_MERCY && selectedSplashScreen != SPLASH_HEDON && selectedSplashScreen != SPLASH_BIIES) {
-    selectedSplashScreen = DEFAULT_SPLASH_SCREEN; // Default to mazduino if invalid
-  }
-  
-  // Display the selected image with color byte swapping for correct colors
-  display.setSwapBytes(true);  // Enable byte swapping for RGB565 color correction
+  // Splash preference was loaded (and validated) with the system settings
+  selectedSplashScreen = systemSettings.splashScreen;
   
-  if (selectedSplashScreen == SPLASH_MAZDUINO) {
-    // Mazduino uses monochrome bitmap format, use drawBitmap with white color
-    display.drawBitmap(0, 0, epd_bitmap_mazduino_invert, 480, 320, TFT_WHITE, TFT_BLACK);
-  } else if (selectedSplashScreen == SPLASH_MERCY) {
-    // Mercy uses uint16_t RGB565 format, can use pushImage directly  
-    display.pushImage(0, 0, 480, 320, epd_bitmap_mercy);
+  // Colour images are stored Q565-compressed and decoded line by line
+  // straight into the panel window
+  uint32_t drawStart = (uint32_t)esp_timer_get_time();
+  if (selectedSplashScreen == SPLASH_MERCY) {
+    drawCompressedImage(0, 0, splash_mercy_q565, sizeof(splash_mercy_q565));
   } else if (selectedSplashScreen == SPLASH_HEDON) {
-    // Hedon uses uint16_t RGB565 format, can use pushImage directly  
-    display.pushImage(0, 0, 480, 320, epd_bitmap_hedon);
+    drawCompressedImage(0, 0, splash_hedon_q565, sizeof(splash_hedon_q565));
   } else if (selectedSplashScreen == SPLASH_BIIES) {
-    // Biies uses uint16_t RGB565 format, can use pushImage directly
-    display.pushImage(0, 0, 480, 320, epd_bitmap_biies);
+    drawCompressedImage(0, 0, splash_biies_q565, sizeof(splash_biies_q565));
   } else {
-    // Default fallback to Mazduino
+    // Mazduino uses monochrome bitmap format, use drawBitmap with white color
     display.drawBitmap(0, 0, epd_bitmap_mazduino_invert, 480, 320, TFT_WHITE, TFT_BLACK);
   }
+  Serial.printf("Splash %d drawn in %u us\n", selectedSplashScreen, (uint32_t)esp_timer_get_time() - drawStart);
   
-  display.setSwapBytes(false); // Disable byte swapping after image display
-  
-  // Hold the image for 3 seconds
-  delay(3000);
-  
-  // Simple fade to black
-  display.fillScreen(TFT_BLACK);
+  // No hold here: the boot sequencer keeps the splash up while the rest of
+  // the system starts, and startUpDisplay() clears it
 }
 
 int getSplashScreenSelection() {
@@ -60,8 +49,8 @@ int getSplashScreenSelection() {
 void setSplashScreenSelection(int selection) {
   if (selection == SPLASH_MAZDUINO || selection == SPLASH_MERCY || selection == SPLASH_HEDON || selection == SPLASH_BIIES) {
     selectedSplashScreen = selection;
-    EEPROM.write(10, selection);
-    EEPROM.commit();
+    systemSettings.splashScreen = selection;
+    configMarkDirty(CONFIG_RECORD_SYSTEM);
   }
 }
 
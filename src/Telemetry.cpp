@@ -0,0 +1,170 @@
+#include "Telemetry.h"
+#include "Config.h"
+#include "ChannelFilter.h"
+#include "text_utils.h"
+#include "JsonWriter.h"
+#include <Arduino.h>
+#include <WebSocketsServer.h>
+#include <stdlib.h>
+#include <string.h>
+
+static_assert(DATA_SOURCE_COUNT <= 16, "telemetry channel mask is 16 bits");
+
+struct TelemetryClient {
+  bool connected;
+  uint8_t seq;
+  uint16_t intervalMs;
+  uint32_t lastSend;
+  uint32_t lastKeyframe;
+  int32_t sent[DATA_SOURCE_COUNT];   // Values as last sent, the delta base
+};
+
+static WebSocketsServer telemetryServer(TELEMETRY_PORT);
+static TelemetryClient clients[WEBSOCKETS_SERVER_CLIENT_MAX];
+static bool telemetryActive = false;
+
+static uint8_t *putVarint(uint8_t *out, int32_t value) {
+  uint32_t zigzag = ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+  while (zigzag >= 0x80) {
+    *out++ = (uint8_t)(zigzag | 0x80);
+    zigzag >>= 7;
+  }
+  *out++ = (uint8_t)zigzag;
+  return out;
+}
+
+// Encode one frame for a client against its last sent values. Returns the
+// frame length, or 0 when a delta would carry nothing.
+static size_t encodeFrame(TelemetryClient &client, const int32_t *values, bool keyframe, uint8_t *frame) {
+  uint16_t mask = 0;
+  uint8_t *out = frame + 4;
+  for (uint8_t i = 0; i < DATA_SOURCE_COUNT; i++) {
+    if (keyframe) {
+      out = putVarint(out, values[i]);
+    } else if (values[i] != client.sent[i]) {
+      out = putVarint(out, values[i] - client.sent[i]);
+    } else {
+      continue;
+    }
+    mask |= 1 << i;
+    client.sent[i] = values[i];
+  }
+  if (mask == 0) {
+    return 0;
+  }
+  frame[0] = keyframe ? TELEMETRY_KEYFRAME : TELEMETRY_DELTA;
+  frame[1] = client.seq++;
+  frame[2] = mask & 0xFF;
+  frame[3] = mask >> 8;
+  return out - frame;
+}
+
+static void setClientRate(TelemetryClient &client, int hz) {
+  if (hz < 1) hz = 1;
+  if (hz > TELEMETRY_MAX_HZ) hz = TELEMETRY_MAX_HZ;
+  client.intervalMs = 1000 / hz;
+}
+
+// Channel names and scaling, sent as text once on connect
+static void sendHello(uint8_t num) {
+  char hello[256];
+  JsonWriter json(hello, sizeof(hello));
+  json.beginObject();
+  json.addInt("decimals", TELEMETRY_DECIMALS);
+  json.addInt("maxHz", TELEMETRY_MAX_HZ);
+  json.beginArray("channels");
+  for (uint8_t i = 0; i < DATA_SOURCE_COUNT; i++) {
+    json.addString(NULL, getDataSourceName(i));
+  }
+  json.endArray();
+  json.endObject();
+  telemetryServer.sendTXT(num, hello);
+}
+
+static void onTelemetryEvent(uint8_t num, WStype_t type, uint8_t *payload, size_t length) {
+  if (num >= WEBSOCKETS_SERVER_CLIENT_MAX) {
+    return;
+  }
+  TelemetryClient &client = clients[num];
+  switch (type) {
+    case WStype_CONNECTED:
+      memset(&client, 0, sizeof(client));
+      client.connected = true;
+      setClientRate(client, TELEMETRY_DEFAULT_HZ);
+      sendHello(num);
+      break;
+    case WStype_DISCONNECTED:
+      client.connected = false;
+      break;
+    case WStype_TEXT:
+      if (length > 5 && strncmp((const char *)payload, "rate=", 5) == 0) {
+        setClientRate(client, atoi((const char *)payload + 5));
+      }
+      break;
+    default:
+      break;
+  }
+}
+
+void startTelemetry() {
+  if (telemetryActive) {
+    return;
+  }
+  memset(clients, 0, sizeof(clients));
+  telemetryServer.begin();
+  telemetryServer.onEvent(onTelemetryEvent);
+  telemetryActive = true;
+}
+
+void stopTelemetry() {
+  if (!telemetryActive) {
+    return;
+  }
+  telemetryServer.close();
+  memset(clients, 0, sizeof(clients));
+  telemetryActive = false;
+}
+
+void updateTelemetry(uint32_t now) {
+  if (!telemetryActive) {
+    return;
+  }
+  telemetryServer.loop();
+
+  // Channels are sampled once per pass and shared by every due client
+  int32_t values[DATA_SOURCE_COUNT];
+  bool sampled = false;
+  uint8_t frame[TELEMETRY_FRAME_MAX];
+
+  for (uint8_t num = 0; num < WEBSOCKETS_SERVER_CLIENT_MAX; num++) {
+    TelemetryClient &client = clients[num];
+    if (!client.connected || now - client.lastSend < client.intervalMs) {
+      continue;
+    }
+    if (!sampled) {
+      for (uint8_t i = 0; i < DATA_SOURCE_COUNT; i++) {
+        values[i] = toFixed(getDisplayValue(i), TELEMETRY_DECIMALS);
+      }
+      sampled = true;
+    }
+    bool keyframe = client.lastKeyframe == 0 || now - client.lastKeyframe >= TELEMETRY_KEYFRAME_MS;
+    size_t length = encodeFrame(client, values, keyframe, frame);
+    client.lastSend = now;
+    if (keyframe) {
+      client.lastKeyframe = now;
+    }
+    if (length > 0) {
+      telemetryServer.sendBIN(num, frame, length);
+    }
+  }
+}
+
+uint8_t getTelemetryClientCount() {
+  uint8_t count = 0;
+  for (uint8_t num = 0; num < WEBSOCKETS_SERVER_CLIENT_MAX; num++) {
+    if (clients[num].connected) {
+      count++;
+    }
+  }
+  return count;
+}
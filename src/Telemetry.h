@@ -0,0 +1,29 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <stdint.h>
+#include "DisplayConfig.h"
+
+#define TELEMETRY_DECIMALS 1                               // Values are sent x10
+#define TELEMETRY_FRAME_MAX (4 + DATA_SOURCE_COUNT * 5)    // Header + worst-case varints
+
+// Binary frame pushed to each WebSocket client on TELEMETRY_PORT:
+//   [0]    TELEMETRY_KEYFRAME or TELEMETRY_DELTA
+//   [1]    sequence number (per client, wraps)
+//   [2..3] channel mask, little-endian, bit n = DataSource n
+//   then one zigzag LEB128 varint per set bit, lowest channel first:
+//   the fixed-point value in a keyframe, the change since the previous
+//   frame in a delta. Deltas only carry channels whose value moved.
+// Clients pick their rate with the text message "rate=<hz>" (1..TELEMETRY_MAX_HZ).
+enum TelemetryFrameType {
+  TELEMETRY_KEYFRAME,
+  TELEMETRY_DELTA
+};
+
+// Runs entirely in the web task; the render loop does no per-client work
+void startTelemetry();
+void stopTelemetry();
+void updateTelemetry(uint32_t now);
+uint8_t getTelemetryClientCount();
+
+#endif // TELEMETRY_H
@@ -0,0 +1,72 @@
+#include "Theme.h"
+#include "Layout.h"
+#include <TFT_eSPI.h>
+
+// One LUT per theme, indexed by ThemeColor
+static const uint16_t themePalettes[THEME_COUNT][THEME_COLOR_COUNT] = {
+  { // THEME_DAY: the original dashboard colors
+    TFT_BLACK,      // THEME_BACKGROUND
+    TFT_WHITE,      // THEME_TEXT
+    TFT_WHITE,      // THEME_LABEL
+    TFT_GREEN,      // THEME_NORMAL
+    TFT_ORANGE,     // THEME_WARN
+    TFT_RED,        // THEME_CRITICAL
+    TFT_DARKGREY,   // THEME_BORDER
+    TFT_DARKGREY,   // THEME_INACTIVE
+    TFT_WHITE,      // THEME_HIGHLIGHT
+    TFT_CYAN,       // THEME_ACCENT
+    TFT_YELLOW      // THEME_NOTICE
+  },
+  { // THEME_NIGHT: same hues at roughly half intensity, grey text. The
+    // background stays black so a switch can restyle widget by widget.
+    TFT_BLACK,      // THEME_BACKGROUND
+    0xA514,         // THEME_TEXT       (grey 160)
+    0x7BCF,         // THEME_LABEL      (grey 120)
+    0x0400,         // THEME_NORMAL     (green 128)
+    0x8260,         // THEME_WARN       (128, 76, 0)
+    0xA000,         // THEME_CRITICAL   (red 160)
+    0x2945,         // THEME_BORDER     (grey 40)
+    0x2945,         // THEME_INACTIVE   (grey 40)
+    0xA514,         // THEME_HIGHLIGHT  (grey 160)
+    0x0410,         // THEME_ACCENT     (0, 128, 128)
+    0x8400          // THEME_NOTICE     (128, 128, 0)
+  }
+};
+
+const uint16_t *activePalette = themePalettes[THEME_DAY];
+static uint8_t activeTheme = THEME_DAY;
+static uint8_t themeEpoch = 0;
+
+bool setTheme(uint8_t theme) {
+  if (theme >= THEME_COUNT) {
+    return false;
+  }
+  if (theme == activeTheme) {
+    return true;
+  }
+  bool backgroundChanged = themePalettes[theme][THEME_BACKGROUND] != activePalette[THEME_BACKGROUND];
+  activeTheme = theme;
+  activePalette = themePalettes[theme];
+  themeEpoch++;
+  if (backgroundChanged) {
+    // Gaps between widgets would keep the old background
+    requestLayoutRebuild();
+  }
+  return true;
+}
+
+uint8_t getTheme() {
+  return activeTheme;
+}
+
+const char *getThemeName(uint8_t theme) {
+  switch (theme) {
+    case THEME_DAY: return "day";
+    case THEME_NIGHT: return "night";
+    default: return "unknown";
+  }
+}
+
+uint8_t getThemeEpoch() {
+  return themeEpoch;
+}
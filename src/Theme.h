@@ -0,0 +1,47 @@
+#ifndef THEME_H
+#define THEME_H
+
+#include <stdint.h>
+
+// Semantic colors. Renderers ask for a role and the active palette decides
+// the RGB565 value, so a theme switch never touches drawing code.
+enum ThemeColor {
+  THEME_BACKGROUND,   // Screen and widget background
+  THEME_TEXT,         // Values and readouts
+  THEME_LABEL,        // Static labels and units
+  THEME_NORMAL,       // Value in range, active indicator, RPM bar normal zone
+  THEME_WARN,         // Approaching a limit, RPM bar high zone
+  THEME_CRITICAL,     // Out of range, REV/LCH active, RPM bar danger zone
+  THEME_BORDER,       // Panel and graph frames, graph cursor
+  THEME_INACTIVE,     // Unlit RPM bar blocks
+  THEME_HIGHLIGHT,    // RPM peak marker and shift flash
+  THEME_ACCENT,       // Debug HUD
+  THEME_NOTICE,       // SIM marker
+  THEME_COLOR_COUNT
+};
+
+enum ThemeId {
+  THEME_DAY,
+  THEME_NIGHT,        // Dimmed, low-glare palette
+  THEME_COUNT
+};
+
+extern const uint16_t *activePalette;
+
+// Resolve a role through the active palette
+static inline uint16_t themeColor(uint8_t role) {
+  return activePalette[role < THEME_COLOR_COUNT ? role : THEME_TEXT];
+}
+
+// Switch palettes. Widgets drawn with the old palette are restyled by the
+// renderer a few per frame (see getThemeEpoch()); a theme with a different
+// background forces a full redraw instead. Returns false for an unknown id.
+bool setTheme(uint8_t theme);
+uint8_t getTheme();
+const char *getThemeName(uint8_t theme);
+
+// Bumped on every palette change. Widgets remember the epoch they were
+// drawn with; a mismatch means they still show the old colors.
+uint8_t getThemeEpoch();
+
+#endif // THEME_H
@@ -3,10 +3,24 @@
 #include "DataTypes.h"
 #include "DisplayConfig.h"
 #include "SplashScreen.h"
+#include "Layout.h"
+#include "DisplayManager.h"
+#include "Profiler.h"
+#include "text_utils.h"
+#include "ChannelFilter.h"
+#include "ChannelBands.h"
+#include "Theme.h"
+#include "Telemetry.h"
+#include "JsonWriter.h"
+#include "WebUI.h"
+#include "Metrics.h"
+#include "LayoutDocument.h"
+#include "OtaUpdate.h"
+#include "ConfigStore.h"
+#include "DataLogger.h"
+#include "MlgEncoder.h"
 #include <WiFi.h>
 #include <WebServer.h>
-#include <Update.h>
-#include <EEPROM.h>
 #include <esp_wifi.h>
 #include <esp_bt.h>
 #include <esp_bt_main.h>
@@ -17,681 +31,108 @@
 // IP configuration - Simple approach, let ESP32 use default IP
 // Default AP IP is usually 192.168.4.1
 
-// OTA upload page HTML
-const char *uploadPage PROGMEM = R"rawliteral(
-<!DOCTYPE html>
-<html>
-  <head>
-    <title>MAZDUINO Display Control</title>
-    <meta name="viewport" content="width=device-width, initial-scale=1.0">
-    <style>
-      body {
-        font-family: Arial, sans-serif;
-        margin: 0;
-        padding: 20px;
-        background-color: #1a1a1a;
-        color: #ffffff;
-      }
-      .container {
-        max-width: 600px;
-        margin: 0 auto;
-      }
-      h1, h2 {
-        color: #4CAF50;
-        text-align: center;
-      }
-      h1 {
-        border-bottom: 2px solid #4CAF50;
-        padding-bottom: 10px;
-        margin-bottom: 30px;
-      }
-      h2 {
-        font-size: 18px;
-        margin-bottom: 15px;
-      }
-      .section {
-        background-color: #2a2a2a;
-        padding: 20px;
-        margin: 20px 0;
-        border-radius: 8px;
-        border: 1px solid #444;
-        border-left: 4px solid #4CAF50;
-      }
-      .btn {
-        padding: 12px 24px;
-        font-size: 16px;
-        background-color: #4CAF50;
-        color: white;
-        border: none;
-        border-radius: 5px;
-        cursor: pointer;
-        margin: 5px;
-        width: 100%;
-        transition: background-color 0.3s;
-      }
-      .btn:hover {
-        background-color: #45a049;
-      }
-      .btn.danger {
-        background-color: #f44336;
-      }
-      .btn.danger:hover {
-        background-color: #da190b;
-      }
-      .toggle-btn.off {
-        background-color: #FF6B6B;
-      }
-      .toggle-btn.on {
-        background-color: #4ECDC4;
-      }
-      .status {
-        background-color: #333;
-        padding: 10px;
-        border-radius: 5px;
-        margin: 10px 0;
-      }
-      .file-input {
-        width: 100%;
-        padding: 10px;
-        background-color: #444;
-        border: 1px solid #666;
-        border-radius: 5px;
-        color: white;
-        margin: 10px 0;
-      }
-      .grid {
-        display: grid;
-        grid-template-columns: 1fr 1fr;
-        gap: 10px;
-      }
-      .config-grid {
-        display: grid;
-        grid-template-columns: 1fr 1fr;
-        gap: 15px;
-        margin: 15px 0;
-      }
-      .config-item {
-        display: flex;
-        flex-direction: column;
-      }
-      .config-item label {
-        font-weight: bold;
-        margin-bottom: 5px;
-        color: #4CAF50;
-      }
-      .config-item select {
-        padding: 8px;
-        background-color: #444;
-        border: 1px solid #666;
-        border-radius: 4px;
-        color: white;
-      }
-      .indicator-grid {
-        display: grid;
-        grid-template-columns: repeat(4, 1fr);
-        gap: 10px;
-        margin: 15px 0;
-      }
-      .indicator-grid label {
-        display: flex;
-        align-items: center;
-        gap: 8px;
-        font-size: 14px;
-      }
-      .indicator-grid input[type="checkbox"] {
-        width: 16px;
-        height: 16px;
-      }
-      .config-controls {
-        display: flex;
-        gap: 10px;
-        margin: 20px 0;
-      }
-      .config-controls .btn {
-        flex: 1;
-      }
-      h3 {
-        color: #4CAF50;
-        font-size: 16px;
-        margin: 20px 0 10px 0;
-        border-bottom: 1px solid #444;
-        padding-bottom: 5px;
-      }
-      @media (max-width: 600px) {
-        .grid {
-          grid-template-columns: 1fr;
-        }
-        .config-grid {
-          grid-template-columns: 1fr;
-        }
-        .indicator-grid {
-          grid-template-columns: repeat(2, 1fr);
-        }
-      }
-    </style>
-    <script>
-      function toggleDisplay(button) {
-        const isCurrentlyOff = button.classList.contains('off');
-        if (isCurrentlyOff) {
-          button.classList.remove('off');
-          button.classList.add('on');
-          button.textContent = "Display Mode: ECU Data";
-          fetch('/toggle', { method: 'POST', body: 'on' });
-        } else {
-          button.classList.remove('on');
-          button.classList.add('off');
-          button.textContent = "Display Mode: Trigger Error";
-          fetch('/toggle', { method: 'POST', body: 'off' });
-        }
-      }
-      
-      function setCommMode(mode) {
-        if (confirm('This will restart the device. Continue?')) {
-          fetch('/setMode', { 
-            method: 'POST', 
-            headers: {'Content-Type': 'application/x-www-form-urlencoded'},
-            body: 'mode=' + mode 
-          });
-        }
-      }
-      
-      function toggleDebug() {
-        fetch('/debug', { 
-          method: 'POST', 
-          headers: {'Content-Type': 'application/x-www-form-urlencoded'},
-          body: 'toggle=1' 
-        })
-        .then(response => response.text())
-        .then(data => {
-          alert('Debug mode: ' + data);
-        });
-      }
-      
-      function setSimulator(mode) {
-        fetch('/simulator', { 
-          method: 'POST', 
-          headers: {'Content-Type': 'application/x-www-form-urlencoded'},
-          body: 'mode=' + mode 
-        })
-        .then(response => response.text())
-        .then(data => {
-          alert('Simulator: ' + data);
-        });
-      }
-      
-      function refreshStatus() {
-        fetch('/status')
-          .then(response => response.json())
-          .then(data => {
-            const uptime = Math.floor(data.uptime);
-            const commColor = data.commMode === 'CAN Bus' ? '#4CAF50' : '#FF9800';
-            document.getElementById('status').innerHTML = 
-              'Status: Connected<br>' +
-              'WiFi: Active<br>' +
-              'Communication: <span style="color: ' + commColor + '; font-weight: bold;">' + data.commMode + ' Mode</span><br>' +
-              'Debug Mode: ' + (data.debugMode ? 'ON' : 'OFF') + '<br>' +
-              'Simulator: Mode ' + data.simulatorMode + '<br>' +
-              'Uptime: ' + uptime + ' seconds<br>' +
-              'Free Memory: ' + Math.round(data.freeHeap / 1024) + 'KB';
-          })
-          .catch(error => {
-            console.error('Error fetching status:', error);
-          });
-      }
-      
-      function updatePanelConfig(position) {
-        const select = document.getElementById('panel' + position);
-        const dataSource = select.value;
-        
-        fetch('/configPanel', {
-          method: 'POST',
-          headers: {'Content-Type': 'application/x-www-form-urlencoded'},
-          body: 'position=' + position + '&dataSource=' + dataSource
-        })
-        .then(response => response.text())
-        .then(data => {
-          console.log('Panel config updated:', data);
-        });
-      }
-      
-      function updateIndicatorConfig(indicator) {
-        const checkbox = document.getElementById('ind' + indicator);
-        const enabled = checkbox.checked;
-        
-        fetch('/configIndicator', {
-          method: 'POST',
-          headers: {'Content-Type': 'application/x-www-form-urlencoded'},
-          body: 'indicator=' + indicator + '&enabled=' + (enabled ? '1' : '0')
-        })
-        .then(response => response.text())
-        .then(data => {
-          console.log('Indicator config updated:', data);
-        });
-      }
-      
-      function saveDisplayConfig() {
-        fetch('/saveDisplayConfig', {
-          method: 'POST'
-        })
-        .then(response => response.text())
-        .then(data => {
-          alert('Display configuration saved: ' + data);
-        });
-      }
-      
-      function resetDisplayConfig() {
-        if (confirm('Reset display configuration to default? This will restart the device.')) {
-          fetch('/resetDisplayConfig', {
-            method: 'POST'
-          })
-          .then(response => response.text())
-          .then(data => {
-            alert('Display configuration reset: ' + data);
-            location.reload();
-          });
-        }
-      }
-      
-      function loadDisplayConfig() {
-        fetch('/getDisplayConfig')
-          .then(response => response.json())
-          .then(data => {
-            // Update panel selects
-            for (let i = 0; i < 8; i++) {
-              const select = document.getElementById('panel' + i);
-              if (data.panels[i] && data.panels[i].enabled) {
-                select.value = data.panels[i].dataSource;
-              } else {
-                select.value = 'disabled';
-              }
-            }
-            
-            // Update indicator checkboxes
-            for (let i = 0; i < 8; i++) {
-              const checkbox = document.getElementById('ind' + i);
-              if (data.indicators[i]) {
-                checkbox.checked = data.indicators[i].enabled;
-              }
-            }
-          });
-      }
-      
-      function updateCanSpeed() {
-        const select = document.getElementById('canSpeedSelect');
-        const speed = select.value;
-        fetch('/canspeed', {
-          method: 'POST',
-          headers: {'Content-Type': 'application/x-www-form-urlencoded'},
-          body: 'speed=' + speed
-        })
-        .then(response => response.text())
-        .then(data => {
-          alert('CAN speed updated: ' + speed + ' bps');
-        });
-      }
-      function loadCanSpeed() {
-        fetch('/canspeed')
-          .then(response => response.text())
-          .then(speed => {
-            const select = document.getElementById('canSpeedSelect');
-            if (select) select.value = speed;
-          });
-      }
-      
-      function updateSplashScreen() {
-        const select = document.getElementById('splashSelect');
-        const splash = select.value;
-        fetch('/splash', {
-          method: 'POST',
-          headers: {'Content-Type': 'application/x-www-form-urlencoded'},
-          body: 'splash=' + splash
-        })
-        .then(response => response.text())
-        .then(data => {
-          let splashName;
-          switch(splash) {
-            case '0': splashName = 'Mazduino'; break;
-            case '1': splashName = 'Mercedes'; break;
-            case '2': splashName = 'Hedon'; break;
-            case '3': splashName = 'Biies'; break;
-            default: splashName = 'Unknown'; break;
-          }
-          alert('Splash screen updated: ' + splashName);
-        });
-      }
-      
-      function loadSplashScreen() {
-        fetch('/splash')
-          .then(response => response.text())
-          .then(splash => {
-            const select = document.getElementById('splashSelect');
-            if (select) select.value = splash;
-          });
+// Web task state. Restarts are deferred so a handler can answer first and
+// never sleeps; the task loop performs them.
+static volatile bool requestServed = false;
+static volatile bool webRestartRequested = false;
+static volatile uint32_t restartAt = 0;
+
+static void scheduleRestart() {
+  restartAt = millis() + WEB_RESTART_DELAY_MS;
+}
+
+// JSON responses are built here (web task only), never in a String
+static char jsonBuffer[JSON_BUFFER_SIZE];
+
+static void sendJson(const JsonWriter &json) {
+  if (json.overflowed()) {
+    server.send(500, "text/plain", "Response too large");
+    return;
+  }
+  server.send_P(200, "application/json", json.c_str(), json.length());
+}
+
+// Register a route. The wrapper marks the pass as a served request so
+// handleWebServerClients() can record its latency.
+// Active panel / indicator shown at a street position, or nullptr. Entries
+// are not stored in position order, so the array index is not the slot,
+// and entries past the active count are never handed out.
+static DisplayPanel *findPanelAt(int position) {
+  if (position < 0 || position >= DISPLAY_MAX_PANELS) {
+    return nullptr;
+  }
+  for (uint8_t i = 0; i < currentDisplayConfig.activePanelCount; i++) {
+    if (currentDisplayConfig.panels[i].position == position) {
+      return &currentDisplayConfig.panels[i];
+    }
+  }
+  return nullptr;
+}
+
+static IndicatorConfig *findIndicatorAt(int position) {
+  if (position < 0 || position >= DISPLAY_MAX_INDICATORS) {
+    return nullptr;
+  }
+  for (uint8_t i = 0; i < currentDisplayConfig.activeIndicatorCount; i++) {
+    if (currentDisplayConfig.indicators[i].position == position) {
+      return &currentDisplayConfig.indicators[i];
+    }
+  }
+  return nullptr;
+}
+
+static void route(const char *uri, HTTPMethod method, WebServer::THandlerFunction handler) {
+  server.on(uri, method, [handler]() {
+    requestServed = true;
+    countMetric(METRIC_WEB_REQUESTS);
+    handler();
+  });
+}
+
+static void route(const char *uri, HTTPMethod method, WebServer::THandlerFunction handler, WebServer::THandlerFunction upload) {
+  server.on(uri, method, [handler]() {
+    requestServed = true;
+    countMetric(METRIC_WEB_REQUESTS);
+    handler();
+  }, upload);
+}
+
+// HTTP runs here, pinned to core 0 below the comm tasks, so serving pages,
+// OTA writes and WiFi bring-up never stall the render loop on core 1
+static void webServerTask(void *parameter) {
+  uint32_t taskStart = millis();
+  bool started = false;
+  while (1) {
+    if (!started && millis() - taskStart >= WEB_SERVER_START_DELAY_MS) {
+      startWebServer();
+      started = true;
+    }
+    if (webRestartRequested) {
+      webRestartRequested = false;
+      if (!wifiActive) {
+        Serial.println("Restarting WiFi and Web Server...");
+        startWebServer();
       }
-      
-      const startTime = Date.now()/1000;
-      setInterval(refreshStatus, 1000);
-      
-      // Load display config on page load
-      window.onload = function() {
-        loadDisplayConfig();
-        loadCanSpeed();
-        loadSplashScreen();
-      };
-    </script>
-  </head>
-  <body>
-    <div class="container">
-      <h1>MAZDUINO Display Control</h1>
-      
-      <div class="section">
-        <h2>System Status</h2>
-        <div class="status" id="status">
-          Status: Connected<br>
-          WiFi: Active<br>
-          Communication: <span id="commStatus" style="color: #4CAF50; font-weight: bold;">CAN Bus Mode</span><br>
-          Ready for configuration
-        </div>
-      </div>
-      
-      <div class="section">
-        <h2>Display Configuration</h2>
-        
-        <!-- Panel Configuration -->
-        <h3>Data Panels</h3>
-        <div class="config-grid">
-          <div class="config-item">
-            <label>Position 1 (Left-Top):</label>
-            <select id="panel0" onchange="updatePanelConfig(0)">
-              <option value="disabled">Disabled</option>
-              <option value="0">IAT</option>
-              <option value="1">Coolant</option>
-              <option value="2">AFR</option>
-              <option value="3">ADV</option>
-              <option value="4">Trigger</option>
-              <option value="5">TPS</option>
-              <option value="6">Voltage</option>
-              <option value="7">MAP</option>
-              <option value="8">RPM</option>
-              <option value="9">FP</option>
-              <option value="10">VSS</option>
-            </select>
-          </div>
-          <div class="config-item">
-            <label>Position 2 (Left-Middle):</label>
-            <select id="panel1" onchange="updatePanelConfig(1)">
-              <option value="disabled">Disabled</option>
-              <option value="0">IAT</option>
-              <option value="1">Coolant</option>
-              <option value="2">AFR</option>
-              <option value="3">ADV</option>
-              <option value="4">Trigger</option>
-              <option value="5">TPS</option>
-              <option value="6">Voltage</option>
-              <option value="7">MAP</option>
-              <option value="8">RPM</option>
-              <option value="9">FP</option>
-              <option value="10">VSS</option>
-            </select>
-          </div>
-          <div class="config-item">
-            <label>Position 3 (Left-Bottom):</label>
-            <select id="panel2" onchange="updatePanelConfig(2)">
-              <option value="disabled">Disabled</option>
-              <option value="0">IAT</option>
-              <option value="1">Coolant</option>
-              <option value="2">AFR</option>
-              <option value="3">ADV</option>
-              <option value="4">Trigger</option>
-              <option value="5">TPS</option>
-              <option value="6">Voltage</option>
-              <option value="7">MAP</option>
-              <option value="8">RPM</option>
-              <option value="9">FP</option>
-              <option value="10">VSS</option>
-            </select>
-          </div>
-          <div class="config-item">
-            <label>Position 4 (Right-Top):</label>
-            <select id="panel3" onchange="updatePanelConfig(3)">
-              <option value="disabled">Disabled</option>
-              <option value="0">IAT</option>
-              <option value="1">Coolant</option>
-              <option value="2">AFR</option>
-              <option value="3">ADV</option>
-              <option value="4">Trigger</option>
-              <option value="5">TPS</option>
-              <option value="6">Voltage</option>
-              <option value="7">MAP</option>
-              <option value="8">RPM</option>
-              <option value="9">FP</option>
-              <option value="10">VSS</option>
-            </select>
-          </div>
-          <div class="config-item">
-            <label>Position 5 (Right-Middle):</label>
-            <select id="panel4" onchange="updatePanelConfig(4)">
-              <option value="disabled">Disabled</option>
-              <option value="0">IAT</option>
-              <option value="1">Coolant</option>
-              <option value="2">AFR</option>
-              <option value="3">ADV</option>
-              <option value="4">Trigger</option>
-              <option value="5">TPS</option>
-              <option value="6">Voltage</option>
-              <option value="7">MAP</option>
-              <option value="8">RPM</option>
-              <option value="9">FP</option>
-              <option value="10">VSS</option>
-            </select>
-          </div>
-          <div class="config-item">
-            <label>Position 6 (Right-Bottom):</label>
-            <select id="panel5" onchange="updatePanelConfig(5)">
-              <option value="disabled">Disabled</option>
-              <option value="0">IAT</option>
-              <option value="1">Coolant</option>
-              <option value="2">AFR</option>
-              <option value="3">ADV</option>
-              <option value="4">Trigger</option>
-              <option value="5">TPS</option>
-              <option value="6">Voltage</option>
-              <option value="7">MAP</option>
-              <option value="8">RPM</option>
-              <option value="9">FP</option>
-              <option value="10">VSS</option>
-            </select>
-          </div>
-          <div class="config-item">
-            <label>Position 7 (Bottom-Left):</label>
-            <select id="panel6" onchange="updatePanelConfig(6)">
-              <option value="disabled">Disabled</option>
-              <option value="0">IAT</option>
-              <option value="1">Coolant</option>
-              <option value="2">AFR</option>
-              <option value="3">ADV</option>
-              <option value="4">Trigger</option>
-              <option value="5">TPS</option>
-              <option value="6">Voltage</option>
-              <option value="7">MAP</option>
-              <option value="8">RPM</option>
-              <option value="9">FP</option>
-              <option value="10">VSS</option>
-            </select>
-          </div>
-          <div class="config-item">
-            <label>Position 8 (Bottom-Right):</label>
-            <select id="panel7" onchange="updatePanelConfig(7)">
-              <option value="disabled">Disabled</option>
-              <option value="0">IAT</option>
-              <option value="1">Coolant</option>
-              <option value="2">AFR</option>
-              <option value="3">ADV</option>
-              <option value="4">Trigger</option>
-              <option value="5">TPS</option>
-              <option value="6">Voltage</option>
-              <option value="7">MAP</option>
-              <option value="8">RPM</option>
-              <option value="9">FP</option>
-              <option value="10">VSS</option>
-            </select>
-          </div>
-        </div>
-        
-        <!-- Indicator Configuration -->
-        <h3>Status Indicators</h3>
-        <div class="indicator-grid">
-          <label><input type="checkbox" id="ind0" onchange="updateIndicatorConfig(0)"> SYNC</label>
-          <label><input type="checkbox" id="ind1" onchange="updateIndicatorConfig(1)"> FAN</label>
-          <label><input type="checkbox" id="ind2" onchange="updateIndicatorConfig(2)"> ASE</label>
-          <label><input type="checkbox" id="ind3" onchange="updateIndicatorConfig(3)"> WUE</label>
-          <label><input type="checkbox" id="ind4" onchange="updateIndicatorConfig(4)"> REV</label>
-          <label><input type="checkbox" id="ind5" onchange="updateIndicatorConfig(5)"> LCH</label>
-          <label><input type="checkbox" id="ind6" onchange="updateIndicatorConfig(6)"> AC</label>
-          <label><input type="checkbox" id="ind7" onchange="updateIndicatorConfig(7)"> DFCO</label>
-        </div>
-        
-        <div class="config-controls">
-          <button class="btn" onclick="saveDisplayConfig()">Save Configuration</button>
-          <button class="btn danger" onclick="resetDisplayConfig()">Reset to Default</button>
-        </div>
-        
-        <p style="font-size: 14px; opacity: 0.8;">
-          <strong>Display Configuration:</strong><br>
-          • <strong>Data Panels:</strong> Choose which engine data to display in each position<br>
-          • <strong>Status Indicators:</strong> Select which status indicators to show at bottom<br>
-          • <strong>Layout:</strong> 8 data panels (4 top, 4 bottom) + indicator bar<br>
-          • <strong>Data Types:</strong> Float (AFR, Voltage), Integer (TPS, MAP, etc.), Boolean (indicators)<br>
-          <br>
-          Configuration is saved to device memory and persists across restarts.
-        </p>
-      </div>
-      
-      <div class="section">
-        <h2>Debug & Testing</h2>
-        <div class="grid">
-          <button class="btn" onclick="toggleDebug()">
-            Toggle Debug Mode
-          </button>
-          <button class="btn" onclick="setSimulator('0')">
-            Simulator OFF
-          </button>
-        </div>
-        <div class="grid">
-          <button class="btn" onclick="setSimulator('1')">
-            RPM Sweep
-          </button>
-          <button class="btn" onclick="setSimulator('2')">
-            Engine Idle
-          </button>
-        </div>
-        <div class="grid">
-          <button class="btn" onclick="setSimulator('3')">
-            Driving Mode
-          </button>
-          <button class="btn" onclick="setSimulator('4')">
-            Redline Mode
-          </button>
-        </div>
-        <p style="font-size: 14px; opacity: 0.8;">
-          <strong>Debug Mode:</strong> Shows CPU usage, FPS, and memory info at top center of display<br>
-          <strong>Simulator Modes:</strong><br>
-          • <strong>OFF:</strong> Use real ECU data<br>
-          • <strong>RPM Sweep:</strong> RPM increases from 0 to 8000 continuously<br>
-          • <strong>Engine Idle:</strong> Simulates engine at idle (800 RPM)<br>
-          • <strong>Driving:</strong> Simulates normal driving conditions (2000-4000 RPM)<br>
-          • <strong>Redline:</strong> Simulates high RPM operation (6000+ RPM)<br>
-          <br>
-          When simulator is active, "SIM" indicator appears on display. Use these modes to test the display without connecting to real ECU.
-        </p>
-      </div>
-      
-      <div class="section">
-        <h2>Communication Mode</h2>
-        <div class="grid">
-          <button class="btn" onclick="setCommMode('can')">
-            CAN Bus Mode
-          </button>
-          <button class="btn" onclick="setCommMode('serial')">
-            Serial Mode
-          </button>
-        </div>
-        <p style="font-size: 14px; opacity: 0.8;">
-          <strong>Communication Mode Explanation:</strong><br>
-          • <strong>CAN Bus Mode:</strong> Receives data via CAN bus (standard automotive protocol)<br>
-          • <strong>Serial Mode:</strong> Receives data via serial communication (UART)<br>
-          <br>
-          The active mode is shown on the display:<br>
-          • <strong>"CAN"</strong> appears in green at top-left for CAN Bus mode<br>
-          • <strong>"SER"</strong> appears in orange at top-left for Serial mode<br>
-          <br>
-          <strong>WARNING:</strong> Changing communication mode will restart the device.
-        </p>
-      </div>
-      
-      <div class="section">
-        <h2>Firmware Update</h2>
-        <form method="POST" action="/update" enctype="multipart/form-data">
-          <input type="file" name="firmware" class="file-input" accept=".bin" required>
-          <button type="submit" class="btn danger">Upload Firmware</button>
-        </form>
-        <p style="font-size: 14px; opacity: 0.8;">
-          WARNING: Only upload official MAZDUINO firmware files
-        </p>
-      </div>
-      
-      <div class="section">
-        <h2>Information</h2>
-        <p>
-          <strong>WiFi Network:</strong> MAZDUINO_Display<br>
-          <strong>IP Address:</strong> 192.168.4.1<br>
-          <strong>Version:</strong> 1.2
-        </p>
-        <p style="font-size: 14px; opacity: 0.8;">
-          WiFi will automatically turn off after 1 minute of inactivity to save power.
-        </p>
-      </div>
-      
-      <div class="section">
-        <h2>Splash Screen Configuration</h2>
-        <div class="config-item">
-          <label for="splashSelect">Splash Screen:</label>
-          <select id="splashSelect" onchange="updateSplashScreen()">
-            <option value="0">Mazduino</option>
-            <option value="1">Mercedes</option>
-            <option value="2">Hedon</option>
-            <option value="3">Biies</option>
-          </select>
-        </div>
-        <p style="font-size: 14px; opacity: 0.8;">
-          Pilih gambar yang akan ditampilkan saat startup.<br>
-          Perubahan akan disimpan dan digunakan saat restart berikutnya.
-        </p>
-      </div>
-      
-      <div class="section">
-        <h2>CAN Bus Configuration</h2>
-        <div class="config-item">
-          <label for="canSpeedSelect">CAN Speed:</label>
-          <select id="canSpeedSelect" onchange="updateCanSpeed()">
-            <option value="500000">500 Kbps</option>
-            <option value="1000000">1 Mbps</option>
-          </select>
-        </div>
-        <p style="font-size: 14px; opacity: 0.8;">
-          Pilih kecepatan CAN sesuai kebutuhan hardware/ECU Anda.<br>
-          Perubahan akan disimpan dan digunakan saat restart berikutnya.
-        </p>
-      </div>
-    </div>
-  </body>
-</html>
-)rawliteral";
+      started = true;
+    }
+    if (restartAt != 0 && (int32_t)(millis() - restartAt) >= 0) {
+      configStoreFlush();
+      ESP.restart();
+    }
+    handleWebServerClients();
+    updateTelemetry(millis());
+    configStoreService(millis());
+    vTaskDelay(wifiActive ? 2 : 50);
+  }
+}
 
 void setupWebServer()
 {
-  // Don't start immediately - will be called after 15 seconds in main.cpp
-  Serial.println("Web server setup ready - will start after 15 seconds");
+  // The task brings the AP up after WEB_SERVER_START_DELAY_MS
+  TaskHandle_t webTask = NULL;
+  xTaskCreatePinnedToCore(webServerTask, "Web Task", WEB_TASK_STACK, NULL, WEB_TASK_PRIORITY, &webTask, 0);
+  metricsRegisterTask("web", webTask);
+  Serial.println("Web server task ready - will start after 15 seconds");
 }
 
 void startWebServer()
@@ -702,19 +143,22 @@ void startWebServer()
   // Use default IP configuration (192.168.4.1)
   WiFi.softAP(ssid, password);
   
-  // Wait for AP to be ready
+  // Wait for AP to be ready (web task only, rendering continues)
   delay(1000);
 
-  server.on("/", HTTP_GET, handleRoot);
-  server.on(
+  route("/", HTTP_GET, handleRoot);
+  route(
       "/update", HTTP_POST, [&]()
       {
-      server.send(200, "text/plain", (Update.hasError()) ? "Gagal update!" : "Update berhasil! MAZDUINO Display akan restart.");
-      delay(1000);
-      ESP.restart(); },
+      if (otaError()[0] != '\0' || otaBytesWritten() == 0) {
+        server.send(400, "text/plain", String("Gagal update: ") + (otaError()[0] ? otaError() : "no file"));
+        return;
+      }
+      server.send(200, "text/plain", "Update berhasil! MAZDUINO Display akan restart.");
+      scheduleRestart(); },
       handleUpdate);
-  server.on("/toggle", HTTP_POST, handleToggle);
-  server.on("/setMode", HTTP_POST, [&]()
+  route("/toggle", HTTP_POST, handleToggle);
+  route("/setMode", HTTP_POST, [&]()
             {
               String mode = server.arg("mode");
               if (mode == "serial")
@@ -725,17 +169,18 @@ void startWebServer()
               {
                 commMode = COMM_CAN;
               }
-              EEPROM.write(1, commMode);
-              EEPROM.commit();
+              systemSettings.commMode = commMode;
+              configMarkDirty(CONFIG_RECORD_SYSTEM);
               server.send(200, "text/plain", "Mode updated");
-              ESP.restart();
+              scheduleRestart();
             });
   
   // Debug mode handler
-  server.on("/debug", HTTP_POST, [&]()
+  route("/debug", HTTP_POST, [&]()
             {
 #if ENABLE_DEBUG_MODE
               debugMode = !debugMode;
+              profilerEnabled = debugMode;
               String status = debugMode ? "ON" : "OFF";
               server.send(200, "text/plain", status);
               Serial.printf("Web: Debug mode %s\n", status.c_str());
@@ -745,12 +190,15 @@ void startWebServer()
             });
   
   // Simulator handler
-  server.on("/simulator", HTTP_POST, [&]()
+  route("/simulator", HTTP_POST, [&]()
             {
 #if ENABLE_SIMULATOR
               String mode = server.arg("mode");
               int simMode = mode.toInt();
-              setSimulatorMode(simMode);
+              {
+                DisplayStateGuard guard;
+                setSimulatorMode(simMode);
+              }
               
               String modeNames[] = {"OFF", "RPM Sweep", "Engine Idle", "Driving", "Redline"};
               String modeName = (simMode >= 0 && simMode <= 4) ? modeNames[simMode] : "Unknown";
@@ -763,132 +211,508 @@ void startWebServer()
             });
   
   // Status endpoint for real-time updates
-  server.on("/status", HTTP_GET, [&]()
+  route("/status", HTTP_GET, [&]()
             {
-              String json = "{";
-              json += "\"commMode\":\"" + String(commMode == COMM_CAN ? "CAN Bus" : "Serial") + "\",";
-              json += "\"debugMode\":" + String(debugMode ? "true" : "false") + ",";
+              JsonWriter json(jsonBuffer, sizeof(jsonBuffer));
+              json.beginObject();
+              json.addString("commMode", commMode == COMM_CAN ? "CAN Bus" : "Serial");
+              json.addBool("debugMode", debugMode);
 #if ENABLE_SIMULATOR
-              json += "\"simulatorMode\":" + String(getSimulatorMode()) + ",";
+              json.addInt("simulatorMode", getSimulatorMode());
 #else
-              json += "\"simulatorMode\":0,";
+              json.addInt("simulatorMode", 0);
 #endif
-              json += "\"uptime\":" + String(millis() / 1000) + ",";
-              json += "\"freeHeap\":" + String(ESP.getFreeHeap()) + "";
-              json += "}";
-              server.send(200, "application/json", json);
+              json.addUInt("uptime", millis() / 1000);
+              json.addUInt("telemetryClients", getTelemetryClientCount());
+              json.addUInt("freeHeap", ESP.getFreeHeap());
+              json.addUInt("maxAllocHeap", ESP.getMaxAllocHeap()); // Largest free block: falls as the heap fragments
+              json.endObject();
+              sendJson(json);
             });
   
   // Display configuration endpoints
-  server.on("/configPanel", HTTP_POST, [&]()
+  route("/configPanel", HTTP_POST, [&]()
             {
               int position = server.arg("position").toInt();
               String dataSourceStr = server.arg("dataSource");
               
-              if (position >= 0 && position < 8) {
+              // Only this task edits the config, so the lookup needs no lock
+              DisplayPanel *panel = findPanelAt(position);
+              if (!panel) {
+                server.send(400, "text/plain", "No panel at that position");
+                return;
+              }
+              {
+                DisplayStateGuard guard;
                 if (dataSourceStr == "disabled") {
-                  currentDisplayConfig.panels[position].enabled = false;
+                  panel->enabled = false;
                 } else {
-                  int dataSource = dataSourceStr.toInt();
+                  // "g<source>" selects a history graph, "a<source>" an arc gauge of that source
+                  bool graph = dataSourceStr.startsWith("g");
+                  bool gauge = dataSourceStr.startsWith("a");
+                  int dataSource = (graph || gauge ? dataSourceStr.substring(1) : dataSourceStr).toInt();
                   if (dataSource >= 0 && dataSource < DATA_SOURCE_COUNT) {
-                    currentDisplayConfig.panels[position].enabled = true;
-                    currentDisplayConfig.panels[position].dataSource = dataSource;
-                    currentDisplayConfig.panels[position].position = position;
-                    
+                    panel->enabled = true;
+                    panel->dataSource = dataSource;
+                  
                     // Set appropriate data type and decimals
                     switch (dataSource) {
                       case DATA_SOURCE_AFR:
                       case DATA_SOURCE_VOLTAGE:
-                        currentDisplayConfig.panels[position].dataType = DATA_TYPE_FLOAT;
-                        currentDisplayConfig.panels[position].decimals = 1;
+                        panel->dataType = DATA_TYPE_FLOAT;
+                        panel->decimals = 1;
                         break;
                       case DATA_SOURCE_IAT:
                       case DATA_SOURCE_COOLANT:
-                        currentDisplayConfig.panels[position].dataType = DATA_TYPE_UINT;
-                        currentDisplayConfig.panels[position].decimals = 0;
+                        panel->dataType = DATA_TYPE_UINT;
+                        panel->decimals = 0;
                         break;
                       default:
-                        currentDisplayConfig.panels[position].dataType = DATA_TYPE_INT;
-                        currentDisplayConfig.panels[position].decimals = 0;
+                        panel->dataType = DATA_TYPE_INT;
+                        panel->decimals = 0;
                         break;
                     }
-                    
+                  
+                    if (graph) {
+                      panel->dataType = DATA_TYPE_GRAPH;
+                    } else if (gauge) {
+                      panel->dataType = DATA_TYPE_GAUGE;
+                    }
+                  
                     // Copy label from data source
-                    strcpy(currentDisplayConfig.panels[position].label, getDataSourceName(dataSource));
+                    strcpy(panel->label, getDataSourceName(dataSource));
                   }
                 }
+                requestLayoutUpdate();
               }
               
               server.send(200, "text/plain", "Panel configured");
             });
   
-  server.on("/configIndicator", HTTP_POST, [&]()
+  route("/configIndicator", HTTP_POST, [&]()
             {
-              int indicator = server.arg("indicator").toInt();
+              int position = server.arg("indicator").toInt();
               bool enabled = server.arg("enabled") == "1";
               
-              if (indicator >= 0 && indicator < 8) {
-                currentDisplayConfig.indicators[indicator].enabled = enabled;
-                currentDisplayConfig.indicators[indicator].indicator = indicator;
-                currentDisplayConfig.indicators[indicator].position = indicator;
-                strcpy(currentDisplayConfig.indicators[indicator].label, getIndicatorName(indicator));
+              IndicatorConfig *indicator = findIndicatorAt(position);
+              if (!indicator) {
+                server.send(400, "text/plain", "No indicator at that position");
+                return;
+              }
+              {
+                DisplayStateGuard guard;
+                indicator->enabled = enabled;
+                requestLayoutUpdate();
               }
               
               server.send(200, "text/plain", "Indicator configured");
             });
   
-  server.on("/saveDisplayConfig", HTTP_POST, [&]()
+  // Whole layout as one document (see LayoutDocument.h): parsed and
+  // validated first, then swapped in between frames and saved once
+  route("/layout", HTTP_GET, [&]() {
+    static char buf[LAYOUT_DOC_SIZE];
+    size_t len = writeLayoutDocument(buf, sizeof(buf));
+    server.send_P(200, "text/plain", buf, len);
+  });
+  
+  route("/layout", HTTP_PUT, [&]() {
+    static char buf[LAYOUT_DOC_SIZE];
+    static LayoutDocument staged;
+    const String &body = server.arg("plain");
+    if (body.length() == 0 || body.length() >= sizeof(buf)) {
+      server.send(400, "text/plain", "Missing or oversized layout document");
+      return;
+    }
+    memcpy(buf, body.c_str(), body.length() + 1);
+    char error[80];
+    if (!parseLayoutDocument(buf, staged, error, sizeof(error))) {
+      server.send(400, "text/plain", error);
+      return;
+    }
+    {
+      DisplayStateGuard guard;
+      applyLayoutDocument(staged);
+    }
+    saveDisplayConfig();
+    if (staged.bandMask) {
+      saveChannelBands();
+    }
+    server.send(200, "text/plain", "Layout applied");
+    Serial.printf("Layout applied via webserver: %u panels, %u indicators\n",
+                  staged.config.activePanelCount, staged.config.activeIndicatorCount);
+  });
+  
+  route("/saveDisplayConfig", HTTP_POST, [&]()
             {
               saveDisplayConfig();
               server.send(200, "text/plain", "Configuration saved");
             });
   
-  server.on("/resetDisplayConfig", HTTP_POST, [&]()
+  route("/resetDisplayConfig", HTTP_POST, [&]()
             {
-              resetDisplayConfigToDefault();
+              {
+                DisplayStateGuard guard;
+                resetDisplayConfigToDefault();
+              }
               server.send(200, "text/plain", "Configuration reset");
-              delay(1000);
-              ESP.restart();
+              scheduleRestart();
             });
   
-  server.on("/getDisplayConfig", HTTP_GET, [&]()
+  route("/getDisplayConfig", HTTP_GET, [&]()
             {
-              String json = "{";
-              json += "\"panels\":[";
-              for (int i = 0; i < 8; i++) {
-                if (i > 0) json += ",";
-                json += "{";
-                json += "\"enabled\":" + String(currentDisplayConfig.panels[i].enabled ? "true" : "false") + ",";
-                json += "\"dataSource\":" + String(currentDisplayConfig.panels[i].dataSource) + ",";
-                json += "\"position\":" + String(currentDisplayConfig.panels[i].position);
-                json += "}";
+              JsonWriter json(jsonBuffer, sizeof(jsonBuffer));
+              json.beginObject();
+              json.beginArray("panels");
+              for (int i = 0; i < DISPLAY_MAX_PANELS; i++) {
+                const DisplayPanel &panel = currentDisplayConfig.panels[i];
+                json.beginObject();
+                json.addBool("enabled", panel.enabled);
+                json.addInt("dataSource", panel.dataSource);
+                json.addBool("graph", panel.dataType == DATA_TYPE_GRAPH);
+                json.addBool("gauge", panel.dataType == DATA_TYPE_GAUGE);
+                json.addInt("position", panel.position);
+                json.endObject();
               }
-              json += "],";
-              json += "\"indicators\":[";
-              for (int i = 0; i < 8; i++) {
-                if (i > 0) json += ",";
-                json += "{";
-                json += "\"enabled\":" + String(currentDisplayConfig.indicators[i].enabled ? "true" : "false") + ",";
-                json += "\"indicator\":" + String(currentDisplayConfig.indicators[i].indicator) + ",";
-                json += "\"position\":" + String(currentDisplayConfig.indicators[i].position);
-                json += "}";
+              json.endArray();
+              json.beginArray("indicators");
+              for (int i = 0; i < DISPLAY_MAX_INDICATORS; i++) {
+                const IndicatorConfig &indicator = currentDisplayConfig.indicators[i];
+                json.beginObject();
+                json.addBool("enabled", indicator.enabled);
+                json.addInt("indicator", indicator.indicator);
+                json.addInt("position", indicator.position);
+                json.endObject();
               }
-              json += "]";
-              json += "}";
-              server.send(200, "application/json", json);
+              json.endArray();
+              json.endObject();
+              sendJson(json);
             });
   
-  server.on("/canspeed", HTTP_GET, handleCanSpeed);
-  server.on("/canspeed", HTTP_POST, handleCanSpeed);
+  // Display page selection
+  route("/page", HTTP_GET, [&]() {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%d", getActivePage());
+    server.send(200, "text/plain", buf);
+  });
+  
+  route("/page", HTTP_POST, [&]() {
+    if (server.hasArg("page")) {
+      int page = server.arg("page").toInt();
+      if (page >= 0 && page < PAGE_COUNT) {
+        {
+          DisplayStateGuard guard;
+          setActivePage(page);
+        }
+        server.send(200, "text/plain", getPageName(page));
+        Serial.printf("Display page set to %s via webserver\n", getPageName(page));
+      } else {
+        server.send(400, "text/plain", "Invalid page");
+      }
+    } else {
+      server.send(400, "text/plain", "Missing page param");
+    }
+  });
+  
+  // Day/night palette
+  route("/theme", HTTP_GET, [&]() {
+    server.send(200, "text/plain", getThemeName(getTheme()));
+  });
+  
+  route("/theme", HTTP_POST, [&]() {
+    if (!server.hasArg("theme")) {
+      server.send(400, "text/plain", "Missing theme param");
+      return;
+    }
+    int theme = server.arg("theme").toInt();
+    bool applied;
+    {
+      DisplayStateGuard guard;
+      applied = theme >= 0 && setTheme(theme);
+    }
+    if (!applied) {
+      server.send(400, "text/plain", "Invalid theme");
+      return;
+    }
+    server.send(200, "text/plain", getThemeName(theme));
+    Serial.printf("Theme set to %s via webserver\n", getThemeName(theme));
+  });
+  
+  // Frame profiler report (enable with POST enabled=1 or debug mode)
+  route("/profile", HTTP_GET, [&]() {
+    JsonWriter json(jsonBuffer, sizeof(jsonBuffer));
+    writeProfileJson(json);
+    sendJson(json);
+  });
+  
+  // Prometheus text exposition of the always-on counters
+  route("/metrics", HTTP_GET, [&]() {
+    static char buf[METRICS_BUFFER_SIZE];
+    size_t len = formatMetrics(buf, sizeof(buf));
+    server.send_P(200, "text/plain; version=0.0.4", buf, len);
+  });
+  
+  route("/profile", HTTP_POST, [&]() {
+    if (server.hasArg("enabled")) {
+      profilerEnabled = server.arg("enabled").toInt() != 0;
+    }
+    server.send(200, "text/plain", profilerEnabled ? "ON" : "OFF");
+  });
+  
+  // Per-channel display smoothing and deadband
+  route("/filter", HTTP_GET, [&]() {
+    JsonWriter json(jsonBuffer, sizeof(jsonBuffer));
+    json.beginArray();
+    for (int i = 0; i < DATA_SOURCE_COUNT; i++) {
+      const ChannelFilterConfig &filter = getChannelFilter(i);
+      json.beginObject();
+      json.addInt("source", i);
+      json.addString("name", getDataSourceName(i));
+      json.addString("mode", getFilterModeName(filter.mode));
+      json.addUInt("param", filter.param);
+      json.addFloat("deadband", filter.deadband, 2);
+      json.addUInt("decimals", getChannelDecimals(i)); // Deadband is capped below half of 10^-decimals
+      json.endObject();
+    }
+    json.endArray();
+    sendJson(json);
+  });
+  
+  route("/filter", HTTP_POST, [&]() {
+    if (!server.hasArg("source")) {
+      server.send(400, "text/plain", "Missing source param");
+      return;
+    }
+    int source = server.arg("source").toInt();
+    if (source < 0 || source >= DATA_SOURCE_COUNT) {
+      server.send(400, "text/plain", "Invalid source");
+      return;
+    }
+    ChannelFilterConfig filter = getChannelFilter(source);
+    if (server.hasArg("mode")) filter.mode = constrain(server.arg("mode").toInt(), FILTER_NONE, FILTER_MEDIAN);
+    if (server.hasArg("param")) filter.param = server.arg("param").toInt();
+    if (server.hasArg("deadband")) filter.deadband = server.arg("deadband").toFloat();
+    {
+      DisplayStateGuard guard;
+      setChannelFilter(source, filter);
+    }
+    server.send(200, "text/plain", "Filter updated");
+    Serial.printf("Filter for %s: %s %u, deadband %.2f\n", getDataSourceName(source), getFilterModeName(filter.mode), filter.param, filter.deadband);
+  });
+  
+  // Per-channel color bands (edges in display units, one role per band)
+  route("/bands", HTTP_GET, [&]() {
+    JsonWriter json(jsonBuffer, sizeof(jsonBuffer));
+    json.beginArray();
+    for (int i = 0; i < DATA_SOURCE_COUNT; i++) {
+      const ChannelBands &bands = getChannelBands(i);
+      json.beginObject();
+      json.addInt("source", i);
+      json.addString("name", getDataSourceName(i));
+      json.addFixed("hysteresis", bands.hysteresis, BAND_DECIMALS);
+      json.beginArray("edges");
+      for (int e = 0; e < bands.count; e++) {
+        json.addFixed(NULL, bands.edge[e], BAND_DECIMALS);
+      }
+      json.endArray();
+      json.beginArray("roles");
+      for (int r = 0; r <= bands.count; r++) {
+        json.addString(NULL, getBandRoleName(bands.role[r]));
+      }
+      json.endArray();
+      json.endObject();
+    }
+    json.endArray();
+    sendJson(json);
+  });
+  
+  route("/bands", HTTP_POST, [&]() {
+    if (!server.hasArg("source") || !server.hasArg("roles")) {
+      server.send(400, "text/plain", "Missing source or roles param");
+      return;
+    }
+    int source = server.arg("source").toInt();
+    if (source < 0 || source >= DATA_SOURCE_COUNT) {
+      server.send(400, "text/plain", "Invalid source");
+      return;
+    }
+    ChannelBands bands = getChannelBands(source);
+    if (server.hasArg("hysteresis")) {
+      bands.hysteresis = toFixed(server.arg("hysteresis").toFloat(), BAND_DECIMALS);
+    }
+
+    // edges=13.0,14.8  roles=warn,normal,critical (one more role than edges)
+    char edges[64];
+    char roles[64];
+    snprintf(edges, sizeof(edges), "%s", server.arg("edges").c_str());
+    snprintf(roles, sizeof(roles), "%s", server.arg("roles").c_str());
+    if (!parseBandLists(edges, roles, bands)) {
+      server.send(400, "text/plain", "Edges must ascend, with one role per band");
+      return;
+    }
+    {
+      DisplayStateGuard guard;
+      setChannelBands(source, bands);
+    }
+    saveChannelBands();
+    server.send(200, "text/plain", "Bands updated");
+    Serial.printf("Bands for %s: %u edges, hysteresis %.1f\n", getDataSourceName(source), bands.count, bands.hysteresis / 10.0f);
+  });
+  
+  // Datalogger status, settings and manual trigger
+  route("/log", HTTP_GET, [&]() {
+    LoggerStatus status;
+    getLoggerStatus(status);
+    JsonWriter json(jsonBuffer, sizeof(jsonBuffer));
+    json.beginObject();
+    json.addString("state", getLoggerStateName(status.state));
+    json.addBool("manual", status.manual);
+    json.addUInt("file", status.fileNumber);
+    json.addUInt("records", status.records);
+    json.addUInt("dropped", status.dropped);
+    json.addUInt("pending", status.pending);
+    json.addUInt("storageUsed", status.storageUsed);
+    json.addUInt("storageTotal", status.storageTotal);
+    json.addUInt("lateSamples", status.lateSamples);
+    json.addUInt("maxSampleGapUs", status.maxSampleGapUs);
+    json.addUInt("lateFrames", status.lateFrames);
+    json.addUInt("maxWriteUs", status.maxWriteUs);
+    json.addUInt("rate", loggerSettings.rateHz);
+    json.addUInt("preTrigger", loggerSettings.preTriggerSec);
+    json.addUInt("rpmStart", loggerSettings.rpmStart);
+    json.addUInt("tpsStart", loggerSettings.tpsStart);
+    json.beginArray("files");
+    if (status.state != LOGGER_OFF) {
+      LogFileInfo files[LOG_MAX_FILES];
+      uint8_t count = listLogFiles(files, LOG_MAX_FILES);
+      for (uint8_t i = 0; i < count; i++) {
+        json.beginObject();
+        json.addUInt("number", files[i].number);
+        json.addUInt("size", files[i].size);
+        json.endObject();
+      }
+    }
+    json.endArray();
+    json.endObject();
+    sendJson(json);
+  });
+
+  // action=start|stop|clear, or any of rate/pre/rpm/tps to change settings
+  route("/log", HTTP_POST, [&]() {
+    LoggerStatus status;
+    getLoggerStatus(status);
+    if (status.state == LOGGER_OFF) {
+      server.send(503, "text/plain", "No log storage");
+      return;
+    }
+    String action = server.arg("action");
+    if (action == "start") {
+      loggerStart();
+      server.send(200, "text/plain", "Logging started");
+      return;
+    }
+    if (action == "stop") {
+      loggerStop();
+      server.send(200, "text/plain", "Logging stopped");
+      return;
+    }
+    if (action == "clear") {
+      if (!deleteAllLogs()) {
+        server.send(409, "text/plain", "Stop logging first");
+        return;
+      }
+      server.send(200, "text/plain", "Logs deleted");
+      return;
+    }
+    if (status.state != LOGGER_ARMED) {
+      server.send(409, "text/plain", "Stop logging first");
+      return;
+    }
+    // Range-check before narrowing into the settings fields
+    long rate = server.hasArg("rate") ? server.arg("rate").toInt() : loggerSettings.rateHz;
+    long pre = server.hasArg("pre") ? server.arg("pre").toInt() : loggerSettings.preTriggerSec;
+    long rpmStart = server.hasArg("rpm") ? server.arg("rpm").toInt() : loggerSettings.rpmStart;
+    long tpsStart = server.hasArg("tps") ? server.arg("tps").toInt() : loggerSettings.tpsStart;
+    LoggerSettings settings = {(uint8_t)rate, (uint8_t)pre, (uint16_t)rpmStart, (uint8_t)tpsStart};
+    if (rate < 0 || rate > 255 || pre < 0 || pre > 255 || rpmStart < 0 || rpmStart > 65535 ||
+        tpsStart < 0 || tpsStart > 255 || !validLoggerSettings(settings)) {
+      server.send(400, "text/plain", "Invalid logger settings");
+      return;
+    }
+    loggerSettings = settings;
+    loggerApplySettings();
+    configMarkDirty(CONFIG_RECORD_LOGGER);
+    server.send(200, "text/plain", "Logger settings saved");
+    Serial.printf("Logger: %u Hz, %u s pre-trigger, start at %u rpm / %u%% TPS\n",
+                  settings.rateHz, settings.preTriggerSec, settings.rpmStart, settings.tpsStart);
+  });
+  
+  // Export a log as MegaLogViewer .mlg: n=<log number>, t=<unix time for
+  // the header>. Encoded MLG_STREAM_RECORDS at a time straight from the
+  // file, so only two small buffers are ever held.
+  route("/log.mlg", HTTP_GET, [&]() {
+    static LogRecord records[MLG_STREAM_RECORDS];
+    static uint8_t out[MLG_STREAM_RECORDS * MLG_BLOCK_SIZE];
+    uint32_t number = server.arg("n").toInt();
+    LoggerStatus status;
+    getLoggerStatus(status);
+    if (status.state != LOGGER_ARMED && number == status.fileNumber) {
+      server.send(409, "text/plain", "Log is still being written");
+      return;
+    }
+    LogFileHeader header;
+    uint32_t remaining;
+    if (!openLogForRead(number, header, remaining)) {
+      server.send(404, "text/plain", "No such log");
+      return;
+    }
+    char info[64];
+    snprintf(info, sizeof(info), "MAZDUINO Display log %u, %u Hz", (unsigned)number, header.rateHz);
+    size_t headerSize = mlgWriteHeader(out, sizeof(out), server.arg("t").toInt(), info);
+    if (headerSize == 0) {
+      closeLogForRead();
+      server.send(500, "text/plain", "Header too large");
+      return;
+    }
+    char disposition[48];
+    snprintf(disposition, sizeof(disposition), "attachment; filename=\"log%05u.mlg\"", (unsigned)number);
+    // The size is known up front, so the browser can show progress
+    server.setContentLength(headerSize + remaining * MLG_BLOCK_SIZE);
+    server.sendHeader("Content-Disposition", disposition);
+    server.send(200, "application/octet-stream", "");
+    server.sendContent((const char *)out, headerSize);
+    uint8_t counter = 0;
+    while (remaining > 0) {
+      size_t count = readLogRecords(records, remaining < MLG_STREAM_RECORDS ? remaining : MLG_STREAM_RECORDS);
+      if (count == 0) {
+        // The file came up short of the Content-Length already sent; drop
+        // the connection so the browser reports a failed download instead
+        // of waiting for bytes that never come
+        Serial.printf("Log %u export truncated, %u records missing\n", (unsigned)number, (unsigned)remaining);
+        server.client().stop();
+        break;
+      }
+      size_t length = 0;
+      for (size_t i = 0; i < count; i++) {
+        length += mlgWriteBlock(out + length, records[i], header.startMs, counter++);
+      }
+      server.sendContent((const char *)out, length);
+      remaining -= count;
+    }
+    closeLogForRead();
+  });
+  
+  route("/canspeed", HTTP_GET, handleCanSpeed);
+  route("/canspeed", HTTP_POST, handleCanSpeed);
   
   // Splash screen configuration handler
-  server.on("/splash", HTTP_GET, [&]() {
+  route("/splash", HTTP_GET, [&]() {
     char buf[16];
     snprintf(buf, sizeof(buf), "%d", getSplashScreenSelection());
     server.send(200, "text/plain", buf);
   });
   
-  server.on("/splash", HTTP_POST, [&]() {
+  route("/splash", HTTP_POST, [&]() {
     if (server.hasArg("splash")) {
       int splash = server.arg("splash").toInt();
       if (splash >= 0 && splash <= 3) { // SPLASH_MAZDUINO, SPLASH_MERCY, SPLASH_HEDON, SPLASH_BIIES
@@ -904,7 +728,11 @@ void startWebServer()
     }
   });
   
+  // WebServer only keeps request headers it was asked for
+  static const char *collectedHeaders[] = {"If-None-Match"};
+  server.collectHeaders(collectedHeaders, 1);
   server.begin();
+  startTelemetry();
   wifiActive = true;
   Serial.println("Web server aktif.");
   Serial.printf("WiFi AP: %s\n", ssid);
@@ -918,6 +746,7 @@ void stopWebServer()
 {
   if (wifiActive) {
     Serial.println("Stopping WiFi and Web Server to save power...");
+    stopTelemetry();
     server.stop();
     WiFi.mode(WIFI_OFF);
     
@@ -929,48 +758,48 @@ void stopWebServer()
   }
 }
 
+// Called from loop() (serial 'w'); the web task does the actual restart
 void restartWebServer()
 {
-  if (!wifiActive) {
-    Serial.println("Restarting WiFi and Web Server...");
-    startWebServer();
-  }
+  webRestartRequested = true;
 }
 
+// The page is served gzipped with a content-hash ETag. Browsers revalidate
+// on every load and get a header-only 304 until the firmware changes it.
 void handleRoot()
 {
-  server.send(200, "text/html", uploadPage);
+  server.sendHeader("ETag", WEB_UI_ETAG);
+  server.sendHeader("Cache-Control", "no-cache");
+  if (server.header("If-None-Match") == WEB_UI_ETAG) {
+    server.send(304);
+    return;
+  }
+  server.sendHeader("Content-Encoding", "gzip");
+  server.send_P(200, "text/html", (const char *)webUiGz, WEB_UI_GZ_LEN);
 }
 
 void handleUpdate()
 {
   HTTPUpload &upload = server.upload();
 
+  // POST /update?sha256=<hex>: the hash rides in the query string, which is
+  // parsed before the multipart body starts streaming
   if (upload.status == UPLOAD_FILE_START)
   {
     Serial.printf("Memulai update: %s\n", upload.filename.c_str());
-    if (!Update.begin(UPDATE_SIZE_UNKNOWN))
-    {
-      Update.printError(Serial);
-    }
+    otaBegin(server.arg("sha256").c_str());
   }
   else if (upload.status == UPLOAD_FILE_WRITE)
   {
-    if (Update.write(upload.buf, upload.currentSize) != upload.currentSize)
-    {
-      Update.printError(Serial);
-    }
+    otaWrite(upload.buf, upload.currentSize);
   }
   else if (upload.status == UPLOAD_FILE_END)
   {
-    if (Update.end(true))
-    {
-      // Update successful
-    }
-    else
-    {
-      Update.printError(Serial);
-    }
+    otaEnd();
+  }
+  else if (upload.status == UPLOAD_FILE_ABORTED)
+  {
+    otaAbort();
   }
 }
 
@@ -978,7 +807,7 @@ void handleToggle()
 {
   if (server.method() == HTTP_POST)
   {
-    bool toggleState = EEPROM.read(0) || false;
+    bool toggleState = systemSettings.displayToggle;
     String body = server.arg("plain");
     if (body == "on")
     {
@@ -990,12 +819,11 @@ void handleToggle()
       toggleState = 0;
       Serial.println("Toggle: OFF");
     }
-    EEPROM.write(0, toggleState);
-    EEPROM.commit();
+    systemSettings.displayToggle = toggleState;
+    configMarkDirty(CONFIG_RECORD_SYSTEM);
 
     server.send(200, "text/plain", "OK");
-    delay(1000);
-    ESP.restart();
+    scheduleRestart();
   }
 }
 
@@ -1072,9 +900,15 @@ void handleWebServerClients()
     }
   }
 
-  // Handle client requests only if WiFi is active
+  // Handle client requests only if WiFi is active. Passes that served a
+  // request are recorded as that request's latency.
   if (wifiActive)
   {
+    requestServed = false;
+    uint32_t start = (uint32_t)esp_timer_get_time();
     server.handleClient();
+    if (requestServed && profilerEnabled) {
+      profilerRecord(PROF_WEB, (uint32_t)esp_timer_get_time() - start);
+    }
   }
 }
@@ -0,0 +1,460 @@
+// Control page, gzip of the minified web/index.html
+// Generated by tools/build_web.py - do not edit
+#ifndef WEB_UI_H
+#define WEB_UI_H
+
+#include <Arduino.h>
+
+// 38785 bytes source, 28535 minified, 7114 gzipped
+#define WEB_UI_GZ_LEN 7114
+#define WEB_UI_ETAG "\"0a66a84b649ed039\""
+
+static const uint8_t webUiGz[WEB_UI_GZ_LEN] PROGMEM = {
+	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x5d, 0xfd, 0x72, 0xdb, 0x48,
+	0x72, 0xff, 0x9f, 0x4f, 0x31, 0xc7, 0xd4, 0x9a, 0xe0, 0x9a, 0x82, 0x08, 0x8a, 0xa2, 0x25, 0x51,
+	0xa2, 0x23, 0x4b, 0xd6, 0x59, 0x39, 0xcb, 0x56, 0x89, 0x92, 0xb7, 0x2e, 0x8a, 0x93, 0x1a, 0x02,
+	0x43, 0x12, 0x27, 0x10, 0x40, 0x01, 0xa0, 0x3e, 0x76, 0xd7, 0xa9, 0x3c, 0x4b, 0x1e, 0x2d, 0x4f,
+	0x92, 0xee, 0x9e, 0x19, 0x7c, 0x92, 0x14, 0x25, 0xef, 0x26, 0xe5, 0x2a, 0xdd, 0x9e, 0x4d, 0x60,
+	0xd0, 0xdd, 0xd3, 0xd3, 0xf3, 0x9b, 0x9e, 0x9e, 0x4f, 0xef, 0xff, 0xe5, 0xf8, 0xf3, 0xd1, 0xe5,
+	0xdf, 0xcf, 0xdf, 0xb3, 0x69, 0x32, 0xf3, 0x06, 0xb5, 0x7d, 0xfd, 0x23, 0xb8, 0x03, 0x3f, 0x89,
+	0x9b, 0x78, 0x62, 0x70, 0x76, 0xf8, 0xaf, 0xc7, 0x57, 0xa7, 0x9f, 0x3e, 0xb3, 0x63, 0x37, 0x0e,
+	0x3d, 0xfe, 0xc0, 0x8e, 0x02, 0x3f, 0x89, 0x02, 0x6f, 0x7f, 0x53, 0x7e, 0xaf, 0xed, 0xcf, 0x44,
+	0xc2, 0x99, 0xcf, 0x67, 0xe2, 0xa0, 0x7e, 0xeb, 0x8a, 0xbb, 0x30, 0x88, 0x92, 0x3a, 0xb3, 0x81,
+	0x4a, 0xf8, 0xc9, 0x41, 0xfd, 0xce, 0x75, 0x92, 0xe9, 0x81, 0x23, 0x6e, 0x5d, 0x5b, 0x6c, 0xd0,
+	0x4b, 0x8b, 0xb9, 0xbe, 0x9b, 0xb8, 0xdc, 0xdb, 0x88, 0x6d, 0xee, 0x89, 0x03, 0xcb, 0x6c, 0xd7,
+	0x41, 0x4c, 0x9c, 0x3c, 0xa0, 0xb8, 0x51, 0xe0, 0x3c, 0xb0, 0xdf, 0x6a, 0x63, 0xe0, 0xdf, 0x18,
+	0xf3, 0x99, 0xeb, 0x3d, 0xec, 0xb1, 0xc3, 0x08, 0xa8, 0x5b, 0x2c, 0xe6, 0x7e, 0xbc, 0x11, 0x8b,
+	0xc8, 0x1d, 0xf7, 0x6b, 0x33, 0x1e, 0x4d, 0x5c, 0x7f, 0x8f, 0xb5, 0xfb, 0xb5, 0x90, 0x3b, 0x8e,
+	0xeb, 0x4f, 0xf6, 0x58, 0xa7, 0x1d, 0xde, 0xf7, 0x6b, 0x23, 0x6e, 0xdf, 0x4c, 0xa2, 0x60, 0xee,
+	0x3b, 0x1b, 0x76, 0xe0, 0x05, 0xd1, 0x1e, 0xfb, 0x27, 0x8b, 0xe3, 0x7f, 0xfd, 0x9a, 0x7e, 0x1f,
+	0xd3, 0xff, 0xfa, 0xb5, 0x6f, 0x35, 0x13, 0xf5, 0xe4, 0xae, 0x2f, 0x22, 0xc8, 0x73, 0xc6, 0xef,
+	0xa5, 0x86, 0x7b, 0xac, 0xd7, 0x26, 0x59, 0x69, 0x2e, 0x8c, 0xcf, 0x93, 0x00, 0x19, 0xa6, 0x56,
+	0x8b, 0x4d, 0x3b, 0x40, 0xac, 0x65, 0x75, 0x8f, 0x0e, 0x4f, 0xb6, 0x41, 0x8b, 0x44, 0xdc, 0x27,
+	0x1b, 0xdc, 0x73, 0x27, 0x40, 0x6e, 0x43, 0xc9, 0x45, 0x24, 0xc9, 0x81, 0x74, 0x14, 0x44, 0x8e,
+	0x88, 0x36, 0x46, 0x41, 0x92, 0x04, 0x33, 0x50, 0x33, 0xbc, 0x67, 0x71, 0xe0, 0xb9, 0x4e, 0xc6,
+	0xac, 0x8a, 0x90, 0x92, 0x58, 0xb9, 0xdc, 0xd3, 0xc4, 0x2d, 0x4a, 0x04, 0x99, 0x1d, 0x6d, 0x9f,
+	0xd8, 0xfd, 0x55, 0x00, 0xf1, 0xce, 0x02, 0x62, 0x6b, 0x5b, 0x12, 0x9b, 0xb1, 0xb0, 0x13, 0x37,
+	0xf0, 0x51, 0x8d, 0xaa, 0x61, 0x3a, 0x1c, 0xff, 0xab, 0x98, 0x50, 0x17, 0x1b, 0xdf, 0xd0, 0xc2,
+	0xaa, 0x00, 0x11, 0x77, 0xdc, 0x79, 0xbc, 0xc7, 0x28, 0x3f, 0x99, 0x06, 0x19, 0xe5, 0x4a, 0xd3,
+	0xed, 0xa6, 0xb4, 0x9e, 0x18, 0x27, 0x7b, 0xac, 0x5b, 0x2d, 0x2a, 0xa8, 0x34, 0x4a, 0x50, 0x9d,
+	0x34, 0x4f, 0x0b, 0x0d, 0xd2, 0xe9, 0xa2, 0xd0, 0x7c, 0xa9, 0x7a, 0x4b, 0x2a, 0x53, 0x0b, 0x52,
+	0xef, 0x77, 0x53, 0x37, 0x11, 0x99, 0x3a, 0x7e, 0xe0, 0x8b, 0x8a, 0xc2, 0x64, 0x0b, 0x7b, 0x1e,
+	0xc5, 0xc8, 0x10, 0x06, 0xae, 0xac, 0x1d, 0x5d, 0x4a, 0xfa, 0xaa, 0xea, 0xdd, 0x6a, 0xb7, 0x7f,
+	0x82, 0xba, 0x8c, 0x00, 0x69, 0x2e, 0x9a, 0x6d, 0x8f, 0x95, 0x35, 0x60, 0x6d, 0x73, 0x2b, 0xd6,
+	0xc5, 0xd8, 0x9b, 0x06, 0xb7, 0x04, 0x9d, 0x45, 0x7a, 0x6e, 0xf3, 0x76, 0x77, 0x57, 0x53, 0x9a,
+	0x0e, 0xf7, 0x27, 0xcb, 0x48, 0xc7, 0xdd, 0xee, 0xd6, 0x56, 0xaf, 0x44, 0xba, 0x4a, 0xb6, 0xc3,
+	0xad, 0xdd, 0xf6, 0x88, 0x18, 0x92, 0x60, 0x32, 0xf1, 0xc4, 0x06, 0xf2, 0x05, 0xe3, 0xf1, 0x62,
+	0xf2, 0x93, 0x93, 0xde, 0xbb, 0xde, 0xbb, 0x0a, 0xf9, 0x12, 0x50, 0x74, 0xdf, 0x1f, 0x1d, 0x1f,
+	0x75, 0x25, 0x78, 0x12, 0x9e, 0xcc, 0xe3, 0xc5, 0x64, 0x5b, 0x5b, 0x5b, 0x39, 0xe0, 0x48, 0xc4,
+	0x2e, 0xb2, 0xbb, 0x36, 0xb3, 0xa5, 0xc0, 0x04, 0x62, 0xc7, 0x2e, 0xa8, 0xe0, 0xfa, 0xe1, 0x3c,
+	0x01, 0xd1, 0x05, 0xcb, 0x97, 0xe5, 0x2d, 0xd0, 0x2e, 0x03, 0x59, 0x01, 0x7c, 0xbd, 0x5e, 0x6f,
+	0x49, 0xbd, 0x17, 0x70, 0xb2, 0x40, 0x9b, 0x49, 0x04, 0xfc, 0xbf, 0xd5, 0x1c, 0xe9, 0xdf, 0xf6,
+	0x18, 0xbe, 0xf7, 0x6b, 0xf8, 0xf7, 0x46, 0x22, 0x66, 0x90, 0x96, 0x08, 0xcc, 0x7d, 0x3e, 0xf3,
+	0x41, 0xa4, 0x35, 0x8e, 0xf0, 0x0f, 0x7c, 0xe7, 0xa1, 0xd6, 0x52, 0xba, 0x91, 0xb1, 0x3b, 0xd9,
+	0xf8, 0x1e, 0x51, 0x45, 0x63, 0x6d, 0xa7, 0xea, 0x29, 0xd1, 0xa0, 0xfd, 0x2c, 0x2f, 0x7a, 0xec,
+	0x09, 0x6c, 0x30, 0xf0, 0xf7, 0x86, 0xe3, 0x46, 0xb2, 0x91, 0x83, 0xe7, 0x21, 0xe1, 0x15, 0x3e,
+	0x8f, 0x8f, 0x84, 0xa7, 0xbd, 0xc6, 0x9d, 0x70, 0x27, 0x53, 0x68, 0x9c, 0xa3, 0xc0, 0x73, 0x2a,
+	0x7e, 0x23, 0x6f, 0xb2, 0x7c, 0x9b, 0xcd, 0x4b, 0x8b, 0x85, 0x07, 0xf9, 0xb5, 0x58, 0x21, 0x51,
+	0x57, 0x67, 0x5a, 0x83, 0x3b, 0x7f, 0x40, 0x05, 0x76, 0xab, 0x15, 0x08, 0xba, 0xb8, 0xbe, 0xe3,
+	0xda, 0x3c, 0x09, 0xa2, 0xa7, 0xd9, 0x3b, 0x12, 0xa1, 0xe0, 0x89, 0xd1, 0x6d, 0xa1, 0xd5, 0x9b,
+	0x85, 0x1a, 0x5c, 0x60, 0xf6, 0x52, 0x26, 0xda, 0x82, 0x25, 0xfb, 0x93, 0xc3, 0x27, 0x03, 0xc4,
+	0x99, 0xdb, 0x27, 0xc1, 0x3b, 0x65, 0x7f, 0xd6, 0x55, 0x50, 0x29, 0x09, 0x26, 0xbb, 0x5d, 0x27,
+	0x0f, 0x21, 0x74, 0x9f, 0xf6, 0x54, 0xd8, 0x37, 0xa3, 0xe0, 0xbe, 0xfe, 0x35, 0xd7, 0x2e, 0xc8,
+	0x0f, 0x4e, 0x55, 0x9d, 0xc9, 0xb7, 0xac, 0x3e, 0x6c, 0xd9, 0x19, 0xc7, 0x55, 0xcd, 0x16, 0x94,
+	0xae, 0xd3, 0x2e, 0x83, 0x2a, 0x65, 0x57, 0x3e, 0x19, 0x59, 0x81, 0x8b, 0x7a, 0x99, 0xad, 0x05,
+	0x9d, 0x5c, 0xc5, 0x3f, 0x17, 0x45, 0xa7, 0xad, 0xaa, 0xd4, 0xe3, 0x95, 0xfb, 0x88, 0x72, 0x77,
+	0xa7, 0xfa, 0xaa, 0x7f, 0x9e, 0x09, 0xc7, 0xe5, 0xcc, 0x28, 0xf7, 0xc3, 0x4d, 0xd0, 0x44, 0xb7,
+	0xd2, 0xe5, 0x6d, 0x69, 0x41, 0x3b, 0x7c, 0x84, 0xb8, 0x82, 0xa3, 0xd5, 0xc0, 0xe9, 0x68, 0xe0,
+	0x7c, 0x83, 0xff, 0xf6, 0x37, 0x55, 0xbc, 0xb2, 0x1f, 0xdb, 0x91, 0x1b, 0x26, 0x83, 0xda, 0x78,
+	0xee, 0xcb, 0x9e, 0x56, 0xba, 0x58, 0x15, 0x2e, 0x19, 0xa3, 0x39, 0x94, 0xd1, 0x6f, 0x92, 0x31,
+	0xfd, 0x38, 0x61, 0x6e, 0x7c, 0x34, 0x8f, 0x22, 0x40, 0x8a, 0xf7, 0xf0, 0x19, 0xfc, 0xf5, 0x01,
+	0x93, 0x04, 0xa6, 0xed, 0xf1, 0x38, 0xfe, 0xe8, 0xc6, 0x89, 0x0e, 0x49, 0x62, 0xa3, 0x01, 0x0e,
+	0xbd, 0x01, 0xf9, 0xb9, 0x63, 0x66, 0x14, 0xd9, 0x50, 0x5c, 0x85, 0x2f, 0x12, 0x33, 0xe8, 0x31,
+	0x52, 0xae, 0xca, 0x77, 0x30, 0x3a, 0x7c, 0xf4, 0x73, 0xdf, 0x30, 0x66, 0x39, 0x92, 0x81, 0x1a,
+	0x28, 0x52, 0xd7, 0x11, 0xde, 0x59, 0xe0, 0x40, 0x05, 0xbf, 0x3f, 0xba, 0x62, 0xc7, 0x3c, 0xe1,
+	0x75, 0xa8, 0x76, 0x91, 0xd8, 0x53, 0xa3, 0xb1, 0x29, 0x4b, 0xd6, 0x68, 0xb1, 0xdf, 0x18, 0x04,
+	0x7d, 0xd3, 0xc0, 0xd9, 0x63, 0x8d, 0xf3, 0xcf, 0xc3, 0x4b, 0x48, 0xc1, 0xb0, 0x0d, 0xde, 0x40,
+	0x3c, 0xfb, 0x86, 0x26, 0x62, 0xc2, 0x8b, 0xc5, 0x4a, 0x2d, 0xfd, 0x15, 0x4a, 0x16, 0x4a, 0xb0,
+	0x52, 0xcb, 0xcb, 0xc8, 0x9d, 0x60, 0xbf, 0xfa, 0x3e, 0x8a, 0x82, 0xe8, 0x69, 0xaa, 0x42, 0x26,
+	0x52, 0x57, 0xf8, 0x2f, 0xad, 0xbc, 0x58, 0x40, 0x5e, 0xb3, 0x19, 0x0a, 0x37, 0x66, 0xf0, 0x17,
+	0x5a, 0x1a, 0xed, 0x4f, 0xc0, 0x8a, 0x66, 0x46, 0xe3, 0x72, 0xea, 0xc6, 0xec, 0xce, 0xf5, 0x3c,
+	0x80, 0x05, 0x74, 0x8f, 0x51, 0xc2, 0x92, 0xa9, 0x60, 0x32, 0xbe, 0x35, 0x29, 0x38, 0x76, 0xfd,
+	0xb9, 0x78, 0xdb, 0x68, 0x22, 0xa7, 0xd6, 0x06, 0xa4, 0xa2, 0x44, 0x54, 0xa7, 0x56, 0x52, 0xa7,
+	0x86, 0xd1, 0xb6, 0x88, 0x00, 0x66, 0xbf, 0x35, 0x54, 0x29, 0x37, 0x2e, 0xc1, 0x1b, 0x34, 0x80,
+	0x82, 0x87, 0xa1, 0x87, 0x08, 0x05, 0xc5, 0x36, 0xa1, 0x49, 0xdc, 0xdd, 0x6d, 0x8c, 0x83, 0x68,
+	0xb6, 0x31, 0x8f, 0x3c, 0xe1, 0xdb, 0x20, 0xcf, 0x69, 0x7c, 0x6b, 0xd5, 0x54, 0x71, 0x50, 0xd9,
+	0x83, 0x06, 0x7b, 0xcd, 0xf0, 0xa1, 0x56, 0x29, 0x97, 0x02, 0xa5, 0x18, 0xcd, 0x27, 0x46, 0x5e,
+	0x33, 0x07, 0x53, 0xfe, 0x4c, 0xbd, 0x64, 0xc6, 0x07, 0x56, 0x03, 0x74, 0x82, 0xf0, 0x63, 0x2a,
+	0x7c, 0x03, 0x0c, 0x17, 0x42, 0x5b, 0x10, 0xec, 0x60, 0xc0, 0xf4, 0x33, 0xd5, 0xb2, 0xd1, 0xd4,
+	0x24, 0x0e, 0x00, 0x0f, 0x3f, 0xff, 0x06, 0x1e, 0x56, 0x44, 0x89, 0xd1, 0x20, 0xcd, 0xa9, 0x6c,
+	0x20, 0x13, 0x4a, 0x89, 0x04, 0x58, 0x46, 0x2a, 0x67, 0xbe, 0xf6, 0x86, 0xee, 0x6c, 0xee, 0x61,
+	0xa3, 0x4e, 0xab, 0x2f, 0xad, 0x04, 0xfd, 0xe5, 0xff, 0xb2, 0x1a, 0xbe, 0xa3, 0xc8, 0x69, 0x49,
+	0x56, 0x95, 0x38, 0x12, 0x63, 0x90, 0x37, 0x1d, 0x52, 0xa0, 0x56, 0xa8, 0x59, 0x19, 0xbb, 0x35,
+	0x56, 0x6a, 0xf0, 0x8f, 0x38, 0xf0, 0x17, 0x69, 0x20, 0x5d, 0xd5, 0x3c, 0x4c, 0xdc, 0x19, 0x30,
+	0xb0, 0x33, 0x9e, 0x4c, 0xcd, 0xb1, 0x17, 0x80, 0x51, 0x91, 0xc6, 0x94, 0x1f, 0x9a, 0x7d, 0x45,
+	0x67, 0x43, 0x83, 0x39, 0xa2, 0xd8, 0xf8, 0x80, 0xb4, 0x34, 0x6d, 0xd5, 0x82, 0xd8, 0xc1, 0xc1,
+	0x01, 0x6b, 0x1c, 0x1d, 0x7e, 0x62, 0xef, 0x40, 0x13, 0xf6, 0x96, 0x35, 0x54, 0x4f, 0xd2, 0x60,
+	0x50, 0x26, 0x08, 0x4b, 0x77, 0x77, 0xda, 0xed, 0x46, 0xbf, 0xe6, 0x04, 0xf6, 0x7c, 0x06, 0x16,
+	0x37, 0x27, 0x22, 0x79, 0xef, 0x09, 0x7c, 0x7c, 0xf7, 0x70, 0x0a, 0x8e, 0x40, 0x97, 0x01, 0x5c,
+	0x35, 0x0c, 0xd1, 0x3e, 0x5c, 0x9e, 0x7d, 0x64, 0x07, 0xb5, 0x86, 0x2c, 0xec, 0x1e, 0x36, 0x36,
+	0x1f, 0x02, 0x11, 0xe1, 0xec, 0x8f, 0xa2, 0x01, 0x98, 0xa8, 0xd6, 0xf8, 0xc5, 0x3d, 0x71, 0x61,
+	0xb8, 0x08, 0xa6, 0xb9, 0x15, 0x69, 0x22, 0xb6, 0xe7, 0xb9, 0xaf, 0x2a, 0x70, 0x8f, 0xed, 0xc7,
+	0x21, 0x07, 0xa4, 0xa0, 0xf7, 0x86, 0x1e, 0x57, 0x76, 0x70, 0x68, 0xdf, 0xac, 0x14, 0xaf, 0x59,
+	0xa3, 0xcf, 0xaa, 0xa1, 0x52, 0x7d, 0xa0, 0xab, 0x21, 0x2b, 0x20, 0x90, 0x92, 0x23, 0x82, 0xee,
+	0x00, 0xa4, 0x0e, 0xd2, 0x3c, 0x25, 0x5c, 0xcf, 0x52, 0xb8, 0x4a, 0xbb, 0x51, 0x63, 0x23, 0x3e,
+	0x30, 0xc5, 0xe7, 0x4f, 0x64, 0x85, 0xcf, 0x27, 0x27, 0x8d, 0x26, 0xca, 0x49, 0x79, 0x73, 0xf5,
+	0x4e, 0xb4, 0x69, 0xae, 0x29, 0x80, 0x75, 0xd6, 0x29, 0xcb, 0x15, 0x55, 0x88, 0xcc, 0x4a, 0xd5,
+	0x1a, 0x6a, 0x06, 0x63, 0xbf, 0xc0, 0x77, 0xe2, 0x94, 0xec, 0x24, 0x12, 0x82, 0x9d, 0x81, 0x03,
+	0x8e, 0x1e, 0x24, 0x2d, 0x55, 0x2c, 0x85, 0x67, 0x52, 0x41, 0xc0, 0x92, 0xf8, 0x20, 0x78, 0xc8,
+	0x36, 0xa1, 0x2b, 0xef, 0x74, 0x49, 0xaf, 0xbf, 0xbd, 0x6b, 0xf4, 0x09, 0xc8, 0x60, 0x40, 0x00,
+	0x96, 0x40, 0x47, 0x9b, 0xa1, 0x24, 0xf0, 0x84, 0x49, 0x49, 0x46, 0x83, 0x5c, 0x30, 0x23, 0xf8,
+	0x41, 0xe7, 0xce, 0x64, 0xdd, 0xed, 0x41, 0x63, 0xa3, 0xef, 0x29, 0x74, 0x15, 0x66, 0xa6, 0x1c,
+	0x2a, 0xcf, 0xfb, 0xc4, 0x67, 0x22, 0x06, 0xd8, 0x5c, 0x37, 0x4e, 0x0f, 0xd1, 0x37, 0x43, 0x65,
+	0x05, 0x1e, 0xf7, 0x13, 0x7c, 0x3c, 0x3c, 0xb9, 0xa0, 0x9f, 0xe3, 0x2f, 0xf8, 0xa3, 0x1c, 0x3d,
+	0x3d, 0x9e, 0x0f, 0xf1, 0xe7, 0x4b, 0xe0, 0x25, 0x7c, 0x82, 0x4e, 0xb5, 0x71, 0x76, 0x78, 0x8e,
+	0x3f, 0x17, 0xe7, 0x67, 0xf8, 0x73, 0x42, 0x2f, 0x5f, 0x86, 0xc3, 0xc6, 0xd7, 0x7e, 0xd6, 0x52,
+	0xa0, 0x7e, 0x84, 0xf7, 0x11, 0x86, 0xfa, 0x46, 0x18, 0xc8, 0xc1, 0x5d, 0xd6, 0x29, 0xdf, 0x72,
+	0x6f, 0x8e, 0x40, 0x5f, 0x0a, 0x44, 0x62, 0x46, 0x8b, 0xa5, 0xbc, 0x26, 0xf1, 0xc8, 0xce, 0x59,
+	0xb1, 0x03, 0xd6, 0x21, 0x08, 0xe3, 0x23, 0x0f, 0x3c, 0x02, 0xca, 0x8e, 0x44, 0x32, 0x8f, 0x7c,
+	0x26, 0x99, 0x59, 0x9e, 0x9b, 0x6a, 0x07, 0xc2, 0x25, 0xf8, 0xd3, 0x66, 0x58, 0xf2, 0xcc, 0x30,
+	0x37, 0x10, 0x95, 0x80, 0x26, 0x24, 0xf2, 0xba, 0xfd, 0x95, 0xa4, 0x4e, 0xb0, 0xed, 0x74, 0x01,
+	0x2d, 0x46, 0x21, 0x99, 0x63, 0xf2, 0x36, 0x24, 0x6f, 0x58, 0x69, 0x5b, 0x8c, 0x83, 0x79, 0x64,
+	0x63, 0x51, 0x42, 0x1e, 0xc5, 0xe2, 0xd4, 0x4f, 0x0c, 0x12, 0xb8, 0x0f, 0xf9, 0xbc, 0x55, 0xc5,
+	0xdc, 0x93, 0xbf, 0x66, 0x3c, 0x1f, 0xc5, 0x49, 0x04, 0x55, 0x65, 0x58, 0xcd, 0x94, 0xdf, 0x11,
+	0xb6, 0x3b, 0xe3, 0x1e, 0xd6, 0x89, 0xa1, 0x65, 0x1d, 0xb0, 0x0e, 0xfb, 0xfd, 0x77, 0x96, 0xbd,
+	0xf6, 0x9a, 0x20, 0xcc, 0x62, 0x34, 0xfb, 0x22, 0xd9, 0x30, 0x7e, 0x05, 0x16, 0xca, 0x6b, 0x70,
+	0x40, 0x99, 0xd1, 0x33, 0xa8, 0x9c, 0x4a, 0x7c, 0x0b, 0xc9, 0x7b, 0xa9, 0xd4, 0xfd, 0x03, 0x90,
+	0xf0, 0x16, 0x24, 0x43, 0x3c, 0x86, 0xd9, 0x2b, 0x63, 0x5d, 0x2b, 0x53, 0xb7, 0x52, 0x5b, 0xb5,
+	0x54, 0xc6, 0x2d, 0xca, 0xa4, 0x95, 0x6a, 0x08, 0xd1, 0x58, 0xab, 0x00, 0xa3, 0x6b, 0x49, 0xf7,
+	0xf5, 0xab, 0xf9, 0x0f, 0x18, 0xe2, 0x1b, 0x0d, 0xd6, 0x28, 0x75, 0x0e, 0xfc, 0x56, 0x47, 0x65,
+	0x47, 0x14, 0x26, 0x1a, 0x19, 0x00, 0x3c, 0xc0, 0x05, 0xe1, 0x10, 0x11, 0x03, 0x28, 0x36, 0x3c,
+	0x01, 0xa1, 0x1a, 0x24, 0xb4, 0xfb, 0xf0, 0xb3, 0xcf, 0x76, 0xe0, 0xe7, 0xf5, 0x6b, 0xa4, 0x27,
+	0x4a, 0x33, 0x9c, 0xc7, 0x53, 0x23, 0x43, 0x94, 0xdb, 0x94, 0x59, 0xad, 0xcb, 0x79, 0xdd, 0x48,
+	0x63, 0x4f, 0x28, 0xa9, 0x4b, 0xff, 0x5f, 0x8a, 0x3d, 0x20, 0x45, 0xec, 0xb8, 0x4d, 0x93, 0xc6,
+	0x07, 0xc2, 0xd1, 0xc6, 0xcf, 0x15, 0x54, 0x66, 0xaf, 0x3c, 0x3f, 0x14, 0x30, 0x98, 0x27, 0xa5,
+	0x5e, 0xee, 0xea, 0x91, 0x4e, 0x0e, 0x3b, 0xa3, 0x4d, 0xb0, 0x8d, 0xeb, 0x67, 0xbd, 0x99, 0xd4,
+	0x58, 0x66, 0xf2, 0x6f, 0x10, 0xaf, 0xad, 0xd5, 0x9f, 0x2d, 0xee, 0xcd, 0x52, 0x0e, 0x33, 0xb8,
+	0x41, 0xef, 0xa7, 0xa3, 0x38, 0x19, 0xb0, 0xcf, 0x23, 0x9e, 0x56, 0x11, 0x6a, 0x8b, 0x8e, 0xf1,
+	0xa8, 0xf0, 0x25, 0x12, 0xff, 0x20, 0x57, 0x0f, 0x1f, 0x9a, 0xf9, 0xce, 0xb0, 0xdc, 0x1b, 0x42,
+	0x04, 0x50, 0xad, 0xe3, 0x42, 0x00, 0x77, 0x81, 0x34, 0xcc, 0x59, 0x98, 0x7f, 0x12, 0x00, 0xbc,
+	0xc6, 0x7c, 0xee, 0x25, 0x6f, 0xd9, 0xca, 0x40, 0xaf, 0x18, 0xde, 0x55, 0xb3, 0x5d, 0x10, 0x62,
+	0x7c, 0x67, 0xfc, 0xb3, 0x50, 0x5f, 0xca, 0xb8, 0x10, 0x1e, 0x78, 0x81, 0xec, 0xe7, 0x20, 0xce,
+	0xf6, 0x02, 0xee, 0x18, 0xa9, 0xdb, 0xcd, 0x59, 0x09, 0x3f, 0x54, 0x8d, 0xa4, 0x0b, 0x33, 0x29,
+	0x17, 0xe5, 0x59, 0x11, 0xc4, 0xea, 0xa6, 0xa0, 0x7c, 0x15, 0xcd, 0x23, 0xac, 0xe5, 0x76, 0x5d,
+	0x35, 0x0c, 0xa2, 0x5e, 0x8a, 0x52, 0xe3, 0x6b, 0xf7, 0x2b, 0x7b, 0xf5, 0x8a, 0x15, 0x53, 0x4c,
+	0xe1, 0x93, 0xff, 0xc5, 0x4c, 0xa4, 0x78, 0x53, 0xfb, 0xf6, 0x12, 0x2f, 0x0c, 0x28, 0x79, 0x38,
+	0x45, 0x28, 0x4e, 0x1a, 0xe4, 0xa6, 0x4a, 0x5f, 0xf9, 0x7c, 0x42, 0xdd, 0x34, 0x27, 0x30, 0x62,
+	0x7d, 0xbf, 0x2e, 0xe7, 0x85, 0xaf, 0x43, 0xf2, 0x39, 0xb9, 0x01, 0x4f, 0x29, 0xd7, 0xac, 0x47,
+	0x50, 0x95, 0xb0, 0x86, 0x5d, 0xf4, 0x34, 0xc0, 0x2a, 0xcb, 0xa4, 0x4e, 0x21, 0x67, 0x97, 0xd4,
+	0xa7, 0xa0, 0x76, 0x24, 0x4e, 0x09, 0x4a, 0x1d, 0x87, 0x8a, 0xcf, 0x0a, 0x84, 0xda, 0x64, 0x52,
+	0xbf, 0x52, 0x78, 0x39, 0x0f, 0x81, 0x41, 0x1c, 0x71, 0x7f, 0x18, 0x0a, 0xe1, 0x18, 0x4f, 0xa9,
+	0x3b, 0x5b, 0x31, 0x0d, 0x89, 0xb2, 0x91, 0xf5, 0x50, 0x98, 0x08, 0x8c, 0x79, 0x43, 0x65, 0xe3,
+	0x36, 0xe0, 0x22, 0x82, 0x3f, 0x33, 0x46, 0xa7, 0x0c, 0x28, 0x48, 0xa7, 0xa7, 0xef, 0x6b, 0x98,
+	0x18, 0xdd, 0xca, 0x22, 0x49, 0x5b, 0x39, 0xb2, 0x39, 0xca, 0x24, 0xec, 0xe6, 0x47, 0x61, 0xdc,
+	0xa8, 0xc6, 0xed, 0xd8, 0x06, 0x0b, 0x66, 0xad, 0x18, 0xe0, 0x09, 0x4a, 0x29, 0x93, 0x0e, 0xbe,
+	0xab, 0x76, 0x10, 0x46, 0x92, 0xaf, 0xc9, 0x4a, 0x20, 0x26, 0xf9, 0xfd, 0xc5, 0xd8, 0x18, 0x82,
+	0xa7, 0x80, 0xf1, 0x87, 0x0d, 0x91, 0xa3, 0xff, 0x24, 0x7c, 0xc4, 0x92, 0xb1, 0x82, 0x0e, 0x4c,
+	0x5d, 0x0a, 0x0f, 0xf9, 0xf9, 0xcf, 0x05, 0x07, 0xe6, 0xa0, 0xd0, 0x81, 0x8f, 0xcf, 0x84, 0x07,
+	0xb6, 0x71, 0x29, 0x00, 0x83, 0x93, 0x7e, 0x2d, 0xbe, 0x73, 0xb1, 0x08, 0x32, 0x89, 0xec, 0xc4,
+	0x41, 0x52, 0xa3, 0x0d, 0xfa, 0x65, 0x64, 0xe8, 0x30, 0xce, 0xf8, 0xaf, 0xce, 0xdc, 0xf5, 0x03,
+	0x18, 0x83, 0x8c, 0x22, 0xc1, 0x6f, 0xfa, 0x8a, 0xd2, 0xaa, 0x52, 0x0a, 0x70, 0x3d, 0x8e, 0x88,
+	0xcb, 0x94, 0x9d, 0x0a, 0xe5, 0x07, 0xe1, 0x04, 0x7e, 0x99, 0x6c, 0xab, 0x42, 0xf6, 0xce, 0x75,
+	0xf3, 0xd2, 0x54, 0x57, 0x58, 0xa6, 0xba, 0xf2, 0x6f, 0xfc, 0xe0, 0x2e, 0x27, 0xee, 0x5b, 0x3a,
+	0x62, 0x95, 0x95, 0x17, 0x13, 0x18, 0xca, 0xed, 0x41, 0x8b, 0x68, 0x2e, 0x01, 0xd2, 0x39, 0xc4,
+	0xf2, 0xc6, 0xd3, 0x3a, 0x87, 0x89, 0xc8, 0xe0, 0xa3, 0x11, 0x12, 0xca, 0x21, 0xc1, 0x9f, 0x86,
+	0x0f, 0x94, 0x2f, 0xd1, 0x91, 0x03, 0xe8, 0x33, 0x31, 0xa2, 0x07, 0x50, 0x5e, 0x30, 0xc9, 0x7a,
+	0x78, 0xcc, 0x00, 0x47, 0x4d, 0x8b, 0xc7, 0xfb, 0xe8, 0x37, 0x52, 0x4b, 0x15, 0xca, 0xfc, 0x04,
+	0x0d, 0x90, 0xfe, 0x69, 0xee, 0xa2, 0x68, 0xeb, 0x15, 0xae, 0x02, 0x09, 0xb5, 0xd2, 0xd8, 0x04,
+	0x46, 0xdc, 0x77, 0x2e, 0xb1, 0x7f, 0x49, 0xa3, 0xeb, 0x34, 0x1c, 0x9f, 0x06, 0x77, 0xef, 0xe0,
+	0x6b, 0x9c, 0xab, 0x74, 0xa4, 0xc6, 0x29, 0xd1, 0x94, 0xe9, 0x7a, 0xa9, 0x46, 0x48, 0x23, 0x3b,
+	0xdf, 0x86, 0x1a, 0x8b, 0x7d, 0x95, 0x8a, 0xfd, 0x05, 0xbf, 0x34, 0x99, 0x1c, 0x4f, 0xac, 0x98,
+	0x5b, 0x40, 0xb2, 0xf7, 0xce, 0x44, 0xc4, 0x9a, 0x5f, 0x65, 0x6c, 0x0a, 0x4c, 0x54, 0x51, 0x6f,
+	0x0b, 0x8b, 0xbb, 0x52, 0xc4, 0x05, 0x54, 0x60, 0x45, 0x44, 0x84, 0x89, 0x6b, 0x8b, 0xf8, 0xf0,
+	0x10, 0x27, 0x02, 0xaa, 0xca, 0xad, 0xc8, 0x99, 0xa6, 0x5f, 0x2a, 0x20, 0xc8, 0x4c, 0xa7, 0x51,
+	0x80, 0x1c, 0x4f, 0x9a, 0xef, 0x21, 0x06, 0x89, 0x83, 0x42, 0x35, 0x51, 0x7a, 0x7f, 0x6d, 0x6c,
+	0xe4, 0x6b, 0x22, 0x8f, 0x0d, 0x33, 0x08, 0x51, 0xdb, 0xd8, 0x84, 0x56, 0x34, 0x49, 0xa6, 0x38,
+	0x70, 0x6c, 0x37, 0x55, 0x5e, 0xb1, 0x09, 0x2d, 0xec, 0x3d, 0x07, 0xbd, 0x65, 0x95, 0x0f, 0x34,
+	0x8e, 0x70, 0xfe, 0xd7, 0x17, 0x77, 0xec, 0x33, 0xf1, 0xd2, 0x57, 0x13, 0xf7, 0x16, 0xb4, 0xa4,
+	0x41, 0xe4, 0x10, 0xaf, 0x29, 0xc3, 0xfe, 0x1c, 0x82, 0xaa, 0x33, 0x81, 0x30, 0x92, 0xa8, 0xa0,
+	0x0b, 0xb7, 0x16, 0x80, 0x03, 0x93, 0x42, 0xa8, 0x11, 0x3f, 0x01, 0x5e, 0x38, 0x81, 0xf2, 0x8a,
+	0xb0, 0x41, 0x9c, 0xd2, 0x33, 0x5c, 0x5d, 0x9c, 0x1e, 0x05, 0x33, 0x30, 0x2e, 0x30, 0x1a, 0xeb,
+	0x43, 0xad, 0x49, 0xc2, 0x08, 0x25, 0xcf, 0x12, 0x56, 0x00, 0x9d, 0x14, 0x96, 0x41, 0xe5, 0xf1,
+	0x82, 0x55, 0x01, 0xd7, 0x2f, 0xa1, 0xe8, 0xcf, 0x73, 0xa0, 0xf8, 0xf7, 0x77, 0x45, 0x5c, 0xe9,
+	0x40, 0x27, 0x6d, 0x03, 0x79, 0x7f, 0xe3, 0xb9, 0xb7, 0x62, 0x18, 0x40, 0xb0, 0x8b, 0x90, 0xf5,
+	0xe7, 0x9e, 0xd7, 0x4f, 0x93, 0xd3, 0xb9, 0xa6, 0xaf, 0x59, 0xda, 0x17, 0x2c, 0x7c, 0x39, 0x71,
+	0x88, 0xdb, 0x52, 0x20, 0xcd, 0x6a, 0xf7, 0xf3, 0x43, 0x4b, 0xee, 0x7c, 0xe1, 0x91, 0x0b, 0x55,
+	0x33, 0x7a, 0x48, 0x44, 0x4c, 0x13, 0x14, 0x4d, 0xd5, 0xd1, 0xeb, 0x46, 0xdb, 0x6e, 0x81, 0x5b,
+	0x73, 0xc7, 0x89, 0x7c, 0x1c, 0x61, 0xbb, 0x47, 0xc0, 0x63, 0x9b, 0x42, 0x9e, 0x6b, 0x60, 0x31,
+	0x21, 0xd4, 0x87, 0xbc, 0x14, 0xa4, 0x60, 0x58, 0x32, 0x62, 0xaf, 0x58, 0xfb, 0xfe, 0xcd, 0xb8,
+	0xc9, 0x7e, 0x96, 0xf3, 0x71, 0x61, 0x70, 0x87, 0x6b, 0x4d, 0x24, 0x08, 0xca, 0x25, 0x05, 0x02,
+	0xe5, 0x1b, 0x1c, 0x65, 0xdc, 0x4d, 0x5d, 0xd0, 0x4d, 0x31, 0xed, 0xb4, 0xb3, 0x89, 0x13, 0x35,
+	0x09, 0xf5, 0x13, 0xeb, 0xe0, 0xe4, 0xcc, 0x86, 0x7a, 0x7d, 0xcd, 0xac, 0x26, 0xdb, 0xa4, 0x59,
+	0x16, 0x99, 0x00, 0xcf, 0xc5, 0x76, 0x02, 0x6d, 0xe8, 0x23, 0x94, 0x99, 0x9a, 0xc9, 0x52, 0xd0,
+	0xa0, 0x55, 0x70, 0x2d, 0xa8, 0x38, 0x13, 0x9b, 0x59, 0xd5, 0x9c, 0xf1, 0xd0, 0x30, 0x64, 0x3b,
+	0x75, 0x9b, 0x50, 0x5b, 0x35, 0x7c, 0xc6, 0xf0, 0x77, 0x8f, 0xed, 0x8f, 0x68, 0xde, 0xd4, 0xc8,
+	0xcc, 0x8d, 0x23, 0xb7, 0xcd, 0xcc, 0xd2, 0x4d, 0x33, 0x09, 0x4e, 0xdc, 0x7b, 0x88, 0x83, 0x2d,
+	0x39, 0x11, 0xba, 0x09, 0x1c, 0x4d, 0xe5, 0x3d, 0x69, 0xee, 0xb2, 0x32, 0xc9, 0x8f, 0x1a, 0x5f,
+	0x40, 0xcc, 0x90, 0x8e, 0xee, 0x73, 0xd5, 0x0e, 0x63, 0xc2, 0xec, 0xcd, 0xc4, 0x6a, 0x7b, 0xc0,
+	0x09, 0x63, 0x9a, 0xb8, 0xb2, 0xe4, 0x3c, 0x4c, 0xfa, 0x35, 0x16, 0x3e, 0x94, 0x0e, 0x06, 0xd3,
+	0x8f, 0x78, 0x03, 0x4f, 0xe5, 0x97, 0x36, 0xb9, 0x85, 0xab, 0x2b, 0xa9, 0x1d, 0x8b, 0x1a, 0x95,
+	0xf2, 0xb4, 0xbd, 0x20, 0x16, 0x08, 0xda, 0x05, 0x50, 0xd5, 0x9d, 0xd6, 0xb7, 0xd2, 0x47, 0x70,
+	0x88, 0xbf, 0x88, 0x91, 0x7c, 0x37, 0x1a, 0x77, 0xf1, 0xde, 0xe6, 0x26, 0xea, 0x9b, 0x0e, 0xf6,
+	0xa7, 0x41, 0x9c, 0xa4, 0x16, 0xdf, 0xb1, 0x36, 0x1b, 0x05, 0xf1, 0xe6, 0xc8, 0xf5, 0x79, 0xf4,
+	0x70, 0x29, 0xe7, 0xe8, 0x1a, 0x3c, 0x8a, 0xf8, 0xc3, 0x68, 0x3e, 0x1e, 0x8b, 0xa8, 0x51, 0x20,
+	0x0b, 0xfc, 0x20, 0x84, 0xb8, 0xed, 0x20, 0x6f, 0xe1, 0x12, 0x01, 0x29, 0x8f, 0x83, 0xe9, 0x26,
+	0x35, 0xc9, 0x05, 0xcd, 0x8d, 0x7d, 0x2b, 0xb1, 0x00, 0x3c, 0x62, 0x8a, 0x37, 0x98, 0xb8, 0xa5,
+	0x25, 0xbc, 0x81, 0xb2, 0x10, 0x4e, 0xe7, 0x05, 0x63, 0x99, 0x6a, 0xca, 0x56, 0x8e, 0xce, 0x99,
+	0xa6, 0x24, 0x1b, 0x99, 0xd7, 0x9e, 0x0a, 0xcf, 0x0b, 0x80, 0xfb, 0x5f, 0x86, 0x9f, 0x3f, 0x99,
+	0x34, 0xab, 0x69, 0x64, 0x2c, 0xaa, 0x9c, 0xba, 0x69, 0x13, 0xad, 0xa9, 0x26, 0x05, 0x63, 0xa5,
+	0x88, 0x6a, 0xcd, 0x69, 0xdb, 0xb2, 0xa0, 0x69, 0x4a, 0x42, 0x3d, 0x95, 0xa8, 0xa4, 0xa4, 0xce,
+	0xa0, 0x84, 0x6b, 0x2a, 0x6b, 0xd6, 0xd4, 0xb2, 0xb9, 0x5a, 0x6a, 0xd4, 0xaa, 0x7e, 0xae, 0xc0,
+	0x33, 0xec, 0x1c, 0xa2, 0x69, 0x8b, 0xea, 0x49, 0xca, 0x19, 0x8f, 0x6f, 0x52, 0x2f, 0xd0, 0xf9,
+	0xca, 0x7e, 0x67, 0xd2, 0x8b, 0x5c, 0x6f, 0x7d, 0x65, 0xfb, 0xfb, 0x6c, 0x27, 0x25, 0xbc, 0x11,
+	0x0f, 0xe3, 0x48, 0x06, 0xda, 0x92, 0x40, 0xce, 0xf5, 0xa6, 0x13, 0xad, 0xe0, 0x41, 0xe0, 0xd3,
+	0x6f, 0xee, 0x1e, 0xeb, 0x7e, 0xcb, 0x4d, 0x55, 0xda, 0x53, 0x39, 0x9d, 0x00, 0xbf, 0xfb, 0x39,
+	0xf5, 0x65, 0xcf, 0x8b, 0xc9, 0x72, 0x7e, 0x01, 0xcd, 0x4e, 0xaa, 0xbc, 0x62, 0x86, 0x85, 0x19,
+	0xdb, 0xd3, 0x66, 0x6e, 0x16, 0x1c, 0x64, 0x2c, 0x76, 0x73, 0x79, 0xfb, 0x5c, 0xdb, 0xd3, 0xaf,
+	0x38, 0xd5, 0xab, 0x15, 0x7d, 0x0b, 0x7c, 0x7b, 0xac, 0xf4, 0xfd, 0x35, 0xbb, 0x95, 0x4d, 0x24,
+	0xf3, 0x2f, 0xf0, 0x5e, 0xf2, 0x3c, 0xbc, 0xb3, 0xdd, 0xfb, 0x20, 0xee, 0xa5, 0x47, 0x4f, 0xb5,
+	0xb8, 0x29, 0x4f, 0xc3, 0x22, 0x22, 0xc1, 0x1f, 0xda, 0xaa, 0x84, 0x50, 0xc0, 0x5e, 0xb7, 0xcf,
+	0x7c, 0x35, 0xa9, 0x0a, 0x04, 0x61, 0x24, 0x97, 0xa9, 0x92, 0x88, 0x3a, 0x32, 0xcd, 0x87, 0x91,
+	0x64, 0xa7, 0x0f, 0x3f, 0x3f, 0xc3, 0x9f, 0x7d, 0xa8, 0x25, 0x78, 0x46, 0x26, 0x34, 0x82, 0x0f,
+	0x8e, 0xd2, 0xd1, 0x11, 0x49, 0x2a, 0x60, 0x0c, 0x58, 0x10, 0x7a, 0x58, 0xc3, 0xbe, 0x91, 0xb9,
+	0xe8, 0x5b, 0x93, 0xdd, 0x5c, 0xdb, 0xe0, 0xb7, 0x11, 0xf9, 0x29, 0x8e, 0xfc, 0x16, 0xb3, 0xc0,
+	0x8f, 0x6d, 0x35, 0x41, 0x96, 0x85, 0xde, 0xbb, 0xdb, 0xd9, 0xed, 0xee, 0xf6, 0xde, 0x74, 0x76,
+	0x7b, 0x50, 0xbf, 0xed, 0x0c, 0x26, 0x58, 0x37, 0xd7, 0xed, 0xfb, 0x1e, 0x6f, 0xef, 0x8a, 0x5e,
+	0xef, 0x4d, 0x0b, 0x3c, 0xf7, 0x68, 0xd4, 0x7b, 0xc3, 0xc5, 0xce, 0x36, 0x3e, 0x6f, 0xd9, 0x3d,
+	0x31, 0xde, 0x7a, 0xd3, 0xc1, 0x67, 0xbe, 0xdd, 0x1d, 0x8f, 0xb7, 0xb7, 0x78, 0xab, 0xd6, 0xbe,
+	0xdf, 0xb6, 0xda, 0x62, 0xbb, 0xf3, 0x66, 0x8c, 0xe9, 0xbb, 0xa3, 0xf6, 0x76, 0x6f, 0x67, 0xc7,
+	0xc6, 0x67, 0x6b, 0xbc, 0xb3, 0xe5, 0xec, 0xf2, 0x11, 0x3e, 0x6f, 0x8f, 0x44, 0xdb, 0x76, 0xac,
+	0xdd, 0xaf, 0xe9, 0x44, 0x7c, 0x90, 0x70, 0x0f, 0xd5, 0x94, 0x53, 0x42, 0x2a, 0xf4, 0x7a, 0xcd,
+	0x76, 0xe1, 0x4f, 0x0f, 0x54, 0x1d, 0x0c, 0x70, 0xf6, 0x1e, 0x6a, 0xbe, 0x97, 0x42, 0x33, 0x9e,
+	0x54, 0x21, 0x4c, 0x62, 0xa0, 0xca, 0xe0, 0x23, 0x38, 0xc9, 0xb4, 0xd3, 0x85, 0xd7, 0xeb, 0x9c,
+	0x5c, 0xb4, 0x07, 0xf6, 0x42, 0x5a, 0x14, 0x6e, 0xff, 0x54, 0xb2, 0xb0, 0xb7, 0xf8, 0x02, 0xaf,
+	0x06, 0x4a, 0x90, 0xce, 0x06, 0xf8, 0x91, 0x00, 0xe5, 0x61, 0x4e, 0x5b, 0x1d, 0x99, 0x0b, 0xdb,
+	0x60, 0x3b, 0xad, 0xca, 0x12, 0xa3, 0x52, 0x7c, 0x13, 0xe4, 0x77, 0xda, 0xf2, 0x7f, 0xcd, 0xe5,
+	0x02, 0xba, 0x72, 0xb8, 0xa4, 0xb9, 0x7e, 0x66, 0x3b, 0x50, 0x50, 0xd9, 0x66, 0xa5, 0x66, 0x5a,
+	0xad, 0x53, 0x64, 0x93, 0x45, 0xec, 0x75, 0xd3, 0xaf, 0xb4, 0xa2, 0xc5, 0x8c, 0xfb, 0x16, 0xf3,
+	0xa9, 0xad, 0x1b, 0xf7, 0xc4, 0x0e, 0x2f, 0xbf, 0xe3, 0x33, 0x58, 0xcb, 0xd8, 0xea, 0x40, 0x36,
+	0x3e, 0xaa, 0x90, 0xe2, 0x2b, 0xa0, 0xed, 0x1b, 0x00, 0x49, 0x7c, 0xd8, 0x97, 0x96, 0x97, 0x2f,
+	0xd0, 0x59, 0x83, 0xf4, 0x25, 0xb3, 0xa0, 0x56, 0x4f, 0x4d, 0xf7, 0xdd, 0x61, 0x3f, 0x78, 0x40,
+	0x46, 0xc3, 0x0e, 0x87, 0x54, 0x33, 0x88, 0x1d, 0xe8, 0x00, 0x4d, 0xcd, 0xd2, 0x52, 0x04, 0x31,
+	0x2a, 0xf4, 0x17, 0xe7, 0x51, 0xdb, 0xd8, 0x70, 0xc1, 0x72, 0x20, 0x71, 0xc3, 0xda, 0xfe, 0xda,
+	0x62, 0x6f, 0x9a, 0xec, 0xdf, 0x8b, 0x29, 0xd6, 0x0e, 0x26, 0xe9, 0x77, 0x2a, 0xde, 0x56, 0x36,
+	0xe9, 0x62, 0xe5, 0x04, 0x74, 0x90, 0xba, 0x20, 0x80, 0x52, 0x76, 0x53, 0xfe, 0x8e, 0x64, 0xb7,
+	0xd0, 0xba, 0xaa, 0x0c, 0x24, 0xb6, 0x87, 0xcd, 0x1e, 0x74, 0x79, 0x4d, 0xaf, 0x6f, 0xe8, 0xcd,
+	0xd2, 0x71, 0xd9, 0x35, 0x87, 0x78, 0x08, 0x1a, 0x31, 0x54, 0x54, 0x8b, 0x41, 0x94, 0x00, 0xa8,
+	0x9e, 0x80, 0x1b, 0x26, 0x08, 0x4d, 0x17, 0xaf, 0xb9, 0x54, 0xca, 0x99, 0xa0, 0x9a, 0x53, 0x44,
+	0xb3, 0x81, 0xaa, 0x81, 0x94, 0x9e, 0x56, 0x13, 0x9e, 0x2d, 0x2b, 0xf7, 0xd2, 0xd9, 0xa6, 0x09,
+	0x5b, 0xc3, 0x10, 0xe0, 0xea, 0xc6, 0xa4, 0xfa, 0x7f, 0xe2, 0xe3, 0x84, 0x92, 0x6f, 0x50, 0xeb,
+	0xd7, 0xb2, 0x02, 0x7e, 0xcf, 0x2d, 0x62, 0x75, 0x10, 0x05, 0x28, 0x01, 0x94, 0xed, 0x68, 0x69,
+	0xf0, 0x6c, 0x6d, 0xe5, 0x5e, 0x3a, 0x1d, 0x25, 0x9a, 0x83, 0xbc, 0x11, 0x89, 0xc6, 0x27, 0x9b,
+	0x9e, 0x46, 0xf4, 0xd4, 0x94, 0x52, 0xa7, 0xd8, 0xf0, 0x27, 0x7d, 0x86, 0xed, 0x6b, 0xdc, 0x67,
+	0x88, 0x16, 0xf0, 0x2e, 0xb4, 0xce, 0x08, 0x02, 0xa0, 0x34, 0x44, 0x85, 0x6e, 0xca, 0xee, 0x93,
+	0x7b, 0x1b, 0x81, 0xef, 0x81, 0x1f, 0xde, 0x67, 0x1c, 0xdd, 0x99, 0x85, 0x54, 0x1d, 0xed, 0x4b,
+	0x96, 0x5a, 0x30, 0x1d, 0x4a, 0x19, 0xb7, 0x2a, 0xfa, 0x62, 0x53, 0x59, 0x2d, 0x53, 0x59, 0xce,
+	0x5b, 0x14, 0x41, 0x21, 0x8b, 0x8a, 0x15, 0xa7, 0xd4, 0xaf, 0xdd, 0x12, 0xd4, 0x6f, 0x55, 0x4b,
+	0x81, 0x20, 0x6c, 0xa8, 0x56, 0x03, 0x7b, 0x4d, 0xe8, 0x67, 0x9d, 0x21, 0xae, 0x79, 0x18, 0xd0,
+	0x34, 0x1b, 0xed, 0x46, 0x53, 0x87, 0x63, 0x8d, 0xf2, 0xcc, 0x0d, 0x86, 0xe1, 0x27, 0x6e, 0x34,
+	0xbb, 0xe3, 0x51, 0x7e, 0xf6, 0x06, 0x77, 0x78, 0xae, 0x1a, 0x33, 0x8e, 0x15, 0xcb, 0x09, 0xd0,
+	0x41, 0x50, 0x85, 0xe4, 0xd8, 0xd5, 0xa5, 0x80, 0x94, 0xfb, 0x4e, 0x57, 0x08, 0x50, 0x93, 0x8f,
+	0x6a, 0x7f, 0x80, 0x1a, 0xf9, 0xa3, 0x98, 0x6c, 0xe4, 0x2f, 0x85, 0x94, 0xb6, 0x0f, 0x35, 0x3e,
+	0xf0, 0x18, 0x97, 0xa7, 0x4d, 0xd3, 0x84, 0xe0, 0x07, 0x19, 0x4c, 0x8a, 0x87, 0xde, 0x91, 0x8b,
+	0xd2, 0xab, 0x57, 0xd2, 0x61, 0xe5, 0xa7, 0x48, 0x70, 0x3c, 0xa3, 0x7c, 0xc8, 0x09, 0x3c, 0xa2,
+	0x7b, 0x33, 0x64, 0x03, 0x9d, 0x99, 0x30, 0xfa, 0xa1, 0x38, 0x52, 0x17, 0x0a, 0x46, 0x4f, 0xa4,
+	0xc9, 0x32, 0x15, 0xae, 0xc8, 0x6a, 0xa9, 0x12, 0xaa, 0x52, 0xf4, 0x00, 0x4c, 0x96, 0xec, 0xad,
+	0xec, 0x1e, 0xe5, 0x4c, 0x53, 0xda, 0x53, 0x96, 0xbc, 0xb4, 0xf2, 0xab, 0xcd, 0x45, 0xa3, 0x35,
+	0x39, 0xda, 0x42, 0xfd, 0xe4, 0xe8, 0xe8, 0x39, 0x23, 0x2e, 0xb6, 0x50, 0x7f, 0xfc, 0x0c, 0xbd,
+	0x63, 0xba, 0x23, 0x40, 0xc7, 0x82, 0xab, 0x0a, 0x0b, 0x5d, 0xab, 0x4b, 0x8b, 0x20, 0xac, 0x3c,
+	0x4e, 0xc7, 0xf8, 0x20, 0x98, 0xa8, 0xfd, 0x2b, 0x5e, 0x30, 0x59, 0x3d, 0x0e, 0xd1, 0x94, 0x8b,
+	0xb6, 0x84, 0x88, 0x74, 0xac, 0x01, 0x64, 0xb4, 0x75, 0x59, 0xd0, 0xb8, 0x03, 0x5e, 0x66, 0xdc,
+	0x9f, 0x43, 0x47, 0xf1, 0x96, 0x35, 0x30, 0xfe, 0xc1, 0xe7, 0xa6, 0x5a, 0xd6, 0xd1, 0x03, 0x0e,
+	0xbd, 0x47, 0x82, 0xc8, 0x09, 0xbd, 0x40, 0x0c, 0x8a, 0x31, 0x2d, 0x8f, 0xd2, 0x68, 0x40, 0xa3,
+	0x53, 0x22, 0x61, 0x07, 0x91, 0x13, 0xd3, 0x24, 0xbf, 0x7a, 0x96, 0x52, 0x94, 0xe0, 0x5a, 0xe3,
+	0x38, 0x0a, 0x00, 0x1a, 0x0e, 0x8b, 0xf9, 0x2c, 0x04, 0x80, 0x67, 0xac, 0x8e, 0xfa, 0x90, 0xdf,
+	0xc3, 0xf1, 0x11, 0xf5, 0xad, 0x50, 0xe2, 0x4e, 0xc4, 0xa1, 0x4c, 0xa4, 0x8c, 0x70, 0x73, 0x24,
+	0x9b, 0xf0, 0x50, 0xee, 0x2a, 0x91, 0x65, 0xbb, 0x97, 0x04, 0x7f, 0xe5, 0xe1, 0x55, 0x4c, 0x3b,
+	0x37, 0xda, 0xed, 0xf2, 0x98, 0x0a, 0x7a, 0x79, 0x40, 0x09, 0xe5, 0x83, 0x12, 0x19, 0x85, 0x6e,
+	0xa5, 0x6c, 0x4e, 0x28, 0x0d, 0xa9, 0x61, 0xf0, 0xe9, 0x05, 0x77, 0x02, 0xfb, 0xcd, 0xc8, 0x4d,
+	0xf4, 0x16, 0x16, 0x95, 0xd9, 0x2f, 0x98, 0xb4, 0x2a, 0xa3, 0x6c, 0x23, 0x4b, 0x12, 0x44, 0x38,
+	0x99, 0x59, 0xde, 0x6a, 0x22, 0xab, 0x87, 0xbe, 0x5d, 0xc5, 0x60, 0x85, 0xdc, 0x66, 0x13, 0x78,
+	0x5e, 0x4e, 0x7c, 0x49, 0xbd, 0x7d, 0x9e, 0xfa, 0x6f, 0xef, 0x74, 0x66, 0xba, 0x8a, 0x64, 0xc8,
+	0x3e, 0x46, 0x44, 0x36, 0xf6, 0x39, 0x9b, 0x46, 0x62, 0x7c, 0x50, 0xdf, 0x24, 0xd5, 0xbd, 0xc9,
+	0x5b, 0x9f, 0xda, 0xd3, 0xd8, 0xf4, 0xe7, 0xb3, 0x91, 0xa0, 0x8d, 0x3e, 0xaf, 0x92, 0x83, 0x34,
+	0x43, 0x19, 0x7e, 0x40, 0xd3, 0x16, 0xa6, 0x0f, 0xf1, 0x5d, 0x53, 0x17, 0x11, 0xcb, 0x52, 0x1f,
+	0x68, 0x30, 0xe4, 0xb9, 0xf7, 0x37, 0x39, 0xb8, 0xd0, 0x92, 0xc6, 0x63, 0x13, 0x77, 0xc8, 0x96,
+	0xf4, 0x6c, 0xae, 0x1a, 0xd1, 0x62, 0x0b, 0x01, 0xf1, 0x85, 0xd9, 0x3c, 0x50, 0xf9, 0x29, 0x73,
+	0x79, 0x40, 0x2e, 0xdd, 0xd5, 0xaa, 0xb6, 0x93, 0x1f, 0xc2, 0xe2, 0x30, 0x07, 0x41, 0x4c, 0x63,
+	0xbc, 0x55, 0x4c, 0xe7, 0x51, 0x99, 0x27, 0x8c, 0x84, 0xda, 0x8d, 0xb3, 0x9a, 0xf3, 0x22, 0x9c,
+	0x95, 0x73, 0x0b, 0x67, 0xd4, 0xad, 0xac, 0xe6, 0xbb, 0x0c, 0xe3, 0x12, 0x5f, 0x12, 0xc6, 0x8a,
+	0xaf, 0xea, 0x2f, 0x2a, 0x53, 0x7f, 0x30, 0x60, 0x49, 0xd0, 0x9a, 0xe8, 0x01, 0xcb, 0x16, 0xfd,
+	0x31, 0xe6, 0xb5, 0x08, 0x0b, 0x0b, 0xa6, 0xfe, 0x27, 0x87, 0xf4, 0x64, 0x70, 0x5b, 0x6f, 0x5f,
+	0xd2, 0x65, 0x6d, 0xc8, 0x24, 0xc2, 0xb2, 0xfa, 0x5a, 0x99, 0x0e, 0x45, 0xb3, 0x89, 0x24, 0x81,
+	0x7e, 0x47, 0x4e, 0x8a, 0xa6, 0xbc, 0x6b, 0xcc, 0x7f, 0x94, 0xb0, 0x83, 0x13, 0x8e, 0x80, 0x82,
+	0x47, 0x99, 0xf2, 0xd8, 0xa1, 0x19, 0xcf, 0x70, 0xf6, 0x78, 0x46, 0x39, 0xd4, 0x20, 0x0f, 0xd4,
+	0xfd, 0xa3, 0x3c, 0x39, 0xc4, 0x54, 0x5b, 0x56, 0x65, 0x85, 0xb2, 0xb4, 0x98, 0xf8, 0xa4, 0x85,
+	0x56, 0xb9, 0x3a, 0x39, 0xf8, 0x8e, 0x75, 0xce, 0x95, 0xeb, 0xac, 0x48, 0x5a, 0xdc, 0x28, 0x47,
+	0x5b, 0x4f, 0x2e, 0xe5, 0xf8, 0x34, 0x73, 0x4d, 0x9b, 0xe8, 0x98, 0xa0, 0x35, 0xd0, 0xb0, 0x41,
+	0x44, 0x20, 0xc0, 0x28, 0xec, 0x04, 0x6d, 0x49, 0xcf, 0x85, 0xe7, 0x9a, 0x7c, 0x27, 0xb8, 0x33,
+	0x03, 0x9f, 0x7a, 0x61, 0x88, 0x43, 0x95, 0x65, 0xc8, 0x10, 0x0b, 0x36, 0x82, 0x48, 0x00, 0x66,
+	0x2b, 0xd3, 0xf2, 0xbd, 0x68, 0x42, 0x99, 0x26, 0x57, 0xa1, 0x4a, 0x13, 0xb1, 0x79, 0xf4, 0xf6,
+	0x71, 0x93, 0xbc, 0xda, 0x1c, 0xbf, 0xbf, 0xa9, 0x0e, 0x15, 0x62, 0x33, 0x81, 0x1f, 0xc7, 0xbd,
+	0x65, 0xb4, 0xe9, 0x1b, 0xb7, 0x60, 0xaa, 0x13, 0x78, 0x78, 0x08, 0x70, 0x6a, 0xad, 0x38, 0x70,
+	0x08, 0x1f, 0x0b, 0x9c, 0xea, 0x68, 0x1b, 0xf1, 0x75, 0x06, 0x43, 0x9c, 0xd4, 0x9e, 0x31, 0x59,
+	0x7e, 0x20, 0xee, 0x94, 0x88, 0x29, 0xbd, 0xce, 0x5c, 0x27, 0x7d, 0x1e, 0xd4, 0x16, 0xee, 0x24,
+	0xad, 0x95, 0x77, 0x91, 0xd6, 0x16, 0xee, 0x20, 0x45, 0x41, 0xb8, 0x0f, 0x74, 0xa8, 0x04, 0x17,
+	0x77, 0x94, 0xea, 0x23, 0x13, 0x0b, 0xf7, 0x91, 0xaa, 0x1d, 0xb1, 0xe5, 0x9d, 0xa3, 0xb5, 0x0b,
+	0x9c, 0xac, 0xc4, 0x98, 0xad, 0xb8, 0xcd, 0x07, 0xac, 0x07, 0x05, 0x19, 0xa4, 0x3f, 0x4b, 0x4d,
+	0x90, 0xb3, 0x58, 0xc6, 0x5d, 0x35, 0x45, 0xee, 0xd8, 0x0e, 0x32, 0xca, 0xa3, 0x2d, 0x90, 0xeb,
+	0x41, 0x3d, 0x5b, 0xe6, 0xab, 0xa7, 0xc2, 0xb0, 0x9e, 0xf7, 0xf6, 0x37, 0x89, 0x0a, 0x8f, 0x3b,
+	0x48, 0xc0, 0x63, 0xe9, 0x73, 0xd4, 0x2c, 0xf0, 0x71, 0xd6, 0x6d, 0x02, 0x06, 0xc8, 0xaf, 0xe6,
+	0xa2, 0x78, 0xb9, 0x0a, 0x24, 0xa7, 0x9f, 0x0f, 0xea, 0xed, 0xfa, 0x00, 0x86, 0x19, 0x02, 0x46,
+	0x7a, 0x86, 0x3d, 0x87, 0x7e, 0x7d, 0x26, 0xf7, 0x65, 0xc6, 0xcd, 0xfd, 0x4d, 0x49, 0x58, 0xe1,
+	0xb0, 0xea, 0x83, 0xcb, 0x88, 0xdb, 0x37, 0x4b, 0x09, 0x3a, 0xa8, 0x2b, 0x9f, 0xf8, 0xe0, 0xce,
+	0x5c, 0x3b, 0xce, 0x91, 0x6d, 0x4a, 0x5d, 0x33, 0xc3, 0x4d, 0xb7, 0x06, 0x18, 0xb8, 0x43, 0x91,
+	0x30, 0x4b, 0x30, 0xcc, 0xd6, 0x42, 0xc3, 0xe0, 0x31, 0x90, 0xfa, 0xe3, 0x26, 0x1b, 0x9c, 0xeb,
+	0xdd, 0x9c, 0x16, 0x33, 0x3e, 0x8a, 0x31, 0x74, 0x1b, 0x41, 0xd8, 0x5c, 0x66, 0x2a, 0xc8, 0xb1,
+	0x5d, 0x35, 0x87, 0xde, 0x1d, 0x44, 0xe6, 0xa6, 0xa7, 0xa5, 0xc5, 0x04, 0xee, 0xd3, 0xc3, 0xcb,
+	0x55, 0x66, 0x52, 0x7b, 0x67, 0x57, 0x19, 0xea, 0xf0, 0xe4, 0x62, 0xe9, 0xe7, 0x2d, 0xf8, 0x7c,
+	0xfc, 0x65, 0xe9, 0xe7, 0x2e, 0xd6, 0x03, 0xf5, 0xfa, 0x4b, 0x49, 0xb6, 0x81, 0xe4, 0x7c, 0xb8,
+	0xf4, 0x73, 0xaf, 0x3e, 0x50, 0x7b, 0x76, 0x97, 0x92, 0xbc, 0xa9, 0x43, 0xfb, 0x3f, 0x5f, 0xfa,
+	0x79, 0xa7, 0x3e, 0xb8, 0x38, 0x3f, 0x5b, 0xfa, 0x79, 0xb7, 0x3e, 0x38, 0x59, 0xce, 0x6c, 0x81,
+	0x05, 0xbf, 0x0c, 0x97, 0xab, 0x37, 0x91, 0xf6, 0x61, 0xb4, 0x31, 0x6c, 0x39, 0x95, 0x54, 0xf1,
+	0x31, 0x2a, 0xa9, 0xe9, 0x23, 0x54, 0x5c, 0x53, 0xe1, 0x66, 0xb3, 0xe5, 0x54, 0x3a, 0xc7, 0xd5,
+	0x54, 0x54, 0xf8, 0x0a, 0x51, 0xa5, 0x0d, 0xac, 0x0d, 0xea, 0x8e, 0x02, 0xf5, 0x99, 0xeb, 0x38,
+	0x30, 0x98, 0x5d, 0x81, 0x6b, 0xeb, 0x05, 0xd7, 0x2f, 0xb8, 0xfe, 0x61, 0x70, 0xbd, 0xa5, 0x70,
+	0xfd, 0x8e, 0x0e, 0x1f, 0xae, 0xc2, 0x75, 0xe7, 0x05, 0xd7, 0x2f, 0xb8, 0xfe, 0x61, 0x70, 0xdd,
+	0x65, 0xc6, 0x05, 0x46, 0x99, 0x8f, 0x45, 0x21, 0x5b, 0x2f, 0xa8, 0x7e, 0x41, 0xf5, 0x0f, 0x83,
+	0xea, 0x6d, 0x8d, 0xea, 0xc7, 0xc3, 0x90, 0xee, 0x0b, 0xb0, 0x5f, 0x80, 0xfd, 0xc3, 0x00, 0xbb,
+	0xa7, 0x81, 0xfd, 0x78, 0x1c, 0xb2, 0xfd, 0x02, 0xec, 0x17, 0x60, 0xff, 0x30, 0xc0, 0x7e, 0xc3,
+	0x0c, 0x09, 0xe9, 0x0d, 0x0c, 0xb3, 0x57, 0xe1, 0xba, 0xf7, 0x82, 0xeb, 0x17, 0x5c, 0xff, 0x30,
+	0xb8, 0xde, 0x49, 0x71, 0x4d, 0x7e, 0x7b, 0x15, 0xb0, 0xdf, 0xbc, 0x00, 0xfb, 0x05, 0xd8, 0xff,
+	0xdf, 0xc0, 0xce, 0xe6, 0xbc, 0xe5, 0x0a, 0x05, 0x3b, 0x4d, 0x4f, 0x7d, 0x56, 0x67, 0xbe, 0x8b,
+	0x57, 0x21, 0x65, 0xe8, 0xdf, 0x97, 0xd7, 0x7a, 0x95, 0xae, 0xa7, 0x22, 0xa4, 0x03, 0x0b, 0xd8,
+	0x99, 0x0d, 0xff, 0xfe, 0xe9, 0x28, 0x6b, 0x09, 0xeb, 0x70, 0x01, 0x80, 0xd9, 0xc9, 0xe1, 0xa7,
+	0xa7, 0x31, 0x41, 0x95, 0xb1, 0xc3, 0xe1, 0xfb, 0xa7, 0x31, 0x01, 0xd0, 0xd9, 0x2f, 0x57, 0x4f,
+	0x64, 0x02, 0xf8, 0xb3, 0x8b, 0xf7, 0x5f, 0x9e, 0xc6, 0x04, 0x0d, 0x82, 0x7d, 0x3c, 0xfa, 0xf0,
+	0x34, 0xa6, 0x1e, 0x96, 0xe9, 0x89, 0xc6, 0x03, 0x88, 0xb0, 0xe3, 0x93, 0xa3, 0xcf, 0x19, 0xd7,
+	0x52, 0x3f, 0xa6, 0x2f, 0xf7, 0xc2, 0xda, 0x94, 0x57, 0x29, 0x69, 0x82, 0x51, 0xe2, 0xd3, 0x8a,
+	0x8d, 0xe7, 0xda, 0x37, 0x07, 0xf5, 0x05, 0xf7, 0x22, 0xd4, 0x07, 0x43, 0x48, 0x2c, 0xaf, 0x23,
+	0x49, 0x21, 0x8b, 0xa4, 0x31, 0x79, 0x65, 0x61, 0x4e, 0xe8, 0xa2, 0x93, 0xf8, 0xd0, 0x06, 0xe8,
+	0xec, 0x7d, 0x12, 0xb0, 0x63, 0x79, 0xb4, 0x30, 0x27, 0x53, 0x15, 0x23, 0xd4, 0xeb, 0x68, 0xe5,
+	0xab, 0xd3, 0x58, 0x10, 0x72, 0xdb, 0x4d, 0x1e, 0xf6, 0x58, 0xdb, 0xdc, 0xe9, 0xcb, 0x0b, 0x43,
+	0xa3, 0xc0, 0x9f, 0x2c, 0x5e, 0xf4, 0xda, 0xc3, 0xfb, 0xb9, 0xe8, 0x33, 0x2d, 0xac, 0xfd, 0xcf,
+	0x7f, 0xfd, 0x37, 0x4b, 0xe9, 0xb3, 0x15, 0xa0, 0x8c, 0x8a, 0x1d, 0x4d, 0x03, 0xdc, 0xd9, 0x7e,
+	0x37, 0x75, 0xed, 0x29, 0x13, 0xfe, 0xc4, 0xf5, 0x05, 0x6d, 0x74, 0xa2, 0x2b, 0x01, 0x54, 0x0e,
+	0xae, 0xcf, 0x04, 0x87, 0xcf, 0xfa, 0x66, 0x8a, 0x8a, 0xe8, 0x4a, 0x43, 0xcb, 0x65, 0x20, 0x17,
+	0xca, 0x54, 0x06, 0x6a, 0x7f, 0x5b, 0x76, 0x0e, 0x1b, 0xb3, 0xc1, 0xad, 0x0d, 0x8c, 0xe3, 0x31,
+	0x25, 0xec, 0x65, 0x2a, 0xc2, 0x3f, 0xd2, 0xad, 0x0e, 0x39, 0x89, 0x3b, 0x52, 0x41, 0xb9, 0x7e,
+	0xc6, 0x8c, 0x2e, 0xc8, 0x08, 0x5b, 0xac, 0xab, 0xf8, 0x71, 0xe3, 0x49, 0x2a, 0x9f, 0x8d, 0x78,
+	0xb4, 0xd8, 0x10, 0xb8, 0xd3, 0x21, 0xaf, 0xe6, 0x89, 0x17, 0x80, 0x0a, 0x06, 0xb8, 0xc7, 0x16,
+	0x53, 0x3e, 0xbc, 0xd9, 0xc2, 0x6d, 0xb3, 0x02, 0x6f, 0xd9, 0x32, 0xc0, 0xeb, 0xb7, 0x18, 0xf8,
+	0xa8, 0x16, 0x13, 0x89, 0x6d, 0xc2, 0x97, 0x77, 0xd0, 0x15, 0x09, 0xee, 0x33, 0x23, 0x2b, 0x4b,
+	0x93, 0x72, 0x92, 0x0b, 0xa7, 0xb4, 0x26, 0x18, 0x33, 0xdc, 0x47, 0xf1, 0x80, 0xa7, 0x24, 0x44,
+	0x32, 0x05, 0x31, 0x77, 0x53, 0xe1, 0x33, 0x28, 0x0d, 0x0b, 0x01, 0x26, 0x31, 0x43, 0xac, 0x41,
+	0xfd, 0xfa, 0x48, 0x32, 0x15, 0xba, 0x40, 0xc9, 0x94, 0xcb, 0x6b, 0x62, 0x26, 0xc2, 0x61, 0x3c,
+	0x12, 0x2c, 0x12, 0x4e, 0xc4, 0xef, 0x7c, 0x53, 0x2d, 0xc9, 0xe6, 0xef, 0x41, 0x70, 0x63, 0x79,
+	0x75, 0x84, 0xbc, 0xc0, 0x01, 0x6f, 0x68, 0x60, 0x33, 0xba, 0xe6, 0x86, 0xe1, 0xe9, 0xb2, 0x50,
+	0x44, 0xb1, 0x1b, 0x27, 0xa0, 0x86, 0x1d, 0x05, 0x90, 0x9f, 0xba, 0xcf, 0x21, 0x36, 0x01, 0x75,
+	0xe1, 0x1a, 0xcb, 0xaa, 0xb4, 0xaf, 0x9d, 0xd1, 0xdd, 0x40, 0xf1, 0xd2, 0xd5, 0xd4, 0x35, 0x17,
+	0x0d, 0xe5, 0x3a, 0x6b, 0x76, 0xba, 0x0c, 0x3a, 0x73, 0x79, 0x5a, 0x61, 0x71, 0x38, 0x91, 0x23,
+	0xcc, 0x2d, 0xb1, 0xe6, 0x0e, 0xbe, 0xd5, 0x07, 0x4f, 0x0e, 0x69, 0x32, 0x15, 0xb2, 0x73, 0x60,
+	0xf5, 0x41, 0xf6, 0x9c, 0xd3, 0x44, 0xba, 0x22, 0xad, 0x48, 0x8e, 0x5c, 0xb9, 0x27, 0xb9, 0x13,
+	0x0a, 0xd7, 0xbe, 0x45, 0x08, 0x81, 0x8b, 0x69, 0xd5, 0xd9, 0xcc, 0xf5, 0x29, 0x84, 0x79, 0xba,
+	0x36, 0x74, 0x42, 0xae, 0x3e, 0xc0, 0x82, 0x31, 0x3a, 0x67, 0xc7, 0x0c, 0x1e, 0xdb, 0xc2, 0xc7,
+	0x9d, 0x92, 0xcd, 0xa5, 0x4a, 0x49, 0x2e, 0xa5, 0x0f, 0xee, 0xd6, 0xa8, 0x33, 0x68, 0xac, 0xb6,
+	0x98, 0x06, 0x9e, 0x23, 0x40, 0xb2, 0xb5, 0x65, 0xb6, 0x5b, 0x56, 0xd7, 0xdc, 0x79, 0x8e, 0x4a,
+	0x74, 0xce, 0x4e, 0xa9, 0x44, 0x0b, 0xfb, 0xa0, 0x53, 0x00, 0x9e, 0x01, 0xa0, 0x25, 0x10, 0xa0,
+	0xbe, 0x54, 0x74, 0xb9, 0x76, 0x52, 0xc0, 0x72, 0xed, 0xee, 0x78, 0xe4, 0xb7, 0xfc, 0x20, 0x9a,
+	0x71, 0xaf, 0x65, 0x47, 0xe0, 0x55, 0x6c, 0xee, 0xd5, 0x2b, 0x7d, 0xf8, 0x63, 0xde, 0x3b, 0xc5,
+	0xc2, 0x21, 0xb5, 0x33, 0x8d, 0xd4, 0xd4, 0xb7, 0xae, 0xef, 0x54, 0x25, 0xeb, 0x1e, 0x43, 0x55,
+	0x5b, 0x4c, 0x29, 0xc6, 0x48, 0x4b, 0xa6, 0xf5, 0x33, 0xd9, 0xa1, 0x3a, 0x4c, 0x86, 0x37, 0xf9,
+	0xa1, 0x17, 0x83, 0x56, 0xc7, 0xd9, 0x14, 0xa2, 0x62, 0x11, 0xc9, 0x23, 0xbc, 0x5c, 0x5e, 0x96,
+	0x82, 0xc6, 0xc1, 0x16, 0x58, 0xc3, 0xfd, 0x8e, 0x31, 0x5d, 0xa5, 0x8b, 0x8a, 0x0b, 0xe6, 0xe2,
+	0x3d, 0x88, 0x0c, 0x0c, 0x06, 0x1e, 0x2f, 0x25, 0x1c, 0xc9, 0xe6, 0x9f, 0x1d, 0x64, 0x5c, 0xb7,
+	0x7d, 0xe2, 0xf9, 0x12, 0x3a, 0x70, 0xf0, 0xc7, 0x34, 0x4e, 0x7d, 0xd8, 0xab, 0x3e, 0xb8, 0xa2,
+	0xad, 0x0c, 0x0c, 0xf7, 0x47, 0x2d, 0x6e, 0x9e, 0x29, 0x69, 0xbe, 0x71, 0xe6, 0x8f, 0xa7, 0xd5,
+	0x17, 0x85, 0xce, 0xdb, 0xec, 0xc3, 0xaf, 0xab, 0x82, 0x57, 0xb5, 0x2d, 0x48, 0x38, 0x03, 0xab,
+	0xbd, 0x8a, 0xb4, 0x03, 0xb2, 0x3a, 0x2b, 0x85, 0x6d, 0x43, 0x43, 0xdc, 0x2e, 0xc9, 0x58, 0x16,
+	0x28, 0xae, 0x02, 0x59, 0xfe, 0x7c, 0x1b, 0x6e, 0xe0, 0x00, 0xef, 0xb9, 0x39, 0x84, 0xee, 0x86,
+	0xe5, 0x4c, 0x9f, 0xa2, 0x6d, 0xc9, 0xa6, 0x1b, 0x7d, 0x86, 0x10, 0x3d, 0xd6, 0x9a, 0xdb, 0x59,
+	0xb0, 0x83, 0xfa, 0x18, 0xc8, 0x91, 0xc8, 0x1f, 0x52, 0xb3, 0x72, 0x1b, 0x1b, 0x46, 0x37, 0xb8,
+	0x61, 0x96, 0x2a, 0x96, 0x19, 0x1f, 0x7e, 0x6d, 0x31, 0x6b, 0xc3, 0x6a, 0xb7, 0x17, 0x37, 0x63,
+	0xcd, 0x54, 0x72, 0x79, 0xe4, 0xe7, 0xd0, 0xdf, 0xf1, 0x7b, 0xac, 0xb4, 0x27, 0x7b, 0x3c, 0xb9,
+	0x3b, 0xae, 0x3e, 0x80, 0xbf, 0x36, 0x12, 0x75, 0x89, 0xe5, 0xd4, 0xc5, 0x9d, 0xae, 0x0f, 0xcc,
+	0x88, 0x97, 0xaa, 0x82, 0x3c, 0x8b, 0x34, 0x69, 0x2b, 0x4d, 0x7a, 0xcf, 0x51, 0xe4, 0x22, 0x9c,
+	0xa9, 0x5a, 0x65, 0x7c, 0x04, 0x6d, 0x9a, 0xe1, 0x58, 0xc5, 0xc0, 0x53, 0x25, 0xc1, 0x78, 0xbc,
+	0xdc, 0x2a, 0xc0, 0xb5, 0x58, 0x95, 0xa7, 0x6b, 0x70, 0x19, 0xc6, 0x45, 0x0d, 0x20, 0xd0, 0x60,
+	0x3f, 0x3d, 0xae, 0x03, 0xf2, 0xad, 0x32, 0x47, 0xb1, 0x62, 0xaa, 0x4a, 0x69, 0xf8, 0x3c, 0xe6,
+	0x61, 0x0b, 0x7b, 0x27, 0xb5, 0x9f, 0x95, 0xd0, 0x64, 0xfa, 0xc3, 0xaa, 0x00, 0x39, 0x27, 0x2e,
+	0xdb, 0xc6, 0xd9, 0xa0, 0x30, 0xa4, 0xa1, 0x5b, 0x14, 0xca, 0x7b, 0x8e, 0x8c, 0x20, 0x94, 0x22,
+	0xb0, 0x39, 0xae, 0x96, 0x50, 0x0d, 0xd3, 0x73, 0x82, 0x6c, 0x88, 0xe3, 0x22, 0x94, 0x74, 0x0c,
+	0xfe, 0x01, 0xda, 0x05, 0xc8, 0x8a, 0xab, 0xf1, 0xf9, 0xb2, 0xc6, 0xad, 0xb7, 0xe4, 0x66, 0xad,
+	0x7b, 0xfd, 0x4e, 0xe7, 0x70, 0x0e, 0xf1, 0x2a, 0x04, 0x72, 0x36, 0x6e, 0x71, 0x85, 0x48, 0x0e,
+	0x4b, 0x42, 0xdd, 0x04, 0xc2, 0x10, 0xbb, 0x13, 0x04, 0xc3, 0x14, 0x07, 0x24, 0x23, 0xbc, 0x57,
+	0x24, 0xed, 0x36, 0xdc, 0x08, 0xfe, 0xc6, 0x3d, 0x8f, 0xd0, 0x99, 0xc6, 0xb4, 0x6d, 0x6e, 0x5b,
+	0x5f, 0x79, 0x68, 0xd6, 0x50, 0x7d, 0xe6, 0x04, 0x77, 0x72, 0xe3, 0x23, 0x8f, 0xd9, 0x99, 0x98,
+	0x70, 0x48, 0xc4, 0x43, 0x69, 0x50, 0x69, 0xb8, 0x1d, 0x9c, 0xc9, 0x0d, 0xe3, 0x6b, 0xf6, 0x32,
+	0xf2, 0x4a, 0xc7, 0x57, 0xec, 0x12, 0xa2, 0x47, 0xa8, 0xee, 0xaa, 0x47, 0x5a, 0x07, 0x4b, 0x85,
+	0x6b, 0x58, 0x81, 0xf8, 0x92, 0xde, 0x59, 0x76, 0x5d, 0x64, 0x6d, 0x4d, 0x04, 0x14, 0x6e, 0x3a,
+	0xc5, 0x13, 0x3a, 0xb8, 0x9b, 0x51, 0x27, 0xb0, 0xcf, 0x27, 0x27, 0xb5, 0x95, 0x75, 0xb7, 0x16,
+	0xee, 0x0b, 0x59, 0x58, 0x94, 0x05, 0xd6, 0xc8, 0xf0, 0x4e, 0x88, 0xf0, 0x79, 0x7a, 0x76, 0x48,
+	0xc8, 0x7b, 0x39, 0xbc, 0x3a, 0x75, 0x3c, 0xf1, 0x47, 0x6b, 0xb9, 0x45, 0x19, 0x1c, 0x47, 0xee,
+	0x2d, 0x5e, 0x41, 0xf9, 0x7c, 0x83, 0x76, 0x65, 0x69, 0x85, 0x83, 0x57, 0xe0, 0x55, 0xe4, 0x3c,
+	0x7f, 0xac, 0x9a, 0x5d, 0x0b, 0x9a, 0x1b, 0x19, 0x42, 0x34, 0x1f, 0xb3, 0xa3, 0xf3, 0x2b, 0x36,
+	0xc7, 0x83, 0xd2, 0x2d, 0x76, 0x82, 0x83, 0x2c, 0xc4, 0xbd, 0x1a, 0xc3, 0xb8, 0xfe, 0x38, 0xa0,
+	0x90, 0x0a, 0xda, 0x85, 0xbc, 0x63, 0x1c, 0x7c, 0xa2, 0x1e, 0x95, 0xca, 0xc1, 0x96, 0x1e, 0x80,
+	0xa6, 0x08, 0xc0, 0x3c, 0xe2, 0x15, 0xa3, 0x60, 0x40, 0x48, 0x4e, 0x85, 0xab, 0x18, 0x87, 0x57,
+	0xdc, 0xa3, 0x4b, 0x9f, 0x71, 0x54, 0x59, 0xa1, 0x4f, 0x2b, 0x3e, 0xc7, 0x85, 0x69, 0xae, 0x6f,
+	0x03, 0x63, 0x0c, 0x61, 0xe0, 0x38, 0x0a, 0x66, 0xac, 0x8d, 0x23, 0xb0, 0x9d, 0x76, 0xbb, 0x4d,
+	0xff, 0x00, 0x88, 0xeb, 0xcf, 0x83, 0x79, 0xec, 0x3d, 0x54, 0xa4, 0xe5, 0x10, 0x90, 0x37, 0x84,
+	0xd4, 0x1e, 0x64, 0xa9, 0x01, 0x38, 0x47, 0x3f, 0x8f, 0xd7, 0x1d, 0x80, 0x44, 0xcc, 0xad, 0x59,
+	0x1d, 0xc3, 0xca, 0x9a, 0x5e, 0x28, 0x44, 0x46, 0xaf, 0xcc, 0x51, 0x60, 0x40, 0xbf, 0x40, 0xc3,
+	0x76, 0x88, 0xe1, 0xf1, 0x48, 0xe9, 0x46, 0xb7, 0xbd, 0x4c, 0xaa, 0xaa, 0xf7, 0x85, 0x52, 0x31,
+	0xcc, 0xa5, 0x92, 0x07, 0x30, 0xac, 0x94, 0xa3, 0x4f, 0xa3, 0x07, 0x92, 0x5e, 0x67, 0xa2, 0xe4,
+	0x26, 0x62, 0x1c, 0xe3, 0xa6, 0x37, 0xb6, 0x62, 0xb8, 0xcb, 0x69, 0x43, 0x71, 0x8b, 0xd5, 0x87,
+	0xa7, 0x67, 0xf5, 0xdc, 0xd8, 0x1c, 0x8f, 0x8f, 0x71, 0x18, 0x59, 0x80, 0x24, 0x55, 0xa7, 0x26,
+	0x55, 0x08, 0x78, 0xb8, 0x58, 0xd0, 0x3d, 0xc2, 0x34, 0x3d, 0x90, 0xe0, 0x79, 0x1c, 0xba, 0x82,
+	0x50, 0x4d, 0x47, 0xdc, 0xb9, 0xc9, 0x34, 0x98, 0xe3, 0xf5, 0xbb, 0xb4, 0x79, 0x19, 0xcb, 0x08,
+	0x64, 0xba, 0x1a, 0xd7, 0x75, 0x6b, 0x85, 0xbd, 0xcd, 0x6a, 0x47, 0xf2, 0x73, 0x3c, 0x5b, 0xfe,
+	0xe2, 0x6c, 0xbc, 0x5d, 0x8c, 0x1a, 0x50, 0x7e, 0xa3, 0xf3, 0x13, 0x1a, 0x62, 0x26, 0x08, 0xff,
+	0xb5, 0x17, 0xee, 0x49, 0xef, 0x46, 0x8f, 0x7f, 0x5c, 0x5b, 0xac, 0x16, 0x9c, 0xbd, 0xbf, 0x07,
+	0xc3, 0xfa, 0x8f, 0x4d, 0x20, 0xe5, 0x0b, 0x95, 0x6f, 0x0d, 0xc2, 0x16, 0x2e, 0x8e, 0x87, 0x68,
+	0x56, 0xe6, 0xd6, 0xe5, 0x0c, 0x09, 0x47, 0x40, 0x68, 0x40, 0x4f, 0xe9, 0x3b, 0x3c, 0x72, 0xe8,
+	0x5f, 0x91, 0x99, 0x05, 0x08, 0x03, 0x16, 0x46, 0x41, 0x12, 0xc0, 0x98, 0xb2, 0x8a, 0xbe, 0x5c,
+	0x41, 0x57, 0x8a, 0x97, 0xb6, 0xa1, 0x7b, 0x8b, 0xb3, 0x72, 0x18, 0x57, 0x87, 0x17, 0x97, 0x39,
+	0x18, 0x5e, 0x02, 0x60, 0x24, 0xf0, 0x08, 0x49, 0x34, 0x53, 0x02, 0xfe, 0xc6, 0x47, 0xb4, 0xe5,
+	0xc0, 0xb4, 0x57, 0xd1, 0xa2, 0x0e, 0xda, 0xd7, 0xb3, 0xec, 0x35, 0x48, 0x5d, 0x9f, 0x4d, 0xe8,
+	0x76, 0x2f, 0xe9, 0x8f, 0xe8, 0xdf, 0x79, 0xa1, 0xae, 0x57, 0x5b, 0x05, 0x73, 0xa9, 0x0a, 0x1b,
+	0xbe, 0xbf, 0x58, 0x2c, 0x2c, 0x88, 0x30, 0x24, 0xa9, 0x48, 0x53, 0x36, 0x48, 0x85, 0x15, 0xbc,
+	0xdc, 0x2f, 0x87, 0x17, 0x9f, 0x4e, 0x3f, 0xfd, 0xb5, 0x30, 0x7b, 0xc7, 0xd1, 0x63, 0x4c, 0x4a,
+	0xc6, 0xa0, 0x12, 0x2f, 0xbb, 0xc2, 0x73, 0xcd, 0xf6, 0xa1, 0x0f, 0xb7, 0x32, 0x39, 0x18, 0x54,
+	0x8d, 0x23, 0x3f, 0x47, 0x8b, 0x51, 0x84, 0x8c, 0x82, 0xf2, 0xa7, 0x5a, 0xeb, 0x5a, 0x5c, 0xf6,
+	0x8f, 0x9d, 0xd4, 0xa1, 0x26, 0x6c, 0x11, 0x26, 0x07, 0x75, 0xbc, 0x91, 0xa3, 0xbe, 0x5e, 0x84,
+	0x56, 0x3e, 0x62, 0x8b, 0xa3, 0x52, 0x0a, 0x69, 0x74, 0x52, 0x61, 0x9c, 0x8f, 0x5a, 0xe4, 0x8f,
+	0xc6, 0x62, 0x38, 0x16, 0x3e, 0xa9, 0x79, 0x68, 0xe3, 0xb2, 0xcf, 0x38, 0x1f, 0x27, 0x73, 0xc7,
+	0x10, 0xdc, 0xb5, 0x09, 0x94, 0xfa, 0x70, 0x86, 0x2e, 0xaa, 0x8c, 0xa1, 0xd6, 0xb4, 0xe5, 0xa9,
+	0x8f, 0xc7, 0xa7, 0xf2, 0xa7, 0x12, 0xc2, 0x5c, 0xad, 0xba, 0x27, 0x2e, 0xfb, 0x24, 0x92, 0xbb,
+	0x20, 0xba, 0xc9, 0x55, 0xad, 0xce, 0xf1, 0x3f, 0x8e, 0x17, 0xf4, 0x77, 0xa7, 0xe7, 0xec, 0xd0,
+	0x71, 0x70, 0x12, 0x31, 0xc7, 0x61, 0xed, 0x76, 0x4c, 0xab, 0xb7, 0x63, 0x76, 0x4d, 0xab, 0x40,
+	0xfc, 0x05, 0xa7, 0x01, 0xf3, 0x2d, 0x9b, 0x59, 0x66, 0xa7, 0xf6, 0x64, 0xfb, 0xa0, 0x9a, 0x84,
+	0x29, 0xae, 0xc3, 0x56, 0xee, 0xe1, 0xcc, 0x25, 0x9e, 0xe1, 0xc5, 0xd3, 0xfb, 0x7c, 0x8c, 0x1d,
+	0xb4, 0x85, 0xe3, 0x90, 0x39, 0x84, 0xd1, 0xd0, 0x53, 0xbb, 0x3e, 0xb5, 0x40, 0x90, 0x42, 0xd3,
+	0xbc, 0x18, 0xc8, 0x86, 0x01, 0x04, 0xa1, 0xeb, 0x42, 0x50, 0x5d, 0xab, 0x27, 0x8f, 0xdf, 0x3c,
+	0xff, 0x70, 0x47, 0xfe, 0x20, 0x52, 0xbd, 0x28, 0x74, 0xf1, 0xec, 0x46, 0x81, 0xa1, 0x72, 0xc2,
+	0xa3, 0x78, 0x26, 0x68, 0xe1, 0x49, 0x0f, 0x7d, 0x95, 0xe1, 0xaa, 0xb5, 0x4c, 0x7d, 0x89, 0xe1,
+	0xaa, 0xc5, 0x4c, 0xba, 0xbe, 0x70, 0xd5, 0x72, 0x26, 0x5d, 0x5c, 0xb8, 0x6a, 0x8e, 0x63, 0xfd,
+	0xfa, 0x3d, 0x77, 0x3d, 0x77, 0xca, 0x26, 0x7c, 0x36, 0xe2, 0x11, 0x7b, 0x80, 0x02, 0x33, 0x7e,
+	0xc3, 0xb1, 0x67, 0x4e, 0xf8, 0x2c, 0x74, 0x3d, 0x7c, 0x8e, 0x39, 0x57, 0xe7, 0xb2, 0xe6, 0xa1,
+	0x9c, 0x8d, 0x3e, 0x17, 0xd1, 0x7c, 0xc4, 0x71, 0x3e, 0x50, 0x11, 0x43, 0xc7, 0x8f, 0x67, 0x84,
+	0x1c, 0x7a, 0x99, 0xcc, 0x7d, 0x9e, 0xf2, 0x69, 0x4f, 0x04, 0x63, 0x55, 0xf7, 0x66, 0x9e, 0xf8,
+	0x0f, 0x7c, 0xed, 0x9e, 0x5a, 0x79, 0xd8, 0x67, 0x03, 0xa0, 0x78, 0xe7, 0xa7, 0x3c, 0x86, 0x44,
+	0x09, 0x8b, 0xab, 0xbf, 0x44, 0x5e, 0x01, 0x40, 0x76, 0x48, 0x6c, 0xc1, 0x2c, 0x17, 0xdd, 0xd8,
+	0x81, 0x93, 0x4f, 0x6d, 0xf6, 0xb7, 0x51, 0x18, 0xaf, 0x98, 0xee, 0x52, 0x94, 0x16, 0x3b, 0x2b,
+	0xd2, 0x7d, 0x77, 0x1d, 0xde, 0x40, 0x8f, 0x19, 0x42, 0x67, 0xe9, 0x53, 0xdf, 0x04, 0x21, 0xea,
+	0x9c, 0xbb, 0x90, 0x08, 0xde, 0x72, 0x8e, 0x35, 0x35, 0x85, 0x0e, 0x19, 0x3d, 0xd8, 0x26, 0xc6,
+	0xbc, 0x87, 0xd0, 0x3f, 0xff, 0xf1, 0x55, 0xa9, 0x7f, 0xd4, 0xa1, 0xb7, 0x4d, 0xf9, 0xef, 0xeb,
+	0xfd, 0x2f, 0xf3, 0x0e, 0x9d, 0x76, 0x77, 0x6f, 0x00, 0x00
+};
+
+#endif // WEB_UI_H
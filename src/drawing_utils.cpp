@@ -1,125 +1,192 @@
 #include "drawing_utils.h"
+#include "Profiler.h"
+#include "Theme.h"
 #include <TFT_eSPI.h>
+#include <string.h>
 
 // External display objects
 extern TFT_eSPI display;
 
 void drawCenteredTextSmall(int x, int y, int w, int h, const char* text, int textSize, uint16_t color) {
   display.setTextDatum(MC_DATUM);
-  display.setTextColor(color, TFT_BLACK);
+  display.setTextColor(color, themeColor(THEME_BACKGROUND));
   display.drawString(text, x, y); 
 }
 
 void drawSmallButton(int x, int y, const char* label, bool value) {
   const int BTN_WIDTH = 50;
   const int BTN_HEIGHT = 30;
-  uint16_t activeColor = (label == "REV" || label == "LCH" ) ? TFT_RED : TFT_GREEN;
-  uint16_t fillColor = value ? activeColor : TFT_WHITE; 
+  uint8_t activeRole = (strcmp(label, "REV") == 0 || strcmp(label, "LCH") == 0) ? THEME_CRITICAL : THEME_NORMAL;
+  uint16_t fillColor = themeColor(value ? activeRole : THEME_TEXT);
   display.drawRoundRect(x, y, BTN_WIDTH, BTN_HEIGHT, 5, fillColor);
   drawCenteredTextSmall(x+BTN_WIDTH/2, y+BTN_HEIGHT/2, BTN_WIDTH, BTN_HEIGHT, label, 1, fillColor);
+  PROFILE_SPI(2 * (BTN_WIDTH + BTN_HEIGHT) + BTN_WIDTH * 15); // Outline + label row
+}
+
+// RPM bar geometry. Blocks 10..29 share the same top edge; the first ten
+// step down to give the bar its curved lead-in.
+// Block Y offsets are relative to the bar origin set by configureRPMBar().
+static const int RPM_BAR_BLOCKS = 30;
+static const int RPM_BAR_BLOCK_WIDTH = 6;
+static const int RPM_BAR_BLOCK_HEIGHT = 70;
+static const int RPM_BAR_SPACING = 2;
+static const int16_t rpmBarBlockY[RPM_BAR_BLOCKS] = {40, 35, 30, 25, 20, 17, 14, 11, 8, 6, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5};
+
+// Lit color role per block: normal RPM, high RPM, then the danger zone
+static const uint8_t rpmBarBlockRole[RPM_BAR_BLOCKS] = {
+  THEME_NORMAL, THEME_NORMAL, THEME_NORMAL, THEME_NORMAL, THEME_NORMAL, THEME_NORMAL, THEME_NORMAL, THEME_NORMAL, THEME_NORMAL, THEME_NORMAL,
+  THEME_NORMAL, THEME_NORMAL, THEME_NORMAL, THEME_NORMAL, THEME_NORMAL, THEME_WARN, THEME_WARN, THEME_WARN, THEME_WARN, THEME_WARN,
+  THEME_WARN, THEME_WARN, THEME_WARN, THEME_WARN, THEME_WARN, THEME_CRITICAL, THEME_CRITICAL, THEME_CRITICAL, THEME_CRITICAL, THEME_CRITICAL
+};
+
+// Bar origin (left edge of the first block, top of the bar area)
+static int16_t rpmBarX = 120;
+static int16_t rpmBarY = 40;
+static bool rpmBarFirstRun = true;
+
+// Move the bar and force a full redraw on the next frame
+void configureRPMBar(int16_t x, int16_t y) {
+  rpmBarX = x;
+  rpmBarY = y;
+  rpmBarFirstRun = true;
+}
+
+// Number of lit blocks for a given RPM (1..30 when RPM > 0, 0 when stopped)
+static int rpmToFilledBlocks(int32_t rpm, int maxRPM) {
+  if (rpm <= 0) {
+    return 0;
+  }
+  int32_t filled = 1 + (rpm * (RPM_BAR_BLOCKS - 1)) / maxRPM;
+  return constrain(filled, 1, RPM_BAR_BLOCKS);
+}
+
+static void drawRPMBarLabels(int maxRPM) {
+  display.setTextSize(1);
+  display.setTextColor(themeColor(THEME_LABEL), themeColor(THEME_BACKGROUND));
+  display.setTextDatum(MC_DATUM);
+
+  // Calculate number of labels based on maxRPM (every 1000 RPM)
+  int numLabels = (maxRPM / 1000) + 1; // For 6000: 7 labels (0-6), For 8000: 9 labels (0-8)
+  int labelStep = 1000; // Every 1000 RPM
+
+  for (int i = 0; i < numLabels; i++) {
+    int labelRPM = i * labelStep;
+    int labelBlock = map(labelRPM, 0, maxRPM, 0, RPM_BAR_BLOCKS);
+    labelBlock = constrain(labelBlock, 0, RPM_BAR_BLOCKS - 1);
+
+    int labelX = rpmBarX + labelBlock * (RPM_BAR_BLOCK_WIDTH + RPM_BAR_SPACING) + RPM_BAR_BLOCK_WIDTH / 2;
+    // Y position follows the specific block's top edge + block height + offset
+    int labelY = rpmBarY + rpmBarBlockY[labelBlock] + RPM_BAR_BLOCK_HEIGHT + 8; // 8px below the specific block
+
+    display.drawString(String(labelRPM / 1000), labelX, labelY); // Show RPM in thousands
+  }
 }
 
 void drawRPMBarBlocks(int rpm, int maxRPM) {
-  static int lastFilledBlocks = -1; // Remember last state to avoid unnecessary redraws
-  static uint32_t lastUpdate = 0;
-  static bool firstRun = true;
-  static bool labelsDrawn = false; // Flag to track if labels have been drawn
-
-  
-  // Limit update frequency to reduce flicker - increased from 50ms to 75ms for better performance
-  if (millis() - lastUpdate < 75) { // Update max every 75ms
+  static uint32_t lastFrame = 0;
+  static int32_t shownRpm = 0;          // Interpolated RPM currently represented by the bar
+  static int lastFilledBlocks = 0;
+  static int peakBlock = -1;            // Index of the peak-hold marker, -1 when none
+  static uint32_t peakTime = 0;
+  static bool lastFlashOn = false;
+  static uint16_t drawnColor[RPM_BAR_BLOCKS]; // Color currently on the panel for each block
+
+  uint32_t now = millis();
+  uint32_t dt = now - lastFrame;
+  if (!rpmBarFirstRun && dt < RPM_BAR_FRAME_MS) {
     return;
   }
-  lastUpdate = millis();
-  
-  int startX = 120;     // Starting X position
-  int startY[30] = {80, 75, 70, 65, 60, 57, 54, 51, 48, 46, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45};
-  int blockWidth = 6;   // Width of each block
-  int blockHeight = 70; // Height of each block
-  int spacing = 2;      // Spacing between blocks
-  int numBlocks = 30;   // Total number of blocks
-
-  // Calculate number of filled blocks based on RPM value
-  int filledBlocks = 0;
-  if (rpm > 0) {
-    filledBlocks = map(rpm, 0, maxRPM, 1, numBlocks); // Start from 1, not 0
-    filledBlocks = constrain(filledBlocks, 1, numBlocks); // Ensure 1-30 range when RPM > 0
+  lastFrame = now;
+
+  if (maxRPM <= 0) {
+    maxRPM = DEFAULT_MAX_RPM;
+  }
+  if (rpm < 0) {
+    rpm = 0;
   }
-  // When RPM = 0, filledBlocks = 0 (no blocks lit)
-  
-  // If first run, clear entire area and initialize all blocks as empty
-  if (firstRun) {
-    display.fillRect(startX - 10, 40, (blockWidth + spacing) * numBlocks + 20, blockHeight + 80, TFT_BLACK);
-    // Draw all blocks as empty initially
-    for (int i = 0; i < numBlocks; i++) {
-      int blockX = startX + i * (blockWidth + spacing);
-      int blockY = startY[i];
-      display.fillRect(blockX, blockY, blockWidth, blockHeight, TFT_DARKGREY);
+
+  // Resolved once per pass so a theme switch recolors the whole bar on its next redraw
+  const uint16_t emptyColor = themeColor(THEME_INACTIVE);
+  const uint16_t highlightColor = themeColor(THEME_HIGHLIGHT);
+
+  bool fullRedraw = rpmBarFirstRun;
+  if (rpmBarFirstRun) {
+    // Clear entire area and draw all blocks as empty
+    display.fillRect(rpmBarX - 10, rpmBarY, (RPM_BAR_BLOCK_WIDTH + RPM_BAR_SPACING) * RPM_BAR_BLOCKS + 20, RPM_BAR_BLOCK_HEIGHT + 80, themeColor(THEME_BACKGROUND));
+    for (int i = 0; i < RPM_BAR_BLOCKS; i++) {
+      display.fillRect(rpmBarX + i * (RPM_BAR_BLOCK_WIDTH + RPM_BAR_SPACING), rpmBarY + rpmBarBlockY[i], RPM_BAR_BLOCK_WIDTH, RPM_BAR_BLOCK_HEIGHT, emptyColor);
+      drawnColor[i] = emptyColor;
     }
-    
-    // Reset labelsDrawn flag to ensure labels are drawn
-    labelsDrawn = false;
-    firstRun = false;
+    drawRPMBarLabels(maxRPM);
+    lastFilledBlocks = 0;
+    peakBlock = -1;
+    lastFlashOn = false;
+    shownRpm = 0;
+    rpmBarFirstRun = false;
+  }
+
+  // Glide towards the latest sample instead of jumping, so the bar keeps
+  // moving at frame rate between ECU updates
+  int32_t diff = rpm - shownRpm;
+  if (fullRedraw || dt >= RPM_BAR_SMOOTHING_MS) {
+    shownRpm = rpm;
+  } else {
+    int32_t step = diff * (int32_t)dt / RPM_BAR_SMOOTHING_MS;
+    shownRpm += (step != 0) ? step : diff;
+  }
+
+  int filledBlocks = rpmToFilledBlocks(shownRpm, maxRPM);
+
+  // Peak hold: follow the fill upwards, hold, then fall back to the current fill
+  int lastPeakBlock = peakBlock;
+  if (filledBlocks - 1 >= peakBlock) {
+    peakBlock = filledBlocks - 1;
+    peakTime = now;
+  } else if (now - peakTime > RPM_PEAK_HOLD_MS) {
+    peakBlock = filledBlocks - 1;
   }
-  
-  // Draw RPM labels if not already drawn
-  if (!labelsDrawn) {
-    display.setTextSize(1);
-    display.setTextColor(TFT_WHITE, TFT_BLACK);
-    
-    // Calculate number of labels based on maxRPM (every 1000 RPM)
-    int numLabels = (maxRPM / 1000) + 1; // For 6000: 7 labels (0-6), For 8000: 9 labels (0-8)
-    int labelStep = 1000; // Every 1000 RPM
-    
-    for (int i = 0; i < numLabels; i++) {
-      int labelRPM = i * labelStep;
-      int labelBlock = map(labelRPM, 0, maxRPM, 0, numBlocks);
-      labelBlock = constrain(labelBlock, 0, numBlocks - 1);
-      
-      int labelX = startX + labelBlock * (blockWidth + spacing) + blockWidth / 2;
-      // Calculate Y position based on the specific block's Y position + block height + offset
-      int labelY = startY[labelBlock] + blockHeight + 8; // 8px below the specific block
-      
-      // Draw the label
-      display.setTextDatum(MC_DATUM);
-      display.drawString(String(labelRPM / 1000), labelX, labelY); // Show RPM in thousands
-      
+
+  // Shift flash toggles the lit blocks at and above the shift point
+  int shiftBlock = (RPM_SHIFT_POINT > 0) ? rpmToFilledBlocks(RPM_SHIFT_POINT, maxRPM) - 1 : RPM_BAR_BLOCKS;
+  bool flashOn = (RPM_SHIFT_POINT > 0 && shownRpm >= RPM_SHIFT_POINT) && ((now / RPM_SHIFT_FLASH_MS) & 1) != 0;
+
+  // Only the span between the old and new state can change color
+  int lo = min(lastFilledBlocks, filledBlocks);
+  int hi = max(lastFilledBlocks, filledBlocks) - 1;
+  if (lastPeakBlock != peakBlock) {
+    if (lastPeakBlock >= 0) {
+      lo = min(lo, lastPeakBlock);
+      hi = max(hi, lastPeakBlock);
     }
-    
-    labelsDrawn = true;
+    if (peakBlock >= 0) {
+      lo = min(lo, peakBlock);
+      hi = max(hi, peakBlock);
+    }
+  }
+  if (flashOn || lastFlashOn) {
+    lo = min(lo, shiftBlock);
+    hi = max(hi, filledBlocks - 1);
   }
+  lo = max(lo, 0);
+  hi = min(hi, RPM_BAR_BLOCKS - 1);
 
-  // Force update ALL blocks to ensure correct state
-  for (int i = 0; i < numBlocks; i++) {
-    int blockX = startX + i * (blockWidth + spacing);
-    int blockY = startY[i];
+  for (int i = lo; i <= hi; i++) {
     uint16_t color;
-    
-    // Determine color based on current state - VERY EXPLICIT
-    if (rpm == 0) {
-      // Force all blocks to be empty when RPM is 0
-      color = TFT_DARKGREY;
-    } else if (i < filledBlocks) {
-      // Block should be filled when RPM > 0
-      if (i < 15) {
-        color = TFT_GREEN;   // Green for normal RPM
-      } else if (i < 25) {
-        color = TFT_ORANGE;  // Orange for high RPM
-      } else {
-        color = TFT_RED;     // Red for danger zone
-      }
+    if (i < filledBlocks) {
+      color = (flashOn && i >= shiftBlock) ? highlightColor : themeColor(rpmBarBlockRole[i]);
+    } else if (i == peakBlock) {
+      color = highlightColor;
     } else {
-      // Block should be empty
-      color = TFT_DARKGREY;
+      color = emptyColor;
     }
-    
-    // Only redraw if the color should change
-    if (lastFilledBlocks == -1 || 
-        (i < filledBlocks) != (i < lastFilledBlocks) ||
-        (rpm == 0 && lastFilledBlocks > 0)) {
-      display.fillRect(blockX, blockY, blockWidth, blockHeight, color);
+
+    if (drawnColor[i] != color) {
+      display.fillRect(rpmBarX + i * (RPM_BAR_BLOCK_WIDTH + RPM_BAR_SPACING), rpmBarY + rpmBarBlockY[i], RPM_BAR_BLOCK_WIDTH, RPM_BAR_BLOCK_HEIGHT, color);
+      PROFILE_SPI(RPM_BAR_BLOCK_WIDTH * RPM_BAR_BLOCK_HEIGHT);
+      drawnColor[i] = color;
     }
   }
-  
+
   lastFilledBlocks = filledBlocks;
+  lastFlashOn = flashOn;
 }
@@ -6,6 +6,7 @@
 
 void drawCenteredTextSmall(int x, int y, int w, int h, const char* text, int textSize, uint16_t color);
 void drawSmallButton(int x, int y, const char* label, bool value);
+void configureRPMBar(int16_t x, int16_t y);
 void drawRPMBarBlocks(int rpm, int maxRPM = DEFAULT_MAX_RPM);
 
 #endif // DRAWING_UTILS_H
@@ -1,8 +1,8 @@
 #include <Arduino.h>
-#include <EEPROM.h>
 #include <WiFi.h>
 #include <WebServer.h>
 #include <TFT_eSPI.h>
+#include <esp_timer.h>
 
 // Include all our modular headers
 #include "Config.h"
@@ -18,6 +18,20 @@
 #include "Comms.h"
 #include "text_utils.h"
 #include "drawing_utils.h"
+#include "DigitRenderer.h"
+#include "Layout.h"
+#include "Profiler.h"
+#include "FrameCapture.h"
+#include "NativePush.h"
+#include "ChannelFilter.h"
+#include "ChannelBands.h"
+#include "HistoryGraph.h"
+#include "BootSequencer.h"
+#include "Theme.h"
+#include "Metrics.h"
+#include "OtaUpdate.h"
+#include "ConfigStore.h"
+#include "DataLogger.h"
 #if ENABLE_SIMULATOR
 #include "Simulator.h"
 #endif
@@ -55,12 +69,13 @@ void handleSerialCommands()
       case 'd':
       case 'D':
         debugMode = !debugMode;
+        profilerEnabled = debugMode;
         Serial.printf("[DEBUG] Debug mode %s\n", debugMode ? "ON" : "OFF");
         Serial.printf("[DEBUG] debugMode variable value: %d\n", debugMode);
         Serial.printf("[DEBUG] CPU Usage: %.1f, FPS: %.1f\n", cpuUsage, fps);
         if (debugMode) {
           Serial.println("=== DEBUG MODE ENABLED ===");
-          Serial.println("CPU Usage and FPS will be displayed");
+          Serial.println("CPU usage, FPS, frame time and SPI load will be displayed");
           Serial.println("Serial debug prints enabled");
           Serial.println("Send 'd' again to disable");
           Serial.println("==========================");
@@ -83,6 +98,29 @@ void handleSerialCommands()
         Serial.printf("Chip Revision: %d\n", ESP.getChipRevision());
         Serial.printf("Uptime: %d seconds\n", (millis() - startupTime) / 1000);
         Serial.println("==================");
+        printBootTimeline();
+        break;
+      case 'r':
+      case 'R':
+        // Show digit render stats and start a new measurement window
+        printDigitRenderStats();
+        resetDigitRenderStats();
+        break;
+      case 'c':
+      case 'C':
+        // Dump the current screen as PPM (see tools/frame_capture.py)
+        captureFrame();
+        break;
+      case 'u':
+      case 'U':
+        // Achieved widget update intervals (and reset)
+        printSchedulerStats();
+        break;
+      case 'n':
+      case 'N':
+        // A/B the native 18-bit push path (compare spiFlush in the profiler)
+        nativePushEnabled = !nativePushEnabled;
+        Serial.printf("[DEBUG] Native 18-bit push %s\n", nativePushEnabled ? "ON" : "OFF");
         break;
 #endif
       case 'h':
@@ -101,12 +139,49 @@ void handleSerialCommands()
         Serial.println("DEBUG COMMANDS:");
         Serial.println("d = Toggle debug mode");
         Serial.println("i = Show system info");
+        Serial.println("r = Show render stats (and reset)");
+        Serial.println("c = Capture screen as PPM over serial");
+        Serial.println("n = Toggle native 18-bit sprite push");
+        Serial.println("u = Show widget scheduler stats (and reset)");
 #endif
+        Serial.println("DISPLAY COMMANDS:");
+        Serial.println("p = Next display page (Street/Track/Diagnostics)");
+        Serial.println("t = Toggle day/night theme");
+        Serial.println("LOGGER COMMANDS:");
+        Serial.println("l = Start/stop a datalog by hand");
         Serial.println("NETWORK COMMANDS:");
         Serial.println("w = Restart WiFi/Web Server");
         Serial.println("h = Show this help");
         Serial.println("===================");
         break;
+      case 'p':
+      case 'P':
+        // Cycle display pages
+        setActivePage((getActivePage() + 1) % PAGE_COUNT);
+        Serial.printf("Display page: %s\n", getPageName(getActivePage()));
+        break;
+      case 't':
+      case 'T':
+        // Toggle day/night palette; widgets restyle over the next frames
+        setTheme(getTheme() == THEME_DAY ? THEME_NIGHT : THEME_DAY);
+        Serial.printf("Theme: %s\n", getThemeName(getTheme()));
+        break;
+      case 'l':
+      case 'L': {
+        // Manual datalog start/stop
+        LoggerStatus status;
+        getLoggerStatus(status);
+        if (status.state == LOGGER_RECORDING) {
+          loggerStop();
+          Serial.println("Datalog stopping");
+        } else if (status.state == LOGGER_ARMED) {
+          loggerStart();
+          Serial.println("Datalog started");
+        } else {
+          Serial.printf("Datalogger %s\n", getLoggerStateName(status.state));
+        }
+        break;
+      }
       case 'w':
       case 'W':
         // Restart WiFi/Web Server
@@ -117,62 +192,12 @@ void handleSerialCommands()
   }
 }
 
-// Calculate CPU usage percentage (simplified approach)
-void updateCpuUsage()
+// Pull CPU usage and rendered FPS from the profiler's last window
+void updateDebugMetrics()
 {
-  static uint32_t lastMeasureTime = 0;
-  static uint32_t loopCount = 0;
-  
-  uint32_t currentTime = millis();
-  loopCount++;
-  
-  if (lastMeasureTime == 0) {
-    lastMeasureTime = currentTime;
-    cpuUsage = 0.0;
-    return;
-  }
-  
-  if (currentTime - lastMeasureTime >= 1000) { // Update every second
-    // Simple approximation: more loops per second = higher CPU usage
-    // This is a rough estimate for demonstration
-    float loopsPerSecond = (float)loopCount / ((float)(currentTime - lastMeasureTime) / 1000.0);
-    cpuUsage = min(loopsPerSecond / 10.0, 100.0); // Scale to reasonable range
-    
-    lastMeasureTime = currentTime;
-    loopCount = 0;
-    
-    // Debug print CPU calculation
-    if (debugMode) {
-      Serial.printf("[DEBUG] CPU calc - Loops/sec: %.1f, Usage: %.1f%%\n", 
-                    loopsPerSecond, cpuUsage);
-    }
-  }
-}
-
-// Calculate FPS (frames per second)
-void updateFPS()
-{
-  frameCount++;
-  uint32_t currentTime = millis();
-  
-  if (lastFpsUpdate == 0) {
-    lastFpsUpdate = currentTime;
-    fps = 0.0;
-    return;
-  }
-  
-  if (currentTime - lastFpsUpdate >= 1000) { // Update every second
-    float timeDelta = (float)(currentTime - lastFpsUpdate) / 1000.0;
-    fps = (float)frameCount / timeDelta;
-    frameCount = 0;
-    lastFpsUpdate = currentTime;
-    
-    // Debug print FPS calculation
-    if (debugMode) {
-      Serial.printf("[DEBUG] FPS calc - Frames: %d, Delta: %.2fs, FPS: %.1f\n", 
-                    frameCount, timeDelta, fps);
-    }
-  }
+  const ProfileReport &report = getProfileReport();
+  cpuUsage = report.cpuUsage;
+  fps = report.fps;
 }
 
 #if ENABLE_DEBUG_MODE
@@ -187,8 +212,15 @@ void printDebugInfo()
   // Increase debug print interval from 2s to 5s to reduce serial overhead
   if (currentTime - lastDebugPrint >= 5000) { // Print every 5 seconds
     Serial.println("=== DEBUG INFO ===");
+    const ProfileReport &report = getProfileReport();
     Serial.printf("CPU Usage: %.1f%%\n", cpuUsage);
-    Serial.printf("FPS: %.1f\n", fps);
+    Serial.printf("FPS: %.1f (loops/s: %.0f)\n", fps, report.loopsPerSecond);
+    Serial.printf("Frame time: avg %uus, p50 %uus, p99 %uus, max %uus\n",
+                  report.avgFrameUs, report.p50FrameUs, report.p99FrameUs, report.maxFrameUs);
+    Serial.printf("SPI: %u bytes/s, %u transactions/s\n", report.spiBytesPerSecond, report.spiTransactionsPerSecond);
+    for (int i = 0; i < PROF_SCOPE_COUNT; i++) {
+      Serial.printf("  %-10s %6uus x %u/s\n", getProfileScopeName(i), report.scopeAvgUs[i], report.scopeCallsPerSecond[i]);
+    }
     Serial.printf("Free Heap: %d bytes\n", ESP.getFreeHeap());
     Serial.printf("Min Free Heap: %d bytes\n", ESP.getMinFreeHeap());
     Serial.printf("RPM: %d\n", rpm);
@@ -204,25 +236,26 @@ void printDebugInfo()
 
 void setup()
 {
-  EEPROM.begin(EEPROM_SIZE);
+  Serial.begin(UART_BAUD);
+  bootMark("serial up");
+  otaCheckBoot();
+  configStoreBegin();
+  configLoad(CONFIG_RECORD_SYSTEM);
   
   // Initialize backlight control
   setupBacklight();
   
-  // Initialize display
+  // Initialize display (also loads the display configuration)
   setupDisplay();
-  drawSplashScreenWithImage();
-  display.fillScreen(TFT_BLACK);
+  // Value color bands, before the first frame evaluates them
+  loadChannelBands();
+  bootMark("display + config");
   
-  Serial.begin(UART_BAUD);
-  commMode = EEPROM.read(1);
+  // Splash goes up immediately; it stays on screen while the rest boots
+  drawSplashScreenWithImage();
+  bootSplashShown();
   
-  // If EEPROM is uninitialized (0xFF), set default to CAN mode
-  if (commMode == 255) {
-    commMode = COMM_CAN;
-    EEPROM.write(1, commMode);
-    EEPROM.commit();
-  }
+  commMode = systemSettings.commMode;
   
   Serial.println("=== MAZDUINO DASHBOARD STARTING ===");
   Serial.printf("Communication mode: %s\n", (commMode == COMM_CAN) ? "CAN" : "Serial");
@@ -230,13 +263,16 @@ void setup()
   // Synchronize isCANMode with commMode
   isCANMode = (commMode == COMM_CAN);
   
+  // Comm tasks start behind the splash so data is flowing when it lifts
   if (commMode == COMM_CAN)
   {
     // Initialize CAN communication
     setupCAN();
     
     // Create CAN task on core 0
-    xTaskCreatePinnedToCore(canTask, "CAN Task", 4096, NULL, 1, NULL, 0);
+    TaskHandle_t commTask = NULL;
+    xTaskCreatePinnedToCore(canTask, "CAN Task", 4096, NULL, 1, &commTask, 0);
+    metricsRegisterTask("can", commTask);
     
     Serial.println("CAN mode aktif.");
   }
@@ -246,28 +282,33 @@ void setup()
     setupSerial();
     
     // Create Serial task on core 0
-    xTaskCreatePinnedToCore(serialTask, "Serial Task", 4096, NULL, 1, NULL, 0);
+    TaskHandle_t commTask = NULL;
+    xTaskCreatePinnedToCore(serialTask, "Serial Task", 4096, NULL, 1, &commTask, 0);
+    metricsRegisterTask("serial", commTask);
     
     Serial.println("Serial mode aktif.");
   }
+  bootMark("comm task started");
+
+  // Datalogger samples from the decoded values, so it starts after the comm task
+  setupDataLogger();
+  bootMark("datalogger");
 
   // Initialize web server setup (will start after 15 seconds)
   setupWebServer();
+  metricsRegisterTask("loop", xTaskGetCurrentTaskHandle());
 
 #if ENABLE_SIMULATOR
   // Initialize simulator
   initializeSimulator();
-  delay(1000); // Give time for simulator messages to appear
 #endif
 
 #if ENABLE_DEBUG_MODE
   // Initialize debug mode
   debugMode = false;
+  profilerEnabled = false;
   cpuUsage = 0.0;
   fps = 0.0;
-  frameCount = 0;
-  lastFpsUpdate = 0;  // Reset to 0 for proper initialization
-  lastCpuMeasure = 0; // Reset to 0 for proper initialization
   
   Serial.println("=== DEBUG MODE AVAILABLE ===");
   Serial.println("Send 'd' to toggle debug mode");
@@ -276,28 +317,38 @@ void setup()
   Serial.printf("Initial debug values - CPU: %.1f%%, FPS: %.1f\n", cpuUsage, fps);
   Serial.println("============================");
 #endif
+  bootMark("web/sim/debug setup");
 
-  EEPROM.write(0, 1);
-  delay(500);
-  startUpDisplay();
+  // Compile the layout while the splash is still up; bootUpdate() in loop()
+  // releases the splash and draws the dashboard
+  prepareDisplay();
+  bootMark("layout compiled");
+  
   startupTime = millis();
   lazyUpdateTime = startupTime;
   lastClientCheckTimeout = startupTime;
 }
 
+// Render time of the last pass that pushed pixels
+static uint32_t lastFrameUs = 0;
+
+// One drawData() pass; passes that pushed pixels count toward frame metrics
+static void renderFrame()
+{
+  uint32_t frameStart = (uint32_t)esp_timer_get_time();
+  drawData();
+  if (framePushed) {
+    lastFrameUs = (uint32_t)esp_timer_get_time() - frameStart;
+    metricsRecordFrame(lastFrameUs);
+  }
+}
+
 void loop()
 {
 #if ENABLE_DEBUG_MODE
   loopStartTime = millis(); // Start timing for CPU usage
 #endif
 
-  // Start web server after 15 seconds to avoid high startup power consumption
-  static bool webServerStarted = false;
-  if (!webServerStarted && (millis() - startupTime >= 15000)) {
-    startWebServer();
-    webServerStarted = true;
-  }
-
   // Handle all serial commands (simulator and debug) in one place
   handleSerialCommands();
 
@@ -313,10 +364,12 @@ void loop()
   }
 #endif
 
+  // Outside the debug guard: /profile can enable the profiler in any build
+  profilerUpdate();
+
 #if ENABLE_DEBUG_MODE
   // Update debug metrics
-  updateCpuUsage();
-  updateFPS();
+  updateDebugMetrics();
   
   // Print debug info if enabled
   printDebugInfo();
@@ -334,16 +387,27 @@ void loop()
   // Update backlight brightness
   adjustBacklightAutomatically();
 
-  // Update display
-  drawData();
+  // Web handlers change layout/config between frames, never during one
+  lockDisplayState();
 
-  // Handle web server clients with power-saving logic
-  // Reduce web server check frequency from every loop to every 10ms
-  static uint32_t lastWebServerCheck = 0;
-  if (millis() - lastWebServerCheck >= 10) {
-    handleWebServerClients();
-    lastWebServerCheck = millis();
+  // Smooth and deadband the decoded values before they reach the panels
+  updateChannelFilters(millis());
+  recordHistory(millis());
+
+  // Update display once the boot sequence has released the splash
+  framePushed = false;
+  if (bootUpdate()) {
+    PROFILE_CALL(PROF_FRAME, renderFrame());
+  }
+  releaseDisplayState(); // Lets a waiting web handler in before the next frame
+  // Ticks while the splash is still held too, so a silent ECU still times out
+  otaHealthTick(framePushed);
+  if (framePushed) {
+    loggerFrameDone(lastFrameUs);
   }
+  profilerEndFrame();
+
+  // HTTP is served by its own task on core 0 (see setupWebServer)
   
   // Add small yield to prevent watchdog issues and improve multitasking
   yield();
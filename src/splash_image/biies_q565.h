@@ -0,0 +1,3839 @@
+// 'biies', 480x320px, Q565 compressed (61347 bytes, raw 307200)
+// Generated by tools/compress_splash.py - do not edit
+const uint8_t splash_biies_q565[] PROGMEM = {
+	0x51, 0x35, 0x36, 0x35, 0xe0, 0x01, 0x40, 0x01, 0xfe, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xe7, 0x66,
+	0xc0, 0x31, 0xc9, 0x2c, 0xc0, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf8, 0x2c, 0xc2, 0x31,
+	0xc2, 0x2c, 0x31, 0xd4, 0x2c, 0x31, 0xc3, 0x2c, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xd1, 0x2c, 0xc0, 0x31, 0xc0, 0x2c, 0xc0, 0x31, 0xc2, 0x2c, 0x55, 0x2c, 0x31, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xd3, 0x2c, 0x31, 0xc2, 0x2c, 0xc0, 0x31, 0xc1, 0x2c, 0xc1, 0x1d, 0x66,
+	0x55, 0xc1, 0x51, 0xc2, 0x66, 0x9c, 0xaa, 0x9d, 0x99, 0x51, 0xc4, 0x25, 0x61, 0x11, 0xa4, 0x66,
+	0xa3, 0x77, 0x6e, 0xc1, 0x35, 0x09, 0xc2, 0x18, 0x1d, 0x2c, 0xc0, 0x31, 0xc1, 0x2c, 0xc1, 0x31,
+	0x2c, 0xc0, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf6, 0x1d, 0x09, 0x35, 0x1c, 0x39, 0x11,
+	0x51, 0x9d, 0xaa, 0x9c, 0xaa, 0x9c, 0xaa, 0x9d, 0x99, 0x66, 0xc0, 0x55, 0x9d, 0xaa, 0x51, 0x6e,
+	0x30, 0x9a, 0xbb, 0x9b, 0xaa, 0x51, 0xc5, 0x66, 0xa2, 0x77, 0xa5, 0x55, 0xa5, 0x66, 0x35, 0x04,
+	0xc0, 0xa2, 0x77, 0x2c, 0xc0, 0x31, 0x7f, 0xa5, 0x55, 0xa2, 0x77, 0xa4, 0x66, 0x11, 0xa3, 0x77,
+	0x08, 0x7e, 0xa5, 0x56, 0xa2, 0x77, 0xa2, 0x77, 0x6e, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf5,
+	0x51, 0x9c, 0xaa, 0x08, 0x9d, 0x99, 0x97, 0xdd, 0x14, 0x9a, 0xbb, 0x30, 0x9d, 0xaa, 0x9d, 0x99,
+	0x55, 0x66, 0x55, 0x62, 0x38, 0x55, 0xc0, 0x38, 0x29, 0xc2, 0x24, 0x69, 0x29, 0xc5, 0x24, 0x1d,
+	0x24, 0xc0, 0x29, 0x24, 0xc0, 0x38, 0xc0, 0x29, 0x7a, 0x3d, 0x11, 0xc0, 0x20, 0x34, 0xa2, 0x77,
+	0x1c, 0x30, 0xa5, 0x55, 0xa7, 0x55, 0xa8, 0x44, 0x39, 0x21, 0x04, 0xa4, 0x66, 0x31, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xdb, 0x65, 0xc0, 0x31, 0xc6, 0x2c, 0xc1, 0x66, 0x31, 0xc1, 0x2c, 0x04,
+	0x9b, 0xaa, 0x9a, 0xbb, 0x3c, 0x97, 0xdc, 0x98, 0xcc, 0x9c, 0xaa, 0x9d, 0xaa, 0x9d, 0xaa, 0xc0,
+	0x56, 0xc0, 0x69, 0x66, 0x27, 0x6f, 0xc2, 0x2e, 0x24, 0x27, 0x69, 0x6e, 0xc5, 0x20, 0x5a, 0xc1,
+	0x6e, 0xc3, 0x1d, 0xc3, 0x66, 0xc0, 0x1d, 0x29, 0xc0, 0x24, 0xc0, 0x29, 0xc1, 0x7f, 0x3d, 0x6e,
+	0x7f, 0xa6, 0x55, 0xa6, 0x55, 0x2d, 0xa7, 0x55, 0x39, 0x04, 0x2c, 0x31, 0xc9, 0x2c, 0x31, 0xc1,
+	0x2c, 0xc1, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xcd, 0x2c, 0xc0, 0x31, 0x2c, 0xc0, 0x9c,
+	0xba, 0x9d, 0x99, 0x9a, 0xbb, 0x99, 0xbc, 0x14, 0x09, 0x99, 0xcb, 0x9a, 0xbc, 0x51, 0x51, 0xc0,
+	0x27, 0x6e, 0x62, 0xc0, 0x27, 0xc2, 0x56, 0x65, 0xc0, 0x1f, 0x24, 0xc1, 0x18, 0xc0, 0x1d, 0xc0,
+	0x20, 0xc4, 0x1d, 0xc1, 0x6e, 0xc1, 0x1d, 0xc2, 0x27, 0xc0, 0x24, 0x1f, 0xc0, 0x18, 0x24, 0xc4,
+	0x1d, 0xc0, 0x29, 0x1d, 0x56, 0x1d, 0xa2, 0x67, 0x2c, 0xa2, 0x77, 0xa4, 0x66, 0xa6, 0x55, 0xaa,
+	0x33, 0xaa, 0x23, 0xa5, 0x66, 0xa6, 0x55, 0xa5, 0x55, 0xa3, 0x77, 0x31, 0xc1, 0x2c, 0x69, 0x31,
+	0xc1, 0x2c, 0x55, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xc8, 0x2c, 0x31, 0xc1, 0x2c, 0xc3,
+	0x9d, 0xa9, 0x9c, 0xaa, 0x98, 0xcc, 0x99, 0xcb, 0x96, 0xde, 0x9c, 0xaa, 0x10, 0x28, 0x3d, 0x9d,
+	0xaa, 0x59, 0x7f, 0x56, 0x29, 0xc1, 0x24, 0x69, 0x22, 0xc3, 0x1d, 0xc0, 0x22, 0xc3, 0x1f, 0xc1,
+	0x24, 0xc0, 0x27, 0xc2, 0x24, 0xc2, 0x29, 0xc0, 0x1d, 0x24, 0xc0, 0x7e, 0xc0, 0x24, 0xc2, 0x7b,
+	0xc0, 0x1d, 0xc1, 0x18, 0x1d, 0xc1, 0x7a, 0xc2, 0x18, 0xc0, 0x69, 0x1d, 0x69, 0x20, 0x00, 0xa4,
+	0x65, 0xa1, 0x89, 0xa6, 0x44, 0xa5, 0x66, 0x3c, 0xa8, 0x44, 0x1c, 0xa5, 0x66, 0xa3, 0x66, 0x31,
+	0xc4, 0x9d, 0xaa, 0x2c, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xca, 0x2c, 0x65, 0x51, 0x9c,
+	0xaa, 0x97, 0xdd, 0x96, 0xdd, 0x97, 0xdc, 0x98, 0xcc, 0x9a, 0xba, 0x56, 0x51, 0x56, 0xc0, 0x1d,
+	0x6f, 0xc2, 0x6e, 0xc0, 0x56, 0x66, 0x29, 0xc2, 0x22, 0x1d, 0xc0, 0x22, 0xc0, 0x79, 0xc2, 0x20,
+	0xc1, 0x66, 0xc6, 0x69, 0x6e, 0x20, 0x19, 0xc1, 0x20, 0xc4, 0x27, 0x66, 0xc0, 0x20, 0xc0, 0x1d,
+	0x18, 0x1b, 0x20, 0x27, 0xc0, 0x22, 0xc0, 0x27, 0xc1, 0x1b, 0x20, 0xc3, 0x1d, 0x7f, 0xc0, 0x7f,
+	0x28, 0xaa, 0x33, 0xa8, 0x44, 0xaa, 0x23, 0xa7, 0x44, 0x04, 0x31, 0xc1, 0x66, 0x31, 0xc1, 0x2c,
+	0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xc7, 0x51, 0x99, 0xcc, 0x97, 0xdd, 0x96, 0xdc, 0x97,
+	0xcd, 0x28, 0x9a, 0xcb, 0x20, 0xc0, 0x7e, 0x34, 0x56, 0x20, 0x5e, 0x29, 0x22, 0x29, 0xc0, 0x26,
+	0xc0, 0x2e, 0xc1, 0x29, 0xc2, 0x65, 0xc1, 0x20, 0x19, 0xc0, 0x65, 0xc1, 0x7a, 0x66, 0x10, 0x69,
+	0xcb, 0x10, 0xc0, 0x0b, 0xc0, 0x10, 0xc1, 0x0b, 0xc0, 0x6b, 0x19, 0x20, 0x1b, 0xc1, 0x20, 0x67,
+	0xc2, 0x6b, 0xc0, 0x66, 0x22, 0x1b, 0x27, 0x2f, 0x27, 0x20, 0xc0, 0x2c, 0x69, 0x1d, 0x11, 0x25,
+	0xa2, 0x77, 0xa3, 0x67, 0xa6, 0x45, 0xaa, 0x34, 0xab, 0x32, 0xa9, 0x34, 0xa8, 0x44, 0x31, 0xc1,
+	0x56, 0x65, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xc4, 0x66, 0x98, 0xcc, 0x97, 0xcd, 0x98,
+	0xcc, 0x96, 0xdc, 0x94, 0xee, 0x9a, 0xbc, 0x69, 0x7f, 0x7e, 0xc1, 0x20, 0x5a, 0x18, 0x1d, 0x6f,
+	0x2c, 0x59, 0x1d, 0xc0, 0x16, 0xc0, 0x1d, 0x25, 0xc0, 0x20, 0xc0, 0x7a, 0x69, 0x66, 0x10, 0x0b,
+	0x69, 0xc0, 0x7a, 0x7e, 0x6e, 0x7e, 0x7d, 0xc0, 0x7e, 0x6e, 0x7f, 0xc4, 0x6e, 0xc1, 0x39, 0xc0,
+	0x6f, 0xc0, 0x66, 0x55, 0x66, 0x56, 0x65, 0x5a, 0x62, 0x5a, 0x66, 0x4f, 0x10, 0x0d, 0xc1, 0x6b,
+	0xc0, 0x66, 0x1b, 0x27, 0xc0, 0x6b, 0xc0, 0x65, 0xc0, 0x27, 0x33, 0x27, 0x55, 0xc0, 0x51, 0xa3,
+	0x66, 0xa2, 0x76, 0xc1, 0x5a, 0x66, 0x21, 0xc0, 0xa4, 0x66, 0xa9, 0x44, 0xac, 0x21, 0xa8, 0x45,
+	0xab, 0x32, 0xa7, 0x44, 0xa2, 0x77, 0xc1, 0x69, 0x67, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc,
+	0x1d, 0x9c, 0xba, 0x1c, 0xfe, 0xa4, 0xf3, 0x93, 0xef, 0x94, 0xee, 0x9c, 0xaa, 0x6f, 0xc1, 0x6e,
+	0x30, 0x29, 0x24, 0xc0, 0x69, 0x24, 0xc0, 0x1d, 0x22, 0x7a, 0x20, 0x69, 0x7e, 0x65, 0x10, 0xc0,
+	0x69, 0xc0, 0x7a, 0x7a, 0x6e, 0x7e, 0xc0, 0x7a, 0x7e, 0xa2, 0x76, 0xa2, 0x77, 0xa3, 0x76, 0xa3,
+	0x76, 0xa2, 0x77, 0xa2, 0x76, 0xa3, 0x86, 0x6d, 0x7f, 0x6e, 0x7f, 0x6e, 0xc6, 0x21, 0x6f, 0xc1,
+	0x66, 0x55, 0x66, 0x5a, 0x00, 0x41, 0x9d, 0xaa, 0x51, 0x51, 0x39, 0x46, 0x66, 0x56, 0x56, 0xc0,
+	0x56, 0xc0, 0x15, 0x66, 0x5a, 0xc0, 0x6f, 0x23, 0x1b, 0x56, 0xc0, 0x18, 0x20, 0xa2, 0x77, 0x56,
+	0x22, 0x1d, 0x59, 0xc1, 0xa1, 0x89, 0x6e, 0x29, 0x5a, 0x29, 0x35, 0x7f, 0xac, 0x22, 0xad, 0x21,
+	0xac, 0x22, 0xa7, 0x44, 0xa4, 0x66, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf4, 0x66, 0xc2, 0x31,
+	0xc2, 0x9b, 0xbb, 0x99, 0xbb, 0x96, 0xdd, 0x93, 0xff, 0x01, 0x99, 0xcc, 0x51, 0x56, 0xc0, 0x30,
+	0x24, 0x5b, 0xc0, 0x65, 0xc0, 0x24, 0x29, 0x24, 0xc1, 0x69, 0x20, 0x19, 0x7a, 0x10, 0x0c, 0x69,
+	0x7a, 0x7e, 0xa2, 0x77, 0x7e, 0xa4, 0x74, 0x7f, 0xa3, 0x76, 0xa2, 0x77, 0xa2, 0x76, 0xa2, 0x87,
+	0xa2, 0x76, 0xa2, 0x77, 0x7e, 0xa2, 0x76, 0x7a, 0xc0, 0x65, 0x7e, 0x69, 0xc1, 0x66, 0xc2, 0x69,
+	0xc3, 0x15, 0xc0, 0x6b, 0xc1, 0x19, 0xc0, 0x1c, 0xc0, 0x5b, 0xc0, 0x25, 0xc0, 0x46, 0x12, 0x56,
+	0x51, 0x41, 0x9d, 0xab, 0x45, 0x9d, 0x9a, 0x52, 0x41, 0x51, 0x42, 0x52, 0x5b, 0xa0, 0x7a, 0xc3,
+	0x6b, 0x5e, 0x1d, 0x5a, 0xc0, 0x29, 0xc0, 0x1d, 0x22, 0x29, 0xc0, 0x66, 0xc1, 0x30, 0xa2, 0x77,
+	0xa6, 0x54, 0xa9, 0x44, 0xad, 0x21, 0xac, 0x12, 0xa6, 0x65, 0xa3, 0x67, 0x31, 0xc3, 0x2c, 0x31,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xea, 0x2c, 0x31, 0x2c, 0xc2, 0x65, 0x99, 0xbc, 0x98, 0xcc, 0x96,
+	0xdc, 0x93, 0xff, 0x97, 0xcd, 0x9c, 0xaa, 0x65, 0x7e, 0xc0, 0x1d, 0x18, 0x24, 0x29, 0xc0, 0x24,
+	0x1d, 0xc0, 0x20, 0xc0, 0x65, 0xa2, 0x76, 0x19, 0x65, 0x75, 0x7e, 0x7d, 0xa2, 0x87, 0xa3, 0x75,
+	0x7f, 0xa4, 0x75, 0xa3, 0x76, 0xa4, 0x66, 0xa2, 0x86, 0xa2, 0x86, 0x7e, 0x6e, 0x25, 0xc1, 0x69,
+	0x69, 0x7a, 0xc0, 0x69, 0xc0, 0x65, 0x7f, 0xc2, 0x69, 0x66, 0xc6, 0x0f, 0xc1, 0x16, 0x66, 0xc1,
+	0x5a, 0xc2, 0x15, 0x7e, 0x15, 0xc0, 0x6b, 0x6e, 0x25, 0xc0, 0x5b, 0x56, 0x55, 0x52, 0x41, 0x9d,
+	0x9a, 0x9d, 0xaa, 0x9c, 0x8b, 0x46, 0x51, 0x9d, 0x9a, 0x52, 0x56, 0x57, 0xa2, 0x77, 0x14, 0x1b,
+	0x20, 0x6b, 0x56, 0x20, 0x6e, 0xc1, 0x6b, 0x27, 0x5a, 0xc0, 0x6e, 0xc0, 0x24, 0xa5, 0x55, 0xa9,
+	0x43, 0xac, 0x22, 0xaa, 0x23, 0xa8, 0x55, 0xa7, 0x44, 0x31, 0xc0, 0x66, 0x31, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xec, 0x1d, 0x2c, 0x31, 0x2c, 0x95, 0xdd, 0x94, 0xfe, 0x93, 0xee, 0x97, 0xdd, 0x9b,
+	0xab, 0x24, 0x6e, 0x7a, 0xc0, 0x1b, 0x20, 0x25, 0x20, 0xc3, 0x19, 0x7a, 0x15, 0x66, 0x65, 0x69,
+	0x7e, 0x0d, 0xa4, 0x75, 0xa5, 0x65, 0xa5, 0x65, 0xa4, 0x75, 0xa2, 0x87, 0xa2, 0x76, 0xa2, 0x86,
+	0x7e, 0xc0, 0x65, 0x60, 0x6e, 0x7a, 0x1a, 0x0e, 0xc0, 0x6d, 0xc0, 0x69, 0x66, 0x69, 0xc2, 0x7a,
+	0xcb, 0x39, 0xc4, 0x00, 0xc3, 0x66, 0x7a, 0xc1, 0x5b, 0xc0, 0x6b, 0x0e, 0x15, 0x6f, 0x6b, 0x25,
+	0xc0, 0x56, 0x4e, 0x5a, 0x9d, 0x9b, 0x9c, 0xaa, 0x9a, 0xac, 0x9a, 0xbc, 0x9c, 0xac, 0x42, 0x67,
+	0x5b, 0x6f, 0x6b, 0x6b, 0x6c, 0x59, 0xc0, 0x6b, 0x6f, 0x20, 0x56, 0xa3, 0x77, 0x27, 0x2c, 0x38,
+	0x2c, 0x55, 0x6f, 0xa6, 0x55, 0xad, 0x11, 0xaf, 0x11, 0xad, 0x21, 0xa5, 0x56, 0xc0, 0x65, 0x31,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xe4, 0x66, 0xc0, 0x31, 0xc0, 0x2c, 0xc0, 0x65, 0x2c, 0x9c, 0xaa,
+	0x99, 0xcb, 0x95, 0xdd, 0xfe, 0x6b, 0x2c, 0x93, 0xef, 0x65, 0x29, 0x18, 0xc0, 0x2c, 0x6e, 0x2c,
+	0x65, 0xc0, 0x6e, 0x7a, 0x25, 0x14, 0x69, 0x10, 0x79, 0x05, 0x7a, 0x7e, 0x7e, 0xa5, 0x64, 0xa4,
+	0x75, 0xa5, 0x65, 0xa5, 0x65, 0xa3, 0x76, 0x7e, 0x7e, 0x69, 0x65, 0x64, 0xc2, 0x13, 0x69, 0xc0,
+	0x00, 0x6e, 0x6e, 0xc0, 0x69, 0xc1, 0x6e, 0x7e, 0x6e, 0xc1, 0x6e, 0x7f, 0xc1, 0x6e, 0x29, 0xc1,
+	0x2e, 0xc2, 0x69, 0x2e, 0xc2, 0x29, 0xc0, 0x66, 0x5a, 0x15, 0xc0, 0x10, 0x67, 0x7a, 0x56, 0x66,
+	0xc0, 0x66, 0x5b, 0xc1, 0x67, 0xc0, 0x6b, 0xc0, 0x0b, 0xa2, 0x67, 0x6f, 0x6b, 0x56, 0x57, 0x9d,
+	0x9b, 0x97, 0xcd, 0x9c, 0x9c, 0x9c, 0xab, 0x9c, 0xab, 0x46, 0x66, 0x5e, 0x5e, 0xc0, 0x6f, 0x6b,
+	0x23, 0x1b, 0xc0, 0x5a, 0x7f, 0x5a, 0x1d, 0xc0, 0x6f, 0x24, 0x29, 0xa6, 0x55, 0xac, 0x22, 0xaf,
+	0x11, 0xab, 0x22, 0xa7, 0x54, 0x6f, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xe5, 0x66, 0xc0, 0x31, 0xc0,
+	0x51, 0x04, 0x97, 0xdc, 0x93, 0xee, 0xfe, 0x5a, 0xcb, 0x98, 0xcb, 0x24, 0x69, 0xc1, 0x7f, 0xc0,
+	0x24, 0x1d, 0xc0, 0x20, 0x19, 0x14, 0x19, 0x7a, 0x69, 0x65, 0x0f, 0xa2, 0x86, 0xa3, 0x75, 0xa5,
+	0x64, 0xa5, 0x65, 0xa3, 0x86, 0xa4, 0x74, 0x6e, 0x7f, 0x7e, 0x1e, 0x7a, 0x69, 0x65, 0x6d, 0xc0,
+	0x69, 0x6e, 0xc0, 0x69, 0xc0, 0x6e, 0x6e, 0x7f, 0xa2, 0x76, 0xa2, 0x67, 0x6d, 0xc0, 0x7e, 0x6e,
+	0x6f, 0x6e, 0x69, 0xc0, 0x6f, 0xc0, 0x6e, 0xc7, 0x69, 0xc0, 0x20, 0xc2, 0x1b, 0xc1, 0x16, 0x11,
+	0xc0, 0x69, 0x00, 0x66, 0x56, 0x2e, 0x56, 0x61, 0x67, 0x56, 0x66, 0x66, 0xc2, 0x76, 0xc0, 0x07,
+	0xc0, 0x0e, 0x1e, 0x25, 0x42, 0x56, 0x52, 0x9d, 0x8a, 0x9a, 0xcc, 0x9c, 0x9a, 0x9c, 0x8b, 0x9f,
+	0x6a, 0x65, 0x57, 0x6b, 0xc0, 0x14, 0x6b, 0x18, 0x6e, 0x7e, 0x1d, 0xc1, 0x6f, 0x24, 0x55, 0x29,
+	0xa6, 0x55, 0xa7, 0x55, 0xfe, 0xa5, 0x34, 0xaa, 0x33, 0xa8, 0x44, 0x31, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xe3, 0x66, 0xc0, 0x31, 0x09, 0x93, 0xff, 0x93, 0xee, 0x95, 0xed, 0x99, 0xcc, 0x9c, 0xaa,
+	0x24, 0x29, 0x2c, 0x24, 0x1d, 0xc0, 0x2c, 0xc0, 0x1d, 0x61, 0xa3, 0x66, 0x65, 0x66, 0x65, 0x10,
+	0xa3, 0x75, 0xa5, 0x75, 0xa4, 0x75, 0xa4, 0x75, 0xa4, 0x75, 0xa2, 0x95, 0x7f, 0x7d, 0x78, 0x0e,
+	0xc0, 0x07, 0x7e, 0xc0, 0x69, 0x55, 0x6e, 0x6e, 0xa2, 0x76, 0xa2, 0x77, 0x6e, 0x33, 0x3b, 0x6e,
+	0x6e, 0x11, 0xa2, 0x66, 0x6e, 0x69, 0xc0, 0x6e, 0x6e, 0xc2, 0x6e, 0x69, 0xc9, 0x5a, 0xc2, 0x66,
+	0xc1, 0x23, 0xc4, 0x56, 0x7a, 0xc0, 0x66, 0x66, 0x56, 0x76, 0x05, 0x00, 0x33, 0x2e, 0x51, 0x10,
+	0x9c, 0xdc, 0x72, 0x6e, 0x5b, 0x6f, 0xc0, 0x5b, 0x15, 0x6f, 0x5a, 0x6b, 0x41, 0x51, 0x9e, 0x6c,
+	0x9d, 0x7c, 0x9b, 0xaa, 0x99, 0xcd, 0x9d, 0x9a, 0x57, 0x6f, 0x6b, 0x55, 0x6f, 0x6e, 0x5a, 0xc0,
+	0x6b, 0xc0, 0x1d, 0xc0, 0x6b, 0x29, 0xc0, 0xa5, 0x65, 0xa7, 0x45, 0xad, 0x22, 0xb0, 0x00, 0xaa,
+	0x32, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xdb, 0x56, 0x31, 0xc1, 0x66, 0x31, 0xc0, 0x9d, 0xaa,
+	0x95, 0xdd, 0xfe, 0x7b, 0xef, 0xfe, 0x4a, 0x28, 0x9c, 0xaa, 0x9d, 0xaa, 0x6e, 0x5a, 0x22, 0x5a,
+	0x6b, 0x7f, 0xc0, 0x29, 0x2c, 0x20, 0x14, 0x78, 0x7d, 0x76, 0x6e, 0xa2, 0x86, 0xa7, 0x53, 0xa7,
+	0x64, 0xa5, 0x64, 0xa2, 0x86, 0x7a, 0x7d, 0x7a, 0x15, 0x69, 0x6d, 0x59, 0x69, 0xc0, 0x6e, 0xa2,
+	0x76, 0x6e, 0xa2, 0x76, 0xa2, 0x76, 0x05, 0xa2, 0x66, 0x6f, 0x6d, 0xc1, 0x6e, 0xc0, 0x69, 0xc1,
+	0x6e, 0xc4, 0x6e, 0xd1, 0x1c, 0xc8, 0x6b, 0xc0, 0x1e, 0xc1, 0x19, 0xc1, 0x66, 0xc0, 0x9c, 0xcc,
+	0x9d, 0xbb, 0x51, 0x52, 0x03, 0x3e, 0xc0, 0x6f, 0x0c, 0x13, 0xc0, 0x6b, 0x56, 0x5b, 0xa0, 0x7a,
+	0x66, 0x41, 0x9b, 0xab, 0x96, 0xdf, 0x99, 0xae, 0x5a, 0x5b, 0xa2, 0x57, 0x6f, 0x46, 0x5b, 0xa2,
+	0x77, 0xc0, 0x29, 0x56, 0x76, 0x24, 0x27, 0x66, 0x27, 0xa2, 0x77, 0xa7, 0x44, 0xfe, 0x94, 0x70,
+	0xfe, 0xde, 0xda, 0xa9, 0x34, 0xca, 0x66, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xc8, 0x2c, 0x5a,
+	0x2c, 0x31, 0xc1, 0x29, 0x18, 0x2c, 0x31, 0x2c, 0x96, 0xdd, 0xfe, 0x94, 0x92, 0x92, 0xff, 0x96,
+	0xdd, 0x9c, 0xa9, 0x7f, 0xa2, 0x77, 0x9d, 0xaa, 0x5e, 0x2e, 0x7f, 0x40, 0x1a, 0x21, 0x18, 0x79,
+	0x79, 0x65, 0x61, 0xa7, 0x61, 0xa5, 0x64, 0xa6, 0x65, 0x36, 0xa4, 0x65, 0x2a, 0x6d, 0x75, 0x65,
+	0x65, 0xc1, 0x6d, 0xa2, 0x55, 0x6e, 0xa2, 0x76, 0xa2, 0x77, 0xa2, 0x76, 0xa2, 0x66, 0x7e, 0xa2,
+	0x66, 0x19, 0x23, 0xc1, 0x69, 0xf3, 0x1e, 0x19, 0x0f, 0x62, 0x56, 0x38, 0x66, 0x9b, 0xbc, 0x66,
+	0x52, 0x67, 0x7a, 0x0c, 0x13, 0x0b, 0x62, 0x6f, 0xa1, 0x79, 0x42, 0x42, 0x98, 0xbe, 0x9b, 0x9b,
+	0x9b, 0x9c, 0x9e, 0x7a, 0x5f, 0xa2, 0x68, 0xc0, 0x5a, 0x66, 0x66, 0x7b, 0xc0, 0x66, 0xc0, 0x27,
+	0x56, 0x18, 0xa6, 0x54, 0xac, 0x12, 0xaf, 0x01, 0xac, 0x32, 0xa8, 0x34, 0x31, 0x41, 0xc0, 0x31,
+	0xc2, 0x66, 0x66, 0x2c, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xcd, 0x51, 0x7e, 0x31, 0x9d, 0xaa,
+	0x95, 0xdd, 0x92, 0xff, 0x94, 0xfe, 0x96, 0xcd, 0x9c, 0xba, 0x6e, 0x7f, 0xc0, 0x1f, 0xc0, 0x6e,
+	0x6d, 0x1d, 0xc0, 0x7a, 0x79, 0x65, 0x75, 0xa2, 0x86, 0xa6, 0x53, 0xa5, 0x74, 0xa7, 0x64, 0xa3,
+	0x75, 0xa3, 0x76, 0x6d, 0x69, 0x75, 0x68, 0x69, 0xc0, 0x6d, 0x7f, 0x7e, 0xa2, 0x66, 0x33, 0xa2,
+	0x66, 0xa2, 0x77, 0x6e, 0x1b, 0xc0, 0x6e, 0x1e, 0x23, 0xc0, 0x69, 0xf5, 0x66, 0x1e, 0xc0, 0x6b,
+	0x20, 0x1b, 0x16, 0x9d, 0xab, 0x66, 0x2b, 0x52, 0x61, 0x56, 0x0f, 0x67, 0x0c, 0x13, 0x6b, 0x5b,
+	0x57, 0xa0, 0x8a, 0x9d, 0x8a, 0x9a, 0xad, 0x9a, 0x9c, 0x9b, 0xab, 0x9c, 0x9b, 0x46, 0x6f, 0xa2,
+	0x77, 0x5a, 0x52, 0x18, 0x2c, 0x24, 0x2c, 0x5a, 0x65, 0x56, 0x22, 0xa5, 0x66, 0xab, 0x33, 0xfe,
+	0xb5, 0xb5, 0xad, 0x22, 0xa4, 0x66, 0xc0, 0x56, 0xa2, 0x77, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd2,
+	0x25, 0x31, 0x25, 0x98, 0xcc, 0xfe, 0xa5, 0x14, 0xfe, 0x5a, 0xcb, 0x97, 0xdc, 0x29, 0x24, 0x2c,
+	0xc0, 0x24, 0xc1, 0x2c, 0x69, 0x61, 0x0d, 0x7a, 0x7a, 0x79, 0xa2, 0x86, 0xa6, 0x64, 0xa7, 0x53,
+	0xa6, 0x53, 0xa2, 0x86, 0xa1, 0x96, 0x7e, 0x69, 0x69, 0x09, 0x6d, 0x69, 0x05, 0xa2, 0x76, 0xa2,
+	0x77, 0xa3, 0x65, 0xa2, 0x77, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x69, 0xc1, 0x69, 0xc1, 0x6e, 0xc0,
+	0x6e, 0x1c, 0xf2, 0x17, 0x1c, 0xc0, 0x23, 0xc0, 0x1e, 0x25, 0x20, 0xc0, 0x6b, 0x62, 0x51, 0x51,
+	0x9c, 0xbb, 0x9d, 0xbb, 0xc0, 0x07, 0x76, 0x6b, 0x1a, 0x57, 0xa1, 0x79, 0x56, 0x9d, 0x9b, 0x9d,
+	0x9a, 0x9b, 0xab, 0x99, 0xad, 0x9c, 0x8b, 0x41, 0x5b, 0x6f, 0x5f, 0x56, 0x22, 0xc0, 0x29, 0xc2,
+	0x65, 0xc0, 0xa7, 0x54, 0xaf, 0x01, 0xb0, 0x00, 0xab, 0x32, 0xa3, 0x67, 0xc0, 0x31, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xd1, 0x61, 0x9a, 0xbb, 0x94, 0xee, 0xfe, 0x6b, 0x4d, 0x95, 0xed, 0x29, 0x66,
+	0xc0, 0x29, 0x7a, 0x29, 0xc1, 0x24, 0x79, 0x65, 0x01, 0xa0, 0xa7, 0xa2, 0x87, 0xa3, 0x86, 0xa4,
+	0x75, 0xa6, 0x64, 0xa7, 0x52, 0xa4, 0x74, 0x69, 0x0b, 0x7a, 0x69, 0x0c, 0x6d, 0x6d, 0x6e, 0xa3,
+	0x65, 0xa3, 0x65, 0xa3, 0x66, 0x1b, 0xa2, 0x66, 0x6e, 0xc0, 0x65, 0x69, 0xc1, 0x6e, 0x6e, 0xc1,
+	0x1c, 0xc2, 0x21, 0x1c, 0xe5, 0x21, 0xc5, 0x1c, 0xc4, 0x21, 0xc3, 0x1c, 0x23, 0xc2, 0x25, 0xc1,
+	0x1b, 0x9d, 0xbb, 0x9d, 0xaa, 0x9d, 0xaa, 0x08, 0x66, 0x67, 0x6b, 0x7b, 0x57, 0x6b, 0x5b, 0x66,
+	0x9c, 0x8c, 0x9b, 0x9c, 0x9a, 0xab, 0x9b, 0x9b, 0x42, 0x4b, 0x46, 0xa2, 0x68, 0x56, 0x6b, 0x29,
+	0x6b, 0x66, 0x79, 0x69, 0x51, 0x20, 0xaa, 0x33, 0xb1, 0x00, 0xae, 0x11, 0xaa, 0x22, 0xa2, 0x67,
+	0x6b, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xc9, 0x66, 0x31, 0xc3, 0x9c, 0xaa, 0x95, 0xee, 0xfe, 0x7b,
+	0xae, 0x92, 0xff, 0x29, 0x24, 0xc4, 0x29, 0x24, 0x18, 0x60, 0xa2, 0x86, 0x7e, 0x74, 0xa4, 0x85,
+	0xa7, 0x53, 0xa6, 0x75, 0xa5, 0x64, 0xa5, 0x64, 0x64, 0x0b, 0x68, 0xa2, 0x76, 0x3e, 0xc0, 0xa2,
+	0x66, 0xa3, 0x65, 0xa3, 0x76, 0xa3, 0x55, 0xa2, 0x66, 0xa2, 0x66, 0x1e, 0xa2, 0x66, 0xc2, 0x21,
+	0xc0, 0x66, 0xc2, 0x21, 0xc0, 0x1c, 0xea, 0x21, 0xc5, 0x1c, 0xc4, 0x21, 0xc2, 0x5a, 0x66, 0x1e,
+	0x7f, 0x21, 0x19, 0x66, 0x19, 0x1c, 0x67, 0x25, 0x66, 0x0f, 0x9d, 0xbb, 0x9c, 0xbb, 0x9d, 0xab,
+	0x52, 0x62, 0x6b, 0x07, 0x6b, 0x6e, 0xa0, 0x7b, 0x9f, 0x8b, 0x55, 0x99, 0xad, 0x98, 0xbc, 0x9c,
+	0x8b, 0x47, 0x42, 0x5b, 0x5b, 0x6b, 0x24, 0xc0, 0x66, 0x24, 0xa3, 0x76, 0x24, 0x65, 0xa6, 0x54,
+	0xa8, 0x45, 0xfe, 0xbd, 0x95, 0xab, 0x23, 0x2a, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xc8, 0x66,
+	0xc0, 0x31, 0xc0, 0x2c, 0x98, 0xcc, 0x92, 0xff, 0xfe, 0x52, 0x8a, 0x99, 0xbc, 0x9d, 0xaa, 0x30,
+	0x65, 0x30, 0xc0, 0x29, 0xc0, 0x1d, 0xc0, 0x7e, 0x75, 0x78, 0x75, 0xa4, 0x75, 0xa8, 0x52, 0xa7,
+	0x64, 0xa4, 0x85, 0xa2, 0x76, 0x60, 0x64, 0xa2, 0x65, 0x0a, 0x6d, 0x56, 0x1a, 0xa2, 0x77, 0xa3,
+	0x65, 0xa3, 0x56, 0x20, 0x69, 0x6e, 0x69, 0x6e, 0xc0, 0x5a, 0x6e, 0xc0, 0x1c, 0xc0, 0x21, 0xc9,
+	0x1c, 0xe5, 0x21, 0xc5, 0x1c, 0xc4, 0x21, 0xc1, 0x6e, 0x21, 0xc1, 0x19, 0x1e, 0x21, 0xc2, 0x1c,
+	0x17, 0x6b, 0xc0, 0x6b, 0x62, 0x61, 0x9c, 0xcb, 0x9c, 0xac, 0x66, 0x03, 0x3e, 0x6f, 0x9f, 0x8b,
+	0x53, 0x7f, 0xa2, 0x68, 0x42, 0x98, 0xbd, 0x98, 0xbe, 0x9a, 0xac, 0x47, 0x46, 0x5b, 0x6b, 0x1d,
+	0x24, 0x56, 0xc0, 0x7a, 0x24, 0x1d, 0x66, 0xa4, 0x65, 0xfe, 0x84, 0x0f, 0xfe, 0xce, 0x58, 0xa9,
+	0x34, 0x2a, 0x6b, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xc3, 0x66, 0xc0, 0x31, 0x2c, 0xc1, 0x9a, 0xbb,
+	0x94, 0xee, 0xfe, 0x6b, 0x4d, 0x92, 0xff, 0x56, 0xc0, 0x55, 0xc0, 0xa2, 0x77, 0x24, 0x59, 0x1d,
+	0x7a, 0x14, 0x0d, 0x7e, 0xa1, 0x97, 0xa2, 0xa4, 0xa6, 0x64, 0xa9, 0x43, 0xa6, 0x63, 0x69, 0x74,
+	0x79, 0x07, 0x6d, 0x03, 0xa2, 0x66, 0xa4, 0x54, 0xa2, 0x77, 0x16, 0x1b, 0x6e, 0x25, 0x23, 0x17,
+	0x6e, 0xc0, 0x6e, 0x5a, 0xc0, 0x6e, 0x1e, 0x21, 0xc6, 0x1c, 0xfd, 0x21, 0xc8, 0x1c, 0x6b, 0x66,
+	0xc0, 0x20, 0x0f, 0x9d, 0xab, 0x24, 0x52, 0x0d, 0x52, 0x9f, 0x9b, 0x66, 0x0b, 0xa0, 0x9a, 0x5b,
+	0xa0, 0x7a, 0x98, 0xbd, 0x98, 0xbe, 0x9b, 0x8b, 0x42, 0x47, 0x5a, 0x1d, 0x6b, 0x6b, 0x65, 0xc0,
+	0x24, 0xc1, 0x7e, 0xaa, 0x23, 0xfe, 0x9d, 0x13, 0xfe, 0xdf, 0x1a, 0xa5, 0x66, 0x7f, 0x31, 0xc2,
+	0x66, 0xc0, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xf9, 0x2c, 0xc0, 0x31, 0xc0, 0x51, 0x96, 0xdd, 0xfe,
+	0x8c, 0x30, 0xfe, 0x4a, 0x28, 0x24, 0xc0, 0x30, 0xc1, 0x55, 0x24, 0x69, 0x79, 0xc0, 0x74, 0x65,
+	0xa2, 0x76, 0xa5, 0x75, 0xa6, 0x64, 0xa7, 0x72, 0xa3, 0x75, 0xa4, 0x65, 0x7c, 0x60, 0x6e, 0x79,
+	0x6e, 0xa3, 0x65, 0xa3, 0x65, 0xa2, 0x66, 0xa3, 0x66, 0xa2, 0x66, 0x69, 0x1e, 0x23, 0xc0, 0x6e,
+	0x69, 0xc2, 0x5a, 0xc2, 0x21, 0xc3, 0x66, 0xfd, 0xc8, 0x21, 0xc0, 0x1e, 0xc0, 0x21, 0xc0, 0x1c,
+	0x23, 0x66, 0x6b, 0xc0, 0x20, 0x9d, 0xaa, 0x51, 0x9c, 0xbc, 0x9d, 0xbb, 0x00, 0x67, 0x77, 0x6b,
+	0xa0, 0x8a, 0x57, 0x9e, 0x7a, 0x9c, 0x9c, 0x9b, 0x9b, 0x98, 0xad, 0x9c, 0x9b, 0x47, 0xa1, 0x69,
+	0x18, 0x1d, 0x7f, 0xc0, 0x24, 0xc1, 0xa2, 0x76, 0xa5, 0x55, 0xab, 0x33, 0xfe, 0xbd, 0xf6, 0xac,
+	0x23, 0xa4, 0x66, 0xc0, 0x66, 0x31, 0xc0, 0x51, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xf6, 0x2c, 0xc0,
+	0x31, 0x2c, 0x31, 0x2c, 0x99, 0xbb, 0x92, 0xff, 0xfe, 0x62, 0xeb, 0x96, 0xcd, 0x18, 0x6f, 0xa2,
+	0x77, 0x41, 0xc1, 0x79, 0x7e, 0x7a, 0x64, 0x60, 0x7a, 0xa5, 0x63, 0xa8, 0x53, 0xa8, 0x54, 0xa5,
+	0x73, 0x74, 0x7d, 0x6c, 0x64, 0xc0, 0x0d, 0xa3, 0x66, 0xa2, 0x76, 0xa3, 0x66, 0xa3, 0x55, 0x20,
+	0x6e, 0x23, 0xc2, 0x6e, 0x69, 0x6e, 0x21, 0x5a, 0x21, 0xc6, 0x66, 0xfd, 0xcb, 0x21, 0x1e, 0xc3,
+	0x21, 0xc0, 0x28, 0xc0, 0x67, 0xc0, 0x55, 0x9d, 0xbc, 0x9d, 0xba, 0x9c, 0xbb, 0x9c, 0xbc, 0x3e,
+	0x77, 0x6b, 0xa0, 0x8a, 0x43, 0x5f, 0xa1, 0x69, 0x9b, 0x9b, 0x97, 0xbc, 0x98, 0xbf, 0x9e, 0x7b,
+	0x10, 0x6f, 0x6f, 0x56, 0x56, 0xa2, 0x67, 0xc0, 0x7e, 0x1d, 0x6e, 0xab, 0x32, 0xb0, 0x01, 0xfe,
+	0xde, 0xfb, 0xa8, 0x44, 0xc0, 0x2c, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xf8, 0x2c, 0x55, 0x2c, 0x31,
+	0x1d, 0x98, 0xcc, 0xfe, 0x7b, 0xcf, 0x92, 0xff, 0x98, 0xcc, 0x18, 0x38, 0x29, 0x51, 0x29, 0x65,
+	0x22, 0x7a, 0x79, 0x64, 0x61, 0xa2, 0x96, 0xa8, 0x51, 0xa9, 0x52, 0xa6, 0x64, 0xa2, 0x86, 0x65,
+	0x7c, 0x59, 0x68, 0xa2, 0x66, 0xa3, 0x65, 0xa3, 0x65, 0xa3, 0x76, 0xa2, 0x67, 0xa2, 0x66, 0xc0,
+	0x69, 0xc0, 0x69, 0x6e, 0xc0, 0x5a, 0xc0, 0x6e, 0x7a, 0xc3, 0x1c, 0xfd, 0xd2, 0x21, 0xc6, 0x1c,
+	0x19, 0x23, 0xc0, 0x6b, 0x62, 0x0a, 0x9d, 0xaa, 0x9d, 0xbb, 0x9d, 0xab, 0x3e, 0x7b, 0xa0, 0x7a,
+	0x12, 0x16, 0x6b, 0x1a, 0x98, 0xbe, 0x97, 0xbf, 0x9b, 0x9b, 0x9d, 0x9b, 0x5b, 0xa1, 0x69, 0x6f,
+	0x6f, 0x24, 0x29, 0xc0, 0x61, 0xa2, 0x66, 0xa4, 0x67, 0xad, 0x22, 0x39, 0xab, 0x33, 0x6e, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfb, 0x2c, 0x9a, 0xbb, 0x93, 0xee, 0xfe, 0x63, 0x2c, 0x38, 0x24, 0x6e, 0xc0,
+	0x24, 0xc0, 0x29, 0x65, 0x69, 0x7e, 0x65, 0x79, 0xa1, 0x96, 0xa7, 0x63, 0xa6, 0x74, 0xa7, 0x53,
+	0xa3, 0x95, 0x78, 0x65, 0x6d, 0x6e, 0xa3, 0x54, 0xa2, 0x76, 0xa3, 0x65, 0xa5, 0x43, 0xa2, 0x66,
+	0xc0, 0x23, 0xc1, 0x17, 0x1c, 0xc0, 0x21, 0xc0, 0x1c, 0xc0, 0x21, 0xc3, 0x1c, 0xca, 0x21, 0xc4,
+	0x1c, 0xf2, 0x21, 0x1c, 0xcd, 0x21, 0xc4, 0x1c, 0xc0, 0x17, 0x5a, 0x1e, 0xc0, 0x6b, 0x9d, 0xba,
+	0x9c, 0xbb, 0x9d, 0xbb, 0x3e, 0xc0, 0x67, 0x07, 0xa0, 0x8a, 0x6b, 0x5f, 0x9c, 0x8c, 0x97, 0xce,
+	0x99, 0xbd, 0x9b, 0x9c, 0x04, 0xa1, 0x69, 0x5b, 0x6b, 0x24, 0xc1, 0x1d, 0xc0, 0xa3, 0x67, 0xab,
+	0x33, 0xfe, 0xad, 0x55, 0xae, 0x11, 0x2c, 0x6e, 0xfd, 0xfd, 0xfd, 0xfd, 0xf7, 0x2c, 0xc0, 0x94,
+	0xee, 0xfe, 0x7b, 0xef, 0x93, 0xff, 0x29, 0x1f, 0x29, 0xc0, 0x66, 0xc1, 0x1d, 0x16, 0x7a, 0x69,
+	0x79, 0xa4, 0x75, 0xaa, 0x42, 0xa7, 0x72, 0xa2, 0x96, 0xa1, 0x95, 0x13, 0x70, 0x79, 0xa2, 0x66,
+	0xa5, 0x25, 0xa5, 0x54, 0xa3, 0x55, 0xa2, 0x65, 0x23, 0x6e, 0x69, 0xc1, 0x66, 0xc2, 0x21, 0xc5,
+	0x1c, 0xcb, 0x21, 0xc5, 0x1c, 0xf1, 0x21, 0xc7, 0x1c, 0xc8, 0x21, 0xc0, 0x1c, 0xc2, 0x17, 0x1c,
+	0x5a, 0x1c, 0x23, 0x66, 0x66, 0x0f, 0x9c, 0xcc, 0x9d, 0xab, 0x9b, 0xcc, 0x9d, 0xab, 0xa1, 0x99,
+	0x67, 0x5f, 0x5b, 0x42, 0x9d, 0x8c, 0x98, 0xae, 0x98, 0x9e, 0x9d, 0x8b, 0x9f, 0x7b, 0x24, 0x56,
+	0xc0, 0x24, 0xc1, 0x6e, 0x7f, 0xa5, 0x55, 0xb1, 0x00, 0xfe, 0xd6, 0xba, 0x2c, 0x6e, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xef, 0x2c, 0x31, 0xc1, 0x51, 0x2c, 0x31, 0x41, 0x93, 0xfe, 0xfe, 0x63, 0x4c, 0xfe,
+	0x31, 0x85, 0x29, 0x7a, 0x6b, 0x50, 0xc0, 0x29, 0x69, 0x55, 0x7a, 0x10, 0x64, 0xa4, 0x74, 0xa8,
+	0x63, 0xa8, 0x63, 0xa5, 0x64, 0xa1, 0x95, 0x79, 0x07, 0x6d, 0xa2, 0x75, 0xa3, 0x76, 0xa4, 0x44,
+	0x1b, 0xa2, 0x66, 0x23, 0xc0, 0x69, 0xc1, 0x6e, 0xc0, 0x1c, 0xc3, 0x21, 0xc2, 0x1c, 0xce, 0x21,
+	0xc3, 0x1c, 0xf2, 0x21, 0xc6, 0x1c, 0xca, 0x21, 0x1c, 0xc3, 0x21, 0x5a, 0xc0, 0x21, 0x1c, 0xc0,
+	0x67, 0x19, 0x1b, 0x9c, 0xcb, 0x9a, 0xcd, 0x9d, 0xab, 0x66, 0xa0, 0x9a, 0x67, 0xa1, 0x79, 0x4b,
+	0x43, 0x99, 0xad, 0x08, 0x99, 0xad, 0x09, 0x10, 0x5b, 0x18, 0xa1, 0x89, 0x69, 0x66, 0xc0, 0x18,
+	0xa6, 0x45, 0xaf, 0x00, 0xfe, 0xce, 0x78, 0xac, 0x12, 0x7b, 0x27, 0x66, 0x31, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xec, 0x1d, 0xc0, 0x7f, 0x31, 0xc0, 0x9a, 0xbb, 0xfe, 0x9d, 0x13, 0xfe, 0x42, 0x48, 0x9b,
+	0xaa, 0x7f, 0x9c, 0xba, 0x6b, 0x7a, 0xa2, 0x77, 0x5a, 0x1d, 0x64, 0xa2, 0x66, 0xa0, 0xa7, 0x08,
+	0xa6, 0x63, 0xa9, 0x52, 0xa9, 0x52, 0xa2, 0x95, 0x9e, 0xa7, 0x64, 0x6e, 0xa3, 0x65, 0xa3, 0x65,
+	0x36, 0xa4, 0x45, 0x19, 0xa2, 0x65, 0xfd, 0xf5, 0x6e, 0x5a, 0xc0, 0x21, 0xc0, 0x1c, 0xc0, 0x17,
+	0x19, 0x1b, 0x9d, 0xbb, 0x9d, 0x9a, 0x9c, 0xbb, 0x03, 0x77, 0x67, 0x0e, 0xa1, 0x79, 0xa0, 0x7a,
+	0x42, 0x95, 0xbe, 0x98, 0xbe, 0x9b, 0x9d, 0x5b, 0xa2, 0x69, 0x27, 0x66, 0xa2, 0x76, 0x66, 0x27,
+	0x1d, 0xa3, 0x66, 0x3a, 0xfe, 0xb5, 0xf6, 0xab, 0x33, 0x31, 0x65, 0x9d, 0xaa, 0xa2, 0x77, 0x31,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xea, 0x25, 0x56, 0x31, 0x20, 0x96, 0xdd, 0xfe, 0x8c, 0x30, 0xfe, 0x42,
+	0x08, 0x99, 0xbb, 0x69, 0xa3, 0x67, 0x65, 0x66, 0x18, 0x27, 0x2f, 0x64, 0x09, 0x69, 0xa1, 0x97,
+	0xab, 0x51, 0xa7, 0x53, 0xa6, 0x63, 0xa1, 0x96, 0x9f, 0x96, 0x79, 0x6d, 0xa3, 0x65, 0xa4, 0x65,
+	0x11, 0xa3, 0x55, 0x6e, 0x6d, 0x69, 0xfd, 0xf5, 0x6e, 0x1e, 0x21, 0xc1, 0x1c, 0xc0, 0x17, 0x19,
+	0x20, 0x6f, 0x62, 0x9c, 0xbb, 0x9b, 0xcc, 0x0b, 0x0a, 0x0c, 0x67, 0xa1, 0x79, 0xa1, 0x79, 0x9d,
+	0x8b, 0x9b, 0x9b, 0x98, 0xae, 0x98, 0xbe, 0x9c, 0x9c, 0xa1, 0x69, 0xa2, 0x67, 0x6e, 0x1d, 0xc1,
+	0x15, 0xa2, 0x77, 0xa9, 0x44, 0xfe, 0x94, 0xb2, 0xfe, 0xde, 0xfb, 0x31, 0x61, 0xc0, 0x31, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xe9, 0x66, 0x31, 0xc0, 0x9b, 0xbb, 0x94, 0xed, 0xfe, 0x73, 0x6d, 0xfe, 0x31,
+	0x86, 0x9d, 0xba, 0xa2, 0x66, 0x1d, 0x5e, 0x7e, 0x66, 0x1d, 0x61, 0xa0, 0xa7, 0x7d, 0xa0, 0xa7,
+	0x37, 0xa9, 0x42, 0xa8, 0x52, 0xa3, 0x75, 0x7d, 0x9f, 0x86, 0x7d, 0xa3, 0x75, 0x3d, 0xa3, 0x55,
+	0xa3, 0x56, 0xa2, 0x65, 0x6d, 0xc0, 0x59, 0x7a, 0xfd, 0xf5, 0x6e, 0xc3, 0x1c, 0xc0, 0x6f, 0x62,
+	0x66, 0x25, 0x6b, 0x66, 0x61, 0x9c, 0xbb, 0x12, 0x03, 0x67, 0x67, 0xa0, 0x8a, 0xa1, 0x79, 0x47,
+	0x9c, 0x9b, 0x99, 0x9d, 0x97, 0xce, 0x9c, 0x8b, 0x4b, 0xa2, 0x58, 0x66, 0xc0, 0x1d, 0x29, 0x7b,
+	0x51, 0xa7, 0x45, 0xfe, 0x8c, 0x10, 0xfe, 0xd6, 0x9a, 0xaa, 0x33, 0x31, 0x2c, 0x31, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xea, 0x99, 0xcc, 0xfe, 0xa5, 0x14, 0xfe, 0x5a, 0xcb, 0x96, 0xdc, 0x9c, 0xbb, 0x7f,
+	0x1f, 0x6e, 0x6d, 0xc0, 0x59, 0x16, 0x75, 0x9f, 0xb7, 0xa3, 0x85, 0xa7, 0x73, 0xa9, 0x53, 0xa7,
+	0x52, 0x9f, 0x96, 0x6d, 0x6c, 0xa2, 0x75, 0xa3, 0x65, 0xa5, 0x54, 0xa3, 0x56, 0x25, 0x6e, 0x23,
+	0x5d, 0xc1, 0x21, 0x66, 0xfd, 0xfd, 0x23, 0x66, 0xc0, 0x25, 0x2a, 0x25, 0x9c, 0xcb, 0x9b, 0xcd,
+	0x9b, 0xcc, 0x63, 0x67, 0x67, 0x5b, 0x5b, 0xa0, 0x6a, 0x9b, 0x9c, 0x96, 0xce, 0x9b, 0x7b, 0x9e,
+	0x6b, 0x6f, 0x16, 0x66, 0xa1, 0x89, 0x56, 0xa1, 0x89, 0x51, 0xa4, 0x65, 0xb0, 0x00, 0xfe, 0xce,
+	0x38, 0xab, 0x23, 0xa3, 0x66, 0xfd, 0xfd, 0xfd, 0xfd, 0xe9, 0x66, 0x94, 0xee, 0xfe, 0x8c, 0x50,
+	0xfe, 0x52, 0x69, 0x96, 0xdd, 0xc0, 0x24, 0x7b, 0xa2, 0x66, 0x24, 0x54, 0xa2, 0x76, 0x14, 0x06,
+	0xa1, 0x96, 0x39, 0xa8, 0x63, 0xa9, 0x51, 0xa2, 0x96, 0x9f, 0x86, 0xa3, 0x64, 0x6d, 0xa2, 0x75,
+	0xa3, 0x65, 0xa4, 0x55, 0x19, 0x1e, 0x69, 0x6e, 0x5a, 0x6e, 0x6e, 0x7a, 0x66, 0x1c, 0xfd, 0xfb,
+	0x17, 0x1c, 0x21, 0x1c, 0x17, 0x6b, 0x59, 0x7f, 0x6f, 0x9c, 0xcc, 0x9b, 0xdc, 0x9b, 0xcc, 0x9b,
+	0xbd, 0xc0, 0xa1, 0x89, 0xa1, 0x79, 0xa0, 0x7a, 0x57, 0x9b, 0xac, 0x3d, 0x97, 0x9e, 0x9c, 0xab,
+	0x6f, 0x9f, 0x8b, 0xa2, 0x78, 0x1f, 0xa2, 0x78, 0x51, 0x55, 0x33, 0xad, 0x11, 0xfe, 0xbd, 0xb6,
+	0x04, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xe7, 0x66, 0x95, 0xdd, 0xfe, 0x73, 0x8e, 0xfe, 0x31, 0x85,
+	0x9d, 0xaa, 0xa2, 0x77, 0x31, 0x24, 0x6b, 0x17, 0x1d, 0x7e, 0x64, 0x09, 0xa1, 0x96, 0xa6, 0x63,
+	0xac, 0x41, 0xa8, 0x51, 0x9e, 0xb7, 0x9f, 0x96, 0xa3, 0x75, 0x45, 0xa5, 0x53, 0x0a, 0xa4, 0x45,
+	0x6d, 0x65, 0x56, 0x6e, 0x21, 0xc1, 0x5a, 0xc0, 0x1c, 0xfd, 0xfd, 0xc2, 0x21, 0xc0, 0x1c, 0x21,
+	0x23, 0x62, 0xa0, 0x8a, 0x61, 0x9a, 0xdd, 0x9b, 0xbc, 0x66, 0x63, 0x6b, 0xa1, 0x7a, 0x52, 0xa0,
+	0x6a, 0x99, 0x8d, 0xfe, 0x61, 0xa1, 0x0d, 0x09, 0xa2, 0x69, 0x18, 0x24, 0x6f, 0x7f, 0x9d, 0x99,
+	0x18, 0xae, 0x11, 0xfe, 0xb5, 0x96, 0xfe, 0xff, 0xdf, 0x6e, 0xfd, 0xfd, 0xfd, 0xfd, 0xe4, 0x62,
+	0x55, 0x94, 0xee, 0xfe, 0x6b, 0x2c, 0x92, 0xff, 0x1d, 0x2c, 0x1d, 0x2c, 0x56, 0x5f, 0x69, 0xa1,
+	0x97, 0x70, 0x74, 0xa3, 0x85, 0xa9, 0x52, 0xa9, 0x41, 0xa5, 0x73, 0xa0, 0x85, 0x78, 0xa2, 0x75,
+	0xa2, 0x66, 0xa6, 0x54, 0x1b, 0x19, 0x69, 0xa2, 0x66, 0x6e, 0xc2, 0x1c, 0xfd, 0xfd, 0xc2, 0x21,
+	0xc7, 0x23, 0x2a, 0x25, 0x6b, 0x9a, 0xdc, 0x1f, 0x08, 0x62, 0x9f, 0x9b, 0x77, 0xa0, 0x7b, 0xa0,
+	0x6a, 0x9c, 0x9a, 0x95, 0xcf, 0x99, 0x9d, 0x09, 0xa1, 0x69, 0x5f, 0x57, 0x6e, 0x29, 0x1d, 0x7f,
+	0x3c, 0xfe, 0xa5, 0x34, 0x04, 0xa5, 0x55, 0xc4, 0x66, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xda, 0x2c,
+	0x31, 0x04, 0xfe, 0xb5, 0x75, 0xfe, 0x5a, 0xcb, 0x97, 0xdc, 0x9c, 0xaa, 0x1d, 0x7a, 0x18, 0xa2,
+	0x76, 0x18, 0x5e, 0x25, 0x60, 0x9f, 0xb7, 0xa7, 0x63, 0xa9, 0x62, 0xa8, 0x52, 0x7d, 0x68, 0xa2,
+	0x74, 0xa4, 0x53, 0x3d, 0x0a, 0x1b, 0xa2, 0x66, 0x69, 0x69, 0x6e, 0x5a, 0x7e, 0xc0, 0x1c, 0xfd,
+	0xfd, 0xc2, 0x21, 0xc8, 0x5b, 0x6b, 0x66, 0xc0, 0x76, 0x9d, 0xab, 0x9b, 0xcb, 0x9b, 0xcd, 0x3e,
+	0x77, 0x0c, 0xa0, 0x7a, 0xa1, 0x69, 0x9d, 0x8b, 0x98, 0x9d, 0x24, 0x9c, 0x7b, 0xa3, 0x57, 0x5b,
+	0x22, 0x66, 0xc1, 0x7f, 0xa8, 0x34, 0xfe, 0x94, 0xb2, 0xfe, 0xe7, 0x1c, 0x31, 0x66, 0x31, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xdc, 0x2c, 0xc0, 0x31, 0x9a, 0xcb, 0xfe, 0xa4, 0xf3, 0x3c, 0x1d, 0xc0, 0x20,
+	0x6e, 0x18, 0x11, 0x20, 0x69, 0x6e, 0x9d, 0xb9, 0xa2, 0x85, 0xa9, 0x62, 0xa9, 0x62, 0xa3, 0x86,
+	0xa3, 0x85, 0x9f, 0x96, 0x6d, 0xa5, 0x43, 0xa5, 0x53, 0xa4, 0x44, 0xa2, 0x66, 0xc0, 0x2a, 0x65,
+	0x1c, 0x6e, 0xc1, 0x1c, 0xfd, 0xfd, 0xc3, 0x21, 0xc6, 0x1c, 0x21, 0x5b, 0xc2, 0x6b, 0x2a, 0x9d,
+	0xbb, 0x9b, 0xcc, 0x9b, 0xcc, 0x3e, 0x73, 0x9f, 0xab, 0x4f, 0x5f, 0xa0, 0x6a, 0x98, 0xae, 0x94,
+	0xcf, 0x9c, 0x8c, 0x5f, 0xa1, 0x79, 0xc0, 0x56, 0xc0, 0xa1, 0x89, 0x56, 0xa3, 0x66, 0xfe, 0x8c,
+	0x51, 0x30, 0x31, 0xc0, 0x66, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xdc, 0x9a, 0xbb, 0xfe, 0x94, 0x92,
+	0xfe, 0x42, 0x07, 0x97, 0xdd, 0xa4, 0x66, 0x1d, 0x7e, 0x20, 0x16, 0x25, 0xc0, 0x74, 0x02, 0xa1,
+	0x97, 0xaa, 0x51, 0xac, 0x40, 0xa3, 0x86, 0x9d, 0xc8, 0x7d, 0x69, 0xa3, 0x65, 0xa6, 0x33, 0xa3,
+	0x55, 0xa2, 0x65, 0xa2, 0x66, 0x6e, 0x2a, 0x65, 0x1c, 0x6e, 0xc1, 0x1c, 0xfd, 0xfd, 0xc0, 0x21,
+	0xcb, 0x5a, 0x6b, 0xc1, 0x65, 0x6b, 0x2a, 0x62, 0x9c, 0xcc, 0x99, 0xdd, 0x9c, 0xbc, 0x9f, 0xba,
+	0x5f, 0x57, 0xa1, 0x69, 0xa0, 0x7a, 0x9b, 0x9c, 0xfe, 0x69, 0xe1, 0x9a, 0xad, 0x46, 0xa2, 0x68,
+	0x5b, 0x6b, 0xa2, 0x67, 0x56, 0x9d, 0xaa, 0xa6, 0x55, 0x2d, 0x35, 0xa6, 0x55, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xdc, 0x66, 0x96, 0xdd, 0xfe, 0x84, 0x0f, 0x0c, 0x9c, 0xa9, 0x7f, 0x20, 0x56, 0xa3, 0x66,
+	0x20, 0xc0, 0x6e, 0x9d, 0xaa, 0x09, 0xa2, 0xa5, 0xab, 0x40, 0xaa, 0x42, 0xa2, 0x95, 0x64, 0xa1,
+	0x97, 0x75, 0x55, 0x03, 0xa2, 0x66, 0x5e, 0xa2, 0x66, 0xa5, 0x43, 0xa7, 0x32, 0x2a, 0x65, 0x69,
+	0x1c, 0xc2, 0x21, 0xc3, 0x1c, 0xfd, 0xf5, 0x21, 0xc8, 0x1c, 0xc1, 0x21, 0xc2, 0x1c, 0xc0, 0x21,
+	0xc0, 0x1c, 0xc0, 0x2a, 0x25, 0x9c, 0xbc, 0x9b, 0xcc, 0x9b, 0xdc, 0x3e, 0x6b, 0x57, 0x12, 0xa1,
+	0x7a, 0x99, 0xae, 0x96, 0xcf, 0x99, 0x9c, 0x47, 0xa1, 0x69, 0x56, 0x4a, 0x29, 0xa2, 0x77, 0x99,
+	0xcc, 0xa8, 0x44, 0x28, 0xfe, 0xe7, 0x3c, 0xa6, 0x55, 0xc2, 0x66, 0xc0, 0x31, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xd4, 0x51, 0x98, 0xcc, 0xfe, 0x73, 0x8e, 0xfe, 0x39, 0xa6, 0x24, 0x69, 0x7f, 0x1d, 0xc0,
+	0xa2, 0x87, 0x50, 0xc1, 0x14, 0xa6, 0x72, 0xa9, 0x90, 0xa7, 0x53, 0xa3, 0x75, 0x74, 0x11, 0x03,
+	0x76, 0xc0, 0x03, 0xc0, 0x05, 0x6e, 0xa3, 0x55, 0xa8, 0x20, 0xa3, 0x65, 0x1e, 0x17, 0x6e, 0xc1,
+	0x21, 0x5a, 0xc0, 0x6e, 0xc1, 0x21, 0x1c, 0xfd, 0xf4, 0x21, 0xc7, 0x1c, 0xc2, 0x21, 0xc1, 0x1c,
+	0xc5, 0x6b, 0x2a, 0x56, 0x9d, 0xbb, 0x9b, 0xdc, 0x9b, 0xbc, 0x3e, 0x7b, 0x11, 0x9e, 0x9c, 0xa1,
+	0x69, 0x43, 0x96, 0xbf, 0x97, 0x9e, 0x9e, 0x7a, 0x5f, 0x56, 0x24, 0x29, 0x24, 0x55, 0xa8, 0x44,
+	0xb0, 0x00, 0xfe, 0xef, 0x5d, 0xa3, 0x66, 0x31, 0xc0, 0x66, 0xc0, 0x31, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xcd, 0x2c, 0x31, 0xc1, 0x2c, 0xc0, 0x31, 0x93, 0xff, 0xfe, 0x7b, 0x8f, 0xfe, 0x39, 0x87, 0x50,
+	0x6d, 0x16, 0x6e, 0x6b, 0x66, 0x20, 0x79, 0x09, 0x79, 0xa8, 0x42, 0xab, 0x60, 0xa4, 0xa4, 0x7e,
+	0x69, 0x69, 0xc0, 0x6e, 0xc1, 0x7f, 0x50, 0xc0, 0x7e, 0x5c, 0xfe, 0xed, 0xa0, 0xa5, 0x54, 0x6e,
+	0x21, 0x5e, 0x66, 0x6b, 0x66, 0x66, 0x7e, 0xa2, 0x66, 0x69, 0x1e, 0x21, 0xcb, 0x66, 0xd8, 0x21,
+	0xe5, 0x1c, 0xcb, 0x21, 0xcc, 0x1c, 0xca, 0x21, 0xc6, 0x1c, 0xc3, 0x21, 0xc1, 0x1c, 0xc7, 0x23,
+	0x57, 0x62, 0x9d, 0xbb, 0x9b, 0xcc, 0x0a, 0x0f, 0xa0, 0x8a, 0x52, 0xa1, 0x6a, 0x9d, 0x8b, 0x97,
+	0xae, 0x96, 0xce, 0x9d, 0x8b, 0xa3, 0x48, 0x4b, 0x55, 0xa3, 0x77, 0x22, 0x66, 0xa4, 0x77, 0xfe,
+	0x8c, 0x31, 0xfe, 0xe6, 0xfc, 0x2c, 0x66, 0x31, 0x69, 0x56, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xc8,
+	0x2c, 0xc2, 0x31, 0xc1, 0x9d, 0xaa, 0x2c, 0x31, 0x94, 0xff, 0xfe, 0x73, 0x6e, 0xfe, 0x39, 0x67,
+	0x65, 0x59, 0x16, 0x6d, 0x6b, 0xc0, 0x11, 0x7a, 0x71, 0xa2, 0x84, 0xa9, 0x51, 0xfe, 0xb3, 0xc5,
+	0xa5, 0x84, 0x9e, 0xc8, 0x69, 0x56, 0x0e, 0xa2, 0x67, 0x5f, 0x52, 0x51, 0xa2, 0x76, 0xa0, 0xa8,
+	0x0e, 0xa0, 0xa7, 0x5c, 0xfe, 0xf5, 0xa1, 0xa5, 0x43, 0x59, 0x6e, 0x6e, 0x25, 0x20, 0x7b, 0x6b,
+	0x2a, 0x23, 0x6d, 0xcd, 0x1c, 0xd8, 0x21, 0xe0, 0x1c, 0xd0, 0x21, 0xcc, 0x1c, 0xe4, 0x20, 0x6b,
+	0x77, 0x9b, 0xcc, 0x9a, 0xdd, 0x0a, 0x77, 0x52, 0xa1, 0x69, 0xa1, 0x79, 0x42, 0x97, 0xbe, 0xfe,
+	0x61, 0x80, 0x9d, 0x6b, 0xa2, 0x4a, 0x6d, 0x66, 0x65, 0xa1, 0x89, 0x66, 0xa3, 0x68, 0xfe, 0x94,
+	0x73, 0xfe, 0xde, 0xbc, 0xa8, 0x43, 0xa2, 0x66, 0x69, 0xc0, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xcf,
+	0x65, 0x6b, 0x34, 0xfe, 0x6b, 0x2d, 0xfe, 0x29, 0x46, 0x61, 0x7f, 0x6d, 0x1d, 0x1b, 0x16, 0x7a,
+	0x66, 0xa0, 0xa8, 0xa2, 0x95, 0xa7, 0x63, 0xfe, 0xc3, 0xc7, 0xa5, 0x63, 0x74, 0x79, 0x51, 0x56,
+	0xa3, 0x68, 0x31, 0x9a, 0xac, 0x99, 0xac, 0x9b, 0xbb, 0xa4, 0x75, 0xaa, 0x41, 0xa2, 0x96, 0x78,
+	0x0b, 0xfe, 0xf5, 0xa0, 0xa4, 0x55, 0xc0, 0x6e, 0xc0, 0x67, 0x62, 0xc1, 0x69, 0x19, 0x23, 0x59,
+	0x1c, 0xc1, 0x6e, 0xc1, 0x1c, 0xdf, 0x21, 0xcb, 0x1c, 0xe5, 0x21, 0xcc, 0x1c, 0xe5, 0x5f, 0x77,
+	0x63, 0x9c, 0xcb, 0x9a, 0xcd, 0x9c, 0xbb, 0xa0, 0x8a, 0x56, 0x12, 0xa3, 0x58, 0x43, 0x96, 0xde,
+	0x97, 0x9e, 0x9b, 0x8d, 0x5b, 0xc0, 0x14, 0x6f, 0x57, 0x51, 0xa6, 0x45, 0xfe, 0x8c, 0x51, 0x30,
+	0xa7, 0x44, 0x65, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xce, 0x2c, 0x25, 0x2c, 0x95, 0xdd, 0xfe, 0x6b,
+	0x2c, 0xfe, 0x31, 0x66, 0xc1, 0x54, 0xc2, 0x79, 0x66, 0x75, 0xa1, 0xa6, 0xaa, 0x52, 0xab, 0x40,
+	0xa3, 0x84, 0x70, 0x6d, 0x6d, 0x15, 0xa1, 0x69, 0x47, 0x99, 0xad, 0x96, 0xcf, 0x9a, 0xac, 0x9d,
+	0xab, 0xa4, 0x74, 0xfe, 0xa3, 0x23, 0xa9, 0x60, 0x74, 0xa3, 0x63, 0xa8, 0x20, 0xa4, 0x46, 0xc1,
+	0x9c, 0xcb, 0x9d, 0xab, 0x62, 0xc0, 0x55, 0xa2, 0x66, 0xa6, 0x43, 0x1e, 0x69, 0x1c, 0xef, 0x6e,
+	0xc0, 0x1c, 0xe6, 0x21, 0xcc, 0x1c, 0xe4, 0x21, 0x56, 0x17, 0xa0, 0x8a, 0x67, 0x9d, 0xba, 0x2e,
+	0x9c, 0xab, 0x53, 0x57, 0xa1, 0x79, 0xa0, 0x8a, 0x53, 0x9a, 0x9c, 0x36, 0x99, 0xbe, 0xa1, 0x79,
+	0xa0, 0x7a, 0x5a, 0x5b, 0x04, 0x9b, 0xaa, 0xa8, 0x43, 0xfe, 0x8c, 0x91, 0xfe, 0xde, 0xfb, 0x31,
+	0x2c, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xca, 0x2c, 0xc0, 0x31, 0xc1, 0x93, 0xfe, 0xfe, 0x73, 0x8e,
+	0x91, 0xff, 0x61, 0x6f, 0x1d, 0x5d, 0x22, 0xc0, 0x1d, 0x79, 0x75, 0xa4, 0x85, 0xa7, 0x63, 0xa9,
+	0x62, 0xa5, 0x83, 0x9d, 0xb7, 0x75, 0xa3, 0x66, 0x49, 0xa2, 0x69, 0x43, 0xfe, 0x9a, 0xe5, 0x96,
+	0xbf, 0x9b, 0x9d, 0x10, 0x65, 0xa2, 0x85, 0xfe, 0x92, 0xe3, 0xfe, 0xd4, 0x65, 0x9f, 0xb7, 0x03,
+	0xa4, 0x54, 0xa2, 0x76, 0x2e, 0x67, 0x9c, 0xbb, 0x9d, 0xbb, 0xc1, 0x69, 0xa2, 0x56, 0xa5, 0x43,
+	0xa6, 0x32, 0x17, 0x1c, 0xc5, 0x23, 0xc0, 0x66, 0xc1, 0x23, 0x1c, 0xfd, 0xce, 0x6e, 0xcc, 0x1c,
+	0xe4, 0x21, 0x6e, 0x1c, 0x17, 0x2a, 0x62, 0x62, 0x9a, 0xcc, 0x9d, 0xab, 0x52, 0x9f, 0x9b, 0x53,
+	0xa0, 0x9a, 0xa0, 0x7a, 0x99, 0xad, 0xfe, 0x71, 0xe2, 0x99, 0xbe, 0x9f, 0x6b, 0xa2, 0x68, 0x4a,
+	0xa2, 0x66, 0x5a, 0x50, 0xa7, 0x56, 0xfe, 0x9c, 0xf4, 0xfe, 0xef, 0x5e, 0xa4, 0x65, 0x31, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xca, 0x2c, 0x31, 0xc0, 0x9d, 0xaa, 0x97, 0xdc, 0xfe, 0x6b, 0x4d, 0xfe, 0x29,
+	0x44, 0xc0, 0x7f, 0x56, 0x1d, 0xa2, 0x55, 0x66, 0x22, 0x66, 0x7a, 0xa0, 0xa7, 0xab, 0x40, 0xab,
+	0x40, 0xa5, 0x84, 0x9d, 0xb8, 0x9e, 0xa7, 0xa1, 0x97, 0x5a, 0xa1, 0x59, 0x9d, 0x9b, 0x98, 0xbe,
+	0xfe, 0x59, 0x81, 0x9b, 0x9d, 0x14, 0xc0, 0x7e, 0xa1, 0x95, 0x3e, 0xfe, 0xdc, 0x66, 0x9f, 0xa5,
+	0x78, 0x5a, 0x5e, 0x67, 0xa1, 0x89, 0x52, 0xa0, 0x9a, 0xc0, 0x15, 0x7d, 0x58, 0x00, 0xa5, 0x43,
+	0xa8, 0x31, 0xa3, 0x54, 0xc6, 0x23, 0xc3, 0x1c, 0xe6, 0x6e, 0xc2, 0x1c, 0xd4, 0x21, 0xc0, 0x1c,
+	0xc8, 0x21, 0xcc, 0x1c, 0xe4, 0x21, 0x6e, 0x21, 0x1c, 0x23, 0x1e, 0x6b, 0x62, 0x9c, 0xbb, 0x12,
+	0x00, 0x63, 0xa0, 0x9a, 0xa1, 0x79, 0x9f, 0x8b, 0x99, 0xae, 0x96, 0xcf, 0x99, 0x9d, 0xa0, 0x5a,
+	0x20, 0x9d, 0x8a, 0x29, 0x55, 0x29, 0xa9, 0x44, 0xfe, 0xa5, 0x15, 0xfe, 0xef, 0x3d, 0x31, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xc9, 0x66, 0xc0, 0x31, 0x9d, 0xaa, 0x3c, 0xfe, 0x52, 0xaa, 0x96, 0xed, 0x29,
+	0x7e, 0x9d, 0xaa, 0x1d, 0xa2, 0x76, 0x59, 0x66, 0x1d, 0xc0, 0x7a, 0xa1, 0x96, 0xa5, 0x63, 0xa9,
+	0x62, 0xa8, 0x52, 0xa2, 0x85, 0xa1, 0x96, 0x7a, 0x57, 0x9e, 0x7c, 0x96, 0xce, 0x94, 0xdf, 0x9c,
+	0x8c, 0xa3, 0x58, 0xa1, 0x69, 0x55, 0xa1, 0x96, 0xa1, 0x95, 0xfe, 0x9b, 0x24, 0xa9, 0x71, 0x9d,
+	0xc7, 0xa3, 0x65, 0xa2, 0x67, 0x46, 0x57, 0xa1, 0x79, 0x67, 0x6b, 0x7a, 0x61, 0x6c, 0xa2, 0x74,
+	0x9f, 0x86, 0xa3, 0x65, 0xa7, 0x31, 0xa7, 0x21, 0xf2, 0x6e, 0xdb, 0x1c, 0xc6, 0x21, 0xce, 0x1c,
+	0xe5, 0x21, 0x26, 0xc0, 0x21, 0x23, 0xc0, 0x62, 0x67, 0x9b, 0xcb, 0x0d, 0x7b, 0x63, 0x3d, 0x9f,
+	0x9c, 0xa3, 0x57, 0x9c, 0x8c, 0xfe, 0x71, 0xc2, 0x99, 0x9d, 0x24, 0x4b, 0x1d, 0xa2, 0x68, 0x7a,
+	0x99, 0xbb, 0xad, 0x22, 0xfe, 0xc6, 0x18, 0xaf, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xca, 0x51, 0xc0,
+	0x96, 0xdd, 0x04, 0x91, 0xff, 0xc0, 0x65, 0xc0, 0x6e, 0x1d, 0x69, 0x22, 0x1d, 0x38, 0x51, 0x75,
+	0x69, 0x74, 0xa2, 0x85, 0xaa, 0x31, 0xa8, 0x53, 0xa3, 0x76, 0x65, 0x9c, 0xac, 0x97, 0xcf, 0x98,
+	0xbd, 0x04, 0xa2, 0x68, 0x16, 0xa2, 0x68, 0x79, 0x9d, 0xa9, 0xa4, 0x94, 0xfe, 0xa3, 0x45, 0xa7,
+	0x82, 0x9e, 0xc7, 0x6e, 0xa2, 0x58, 0x47, 0x46, 0x47, 0x9c, 0x9b, 0x97, 0xde, 0x9a, 0xcb, 0xa2,
+	0x76, 0xfe, 0xb3, 0x43, 0xa8, 0x52, 0x09, 0xa2, 0x75, 0xa7, 0x41, 0xfe, 0xfe, 0x60, 0x6e, 0xc0,
+	0x52, 0x1c, 0x21, 0xc1, 0x56, 0xc0, 0x6e, 0x21, 0xc0, 0x1c, 0xe5, 0x21, 0x26, 0xc0, 0x1e, 0xd5,
+	0x21, 0xc2, 0x1c, 0xc1, 0x21, 0xd2, 0x1c, 0xe4, 0x21, 0xc2, 0x1e, 0x6b, 0x76, 0xc0, 0x66, 0x9d,
+	0xbb, 0x9b, 0xcd, 0x99, 0xde, 0x76, 0xa0, 0x9b, 0x63, 0xa1, 0x69, 0x46, 0x9c, 0x7b, 0xfe, 0x6a,
+	0x01, 0x99, 0xae, 0xa1, 0x6a, 0x4b, 0x24, 0xc0, 0x66, 0xa3, 0x75, 0xab, 0x23, 0xfe, 0xc6, 0x18,
+	0xac, 0x22, 0xa3, 0x66, 0x66, 0x31, 0x2c, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xc3, 0x2c, 0x31, 0x95,
+	0xee, 0xfe, 0x73, 0x6e, 0x38, 0x51, 0x29, 0x1d, 0x65, 0x6e, 0xa2, 0x77, 0xc0, 0x1d, 0xc0, 0x7f,
+	0x61, 0x6e, 0x65, 0x79, 0x6e, 0x7d, 0x7a, 0x2d, 0xa2, 0x76, 0x9d, 0x9b, 0x9d, 0xac, 0x55, 0x5a,
+	0xa2, 0x67, 0x5a, 0x22, 0x69, 0x9d, 0xb9, 0x2d, 0xfe, 0xa3, 0x67, 0xa8, 0x73, 0x9e, 0xc7, 0x55,
+	0x9f, 0x6a, 0x9b, 0x8b, 0x99, 0xad, 0x9b, 0x9c, 0x9d, 0x9a, 0x41, 0x76, 0x7a, 0xfe, 0x8a, 0x81,
+	0xfe, 0xcc, 0x04, 0xa1, 0x96, 0xa2, 0x85, 0xa6, 0x42, 0xfe, 0xfe, 0x41, 0x23, 0xc0, 0x65, 0x6e,
+	0xc1, 0x6e, 0x5a, 0xc0, 0x6e, 0xc0, 0x1e, 0x21, 0x1c, 0xe2, 0x6f, 0xc0, 0x21, 0xc1, 0x1e, 0x21,
+	0xce, 0x1e, 0xc0, 0x21, 0xc2, 0x1c, 0xc2, 0x21, 0xd5, 0x1c, 0xe4, 0x21, 0xc2, 0x5b, 0xc0, 0x28,
+	0x1c, 0x67, 0xc0, 0x9d, 0xbc, 0x9b, 0xdc, 0x9b, 0xbc, 0x9c, 0xcd, 0x9f, 0xab, 0x0c, 0x4f, 0x4b,
+	0x9a, 0x9d, 0x96, 0xbf, 0x00, 0xa1, 0x6a, 0xa1, 0x69, 0x65, 0x5a, 0xa2, 0x76, 0xa2, 0x78, 0xac,
+	0x12, 0xfe, 0xbd, 0xf7, 0xaf, 0x11, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xc8, 0x96, 0xdd, 0xfe, 0x73,
+	0x6e, 0x91, 0xff, 0x9d, 0x99, 0x24, 0x1d, 0xc0, 0x2a, 0x65, 0x0a, 0x7b, 0x08, 0x56, 0x08, 0xa2,
+	0x76, 0xc0, 0x56, 0x7f, 0x14, 0x55, 0xa2, 0x77, 0xa2, 0x77, 0x9d, 0x9a, 0x27, 0x20, 0xc0, 0x59,
+	0x6e, 0xc0, 0x1e, 0x0d, 0xa4, 0x75, 0xab, 0x61, 0xa7, 0x74, 0x9d, 0xb8, 0x9d, 0x9a, 0x99, 0x9c,
+	0x99, 0xad, 0x9e, 0x7a, 0x15, 0x1e, 0x69, 0xa0, 0xa7, 0x9d, 0xba, 0xfe, 0x8a, 0x81, 0xfe, 0xcc,
+	0x25, 0x0b, 0xa1, 0x96, 0xa3, 0x65, 0xfe, 0xfd, 0xe2, 0xa2, 0x66, 0x6e, 0xc0, 0x69, 0xc0, 0x59,
+	0xc0, 0xa2, 0x66, 0xc0, 0x23, 0xc0, 0x1e, 0x7a, 0x66, 0xdf, 0x6b, 0xc3, 0x65, 0x1c, 0xc4, 0x23,
+	0xc1, 0x66, 0xc1, 0x23, 0xc8, 0x28, 0xc1, 0x23, 0xc0, 0x1c, 0xc5, 0x21, 0xd0, 0x1c, 0xe4, 0x21,
+	0xc1, 0x5b, 0xc1, 0x69, 0x21, 0x1c, 0x67, 0x20, 0x67, 0x33, 0x9a, 0xde, 0x9d, 0xcc, 0x5a, 0x5e,
+	0x5f, 0x9f, 0x7b, 0x99, 0xae, 0xfe, 0x59, 0x60, 0x43, 0x9f, 0x7b, 0x6f, 0xa2, 0x66, 0x56, 0x45,
+	0xa2, 0x78, 0xfe, 0x73, 0xae, 0xfe, 0xd6, 0x9a, 0x2c, 0x6e, 0x2c, 0x31, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xc5, 0x2c, 0x98, 0xcc, 0xfe, 0x9c, 0xd3, 0xfe, 0x52, 0x8a, 0x9a, 0xbb, 0x9b, 0xba, 0x11, 0x2a,
+	0x69, 0x9d, 0xa9, 0x02, 0xa4, 0x64, 0x6e, 0xa2, 0x76, 0x21, 0x52, 0xc0, 0x9c, 0xac, 0xa1, 0x79,
+	0xa2, 0x68, 0x20, 0x5a, 0x69, 0x2a, 0x25, 0x69, 0xc0, 0x19, 0x1e, 0x19, 0xc0, 0x7a, 0xa3, 0x86,
+	0xa2, 0x96, 0x9d, 0xa8, 0x9d, 0xaa, 0x46, 0x5b, 0x1c, 0x19, 0x11, 0x1e, 0x9f, 0xa6, 0xa1, 0xa7,
+	0xfe, 0x9b, 0x03, 0xa9, 0x61, 0x9f, 0xb7, 0x79, 0xa3, 0x64, 0xa7, 0x12, 0xa4, 0x55, 0xa2, 0x67,
+	0x64, 0xc0, 0xa2, 0x66, 0x6e, 0x69, 0x6e, 0x6d, 0x5a, 0xc0, 0x21, 0xc0, 0x66, 0xdd, 0x17, 0x6b,
+	0xc2, 0x66, 0xc0, 0x25, 0xc8, 0x20, 0xc1, 0x25, 0xc4, 0x6e, 0xc0, 0x25, 0xc0, 0x19, 0xc2, 0x5e,
+	0x1e, 0xc0, 0x23, 0x1c, 0xc3, 0x21, 0xcf, 0x1c, 0xe4, 0x21, 0x5a, 0x6b, 0xc1, 0x21, 0xc2, 0x9d,
+	0xbb, 0xc0, 0xa1, 0x79, 0x22, 0x9b, 0xdc, 0x99, 0xde, 0x51, 0x6f, 0x53, 0xa1, 0x79, 0xa0, 0x7a,
+	0xfe, 0xa3, 0x04, 0xfe, 0x69, 0xa1, 0x9a, 0x9d, 0xa2, 0x58, 0xa1, 0x79, 0x5a, 0x6e, 0x5b, 0x0c,
+	0xfe, 0x8c, 0x30, 0xfe, 0xe7, 0x1c, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xc7, 0x2c, 0x31, 0x9d, 0xaa,
+	0x96, 0xdd, 0x93, 0xfe, 0x93, 0xee, 0x97, 0xdc, 0x9b, 0xa9, 0x55, 0xa3, 0x84, 0xfe, 0x72, 0xc1,
+	0xac, 0x10, 0xa5, 0x54, 0xa4, 0x64, 0x9c, 0xbb, 0x9b, 0xac, 0x98, 0xcf, 0xfe, 0x49, 0xa0, 0x9b,
+	0xad, 0xa3, 0x67, 0x5b, 0x56, 0x6e, 0x55, 0x7e, 0x7a, 0xc0, 0x66, 0x6b, 0x56, 0xa2, 0x78, 0x51,
+	0x79, 0x10, 0x61, 0xc0, 0x10, 0x6f, 0x25, 0x67, 0x18, 0x78, 0xa0, 0xa6, 0xaa, 0x51, 0xab, 0x50,
+	0xa4, 0x83, 0x9f, 0xb7, 0x60, 0xa2, 0x76, 0x0a, 0xa4, 0x65, 0x6e, 0x55, 0x6d, 0xa3, 0x56, 0xa3,
+	0x65, 0xa3, 0x65, 0xa2, 0x66, 0x6e, 0x65, 0x5a, 0x7e, 0x1c, 0xdd, 0x23, 0x66, 0xc0, 0x6b, 0xc1,
+	0x6b, 0xc0, 0x61, 0xc1, 0x66, 0xc2, 0x66, 0xc2, 0x66, 0xc0, 0x11, 0xc2, 0x6f, 0x16, 0xc0, 0x11,
+	0x16, 0xc0, 0x6f, 0x6e, 0xc0, 0xa2, 0x66, 0x6e, 0x2a, 0xc0, 0x23, 0xc1, 0x1c, 0xc2, 0x21, 0xce,
+	0x1c, 0xe4, 0x21, 0x5a, 0x6b, 0xc0, 0x28, 0x21, 0xc0, 0x19, 0x21, 0x1c, 0xc0, 0x23, 0x2a, 0x22,
+	0x99, 0xfe, 0x9b, 0xab, 0x66, 0x67, 0x9f, 0x9b, 0xa1, 0x79, 0xa2, 0x59, 0xfe, 0xa3, 0x04, 0xfe,
+	0x61, 0x80, 0x9c, 0x8c, 0xa0, 0x6a, 0xa2, 0x68, 0x6f, 0x24, 0x9c, 0xaa, 0xac, 0x22, 0xfe, 0xad,
+	0x55, 0xfe, 0xef, 0x7d, 0xa4, 0x66, 0xfd, 0xfd, 0xfd, 0xfd, 0xc3, 0x69, 0x31, 0xc1, 0x66, 0xc0,
+	0x31, 0x09, 0x98, 0xcb, 0x93, 0xfe, 0xfe, 0x52, 0x87, 0x98, 0xcc, 0xfe, 0x5a, 0x82, 0xfe, 0xbd,
+	0x24, 0xaa, 0x31, 0x68, 0xa4, 0x55, 0x66, 0x53, 0xfe, 0xcd, 0xa8, 0xfe, 0x7b, 0x22, 0xfe, 0x41,
+	0x60, 0x56, 0x5b, 0x6e, 0x5e, 0xa3, 0x65, 0xa3, 0x77, 0x9c, 0xbb, 0x0b, 0x6b, 0x6b, 0x53, 0xa3,
+	0x67, 0x5a, 0x65, 0x6e, 0x69, 0x65, 0x20, 0xc0, 0x57, 0x24, 0x7e, 0x9f, 0xb7, 0xa1, 0x95, 0xfe,
+	0xab, 0x87, 0xa7, 0x71, 0x9e, 0xb7, 0xa0, 0xa7, 0x39, 0x7e, 0x5f, 0x6e, 0x05, 0xc0, 0xa2, 0x65,
+	0x5a, 0xa2, 0x66, 0xa4, 0x64, 0xa5, 0x54, 0xa3, 0x55, 0x6d, 0xdf, 0x6b, 0x1e, 0xc0, 0x66, 0x66,
+	0x56, 0x66, 0x56, 0x66, 0x9d, 0xba, 0x7a, 0x66, 0x5a, 0x66, 0xc0, 0x66, 0x5a, 0x66, 0xc1, 0x08,
+	0xc1, 0x0d, 0xc1, 0x12, 0xc1, 0x1a, 0xc0, 0x6f, 0x7e, 0x6e, 0x02, 0x07, 0x5e, 0x7e, 0x6e, 0x7f,
+	0x23, 0xc1, 0x1c, 0xc1, 0x6e, 0xce, 0x1c, 0xe4, 0x21, 0x5a, 0xc1, 0x21, 0xc3, 0x6e, 0x21, 0x56,
+	0x6b, 0xa0, 0x9a, 0x1d, 0x9b, 0xcc, 0x9a, 0xdd, 0x67, 0x63, 0x5b, 0x5f, 0x47, 0xfe, 0x92, 0xe4,
+	0xfe, 0x59, 0x81, 0x9d, 0x7c, 0xa1, 0x69, 0x57, 0x6e, 0x6e, 0x51, 0xab, 0x33, 0xfe, 0xad, 0x75,
+	0xb1, 0x00, 0xa3, 0x66, 0xfd, 0xfd, 0xfd, 0xfd, 0xca, 0x2a, 0x9b, 0xb9, 0xfe, 0xb5, 0x71, 0xfe,
+	0x42, 0x03, 0xfe, 0x7b, 0x83, 0xfe, 0xe6, 0x24, 0xa3, 0x66, 0x54, 0x7a, 0x6e, 0x3e, 0x9f, 0x9b,
+	0x97, 0xcf, 0x95, 0xdf, 0xfe, 0x72, 0xc0, 0x42, 0xa3, 0x65, 0xa6, 0x54, 0xa8, 0x31, 0xa1, 0x8a,
+	0xfe, 0x7b, 0x63, 0xfe, 0x41, 0xa0, 0x9c, 0xac, 0xa2, 0x78, 0x46, 0xa2, 0x77, 0x5a, 0x66, 0xc2,
+	0x76, 0x6b, 0x5b, 0x1f, 0x79, 0xa1, 0x96, 0xa3, 0x84, 0xfe, 0xbc, 0x09, 0xa4, 0x83, 0x9c, 0xc8,
+	0xa2, 0x86, 0x9d, 0xba, 0xa3, 0x66, 0x4e, 0x52, 0x6e, 0x69, 0xa2, 0x76, 0x55, 0x64, 0xa3, 0x55,
+	0xa5, 0x53, 0xa7, 0x32, 0xa2, 0x66, 0x21, 0x1c, 0xc7, 0x21, 0xc3, 0x5a, 0x21, 0xc1, 0x1c, 0xc1,
+	0x6f, 0x1c, 0x66, 0x6b, 0x23, 0x6b, 0x66, 0x66, 0x66, 0x66, 0x62, 0x52, 0x33, 0x62, 0x56, 0x66,
+	0x66, 0x55, 0x03, 0x7a, 0x66, 0x5a, 0xc1, 0x66, 0x6f, 0xc3, 0x6b, 0xc0, 0x05, 0xc3, 0x6e, 0x7a,
+	0x03, 0x06, 0x03, 0x06, 0xc0, 0x03, 0xa2, 0x67, 0x6e, 0xc0, 0xa2, 0x66, 0x7e, 0x6e, 0x7e, 0xa2,
+	0x66, 0xa2, 0x76, 0x6e, 0x6e, 0x1e, 0xc0, 0x69, 0xc2, 0x6e, 0xc2, 0x6e, 0xc0, 0x1c, 0xc6, 0x21,
+	0xc0, 0x1c, 0xde, 0x21, 0xc2, 0x1c, 0xc1, 0x21, 0xc2, 0x56, 0xc0, 0x7b, 0x20, 0x67, 0x3a, 0x9b,
+	0xbc, 0x05, 0xa0, 0x9a, 0x52, 0xa1, 0x7a, 0x9d, 0x8b, 0x97, 0xaf, 0xfe, 0x51, 0x41, 0x9d, 0x7b,
+	0xa3, 0x58, 0xa1, 0x69, 0x7e, 0x9c, 0xb9, 0xa3, 0x66, 0xac, 0x22, 0xfe, 0xce, 0x37, 0xad, 0x12,
+	0x31, 0xc3, 0x25, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xc2, 0x69, 0xc0, 0x68, 0x96, 0xeb, 0xfe, 0x4a,
+	0x42, 0xfe, 0x9c, 0x85, 0xfe, 0xee, 0x64, 0xc0, 0x7e, 0x65, 0xc0, 0x9d, 0xaa, 0x3a, 0x6f, 0x52,
+	0x9b, 0xbb, 0x46, 0xa2, 0x78, 0xa3, 0x75, 0xa2, 0x74, 0x9f, 0x9c, 0x9a, 0xbf, 0xfe, 0x9c, 0x25,
+	0xfe, 0x62, 0xa2, 0x99, 0xbd, 0x52, 0x5a, 0x56, 0x7a, 0x0e, 0xa2, 0x78, 0x9c, 0xbb, 0x67, 0xa1,
+	0x79, 0x6b, 0xc0, 0x65, 0x79, 0xa4, 0x84, 0xfe, 0xab, 0xc8, 0xa4, 0x84, 0x75, 0xa2, 0x86, 0x9d,
+	0xa9, 0xa2, 0x77, 0x4f, 0x9c, 0xaa, 0x56, 0x9d, 0xa9, 0xa3, 0x76, 0xa4, 0x75, 0x6c, 0xa0, 0x95,
+	0xa4, 0x54, 0xa7, 0x32, 0xa5, 0x33, 0x69, 0x19, 0x1c, 0xc6, 0x6e, 0xc1, 0x1c, 0x19, 0x6e, 0xc0,
+	0x19, 0xc0, 0x66, 0xc0, 0x7b, 0x6b, 0xc0, 0x66, 0x66, 0x0f, 0x62, 0x9d, 0x9b, 0x52, 0x66, 0x62,
+	0x66, 0x66, 0x66, 0x77, 0xc6, 0x66, 0x5a, 0x6b, 0xc1, 0x6e, 0xc1, 0x6b, 0xc0, 0x7e, 0x15, 0xc0,
+	0x0e, 0xc0, 0x7a, 0xc1, 0x59, 0x0a, 0xc0, 0x6e, 0xc2, 0x5a, 0xc0, 0x69, 0xc1, 0x6e, 0xa2, 0x65,
+	0xc0, 0x1a, 0xa2, 0x66, 0xa2, 0x76, 0x7f, 0xa2, 0x66, 0xa2, 0x66, 0x20, 0x6d, 0xc0, 0x69, 0xc0,
+	0x1c, 0xc3, 0x17, 0xc1, 0x1c, 0xce, 0x21, 0xc0, 0x1c, 0xde, 0x6b, 0x1e, 0x25, 0x9d, 0xbc, 0x2b,
+	0x08, 0x73, 0x63, 0xa0, 0x7a, 0xa1, 0x79, 0x9c, 0x8c, 0xfe, 0x82, 0x22, 0x98, 0xae, 0xa1, 0x49,
+	0xa2, 0x3a, 0x9d, 0xc9, 0x69, 0xa2, 0x86, 0xc0, 0xfe, 0x7b, 0x8c, 0xfe, 0xe7, 0x1b, 0xa7, 0x45,
+	0x5a, 0xc0, 0x31, 0x66, 0xc0, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xc1, 0x2c, 0x69, 0x2a, 0x69, 0x93,
+	0xfc, 0xfe, 0x52, 0x84, 0xfe, 0xbd, 0x8c, 0xfe, 0xee, 0xaa, 0x65, 0x50, 0x9d, 0xa9, 0xa2, 0x86,
+	0xa2, 0x76, 0x6d, 0x65, 0xc0, 0x6e, 0x3a, 0x66, 0x2e, 0x65, 0x67, 0xa1, 0x79, 0xa0, 0x7a, 0x9a,
+	0xbd, 0x9b, 0xac, 0x99, 0xbd, 0x9b, 0xac, 0x66, 0xa2, 0x67, 0xa3, 0x77, 0x69, 0xfe, 0x52, 0x00,
+	0xfe, 0x31, 0x21, 0xa1, 0x7a, 0x6f, 0x52, 0x61, 0x7e, 0xa4, 0x74, 0xa9, 0x51, 0xa6, 0x74, 0xa2,
+	0x86, 0x7d, 0x9d, 0xaa, 0x45, 0x9a, 0xac, 0x9d, 0xaa, 0x51, 0x9c, 0xbb, 0xa4, 0x74, 0xac, 0x30,
+	0xa7, 0x52, 0xa0, 0x85, 0xa2, 0x74, 0xa7, 0x32, 0xa6, 0x32, 0xa2, 0x66, 0x5a, 0x1c, 0xc0, 0x6e,
+	0xc6, 0x1c, 0xc0, 0x23, 0x66, 0xc0, 0x6b, 0xc1, 0x67, 0x66, 0x61, 0x9d, 0xab, 0x9d, 0xba, 0x51,
+	0x08, 0x66, 0xc0, 0x67, 0x55, 0x7b, 0x6f, 0x7e, 0x6b, 0x66, 0x5a, 0xc2, 0x5a, 0xa0, 0x8a, 0xc2,
+	0x7f, 0xc1, 0x56, 0x1e, 0x56, 0xc0, 0x66, 0xc0, 0x66, 0x11, 0x7e, 0xc0, 0x1e, 0x19, 0x1e, 0x7e,
+	0xc0, 0x65, 0xc1, 0x10, 0x05, 0x79, 0x6b, 0x6e, 0x08, 0xc0, 0x05, 0x00, 0x05, 0xc0, 0x0d, 0xc0,
+	0x6e, 0xa3, 0x55, 0xa2, 0x66, 0x3f, 0xa2, 0x76, 0xa2, 0x66, 0xa2, 0x66, 0x6e, 0x69, 0x23, 0x6e,
+	0xc0, 0x55, 0xc1, 0x7e, 0x6e, 0x21, 0xc0, 0x1c, 0xca, 0x21, 0xc2, 0x1c, 0xde, 0x23, 0x6b, 0x25,
+	0x1d, 0x9a, 0xdc, 0x99, 0xde, 0x00, 0xa0, 0x8a, 0xa1, 0x89, 0x9f, 0x6b, 0x9d, 0x8b, 0x96, 0xbe,
+	0xfe, 0x41, 0x20, 0xa1, 0x4b, 0xc0, 0x7a, 0x7e, 0x55, 0xa3, 0x67, 0xfe, 0x94, 0xb2, 0xfe, 0xe7,
+	0x7d, 0xa4, 0x66, 0x66, 0x31, 0x66, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xc2, 0x2c, 0x31, 0x65, 0x65,
+	0x96, 0xdb, 0xfe, 0x5a, 0xc6, 0xfe, 0xa4, 0xec, 0xa4, 0x71, 0x9a, 0xbb, 0x97, 0xed, 0x9a, 0xbc,
+	0xfe, 0xa4, 0x01, 0xfe, 0xe6, 0x07, 0xa4, 0x63, 0x9f, 0x96, 0x64, 0x6e, 0x1b, 0xc0, 0x6b, 0x76,
+	0x6e, 0x6b, 0x6f, 0x6b, 0x37, 0x5b, 0x9d, 0xab, 0xa0, 0x8a, 0x6e, 0xa2, 0x77, 0x3c, 0xfe, 0x8b,
+	0x81, 0xfe, 0x39, 0x60, 0x9f, 0x8b, 0x6b, 0xa1, 0x79, 0x66, 0xc0, 0x64, 0x64, 0xa2, 0x86, 0xa1,
+	0x97, 0x6d, 0x1c, 0x55, 0x57, 0x05, 0x7b, 0x61, 0xa1, 0x97, 0xfe, 0x9a, 0xa3, 0xfe, 0xd4, 0x26,
+	0xa1, 0x84, 0xa2, 0x74, 0xa6, 0x42, 0xa6, 0x33, 0x2a, 0x69, 0x5e, 0x69, 0xc2, 0x21, 0xc1, 0x66,
+	0x17, 0xc0, 0x6b, 0x2a, 0x20, 0x1b, 0x6b, 0x61, 0x62, 0x52, 0x62, 0x51, 0x0f, 0x62, 0xc0, 0x7b,
+	0x6e, 0x6f, 0x56, 0x66, 0x0e, 0x5a, 0x6b, 0xc0, 0x6b, 0x5a, 0xc0, 0x5e, 0xc0, 0x5a, 0x9d, 0xac,
+	0x56, 0x66, 0x56, 0x69, 0xc0, 0x66, 0xc0, 0x56, 0x69, 0xc2, 0x66, 0x7e, 0x6e, 0x7f, 0xc0, 0x6e,
+	0xc0, 0x7e, 0x0a, 0xc0, 0x7e, 0xa2, 0x77, 0xc0, 0xa0, 0x95, 0x10, 0xc0, 0x7e, 0x6b, 0x66, 0x0e,
+	0xc2, 0x69, 0xc0, 0x66, 0xa2, 0x66, 0x5d, 0xc0, 0xa2, 0x75, 0xa2, 0x77, 0x33, 0xa3, 0x56, 0xa2,
+	0x76, 0x1b, 0xa2, 0x66, 0x2a, 0x5a, 0x69, 0x6e, 0xc1, 0x69, 0xc0, 0x7a, 0xc0, 0x66, 0xc7, 0x21,
+	0xc4, 0x1c, 0xde, 0x23, 0x66, 0x67, 0x11, 0x99, 0xdd, 0x9d, 0xbb, 0x00, 0x13, 0x19, 0xa1, 0x6a,
+	0x9b, 0x9c, 0xfe, 0x6a, 0x02, 0x99, 0x9f, 0x5a, 0xa2, 0x77, 0x57, 0x6e, 0x6f, 0xa5, 0x56, 0xfe,
+	0xad, 0x96, 0xfe, 0xf7, 0xdf, 0x7a, 0xc1, 0x6e, 0xfd, 0xfd, 0xfd, 0xfd, 0xc4, 0x51, 0x7e, 0x9b,
+	0xb9, 0xfe, 0x5a, 0xa7, 0x39, 0x9e, 0x97, 0x9a, 0xcc, 0x61, 0x9d, 0xab, 0xfe, 0x62, 0x40, 0xfe,
+	0xbc, 0xe6, 0xfe, 0xe6, 0x26, 0xa1, 0x94, 0x6c, 0x1c, 0xc1, 0x1e, 0x6f, 0x66, 0x65, 0x25, 0x2a,
+	0x19, 0x25, 0x29, 0x3f, 0x5a, 0xc0, 0x6e, 0xfe, 0xb4, 0xc2, 0xfe, 0x62, 0x61, 0x99, 0xae, 0x9c,
+	0xac, 0xa2, 0x69, 0x6f, 0x66, 0xa2, 0x76, 0x9d, 0xa9, 0x79, 0x6e, 0x6e, 0xa1, 0x79, 0x56, 0x1d,
+	0xc0, 0xa0, 0xa8, 0x74, 0x60, 0xab, 0x50, 0xfe, 0xc3, 0xe6, 0xa3, 0x83, 0xa2, 0x74, 0xa5, 0x52,
+	0xa5, 0x44, 0x25, 0x1e, 0xa2, 0x56, 0x6e, 0x69, 0x66, 0xc1, 0x1c, 0x6b, 0xc0, 0x66, 0x19, 0x66,
+	0x66, 0x63, 0x61, 0x9d, 0xab, 0x51, 0x52, 0x67, 0x66, 0x62, 0x6b, 0x6b, 0x7f, 0xc0, 0x66, 0xa2,
+	0x56, 0x17, 0x66, 0x57, 0x5a, 0x62, 0x46, 0x52, 0x46, 0x41, 0x41, 0x52, 0x41, 0x53, 0x56, 0x66,
+	0x55, 0x65, 0x66, 0x59, 0x66, 0xc5, 0x7a, 0xc0, 0x6e, 0x7e, 0xc0, 0x6f, 0x6e, 0x7e, 0x7f, 0xa3,
+	0x66, 0xa2, 0x77, 0x7f, 0xa4, 0x83, 0x7e, 0x7f, 0xa2, 0x86, 0x7f, 0x6e, 0x7a, 0x79, 0xc0, 0x7e,
+	0x69, 0xc0, 0x69, 0x6e, 0x69, 0x66, 0x00, 0x6d, 0x03, 0xa2, 0x66, 0xa2, 0x76, 0xa2, 0x66, 0xa3,
+	0x56, 0xa3, 0x66, 0xa2, 0x66, 0x6f, 0xa2, 0x65, 0x25, 0x20, 0xc1, 0x7e, 0xc0, 0x65, 0x6e, 0xcc,
+	0x1c, 0xdd, 0x21, 0x1c, 0x56, 0x19, 0x67, 0x9d, 0xbb, 0x1a, 0x03, 0xa0, 0x8a, 0x53, 0xa1, 0x79,
+	0x9f, 0x8b, 0x98, 0xae, 0xfe, 0x59, 0xa1, 0x9b, 0xac, 0xa1, 0x69, 0xa0, 0x6a, 0x6f, 0x5f, 0x65,
+	0xae, 0x11, 0xfe, 0xc6, 0x38, 0xad, 0x22, 0xc0, 0x66, 0xa2, 0x66, 0xfd, 0xfd, 0xfd, 0xfd, 0xc3,
+	0x2c, 0x27, 0x6d, 0x96, 0xed, 0xfe, 0x4a, 0x06, 0x9c, 0x99, 0x9d, 0x99, 0xa4, 0x76, 0xae, 0x12,
+	0x98, 0xdb, 0x97, 0xdb, 0xfe, 0x6a, 0x80, 0xfe, 0xbd, 0x06, 0xa8, 0x50, 0xa4, 0x63, 0x64, 0xc0,
+	0x38, 0x56, 0x5a, 0x6b, 0xa1, 0x89, 0x66, 0x9a, 0xba, 0x9c, 0xa9, 0xa8, 0x32, 0x2e, 0x6f, 0x56,
+	0x9d, 0x9b, 0xa4, 0x67, 0x9e, 0x9c, 0xfe, 0xac, 0xc9, 0xfe, 0x6b, 0x04, 0xfe, 0x39, 0xa1, 0x23,
+	0x6b, 0x56, 0x79, 0x51, 0x7e, 0x6e, 0x5a, 0x6b, 0x5b, 0x6f, 0x7a, 0x22, 0xa0, 0xa7, 0x9e, 0xc8,
+	0xfe, 0x8a, 0xc5, 0xfe, 0xc4, 0x27, 0xa1, 0xa4, 0x16, 0x1a, 0xa5, 0x53, 0xa4, 0x45, 0xa2, 0x66,
+	0xa2, 0x56, 0xc2, 0x76, 0xc1, 0x67, 0xc0, 0x62, 0x61, 0x9d, 0xab, 0x61, 0x62, 0x52, 0x03, 0x56,
+	0x6b, 0x6f, 0x6b, 0x17, 0x67, 0x6b, 0xc0, 0x6b, 0x5a, 0x9c, 0x8a, 0x41, 0x51, 0x9d, 0x9b, 0x9d,
+	0xaa, 0x52, 0x41, 0x52, 0x56, 0x56, 0x5a, 0x52, 0x56, 0x7a, 0xc1, 0x0c, 0xc1, 0x0f, 0x59, 0xc0,
+	0x66, 0x05, 0x7a, 0xc3, 0x66, 0x00, 0x66, 0x00, 0xa2, 0x76, 0x08, 0x00, 0xc0, 0x05, 0x08, 0x7f,
+	0x7e, 0xa2, 0x77, 0xa2, 0x87, 0xa2, 0x76, 0xa2, 0x87, 0xa2, 0x76, 0xa4, 0x75, 0xa3, 0x65, 0xa3,
+	0x76, 0xa2, 0x86, 0x6e, 0x65, 0x78, 0x7e, 0x69, 0xc1, 0x69, 0xc0, 0x65, 0xa2, 0x66, 0xa2, 0x76,
+	0x1a, 0xa2, 0x77, 0xa2, 0x76, 0x1b, 0x25, 0x6e, 0xc0, 0x23, 0x1e, 0x69, 0x6e, 0xc0, 0x6e, 0xc0,
+	0x5a, 0xc0, 0x21, 0xc7, 0x1c, 0xdc, 0x21, 0x6e, 0x21, 0x1c, 0x17, 0x67, 0x6b, 0x9a, 0xdc, 0x1a,
+	0x9d, 0xab, 0x0c, 0x67, 0x9f, 0x8b, 0x43, 0x98, 0x9d, 0x96, 0xbf, 0x9d, 0x8c, 0xa1, 0x5a, 0xa1,
+	0x69, 0x5a, 0x30, 0x6e, 0xfe, 0x7b, 0xce, 0xfe, 0xde, 0xbb, 0xa9, 0x33, 0xc0, 0x6e, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xc3, 0x52, 0x31, 0x9a, 0xcc, 0xfe, 0x9c, 0xb2, 0xfe, 0x29, 0x23, 0xa3, 0x66, 0x6f,
+	0x25, 0xfe, 0xef, 0x3c, 0xfe, 0xb5, 0x55, 0xfe, 0x41, 0xc4, 0x9e, 0xa7, 0xa4, 0x63, 0xfe, 0x9c,
+	0x43, 0xfe, 0xde, 0x28, 0x7d, 0x66, 0x7f, 0x5a, 0x5f, 0x62, 0x62, 0x93, 0xff, 0x96, 0xdf, 0xa4,
+	0x64, 0xfe, 0xd5, 0xa3, 0x32, 0x5a, 0x52, 0x9a, 0xbd, 0xa2, 0x79, 0xa5, 0x59, 0x9b, 0xbe, 0xfe,
+	0x7b, 0x66, 0xfe, 0x41, 0xa1, 0x9b, 0xad, 0x6f, 0x11, 0x7a, 0x6e, 0xc1, 0x5a, 0x6b, 0x5a, 0x5e,
+	0x7e, 0x61, 0xa1, 0x97, 0x9f, 0xb7, 0xfe, 0x8b, 0x06, 0xa9, 0x61, 0xa1, 0x94, 0xa1, 0x84, 0x08,
+	0xa4, 0x64, 0xa6, 0x33, 0xa3, 0x56, 0x23, 0xc1, 0x66, 0xc0, 0x6b, 0x20, 0x62, 0x9c, 0xcb, 0x9c,
+	0xab, 0x52, 0x03, 0x66, 0x03, 0x6b, 0x6f, 0x0e, 0x57, 0x57, 0x6f, 0xa1, 0x79, 0x6b, 0x52, 0x9b,
+	0xbb, 0x99, 0xbc, 0x9a, 0xbc, 0x9d, 0x6a, 0x56, 0x56, 0x66, 0xc0, 0x7a, 0x5b, 0x66, 0xc1, 0x6f,
+	0x5a, 0xc0, 0x9f, 0xb8, 0xc0, 0x69, 0x66, 0x03, 0xc0, 0x7e, 0xa3, 0x66, 0x7e, 0xa2, 0x77, 0xa2,
+	0x76, 0xa2, 0x77, 0x7f, 0x21, 0x6b, 0x21, 0x66, 0x41, 0x2c, 0x51, 0x0b, 0x03, 0xc1, 0x08, 0x0b,
+	0xa0, 0x7a, 0x6b, 0x55, 0x7a, 0x0a, 0xc0, 0x79, 0xc1, 0xa3, 0x75, 0xa6, 0x53, 0xa8, 0x43, 0xa7,
+	0x54, 0xa3, 0x84, 0x79, 0x65, 0x66, 0x65, 0x7a, 0x6e, 0x79, 0x69, 0x69, 0xc0, 0x6e, 0x6e, 0xa4,
+	0x44, 0xa3, 0x55, 0xa3, 0x66, 0xa3, 0x66, 0x20, 0x69, 0x69, 0xa2, 0x66, 0xc0, 0x6e, 0x5a, 0xc0,
+	0x6e, 0x21, 0x1c, 0xc0, 0x21, 0xc3, 0x1c, 0xdd, 0x21, 0x26, 0x21, 0x26, 0x67, 0x62, 0xc0, 0x1b,
+	0x9b, 0xcc, 0x99, 0xde, 0x9d, 0xbb, 0xa0, 0x8a, 0x09, 0xa1, 0x7a, 0x9f, 0x69, 0xfe, 0x82, 0x62,
+	0xfe, 0x49, 0x00, 0xa0, 0x5a, 0xa2, 0x59, 0x5b, 0x7e, 0xc0, 0xa5, 0x65, 0xfe, 0xa4, 0xf3, 0xfe,
+	0xf7, 0x9e, 0x31, 0xfd, 0xfd, 0xfd, 0xee, 0x66, 0xc0, 0x31, 0xc1, 0x2c, 0x31, 0xc8, 0x69, 0x31,
+	0xc2, 0x9a, 0xcd, 0xfe, 0x8c, 0x52, 0xfe, 0x39, 0xc7, 0x9c, 0xba, 0x59, 0xa5, 0x54, 0xfe, 0xb5,
+	0xb6, 0x18, 0x2c, 0x95, 0xed, 0xfe, 0x83, 0xac, 0x94, 0xdb, 0x9c, 0xb9, 0xa6, 0x52, 0xab, 0x21,
+	0xa4, 0x76, 0x66, 0x55, 0x59, 0x97, 0xde, 0x9b, 0xbc, 0x9c, 0xac, 0xa5, 0x63, 0xfe, 0xb4, 0xe3,
+	0xaa, 0x32, 0xa2, 0x75, 0x9d, 0xaa, 0xfe, 0x83, 0x60, 0xfe, 0x5a, 0x00, 0xfe, 0x8b, 0x83, 0xb0,
+	0x02, 0xfe, 0x72, 0xc3, 0xfe, 0x41, 0x40, 0xa7, 0x45, 0x9c, 0xac, 0x9c, 0xab, 0xc0, 0x7a, 0xc0,
+	0xa5, 0x55, 0xa2, 0x77, 0x17, 0x6f, 0x46, 0xa2, 0x66, 0x65, 0xc0, 0x75, 0x75, 0x33, 0xfe, 0x9b,
+	0x04, 0xa9, 0x51, 0xa3, 0x73, 0x9f, 0x96, 0x7d, 0xa3, 0x65, 0xa6, 0x43, 0xa2, 0x66, 0xa2, 0x67,
+	0x66, 0xc1, 0x05, 0x9c, 0xbb, 0x1a, 0x62, 0x52, 0x66, 0x7b, 0x6f, 0x46, 0xa1, 0x79, 0x56, 0xa1,
+	0x79, 0x6f, 0x9d, 0x8b, 0x9b, 0xac, 0x9d, 0x9a, 0x9a, 0xac, 0x9a, 0xbc, 0x9d, 0x9a, 0x66, 0x6f,
+	0xa0, 0x6a, 0x5a, 0x1c, 0x7a, 0xc0, 0x13, 0x65, 0x6e, 0x65, 0x7a, 0x0d, 0xa2, 0x87, 0xa2, 0x76,
+	0xa1, 0xb7, 0x7f, 0xa3, 0x76, 0xa4, 0x55, 0xa3, 0x77, 0xa2, 0x76, 0xa2, 0x77, 0xa2, 0x77, 0x7d,
+	0xc0, 0x6e, 0xc5, 0x6b, 0x66, 0x59, 0x52, 0x51, 0x9d, 0xaa, 0x9d, 0x99, 0x9d, 0x9a, 0x51, 0x9e,
+	0x7b, 0x42, 0x9d, 0xaa, 0x51, 0x03, 0x6f, 0xc2, 0x03, 0x5a, 0xc0, 0x0d, 0xa6, 0x63, 0xa4, 0x74,
+	0xa5, 0x66, 0xa4, 0x76, 0xa3, 0x86, 0xa2, 0x86, 0x79, 0x50, 0x7e, 0x74, 0x69, 0x69, 0x7e, 0x4a,
+	0xa2, 0x66, 0xa3, 0x65, 0xa3, 0x66, 0xa3, 0x65, 0xa2, 0x66, 0xa2, 0x66, 0xa2, 0x66, 0x69, 0x6e,
+	0x5a, 0x6e, 0x6e, 0x76, 0x1c, 0xc2, 0x21, 0xc0, 0x1c, 0xde, 0x21, 0xc2, 0x67, 0xc1, 0x67, 0x62,
+	0x9a, 0xdd, 0x03, 0x63, 0xa0, 0x9a, 0x6b, 0x4b, 0x9c, 0x8c, 0xfe, 0x72, 0x23, 0x98, 0x9e, 0xa2,
+	0x59, 0x57, 0x6f, 0x24, 0x1d, 0xac, 0x22, 0xfe, 0xc5, 0xf8, 0xfe, 0xff, 0xff, 0x66, 0x31, 0xc0,
+	0x2c, 0xc0, 0x31, 0xfd, 0xfd, 0xfd, 0xe8, 0x2c, 0xc0, 0x31, 0xc4, 0x2c, 0x55, 0x2c, 0x31, 0xc0,
+	0x2c, 0x31, 0xc0, 0x2a, 0x31, 0xc1, 0x2c, 0x96, 0xde, 0xfe, 0x6b, 0x4e, 0xfe, 0x31, 0x45, 0xc0,
+	0x59, 0xae, 0x10, 0xfe, 0xdf, 0x1a, 0xa4, 0x78, 0x2c, 0x18, 0x9d, 0xa9, 0x98, 0xba, 0x96, 0xeb,
+	0x97, 0xcb, 0x93, 0xfe, 0x99, 0xcd, 0xa3, 0x75, 0x56, 0x66, 0x11, 0x0c, 0xa7, 0x51, 0xfe, 0xa4,
+	0x84, 0xfe, 0xde, 0x28, 0xa2, 0x76, 0x7b, 0xfe, 0xac, 0x63, 0xfe, 0x6a, 0x60, 0x9d, 0xab, 0x52,
+	0xa8, 0x44, 0x95, 0xef, 0xa7, 0x53, 0xab, 0x24, 0x95, 0xdf, 0x95, 0xef, 0xa2, 0x87, 0xa5, 0x54,
+	0xa6, 0x65, 0xa9, 0x33, 0x9c, 0xaa, 0xfe, 0x51, 0x62, 0x52, 0x46, 0xa2, 0x57, 0x6e, 0x67, 0x65,
+	0x0b, 0x07, 0xa4, 0x83, 0xaa, 0x51, 0xaa, 0x40, 0xa2, 0x75, 0x7c, 0x69, 0xa3, 0x75, 0xa3, 0x64,
+	0x7f, 0xc1, 0x66, 0x42, 0x9d, 0xaa, 0x53, 0xc0, 0x67, 0x7f, 0x6b, 0x5b, 0xa1, 0x69, 0x9d, 0x9b,
+	0x3d, 0x9c, 0x9a, 0x9b, 0xac, 0x9b, 0xab, 0x15, 0x42, 0x6b, 0x6f, 0x5a, 0x66, 0x0b, 0x6f, 0x10,
+	0xc0, 0x75, 0x7e, 0xa3, 0x75, 0xa2, 0x77, 0xa2, 0x86, 0xa2, 0x86, 0xa4, 0x65, 0xa3, 0x77, 0x3d,
+	0xa2, 0x76, 0xa1, 0xa7, 0x7a, 0x6e, 0xc1, 0x69, 0xc0, 0x79, 0xc0, 0x1a, 0xc0, 0x65, 0x5a, 0xc0,
+	0x6e, 0xc0, 0x6b, 0xc3, 0x19, 0xc0, 0x1e, 0x19, 0x5a, 0x53, 0x42, 0x9c, 0xaa, 0x3c, 0x9d, 0x9a,
+	0x9d, 0x9b, 0x41, 0x9c, 0x9b, 0x66, 0x46, 0xc0, 0x0c, 0x6f, 0x0c, 0x05, 0xa1, 0x98, 0xa3, 0x76,
+	0xa4, 0x66, 0xa5, 0x74, 0xa3, 0x76, 0xa5, 0x64, 0xa1, 0x96, 0x19, 0xa2, 0x86, 0x64, 0x55, 0x6e,
+	0x69, 0x65, 0x6e, 0xa2, 0x76, 0xa3, 0x65, 0xa3, 0x55, 0xa3, 0x66, 0xa3, 0x55, 0xa2, 0x66, 0xa2,
+	0x66, 0x56, 0x69, 0xc0, 0x7a, 0xc0, 0x6e, 0xc0, 0x1c, 0xe0, 0x21, 0xc1, 0x1c, 0x6b, 0xc1, 0x1e,
+	0x6b, 0x9c, 0xcb, 0x99, 0xef, 0x01, 0x67, 0xa0, 0x8a, 0x0e, 0x9f, 0x7b, 0x9a, 0x8e, 0xfe, 0x59,
+	0xc2, 0x9a, 0xad, 0xa2, 0x59, 0x56, 0xc0, 0xa2, 0x77, 0xc0, 0xfe, 0x7b, 0xae, 0xfe, 0xe7, 0x1c,
+	0xa6, 0x55, 0xc0, 0x6e, 0xc0, 0x2c, 0x31, 0xfd, 0xfd, 0xfd, 0xeb, 0x2c, 0x31, 0xc3, 0x2c, 0xc0,
+	0x31, 0xc0, 0x2c, 0xc0, 0x31, 0x2a, 0x31, 0xc1, 0x2c, 0xfe, 0xc5, 0xf9, 0xfe, 0x52, 0x6a, 0x95,
+	0xed, 0xa3, 0x67, 0xa2, 0x75, 0xfe, 0x9c, 0xf1, 0xfe, 0xf7, 0xdd, 0x66, 0x31, 0x56, 0x66, 0x31,
+	0x9b, 0xba, 0x9c, 0xaa, 0xfe, 0x8c, 0x6f, 0xfe, 0x39, 0xc4, 0x9c, 0xaa, 0x65, 0xa2, 0x87, 0x64,
+	0xfe, 0x62, 0x60, 0xfe, 0xa4, 0xa5, 0xfe, 0xde, 0x28, 0xa2, 0x76, 0xa1, 0x89, 0x9c, 0xcc, 0xfe,
+	0x8a, 0xe1, 0x9b, 0xbd, 0xa5, 0x68, 0x94, 0xee, 0x66, 0xa5, 0x53, 0xfe, 0xb3, 0xe7, 0xa4, 0x67,
+	0xfe, 0x7a, 0x43, 0xfe, 0x50, 0xe0, 0xaa, 0x41, 0xa9, 0x42, 0xa5, 0x65, 0xa4, 0x66, 0x98, 0xbd,
+	0x16, 0x42, 0x56, 0xa2, 0x58, 0x6f, 0x5b, 0x56, 0x7a, 0x79, 0x9d, 0xb8, 0xa5, 0x73, 0xa9, 0x51,
+	0xa9, 0x41, 0xa5, 0x73, 0x6e, 0x78, 0x78, 0xc0, 0x6e, 0x6b, 0xc0, 0x52, 0x5b, 0x17, 0x6b, 0x6b,
+	0x56, 0x10, 0x56, 0x97, 0xaf, 0x9c, 0x9b, 0x9d, 0x9a, 0x51, 0x00, 0x6b, 0x13, 0x5a, 0x6b, 0x5a,
+	0xc0, 0x17, 0x6e, 0x74, 0x69, 0xa3, 0x76, 0xa7, 0x64, 0xa6, 0x64, 0xa2, 0x76, 0xa1, 0x97, 0xa3,
+	0x75, 0x7e, 0xa1, 0x97, 0x1e, 0xc0, 0x7a, 0x64, 0xc1, 0x69, 0xc1, 0x69, 0x7e, 0xc1, 0x69, 0x5a,
+	0xc1, 0x6e, 0xc1, 0x6b, 0x02, 0xc1, 0x66, 0x09, 0xc1, 0x66, 0x0e, 0x7a, 0x6b, 0x5b, 0x46, 0x43,
+	0x38, 0x9d, 0x9b, 0x9c, 0x9b, 0x9b, 0x9b, 0x9b, 0xab, 0x05, 0x5a, 0x17, 0x57, 0x7a, 0x6e, 0x7e,
+	0x7d, 0x7d, 0xa4, 0x74, 0xa3, 0x85, 0xa6, 0x64, 0xa7, 0x52, 0xa2, 0x86, 0x7d, 0x21, 0x69, 0x0e,
+	0x07, 0x00, 0x03, 0x6e, 0xa3, 0x55, 0xa3, 0x65, 0xa4, 0x65, 0xa3, 0x56, 0x6e, 0x6e, 0x65, 0x69,
+	0x6f, 0xc0, 0x69, 0xe1, 0x6e, 0xc0, 0x1c, 0x23, 0xc4, 0x20, 0x9c, 0xcc, 0x98, 0xee, 0x9c, 0xcc,
+	0x6b, 0x6b, 0xa2, 0x59, 0x9e, 0x7c, 0xfe, 0x92, 0xe5, 0xfe, 0x51, 0x40, 0x13, 0x5f, 0x42, 0xa3,
+	0x67, 0x9d, 0x99, 0xa5, 0x56, 0xfe, 0xa5, 0x34, 0xfe, 0xf7, 0xbe, 0x31, 0xfd, 0xfd, 0xfd, 0xf1,
+	0x66, 0x9b, 0xaa, 0x99, 0xcc, 0x15, 0x9c, 0xaa, 0x15, 0xab, 0x33, 0xa8, 0x44, 0x2c, 0x31, 0xc0,
+	0x69, 0x56, 0x2a, 0x31, 0x2c, 0x92, 0xff, 0xfe, 0x52, 0x6a, 0x96, 0xdc, 0xa3, 0x66, 0xa3, 0x77,
+	0xfe, 0xbd, 0xf5, 0x2a, 0x55, 0x66, 0x1d, 0x6f, 0x7e, 0x9d, 0xaa, 0x31, 0xfe, 0xc5, 0xf6, 0xfe,
+	0x52, 0x46, 0x98, 0xcb, 0x69, 0x7a, 0xa9, 0x41, 0xfe, 0xa4, 0x88, 0xfe, 0xde, 0x4c, 0xa3, 0x75,
+	0x9d, 0xa9, 0x9c, 0xbc, 0xfe, 0xb4, 0x67, 0xfe, 0x69, 0xc0, 0xa7, 0x54, 0xaa, 0x44, 0x94, 0xed,
+	0x9b, 0xbb, 0x32, 0xa5, 0x55, 0x52, 0x9a, 0xbb, 0x9d, 0xba, 0xa8, 0x43, 0xa4, 0x65, 0x65, 0xc0,
+	0x9c, 0x9b, 0x95, 0xdf, 0xa1, 0x7a, 0x3f, 0xa3, 0x49, 0x9a, 0xac, 0x9b, 0xab, 0x42, 0x56, 0x7a,
+	0x74, 0x9e, 0xa7, 0xa1, 0xa7, 0xfe, 0x92, 0x61, 0xac, 0x30, 0x1e, 0x60, 0xa2, 0x85, 0x0a, 0x5a,
+	0x0e, 0x5f, 0xc0, 0xa1, 0x79, 0x2e, 0x57, 0x9d, 0x9a, 0x9a, 0xad, 0x98, 0xcc, 0x9a, 0xbc, 0x3b,
+	0xc0, 0x6b, 0x13, 0x6e, 0x13, 0x5a, 0x65, 0xc0, 0x79, 0x7e, 0xa2, 0x77, 0xa2, 0x76, 0xa9, 0x51,
+	0xa4, 0x64, 0xa4, 0x76, 0xa3, 0x76, 0x1f, 0x79, 0x69, 0x7a, 0x69, 0x7a, 0x55, 0xc0, 0x69, 0x6d,
+	0xc0, 0x6e, 0x6f, 0x7e, 0x69, 0x6f, 0xa2, 0x76, 0xc1, 0x6e, 0xc1, 0x6e, 0xc0, 0x2b, 0xc0, 0x56,
+	0xc0, 0x66, 0xc0, 0x19, 0xc1, 0x56, 0x0c, 0x9e, 0xca, 0x66, 0x66, 0x5b, 0x0e, 0x5b, 0xa1, 0x79,
+	0x6f, 0x46, 0x9d, 0x9b, 0x9b, 0xaa, 0x99, 0xbc, 0x9b, 0xac, 0x9c, 0x9d, 0x9e, 0x8c, 0x59, 0xc0,
+	0x6f, 0x6e, 0x69, 0x64, 0x7a, 0xa2, 0x86, 0xa5, 0x63, 0xa7, 0x54, 0xa6, 0x64, 0xa3, 0x87, 0xa1,
+	0x97, 0x7e, 0x68, 0x69, 0x10, 0x7d, 0x54, 0xa2, 0x66, 0xa3, 0x65, 0xa3, 0x76, 0xa3, 0x66, 0xa3,
+	0x56, 0xa2, 0x65, 0x6d, 0xc0, 0x66, 0x6d, 0xe1, 0x6e, 0xc0, 0x1c, 0xc3, 0x21, 0x1c, 0x23, 0x63,
+	0x33, 0x9a, 0xdd, 0x52, 0x0f, 0xa0, 0x7a, 0x2a, 0x19, 0xfe, 0x82, 0x42, 0xfe, 0x49, 0x00, 0xa2,
+	0x58, 0x47, 0x6f, 0x6f, 0x41, 0xaf, 0x10, 0xfe, 0xce, 0x58, 0xad, 0x12, 0xfd, 0xfd, 0xfd, 0xec,
+	0x66, 0x31, 0xc0, 0x1d, 0x99, 0xcc, 0x92, 0xff, 0x93, 0xee, 0x98, 0xcc, 0x99, 0xcc, 0x15, 0xa4,
+	0x66, 0xa9, 0x44, 0xab, 0x23, 0xab, 0x33, 0xa8, 0x44, 0xaa, 0x31, 0x6e, 0xc0, 0x31, 0xc1, 0x94,
+	0xef, 0xfe, 0x63, 0x0c, 0x92, 0xff, 0x7e, 0xa5, 0x55, 0xfe, 0xbd, 0xf7, 0xfe, 0xf7, 0xdd, 0x7e,
+	0x1b, 0xc0, 0x6b, 0x62, 0x66, 0x54, 0xfe, 0x9c, 0x8f, 0xfe, 0x39, 0x81, 0x65, 0xa6, 0x52, 0xaa,
+	0x43, 0xaf, 0x00, 0x50, 0x99, 0xca, 0xa3, 0x66, 0x7f, 0x97, 0xee, 0xfe, 0x69, 0xe0, 0x9a, 0xce,
+	0xfe, 0xa3, 0x25, 0xa9, 0x42, 0x9c, 0xa9, 0x9b, 0xc9, 0x12, 0xc0, 0x56, 0xa2, 0x87, 0xc0, 0x6d,
+	0x65, 0x51, 0xa3, 0x66, 0xa0, 0x8a, 0x9c, 0x9b, 0xa3, 0x69, 0x9f, 0x6a, 0x9a, 0x9e, 0xfe, 0x59,
+	0xe5, 0x9a, 0xac, 0x2c, 0x24, 0x66, 0xa1, 0x96, 0x9e, 0xa7, 0x71, 0xfe, 0x82, 0x21, 0xfe, 0xc3,
+	0xc5, 0xa3, 0x85, 0x65, 0x79, 0x66, 0x6f, 0x6f, 0x5b, 0x5f, 0x42, 0x9c, 0x9b, 0x99, 0xad, 0x9a,
+	0xbc, 0x9c, 0x9b, 0x9c, 0xab, 0x42, 0xa5, 0x56, 0x69, 0x56, 0xc1, 0x65, 0x7d, 0x7e, 0x7e, 0xa3,
+	0x76, 0xa6, 0x64, 0xa7, 0x54, 0xa5, 0x64, 0xa0, 0x95, 0xa2, 0x86, 0xa2, 0x77, 0x69, 0x69, 0x75,
+	0x59, 0x7a, 0x6d, 0xc0, 0x6e, 0x7e, 0x6f, 0xa3, 0x55, 0x7e, 0xa2, 0x67, 0x7e, 0x6f, 0x6e, 0xc0,
+	0x69, 0xc0, 0x6e, 0xc2, 0x6f, 0x69, 0x2c, 0xc0, 0x20, 0x1b, 0xc0, 0x66, 0x56, 0x09, 0x51, 0x56,
+	0x61, 0x08, 0x76, 0x6f, 0xc0, 0x67, 0x42, 0x56, 0x67, 0xa3, 0x66, 0xa2, 0x68, 0x6b, 0x9d, 0xa9,
+	0x3a, 0x9a, 0x9f, 0x9a, 0xbd, 0x9a, 0x9b, 0x9c, 0x9b, 0x5a, 0x6f, 0xa2, 0x67, 0xc1, 0x51, 0x61,
+	0x05, 0xa3, 0x76, 0xa6, 0x74, 0x14, 0xa6, 0x64, 0xa4, 0x65, 0x79, 0x78, 0x6d, 0x64, 0x69, 0x69,
+	0x7e, 0xa3, 0x66, 0xa3, 0x66, 0xa6, 0x32, 0x25, 0x6d, 0xc1, 0x65, 0xc0, 0x6e, 0xde, 0x6e, 0xc0,
+	0x1c, 0xc2, 0x21, 0x6e, 0x52, 0xc0, 0xa0, 0x9a, 0x16, 0x9a, 0xdd, 0x0b, 0x63, 0x57, 0xa0, 0x8a,
+	0xa2, 0x69, 0x98, 0xae, 0xfe, 0x69, 0xc1, 0x99, 0x9e, 0xa3, 0x58, 0x47, 0xa2, 0x67, 0x6e, 0x7e,
+	0xfe, 0x7b, 0xef, 0xfe, 0xef, 0x5d, 0xa5, 0x55, 0xc0, 0x66, 0x31, 0xfd, 0xfd, 0xfd, 0xea, 0x96,
+	0xdd, 0xfe, 0x94, 0x92, 0x95, 0xdd, 0x97, 0xdd, 0x99, 0xbb, 0xc0, 0xa3, 0x77, 0xa2, 0x77, 0x29,
+	0x15, 0xa2, 0x88, 0xa5, 0x56, 0xa8, 0x43, 0xab, 0x22, 0xa7, 0x54, 0xa8, 0x33, 0xa8, 0x55, 0x31,
+	0xc0, 0x99, 0xcc, 0xfe, 0x7b, 0xef, 0x38, 0x60, 0xa6, 0x45, 0xfe, 0xbd, 0xd8, 0xfe, 0xff, 0xde,
+	0x5d, 0x69, 0x66, 0x56, 0x25, 0x66, 0xfe, 0xbd, 0x95, 0xfe, 0x62, 0xa6, 0x9c, 0xa7, 0xfe, 0x8b,
+	0xa4, 0xa6, 0x44, 0xaa, 0x21, 0x99, 0xce, 0xfe, 0x62, 0xc1, 0xfe, 0x39, 0x60, 0xa2, 0x86, 0xa1,
+	0x89, 0x9c, 0xba, 0x62, 0xa6, 0x62, 0xfe, 0xb3, 0xc6, 0xa5, 0x63, 0x7d, 0x9d, 0xb9, 0x9f, 0xb9,
+	0x7f, 0xc1, 0x09, 0x79, 0x69, 0x6e, 0x6f, 0xa0, 0x7a, 0x9f, 0x7b, 0xa1, 0x79, 0x95, 0xcf, 0x96,
+	0xaf, 0x9c, 0x8b, 0x43, 0xa3, 0x58, 0x2e, 0x56, 0x74, 0xa2, 0x96, 0xa7, 0x72, 0xa9, 0x61, 0xa6,
+	0x73, 0x74, 0x7e, 0x77, 0x5a, 0x6f, 0x56, 0x9b, 0x9b, 0x08, 0x9b, 0xab, 0x9b, 0x9c, 0x9c, 0x8b,
+	0x57, 0xa2, 0x67, 0xa1, 0x79, 0x6e, 0x9d, 0xa9, 0x15, 0xa2, 0x77, 0x65, 0x02, 0xa3, 0x76, 0xa5,
+	0x74, 0xa4, 0x75, 0xa5, 0x64, 0xa5, 0x74, 0xa3, 0x86, 0x79, 0x69, 0xc0, 0x69, 0xc0, 0x69, 0x6d,
+	0x79, 0x6e, 0xa3, 0x65, 0xa2, 0x66, 0xa2, 0x76, 0xa2, 0x66, 0x6f, 0xa2, 0x76, 0x65, 0x14, 0x6e,
+	0x6e, 0xc0, 0x6e, 0xc3, 0x6e, 0xc0, 0x23, 0x65, 0xc0, 0x6e, 0xc0, 0x23, 0x1e, 0xc2, 0x6b, 0xc0,
+	0x66, 0x14, 0x67, 0x52, 0x9d, 0xbb, 0x51, 0x52, 0x62, 0x57, 0x76, 0x66, 0x6b, 0x7a, 0x6b, 0xc0,
+	0x4b, 0x42, 0x9c, 0x9b, 0x9b, 0x9b, 0x9b, 0x8c, 0x9b, 0x9c, 0x9c, 0x9c, 0xa2, 0x58, 0x7b, 0xc0,
+	0x7b, 0x65, 0x66, 0x9f, 0xa6, 0xa3, 0x75, 0xa6, 0x64, 0xa5, 0x64, 0xa5, 0x74, 0xa5, 0x75, 0xa5,
+	0x63, 0x21, 0x68, 0x07, 0x69, 0x7a, 0xa2, 0x66, 0xa5, 0x22, 0xa5, 0x33, 0xa2, 0x76, 0x1e, 0x6e,
+	0xc0, 0x65, 0x6e, 0xc3, 0x6e, 0x1c, 0xd8, 0x21, 0xc0, 0x1c, 0xc2, 0x21, 0xc0, 0x5e, 0x66, 0x77,
+	0x67, 0x9c, 0xcc, 0x9a, 0xdd, 0x9a, 0xde, 0x6b, 0x07, 0xa0, 0x8a, 0x9f, 0x7b, 0x98, 0x9f, 0xfe,
+	0x49, 0x41, 0xa1, 0x59, 0x43, 0xa2, 0x67, 0xc0, 0x64, 0xa7, 0x45, 0xfe, 0xa5, 0x34, 0xfe, 0xf7,
+	0xbe, 0xa2, 0x77, 0xc0, 0x66, 0x31, 0xfd, 0xfd, 0xfd, 0xe7, 0x9c, 0xaa, 0x94, 0xee, 0xfe, 0x73,
+	0xae, 0x92, 0xff, 0x29, 0xa2, 0x77, 0xa5, 0x66, 0xa3, 0x66, 0xa5, 0x66, 0xa2, 0x66, 0x9d, 0xaa,
+	0x9a, 0xbb, 0x11, 0x33, 0x69, 0x38, 0xa3, 0x76, 0xa7, 0x44, 0xaa, 0x33, 0xae, 0x11, 0xa6, 0x56,
+	0xa5, 0x55, 0xfe, 0xad, 0x34, 0xfe, 0x42, 0x08, 0x98, 0xcc, 0x14, 0xfe, 0xad, 0x54, 0xfe, 0xff,
+	0xde, 0x51, 0x55, 0xa3, 0x66, 0x25, 0x6e, 0x97, 0xec, 0xfe, 0x7b, 0x8a, 0x97, 0xda, 0xfe, 0xa4,
+	0x88, 0xad, 0x20, 0x51, 0x94, 0xdf, 0xfe, 0x52, 0x40, 0x9a, 0xbe, 0x52, 0x06, 0x6b, 0x60, 0xa2,
+	0x86, 0xaa, 0x52, 0xfe, 0xbc, 0x08, 0xa2, 0x84, 0x78, 0x13, 0x72, 0xc0, 0x6e, 0x5a, 0xc1, 0x5e,
+	0x13, 0x5b, 0x6b, 0x6b, 0x97, 0xce, 0xfe, 0x79, 0xa0, 0x9b, 0x8d, 0xa2, 0x56, 0xa0, 0x7a, 0x4b,
+	0x5b, 0x29, 0x69, 0xa5, 0x74, 0xa8, 0x52, 0xa4, 0x85, 0x9f, 0xb8, 0x79, 0xa2, 0x87, 0x56, 0x6e,
+	0x52, 0x9b, 0x9b, 0x99, 0xbc, 0x9c, 0x9a, 0x57, 0x46, 0x6b, 0x19, 0x6b, 0xc0, 0x56, 0x19, 0x09,
+	0xa2, 0x77, 0xa3, 0x85, 0xa4, 0x85, 0xa8, 0x52, 0xa5, 0x75, 0xa2, 0x85, 0x25, 0x1e, 0x65, 0x69,
+	0x7e, 0x54, 0xa3, 0x66, 0xa2, 0x76, 0x69, 0x26, 0xa3, 0x65, 0xa3, 0x66, 0xa2, 0x66, 0x69, 0x6e,
+	0x6d, 0xc2, 0x6e, 0x17, 0x1c, 0xc7, 0x5a, 0x1c, 0xc0, 0x6e, 0xc2, 0x6b, 0x66, 0xc4, 0x67, 0xc0,
+	0x6b, 0x66, 0x66, 0x9d, 0xaa, 0x62, 0x9c, 0xbb, 0x9d, 0xab, 0x62, 0xc0, 0x66, 0x6b, 0xc0, 0x6b,
+	0x12, 0x1d, 0x9c, 0x9b, 0x99, 0xad, 0x9a, 0xac, 0x15, 0x42, 0x5b, 0xa1, 0x69, 0x66, 0x18, 0x7c,
+	0x64, 0x7a, 0x7e, 0xa2, 0x97, 0xa7, 0x52, 0xa7, 0x63, 0xa5, 0x74, 0xa3, 0x75, 0xa1, 0x96, 0x0e,
+	0x65, 0xa2, 0x76, 0x59, 0xa2, 0x65, 0x26, 0xa5, 0x54, 0xa4, 0x44, 0x6d, 0x1c, 0xc0, 0x6e, 0xc1,
+	0x1c, 0x17, 0x1c, 0xc4, 0x21, 0xc0, 0x1c, 0xd1, 0x21, 0x1c, 0xc2, 0x21, 0xc2, 0x1c, 0x23, 0x1e,
+	0x9b, 0xcd, 0x99, 0xdf, 0x9d, 0xbb, 0x00, 0x77, 0xa1, 0x6a, 0x9e, 0x7b, 0xfe, 0x7a, 0x22, 0x99,
+	0x8e, 0x12, 0xa1, 0x69, 0x18, 0xc0, 0xa2, 0x77, 0xad, 0x02, 0xfe, 0xc6, 0x59, 0xad, 0x21, 0xc0,
+	0x65, 0x31, 0xfd, 0xfd, 0xfd, 0xe1, 0x66, 0x31, 0xc2, 0x98, 0xdc, 0xfe, 0x9c, 0xf3, 0xfe, 0x5a,
+	0xaa, 0x33, 0xc0, 0xa6, 0x54, 0xa8, 0x34, 0xa7, 0x55, 0xa3, 0x66, 0xc0, 0x66, 0xc0, 0x55, 0x9b,
+	0xba, 0x10, 0x9b, 0xab, 0x9b, 0xba, 0x18, 0x6f, 0x2c, 0xa8, 0x44, 0xa4, 0x66, 0xac, 0x22, 0xa5,
+	0x56, 0xfe, 0x6b, 0x2c, 0x2c, 0x22, 0xfe, 0x7b, 0xee, 0xfe, 0xef, 0x7c, 0xa3, 0x78, 0xc1, 0x9d,
+	0x99, 0x94, 0xfd, 0xfe, 0x83, 0xcb, 0xfe, 0x39, 0x80, 0xab, 0x30, 0xfe, 0xd6, 0x0d, 0xa2, 0x86,
+	0xfe, 0xa4, 0x47, 0xfe, 0x5a, 0x22, 0x97, 0xcf, 0xa3, 0x67, 0x57, 0x6b, 0x5a, 0x75, 0x79, 0xa5,
+	0x73, 0xac, 0x40, 0xa8, 0x61, 0xa0, 0xa6, 0x75, 0xa1, 0x97, 0x55, 0x0e, 0x6f, 0x5a, 0x56, 0xa2,
+	0x67, 0x52, 0x9c, 0xaa, 0xa3, 0x87, 0xc0, 0x94, 0xef, 0x56, 0xa3, 0x49, 0xa0, 0x7a, 0x99, 0xad,
+	0x9a, 0xad, 0x5f, 0x5f, 0x54, 0xa2, 0x76, 0xa2, 0x86, 0x79, 0x62, 0x77, 0x7f, 0x6d, 0x6e, 0x56,
+	0x9d, 0x9a, 0x41, 0x6f, 0x19, 0xc0, 0x6b, 0x1d, 0x6b, 0xc0, 0x7a, 0x79, 0xa2, 0x85, 0xa6, 0x64,
+	0xaa, 0x51, 0xa5, 0x84, 0x9f, 0xa6, 0x79, 0xa1, 0x96, 0x65, 0x6e, 0x69, 0x5f, 0x7e, 0xa4, 0x43,
+	0xa2, 0x76, 0xa2, 0x66, 0xa2, 0x76, 0xa2, 0x66, 0x6e, 0x6d, 0x6e, 0x69, 0xc1, 0x6e, 0xc8, 0x21,
+	0xc1, 0x5a, 0xc1, 0x21, 0xca, 0x5b, 0x66, 0x7a, 0xc1, 0x67, 0x66, 0x16, 0x9d, 0xbb, 0x9d, 0xaa,
+	0x52, 0x08, 0x52, 0x7b, 0x66, 0x67, 0x18, 0xa0, 0x8a, 0x46, 0x9d, 0x8b, 0x99, 0xac, 0x9a, 0x9c,
+	0x9b, 0x8c, 0x47, 0xa0, 0x7a, 0x22, 0x69, 0x59, 0x7a, 0x7b, 0x69, 0x9f, 0xb8, 0xa2, 0x86, 0xa7,
+	0x52, 0xa5, 0x84, 0xa7, 0x52, 0xa3, 0x86, 0x79, 0x75, 0x18, 0x66, 0xa2, 0x64, 0xa2, 0x65, 0xa5,
+	0x32, 0xa5, 0x43, 0xa4, 0x55, 0xa2, 0x66, 0x69, 0x1c, 0xc1, 0x66, 0xc0, 0x1c, 0xc3, 0x21, 0xc1,
+	0x1c, 0xdc, 0x1e, 0x9a, 0xbf, 0x99, 0xed, 0x9d, 0xcb, 0xa0, 0xa9, 0x9f, 0x8b, 0xa0, 0x6a, 0x9b,
+	0x8d, 0xfe, 0x6a, 0x01, 0x9a, 0x8e, 0xa0, 0x7a, 0x57, 0x27, 0x6f, 0xa3, 0x56, 0xfe, 0x84, 0x30,
+	0xfe, 0xef, 0x7d, 0xa4, 0x66, 0x65, 0x31, 0xfd, 0xfd, 0xfd, 0xe3, 0x51, 0x31, 0x9b, 0xbb, 0xfe,
+	0x94, 0x92, 0xfe, 0x42, 0x08, 0x98, 0xcc, 0xa3, 0x76, 0xa9, 0x34, 0xa8, 0x44, 0xa7, 0x44, 0x05,
+	0x7f, 0x05, 0xc0, 0x14, 0x19, 0x14, 0x65, 0x9c, 0xaa, 0x9a, 0xbb, 0x9c, 0xaa, 0x9c, 0xaa, 0x9a,
+	0xbb, 0x6f, 0x18, 0xa3, 0x67, 0x14, 0x51, 0x38, 0x36, 0xa7, 0x44, 0xfe, 0xad, 0x74, 0xa5, 0x66,
+	0x52, 0x9b, 0xaa, 0x9a, 0xbb, 0xfe, 0x52, 0x89, 0x96, 0xeb, 0x69, 0xab, 0x30, 0xfe, 0xb4, 0xec,
+	0x69, 0xfe, 0x5a, 0x41, 0xfe, 0x31, 0x20, 0x0b, 0xa2, 0x78, 0x42, 0xa2, 0x78, 0x24, 0x7d, 0x75,
+	0x9d, 0xb8, 0xa5, 0x73, 0xab, 0x40, 0xa9, 0x52, 0xa4, 0x75, 0x9b, 0xca, 0xc0, 0x6f, 0xa3, 0x57,
+	0x6b, 0x9c, 0x9a, 0x97, 0xdd, 0x9c, 0xaa, 0x66, 0xae, 0x10, 0xa5, 0x75, 0x11, 0xa3, 0x68, 0xa0,
+	0x5b, 0x9a, 0xad, 0xfe, 0x61, 0xe5, 0x98, 0xbe, 0xa3, 0x57, 0x2c, 0x59, 0x69, 0x78, 0x0b, 0x76,
+	0x62, 0x66, 0xa2, 0x66, 0xc1, 0xa2, 0x67, 0x6f, 0xc0, 0x56, 0x6b, 0x5a, 0x24, 0xc2, 0x25, 0xa1,
+	0x97, 0xa6, 0x63, 0xa9, 0x62, 0xa6, 0x74, 0xa1, 0x95, 0x78, 0x74, 0x79, 0x6e, 0x0f, 0x7a, 0xa4,
+	0x56, 0xa5, 0x33, 0xa3, 0x55, 0xa2, 0x67, 0x6e, 0x6d, 0x6d, 0xc0, 0x69, 0x23, 0x6e, 0xc0, 0x65,
+	0x5a, 0xc1, 0x7e, 0xc0, 0x1c, 0xc1, 0x21, 0xd2, 0x28, 0x23, 0xc2, 0x1e, 0x6b, 0x67, 0x66, 0x62,
+	0x9d, 0xba, 0x9d, 0x9a, 0x9c, 0xbb, 0x62, 0x67, 0x6f, 0xa0, 0x9a, 0x5b, 0x5b, 0x57, 0x9d, 0x8a,
+	0x99, 0xad, 0x98, 0xae, 0x9c, 0x9b, 0x04, 0x4b, 0x20, 0xc0, 0x65, 0x6e, 0x79, 0x04, 0x7e, 0xa2,
+	0x95, 0xa5, 0x75, 0xa8, 0x52, 0xa7, 0x53, 0x25, 0x21, 0x64, 0x59, 0x68, 0x3b, 0xa5, 0x53, 0xa4,
+	0x55, 0xa5, 0x44, 0x6e, 0x6e, 0x17, 0x1c, 0x6e, 0xc0, 0x1c, 0xc1, 0x21, 0xc4, 0x1c, 0xdb, 0x1e,
+	0x9d, 0xac, 0x99, 0xed, 0x9b, 0xcd, 0x77, 0x16, 0x57, 0xa3, 0x49, 0xfe, 0x93, 0x05, 0xfe, 0x49,
+	0x81, 0x09, 0x14, 0xa0, 0x7a, 0xa2, 0x77, 0x59, 0xa8, 0x44, 0xfe, 0xbe, 0x17, 0xaf, 0x11, 0xc0,
+	0x66, 0x31, 0xfd, 0xfd, 0xfd, 0xe3, 0x51, 0xfe, 0xa5, 0x34, 0xfe, 0x4a, 0x49, 0x29, 0x7a, 0xab,
+	0x23, 0xaa, 0x33, 0xa2, 0x77, 0x6e, 0x00, 0x14, 0x19, 0xc1, 0x14, 0xc0, 0x7e, 0xc0, 0x55, 0x51,
+	0x9c, 0xab, 0x9c, 0xaa, 0x99, 0xcb, 0x9c, 0x9a, 0x29, 0x7e, 0x2c, 0x9d, 0x9a, 0x65, 0xa4, 0x54,
+	0xa4, 0x67, 0x6f, 0xc0, 0x3d, 0x9d, 0xaa, 0x65, 0x65, 0xa3, 0x65, 0x79, 0xa5, 0x64, 0x7e, 0x97,
+	0xce, 0xa3, 0x56, 0xa1, 0x79, 0x6b, 0x9d, 0x9b, 0x29, 0x6b, 0x18, 0x7e, 0xa1, 0x96, 0x78, 0x7d,
+	0xa7, 0x63, 0xac, 0x31, 0xa3, 0x75, 0x7f, 0x42, 0x99, 0xbd, 0x98, 0xcd, 0x9a, 0xbb, 0x62, 0xc0,
+	0xa8, 0x52, 0xae, 0x10, 0x7d, 0x7e, 0x21, 0x9b, 0x8e, 0xfe, 0x62, 0x04, 0x99, 0xbd, 0x9f, 0x8b,
+	0x5e, 0x1f, 0xa2, 0x65, 0x69, 0x79, 0xc0, 0x7a, 0x67, 0x61, 0xa2, 0x77, 0x1c, 0xc1, 0x6f, 0x56,
+	0xc1, 0x5b, 0xc3, 0x69, 0x75, 0x7d, 0xa2, 0x95, 0xa7, 0x63, 0xaa, 0x52, 0x29, 0x79, 0x74, 0x64,
+	0x7e, 0x12, 0x6e, 0xa2, 0x55, 0xa2, 0x77, 0xa3, 0x55, 0xa2, 0x77, 0xa2, 0x66, 0xa2, 0x66, 0x27,
+	0x6d, 0x6e, 0xc0, 0x6e, 0x65, 0xc0, 0x59, 0xc1, 0x6e, 0xc1, 0x7e, 0x1e, 0x7a, 0xc0, 0x66, 0xc2,
+	0x21, 0xcc, 0x1c, 0xc3, 0x67, 0x66, 0xc0, 0x67, 0xc0, 0x66, 0x38, 0x9d, 0xab, 0x9d, 0xaa, 0x62,
+	0x53, 0x6b, 0x6b, 0x6b, 0xa3, 0x58, 0x43, 0x99, 0xbd, 0x98, 0xbd, 0x98, 0xbe, 0x9d, 0x8c, 0xa1,
+	0x69, 0xc0, 0x14, 0xc0, 0x20, 0xc0, 0x75, 0x65, 0x79, 0xa2, 0x85, 0xa7, 0x63, 0x30, 0xa6, 0x62,
+	0x7c, 0x7a, 0x68, 0x79, 0xc0, 0x3e, 0xa4, 0x55, 0xa6, 0x43, 0x27, 0x25, 0x6c, 0xa2, 0x56, 0x21,
+	0x1c, 0xc0, 0x21, 0xc6, 0x1c, 0xda, 0x6b, 0x63, 0x9c, 0xcc, 0x99, 0xdd, 0x3e, 0x0f, 0x9f, 0x8b,
+	0xa1, 0x69, 0x9c, 0x8d, 0xfe, 0x72, 0x22, 0x99, 0x9e, 0x9f, 0x7b, 0x57, 0xa3, 0x56, 0xc0, 0x6e,
+	0xfe, 0x7b, 0xef, 0xfe, 0xe7, 0x3c, 0xa6, 0x55, 0xfd, 0xfd, 0xfd, 0xe4, 0x51, 0xfe, 0xb5, 0x96,
+	0xfe, 0x52, 0x8a, 0x95, 0xed, 0x33, 0x08, 0xaa, 0x33, 0xa4, 0x66, 0xc1, 0x6e, 0xc0, 0x14, 0x5a,
+	0x14, 0xc1, 0x65, 0xc0, 0x19, 0x14, 0x08, 0x19, 0x9c, 0xba, 0x9c, 0xaa, 0x9a, 0xbb, 0x9d, 0x9a,
+	0x51, 0x51, 0x50, 0x59, 0x9d, 0xaa, 0x6e, 0x29, 0xc1, 0x66, 0x29, 0x75, 0x65, 0xc0, 0x65, 0x6e,
+	0x5f, 0xc0, 0x6b, 0x5a, 0x6b, 0x7f, 0x6e, 0x18, 0xa8, 0x43, 0xac, 0x31, 0x9d, 0xb8, 0x93, 0xee,
+	0x60, 0xa8, 0x42, 0xa2, 0x88, 0x5b, 0x53, 0xa4, 0x77, 0xa9, 0x34, 0x9b, 0xba, 0xfe, 0x51, 0x42,
+	0xa7, 0x63, 0xfe, 0xbc, 0x0a, 0xa2, 0x85, 0x7d, 0x9a, 0xac, 0xfe, 0x6a, 0x44, 0x98, 0xbe, 0x57,
+	0xa2, 0x68, 0x52, 0x5a, 0x24, 0x6d, 0x79, 0xc0, 0x66, 0x66, 0xc2, 0x20, 0x66, 0x20, 0x5a, 0x20,
+	0x29, 0x24, 0xc4, 0x22, 0x1e, 0x70, 0xa1, 0x96, 0xa6, 0x73, 0xa8, 0x53, 0xa7, 0x62, 0xa3, 0x85,
+	0x75, 0x7d, 0x79, 0x9d, 0x99, 0x6e, 0x6e, 0x6e, 0x03, 0xa2, 0x66, 0x26, 0xa2, 0x66, 0xa2, 0x66,
+	0xa2, 0x76, 0x6f, 0xa2, 0x76, 0x6e, 0x6e, 0x6e, 0x69, 0x5a, 0x69, 0xc0, 0x6e, 0xc1, 0x1e, 0x7a,
+	0x1c, 0xce, 0x21, 0xc3, 0x1c, 0xc1, 0x66, 0xc0, 0x6b, 0xc0, 0x66, 0x6f, 0x62, 0x9d, 0xaa, 0x9b,
+	0xcc, 0x0d, 0x03, 0x05, 0x6b, 0x6b, 0x9f, 0x8b, 0xa1, 0x79, 0x9d, 0x9b, 0x98, 0xde, 0x98, 0x9f,
+	0x9b, 0x8c, 0x41, 0x5f, 0x5f, 0x56, 0x5b, 0x24, 0xc0, 0x75, 0x0b, 0xa1, 0x96, 0xa4, 0x65, 0xa8,
+	0x50, 0xa7, 0x62, 0xa5, 0x75, 0xa2, 0x86, 0x75, 0x61, 0x79, 0x6e, 0xa4, 0x44, 0xa5, 0x43, 0xa5,
+	0x43, 0x2a, 0xa2, 0x55, 0x21, 0x66, 0x21, 0xc3, 0x5a, 0x21, 0xc1, 0x1c, 0xdb, 0x67, 0x63, 0x9a,
+	0xdd, 0x99, 0xdf, 0x63, 0x15, 0x56, 0xa3, 0x69, 0x97, 0xae, 0xfe, 0x61, 0xc2, 0x9c, 0x7c, 0x9f,
+	0x8b, 0x29, 0x22, 0x29, 0xa6, 0x54, 0xfe, 0xad, 0x54, 0xfe, 0xff, 0xde, 0x6f, 0xfd, 0xfd, 0xfd,
+	0xe2, 0x51, 0x92, 0xff, 0xfe, 0x52, 0xaa, 0x95, 0xee, 0x29, 0xa7, 0x55, 0xac, 0x22, 0xa6, 0x55,
+	0x55, 0x66, 0x55, 0x19, 0xc1, 0x6e, 0x19, 0x14, 0xc0, 0x69, 0x14, 0xa2, 0x76, 0x19, 0x14, 0xc0,
+	0x19, 0xc0, 0x05, 0x51, 0x51, 0x9d, 0xa9, 0x9c, 0xaa, 0x9c, 0x99, 0x9d, 0xaa, 0x51, 0x22, 0x56,
+	0xc0, 0x51, 0x29, 0x7a, 0x66, 0x18, 0x65, 0x2c, 0x22, 0x2c, 0x24, 0x29, 0x56, 0xc0, 0x29, 0x9d,
+	0xa9, 0xa9, 0x43, 0xfe, 0xa4, 0xf2, 0xaa, 0x32, 0x95, 0xed, 0x96, 0xdd, 0x7d, 0xa6, 0x55, 0xa3,
+	0x78, 0xa6, 0x46, 0xa8, 0x55, 0xa5, 0x66, 0x93, 0xfe, 0xfe, 0x59, 0xe6, 0x60, 0xaa, 0x41, 0xab,
+	0x31, 0x9b, 0xba, 0x94, 0xde, 0x99, 0x8d, 0xa0, 0x8a, 0x6b, 0x9f, 0x8b, 0xc0, 0x5a, 0xc0, 0x6d,
+	0x6e, 0x69, 0x66, 0x7b, 0x6e, 0x18, 0x1d, 0xc0, 0x18, 0xc0, 0x1d, 0x24, 0x29, 0x2c, 0xc2, 0x29,
+	0xc0, 0x1d, 0xc0, 0x79, 0x74, 0x79, 0xa3, 0x95, 0xa8, 0x52, 0xaa, 0x41, 0xa4, 0x85, 0x64, 0x7a,
+	0x7d, 0x66, 0x69, 0x5a, 0x69, 0xc0, 0xa2, 0x66, 0x6e, 0x6d, 0x7e, 0x6e, 0x33, 0xa2, 0x76, 0xa2,
+	0x67, 0xa3, 0x55, 0x6d, 0x6e, 0xc0, 0x59, 0xc0, 0x6e, 0x6e, 0x1e, 0x7a, 0x66, 0xd1, 0x21, 0xc1,
+	0x1c, 0xc5, 0x66, 0xc0, 0x6b, 0x63, 0x00, 0x1a, 0x9c, 0xbc, 0x66, 0x6b, 0xa0, 0x8a, 0x67, 0x67,
+	0x57, 0x9c, 0x8c, 0x99, 0xad, 0x98, 0xbd, 0x9d, 0x7a, 0xa0, 0x6a, 0x5f, 0x1d, 0x2e, 0x22, 0x1d,
+	0x19, 0x10, 0x79, 0x08, 0xa4, 0x74, 0xa9, 0x42, 0xa7, 0x64, 0xa4, 0x84, 0xa1, 0x96, 0x79, 0x65,
+	0x58, 0x03, 0x26, 0xa6, 0x33, 0xa3, 0x55, 0x1e, 0x1c, 0xc1, 0x6e, 0xc5, 0x1c, 0xdb, 0x66, 0xa0,
+	0x8a, 0x9c, 0xcc, 0x99, 0xdf, 0x9c, 0xbc, 0x77, 0x62, 0xa3, 0x58, 0x9c, 0x9c, 0xfe, 0x8a, 0x83,
+	0xfe, 0x49, 0x41, 0x9f, 0x6a, 0x5f, 0x6b, 0xa2, 0x76, 0x1d, 0xb0, 0x00, 0xfe, 0xd6, 0x99, 0xab,
+	0x23, 0xfd, 0xfd, 0xfd, 0xe0, 0x51, 0x31, 0x98, 0xcc, 0xfe, 0x6b, 0x6d, 0x24, 0xa2, 0x77, 0xa5,
+	0x55, 0xaa, 0x44, 0xa7, 0x44, 0x65, 0x5a, 0xa2, 0x77, 0x14, 0x19, 0x14, 0xc2, 0x19, 0xc1, 0x14,
+	0x51, 0x14, 0x19, 0x14, 0xc1, 0x19, 0x14, 0xc1, 0x05, 0x50, 0x51, 0x56, 0x50, 0x9a, 0xbc, 0x9b,
+	0xaa, 0x2e, 0x29, 0x51, 0x1f, 0x38, 0x66, 0x1f, 0x24, 0x38, 0x15, 0x24, 0xc1, 0x69, 0x29, 0xc0,
+	0x25, 0x05, 0xaf, 0x10, 0xa6, 0x54, 0x9d, 0x99, 0x97, 0xdd, 0x94, 0xee, 0xa7, 0x45, 0xfe, 0xe7,
+	0x1c, 0xa6, 0x55, 0x9c, 0xb9, 0xfe, 0xbd, 0x54, 0x96, 0xec, 0xfe, 0x59, 0xe4, 0xa6, 0x65, 0x9c,
+	0xa9, 0x9a, 0xab, 0x9f, 0x6a, 0x6b, 0x6b, 0x27, 0x6b, 0x56, 0x27, 0x24, 0x1d, 0xc0, 0x22, 0xc0,
+	0x1d, 0x29, 0x24, 0xc0, 0x29, 0xc0, 0x24, 0xc0, 0x29, 0xc0, 0x7a, 0xc1, 0x29, 0xc0, 0x5a, 0x22,
+	0x1d, 0x75, 0x10, 0x78, 0x76, 0xa7, 0x61, 0xad, 0x30, 0xa6, 0x64, 0x79, 0x7a, 0x9d, 0xba, 0x6d,
+	0xc1, 0x69, 0x6e, 0x69, 0x69, 0x65, 0xc0, 0xa2, 0x76, 0x7e, 0xa2, 0x76, 0xa6, 0x23, 0xa3, 0x55,
+	0x1b, 0xa3, 0x55, 0x2f, 0x65, 0x59, 0x6e, 0xc0, 0x7a, 0xc0, 0x1c, 0xd1, 0x21, 0xc2, 0x1c, 0x19,
+	0x1c, 0xc1, 0xa2, 0x66, 0x21, 0x1c, 0x67, 0x1b, 0x0a, 0x3b, 0x9c, 0xbb, 0x9c, 0xbc, 0x56, 0x9f,
+	0xab, 0x57, 0x7f, 0xa0, 0x7a, 0x4b, 0x98, 0xbe, 0x95, 0xbf, 0x9c, 0x8c, 0x4f, 0x4b, 0xc0, 0x5a,
+	0xc0, 0x76, 0x7a, 0x66, 0xa1, 0x97, 0x65, 0x64, 0xa7, 0x62, 0xab, 0x41, 0xa6, 0x73, 0xa1, 0x96,
+	0x65, 0x0e, 0x07, 0x5c, 0xa4, 0x55, 0xa6, 0x53, 0xa5, 0x33, 0x1c, 0xc2, 0x6e, 0xc4, 0x1c, 0xdc,
+	0x1e, 0x9f, 0x9b, 0x9b, 0xcd, 0x99, 0xde, 0x9d, 0xbb, 0xa0, 0xa9, 0x9d, 0xab, 0xa2, 0x58, 0x9a,
+	0x8e, 0xfe, 0x61, 0xc1, 0x9b, 0x8d, 0x5f, 0x6b, 0x6f, 0x66, 0xa5, 0x45, 0xfe, 0x9c, 0xf3, 0xfe,
+	0xef, 0x7d, 0xa4, 0x66, 0xfd, 0xfd, 0xfd, 0xde, 0x65, 0x31, 0x9b, 0xbb, 0xfe, 0x94, 0x91, 0xfe,
+	0x39, 0xe7, 0x9a, 0xbb, 0xa4, 0x66, 0xab, 0x33, 0xa9, 0x33, 0x7f, 0xc0, 0x6e, 0x14, 0xc0, 0x19,
+	0xc5, 0x14, 0xcb, 0x69, 0x6e, 0x5a, 0xc2, 0x9c, 0xaa, 0x9d, 0xa9, 0x9a, 0xbc, 0x9b, 0xbb, 0x9d,
+	0xaa, 0x66, 0x69, 0x38, 0xc0, 0x69, 0x66, 0xc0, 0x22, 0x66, 0x31, 0x9c, 0xaa, 0x3d, 0x9d, 0x99,
+	0x3d, 0x9d, 0x9a, 0x7e, 0x1a, 0xaa, 0x33, 0xfe, 0xb5, 0xd5, 0xaf, 0x11, 0xa2, 0x77, 0xc0, 0x9d,
+	0xa9, 0x9a, 0xcb, 0xfe, 0x6a, 0xea, 0xfe, 0x39, 0x23, 0x1f, 0x9d, 0x9a, 0xa4, 0x45, 0x6b, 0x67,
+	0xc0, 0x2e, 0xc0, 0x59, 0xc0, 0x29, 0x22, 0xc0, 0x29, 0xc9, 0x1d, 0xc0, 0x22, 0xc0, 0x29, 0xc2,
+	0x75, 0xc0, 0x79, 0x74, 0x79, 0xa8, 0x53, 0xaa, 0x41, 0xa5, 0x65, 0x7a, 0x79, 0x7a, 0xc1, 0x7e,
+	0x6d, 0x65, 0x79, 0x79, 0x69, 0x65, 0x69, 0xc0, 0xa2, 0x66, 0xa4, 0x54, 0xa4, 0x55, 0xa4, 0x45,
+	0xa2, 0x66, 0x6d, 0x6d, 0x5a, 0xa2, 0x76, 0xc3, 0x66, 0xd1, 0x21, 0xc7, 0x1c, 0x6b, 0x66, 0x67,
+	0xc0, 0x9d, 0xba, 0x9a, 0xcd, 0x9b, 0xcd, 0x66, 0x6f, 0x67, 0x0e, 0x15, 0x25, 0x9c, 0x8c, 0xfe,
+	0x7a, 0x42, 0x97, 0xaf, 0x5f, 0xa2, 0x57, 0x56, 0x66, 0x66, 0x66, 0xa1, 0x89, 0xc1, 0x7d, 0x74,
+	0xa1, 0x96, 0xa9, 0x51, 0xad, 0x20, 0xa1, 0x96, 0xa2, 0x86, 0x74, 0x60, 0xa2, 0x75, 0xa2, 0x76,
+	0xa5, 0x32, 0xa6, 0x33, 0x19, 0x1e, 0x17, 0xc0, 0x21, 0x66, 0x5a, 0xc1, 0x1c, 0xdd, 0x9f, 0x9b,
+	0x9e, 0xac, 0x9a, 0xdd, 0x3e, 0x9f, 0xba, 0x6b, 0xa0, 0x8a, 0xa1, 0x4a, 0x96, 0x9f, 0xfe, 0x41,
+	0x40, 0x47, 0xa0, 0x8a, 0xa2, 0x67, 0xc0, 0x56, 0xaa, 0x33, 0xfe, 0xce, 0x58, 0xac, 0x23, 0x5a,
+	0x7e, 0x2c, 0x31, 0x9d, 0xaa, 0x31, 0xfd, 0xfd, 0xfd, 0xd3, 0x2c, 0x31, 0xc0, 0x65, 0x31, 0x25,
+	0x96, 0xdd, 0x92, 0xff, 0xfe, 0x52, 0x8a, 0x3d, 0x51, 0xa8, 0x44, 0xab, 0x33, 0xa5, 0x55, 0x66,
+	0xc0, 0x19, 0x51, 0x19, 0xc6, 0x14, 0xcc, 0x19, 0x59, 0xc4, 0x65, 0x56, 0x61, 0x52, 0x66, 0x61,
+	0x55, 0x55, 0x61, 0x55, 0x56, 0x65, 0x5a, 0xc0, 0x9d, 0x9a, 0x9a, 0xbb, 0xad, 0x22, 0xa5, 0x55,
+	0x52, 0x05, 0xad, 0x11, 0xae, 0x10, 0xa3, 0x77, 0x69, 0x5a, 0x2a, 0x9c, 0xa9, 0xfe, 0x7b, 0xce,
+	0xfe, 0x41, 0xc6, 0x9d, 0xaa, 0x55, 0x6e, 0x20, 0x6b, 0xc2, 0x24, 0xc0, 0x6e, 0xca, 0x22, 0x66,
+	0x22, 0xc2, 0x24, 0xc3, 0x27, 0x20, 0x61, 0x79, 0xa2, 0x86, 0xa4, 0x65, 0xa2, 0x86, 0x7e, 0xa2,
+	0x76, 0x7a, 0xa2, 0x67, 0xa2, 0x86, 0xa3, 0x76, 0xa2, 0x87, 0xa3, 0x76, 0xa2, 0x76, 0xa1, 0x96,
+	0x79, 0x69, 0x75, 0x6e, 0x68, 0x55, 0xc0, 0xa3, 0x65, 0xa5, 0x44, 0xa4, 0x55, 0xa3, 0x55, 0x1e,
+	0x6e, 0x1c, 0x6e, 0x5a, 0xc0, 0x1c, 0xd2, 0x21, 0xc6, 0x1c, 0xc0, 0x23, 0x66, 0xc0, 0x62, 0x66,
+	0x9d, 0xbb, 0x9b, 0xbc, 0x9d, 0x9b, 0x62, 0x77, 0x9f, 0x9b, 0xa2, 0x68, 0x5f, 0x9b, 0x9d, 0x97,
+	0xbe, 0x99, 0x9d, 0x9b, 0xac, 0xa0, 0x7a, 0x5f, 0x7f, 0x2f, 0x20, 0x57, 0xc0, 0x20, 0x79, 0x64,
+	0xa1, 0x96, 0xa4, 0x75, 0xac, 0x31, 0xa4, 0x84, 0xa3, 0x85, 0xa0, 0xa6, 0x78, 0x37, 0xa4, 0x34,
+	0xa5, 0x43, 0xa3, 0x66, 0x1b, 0xa2, 0x66, 0x1e, 0x17, 0x6e, 0x6e, 0xc3, 0x1c, 0xdb, 0xa0, 0x8a,
+	0x67, 0x9b, 0xcd, 0x99, 0xed, 0x9b, 0xdc, 0x37, 0x9f, 0x9b, 0xa2, 0x59, 0x9e, 0x5b, 0xfe, 0x72,
+	0x42, 0x97, 0xbf, 0xa0, 0x6a, 0x19, 0x66, 0x5a, 0xa6, 0x56, 0xfe, 0x94, 0x92, 0xfe, 0xef, 0x9e,
+	0xa2, 0x77, 0x7e, 0xfd, 0xfd, 0xfd, 0xd0, 0x66, 0xc0, 0x31, 0xc4, 0x2c, 0x31, 0xc0, 0x9a, 0xbb,
+	0x93, 0xff, 0xfe, 0x6b, 0x4d, 0x96, 0xdc, 0x9a, 0xbc, 0xc1, 0xaa, 0x33, 0xac, 0x22, 0xa3, 0x76,
+	0x51, 0x5a, 0x1c, 0x08, 0xa2, 0x67, 0x66, 0x19, 0xc4, 0x14, 0xcc, 0x19, 0xc0, 0x59, 0xc1, 0x69,
+	0xc0, 0x0f, 0x7a, 0xc0, 0x0f, 0x76, 0x7b, 0xc0, 0x55, 0xc0, 0x69, 0xc0, 0x56, 0x9d, 0xa9, 0x39,
+	0x96, 0xcd, 0x51, 0xfe, 0xad, 0x95, 0xab, 0x33, 0x56, 0xa4, 0x65, 0xa4, 0x66, 0x69, 0x7e, 0x55,
+	0x6e, 0x14, 0x94, 0xef, 0xfe, 0x5a, 0xea, 0x94, 0xef, 0x52, 0x24, 0x27, 0xc4, 0x24, 0xc1, 0x29,
+	0xc6, 0x24, 0xc0, 0x20, 0xc1, 0x6e, 0x5a, 0xc1, 0x20, 0x27, 0xc0, 0x24, 0x6b, 0xc1, 0x27, 0x20,
+	0x65, 0x7a, 0x69, 0xc0, 0x6d, 0x69, 0xc0, 0x7f, 0xa2, 0x76, 0xa1, 0x97, 0xa3, 0x76, 0xa4, 0x75,
+	0xa4, 0x75, 0xa5, 0x75, 0xa2, 0x86, 0xa2, 0x76, 0x79, 0x60, 0xa1, 0x97, 0x6d, 0x55, 0x6d, 0xa4,
+	0x54, 0xa4, 0x55, 0xa4, 0x54, 0xa3, 0x55, 0xa2, 0x66, 0x69, 0x5a, 0xa2, 0x66, 0x76, 0x1c, 0xd4,
+	0x21, 0xc3, 0x1c, 0xc0, 0x6b, 0xc1, 0x66, 0x23, 0x67, 0x9c, 0xcc, 0x9c, 0xab, 0x9c, 0xab, 0x9d,
+	0xcc, 0x9e, 0xbc, 0x56, 0x6f, 0xa1, 0x69, 0x9e, 0x7a, 0x9a, 0xbe, 0xfe, 0x61, 0x82, 0x9c, 0x9c,
+	0x5b, 0xa2, 0x57, 0x52, 0x5e, 0x24, 0x18, 0xc0, 0xa2, 0x77, 0x69, 0x65, 0x10, 0xa2, 0x96, 0xa8,
+	0x62, 0xa8, 0x62, 0xa4, 0x84, 0xa2, 0x84, 0xa0, 0xa6, 0x4d, 0x5d, 0xa4, 0x55, 0xa5, 0x64, 0xa4,
+	0x45, 0xa2, 0x65, 0x65, 0xa2, 0x66, 0x1c, 0x21, 0xc1, 0x1c, 0xda, 0x21, 0xc0, 0x5b, 0x2a, 0x9d,
+	0xbb, 0x9b, 0xdc, 0x0b, 0x3c, 0x63, 0x15, 0xa2, 0x59, 0x98, 0x9e, 0xfe, 0x51, 0x60, 0x9e, 0x7b,
+	0x5b, 0x14, 0x5a, 0xa3, 0x67, 0xaa, 0x23, 0xfe, 0xce, 0x79, 0xac, 0x22, 0xc1, 0x66, 0x31, 0x2c,
+	0x31, 0xfd, 0xfd, 0xfd, 0xcb, 0x2c, 0x31, 0xc3, 0x2c, 0x31, 0xc0, 0x9c, 0xaa, 0x97, 0xdd, 0xfe,
+	0x7b, 0xef, 0xfe, 0x39, 0xc6, 0x9b, 0xab, 0xa4, 0x66, 0xa5, 0x65, 0x51, 0x9a, 0xbb, 0x3d, 0xa6,
+	0x55, 0xa8, 0x54, 0xa7, 0x45, 0xc1, 0x55, 0xa2, 0x77, 0x14, 0xc0, 0x19, 0xd0, 0x14, 0x19, 0xc2,
+	0x69, 0x6f, 0x12, 0x5a, 0xc0, 0x12, 0xc0, 0x19, 0x08, 0xc2, 0x6e, 0xc1, 0x9d, 0x99, 0xa2, 0x77,
+	0x94, 0xee, 0xa9, 0x44, 0xfe, 0xe7, 0x5b, 0xa5, 0x66, 0xc1, 0x55, 0x61, 0xa2, 0x77, 0x97, 0xcc,
+	0xfe, 0x94, 0xb1, 0x9b, 0xba, 0x98, 0xbc, 0x94, 0xff, 0x29, 0xc0, 0x7f, 0x27, 0xc3, 0x24, 0xc2,
+	0x29, 0xc4, 0x24, 0x27, 0xc0, 0x20, 0xc2, 0x6e, 0x5a, 0xc1, 0x20, 0xc0, 0x27, 0x24, 0xc0, 0x6b,
+	0xc0, 0x7a, 0x27, 0x20, 0x66, 0xc0, 0x6d, 0x6d, 0xc2, 0x7a, 0xc0, 0x0e, 0x79, 0xa1, 0x97, 0xa4,
+	0x65, 0xa6, 0x64, 0xa6, 0x65, 0xa5, 0x64, 0xa2, 0x96, 0x79, 0x69, 0x69, 0x75, 0x68, 0xa2, 0x65,
+	0xa4, 0x54, 0xa5, 0x54, 0xa4, 0x45, 0xa2, 0x65, 0x23, 0x6e, 0x21, 0xcb, 0x1c, 0xd3, 0x66, 0x1e,
+	0x6b, 0x1b, 0x9c, 0xab, 0x9a, 0xde, 0x9d, 0xbc, 0x65, 0x6b, 0x6b, 0x9f, 0x8b, 0xa0, 0x7a, 0x99,
+	0xbe, 0xfe, 0x71, 0xc3, 0x9a, 0x9c, 0xa1, 0x69, 0x5a, 0x20, 0xc0, 0x1d, 0x56, 0x1d, 0x22, 0x1d,
+	0x20, 0x71, 0xa1, 0x95, 0xa6, 0x73, 0xaa, 0x41, 0xa8, 0x61, 0x7d, 0x13, 0x0c, 0x59, 0xa4, 0x64,
+	0xa5, 0x44, 0xa4, 0x55, 0xa2, 0x65, 0x23, 0x69, 0xc3, 0x21, 0x1c, 0xd9, 0x21, 0x5a, 0x28, 0x67,
+	0x9c, 0xcb, 0x98, 0xff, 0x9c, 0xbc, 0x63, 0x9f, 0x8b, 0xa2, 0x69, 0x9d, 0x7a, 0xfe, 0x7a, 0x62,
+	0xfe, 0x39, 0x42, 0x10, 0x6f, 0x5a, 0x5b, 0x3d, 0xfe, 0x8c, 0x92, 0xfe, 0xf7, 0xbf, 0xa2, 0x76,
+	0xc0, 0x2c, 0x31, 0x2c, 0x31, 0xfd, 0xfd, 0xfd, 0xce, 0x2c, 0x31, 0xc1, 0x55, 0x95, 0xee, 0x0d,
+	0xfe, 0x42, 0x07, 0x97, 0xcd, 0x19, 0xac, 0x22, 0xc0, 0x51, 0x98, 0xcc, 0x9d, 0x9a, 0xa2, 0x77,
+	0x11, 0x66, 0xa8, 0x44, 0xa6, 0x55, 0xa5, 0x55, 0xa3, 0x77, 0x14, 0xc1, 0x6e, 0xd6, 0x56, 0x69,
+	0x11, 0x6e, 0x79, 0xc0, 0x14, 0x19, 0xc4, 0x11, 0x50, 0x05, 0x98, 0xcb, 0xfe, 0xb5, 0xb5, 0xfe,
+	0xff, 0xfe, 0x51, 0x7e, 0x6e, 0x16, 0x2a, 0x9c, 0xaa, 0xfe, 0x94, 0x71, 0xfe, 0x39, 0xa6, 0x51,
+	0xc0, 0x1d, 0x6e, 0x1d, 0xc0, 0x27, 0xc1, 0x69, 0xc0, 0x22, 0xc1, 0x67, 0xc0, 0x27, 0x20, 0xca,
+	0x22, 0xc1, 0x20, 0xc1, 0x24, 0xc3, 0x66, 0x24, 0x2c, 0x27, 0x20, 0x55, 0x6e, 0x6e, 0x22, 0x20,
+	0x69, 0xc0, 0x7e, 0x60, 0x51, 0xa2, 0x86, 0xa3, 0x76, 0xa4, 0x65, 0xa9, 0x62, 0xa4, 0x75, 0xa5,
+	0x65, 0xa0, 0xa7, 0x64, 0x79, 0x6c, 0x68, 0xa3, 0x55, 0xa5, 0x54, 0xa6, 0x33, 0xa2, 0x66, 0x55,
+	0xa2, 0x75, 0x6e, 0xcb, 0x1c, 0xcf, 0x21, 0xc1, 0x1c, 0x66, 0x6b, 0x67, 0x1b, 0x9d, 0xac, 0x9b,
+	0xcc, 0x9c, 0xbb, 0x66, 0x76, 0x53, 0xa0, 0x8b, 0xa1, 0x69, 0x9b, 0x9d, 0xfe, 0x7a, 0x03, 0x98,
+	0x9d, 0xa1, 0x69, 0xa2, 0x57, 0x67, 0x6e, 0x22, 0x1d, 0x5a, 0x66, 0x7a, 0x2f, 0x9d, 0xb8, 0x79,
+	0xa6, 0x62, 0xa8, 0x62, 0xa9, 0x42, 0xa3, 0x95, 0x9f, 0xb7, 0x58, 0x59, 0xa4, 0x54, 0xa5, 0x54,
+	0xa5, 0x43, 0xa3, 0x55, 0x6d, 0x1c, 0xc0, 0x21, 0xc1, 0x1c, 0xd9, 0x5e, 0xc0, 0x6e, 0x77, 0x9d,
+	0xbb, 0x99, 0xee, 0x9b, 0xcd, 0x08, 0x0e, 0x67, 0x5f, 0x9b, 0x7e, 0xfe, 0x49, 0xa3, 0x9c, 0xab,
+	0x6f, 0x11, 0x1d, 0x24, 0xac, 0x12, 0xfe, 0xce, 0x9a, 0xab, 0x32, 0xc1, 0x66, 0x31, 0xfd, 0xfd,
+	0xfd, 0xce, 0x2c, 0x31, 0xc0, 0x2c, 0x98, 0xcc, 0xfe, 0x9c, 0xd2, 0xfe, 0x5a, 0xeb, 0x97, 0xdc,
+	0x5a, 0xad, 0x22, 0xac, 0x22, 0x9d, 0xa9, 0x96, 0xdd, 0x51, 0xc0, 0x09, 0xa5, 0x65, 0x9d, 0x9a,
+	0x93, 0xff, 0x24, 0x20, 0xa5, 0x55, 0x1d, 0xa2, 0x77, 0xa3, 0x77, 0xc5, 0x6e, 0xce, 0x6b, 0xc1,
+	0x66, 0x20, 0xc1, 0x19, 0xc1, 0x14, 0x5a, 0xc0, 0x6f, 0xc1, 0x69, 0x55, 0x61, 0x9b, 0xba, 0xfe,
+	0xd6, 0xb9, 0xaa, 0x32, 0x51, 0xa2, 0x76, 0x23, 0x66, 0xa1, 0x79, 0x34, 0xfe, 0x62, 0xec, 0x93,
+	0xff, 0x1f, 0x7a, 0x6d, 0x59, 0x7e, 0x66, 0x22, 0xc0, 0x20, 0xc0, 0x6e, 0x5a, 0xc1, 0x20, 0xcd,
+	0x22, 0xc5, 0x24, 0xc2, 0x7e, 0xc1, 0x66, 0x2c, 0x20, 0xc2, 0x67, 0xc0, 0x69, 0xc1, 0x79, 0x10,
+	0x69, 0x69, 0xa3, 0x85, 0xa5, 0x64, 0xa6, 0x75, 0xa6, 0x74, 0xa3, 0x85, 0xa1, 0x96, 0x79, 0x68,
+	0x3e, 0xa3, 0x55, 0xa4, 0x54, 0xa5, 0x45, 0xa3, 0x65, 0xa2, 0x65, 0x6d, 0xce, 0x66, 0xcb, 0x21,
+	0xc3, 0x1c, 0x66, 0x67, 0x20, 0x6f, 0x62, 0x30, 0x9a, 0xdd, 0x72, 0x7b, 0x0a, 0x57, 0xa2, 0x59,
+	0x9b, 0x8d, 0x95, 0xbf, 0x98, 0xae, 0xa0, 0x6a, 0x6b, 0x27, 0x6d, 0x5a, 0xc2, 0x61, 0x19, 0x10,
+	0x64, 0xa3, 0x75, 0xa9, 0x53, 0xa8, 0x81, 0xa3, 0xa4, 0x18, 0x13, 0x58, 0x0d, 0x24, 0xa7, 0x32,
+	0x6d, 0x1c, 0x21, 0xc1, 0x1c, 0xd9, 0x23, 0x21, 0x5e, 0xc0, 0x21, 0x17, 0x9c, 0xcd, 0x9b, 0xce,
+	0x99, 0xde, 0x9f, 0x9b, 0x18, 0x56, 0xa0, 0x5b, 0xfe, 0x6a, 0x86, 0x96, 0xce, 0x56, 0x6b, 0x22,
+	0x6b, 0x6f, 0xfe, 0x84, 0x51, 0xfe, 0xef, 0x7e, 0x31, 0xfd, 0xfd, 0xfd, 0xcb, 0x66, 0x31, 0xc2,
+	0x2c, 0xc0, 0x31, 0x9d, 0xaa, 0x93, 0xee, 0xfe, 0x7b, 0xce, 0x92, 0xef, 0x9d, 0xaa, 0xae, 0x11,
+	0xaf, 0x10, 0xa2, 0x77, 0x95, 0xde, 0x95, 0xed, 0x6f, 0x25, 0x05, 0x7e, 0x6f, 0x0d, 0x21, 0x93,
+	0xff, 0xc0, 0x29, 0xa4, 0x66, 0xa7, 0x55, 0xa6, 0x55, 0x0d, 0xa2, 0x78, 0x51, 0x59, 0x19, 0x14,
+	0x5a, 0x14, 0xc0, 0x19, 0xc1, 0x6f, 0x19, 0xc9, 0x6b, 0xc0, 0x19, 0x11, 0xc0, 0x14, 0xc0, 0x19,
+	0xc1, 0x5a, 0x11, 0xc2, 0xa2, 0x76, 0x9a, 0xbb, 0x66, 0xfe, 0xe7, 0x1b, 0xa5, 0x55, 0x7e, 0xc0,
+	0x2a, 0x66, 0x98, 0xcc, 0xfe, 0x84, 0x10, 0xfe, 0x39, 0x86, 0x24, 0xc0, 0x65, 0xa2, 0x77, 0x69,
+	0x55, 0x6b, 0x27, 0x69, 0xc0, 0x25, 0x1d, 0xc2, 0x6e, 0xc0, 0x20, 0xc0, 0x1d, 0xc2, 0x20, 0xc1,
+	0x27, 0x24, 0xc1, 0x6e, 0x24, 0x1d, 0xc2, 0x29, 0x2c, 0xc0, 0x24, 0x1d, 0x2c, 0xc1, 0x24, 0x27,
+	0x20, 0xc1, 0x27, 0x1f, 0xc1, 0x24, 0x27, 0x20, 0xc0, 0x65, 0xc0, 0xa2, 0x64, 0x61, 0xa2, 0x96,
+	0xa5, 0x85, 0xa8, 0x64, 0xa6, 0x73, 0xa3, 0x75, 0x7c, 0x13, 0x6c, 0x5d, 0xa4, 0x54, 0xa8, 0x32,
+	0xa2, 0x66, 0x6d, 0xc0, 0x5a, 0x79, 0x6e, 0xc3, 0x1c, 0xc0, 0x5a, 0x1c, 0x21, 0xc5, 0x1c, 0xc3,
+	0x21, 0xc6, 0x1c, 0xc1, 0x67, 0x66, 0x1e, 0x6f, 0x1b, 0x99, 0xee, 0x9b, 0xdc, 0x67, 0x52, 0x6f,
+	0x47, 0xa1, 0x6a, 0x9d, 0x7b, 0xfe, 0x7a, 0x63, 0x97, 0xbe, 0x9f, 0x7b, 0xa1, 0x69, 0xc0, 0x16,
+	0x6f, 0xc0, 0x7e, 0x1d, 0x16, 0x7a, 0x69, 0x79, 0xa2, 0x76, 0xa5, 0x94, 0xa9, 0x72, 0xa8, 0x52,
+	0x7d, 0x9e, 0x96, 0x6c, 0xa3, 0x65, 0xa6, 0x42, 0xa4, 0x55, 0x1e, 0x23, 0x1c, 0xc6, 0x6e, 0x1c,
+	0xd2, 0x23, 0x21, 0xc2, 0x1c, 0x1e, 0x9c, 0xcd, 0x0d, 0x9d, 0xbc, 0xa0, 0x9a, 0x9d, 0xac, 0xa1,
+	0x5a, 0x9a, 0x7e, 0xfe, 0x59, 0xa2, 0x9b, 0x9b, 0x12, 0xa1, 0x79, 0x29, 0x51, 0xa9, 0x44, 0xfe,
+	0xc6, 0x18, 0xad, 0x22, 0x6e, 0x6e, 0xfd, 0xfd, 0xfd, 0xc9, 0x2c, 0x31, 0xc1, 0x65, 0x31, 0x9d,
+	0xaa, 0x96, 0xdc, 0xfe, 0x8c, 0x71, 0x93, 0xff, 0x9a, 0xba, 0x09, 0xaf, 0x11, 0x20, 0x24, 0x92,
+	0xfe, 0x98, 0xcd, 0xa8, 0x44, 0xa5, 0x55, 0x7f, 0x69, 0x6f, 0x00, 0x9a, 0xbb, 0x96, 0xdc, 0x38,
+	0xad, 0x11, 0xa6, 0x55, 0x35, 0x9a, 0xbb, 0x9d, 0xaa, 0xa5, 0x55, 0x09, 0x00, 0x28, 0x55, 0x05,
+	0x6e, 0x14, 0xc0, 0x19, 0xc0, 0x0a, 0x14, 0xc4, 0x19, 0xd1, 0x14, 0x69, 0xa2, 0x77, 0x95, 0xee,
+	0xa4, 0x66, 0xfe, 0xef, 0x3c, 0xa4, 0x66, 0x25, 0x20, 0x25, 0x99, 0xcc, 0x0d, 0xfe, 0x39, 0xa6,
+	0x9c, 0xaa, 0xc1, 0x1d, 0x7f, 0xc0, 0x1d, 0x2c, 0x22, 0xc0, 0x29, 0x6e, 0x29, 0x1d, 0xc2, 0x22,
+	0x29, 0x7e, 0x6e, 0xa3, 0x78, 0x6e, 0x34, 0x39, 0x08, 0xc3, 0x39, 0x34, 0x20, 0x55, 0x66, 0x31,
+	0x1d, 0x52, 0xc0, 0x18, 0x1d, 0x6b, 0xc4, 0x2c, 0x24, 0x1d, 0xc9, 0x5e, 0x7d, 0x66, 0x9e, 0xc8,
+	0xa2, 0x97, 0xa8, 0x63, 0xa8, 0x52, 0xa6, 0x73, 0x7c, 0xa0, 0x85, 0x6c, 0xa2, 0x75, 0xa3, 0x65,
+	0xa7, 0x23, 0xa3, 0x65, 0x6f, 0x25, 0x1e, 0x6e, 0xc0, 0x69, 0xc2, 0x23, 0x1e, 0x1c, 0xc0, 0x6e,
+	0xc0, 0x5a, 0xc1, 0x6e, 0x1e, 0x66, 0x1c, 0xc1, 0x21, 0xc3, 0x1c, 0xc1, 0x6b, 0x66, 0xc3, 0x23,
+	0x63, 0x9d, 0xbc, 0x9b, 0xdc, 0x9c, 0xbb, 0x9d, 0xbb, 0x51, 0xa2, 0x68, 0x47, 0xa1, 0x6a, 0x9c,
+	0x9c, 0xfe, 0x82, 0x42, 0x98, 0x9f, 0xa0, 0x5a, 0xc0, 0x5a, 0xc0, 0x1d, 0x29, 0x24, 0xc0, 0x1d,
+	0xc0, 0x1b, 0xc0, 0x0e, 0xa5, 0x84, 0xab, 0x41, 0xa6, 0x73, 0xa2, 0x94, 0x78, 0x3e, 0x0d, 0xa3,
+	0x55, 0xa6, 0x43, 0xa4, 0x54, 0xc0, 0x65, 0xa2, 0x66, 0xc0, 0x56, 0x21, 0x1c, 0xc0, 0x21, 0x1c,
+	0xd9, 0x1e, 0x98, 0xdf, 0x99, 0xef, 0x9f, 0xab, 0x9e, 0xbc, 0xa0, 0x7a, 0x9f, 0x6a, 0x95, 0xbf,
+	0xfe, 0x49, 0x00, 0x0e, 0xa1, 0x69, 0x5b, 0x1d, 0xc0, 0xfe, 0x8c, 0x30, 0xfe, 0xef, 0x3c, 0xa5,
+	0x56, 0x6e, 0xfd, 0xfd, 0xfd, 0xc7, 0x51, 0x31, 0xc4, 0x99, 0xcb, 0xfe, 0xa5, 0x14, 0x39, 0x98,
+	0xcc, 0xad, 0x22, 0xfe, 0xad, 0x55, 0xad, 0x11, 0x9c, 0xaa, 0xfe, 0x84, 0x10, 0x95, 0xdd, 0xa3,
+	0x76, 0xaa, 0x33, 0xa3, 0x67, 0x0d, 0x56, 0xa2, 0x77, 0x05, 0x35, 0x34, 0x99, 0xbb, 0xab, 0x32,
+	0xfe, 0xd6, 0x99, 0x1d, 0x9c, 0xaa, 0x96, 0xdd, 0xfe, 0x7b, 0xce, 0x93, 0xef, 0x29, 0xa8, 0x44,
+	0xaa, 0x33, 0x05, 0x19, 0xc0, 0x56, 0x05, 0xc0, 0x7f, 0x19, 0x0a, 0x19, 0xc1, 0x14, 0xc0, 0x19,
+	0xd1, 0x14, 0xc0, 0x19, 0x30, 0xa4, 0x65, 0xfe, 0xe7, 0x1b, 0xa5, 0x66, 0xc0, 0x6e, 0x97, 0xdd,
+	0x08, 0xfe, 0x39, 0xa6, 0x9b, 0xaa, 0xa3, 0x77, 0x55, 0xc0, 0x2c, 0x51, 0xc0, 0x2c, 0xc0, 0x6e,
+	0x1d, 0x09, 0x56, 0x09, 0x1d, 0x31, 0xa3, 0x66, 0xa5, 0x56, 0xa7, 0x55, 0x19, 0xa6, 0x55, 0xa4,
+	0x66, 0xc0, 0x7f, 0xa2, 0x77, 0xa2, 0x77, 0x6e, 0xc0, 0x34, 0xc0, 0x39, 0x34, 0x55, 0x0c, 0x3d,
+	0x9a, 0xbb, 0x0d, 0x99, 0xcc, 0x99, 0xbb, 0x9a, 0xbb, 0x1d, 0x18, 0xc1, 0x1d, 0xc1, 0x18, 0x5a,
+	0x1d, 0xc0, 0x6b, 0x2c, 0x5a, 0x1d, 0xc1, 0x29, 0xc0, 0x1d, 0xc1, 0x22, 0x75, 0x65, 0xa0, 0xa8,
+	0x79, 0xa4, 0x74, 0xaa, 0x51, 0xaa, 0x30, 0xa2, 0x85, 0x64, 0x7c, 0x69, 0x3a, 0xa4, 0x55, 0xa2,
+	0x67, 0x65, 0x65, 0xc1, 0x6e, 0x11, 0x69, 0x11, 0x16, 0x6f, 0x69, 0xc0, 0x6e, 0x6e, 0x69, 0x23,
+	0x1c, 0xc0, 0x5a, 0xc0, 0x7e, 0xc0, 0x5a, 0xc2, 0x21, 0xc0, 0x1c, 0x67, 0xc0, 0x25, 0xc0, 0x20,
+	0x65, 0x66, 0xc0, 0x62, 0x67, 0x63, 0x63, 0x9c, 0xcb, 0x9d, 0xaa, 0x65, 0xa2, 0x68, 0x46, 0xa0,
+	0x8a, 0xa1, 0x69, 0x9a, 0xad, 0x96, 0xaf, 0x97, 0xaf, 0x5b, 0x5f, 0x5b, 0x2e, 0x15, 0x24, 0x79,
+	0x66, 0x20, 0xc0, 0x5e, 0x70, 0x78, 0xa4, 0x85, 0x08, 0xaa, 0x50, 0xa2, 0x85, 0x9d, 0xa7, 0xa3,
+	0x65, 0x00, 0xa6, 0x42, 0xa7, 0x33, 0x6d, 0x12, 0x6e, 0x6e, 0xc0, 0x21, 0xc0, 0x1c, 0xda, 0x6f,
+	0x1e, 0x9c, 0xbc, 0x98, 0xef, 0x9c, 0xcd, 0x9f, 0xab, 0x9f, 0x8b, 0xa1, 0x6a, 0x99, 0x9c, 0xfe,
+	0x61, 0xa0, 0x02, 0xa1, 0x69, 0x22, 0x6b, 0x61, 0xad, 0x22, 0xfe, 0xce, 0x38, 0xad, 0x12, 0x6e,
+	0xfd, 0xfd, 0xfd, 0xc7, 0x2c, 0xc0, 0x31, 0xc1, 0x9c, 0xaa, 0x95, 0xed, 0xfe, 0x6b, 0x4c, 0x93,
+	0xef, 0xa6, 0x55, 0xfe, 0x9c, 0xd2, 0xfe, 0xe7, 0x1c, 0x09, 0xfe, 0xad, 0x75, 0xfe, 0x52, 0xaa,
+	0x7e, 0xaa, 0x33, 0xa3, 0x67, 0x51, 0x9d, 0xaa, 0xa4, 0x66, 0x19, 0x99, 0xcb, 0x95, 0xde, 0x9b,
+	0xbb, 0x51, 0x9d, 0x99, 0x15, 0xfe, 0xd6, 0xba, 0x31, 0x51, 0xc0, 0x09, 0xfe, 0xb5, 0x96, 0xfe,
+	0x6b, 0x6d, 0x93, 0xfe, 0x9c, 0xaa, 0xa8, 0x45, 0xaa, 0x33, 0xa4, 0x66, 0xa2, 0x67, 0x19, 0xc0,
+	0x14, 0x19, 0xc0, 0x14, 0x19, 0xc2, 0x14, 0x19, 0xd0, 0x14, 0x69, 0x19, 0x95, 0xed, 0x7f, 0xfe,
+	0xe7, 0x1b, 0x31, 0x9b, 0xba, 0x98, 0xcd, 0xfe, 0x7b, 0xae, 0xfe, 0x31, 0x85, 0x9c, 0xab, 0xa3,
+	0x76, 0x5a, 0x1d, 0xc0, 0xa3, 0x67, 0x7a, 0x2c, 0xc0, 0x41, 0x1d, 0x05, 0xa5, 0x56, 0xa7, 0x54,
+	0x0d, 0xa8, 0x44, 0xa9, 0x34, 0xa5, 0x65, 0xa3, 0x67, 0xa2, 0x77, 0xa2, 0x76, 0x6b, 0x66, 0x31,
+	0xcd, 0x9d, 0xa9, 0x9a, 0xbb, 0x98, 0xcc, 0x98, 0xcd, 0x18, 0x97, 0xcc, 0x9b, 0xba, 0x9c, 0xaa,
+	0x66, 0x24, 0xa2, 0x76, 0x9d, 0x9a, 0xa2, 0x77, 0x7a, 0x29, 0xc0, 0x1d, 0xc1, 0x24, 0x29, 0xc0,
+	0x24, 0x1d, 0x7b, 0x18, 0x7a, 0x6e, 0x7d, 0x79, 0x64, 0xa1, 0x97, 0xa9, 0x51, 0xab, 0x30, 0xa3,
+	0x95, 0x79, 0x7e, 0x9f, 0x95, 0xa2, 0x76, 0xa2, 0x77, 0x55, 0x0b, 0xc0, 0x56, 0xc3, 0x6e, 0x10,
+	0xa3, 0x66, 0x6e, 0x7e, 0xa2, 0x67, 0xa2, 0x66, 0xa2, 0x66, 0x6e, 0x68, 0x6e, 0x1c, 0x5a, 0xc1,
+	0x6e, 0x67, 0x23, 0xc0, 0x6b, 0x61, 0x52, 0x66, 0x66, 0x62, 0x51, 0x62, 0x66, 0x56, 0x08, 0x9d,
+	0xab, 0x76, 0x67, 0x7b, 0x65, 0xa3, 0x66, 0x56, 0x6f, 0x6f, 0x53, 0x5b, 0x9d, 0x7c, 0xfe, 0x72,
+	0x23, 0x96, 0xcf, 0xa2, 0x58, 0xa2, 0x49, 0x6b, 0x51, 0x27, 0x65, 0x7a, 0x1b, 0x6e, 0x5b, 0x7d,
+	0x74, 0x60, 0xa5, 0x83, 0xa9, 0x62, 0xa8, 0x52, 0xa3, 0x85, 0x0e, 0xa2, 0x65, 0x03, 0xa5, 0x43,
+	0xa8, 0x22, 0xa2, 0x66, 0x68, 0x6e, 0x6e, 0xc0, 0x1c, 0xc1, 0x21, 0xc1, 0x1c, 0xc0, 0x21, 0x1c,
+	0xcc, 0x21, 0x1c, 0xc3, 0x21, 0x23, 0x63, 0x98, 0xef, 0x99, 0xef, 0xa0, 0x9a, 0x53, 0xa1, 0x7a,
+	0x9d, 0x7b, 0x94, 0xcf, 0x97, 0x9f, 0xa0, 0x6a, 0x31, 0xc0, 0x29, 0xa2, 0x87, 0xfe, 0x9c, 0xb2,
+	0xfe, 0xf7, 0x9d, 0xa3, 0x67, 0xfd, 0xfd, 0xfd, 0xc7, 0x66, 0x31, 0xc0, 0x11, 0x97, 0xcd, 0x2d,
+	0xfe, 0x4a, 0x48, 0x6f, 0xad, 0x22, 0xfe, 0xce, 0x79, 0xaa, 0x33, 0x97, 0xdc, 0xfe, 0x8c, 0x50,
+	0x95, 0xde, 0xa4, 0x66, 0xa7, 0x55, 0x6e, 0x51, 0xc0, 0xa3, 0x76, 0x9b, 0xab, 0x98, 0xcc, 0x9b,
+	0xaa, 0x66, 0x7f, 0x2d, 0x9c, 0xaa, 0xa2, 0x77, 0xfe, 0x94, 0xb2, 0xfe, 0xef, 0x7d, 0xa4, 0x66,
+	0x65, 0x31, 0x2c, 0x98, 0xcc, 0x91, 0xff, 0x21, 0x05, 0x56, 0xa4, 0x66, 0xa7, 0x44, 0xa7, 0x55,
+	0xa2, 0x77, 0xc0, 0x6e, 0x7f, 0x56, 0x05, 0x11, 0x19, 0x14, 0x11, 0x19, 0xd0, 0x14, 0x0d, 0x05,
+	0x93, 0xff, 0x69, 0xfe, 0xce, 0x59, 0xa7, 0x54, 0x93, 0xee, 0xfe, 0x63, 0x0b, 0x94, 0xee, 0x9d,
+	0xaa, 0x31, 0x24, 0x55, 0xa2, 0x77, 0x7a, 0x31, 0x7f, 0x25, 0xa7, 0x54, 0xa5, 0x66, 0xac, 0x12,
+	0xa5, 0x65, 0xa7, 0x45, 0xa5, 0x55, 0x1d, 0x7e, 0xc0, 0x6f, 0xc2, 0x25, 0x1d, 0x31, 0xc1, 0x66,
+	0xc2, 0x31, 0xc0, 0x2c, 0xc2, 0x1d, 0x25, 0x2c, 0x31, 0xc0, 0x9d, 0xaa, 0x9d, 0x99, 0x34, 0x95,
+	0xdd, 0x94, 0xee, 0x97, 0xdd, 0x3d, 0x9d, 0xa9, 0x24, 0x6e, 0xc0, 0x1d, 0xc0, 0x29, 0xc0, 0x1d,
+	0x29, 0xc1, 0x24, 0xc0, 0x76, 0xc1, 0x59, 0xc0, 0xa2, 0x65, 0x79, 0x74, 0x76, 0xa7, 0x72, 0xac,
+	0x30, 0xa5, 0x86, 0x79, 0xa0, 0x93, 0x78, 0xc0, 0x6b, 0x6f, 0xc0, 0x62, 0x6e, 0x0f, 0xc3, 0x69,
+	0x3e, 0xc0, 0x7e, 0xa3, 0x65, 0xa3, 0x66, 0xa3, 0x55, 0xa3, 0x56, 0xa2, 0x66, 0xa2, 0x66, 0x23,
+	0x59, 0xc0, 0x23, 0x67, 0x20, 0x0c, 0x52, 0x9d, 0xbb, 0x51, 0x62, 0x66, 0x62, 0x3e, 0xc0, 0x6b,
+	0xc0, 0x6b, 0x77, 0x56, 0x76, 0x6f, 0xa2, 0x76, 0x60, 0x6e, 0xc0, 0x56, 0x6b, 0x13, 0xa1, 0x59,
+	0x9b, 0x9d, 0xfe, 0x71, 0xe2, 0x9a, 0x8d, 0xa1, 0x5a, 0x57, 0xa2, 0x67, 0x22, 0x1e, 0x69, 0x1e,
+	0x5a, 0x24, 0xc0, 0x7d, 0x64, 0x70, 0xa4, 0x84, 0xa9, 0x62, 0xab, 0x51, 0x79, 0x7c, 0x9f, 0x96,
+	0xa2, 0x55, 0xa7, 0x31, 0xa7, 0x33, 0xa2, 0x65, 0x6d, 0x6e, 0xc0, 0x1c, 0xc1, 0x21, 0xc5, 0x1c,
+	0xca, 0x21, 0xc0, 0x1c, 0xc3, 0x21, 0x1c, 0x2a, 0x99, 0xef, 0x98, 0xee, 0x9e, 0xac, 0x09, 0xa1,
+	0x79, 0x1f, 0x99, 0x9d, 0xfe, 0x59, 0x81, 0x9c, 0x7c, 0x25, 0x29, 0x6f, 0x61, 0xaf, 0x00, 0xfe,
+	0xd6, 0x99, 0xab, 0x23, 0xfd, 0xfd, 0xfd, 0xc6, 0x2c, 0x31, 0x9d, 0xa9, 0x01, 0x93, 0xef, 0xfe,
+	0x63, 0x0c, 0x97, 0xcc, 0xae, 0x11, 0xb0, 0x00, 0x3a, 0x9d, 0xaa, 0x94, 0xee, 0x1d, 0x30, 0x1d,
+	0xa6, 0x55, 0xc0, 0x51, 0x19, 0x05, 0x99, 0xbb, 0x99, 0xcc, 0x7f, 0x05, 0xae, 0x11, 0xa5, 0x65,
+	0x9d, 0x9a, 0x97, 0xdd, 0x94, 0xed, 0x56, 0x29, 0xaf, 0x10, 0x2c, 0x31, 0xc1, 0x9d, 0xa9, 0x01,
+	0xfe, 0x9c, 0xd3, 0x94, 0xed, 0x96, 0xdd, 0x9d, 0x9a, 0xa3, 0x66, 0xa5, 0x66, 0xa5, 0x66, 0xa5,
+	0x55, 0xa3, 0x66, 0x7f, 0xc1, 0x14, 0x0a, 0xc0, 0x14, 0xca, 0x19, 0xc4, 0x14, 0xc0, 0x51, 0x0d,
+	0x9a, 0xbb, 0xfe, 0x84, 0x0f, 0x51, 0x92, 0xff, 0x99, 0xcc, 0x56, 0xa2, 0x76, 0xc0, 0x51, 0xa3,
+	0x67, 0x19, 0xab, 0x33, 0xa8, 0x44, 0xa5, 0x55, 0xa7, 0x55, 0xa7, 0x44, 0xa5, 0x56, 0xa2, 0x77,
+	0x7e, 0xc3, 0x6f, 0xd2, 0x25, 0xc2, 0x31, 0xc2, 0x9d, 0xaa, 0x21, 0x97, 0xdd, 0x93, 0xfe, 0x96,
+	0xdd, 0x95, 0xdd, 0x9d, 0x9a, 0x7a, 0xa2, 0x77, 0x29, 0x65, 0xc0, 0x6b, 0x29, 0xc2, 0x24, 0x22,
+	0x6e, 0xc0, 0x24, 0x29, 0x69, 0x69, 0x79, 0x75, 0xa0, 0xa7, 0xa5, 0x74, 0xa9, 0x54, 0xa8, 0x62,
+	0xa2, 0x82, 0x74, 0x66, 0x6b, 0xa2, 0x67, 0x6b, 0x65, 0x6b, 0xc1, 0x5a, 0x69, 0xc0, 0x7d, 0x59,
+	0x65, 0x7e, 0x6e, 0x7e, 0xa2, 0x66, 0xa2, 0x76, 0x33, 0xa3, 0x66, 0xa3, 0x56, 0x6e, 0x6e, 0x0c,
+	0x61, 0x52, 0x52, 0x52, 0x52, 0x66, 0xa0, 0x8a, 0xc0, 0x1a, 0x67, 0xc0, 0x66, 0x19, 0x6e, 0x6b,
+	0xc1, 0x79, 0xc0, 0x64, 0x7e, 0x65, 0x56, 0x0a, 0x7b, 0x47, 0xa1, 0x6a, 0x9a, 0x9d, 0xfe, 0x69,
+	0xe2, 0x9b, 0x8d, 0x47, 0xa2, 0x68, 0x61, 0xc0, 0x7a, 0x1b, 0x6f, 0x5b, 0x24, 0xc0, 0x7d, 0x60,
+	0x64, 0xa5, 0x84, 0xa8, 0x73, 0xa9, 0x62, 0xa3, 0x85, 0x7c, 0x9f, 0x85, 0xa2, 0x55, 0xa6, 0x42,
+	0xa5, 0x54, 0xa3, 0x54, 0xa2, 0x67, 0x69, 0xc1, 0x6e, 0xc6, 0x1c, 0xca, 0x21, 0xc0, 0x1c, 0xc2,
+	0x21, 0xc0, 0x1c, 0x23, 0x9d, 0xbc, 0x98, 0xef, 0x9b, 0xcc, 0x0f, 0x9f, 0x9b, 0x9f, 0x7b, 0xa0,
+	0x59, 0xfe, 0x7a, 0x43, 0x97, 0xae, 0xa1, 0x5a, 0x1d, 0x6f, 0x56, 0x11, 0x2d, 0xfe, 0xf7, 0xbd,
+	0xa2, 0x77, 0x6b, 0xfd, 0xfd, 0xfd, 0xc5, 0x9c, 0xaa, 0xfe, 0xa5, 0x14, 0xfe, 0x5a, 0xcb, 0x98,
+	0xcc, 0xa7, 0x44, 0xfe, 0xad, 0x75, 0xaf, 0x11, 0xa3, 0x66, 0x98, 0xcc, 0xfe, 0x84, 0x30, 0x95,
+	0xed, 0xa6, 0x55, 0x05, 0x66, 0xa2, 0x76, 0xc0, 0x05, 0x65, 0x95, 0xde, 0x98, 0xcc, 0x35, 0xfe,
+	0xbd, 0xd6, 0x09, 0xa3, 0x66, 0x1d, 0x7f, 0x1d, 0x9c, 0xaa, 0xfe, 0xa5, 0x34, 0x30, 0xac, 0x11,
+	0x35, 0x22, 0x31, 0xc2, 0x1d, 0x35, 0x93, 0xfe, 0xfe, 0x63, 0x2c, 0x3d, 0x51, 0x3d, 0xa2, 0x77,
+	0xa9, 0x33, 0xa5, 0x66, 0xa5, 0x65, 0x6b, 0x55, 0x14, 0x6e, 0x14, 0xca, 0x19, 0xc4, 0x14, 0xa2,
+	0x76, 0x05, 0x1c, 0x93, 0xee, 0xa4, 0x76, 0x51, 0x9d, 0x9a, 0x29, 0xc0, 0x15, 0x29, 0x3d, 0x9d,
+	0xa9, 0xae, 0x11, 0xfe, 0xce, 0x79, 0xa9, 0x43, 0xc0, 0xa2, 0x77, 0xc0, 0x6f, 0xc1, 0x25, 0x31,
+	0xc8, 0x66, 0xc0, 0x31, 0xc2, 0x2c, 0x31, 0xc2, 0x2c, 0xc0, 0x25, 0xc0, 0x2c, 0x31, 0xc5, 0x25,
+	0x9c, 0xaa, 0x9b, 0xab, 0xfe, 0x73, 0xae, 0x93, 0xfe, 0x99, 0xcc, 0x6e, 0xc1, 0x6f, 0xc4, 0x66,
+	0x7e, 0x24, 0xc0, 0x29, 0x6e, 0x56, 0x79, 0xc0, 0x75, 0xa1, 0x96, 0x9d, 0xb9, 0xa3, 0x86, 0xad,
+	0x31, 0xfe, 0xcc, 0x26, 0xa1, 0x96, 0x5a, 0x66, 0x6f, 0x6b, 0x6b, 0x51, 0xc1, 0x69, 0x6f, 0x6e,
+	0x1b, 0x6d, 0x7a, 0x66, 0x13, 0xc0, 0x69, 0x69, 0xc0, 0xa3, 0x65, 0xa5, 0x55, 0x6e, 0x51, 0x0b,
+	0x72, 0x5b, 0xc0, 0x13, 0x6b, 0x57, 0x6b, 0x6f, 0x67, 0x52, 0x9d, 0x9a, 0x51, 0x9d, 0x89, 0x59,
+	0x6e, 0xa2, 0x77, 0xa3, 0x76, 0xa2, 0x77, 0x7d, 0xa3, 0x76, 0x64, 0xa1, 0x97, 0x13, 0x60, 0x7f,
+	0x6b, 0x53, 0xa2, 0x48, 0x99, 0xae, 0xfe, 0x61, 0xa1, 0x9b, 0x9d, 0xa3, 0x58, 0x42, 0x6e, 0x6b,
+	0xc0, 0x5a, 0xc0, 0x6b, 0x65, 0x6d, 0x6e, 0x68, 0x9f, 0xb7, 0xa0, 0xa8, 0xaa, 0x72, 0xaa, 0x51,
+	0xa3, 0x85, 0x0e, 0xa2, 0x64, 0xa3, 0x64, 0xa4, 0x44, 0xa6, 0x43, 0xa2, 0x67, 0x69, 0x69, 0xa2,
+	0x66, 0xc2, 0x5a, 0x21, 0xc2, 0x66, 0xca, 0x21, 0xc0, 0x1c, 0xc2, 0x21, 0xc1, 0x23, 0xa0, 0x8a,
+	0x99, 0xee, 0x97, 0xef, 0xa0, 0xa9, 0x9d, 0xbc, 0x9f, 0x7b, 0xa5, 0x47, 0xfe, 0x92, 0xe4, 0xfe,
+	0x49, 0x40, 0xa1, 0x5a, 0x5b, 0x42, 0xa3, 0x67, 0x50, 0xb0, 0x10, 0xfe, 0xe7, 0x3b, 0xa6, 0x55,
+	0x6b, 0xfd, 0xfd, 0xfd, 0x66, 0x55, 0x31, 0xc0, 0x9d, 0xaa, 0x91, 0xff, 0xfe, 0x6b, 0x6d, 0xfe,
+	0x31, 0x86, 0x6e, 0xfe, 0x7b, 0xef, 0xfe, 0xde, 0xda, 0x1d, 0x51, 0x96, 0xdd, 0xfe, 0x6b, 0x4d,
+	0x9d, 0x99, 0xad, 0x11, 0x2d, 0x9c, 0xaa, 0x7e, 0x6b, 0x6e, 0x98, 0xcc, 0x94, 0xee, 0x55, 0xfe,
+	0x94, 0x92, 0xfe, 0xde, 0xfb, 0xa8, 0x44, 0x1d, 0x31, 0xc0, 0x65, 0x31, 0x1d, 0x25, 0x98, 0xbc,
+	0x14, 0x92, 0xff, 0xfe, 0xad, 0x75, 0xb0, 0x00, 0x31, 0xc0, 0x1d, 0xc0, 0x2c, 0x1d, 0x18, 0x95,
+	0xdd, 0xfe, 0x7b, 0xcf, 0x11, 0x10, 0x6e, 0x38, 0xa7, 0x44, 0xa7, 0x54, 0xa5, 0x56, 0x7f, 0x05,
+	0x19, 0xc0, 0x14, 0x50, 0xc0, 0x19, 0xc0, 0x05, 0xa3, 0x76, 0x19, 0x0d, 0x21, 0x14, 0x59, 0x19,
+	0xc0, 0x0a, 0x05, 0x0d, 0x14, 0x00, 0x98, 0xcb, 0xfe, 0x29, 0x24, 0xc0, 0x6e, 0x18, 0x24, 0xc0,
+	0x6e, 0xc0, 0x7a, 0x6e, 0xad, 0x12, 0xfe, 0xef, 0x5d, 0xa5, 0x55, 0x66, 0xc0, 0x69, 0x31, 0xe5,
+	0x61, 0x55, 0x96, 0xdd, 0xfe, 0x6b, 0x6d, 0xfe, 0x31, 0x65, 0x15, 0x1d, 0xa2, 0x77, 0x29, 0xc0,
+	0x1d, 0xc2, 0x29, 0xc5, 0x79, 0x65, 0x7a, 0x65, 0x7a, 0x69, 0xfe, 0x9b, 0x45, 0xa8, 0x43, 0xc0,
+	0x9c, 0xab, 0x9d, 0x9a, 0x99, 0xcc, 0x9a, 0xbc, 0x9d, 0x9a, 0x52, 0x66, 0x0b, 0x18, 0xa2, 0x76,
+	0xa5, 0x54, 0xa4, 0x75, 0xa6, 0x54, 0xa5, 0x76, 0xa2, 0x86, 0x79, 0x75, 0x69, 0x60, 0x3b, 0xa2,
+	0x76, 0x6e, 0x51, 0x7b, 0xa1, 0x89, 0x6b, 0x46, 0x5b, 0xa0, 0x8a, 0x47, 0x9c, 0x9b, 0x99, 0xbc,
+	0x9a, 0xac, 0x9c, 0xab, 0x42, 0x66, 0x59, 0x5a, 0x6e, 0xc1, 0xa2, 0x86, 0xa4, 0x64, 0xa6, 0x64,
+	0xa5, 0x65, 0xa5, 0x75, 0xa3, 0x85, 0x2a, 0x60, 0x65, 0x7f, 0x6b, 0x4b, 0x97, 0xbe, 0x18, 0x47,
+	0xa0, 0x5a, 0x5b, 0x5b, 0xa2, 0x77, 0x65, 0x66, 0x7a, 0x66, 0x29, 0x59, 0x6d, 0x75, 0x75, 0x03,
+	0xac, 0x40, 0xaa, 0x61, 0xa3, 0x73, 0x02, 0x39, 0xa3, 0x55, 0xa7, 0x21, 0xa6, 0x44, 0x6e, 0x6d,
+	0xc0, 0x69, 0x6e, 0xc0, 0x5a, 0x21, 0xc2, 0x1c, 0xca, 0x21, 0xc0, 0x1c, 0xc2, 0x21, 0xc1, 0x1c,
+	0x67, 0x63, 0x99, 0xdd, 0xfe, 0xdc, 0x20, 0xa0, 0xba, 0x0e, 0x19, 0x9e, 0x7c, 0xfe, 0x69, 0xe2,
+	0x99, 0x9e, 0xa1, 0x69, 0x5f, 0x35, 0x61, 0xa5, 0x54, 0xfe, 0xa5, 0x33, 0xfe, 0xff, 0xfe, 0x6b,
+	0xc0, 0x66, 0x31, 0xc0, 0x2c, 0x31, 0xfd, 0xfd, 0xf3, 0x2c, 0x31, 0xc0, 0x2c, 0x31, 0xc0, 0x9b,
+	0xbb, 0x97, 0xcc, 0x94, 0xee, 0xfe, 0x5a, 0xcb, 0x97, 0xcc, 0xa8, 0x44, 0xfe, 0xad, 0x75, 0xb0,
+	0x00, 0xa3, 0x76, 0x99, 0xbc, 0xfe, 0xa5, 0x13, 0xfe, 0x63, 0x0b, 0x6f, 0xaa, 0x33, 0x51, 0xc0,
+	0xa3, 0x76, 0xc0, 0x9b, 0xab, 0x0d, 0x9b, 0xbb, 0xaa, 0x32, 0xfe, 0xad, 0x75, 0xaf, 0x10, 0xa5,
+	0x56, 0xc0, 0x55, 0x31, 0xc1, 0x25, 0x31, 0xc0, 0x51, 0x99, 0xcb, 0x94, 0xee, 0xfe, 0x4a, 0x89,
+	0xab, 0x33, 0xad, 0x22, 0xac, 0x22, 0xa5, 0x55, 0xa2, 0x77, 0xc3, 0x3d, 0x96, 0xde, 0x3c, 0x94,
+	0xee, 0x99, 0xbb, 0x9a, 0xbb, 0x51, 0xa3, 0x77, 0x0d, 0x35, 0xa2, 0x77, 0xa3, 0x76, 0xa2, 0x77,
+	0xa2, 0x78, 0x21, 0x51, 0x19, 0x39, 0x6b, 0x0d, 0x19, 0xc0, 0x00, 0x19, 0xc0, 0x6e, 0x19, 0xc0,
+	0x14, 0xc0, 0x05, 0x98, 0xdc, 0x93, 0xee, 0x66, 0xc0, 0x55, 0x29, 0x24, 0x1d, 0x56, 0x65, 0xc0,
+	0xaf, 0x11, 0xfe, 0xef, 0x7d, 0xa4, 0x66, 0xe4, 0x66, 0xc3, 0x31, 0xc0, 0x65, 0x96, 0xdd, 0x19,
+	0xfe, 0x4a, 0x28, 0x1d, 0xc1, 0x6b, 0xa2, 0x76, 0xc0, 0x29, 0xc0, 0x5d, 0xc1, 0x29, 0xc1, 0x27,
+	0xc0, 0x69, 0x69, 0xc1, 0x79, 0xa2, 0x85, 0xaa, 0x32, 0x7f, 0x97, 0xdd, 0x9a, 0xbc, 0x6b, 0xa2,
+	0x77, 0x13, 0x69, 0x5a, 0x66, 0xc1, 0xa2, 0x76, 0x69, 0x7a, 0xa4, 0x75, 0xa6, 0x64, 0xa7, 0x63,
+	0xa4, 0x75, 0xa2, 0x86, 0xa1, 0x96, 0x79, 0x64, 0xc0, 0x69, 0xa0, 0x7a, 0xa0, 0x8a, 0x5a, 0x43,
+	0x9d, 0x9a, 0x9a, 0x9d, 0x9a, 0xac, 0x9b, 0x9b, 0x42, 0x04, 0xc0, 0x5b, 0x6f, 0xa2, 0x76, 0x66,
+	0x59, 0x7a, 0x55, 0xc0, 0x7e, 0x11, 0xa0, 0xa7, 0xa5, 0x65, 0x33, 0xa5, 0x64, 0xa6, 0x54, 0xa3,
+	0x95, 0x68, 0x61, 0x19, 0x42, 0xfe, 0x92, 0x82, 0xfe, 0x49, 0x00, 0xa1, 0x59, 0xa2, 0x58, 0x4b,
+	0x66, 0x26, 0x7a, 0x27, 0x76, 0x4e, 0x1f, 0x5e, 0x79, 0x75, 0x0e, 0xa1, 0xa6, 0xa9, 0x72, 0xab,
+	0x40, 0xa4, 0x73, 0x9e, 0xa7, 0x5c, 0xa4, 0x54, 0xa5, 0x54, 0xa5, 0x45, 0xa3, 0x55, 0x23, 0x69,
+	0x6e, 0xc4, 0x1c, 0xcb, 0x21, 0xc0, 0x1c, 0xc2, 0x21, 0xc0, 0x6e, 0x56, 0x23, 0x67, 0x9a, 0xdc,
+	0xfe, 0xe4, 0x80, 0x9d, 0xcc, 0x02, 0xa1, 0x69, 0xa0, 0x6b, 0xfe, 0x8a, 0xa4, 0x96, 0xaf, 0x47,
+	0x47, 0x24, 0xc0, 0x29, 0xfe, 0x7b, 0xce, 0xfe, 0xef, 0x3b, 0xa6, 0x46, 0xc2, 0x66, 0x31, 0xfd,
+	0xfd, 0xf2, 0x2c, 0x31, 0xc3, 0x2c, 0x98, 0xcc, 0x3c, 0x91, 0xff, 0x98, 0xcc, 0xa2, 0x77, 0xb1,
+	0x00, 0xfe, 0xd6, 0x9a, 0xa8, 0x33, 0x7f, 0x95, 0xed, 0xfe, 0x7b, 0xce, 0x9a, 0xbc, 0x25, 0xa5,
+	0x56, 0x65, 0xc0, 0x19, 0x0d, 0x99, 0xbc, 0x96, 0xdd, 0xc0, 0xad, 0x21, 0xfe, 0xc6, 0x38, 0x1d,
+	0x31, 0x2c, 0x31, 0xc5, 0x55, 0x7a, 0x31, 0x01, 0xfe, 0x42, 0x08, 0x3d, 0xa5, 0x65, 0xaa, 0x33,
+	0xad, 0x12, 0xaf, 0x00, 0x1d, 0x2c, 0x65, 0x2c, 0x31, 0xc0, 0x9d, 0xa9, 0x9c, 0xaa, 0x98, 0xcd,
+	0x97, 0xcc, 0x95, 0xee, 0x96, 0xdd, 0x99, 0xcb, 0x5a, 0xa3, 0x76, 0xa2, 0x77, 0x34, 0xa3, 0x76,
+	0xa5, 0x56, 0xa4, 0x66, 0xa3, 0x66, 0x7a, 0x0d, 0xc1, 0x14, 0xc0, 0x6e, 0xc0, 0x56, 0xc0, 0x14,
+	0xc0, 0x0d, 0xc0, 0x09, 0xfe, 0x39, 0xa6, 0x9c, 0xaa, 0x24, 0x7e, 0xa3, 0x67, 0xa6, 0x54, 0xa5,
+	0x56, 0xa3, 0x77, 0x69, 0x04, 0xa6, 0x55, 0xfe, 0xef, 0x5d, 0x31, 0x25, 0x31, 0xe3, 0x66, 0x31,
+	0xc1, 0x2c, 0x31, 0x25, 0xc0, 0x9d, 0x9a, 0x95, 0xed, 0xfe, 0x6b, 0x4c, 0x24, 0x29, 0xc0, 0x24,
+	0x29, 0xc0, 0x69, 0x5e, 0xc1, 0x22, 0xc0, 0x27, 0xc1, 0x69, 0xc0, 0x59, 0x6e, 0xc0, 0x76, 0x7f,
+	0x51, 0xc0, 0x28, 0x20, 0x66, 0xc1, 0x27, 0x66, 0x1b, 0x5a, 0xc0, 0x1b, 0x14, 0x79, 0xa2, 0x86,
+	0xa2, 0x96, 0xa2, 0x85, 0xa9, 0x52, 0xa7, 0x62, 0xa3, 0x85, 0x64, 0x02, 0x0a, 0xa1, 0x5b, 0x47,
+	0x9a, 0xac, 0x98, 0xbd, 0x9b, 0x9b, 0x9d, 0x8b, 0x5b, 0x0b, 0x5b, 0x6f, 0x5a, 0xc0, 0x1f, 0x7b,
+	0x62, 0x6d, 0x29, 0x79, 0x66, 0xc0, 0x7b, 0x9d, 0xa9, 0xa1, 0x97, 0x7e, 0xa2, 0x85, 0xa5, 0x65,
+	0xa9, 0x50, 0xa7, 0x51, 0xa3, 0x86, 0x66, 0x65, 0x9c, 0x9c, 0xfe, 0x7a, 0x42, 0x98, 0x9e, 0x0f,
+	0xa2, 0x59, 0x66, 0x69, 0x7a, 0x72, 0x7b, 0x20, 0x22, 0x4e, 0xc0, 0x79, 0x9f, 0xb8, 0x3a, 0xa3,
+	0xa5, 0xab, 0x50, 0xac, 0x40, 0x78, 0xa0, 0x85, 0x5c, 0xa2, 0x77, 0xa7, 0x43, 0xa5, 0x33, 0x69,
+	0x6c, 0x6e, 0x6e, 0xc2, 0x1c, 0xcc, 0x21, 0xc0, 0x1c, 0xc2, 0x21, 0xc0, 0x5e, 0x1e, 0x1c, 0x6b,
+	0x9c, 0xcc, 0x99, 0xee, 0x99, 0xef, 0x57, 0xa2, 0x68, 0xa0, 0x7b, 0x9a, 0x9e, 0xfe, 0x61, 0xc2,
+	0x9c, 0x8c, 0x47, 0x5b, 0x29, 0x51, 0xaa, 0x42, 0xfe, 0xbd, 0xb6, 0x31, 0xc2, 0x66, 0x31, 0xfd,
+	0xfd, 0xf0, 0x2c, 0x31, 0xc1, 0x2c, 0x31, 0xc0, 0x9a, 0xbb, 0x94, 0xee, 0xfe, 0x73, 0xae, 0xfe,
+	0x39, 0xc7, 0x51, 0xaa, 0x33, 0xfe, 0xa5, 0x34, 0x35, 0x31, 0x9d, 0xa9, 0xfe, 0xb5, 0x96, 0xfe,
+	0x73, 0x8d, 0x1c, 0x39, 0x05, 0xa3, 0x76, 0x05, 0xc0, 0x7f, 0x99, 0xbb, 0x95, 0xed, 0x6f, 0xfe,
+	0x94, 0x92, 0xfe, 0xde, 0xfb, 0x2c, 0x9d, 0x99, 0x31, 0x2c, 0xc0, 0x31, 0xc2, 0x65, 0x2c, 0xc0,
+	0x55, 0x21, 0xfe, 0x94, 0x91, 0xfe, 0x31, 0xa6, 0x9d, 0xa9, 0xa2, 0x78, 0x29, 0x3d, 0xad, 0x22,
+	0xad, 0x11, 0xad, 0x21, 0xa8, 0x44, 0x31, 0xc1, 0x25, 0x52, 0xc1, 0x50, 0x98, 0xcc, 0x95, 0xde,
+	0x98, 0xcc, 0x96, 0xed, 0x19, 0x29, 0x66, 0xa3, 0x76, 0xa2, 0x77, 0xa4, 0x56, 0x10, 0x1c, 0xa4,
+	0x65, 0xa3, 0x77, 0x31, 0x05, 0x6e, 0x6b, 0xc1, 0x7a, 0xc0, 0x6e, 0x21, 0x99, 0xbc, 0x0c, 0x9a,
+	0xba, 0xa8, 0x44, 0xab, 0x23, 0xb0, 0x00, 0x2d, 0xa6, 0x55, 0xa2, 0x77, 0xc0, 0x52, 0x9d, 0x99,
+	0x2c, 0x6e, 0xe5, 0x2c, 0xc0, 0x31, 0xc1, 0x25, 0xc2, 0x2c, 0x96, 0xdc, 0xfe, 0x7b, 0xce, 0xfe,
+	0x39, 0xc6, 0x9d, 0x9a, 0x24, 0x69, 0xc0, 0xa2, 0x77, 0x59, 0xc0, 0x66, 0xc0, 0x1d, 0x7b, 0xc1,
+	0x69, 0xc0, 0x1d, 0xc0, 0x7e, 0x61, 0xa1, 0x89, 0x69, 0x66, 0xc0, 0x14, 0xc0, 0x23, 0x20, 0x1b,
+	0xc0, 0x20, 0x2a, 0x27, 0xc1, 0x23, 0x69, 0x74, 0x65, 0xa4, 0x74, 0xa8, 0x63, 0xa8, 0x42, 0xa5,
+	0x74, 0xa2, 0x76, 0x61, 0x9b, 0x8e, 0x99, 0xad, 0x99, 0xac, 0x9c, 0xab, 0x5a, 0x5b, 0x5a, 0x6b,
+	0x5e, 0x6b, 0xc0, 0x65, 0x14, 0x77, 0x23, 0x1c, 0xc2, 0x23, 0x67, 0xc0, 0x7a, 0x69, 0x64, 0x6e,
+	0xa3, 0x73, 0xa6, 0x73, 0xab, 0x42, 0xa3, 0x86, 0x7e, 0x6f, 0x99, 0xad, 0xfe, 0x61, 0xc2, 0x9b,
+	0x8c, 0x1b, 0x22, 0xc1, 0x20, 0xc1, 0x22, 0xc0, 0x1f, 0xc0, 0xa0, 0xa8, 0x74, 0x60, 0xa5, 0x83,
+	0xac, 0x41, 0xa8, 0x52, 0xa2, 0x95, 0xa0, 0x85, 0x68, 0xa3, 0x55, 0xa6, 0x53, 0xa5, 0x33, 0x6d,
+	0x6d, 0x6e, 0xc1, 0x1c, 0xcd, 0x21, 0xc0, 0x1c, 0xc2, 0x21, 0x5a, 0xc1, 0x1c, 0x6b, 0x62, 0x9a,
+	0xee, 0xfe, 0xec, 0x40, 0x5b, 0xa0, 0x8a, 0x9f, 0x8b, 0x9e, 0x7c, 0xfe, 0x82, 0x43, 0x97, 0xaf,
+	0xa1, 0x59, 0x47, 0x29, 0x51, 0xa4, 0x76, 0x08, 0xfe, 0xf7, 0xbe, 0xa2, 0x77, 0x66, 0x31, 0xfd,
+	0xfd, 0xf2, 0x2c, 0x31, 0xc2, 0x2c, 0x98, 0xcc, 0xfe, 0x84, 0x10, 0x34, 0x98, 0xcc, 0xa2, 0x77,
+	0xb0, 0x00, 0xfe, 0xce, 0x79, 0x1d, 0x31, 0x9d, 0xaa, 0xfe, 0xa5, 0x14, 0xfe, 0x52, 0xaa, 0xa2,
+	0x77, 0xac, 0x22, 0x66, 0xa2, 0x76, 0x51, 0x51, 0x6f, 0x97, 0xdc, 0x95, 0xde, 0xa6, 0x55, 0xfe,
+	0xa5, 0x34, 0xfe, 0xf7, 0x9d, 0x31, 0x2c, 0x1d, 0x31, 0xc1, 0x2c, 0x31, 0x2c, 0xc0, 0x1d, 0x2c,
+	0x31, 0x99, 0xcc, 0xfe, 0x94, 0xd2, 0x38, 0x69, 0x34, 0xa7, 0x44, 0x9d, 0xaa, 0x98, 0xcc, 0x9d,
+	0x99, 0x38, 0xa8, 0x43, 0x08, 0xad, 0x11, 0xa8, 0x44, 0x11, 0xa3, 0x67, 0xc4, 0x65, 0x1d, 0x9b,
+	0xba, 0x95, 0xee, 0xfe, 0x63, 0x0b, 0x38, 0x69, 0x66, 0x55, 0x31, 0x9d, 0xaa, 0x1d, 0x31, 0x2c,
+	0xa4, 0x56, 0x6f, 0xa2, 0x77, 0xa3, 0x76, 0x1c, 0x6e, 0xc1, 0x29, 0x01, 0x38, 0x2c, 0xfe, 0x84,
+	0x10, 0xfe, 0xe6, 0xfb, 0xa5, 0x56, 0x25, 0x6f, 0xc4, 0x66, 0x31, 0xe2, 0x51, 0xc0, 0x31, 0xc8,
+	0x25, 0x15, 0xfe, 0x8c, 0x50, 0xfe, 0x31, 0x65, 0x9d, 0x9a, 0xa4, 0x65, 0x51, 0xc0, 0x22, 0xc2,
+	0x67, 0xc0, 0x7a, 0xc0, 0x24, 0x1d, 0xc0, 0x7a, 0xc0, 0x7a, 0x62, 0x55, 0xa3, 0x65, 0x7a, 0x9d,
+	0x99, 0xc0, 0x6e, 0xc1, 0x6b, 0x7f, 0xc0, 0x27, 0xc0, 0x65, 0x5a, 0x79, 0x6e, 0x79, 0x64, 0x7a,
+	0xa5, 0x74, 0xab, 0x32, 0xa4, 0x75, 0x9b, 0xba, 0x97, 0xaf, 0x9b, 0x9c, 0x9d, 0x9a, 0x06, 0xa2,
+	0x78, 0xc0, 0x19, 0x6e, 0x12, 0xc0, 0x79, 0x09, 0x0e, 0x09, 0x7a, 0xc0, 0x65, 0x5a, 0x0c, 0x67,
+	0x57, 0xa2, 0x68, 0xc0, 0x69, 0x23, 0x54, 0x09, 0x3d, 0xa4, 0x84, 0xa9, 0x53, 0xaa, 0x52, 0xa4,
+	0x66, 0x41, 0x97, 0xbe, 0x95, 0xbe, 0x06, 0x12, 0xa0, 0x7a, 0xa2, 0x67, 0x7a, 0x65, 0xc0, 0x20,
+	0xc0, 0x24, 0xc0, 0x1d, 0x19, 0x12, 0x00, 0xa3, 0x85, 0xae, 0x20, 0xa9, 0x60, 0xa0, 0xb5, 0x58,
+	0x58, 0xa6, 0x43, 0xa7, 0x32, 0xa4, 0x44, 0x68, 0xc0, 0x6e, 0xc0, 0x1c, 0xcd, 0x21, 0xc0, 0x1c,
+	0xc0, 0x6b, 0xc0, 0x1c, 0x5e, 0xc1, 0x21, 0x1c, 0x66, 0x9c, 0xcd, 0xfe, 0xec, 0xa1, 0x62, 0x67,
+	0x43, 0xa0, 0x7b, 0x97, 0xaf, 0xfe, 0x51, 0x20, 0x1f, 0x47, 0x5e, 0x66, 0x27, 0xac, 0x22, 0xfe,
+	0xde, 0xfb, 0xa8, 0x44, 0x66, 0x31, 0xc0, 0x2c, 0x31, 0xfd, 0xfd, 0xf0, 0x2c, 0xc0, 0x31, 0x9c,
+	0xaa, 0xfe, 0xb5, 0x96, 0xfe, 0x73, 0x8e, 0xfe, 0x31, 0x86, 0x9d, 0x99, 0xad, 0x22, 0xfe, 0xa4,
+	0xf3, 0xae, 0x01, 0x2c, 0x31, 0x95, 0xdd, 0xfe, 0x84, 0x10, 0x96, 0xdc, 0xa4, 0x66, 0xa8, 0x45,
+	0x9d, 0x99, 0xa7, 0x55, 0x9b, 0xaa, 0xc0, 0x7e, 0x95, 0xde, 0x96, 0xdd, 0x21, 0xfe, 0xad, 0x75,
+	0xfe, 0xf7, 0x9d, 0xa3, 0x67, 0x2c, 0x55, 0x31, 0x2c, 0x69, 0x31, 0xc1, 0x25, 0x2c, 0x31, 0x1d,
+	0x94, 0xee, 0xfe, 0x84, 0x0f, 0x94, 0xee, 0x9c, 0xaa, 0xaa, 0x33, 0x39, 0x05, 0xc0, 0x9d, 0xaa,
+	0x3d, 0x01, 0x98, 0xcc, 0x66, 0xa4, 0x56, 0xa8, 0x54, 0xac, 0x12, 0x29, 0xaa, 0x33, 0xa7, 0x54,
+	0xa3, 0x67, 0x1d, 0x11, 0x1d, 0x7e, 0x11, 0x94, 0xee, 0x00, 0x3d, 0x6f, 0x7e, 0x3d, 0x9b, 0xbb,
+	0x38, 0xa5, 0x65, 0x1c, 0x28, 0x56, 0x41, 0x9d, 0x99, 0x61, 0x7f, 0x6e, 0x24, 0x15, 0x7e, 0x29,
+	0x24, 0x2c, 0xfe, 0x9c, 0xd2, 0x31, 0xc1, 0x66, 0xc0, 0x31, 0xc1, 0x51, 0xc0, 0x2c, 0x31, 0xe2,
+	0x1d, 0x30, 0x9b, 0xaa, 0x51, 0x7f, 0xa2, 0x77, 0x30, 0x1d, 0x65, 0x7f, 0x31, 0xc1, 0x98, 0xdc,
+	0xfe, 0x8c, 0x50, 0xfe, 0x42, 0x07, 0x29, 0xc0, 0x61, 0x7e, 0xc1, 0x5b, 0x29, 0xc1, 0x24, 0xc0,
+	0x66, 0x1b, 0xc1, 0x71, 0x69, 0x7d, 0xa3, 0x66, 0x69, 0x6e, 0xa3, 0x76, 0x55, 0x7b, 0xc0, 0x56,
+	0x9d, 0xaa, 0x07, 0x5f, 0x6f, 0x5e, 0xc1, 0x55, 0xc0, 0x1e, 0x61, 0x65, 0xa4, 0x76, 0xa3, 0x77,
+	0x9c, 0xba, 0x9e, 0x7a, 0x5a, 0x6f, 0x14, 0x52, 0x14, 0xa2, 0x87, 0x9c, 0xa9, 0x7a, 0xa3, 0x75,
+	0x33, 0x7e, 0x7a, 0xa4, 0x55, 0x7e, 0x59, 0x51, 0x56, 0x52, 0x9d, 0x9b, 0x57, 0x9d, 0x9b, 0x5b,
+	0x17, 0xa2, 0x65, 0x6e, 0x5b, 0x12, 0x9d, 0xb9, 0xa3, 0x96, 0xa7, 0x73, 0xa8, 0x53, 0xa9, 0x33,
+	0x51, 0x95, 0xcf, 0x95, 0xbe, 0x47, 0xa2, 0x59, 0x29, 0xc0, 0x6d, 0x25, 0x20, 0x77, 0xc0, 0x5a,
+	0x6e, 0x18, 0xa2, 0x76, 0x74, 0x9d, 0xb9, 0xa9, 0x51, 0xaa, 0x71, 0xa5, 0x92, 0xa2, 0x65, 0x6c,
+	0xa2, 0x55, 0xa6, 0x42, 0xa7, 0x32, 0xa2, 0x66, 0x69, 0x6e, 0x1c, 0xce, 0x21, 0xc0, 0x1c, 0x23,
+	0xc1, 0x1c, 0x5e, 0x6e, 0xc0, 0x7a, 0x1c, 0x66, 0x9e, 0xac, 0x99, 0xef, 0x9a, 0xcd, 0x0c, 0x0e,
+	0xa0, 0x7b, 0x9b, 0x9d, 0xfe, 0x61, 0x81, 0x9d, 0x7c, 0xa1, 0x59, 0x6b, 0x56, 0x27, 0xa4, 0x66,
+	0xfe, 0xad, 0x75, 0xfe, 0xff, 0xff, 0x66, 0x31, 0x2c, 0x31, 0xfd, 0xfd, 0xf1, 0x1d, 0x2c, 0x9b,
+	0xaa, 0xfe, 0x94, 0xb2, 0xfe, 0x4a, 0x49, 0x98, 0xcc, 0xc0, 0xac, 0x22, 0xfe, 0xb5, 0x96, 0xb0,
+	0x00, 0x31, 0x9c, 0xba, 0x97, 0xcc, 0xfe, 0x6b, 0x6d, 0x95, 0xed, 0xae, 0x01, 0xa5, 0x66, 0x66,
+	0x55, 0x00, 0xa4, 0x65, 0x9c, 0xaa, 0x93, 0xef, 0x98, 0xcc, 0xaf, 0x11, 0xfe, 0xc6, 0x38, 0x2c,
+	0x31, 0x65, 0x31, 0xc0, 0x2c, 0x31, 0x1d, 0x25, 0x31, 0xc1, 0x2c, 0x9d, 0x99, 0x95, 0xee, 0x04,
+	0x95, 0xdd, 0x39, 0xac, 0x22, 0x00, 0x19, 0x14, 0xc0, 0xa2, 0x66, 0x14, 0x05, 0x31, 0x98, 0xcc,
+	0x9a, 0xbb, 0x9d, 0xaa, 0x69, 0x66, 0xa8, 0x34, 0xad, 0x21, 0xac, 0x22, 0xa5, 0x56, 0x7e, 0xc0,
+	0x9d, 0x9a, 0x97, 0xdc, 0x98, 0xcd, 0x69, 0x14, 0x19, 0x9c, 0xba, 0x3d, 0x9a, 0xbb, 0xa2, 0x77,
+	0xfe, 0xad, 0x54, 0x30, 0x9d, 0x99, 0x20, 0x9a, 0xab, 0x19, 0x9b, 0xab, 0x61, 0x55, 0x9d, 0xaa,
+	0x04, 0x18, 0xc0, 0x98, 0xcc, 0x96, 0xdc, 0x18, 0xfe, 0xef, 0x5d, 0xa5, 0x55, 0xc5, 0x2c, 0x31,
+	0xc2, 0x51, 0x31, 0xd7, 0x2c, 0x31, 0xc3, 0x9c, 0xba, 0x0d, 0x94, 0xee, 0x30, 0x96, 0xdd, 0x51,
+	0x6e, 0x7e, 0xac, 0x22, 0xfe, 0xad, 0x74, 0xab, 0x33, 0xa5, 0x56, 0x31, 0x2c, 0x50, 0x1d, 0x61,
+	0xfe, 0x94, 0x91, 0xfe, 0x41, 0xe7, 0x9a, 0xbb, 0x27, 0xc0, 0x66, 0x6d, 0x6e, 0x5a, 0xc2, 0x65,
+	0x7a, 0x10, 0xa0, 0xa8, 0xa2, 0x76, 0xa2, 0xa5, 0x6e, 0xa2, 0x87, 0xa6, 0x44, 0xa4, 0x66, 0xa3,
+	0x66, 0xa2, 0x76, 0x66, 0xc0, 0x01, 0x51, 0x9c, 0xba, 0x9c, 0xaa, 0x9d, 0x8a, 0x42, 0x46, 0x52,
+	0x56, 0x10, 0x5a, 0x6b, 0xa2, 0x77, 0x14, 0x65, 0xa2, 0x77, 0x69, 0xa0, 0x8a, 0x56, 0xc0, 0x79,
+	0x75, 0x7d, 0xa3, 0x75, 0xa3, 0x86, 0xa3, 0x76, 0xa5, 0x65, 0xa6, 0x64, 0xa2, 0x77, 0xa2, 0x76,
+	0x69, 0xc1, 0x69, 0xc0, 0x57, 0x9d, 0x9a, 0x00, 0x9b, 0xac, 0x9d, 0x8a, 0x41, 0x9d, 0x9a, 0x02,
+	0x5b, 0x25, 0x7a, 0x10, 0x75, 0x33, 0xac, 0x31, 0xa8, 0x44, 0x9b, 0xaa, 0x94, 0xde, 0x11, 0xa1,
+	0x69, 0x47, 0xc0, 0x22, 0x25, 0x66, 0x67, 0xc0, 0x6e, 0xc1, 0x6e, 0x25, 0x12, 0xa1, 0x97, 0xa7,
+	0x82, 0xfe, 0xcb, 0xc5, 0xa4, 0x65, 0x68, 0xa0, 0x85, 0xa2, 0x65, 0x36, 0xa6, 0x33, 0x6e, 0x69,
+	0xc0, 0x6e, 0x1c, 0xd3, 0x21, 0xc0, 0x6e, 0x21, 0x1c, 0xc0, 0x9f, 0x9b, 0x9b, 0xdd, 0x98, 0xde,
+	0x9d, 0xbb, 0xa0, 0x9b, 0xa0, 0x6a, 0x43, 0xfe, 0x82, 0x42, 0x97, 0x9f, 0xa1, 0x6a, 0x2c, 0x56,
+	0x27, 0x2c, 0xfe, 0x7b, 0xce, 0xfe, 0xef, 0x5d, 0xa4, 0x66, 0x6e, 0x2c, 0x31, 0xfd, 0xfd, 0xef,
+	0x2c, 0xc1, 0x98, 0xcc, 0xfe, 0x8c, 0x51, 0xfe, 0x42, 0x28, 0x9a, 0xcb, 0x6f, 0xb0, 0x00, 0xfe,
+	0xc6, 0x38, 0xab, 0x33, 0xa2, 0x77, 0x18, 0xfe, 0xb5, 0x96, 0xfe, 0x63, 0x2c, 0x9c, 0xaa, 0xa9,
+	0x44, 0x14, 0xc0, 0xa3, 0x66, 0x9c, 0xaa, 0xc0, 0x9d, 0xa9, 0x0d, 0x98, 0xcc, 0xae, 0x11, 0xfe,
+	0xce, 0x58, 0xab, 0x23, 0x31, 0xc5, 0x66, 0x1d, 0x2c, 0x31, 0x2c, 0x99, 0xbb, 0xfe, 0x94, 0xd3,
+	0xfe, 0x4a, 0x49, 0x55, 0x09, 0x05, 0xc0, 0x14, 0xc5, 0x6e, 0xc0, 0x05, 0x9c, 0xaa, 0x9d, 0xaa,
+	0x30, 0x9b, 0xaa, 0x25, 0x39, 0x0d, 0x66, 0xa2, 0x77, 0x04, 0x1d, 0xa3, 0x77, 0x19, 0xc0, 0x9b,
+	0xbb, 0x99, 0xbb, 0x08, 0x05, 0xb1, 0x00, 0x18, 0xa2, 0x77, 0xc0, 0x31, 0x2c, 0xc1, 0x18, 0x55,
+	0x51, 0xc0, 0x18, 0xc0, 0xfe, 0x9c, 0xd3, 0x3d, 0x08, 0xfe, 0xd6, 0x9a, 0x31, 0xc0, 0x2c, 0x31,
+	0xc8, 0x2c, 0x31, 0xc3, 0x2c, 0x31, 0xc1, 0x55, 0xc0, 0x31, 0x65, 0xc0, 0x31, 0x56, 0x6e, 0xc1,
+	0x31, 0x2c, 0x29, 0xc1, 0x2c, 0x31, 0xc0, 0x61, 0x55, 0x9b, 0xbb, 0x91, 0xff, 0xfe, 0x63, 0x0b,
+	0x96, 0xdd, 0x9b, 0xab, 0x7a, 0xa2, 0x77, 0x5a, 0x2c, 0x50, 0x05, 0x04, 0xaf, 0x01, 0xaf, 0x11,
+	0xa6, 0x54, 0x55, 0x20, 0xa2, 0x66, 0x99, 0xdc, 0xfe, 0xa4, 0xb2, 0xfe, 0x49, 0xe8, 0x99, 0xcc,
+	0x5f, 0x6d, 0x79, 0x69, 0x12, 0xa2, 0x66, 0x66, 0x56, 0x7d, 0xa1, 0xa7, 0xa3, 0x86, 0xa4, 0x85,
+	0xa5, 0x84, 0xa4, 0x84, 0xa2, 0x85, 0xa2, 0x68, 0xc1, 0x6b, 0x6e, 0x6b, 0x6d, 0x1b, 0x14, 0x7f,
+	0x69, 0x45, 0x42, 0x9c, 0x9c, 0x9c, 0x9c, 0x9b, 0x9c, 0x9b, 0xac, 0x42, 0x0e, 0x5a, 0xa2, 0x66,
+	0x6e, 0x12, 0x59, 0xa0, 0x9b, 0x62, 0x79, 0xa3, 0x84, 0xa4, 0x74, 0x2f, 0xa5, 0x74, 0xa5, 0x64,
+	0xa2, 0x86, 0x6e, 0x65, 0x6e, 0x19, 0x1c, 0x7a, 0xc0, 0x59, 0x66, 0x15, 0x6f, 0x19, 0x47, 0x9c,
+	0x9b, 0x9b, 0xac, 0x99, 0xbd, 0x9b, 0x9b, 0x47, 0x9f, 0x6b, 0x11, 0x6f, 0xc0, 0xa0, 0xa7, 0xa3,
+	0x75, 0xa9, 0x62, 0xa9, 0x43, 0x9a, 0xbb, 0xfe, 0x49, 0x41, 0x42, 0xa2, 0x59, 0x56, 0x1d, 0xc1,
+	0x6b, 0xc4, 0x1d, 0xc1, 0xa1, 0xb5, 0xfe, 0x92, 0xc4, 0xaa, 0x41, 0xa1, 0x95, 0xa1, 0x95, 0xa0,
+	0x75, 0xa5, 0x53, 0xa7, 0x33, 0xa3, 0x55, 0xa2, 0x65, 0x69, 0x6e, 0xc0, 0x1c, 0xc8, 0x21, 0xc1,
+	0x1c, 0xcb, 0x23, 0x9d, 0xbb, 0x99, 0xde, 0x3b, 0xa1, 0x99, 0x53, 0xa1, 0x69, 0x99, 0x9e, 0xfe,
+	0x51, 0x40, 0x9e, 0x7c, 0xa2, 0x59, 0x6f, 0x1d, 0xc0, 0xa9, 0x44, 0xfe, 0xc6, 0x38, 0xae, 0x11,
+	0xfd, 0xfd, 0xf3, 0x9d, 0xaa, 0x34, 0xfe, 0x7b, 0xce, 0xfe, 0x39, 0xa6, 0x9b, 0xab, 0xa8, 0x44,
+	0xfe, 0x8c, 0x30, 0xfe, 0xe6, 0xfb, 0xa7, 0x44, 0x31, 0x9c, 0xba, 0xfe, 0xa5, 0x34, 0xfe, 0x5a,
+	0xca, 0x6b, 0xa8, 0x44, 0xa7, 0x44, 0x9d, 0xa9, 0x56, 0xa3, 0x77, 0x0d, 0x9c, 0xaa, 0x94, 0xee,
+	0x9c, 0xaa, 0xaf, 0x01, 0xfe, 0xd6, 0xda, 0xa8, 0x54, 0x6b, 0x31, 0xc4, 0x2c, 0x31, 0x2c, 0xc0,
+	0x31, 0x34, 0xfe, 0x7b, 0xef, 0x92, 0xff, 0x39, 0xab, 0x22, 0xa4, 0x77, 0x55, 0xa2, 0x77, 0x14,
+	0xc4, 0x59, 0x05, 0x14, 0xc1, 0x19, 0x14, 0x31, 0x05, 0x99, 0xcc, 0x95, 0xdd, 0xc0, 0xaa, 0x33,
+	0x31, 0x7f, 0x14, 0xc0, 0x9a, 0xbb, 0x98, 0xcc, 0xa3, 0x66, 0xfe, 0xad, 0x55, 0xae, 0x11, 0x2c,
+	0x6e, 0xca, 0x2c, 0x91, 0xff, 0xfe, 0x4a, 0x49, 0x9a, 0xbb, 0xfe, 0xa5, 0x34, 0xfe, 0xf7, 0xbe,
+	0x31, 0xca, 0x2c, 0xc4, 0x31, 0xc0, 0x2c, 0x5a, 0xc0, 0x31, 0xc0, 0x2a, 0xc1, 0x1d, 0x31, 0xc0,
+	0x1d, 0x7e, 0x31, 0x2c, 0xc0, 0x66, 0x0c, 0x9b, 0xaa, 0x9b, 0xbb, 0x9b, 0xaa, 0x09, 0x97, 0xdd,
+	0x91, 0xff, 0x99, 0xcc, 0xc1, 0xa2, 0x77, 0xc0, 0x18, 0x6e, 0xc0, 0x55, 0xa1, 0x89, 0xa7, 0x45,
+	0xfe, 0x94, 0x93, 0xfe, 0xde, 0xfc, 0xa8, 0x43, 0x25, 0xc1, 0x9b, 0xbb, 0xfe, 0xa4, 0xb4, 0xfe,
+	0x41, 0xc8, 0x9c, 0xaa, 0x55, 0x7e, 0x65, 0x7d, 0x6d, 0x60, 0xa2, 0x86, 0xa6, 0x64, 0xa7, 0x63,
+	0xa6, 0x64, 0xa3, 0x75, 0xa2, 0x86, 0x61, 0x7f, 0x6e, 0x6b, 0x56, 0xc0, 0x6f, 0x6e, 0x29, 0xc0,
+	0x31, 0x25, 0x51, 0x25, 0xc0, 0x31, 0x52, 0x9d, 0x9a, 0x9c, 0x8b, 0x3f, 0x99, 0xac, 0x9a, 0x9c,
+	0x6f, 0xa2, 0x78, 0x55, 0x52, 0x74, 0xa2, 0x96, 0xa8, 0x43, 0xa7, 0x63, 0xa5, 0x65, 0xa4, 0x74,
+	0x31, 0x61, 0x25, 0x20, 0x25, 0x31, 0x66, 0x6b, 0x5a, 0x65, 0x29, 0xc0, 0x69, 0x2c, 0x55, 0x29,
+	0x35, 0x67, 0x9d, 0x9a, 0x99, 0xbc, 0x98, 0xad, 0x9b, 0x7c, 0x9d, 0x9b, 0x6f, 0xa2, 0x67, 0x0d,
+	0x60, 0xa1, 0x97, 0xad, 0x21, 0xa8, 0x54, 0x96, 0xbe, 0x95, 0xde, 0xa1, 0x69, 0x6f, 0x5a, 0xc1,
+	0x6b, 0xc4, 0x1d, 0xc1, 0x04, 0xa4, 0x94, 0xfe, 0xa3, 0x25, 0x29, 0xa0, 0x95, 0x9f, 0x96, 0xa2,
+	0x75, 0xa6, 0x32, 0xa5, 0x54, 0xa4, 0x45, 0x23, 0x69, 0xca, 0x6e, 0xc1, 0x1c, 0xcb, 0x23, 0x25,
+	0x9a, 0xdd, 0x98, 0xef, 0x73, 0xa0, 0x7a, 0xa0, 0x7a, 0x9e, 0x7b, 0xfe, 0x69, 0xe1, 0xfe, 0x39,
+	0x02, 0xa1, 0x69, 0xa2, 0x67, 0x1d, 0xc0, 0xa4, 0x66, 0xfe, 0x9c, 0xd2, 0xfe, 0xf7, 0xbe, 0xa2,
+	0x77, 0xfd, 0xfd, 0xf1, 0x66, 0x93, 0xfe, 0xfe, 0x62, 0xeb, 0x92, 0xef, 0x7f, 0xa6, 0x55, 0x35,
+	0x0c, 0xa2, 0x77, 0x2c, 0x9b, 0xaa, 0xfe, 0x94, 0x71, 0x19, 0xa7, 0x45, 0xad, 0x21, 0x56, 0x51,
+	0x19, 0x66, 0x05, 0x51, 0x93, 0xee, 0x9a, 0xcb, 0xb0, 0x01, 0xfe, 0xde, 0xdb, 0xa9, 0x33, 0xc8,
+	0x1d, 0x31, 0xc0, 0xfe, 0xbd, 0xd7, 0xfe, 0x5a, 0xcb, 0x99, 0xbb, 0xaa, 0x33, 0xa9, 0x34, 0x14,
+	0xc0, 0x19, 0x11, 0x14, 0xc4, 0x19, 0x14, 0x05, 0x19, 0xc0, 0x9d, 0xaa, 0xc0, 0x19, 0x98, 0xcc,
+	0x97, 0xdd, 0xa2, 0x77, 0xa9, 0x33, 0x19, 0x05, 0x14, 0xa2, 0x77, 0x1c, 0x98, 0xcc, 0x09, 0xfe,
+	0xd6, 0x9a, 0x31, 0x2c, 0xc0, 0x31, 0xc0, 0x2c, 0x31, 0xc2, 0x2c, 0xc1, 0x31, 0xc1, 0x99, 0xcc,
+	0xfe, 0x6b, 0x4d, 0xfe, 0x18, 0xe3, 0xfe, 0x7b, 0xcf, 0xfe, 0xef, 0x7d, 0x31, 0xcc, 0x66, 0xc0,
+	0x31, 0xc0, 0x56, 0x2c, 0x31, 0xc2, 0x51, 0xa2, 0x76, 0xc0, 0x55, 0x66, 0x31, 0x2a, 0xc0, 0x66,
+	0x61, 0x9b, 0xbb, 0x98, 0xcc, 0x96, 0xdd, 0x97, 0xcd, 0x34, 0x9d, 0xa9, 0x9d, 0x99, 0x51, 0x66,
+	0xc0, 0x1d, 0x6f, 0x7a, 0xc0, 0x1d, 0x18, 0x1d, 0x31, 0x1d, 0x24, 0x10, 0xa7, 0x55, 0xfe, 0xad,
+	0x55, 0xfe, 0xff, 0xff, 0x25, 0x16, 0x31, 0x66, 0x99, 0xcc, 0xfe, 0x9c, 0x94, 0xfe, 0x31, 0x66,
+	0x9c, 0xa9, 0xa3, 0x77, 0x65, 0x0b, 0x7d, 0xa3, 0x95, 0xaa, 0x41, 0xa8, 0x52, 0xa5, 0x64, 0x7e,
+	0x54, 0x56, 0xa0, 0x9a, 0x6f, 0xc0, 0x5a, 0x9d, 0x9b, 0x9c, 0xaa, 0x51, 0x9c, 0xaa, 0x51, 0xa3,
+	0x76, 0xa6, 0x54, 0xa3, 0x77, 0xa2, 0x77, 0x65, 0xa0, 0xa8, 0x69, 0x69, 0xc0, 0x22, 0x47, 0x9b,
+	0x9c, 0x97, 0xbf, 0x97, 0xbe, 0x52, 0xa2, 0x78, 0x65, 0xa5, 0x81, 0xa8, 0x52, 0xa9, 0x43, 0xa4,
+	0x66, 0x29, 0x55, 0x66, 0x7e, 0x29, 0x6f, 0x52, 0x05, 0x52, 0x9b, 0xab, 0x42, 0xa2, 0x77, 0xa3,
+	0x76, 0xa3, 0x65, 0xa3, 0x87, 0xa3, 0x66, 0x65, 0x35, 0x66, 0xc0, 0x7e, 0x51, 0x9d, 0x7b, 0x96,
+	0xbf, 0x96, 0xce, 0x57, 0x5f, 0x66, 0xc0, 0x11, 0x0c, 0xa8, 0x44, 0xac, 0x23, 0x93, 0xdf, 0x98,
+	0xbc, 0xa3, 0x67, 0x56, 0xc1, 0x6b, 0xc4, 0x1d, 0xc1, 0x74, 0xa0, 0xa6, 0xa6, 0x84, 0xfe, 0xb3,
+	0x86, 0xa5, 0x73, 0xa0, 0x95, 0xa0, 0x95, 0xa2, 0x66, 0xa7, 0x32, 0xa6, 0x33, 0xa2, 0x66, 0x69,
+	0x6d, 0xc9, 0x6e, 0xc1, 0x1c, 0xcc, 0x23, 0x9c, 0xcd, 0x97, 0xff, 0x39, 0xa0, 0x8a, 0xa1, 0x79,
+	0x35, 0xfe, 0x8a, 0xa4, 0x0c, 0xa0, 0x6a, 0xa1, 0x79, 0x59, 0xc0, 0x6f, 0xb0, 0x10, 0xfe, 0xe7,
+	0x3c, 0x31, 0xfd, 0xfd, 0xf0, 0x9c, 0xaa, 0xfe, 0xb5, 0x96, 0xfe, 0x62, 0xeb, 0x94, 0xee, 0x56,
+	0xab, 0x32, 0xfe, 0xb5, 0x75, 0xfe, 0xf7, 0xbe, 0x31, 0x65, 0x9a, 0xbc, 0xfe, 0x8c, 0x50, 0xfe,
+	0x42, 0x07, 0xa6, 0x56, 0xab, 0x32, 0xa2, 0x67, 0xc1, 0x66, 0x19, 0x9a, 0xbb, 0x97, 0xdc, 0x29,
+	0xb1, 0x00, 0xfe, 0xce, 0x79, 0xab, 0x33, 0x31, 0x25, 0x31, 0xc5, 0x51, 0x31, 0x09, 0xfe, 0xa5,
+	0x34, 0xfe, 0x52, 0x8a, 0x34, 0xa9, 0x33, 0xa6, 0x55, 0x14, 0xc2, 0x5a, 0x14, 0xca, 0x51, 0x99,
+	0xbb, 0x34, 0xa3, 0x66, 0xa9, 0x44, 0x14, 0x05, 0x19, 0x9c, 0xaa, 0x08, 0x55, 0x05, 0xfe, 0xd6,
+	0xba, 0xa9, 0x44, 0x1d, 0xa2, 0x77, 0xc3, 0x2c, 0x31, 0xc4, 0x2c, 0x31, 0xc0, 0x1d, 0xfe, 0x9c,
+	0xd3, 0xfe, 0x21, 0x24, 0x09, 0xfe, 0xef, 0x5d, 0x2c, 0x31, 0xc9, 0x2c, 0x31, 0xc0, 0x2c, 0x56,
+	0x6e, 0x2c, 0x66, 0x40, 0x9c, 0xaa, 0x66, 0xa3, 0x76, 0xa3, 0x66, 0x5f, 0x7e, 0x2a, 0x25, 0x9d,
+	0x99, 0x9b, 0xbb, 0x9b, 0xba, 0x99, 0xcc, 0x96, 0xdd, 0x96, 0xdd, 0x98, 0xcc, 0x9b, 0xbb, 0x50,
+	0xa3, 0x57, 0xc3, 0x6f, 0x7a, 0x56, 0x1d, 0x2c, 0xc2, 0x59, 0x9d, 0xaa, 0xa4, 0x67, 0x2c, 0x9d,
+	0x9a, 0xfe, 0x83, 0xef, 0xfe, 0xf7, 0x7d, 0x25, 0x31, 0xc0, 0x66, 0x56, 0x9b, 0xab, 0xfe, 0x83,
+	0xf0, 0xfe, 0x39, 0x86, 0x50, 0x9d, 0xb9, 0xa2, 0x85, 0xa8, 0x72, 0xa9, 0x61, 0xa6, 0x73, 0x7d,
+	0x65, 0x5e, 0x5f, 0x47, 0x9f, 0x8b, 0x9b, 0xad, 0x9a, 0xab, 0x9b, 0xab, 0x9d, 0x99, 0x9c, 0xab,
+	0x56, 0xc0, 0x08, 0xc0, 0x66, 0x7e, 0xa6, 0x54, 0xa5, 0x85, 0xa4, 0x75, 0xa5, 0x73, 0xa4, 0x64,
+	0x7c, 0x56, 0x5f, 0xa1, 0x69, 0x9c, 0x9c, 0xfe, 0x82, 0x83, 0xfe, 0x51, 0x20, 0x7b, 0xa6, 0x65,
+	0xfe, 0xbb, 0x85, 0xa6, 0x51, 0x7f, 0x5a, 0x6b, 0x56, 0x52, 0x9d, 0x9b, 0x9a, 0xab, 0x9c, 0xab,
+	0x9b, 0xac, 0x0b, 0x03, 0x08, 0x5b, 0xc0, 0x69, 0x08, 0xa3, 0x76, 0xa4, 0x75, 0xa7, 0x53, 0xa5,
+	0x75, 0xa4, 0x75, 0x79, 0x7a, 0x69, 0xa2, 0x58, 0x0a, 0x96, 0xcf, 0x97, 0xbe, 0x9c, 0x8c, 0x6f,
+	0xa2, 0x78, 0xc0, 0x56, 0x65, 0xaa, 0x33, 0xa4, 0x56, 0x96, 0xdd, 0x9c, 0x9b, 0x6f, 0xc1, 0x6b,
+	0xc4, 0x1d, 0xc1, 0x7a, 0x75, 0xa0, 0xa6, 0xaa, 0x51, 0xfe, 0xcb, 0xe7, 0xa3, 0x83, 0x9f, 0x96,
+	0x68, 0xa5, 0x44, 0xa7, 0x32, 0xa4, 0x44, 0x6e, 0x6d, 0xc0, 0x69, 0xc7, 0x6e, 0xc1, 0x1c, 0xcc,
+	0x23, 0x20, 0x33, 0x98, 0xef, 0x07, 0xa0, 0x8a, 0xa2, 0x59, 0x28, 0xfe, 0x59, 0x82, 0x9c, 0x8c,
+	0xa2, 0x58, 0x5f, 0xc0, 0x1d, 0xa9, 0x44, 0xfe, 0xc6, 0x17, 0xaf, 0x01, 0xfd, 0xfd, 0xef, 0x9c,
+	0xaa, 0xfe, 0xad, 0x75, 0xfe, 0x5a, 0xcb, 0x96, 0xdd, 0xc0, 0xab, 0x22, 0xfe, 0xbd, 0xd6, 0xaf,
+	0x01, 0x7a, 0x2c, 0x98, 0xcb, 0xfe, 0x84, 0x30, 0x92, 0xff, 0xa7, 0x54, 0xa6, 0x55, 0x05, 0x7e,
+	0x05, 0x66, 0x0d, 0x9c, 0xaa, 0x94, 0xef, 0x9c, 0x99, 0xb0, 0x00, 0xfe, 0xd6, 0x99, 0xaa, 0x33,
+	0xc0, 0x2c, 0x31, 0xc7, 0x30, 0xfe, 0x9c, 0xf3, 0xfe, 0x52, 0x8a, 0x34, 0xab, 0x22, 0xa5, 0x56,
+	0x7a, 0x6e, 0x14, 0xc0, 0x19, 0x11, 0x14, 0xc9, 0x1d, 0x98, 0xcc, 0x34, 0xa8, 0x44, 0x00, 0x14,
+	0x19, 0x05, 0x04, 0x34, 0x21, 0x29, 0xaf, 0x11, 0x31, 0x51, 0x2c, 0xc1, 0x31, 0xc7, 0x2c, 0x31,
+	0xc0, 0x2c, 0x31, 0xfe, 0xbd, 0xf7, 0xfe, 0x42, 0x08, 0xac, 0x22, 0x04, 0x31, 0xcb, 0x2c, 0xc0,
+	0x31, 0x2c, 0x9d, 0x9a, 0x9a, 0xbb, 0x9c, 0xa9, 0x9b, 0xbb, 0xa2, 0x77, 0xa8, 0x44, 0xa6, 0x65,
+	0x6e, 0x1d, 0x9c, 0xaa, 0x9c, 0xaa, 0x97, 0xdc, 0x95, 0xed, 0x97, 0xdd, 0x99, 0xbb, 0x9d, 0x99,
+	0x9d, 0xaa, 0x56, 0xc0, 0x25, 0x6e, 0x67, 0x1d, 0xc0, 0x2c, 0xc0, 0x24, 0x1d, 0x24, 0x2c, 0xc1,
+	0x5a, 0x1d, 0xa3, 0x66, 0x9c, 0xbb, 0x2c, 0xc0, 0x18, 0xad, 0x21, 0xfe, 0xce, 0x17, 0xae, 0x01,
+	0x6f, 0x66, 0x56, 0x31, 0xc0, 0x30, 0xfe, 0x52, 0x89, 0x96, 0xec, 0xa2, 0x95, 0xaa, 0x51, 0xa8,
+	0x61, 0xa3, 0x95, 0xa0, 0xa6, 0x7f, 0x42, 0x43, 0x9c, 0x8b, 0x9a, 0xad, 0x2b, 0x5b, 0x6e, 0xa2,
+	0x68, 0xa3, 0x77, 0xa6, 0x45, 0xa3, 0x76, 0x6b, 0x7e, 0xc0, 0x9d, 0xa9, 0x9a, 0xbb, 0x9a, 0xbb,
+	0x61, 0xa0, 0xa7, 0xa5, 0x63, 0xa9, 0x50, 0xa6, 0x63, 0xa3, 0x74, 0x6f, 0x55, 0x27, 0x12, 0x95,
+	0xff, 0x52, 0xa9, 0x45, 0xa4, 0x62, 0xa2, 0x65, 0x27, 0x42, 0x9d, 0x9a, 0x9a, 0xad, 0x9a, 0xab,
+	0x9b, 0xac, 0x57, 0x6f, 0xa3, 0x68, 0xa4, 0x56, 0x28, 0xa4, 0x66, 0x6f, 0x69, 0x51, 0x9b, 0xbb,
+	0x9b, 0xb9, 0x9d, 0xa9, 0x9d, 0xb8, 0xa2, 0x96, 0xa7, 0x53, 0xa8, 0x53, 0xa4, 0x75, 0xa2, 0x86,
+	0x69, 0x6f, 0x17, 0xfe, 0x8a, 0xa2, 0xfe, 0x51, 0x60, 0x43, 0x5b, 0x5b, 0x6f, 0x7e, 0x20, 0xa5,
+	0x54, 0x65, 0x9c, 0xab, 0x5b, 0xc1, 0x6b, 0xc4, 0x1d, 0xc2, 0x66, 0x9f, 0xa6, 0xa4, 0xa5, 0xfe,
+	0xa3, 0x05, 0xa8, 0x72, 0xa1, 0x84, 0x7c, 0x6c, 0xa5, 0x44, 0x16, 0xa3, 0x55, 0xc0, 0x23, 0x69,
+	0xc7, 0x6e, 0xc1, 0x1c, 0xcb, 0x21, 0x56, 0x25, 0x9b, 0xdd, 0xfe, 0xe4, 0x60, 0x63, 0xa0, 0x8a,
+	0xa0, 0x7a, 0x9f, 0x6c, 0xfe, 0x72, 0x23, 0x98, 0xae, 0xa0, 0x6a, 0xa2, 0x58, 0xc0, 0x1d, 0xa4,
+	0x66, 0xfe, 0x94, 0x71, 0xfe, 0xf7, 0x9d, 0xa3, 0x67, 0xfd, 0xfd, 0xed, 0x51, 0x38, 0x08, 0x29,
+	0x7f, 0xac, 0x22, 0xfe, 0xc6, 0x18, 0x1d, 0x31, 0x65, 0x99, 0xbc, 0xfe, 0x73, 0x8d, 0x95, 0xde,
+	0xa5, 0x66, 0xaa, 0x22, 0xa3, 0x77, 0x65, 0x56, 0x19, 0xc0, 0x9b, 0xbb, 0x95, 0xdd, 0x9b, 0xaa,
+	0x11, 0x21, 0x1d, 0xc0, 0x7f, 0x31, 0xc0, 0x2c, 0x31, 0xc4, 0x9b, 0xbb, 0x05, 0xfe, 0x4a, 0x49,
+	0xa5, 0x55, 0xa9, 0x44, 0xa2, 0x77, 0xc0, 0x5a, 0x19, 0xc2, 0x11, 0x19, 0xc5, 0x14, 0xc1, 0x97,
+	0xcc, 0x25, 0xa4, 0x66, 0xa9, 0x44, 0x00, 0x14, 0x19, 0x05, 0x30, 0x34, 0xaa, 0x33, 0xfe, 0xce,
+	0x79, 0x1d, 0x7f, 0xc1, 0x31, 0x2c, 0xc0, 0x31, 0xca, 0x1d, 0x31, 0x95, 0xee, 0xfe, 0x52, 0x8a,
+	0x18, 0x09, 0x31, 0x2c, 0x31, 0xc9, 0x2c, 0x31, 0x2c, 0x96, 0xdd, 0xfe, 0x94, 0x92, 0xc0, 0xa9,
+	0x34, 0xa8, 0x54, 0xa5, 0x55, 0xa3, 0x76, 0x66, 0x9d, 0x99, 0xfe, 0xa5, 0x35, 0x95, 0xed, 0x98,
+	0xdb, 0x99, 0xcb, 0x9b, 0xba, 0x5a, 0xc0, 0x5f, 0xc1, 0x5a, 0x22, 0x6e, 0x22, 0x7b, 0x24, 0x65,
+	0x6e, 0x2c, 0xc1, 0x6e, 0x24, 0x18, 0x24, 0x2c, 0x18, 0x2c, 0x18, 0x65, 0xa2, 0x77, 0xa2, 0x77,
+	0xfe, 0x8c, 0x0f, 0xfe, 0xe7, 0x1b, 0xa6, 0x56, 0xc0, 0x6e, 0x56, 0x52, 0x93, 0xfe, 0xfe, 0x41,
+	0xc6, 0x9c, 0xb8, 0xa7, 0x72, 0xfe, 0xab, 0xe6, 0xa4, 0x94, 0x74, 0x7a, 0x57, 0x98, 0xbe, 0xfe,
+	0x82, 0x02, 0x9b, 0x9d, 0x9d, 0x8c, 0xa3, 0x47, 0xac, 0x12, 0xae, 0x11, 0xa9, 0x33, 0xa4, 0x66,
+	0xa4, 0x57, 0x38, 0x6f, 0xc0, 0x38, 0x61, 0x9d, 0x99, 0x08, 0x96, 0xee, 0xfe, 0x6a, 0x8a, 0x94,
+	0xfb, 0xa3, 0x84, 0xa9, 0x50, 0xa9, 0x51, 0xa7, 0x63, 0x64, 0x66, 0x62, 0x52, 0xa0, 0x8a, 0xa2,
+	0x77, 0x4e, 0xa2, 0x57, 0x9c, 0xab, 0x97, 0xbe, 0x99, 0xbc, 0x9c, 0x8c, 0x42, 0xaa, 0x24, 0xae,
+	0x02, 0xab, 0x23, 0xa4, 0x67, 0xa5, 0x56, 0xa3, 0x67, 0xa2, 0x87, 0x69, 0x52, 0x6e, 0x9d, 0xa9,
+	0x9b, 0xba, 0x9a, 0xcb, 0xfe, 0x8b, 0x8b, 0xfe, 0x59, 0xc2, 0x9b, 0xcb, 0xa6, 0x62, 0xa9, 0x52,
+	0xa7, 0x53, 0xa3, 0x85, 0x64, 0xa2, 0x68, 0x9d, 0x8d, 0xfe, 0x82, 0x63, 0x96, 0xbf, 0xa0, 0x6a,
+	0x20, 0x5a, 0x6f, 0x79, 0x65, 0x69, 0x19, 0x1d, 0xc1, 0x6b, 0xc4, 0x1d, 0xc1, 0x29, 0x56, 0x20,
+	0x07, 0xa4, 0x94, 0xfe, 0xc3, 0xa6, 0xa3, 0x94, 0xa3, 0x74, 0x9e, 0x86, 0xa3, 0x65, 0xa8, 0x22,
+	0xa5, 0x33, 0x5e, 0x69, 0x7d, 0xc7, 0x6e, 0xc1, 0x1c, 0xcb, 0x21, 0x5a, 0x77, 0x9d, 0xbc, 0xfe,
+	0xec, 0xc0, 0x9c, 0xbd, 0x77, 0x9e, 0x8c, 0xa5, 0x48, 0xfe, 0x92, 0xc4, 0xfe, 0x49, 0x41, 0x9f,
+	0x6a, 0x29, 0x56, 0x29, 0xc0, 0xaf, 0x10, 0x38, 0x31, 0xfd, 0xfd, 0xe5, 0x2c, 0x31, 0xc1, 0x2c,
+	0xc0, 0x31, 0x51, 0xfe, 0xad, 0x55, 0xfe, 0x42, 0x28, 0x99, 0xcc, 0xa3, 0x66, 0xfe, 0x84, 0x0f,
+	0xfe, 0xef, 0x5c, 0x31, 0xc1, 0x95, 0xee, 0xfe, 0x6b, 0x6d, 0xfe, 0x31, 0x86, 0xac, 0x22, 0xaa,
+	0x22, 0x7f, 0xc2, 0x66, 0x55, 0x96, 0xdd, 0x29, 0xae, 0x11, 0xfe, 0xe7, 0x5c, 0x31, 0xc5, 0x2c,
+	0x1d, 0xc0, 0x31, 0x2c, 0x04, 0xfe, 0x6b, 0x4d, 0x95, 0xdd, 0xa7, 0x55, 0x05, 0xc0, 0x14, 0xc1,
+	0x19, 0xc1, 0x14, 0x19, 0x05, 0x19, 0x6f, 0x14, 0x5a, 0x0a, 0x05, 0x14, 0x05, 0x1c, 0x38, 0x1c,
+	0x05, 0x14, 0xc0, 0x19, 0x14, 0x92, 0xff, 0x99, 0xbb, 0xfe, 0x7b, 0xef, 0xfe, 0xe7, 0x1c, 0x1d,
+	0xa2, 0x77, 0xd0, 0x1d, 0x31, 0xc0, 0x9c, 0xaa, 0x08, 0x05, 0xfe, 0xf7, 0x9e, 0x2c, 0x31, 0xc3,
+	0x2c, 0x1d, 0x31, 0x2c, 0xc0, 0x31, 0xc1, 0x30, 0xfe, 0x7b, 0xcf, 0x95, 0xde, 0xb0, 0x00, 0xfe,
+	0xde, 0xdb, 0x18, 0xa2, 0x77, 0x65, 0x98, 0xdc, 0xfe, 0x9c, 0x71, 0xfe, 0x52, 0x27, 0x99, 0xcb,
+	0x7e, 0x64, 0x61, 0xa2, 0x77, 0x6e, 0xa1, 0x69, 0x12, 0xa1, 0x79, 0x5e, 0x56, 0x61, 0xa2, 0x77,
+	0x6b, 0xc0, 0x66, 0xc4, 0x29, 0x24, 0xc1, 0x29, 0x24, 0xc0, 0x79, 0xc2, 0xa4, 0x66, 0xfe, 0x8c,
+	0x0f, 0xfe, 0xef, 0x3c, 0x2c, 0x18, 0x9d, 0x99, 0x95, 0xee, 0xfe, 0x39, 0xc7, 0x9d, 0xb8, 0x9d,
+	0xb7, 0xfe, 0x7a, 0x83, 0xfe, 0xc4, 0x47, 0x74, 0xc0, 0x9d, 0xaa, 0xfe, 0x8a, 0x82, 0x97, 0xbf,
+	0x9d, 0x8c, 0xa6, 0x47, 0xad, 0x13, 0xfe, 0xe6, 0xda, 0xa5, 0x55, 0xa3, 0x67, 0x6e, 0x25, 0xc0,
+	0x31, 0xc1, 0x2a, 0x25, 0xc1, 0x2c, 0x9c, 0xaa, 0xfe, 0x8c, 0x30, 0xfe, 0x49, 0xe5, 0x9b, 0xc8,
+	0x32, 0xfe, 0xc3, 0xc5, 0xa3, 0x83, 0x75, 0xa1, 0x97, 0x5b, 0x9d, 0x9b, 0xa1, 0x79, 0xa5, 0x28,
+	0x96, 0xbf, 0x92, 0xef, 0x00, 0xa2, 0x67, 0xac, 0x03, 0xfe, 0xad, 0x12, 0xfe, 0xef, 0x5c, 0xa2,
+	0x67, 0xa2, 0x78, 0x6e, 0xc1, 0x31, 0x25, 0x6b, 0x31, 0xc0, 0x2c, 0x25, 0x60, 0x94, 0xfd, 0xfe,
+	0x7b, 0x08, 0xfe, 0x49, 0x40, 0x7e, 0x36, 0x13, 0x1a, 0x5b, 0x57, 0x9c, 0x8c, 0xfe, 0x72, 0x23,
+	0xfe, 0x30, 0xa0, 0xa3, 0x48, 0xa3, 0x57, 0x56, 0x29, 0x64, 0x75, 0xa2, 0x68, 0x24, 0xca, 0x29,
+	0x4e, 0x22, 0x9f, 0xb7, 0x9f, 0xc7, 0xa8, 0x72, 0xfe, 0xdc, 0x27, 0x9f, 0xa6, 0xa1, 0x74, 0xa2,
+	0x65, 0xa3, 0x55, 0xab, 0x00, 0x55, 0xa2, 0x65, 0x7d, 0xc1, 0x6e, 0xc0, 0x1c, 0xc2, 0x21, 0xc1,
+	0x1c, 0xcb, 0x21, 0x5a, 0x77, 0x67, 0xfe, 0xf5, 0x21, 0x99, 0xde, 0x9f, 0xab, 0x10, 0xa2, 0x59,
+	0x98, 0xae, 0xfe, 0x59, 0x60, 0x15, 0x47, 0x29, 0x7e, 0x29, 0xa6, 0x65, 0xfe, 0xbd, 0xd7, 0xfe,
+	0xff, 0xff, 0xfd, 0xfd, 0xe9, 0x66, 0xc0, 0x9d, 0x99, 0xfe, 0xad, 0x75, 0xfe, 0x63, 0x0c, 0x91,
+	0xff, 0xa2, 0x77, 0xfe, 0x7b, 0xcf, 0xfe, 0xd6, 0x9a, 0xa9, 0x33, 0x6e, 0x7b, 0x95, 0xdd, 0xfe,
+	0x7b, 0xef, 0xfe, 0x31, 0xa6, 0xab, 0x32, 0xa8, 0x44, 0xa4, 0x66, 0x52, 0x55, 0xc1, 0xa2, 0x77,
+	0x30, 0x94, 0xee, 0x30, 0xfe, 0xbd, 0xf7, 0x2c, 0x6e, 0xc6, 0x1d, 0x2c, 0xc0, 0x94, 0xee, 0xfe,
+	0x6b, 0x6d, 0x95, 0xee, 0xa9, 0x33, 0x05, 0x14, 0x05, 0x14, 0x19, 0xc5, 0x7f, 0x41, 0x05, 0x14,
+	0xc2, 0x9b, 0xaa, 0x97, 0xdd, 0x65, 0x35, 0x05, 0x14, 0x05, 0x19, 0x9b, 0xbb, 0x08, 0x9d, 0x99,
+	0x14, 0xfe, 0xde, 0xfb, 0xa5, 0x66, 0x31, 0xd1, 0x66, 0x31, 0xc0, 0x9c, 0xaa, 0xfe, 0x52, 0xaa,
+	0xb1, 0x00, 0xfe, 0xf7, 0xbe, 0x31, 0xc3, 0x2c, 0x31, 0xc0, 0x1d, 0xc0, 0x31, 0x1d, 0x97, 0xdd,
+	0x14, 0x98, 0xcc, 0xa7, 0x45, 0xad, 0x21, 0xab, 0x22, 0x18, 0x9a, 0xbb, 0x93, 0xfe, 0x94, 0xfe,
+	0x96, 0xdc, 0x98, 0xdc, 0x9d, 0xa8, 0xa5, 0x73, 0xa6, 0x64, 0xa4, 0x76, 0x7e, 0x6f, 0xc0, 0xa1,
+	0x59, 0x96, 0xcf, 0x9b, 0x9b, 0x47, 0x15, 0x7f, 0xa2, 0x66, 0x66, 0x24, 0xcc, 0x79, 0xc2, 0x56,
+	0xa2, 0x77, 0xa9, 0x33, 0xa6, 0x65, 0xa2, 0x67, 0x9c, 0xa9, 0x97, 0xdd, 0x9a, 0xbb, 0x21, 0xa0,
+	0xa6, 0xfe, 0x8a, 0xe4, 0xac, 0x31, 0x9d, 0xb9, 0x9b, 0x9b, 0x96, 0xce, 0x99, 0xae, 0xa5, 0x47,
+	0xfe, 0x8c, 0x0f, 0xae, 0x02, 0xac, 0x22, 0xa2, 0x76, 0xa2, 0x76, 0x2a, 0xc2, 0x31, 0xc1, 0x2a,
+	0xc2, 0x09, 0xa4, 0x56, 0x9b, 0xab, 0xfe, 0xad, 0x95, 0xfe, 0x62, 0xe9, 0xfe, 0x41, 0x20, 0xa7,
+	0x82, 0xfe, 0xc3, 0x83, 0xa5, 0x74, 0x61, 0x15, 0xa1, 0x79, 0x9c, 0x8b, 0xfe, 0x8a, 0xa4, 0xfe,
+	0x51, 0x83, 0x56, 0xad, 0x12, 0xfe, 0xb5, 0x13, 0xab, 0x12, 0xa7, 0x46, 0xa3, 0x67, 0x6e, 0x6e,
+	0xc2, 0x2a, 0x66, 0x6b, 0x31, 0xc2, 0x29, 0x64, 0xfe, 0xd6, 0x36, 0xfe, 0x8b, 0xec, 0xfe, 0x51,
+	0xe3, 0x65, 0xfe, 0x92, 0xe2, 0xa9, 0x70, 0xa5, 0x56, 0x52, 0x43, 0x99, 0xae, 0xfe, 0x51, 0x41,
+	0x9f, 0x5b, 0xa2, 0x68, 0x46, 0x7a, 0x7d, 0x14, 0x20, 0x24, 0xca, 0x5e, 0x5a, 0x1f, 0xa0, 0xa7,
+	0x9d, 0xd8, 0xa5, 0x84, 0xac, 0x50, 0xfe, 0xe4, 0x66, 0x9d, 0xa7, 0xa2, 0x74, 0xa2, 0x66, 0xa8,
+	0x21, 0xa4, 0x55, 0xa2, 0x65, 0x6d, 0xc1, 0x6e, 0xc0, 0x1c, 0xc2, 0x21, 0xc1, 0x1c, 0xcb, 0x21,
+	0x5a, 0x1c, 0x9f, 0x9b, 0x9a, 0xed, 0x98, 0xef, 0x63, 0x9f, 0x8b, 0xa0, 0x8a, 0x9c, 0x7c, 0xfe,
+	0x69, 0xe0, 0x9b, 0x8e, 0x14, 0x24, 0x6e, 0xc0, 0xa2, 0x77, 0xfe, 0x9c, 0xd3, 0xfe, 0xf7, 0xbe,
+	0x31, 0xfd, 0xfd, 0xe5, 0x66, 0xc0, 0x31, 0x2c, 0x1d, 0xfe, 0xad, 0x75, 0xfe, 0x5a, 0xeb, 0x92,
+	0xff, 0xa3, 0x77, 0xfe, 0x7b, 0xcf, 0xfe, 0xd6, 0xba, 0xa9, 0x33, 0x31, 0x1d, 0x97, 0xcc, 0xfe,
+	0x6b, 0x8d, 0x92, 0xff, 0xa5, 0x66, 0xad, 0x11, 0xa3, 0x77, 0xc0, 0x51, 0x6e, 0x19, 0x05, 0x99,
+	0xcb, 0x94, 0xef, 0xa7, 0x44, 0xfe, 0xbd, 0xf7, 0xaf, 0x10, 0xc0, 0x31, 0xc5, 0x66, 0x1d, 0x2c,
+	0x93, 0xee, 0xfe, 0x73, 0x8e, 0x94, 0xee, 0xaa, 0x33, 0xa6, 0x55, 0xa2, 0x77, 0xc1, 0x19, 0xc6,
+	0x56, 0x19, 0x14, 0x05, 0x19, 0x05, 0x9a, 0xbb, 0x97, 0xdd, 0x39, 0x09, 0x05, 0x19, 0x14, 0x05,
+	0x04, 0x39, 0xa3, 0x77, 0x3c, 0xfe, 0xe7, 0x3c, 0x31, 0x2c, 0x31, 0xd4, 0x9c, 0xaa, 0xfe, 0x63,
+	0x2c, 0xfe, 0xbd, 0xf7, 0x2c, 0x31, 0xc5, 0x2c, 0x1d, 0x2c, 0x9a, 0xbb, 0xfe, 0xa5, 0x14, 0x04,
+	0x6e, 0xaa, 0x33, 0xfe, 0xde, 0xfc, 0xa7, 0x44, 0x97, 0xdc, 0x93, 0xfe, 0x93, 0xff, 0x96, 0xdc,
+	0x99, 0xcb, 0x9d, 0xba, 0xa4, 0x65, 0xa8, 0x52, 0xfe, 0xa3, 0x64, 0xa5, 0x74, 0xa3, 0x76, 0x2a,
+	0x66, 0xa0, 0x7a, 0x9f, 0x6a, 0xfe, 0x6a, 0x24, 0x98, 0xae, 0xa0, 0x7a, 0x5b, 0xa2, 0x77, 0x66,
+	0x59, 0xcb, 0x7a, 0xc0, 0x5d, 0xc2, 0x76, 0x56, 0xc0, 0x20, 0x79, 0x6e, 0x64, 0x6b, 0x65, 0xa3,
+	0x85, 0xae, 0x30, 0xa7, 0x54, 0x96, 0xde, 0x96, 0xbe, 0x47, 0xfe, 0x73, 0x4b, 0xfe, 0xad, 0x94,
+	0xad, 0x12, 0xa5, 0x56, 0x7e, 0x76, 0x6e, 0xc2, 0x31, 0xc5, 0x2a, 0x65, 0x6e, 0xa0, 0x7a, 0x41,
+	0x93, 0xff, 0xfe, 0x6a, 0xea, 0xfe, 0x49, 0x00, 0xaa, 0x60, 0xab, 0x50, 0xa3, 0x76, 0x5f, 0x9c,
+	0x8b, 0x95, 0xbf, 0x07, 0xa8, 0x36, 0xfe, 0x9c, 0x30, 0xfe, 0xd6, 0x38, 0xab, 0x23, 0xa2, 0x67,
+	0xc0, 0x5a, 0x2e, 0x31, 0xc0, 0x2a, 0x23, 0x1e, 0x25, 0xc0, 0x31, 0xc0, 0x2e, 0xc0, 0x29, 0x2e,
+	0x31, 0x98, 0xcb, 0xfe, 0x8c, 0x4f, 0xfe, 0x42, 0x05, 0x9d, 0xe6, 0xfe, 0xab, 0x02, 0xac, 0x21,
+	0x61, 0x66, 0x9e, 0x7b, 0xfe, 0x72, 0x23, 0x99, 0x9e, 0xa1, 0x59, 0x47, 0x7a, 0x7e, 0x19, 0x6b,
+	0x24, 0xca, 0x6e, 0x26, 0x69, 0x25, 0x60, 0xa1, 0xa5, 0xa6, 0x83, 0xfe, 0xd4, 0x27, 0xa0, 0x95,
+	0xa0, 0x95, 0xa2, 0x65, 0xa3, 0x55, 0xa9, 0x21, 0xa3, 0x55, 0xa2, 0x65, 0x65, 0xc6, 0x6e, 0xc1,
+	0x1c, 0xcb, 0x21, 0x5a, 0x1c, 0x6b, 0x9b, 0xde, 0x99, 0xee, 0x08, 0x67, 0xa0, 0x7a, 0x47, 0xfe,
+	0x82, 0x61, 0xfe, 0x49, 0x20, 0xa0, 0x5b, 0x5b, 0x6e, 0x29, 0x51, 0x0c, 0xfe, 0xe6, 0xfb, 0x31,
+	0xfd, 0xfd, 0xe4, 0x66, 0x31, 0xc0, 0x2c, 0x55, 0x94, 0xee, 0xfe, 0x5a, 0xcb, 0x38, 0xc0, 0xfe,
+	0x7b, 0xef, 0xfe, 0xde, 0xdb, 0x2c, 0x1d, 0xa2, 0x77, 0x98, 0xcc, 0xfe, 0x73, 0xce, 0x38, 0xa7,
+	0x44, 0xaf, 0x10, 0x56, 0x7f, 0x59, 0x05, 0xa2, 0x77, 0x14, 0x9b, 0xaa, 0xfe, 0x31, 0xa6, 0xa3,
+	0x76, 0xfe, 0xb5, 0x96, 0xfe, 0xf7, 0x9d, 0x31, 0xc6, 0x2c, 0xc0, 0x31, 0x95, 0xee, 0xfe, 0x6b,
+	0x6d, 0x95, 0xee, 0x09, 0x05, 0x14, 0xc0, 0x6e, 0x14, 0x05, 0x19, 0xc5, 0x14, 0x19, 0x14, 0x19,
+	0x0a, 0x35, 0x98, 0xcc, 0xa4, 0x66, 0xaa, 0x33, 0x14, 0x05, 0x14, 0xc0, 0x09, 0x20, 0xa4, 0x66,
+	0xfe, 0xa5, 0x34, 0xfe, 0xef, 0x7d, 0xa4, 0x66, 0x2c, 0x31, 0xc1, 0x2c, 0x31, 0xd1, 0x9d, 0xaa,
+	0xfe, 0x7b, 0xef, 0x1c, 0xa9, 0x33, 0xc1, 0x2c, 0x31, 0xc0, 0x2c, 0x31, 0x2c, 0x55, 0x94, 0xee,
+	0xfe, 0x73, 0x8e, 0x95, 0xdd, 0xac, 0x32, 0xfe, 0xce, 0x38, 0xab, 0x23, 0x9c, 0x9a, 0x15, 0xfe,
+	0x63, 0x0c, 0x97, 0xdc, 0x9c, 0xa9, 0x51, 0xa2, 0x86, 0xa6, 0x65, 0xa9, 0x43, 0xa8, 0x52, 0xa1,
+	0xa3, 0xa1, 0x95, 0x75, 0x65, 0x52, 0xa1, 0x79, 0x9c, 0x8d, 0xfe, 0x61, 0x81, 0x9c, 0x7c, 0xa2,
+	0x69, 0x57, 0xa2, 0x77, 0x22, 0x5e, 0xcb, 0x7a, 0xc0, 0x5d, 0xc1, 0x29, 0x24, 0x69, 0x7a, 0x65,
+	0x04, 0xa2, 0x75, 0x7a, 0xa2, 0x76, 0xc0, 0xaa, 0x43, 0xa9, 0x45, 0x99, 0xbb, 0xfe, 0x51, 0x62,
+	0xa2, 0x58, 0xfe, 0x8c, 0x0f, 0xfe, 0xd6, 0xba, 0xa9, 0x23, 0xc0, 0x6e, 0x7a, 0x31, 0xc2, 0x66,
+	0x31, 0xc6, 0x68, 0xc0, 0x27, 0x57, 0xc0, 0xfe, 0xbd, 0xb5, 0xfe, 0x5a, 0x26, 0x99, 0xf9, 0xac,
+	0x31, 0xac, 0x31, 0x9a, 0x9c, 0x94, 0xcf, 0x9b, 0x9c, 0xac, 0x24, 0xfe, 0xbd, 0x75, 0xae, 0x11,
+	0xa4, 0x56, 0x6b, 0xc1, 0x31, 0xc1, 0x2a, 0xc0, 0x69, 0x2a, 0xc1, 0x31, 0xc2, 0x2e, 0x66, 0xc0,
+	0x31, 0x98, 0xcc, 0xfe, 0x7b, 0xee, 0xfe, 0x49, 0x81, 0xa4, 0x94, 0xfe, 0xbb, 0xc6, 0xa4, 0x75,
+	0x75, 0x5b, 0x97, 0xbf, 0xfe, 0x49, 0x20, 0xa1, 0x5a, 0xa1, 0x59, 0x66, 0x7a, 0x69, 0xc0, 0x24,
+	0xca, 0x29, 0xc1, 0x22, 0x11, 0xa0, 0xa6, 0xa2, 0xa5, 0xfe, 0xa3, 0x24, 0xaa, 0x50, 0x9f, 0xa6,
+	0x6c, 0x55, 0xa8, 0x42, 0xa6, 0x22, 0xa4, 0x42, 0x66, 0xc6, 0x21, 0xc1, 0x1c, 0xcb, 0x21, 0x56,
+	0x1c, 0x67, 0x1b, 0x9a, 0xed, 0x99, 0xdf, 0x66, 0x57, 0xa1, 0x69, 0xfe, 0x9a, 0xe2, 0xfe, 0x51,
+	0x40, 0x9f, 0x6c, 0x4b, 0x29, 0x7e, 0x9b, 0xbb, 0xab, 0x22, 0xfe, 0xc6, 0x17, 0x2c, 0x6e, 0xfd,
+	0xfd, 0xe7, 0x96, 0xdd, 0xfe, 0x6b, 0x6d, 0x29, 0x7f, 0xfe, 0x7b, 0xef, 0xfe, 0xe7, 0x1c, 0xa7,
+	0x44, 0x2c, 0xc0, 0x99, 0xbb, 0xfe, 0x84, 0x50, 0xfe, 0x31, 0xa6, 0x34, 0xae, 0x00, 0x0a, 0xc2,
+	0x7f, 0xc0, 0x9b, 0xaa, 0x94, 0xee, 0x9c, 0xba, 0xfe, 0x94, 0x92, 0xfe, 0xf7, 0x9e, 0x2c, 0xc0,
+	0x31, 0xc7, 0x0d, 0xfe, 0x6b, 0x4d, 0x97, 0xcc, 0x04, 0xa7, 0x44, 0x66, 0xa2, 0x77, 0xc0, 0x19,
+	0xc0, 0x14, 0x19, 0xc6, 0x14, 0x19, 0x36, 0x97, 0xdd, 0x25, 0xa3, 0x77, 0xab, 0x22, 0x19, 0x14,
+	0x28, 0x05, 0x35, 0x29, 0x21, 0xfe, 0xb5, 0xb6, 0xae, 0x21, 0x2c, 0x55, 0xa2, 0x77, 0xc0, 0x2c,
+	0xc0, 0x31, 0xcf, 0x2c, 0x31, 0x2c, 0x9d, 0x99, 0xfe, 0x94, 0xb2, 0xfe, 0xef, 0x5d, 0x31, 0xc1,
+	0x2c, 0x31, 0xc2, 0x30, 0xfe, 0x9c, 0xf3, 0x08, 0x25, 0x01, 0x04, 0x55, 0x93, 0xff, 0xfe, 0x6b,
+	0x6d, 0x93, 0xff, 0x9b, 0xaa, 0x7e, 0x7e, 0x7e, 0xa4, 0x75, 0xa7, 0x54, 0xa7, 0x54, 0xa2, 0x85,
+	0x9d, 0xc6, 0x9f, 0xb7, 0xa2, 0x86, 0xa3, 0x86, 0x5b, 0xa2, 0x68, 0xfe, 0xa3, 0x25, 0x10, 0x47,
+	0xa1, 0x6a, 0x46, 0x27, 0xc0, 0x24, 0xcb, 0x27, 0xc0, 0x5d, 0xc0, 0x29, 0xc1, 0x1d, 0x20, 0xa0,
+	0xa7, 0x9f, 0x96, 0xa6, 0x63, 0xa8, 0x43, 0x75, 0xa5, 0x56, 0xa6, 0x56, 0x98, 0xbd, 0xfe, 0x39,
+	0x00, 0xa6, 0x47, 0xfe, 0x9c, 0x91, 0x35, 0xa6, 0x55, 0x41, 0x69, 0xa2, 0x77, 0xc0, 0x31, 0xcb,
+	0x64, 0x65, 0xa2, 0x68, 0x57, 0x2e, 0x9b, 0xcb, 0xfe, 0xac, 0xf2, 0xfe, 0x49, 0x62, 0xa3, 0x76,
+	0xac, 0x32, 0x95, 0xce, 0x9b, 0x9b, 0xfe, 0x63, 0x2a, 0xfe, 0xce, 0x58, 0xac, 0x22, 0x31, 0x61,
+	0x2c, 0x31, 0x2c, 0x31, 0xc1, 0x2a, 0xc3, 0x31, 0xc3, 0x29, 0x31, 0x51, 0x29, 0x31, 0x92, 0xff,
+	0xfe, 0x6a, 0xc8, 0xfe, 0x49, 0x20, 0xfe, 0x8a, 0xa3, 0xad, 0x40, 0x9f, 0xb6, 0x5b, 0x9d, 0x7b,
+	0xfe, 0x59, 0x60, 0x9e, 0x6b, 0xa3, 0x49, 0x9d, 0xab, 0xc0, 0x7e, 0x69, 0x5b, 0xca, 0x22, 0xc0,
+	0x66, 0xc1, 0x79, 0x0c, 0xa5, 0x83, 0xfe, 0xc3, 0xe6, 0xa3, 0x83, 0x78, 0x64, 0xa4, 0x54, 0xa8,
+	0x21, 0xa6, 0x21, 0xc3, 0x6e, 0x1c, 0xc1, 0x21, 0xc1, 0x1c, 0xce, 0x66, 0x9f, 0x9b, 0x9c, 0xcc,
+	0x98, 0xef, 0x62, 0x52, 0xa1, 0x69, 0x9a, 0x9e, 0xfe, 0x61, 0xa0, 0x9b, 0x8f, 0xa1, 0x69, 0x24,
+	0x6e, 0x51, 0x29, 0xfe, 0x94, 0xb2, 0xfe, 0xef, 0x7d, 0xa4, 0x66, 0xfd, 0xfd, 0xe5, 0x2c, 0x97,
+	0xcc, 0xfe, 0x7b, 0xef, 0xfe, 0x31, 0x86, 0xc0, 0xfe, 0x73, 0xae, 0xfe, 0xd6, 0x9a, 0xab, 0x22,
+	0xc1, 0x35, 0xfe, 0x84, 0x30, 0xfe, 0x39, 0xc7, 0xa3, 0x66, 0xad, 0x11, 0xa5, 0x66, 0x9d, 0xaa,
+	0x0a, 0xc0, 0x14, 0xa2, 0x66, 0x00, 0x97, 0xcc, 0x25, 0x19, 0x09, 0x31, 0xc1, 0x65, 0x31, 0xc3,
+	0x2c, 0x55, 0x95, 0xee, 0xfe, 0x6b, 0x4d, 0x0c, 0xab, 0x22, 0x28, 0x14, 0xc0, 0x05, 0xc1, 0x28,
+	0xc0, 0x14, 0x19, 0xc4, 0x05, 0x14, 0x9d, 0x99, 0x96, 0xdd, 0x9a, 0xbb, 0xa7, 0x45, 0x31, 0x14,
+	0x05, 0x14, 0xc0, 0x21, 0x11, 0xa7, 0x55, 0xfe, 0xbd, 0xf7, 0xb0, 0x00, 0xc0, 0x9d, 0xaa, 0xc0,
+	0x31, 0xc0, 0x2c, 0x31, 0xd0, 0x2c, 0x31, 0x1d, 0x18, 0xfe, 0xb5, 0x96, 0x2c, 0x31, 0xc1, 0x2c,
+	0x31, 0xc0, 0x2c, 0x95, 0xdd, 0xfe, 0x7b, 0xef, 0x92, 0xff, 0x1c, 0x38, 0x2c, 0x94, 0xed, 0x31,
+	0xfe, 0x42, 0x08, 0x9a, 0xaa, 0x7a, 0x29, 0x69, 0x65, 0x7a, 0xa2, 0x86, 0x7e, 0x65, 0x64, 0xa1,
+	0xa7, 0xa1, 0x97, 0xa7, 0x62, 0xab, 0x31, 0x7f, 0x5b, 0xfe, 0x8a, 0x83, 0xfe, 0x49, 0x20, 0xa2,
+	0x48, 0x19, 0x1d, 0x22, 0xc0, 0x6b, 0x66, 0xca, 0x27, 0xc0, 0x29, 0xc1, 0x5a, 0x29, 0x7a, 0x75,
+	0x74, 0xa4, 0x74, 0xfe, 0x9b, 0x66, 0xaa, 0x42, 0x60, 0x6b, 0x99, 0xad, 0xfe, 0x49, 0x81, 0x4b,
+	0xfe, 0x9c, 0xd0, 0xfe, 0xe7, 0x3b, 0xa4, 0x66, 0x66, 0x16, 0xa2, 0x78, 0x66, 0x66, 0x31, 0xcc,
+	0x61, 0x5e, 0x6b, 0xc0, 0x31, 0x99, 0xca, 0xfe, 0x6a, 0xc9, 0x93, 0xfd, 0xa5, 0x56, 0x9b, 0xab,
+	0xfe, 0x6b, 0x2b, 0xfe, 0xc6, 0x17, 0xae, 0x01, 0x6f, 0x55, 0x2e, 0x7a, 0xc0, 0x52, 0x31, 0xc5,
+	0x2e, 0x31, 0xc3, 0x51, 0x31, 0x20, 0x1d, 0x31, 0x9d, 0xaa, 0xfe, 0xa4, 0xd2, 0xfe, 0x41, 0x63,
+	0xa0, 0xb5, 0xfe, 0xbb, 0xa6, 0xa3, 0xa4, 0xa2, 0x67, 0x9e, 0x7a, 0xfe, 0x7a, 0x42, 0x97, 0xaf,
+	0xa1, 0x5b, 0x56, 0x67, 0xa2, 0x76, 0xc0, 0x5a, 0xca, 0x20, 0xc0, 0x5f, 0xc0, 0x5b, 0xa0, 0xa7,
+	0x9e, 0xb7, 0x08, 0xfe, 0x92, 0xa3, 0xfe, 0xdc, 0x25, 0x78, 0x68, 0x7d, 0xa7, 0x11, 0xa8, 0x10,
+	0xa2, 0x76, 0x6e, 0x1c, 0xc4, 0x21, 0xc1, 0x1c, 0xce, 0x66, 0xa0, 0x8a, 0x9d, 0xbc, 0x97, 0xff,
+	0x9d, 0xba, 0x57, 0x5b, 0x9e, 0x7d, 0xfe, 0x72, 0x22, 0xfe, 0x41, 0x02, 0x1b, 0x5e, 0xc0, 0xa2,
+	0x77, 0x9c, 0xab, 0xfe, 0x73, 0x8e, 0xfe, 0xe7, 0x1b, 0xa7, 0x45, 0xfd, 0xfd, 0xe5, 0x9b, 0xbb,
+	0xfe, 0x94, 0xb2, 0xfe, 0x31, 0x86, 0x2c, 0x35, 0xfe, 0xce, 0x79, 0xab, 0x32, 0x6b, 0x31, 0x9d,
+	0xaa, 0xfe, 0x9c, 0xf3, 0x0c, 0x38, 0xaf, 0x00, 0xa6, 0x55, 0xc0, 0x2d, 0x51, 0x65, 0x19, 0xc0,
+	0x97, 0xdc, 0x97, 0xcd, 0xae, 0x11, 0xfe, 0xde, 0xfb, 0xa8, 0x44, 0x51, 0x31, 0xc6, 0x2c, 0x96,
+	0xdd, 0x09, 0xfe, 0x29, 0x65, 0x35, 0x19, 0x05, 0x7f, 0xc1, 0xa2, 0x77, 0x19, 0x05, 0x14, 0xc2,
+	0x19, 0xc1, 0x14, 0x28, 0x9b, 0xaa, 0x95, 0xee, 0x9b, 0xaa, 0xa9, 0x44, 0x05, 0x14, 0xc2, 0x95,
+	0xdd, 0x0c, 0x30, 0xfe, 0xd6, 0x9a, 0xab, 0x22, 0x2c, 0x1d, 0x31, 0xd5, 0x1d, 0x31, 0x2c, 0x1d,
+	0x98, 0xdd, 0x31, 0x2c, 0x31, 0xc0, 0x2c, 0x31, 0x18, 0x92, 0xff, 0xfe, 0x6b, 0x2c, 0x95, 0xde,
+	0xac, 0x22, 0xfe, 0xce, 0x59, 0xa7, 0x44, 0x01, 0xfe, 0x52, 0x89, 0x96, 0xde, 0xa3, 0x76, 0xa7,
+	0x45, 0xa2, 0x77, 0x65, 0x59, 0x69, 0x66, 0x7e, 0x75, 0x55, 0x76, 0x98, 0xeb, 0x75, 0xfe, 0x92,
+	0x81, 0xad, 0x31, 0x69, 0x9e, 0x7b, 0xfe, 0x6a, 0x02, 0x98, 0xbe, 0xa2, 0x59, 0x20, 0x5e, 0xc1,
+	0x29, 0x66, 0xca, 0x27, 0xc0, 0x24, 0x29, 0xc1, 0x24, 0x20, 0x70, 0xa1, 0x95, 0xfe, 0x8a, 0xe4,
+	0xab, 0x41, 0x75, 0xa2, 0x77, 0x99, 0xbd, 0x94, 0xcf, 0x9d, 0x7c, 0xfe, 0x94, 0x6f, 0xfe, 0xe7,
+	0x3b, 0xa6, 0x45, 0x7a, 0x66, 0x31, 0x2c, 0x18, 0x2c, 0x31, 0xcf, 0x56, 0x25, 0x51, 0xfe, 0x94,
+	0x70, 0xfe, 0x31, 0x43, 0xc0, 0xab, 0x23, 0xfe, 0xc5, 0xf7, 0xfe, 0xf7, 0xde, 0xc0, 0x6f, 0xc2,
+	0x31, 0xc7, 0x2e, 0xc0, 0x31, 0xc4, 0x2c, 0x25, 0xc0, 0x66, 0x97, 0xcb, 0xfe, 0x5a, 0x67, 0xfe,
+	0x49, 0x00, 0xfe, 0xab, 0x44, 0xa6, 0x83, 0xa3, 0x76, 0x47, 0xfe, 0x9a, 0xe4, 0x03, 0xa1, 0x59,
+	0xa0, 0x6a, 0x66, 0xa3, 0x66, 0x24, 0x6e, 0xca, 0x65, 0x7a, 0x2c, 0x29, 0x6f, 0x2c, 0x60, 0x9f,
+	0xb7, 0xa6, 0x82, 0xfe, 0xc3, 0xc6, 0xa3, 0x83, 0x78, 0x78, 0xa5, 0x33, 0xa8, 0x10, 0xa3, 0x66,
+	0xa2, 0x67, 0x65, 0x69, 0xc0, 0x6e, 0xc1, 0x6e, 0xc3, 0x1c, 0xc6, 0x21, 0xc1, 0x1c, 0xc0, 0x6f,
+	0x1e, 0x6e, 0x9d, 0xbc, 0x99, 0xed, 0x9a, 0xde, 0x67, 0xa0, 0x7a, 0xa0, 0x6b, 0xfe, 0x82, 0x83,
+	0xfe, 0x41, 0x01, 0xa1, 0x6a, 0x1d, 0xc0, 0xa3, 0x76, 0x9c, 0x9a, 0xae, 0x11, 0xfe, 0xd6, 0x99,
+	0xab, 0x23, 0xfd, 0xfd, 0xe2, 0x66, 0x31, 0x9d, 0xaa, 0xfe, 0xb5, 0x96, 0xfe, 0x52, 0x69, 0x96,
+	0xcd, 0xac, 0x22, 0xfe, 0xbd, 0xf7, 0xae, 0x21, 0xc0, 0x25, 0x56, 0xfe, 0xb5, 0x75, 0xfe, 0x4a,
+	0x69, 0x9b, 0xba, 0xa9, 0x34, 0xaa, 0x33, 0xa2, 0x77, 0xc0, 0x65, 0x19, 0x05, 0x7f, 0x50, 0xfe,
+	0x3a, 0x07, 0x21, 0x34, 0x18, 0xa2, 0x77, 0x31, 0xc2, 0x2c, 0x31, 0x2c, 0xc1, 0x98, 0xcc, 0xfe,
+	0x7c, 0x10, 0x92, 0xfe, 0x21, 0x05, 0x14, 0xc0, 0x19, 0xc6, 0x14, 0x05, 0x14, 0x19, 0xc0, 0x0d,
+	0x9d, 0x9a, 0x94, 0xee, 0x9c, 0xaa, 0xa9, 0x44, 0x05, 0x14, 0xc1, 0x05, 0x21, 0x11, 0xaa, 0x33,
+	0xfe, 0xc6, 0x38, 0x1d, 0x2c, 0x6e, 0xc9, 0x2c, 0x31, 0x2c, 0x31, 0xc1, 0x2c, 0xc0, 0x31, 0x2c,
+	0xc0, 0x31, 0x2c, 0x31, 0x2c, 0xc0, 0x31, 0x2c, 0xc0, 0x31, 0x2c, 0x69, 0x2c, 0x25, 0x9c, 0xaa,
+	0xfe, 0xad, 0x75, 0xfe, 0x52, 0x89, 0x99, 0xbc, 0xb1, 0x00, 0x34, 0x55, 0xfe, 0x83, 0xef, 0xfe,
+	0x39, 0xc6, 0x9d, 0x9a, 0x39, 0xfe, 0xa4, 0xf4, 0xae, 0x11, 0xa2, 0x77, 0x6d, 0x55, 0xc0, 0xa2,
+	0x77, 0x56, 0x66, 0x76, 0x99, 0xcb, 0xfe, 0x62, 0x26, 0x9a, 0xe9, 0xfe, 0xab, 0x24, 0xaa, 0x41,
+	0x41, 0x9a, 0x9d, 0xfe, 0x51, 0x81, 0x10, 0x1e, 0x5a, 0xc0, 0x5e, 0x6e, 0x24, 0xcb, 0x22, 0x24,
+	0xa0, 0x8a, 0x69, 0x24, 0x1d, 0x7a, 0x7a, 0x9e, 0xb6, 0xa6, 0x72, 0xfe, 0xbb, 0xa4, 0xa4, 0x86,
+	0x7a, 0xa2, 0x49, 0xfe, 0x92, 0xa4, 0x96, 0xbf, 0xfe, 0x83, 0x4a, 0xfe, 0xef, 0x1b, 0xa7, 0x35,
+	0x55, 0x6f, 0x31, 0x66, 0xc1, 0x31, 0xcf, 0x2c, 0x31, 0xc0, 0x65, 0xfe, 0xb5, 0x95, 0xfe, 0x31,
+	0x85, 0x05, 0xfe, 0xb5, 0x96, 0xfe, 0xf7, 0xbe, 0xa2, 0x77, 0xcd, 0x2e, 0xc0, 0x31, 0xc2, 0x2c,
+	0x31, 0xc0, 0x22, 0x25, 0x6e, 0x9c, 0xba, 0xfe, 0x6b, 0x29, 0xfe, 0x49, 0x40, 0xfe, 0x9b, 0x24,
+	0xa8, 0x72, 0x20, 0x7f, 0x99, 0xad, 0xfe, 0x59, 0x00, 0x4f, 0xa0, 0x5a, 0x5a, 0xa4, 0x56, 0x51,
+	0xc2, 0x6b, 0xc8, 0x22, 0x76, 0x6b, 0xc1, 0x1e, 0x69, 0xa3, 0x94, 0xfe, 0x9b, 0x05, 0xaa, 0x50,
+	0x9e, 0xc5, 0xa1, 0xa6, 0xa2, 0x55, 0xa6, 0x12, 0xa5, 0x55, 0xa2, 0x67, 0x69, 0x6e, 0x6d, 0x69,
+	0xc0, 0x6e, 0x6e, 0xc2, 0x1c, 0xc3, 0x17, 0x1c, 0xc0, 0x21, 0xc0, 0x5a, 0xc1, 0x1c, 0xa0, 0x8a,
+	0x55, 0x7e, 0x17, 0x9a, 0xde, 0x99, 0xff, 0x9c, 0xbc, 0xa0, 0x8c, 0xa1, 0x5a, 0x14, 0x00, 0xa2,
+	0x59, 0x5a, 0x6e, 0x56, 0x7f, 0xa6, 0x45, 0xfe, 0xb5, 0x95, 0xfe, 0xf7, 0xbd, 0xa2, 0x77, 0xc4,
+	0x6b, 0xd2, 0x66, 0x31, 0x2c, 0x31, 0xfd, 0xfd, 0xc6, 0x95, 0xee, 0xfe, 0x73, 0x8e, 0xfe, 0x29,
+	0x24, 0xa7, 0x45, 0xfe, 0x9c, 0xf3, 0xfe, 0xf7, 0x9e, 0x2c, 0x31, 0xc0, 0xfe, 0xce, 0x38, 0xfe,
+	0x5a, 0xeb, 0x95, 0xee, 0xaa, 0x32, 0xab, 0x23, 0xa2, 0x77, 0x65, 0xc0, 0x19, 0x0d, 0x19, 0x9d,
+	0xaa, 0x15, 0x99, 0xbc, 0xfe, 0xad, 0x54, 0xfe, 0xf7, 0x9d, 0x2c, 0x31, 0x2c, 0xc0, 0x31, 0xc0,
+	0x51, 0x31, 0x1d, 0x31, 0x9c, 0xaa, 0x05, 0xfe, 0x42, 0x28, 0x21, 0xab, 0x33, 0x19, 0x14, 0x19,
+	0xc6, 0x14, 0xc1, 0x0d, 0x14, 0x05, 0x9d, 0xaa, 0x92, 0xfe, 0x56, 0xa9, 0x43, 0x05, 0x6e, 0x05,
+	0x14, 0x05, 0x30, 0x92, 0xff, 0x04, 0xfe, 0xce, 0x59, 0x1d, 0x7f, 0xc0, 0x31, 0xcc, 0x1d, 0x2c,
+	0x31, 0xc0, 0x2c, 0x31, 0xc1, 0x2c, 0x31, 0xc0, 0x2c, 0xc0, 0x31, 0xc2, 0x2c, 0x18, 0x31, 0x9b,
+	0xbb, 0xfe, 0x94, 0x71, 0xfe, 0x4a, 0x28, 0x20, 0xfe, 0x94, 0xb2, 0xae, 0x11, 0x93, 0xff, 0xfe,
+	0x52, 0x89, 0x97, 0xcd, 0x51, 0xa9, 0x33, 0xfe, 0xa5, 0x34, 0x04, 0x2c, 0xc0, 0x69, 0x6e, 0x56,
+	0x31, 0xc0, 0x2c, 0xc0, 0x94, 0xfd, 0xfe, 0x59, 0xe5, 0x9f, 0xa6, 0xfe, 0xb3, 0xa6, 0xa6, 0x54,
+	0xc0, 0xfe, 0x82, 0xe4, 0xfe, 0x41, 0x62, 0x9f, 0x7b, 0x27, 0x24, 0xc0, 0x29, 0x5a, 0x29, 0x24,
+	0xca, 0x6d, 0x24, 0x6b, 0xc0, 0x24, 0x69, 0x20, 0x76, 0xa1, 0x94, 0xa9, 0x61, 0xfe, 0xc4, 0x06,
+	0xa1, 0xa7, 0x7a, 0xa0, 0x5a, 0xfe, 0x61, 0xa0, 0xa2, 0x69, 0xfe, 0xbd, 0x12, 0xfe, 0xff, 0xbd,
+	0x2c, 0x31, 0xc2, 0x2c, 0x31, 0xd2, 0x65, 0xc0, 0xfe, 0xbd, 0xd6, 0xfe, 0x42, 0x28, 0xae, 0x10,
+	0xfe, 0xe7, 0x1b, 0x31, 0xd4, 0x2c, 0xc0, 0x31, 0x65, 0xc0, 0x31, 0x9d, 0xa9, 0xfe, 0x73, 0x4b,
+	0xfe, 0x49, 0x40, 0xfe, 0x9b, 0x04, 0x20, 0x7e, 0x42, 0x9b, 0x9d, 0xfe, 0x51, 0x00, 0xa2, 0x38,
+	0x5b, 0x0e, 0xa3, 0x67, 0x22, 0x6b, 0xc1, 0x22, 0xc9, 0x29, 0xc0, 0x66, 0xc0, 0x27, 0x64, 0xa0,
+	0xa6, 0xa9, 0x51, 0xfe, 0xc4, 0x07, 0xa1, 0xa4, 0xa0, 0xa6, 0xa2, 0x65, 0xa2, 0x55, 0xa4, 0x66,
+	0xa2, 0x66, 0xa2, 0x76, 0xa2, 0x67, 0xa2, 0x66, 0x6e, 0x6d, 0x69, 0xc1, 0x6e, 0x65, 0xc1, 0x6e,
+	0xc1, 0x1c, 0xc2, 0x21, 0xc0, 0x5a, 0x21, 0xc0, 0x28, 0x56, 0x69, 0x1c, 0x9c, 0xcc, 0xfe, 0xf4,
+	0xc0, 0x9a, 0xde, 0xa1, 0x7b, 0xa1, 0x6b, 0x99, 0x8e, 0xfe, 0x51, 0x62, 0x9d, 0x8b, 0xa2, 0x58,
+	0xc0, 0x66, 0xa2, 0x67, 0x6f, 0xfe, 0x8c, 0x51, 0x09, 0x31, 0xe6, 0x66, 0x31, 0xfd, 0xf7, 0x09,
+	0x3c, 0xfe, 0x39, 0xc6, 0x9b, 0xbb, 0xfe, 0x84, 0x0f, 0xfe, 0xe7, 0x1c, 0x31, 0x25, 0x31, 0x30,
+	0xfe, 0x7b, 0xae, 0xfe, 0x31, 0x65, 0xa6, 0x45, 0xad, 0x22, 0xa5, 0x55, 0x65, 0x19, 0x14, 0x19,
+	0x51, 0x14, 0x99, 0xbb, 0x38, 0x39, 0x11, 0x31, 0xc1, 0x66, 0xc1, 0x31, 0xc0, 0x51, 0x2c, 0x51,
+	0x19, 0xfe, 0x42, 0x08, 0xa5, 0x55, 0x05, 0xa3, 0x67, 0x14, 0x59, 0x00, 0xa4, 0x55, 0x19, 0xc6,
+	0x65, 0xc0, 0x19, 0x9a, 0xbb, 0x94, 0xee, 0x9c, 0xaa, 0xad, 0x22, 0x05, 0x00, 0x19, 0xc0, 0x00,
+	0x97, 0xcc, 0x38, 0x21, 0x34, 0x31, 0x51, 0x2c, 0xc0, 0x31, 0xcb, 0x2c, 0x31, 0xc0, 0x2c, 0x31,
+	0x2c, 0x18, 0x6f, 0x31, 0xc4, 0x2c, 0xc2, 0x65, 0x31, 0x99, 0xcb, 0x00, 0xfe, 0x29, 0x24, 0x3d,
+	0xfe, 0x9c, 0xb2, 0xfe, 0xd6, 0xba, 0xfe, 0x8c, 0x50, 0xfe, 0x31, 0x65, 0x56, 0x2c, 0xa5, 0x56,
+	0xfe, 0xad, 0x95, 0xaf, 0x11, 0xa3, 0x77, 0x51, 0xc0, 0xa2, 0x76, 0x31, 0x55, 0x6f, 0x1d, 0x7a,
+	0x51, 0xfe, 0xa4, 0xb1, 0xfe, 0x41, 0x21, 0xa6, 0x63, 0xfe, 0xb3, 0xe7, 0xa3, 0x76, 0xa3, 0x57,
+	0xfe, 0x6a, 0x43, 0x99, 0x9e, 0x24, 0xc2, 0x26, 0xc0, 0x7a, 0x24, 0xca, 0x6d, 0x24, 0x2b, 0x6e,
+	0x29, 0x65, 0x7a, 0x65, 0xa2, 0x95, 0xfe, 0x9b, 0x26, 0xa9, 0x50, 0x9f, 0xb8, 0x7a, 0xfe, 0x9a,
+	0xe4, 0xfe, 0x40, 0xe0, 0xfe, 0x83, 0x29, 0xfe, 0xee, 0xd9, 0x25, 0x56, 0x31, 0xd3, 0x66, 0x31,
+	0xc1, 0x25, 0x31, 0xfe, 0xb5, 0x95, 0x01, 0xfe, 0xb5, 0xb5, 0xfe, 0xff, 0xff, 0xd6, 0x25, 0x31,
+	0xc1, 0x25, 0x9c, 0xaa, 0xfe, 0x6b, 0x0a, 0xfe, 0x49, 0x20, 0xfe, 0x9a, 0xe4, 0x20, 0xa2, 0x77,
+	0x42, 0x99, 0x9e, 0xfe, 0x49, 0x20, 0xa1, 0x49, 0xa1, 0x79, 0x41, 0xa3, 0x66, 0x22, 0x29, 0xc1,
+	0x22, 0xc2, 0x25, 0x66, 0xc2, 0x22, 0x5f, 0x66, 0x29, 0xc2, 0x20, 0x9e, 0xa7, 0xa4, 0x84, 0xfe,
+	0xa3, 0x65, 0xa8, 0x61, 0x74, 0x78, 0x5d, 0x7e, 0x5a, 0xa2, 0x76, 0xa2, 0x66, 0x6e, 0xa5, 0x54,
+	0x6e, 0xa2, 0x77, 0xa2, 0x66, 0x69, 0x66, 0x69, 0x1c, 0xc0, 0x6e, 0xc0, 0x6e, 0x6b, 0x21, 0xc0,
+	0x1c, 0xc0, 0x6b, 0xc0, 0x1c, 0x5a, 0x6e, 0x67, 0x19, 0x76, 0x62, 0xfe, 0xfd, 0x00, 0xfe, 0xec,
+	0x00, 0xa0, 0x8c, 0xa2, 0x59, 0x9d, 0x7c, 0xfe, 0x71, 0xe4, 0x98, 0x9e, 0xa2, 0x58, 0x6f, 0x66,
+	0xa3, 0x67, 0x51, 0xb0, 0x00, 0xfe, 0xe6, 0xdc, 0x2c, 0xc0, 0x66, 0x2c, 0x6e, 0xd7, 0x65, 0x2c,
+	0x31, 0xfd, 0xfd, 0xc3, 0xfe, 0xce, 0x38, 0xfe, 0x5a, 0xaa, 0x93, 0xef, 0xad, 0x21, 0xfe, 0xc6,
+	0x17, 0x31, 0x1d, 0x31, 0x09, 0xfe, 0x94, 0x92, 0xfe, 0x31, 0x85, 0xa2, 0x77, 0xae, 0x11, 0xa6,
+	0x55, 0x56, 0x0d, 0x6f, 0x05, 0x19, 0xc0, 0x9b, 0xbb, 0x94, 0xee, 0xa3, 0x66, 0xfe, 0xd6, 0xba,
+	0xaa, 0x33, 0x66, 0x31, 0xc5, 0x2c, 0x1d, 0xfe, 0xa5, 0x14, 0xfe, 0x31, 0xa6, 0xa4, 0x66, 0xad,
+	0x12, 0xa4, 0x66, 0xc0, 0x19, 0x28, 0x11, 0x19, 0xc6, 0x65, 0x00, 0xa2, 0x77, 0x9c, 0xa9, 0x95,
+	0xde, 0x99, 0xcb, 0xae, 0x11, 0xa5, 0x56, 0x0d, 0x19, 0xc0, 0x9d, 0xa9, 0x99, 0xbc, 0x95, 0xee,
+	0xa7, 0x44, 0xfe, 0xce, 0x59, 0x2c, 0x6e, 0x2c, 0x31, 0xcd, 0x2c, 0xc2, 0x18, 0x9c, 0xaa, 0xc0,
+	0x18, 0x31, 0x2c, 0xc0, 0x31, 0xc1, 0x2c, 0xc0, 0x31, 0xc0, 0x2c, 0x98, 0xcb, 0x25, 0xfe, 0x29,
+	0x45, 0x0c, 0x00, 0xab, 0x32, 0x04, 0xfe, 0x29, 0x44, 0x7f, 0x6e, 0xa6, 0x56, 0x10, 0xfe, 0xf7,
+	0xbe, 0xa2, 0x77, 0x27, 0x31, 0xc2, 0x59, 0x31, 0xc1, 0x98, 0xdc, 0xfe, 0x73, 0x2b, 0x08, 0xac,
+	0x30, 0xfe, 0xc4, 0x48, 0x6e, 0x9c, 0x9c, 0xfe, 0x49, 0xa1, 0x9c, 0x9d, 0xa2, 0x59, 0x66, 0xc0,
+	0x6d, 0x5a, 0xc0, 0x29, 0xcb, 0x22, 0x24, 0x6b, 0x6e, 0x29, 0x65, 0x7a, 0x65, 0xa2, 0xa5, 0xfe,
+	0xa3, 0x87, 0xa6, 0x82, 0x74, 0x67, 0xfe, 0x72, 0x01, 0x99, 0x9e, 0xfe, 0xac, 0x90, 0xfe, 0xff,
+	0x9d, 0xa2, 0x68, 0x55, 0x31, 0xd6, 0x2c, 0x31, 0x65, 0xfe, 0x9c, 0xf3, 0xfe, 0x63, 0x0b, 0xfe,
+	0xd6, 0x99, 0xab, 0x22, 0x25, 0xc0, 0x31, 0xcc, 0x2a, 0xc5, 0x25, 0xc2, 0x2c, 0x97, 0xdc, 0xfe,
+	0x62, 0x69, 0xfe, 0x51, 0x20, 0xfe, 0xab, 0x25, 0xa7, 0x71, 0x6f, 0x5f, 0xfe, 0x8a, 0xe4, 0xfe,
+	0x39, 0x41, 0xa1, 0x59, 0xa1, 0x79, 0x51, 0x22, 0xc0, 0x6b, 0xc2, 0x22, 0x76, 0xc5, 0x22, 0x5e,
+	0x22, 0xc0, 0x29, 0xc1, 0x79, 0x74, 0x78, 0xaa, 0x61, 0xfe, 0xc4, 0x47, 0xa0, 0xa7, 0x74, 0x7c,
+	0xc0, 0x55, 0x6e, 0x07, 0x69, 0xa2, 0x66, 0xa2, 0x76, 0xa3, 0x66, 0xa3, 0x66, 0xa2, 0x77, 0x6e,
+	0x6d, 0xa2, 0x65, 0xc0, 0x1c, 0x56, 0x1c, 0x21, 0xc1, 0x1c, 0x23, 0xc1, 0x65, 0x56, 0x23, 0x5b,
+	0x69, 0x76, 0x62, 0xfe, 0xfd, 0x22, 0x98, 0xef, 0x9f, 0x9b, 0xa1, 0x6a, 0xa0, 0x5a, 0xfe, 0x8a,
+	0x64, 0xfe, 0x40, 0xe1, 0xa2, 0x49, 0x6b, 0x1b, 0xa2, 0x78, 0x55, 0xaa, 0x34, 0xfe, 0xce, 0x19,
+	0xad, 0x11, 0x2c, 0x27, 0xc0, 0x2c, 0x31, 0x56, 0xcb, 0x31, 0xca, 0x2c, 0x31, 0xc8, 0x2c, 0xc0,
+	0x65, 0x31, 0xfd, 0xf2, 0x9c, 0xaa, 0xfe, 0x8c, 0x71, 0xfe, 0x29, 0x65, 0xa4, 0x76, 0x3c, 0xfe,
+	0xef, 0x5d, 0x31, 0x2c, 0x55, 0xfe, 0xb5, 0x96, 0xfe, 0x4a, 0x49, 0x97, 0xcc, 0xad, 0x22, 0xab,
+	0x22, 0x7e, 0x6b, 0x19, 0x0d, 0x05, 0x14, 0xc0, 0x95, 0xdd, 0x34, 0xfe, 0xad, 0x54, 0x31, 0x2c,
+	0x31, 0x2c, 0x31, 0xc3, 0x2c, 0x55, 0xfe, 0xbd, 0xd7, 0xfe, 0x52, 0xaa, 0x9a, 0xbb, 0xad, 0x22,
+	0xa6, 0x45, 0x19, 0xc0, 0x55, 0x19, 0xc0, 0x14, 0x19, 0xc4, 0x0a, 0x05, 0x19, 0x9b, 0xbb, 0x93,
+	0xee, 0x9c, 0xaa, 0xac, 0x22, 0x05, 0x0a, 0x14, 0x19, 0x05, 0x1c, 0x98, 0xcb, 0x0d, 0xfe, 0xbd,
+	0xf7, 0x31, 0xc0, 0x66, 0x31, 0xcc, 0x2c, 0xc0, 0x31, 0x2c, 0x1d, 0x9b, 0xbb, 0x9b, 0xaa, 0xa3,
+	0x77, 0x09, 0x2c, 0x31, 0x2c, 0x31, 0xc5, 0x1d, 0x39, 0xfe, 0x7b, 0xcf, 0xfe, 0x31, 0x65, 0xa4,
+	0x66, 0xfe, 0x84, 0x30, 0xa3, 0x77, 0x21, 0x29, 0xc0, 0x2c, 0xa7, 0x44, 0xfe, 0xad, 0x54, 0x09,
+	0x31, 0x55, 0x27, 0x31, 0xc1, 0x5a, 0x66, 0x2e, 0x31, 0xc0, 0xfe, 0xc6, 0x17, 0xfe, 0x51, 0xe5,
+	0x9e, 0xc5, 0xfe, 0xb3, 0xa6, 0xa6, 0x64, 0x32, 0xfe, 0x8a, 0xe4, 0xfe, 0x41, 0x61, 0x9f, 0x7b,
+	0xa0, 0x7a, 0xc0, 0x79, 0xc0, 0x5e, 0xc1, 0x6b, 0xc9, 0x22, 0xc0, 0x29, 0x2b, 0x6e, 0x29, 0x65,
+	0x20, 0x65, 0xa3, 0x94, 0xfe, 0xab, 0xc8, 0xa5, 0x82, 0x70, 0x9d, 0xab, 0xfe, 0x59, 0x80, 0xa2,
+	0x4a, 0xfe, 0xc5, 0xb5, 0xfe, 0xff, 0xde, 0x31, 0xd4, 0x66, 0x31, 0xc0, 0x2c, 0x31, 0x56, 0x9a,
+	0xbb, 0x18, 0xa2, 0x76, 0xfe, 0xef, 0x5c, 0xa4, 0x66, 0x66, 0x25, 0x31, 0xcc, 0x2c, 0x31, 0x69,
+	0xc3, 0x31, 0xc0, 0x20, 0x2c, 0x27, 0xfe, 0xb5, 0x54, 0xfe, 0x49, 0x84, 0xa1, 0xb4, 0xfe, 0xbb,
+	0x85, 0xa4, 0x94, 0x19, 0xa1, 0x69, 0xfe, 0x6a, 0x42, 0x0e, 0xa1, 0x4a, 0x6f, 0x1a, 0xa1, 0x97,
+	0x22, 0x24, 0xc3, 0x7a, 0x69, 0xc4, 0x22, 0xc3, 0x20, 0xc1, 0x7d, 0x74, 0xa5, 0x74, 0xfe, 0xb3,
+	0xe7, 0x35, 0x60, 0x78, 0x7f, 0x59, 0x7a, 0x6d, 0x59, 0x69, 0x00, 0xc0, 0xa2, 0x76, 0xa2, 0x76,
+	0xa2, 0x77, 0xa3, 0x65, 0xa4, 0x45, 0xa2, 0x66, 0x1e, 0xc0, 0x6d, 0x6e, 0xc0, 0x1c, 0xc0, 0x6b,
+	0x1e, 0xc0, 0x25, 0x66, 0x6b, 0x6b, 0x55, 0x75, 0x66, 0x9a, 0xef, 0x9a, 0xcd, 0x67, 0x12, 0xa2,
+	0x59, 0xfe, 0x9b, 0x04, 0xfe, 0x49, 0x40, 0xa0, 0x5c, 0xc0, 0x56, 0xc0, 0x6e, 0xa4, 0x67, 0xfe,
+	0xad, 0x55, 0x04, 0xa3, 0x76, 0x2c, 0x31, 0x2c, 0x31, 0xd7, 0x2c, 0x69, 0x31, 0xc8, 0x2c, 0xc1,
+	0x31, 0xfd, 0xf2, 0xfe, 0xbd, 0xf7, 0xfe, 0x52, 0x8a, 0x15, 0xfe, 0x73, 0x8e, 0x10, 0x31, 0x2c,
+	0x31, 0x96, 0xdd, 0xfe, 0x6b, 0x4c, 0x15, 0xa8, 0x44, 0xac, 0x32, 0xa6, 0x45, 0x65, 0x6b, 0x0d,
+	0x05, 0x19, 0x0d, 0x9c, 0x9a, 0x94, 0xff, 0xab, 0x22, 0xfe, 0xe7, 0x3c, 0x2c, 0xc0, 0x31, 0xc2,
+	0x2c, 0xc2, 0x97, 0xcc, 0xfe, 0x6b, 0x4d, 0x95, 0xdd, 0x18, 0x14, 0xc0, 0x5a, 0x19, 0xc0, 0x14,
+	0xa2, 0x66, 0x05, 0x19, 0xc4, 0x14, 0xc0, 0x9c, 0xa9, 0x93, 0xef, 0x0c, 0xaa, 0x32, 0xa8, 0x45,
+	0x0a, 0x14, 0x19, 0x00, 0x29, 0x0c, 0xa5, 0x55, 0xfe, 0xb5, 0xb6, 0xb0, 0x00, 0x2c, 0x31, 0x2c,
+	0xc0, 0x31, 0xcb, 0x2c, 0x69, 0x31, 0x9b, 0xba, 0x93, 0xef, 0xc0, 0xab, 0x33, 0xa4, 0x66, 0x31,
+	0xc0, 0x2c, 0x31, 0xc5, 0x18, 0x98, 0xcc, 0xfe, 0x6b, 0x2c, 0x93, 0xef, 0xa3, 0x66, 0xb0, 0x10,
+	0xa5, 0x56, 0xfe, 0x52, 0x8a, 0x96, 0xdd, 0xa2, 0x76, 0x66, 0xa8, 0x44, 0xfe, 0xad, 0x75, 0x18,
+	0xa3, 0x66, 0xc0, 0x66, 0x31, 0x61, 0x2c, 0x31, 0xc0, 0x5a, 0xc0, 0x66, 0x1d, 0xfe, 0xad, 0x33,
+	0xfe, 0x30, 0xe0, 0xfe, 0x7a, 0x20, 0xfe, 0xd4, 0x47, 0x65, 0x5b, 0xfe, 0x71, 0xc0, 0x9b, 0x7e,
+	0xa1, 0x69, 0x5b, 0xc0, 0x65, 0x7a, 0x5e, 0xc0, 0x20, 0x5e, 0xcb, 0x6b, 0x67, 0x29, 0xc0, 0x65,
+	0x19, 0x14, 0xa3, 0x94, 0xfe, 0xb4, 0x09, 0xa4, 0x82, 0x9d, 0xc9, 0x9b, 0xbb, 0xfe, 0x49, 0x40,
+	0xa8, 0x26, 0xfe, 0xd6, 0x58, 0xac, 0x13, 0x5a, 0x31, 0xc0, 0x2a, 0x31, 0xd3, 0x29, 0x31, 0x9d,
+	0x9a, 0x93, 0xfe, 0xfe, 0x3a, 0x08, 0x05, 0xfe, 0xf7, 0xbe, 0x7e, 0x31, 0x2a, 0x31, 0xcc, 0x2c,
+	0x31, 0xc0, 0x2a, 0xc1, 0x5a, 0x2a, 0xc0, 0x31, 0x2c, 0x97, 0xdd, 0xfe, 0x8b, 0xad, 0xfe, 0x41,
+	0x00, 0xfe, 0x8a, 0x62, 0xac, 0x40, 0xa2, 0xa4, 0x4f, 0x9d, 0x8c, 0xfe, 0x59, 0xc0, 0x9d, 0x6d,
+	0xa0, 0x6b, 0x6f, 0x61, 0xa1, 0x96, 0x66, 0x24, 0xca, 0x22, 0x69, 0x7a, 0xc0, 0x66, 0x20, 0xc0,
+	0x19, 0x14, 0x78, 0xa0, 0xa7, 0xac, 0x30, 0xa7, 0x64, 0xa1, 0x96, 0xa2, 0x96, 0xa2, 0x77, 0x6e,
+	0x69, 0x69, 0x69, 0x7e, 0x64, 0x65, 0x69, 0x6e, 0x7a, 0xa2, 0x66, 0xa4, 0x44, 0xa4, 0x55, 0xa4,
+	0x55, 0x6d, 0x6e, 0x6d, 0xc2, 0x1e, 0xc0, 0x6b, 0x1b, 0x9c, 0xcd, 0x52, 0x56, 0x55, 0x51, 0x7a,
+	0x77, 0x9c, 0xbc, 0xa1, 0x79, 0x4a, 0xa3, 0x57, 0x98, 0xae, 0xfe, 0x49, 0x80, 0x9e, 0x6c, 0x6b,
+	0x6e, 0x52, 0xa3, 0x76, 0xc0, 0xae, 0x12, 0xab, 0x22, 0xa2, 0x77, 0xa3, 0x67, 0xa5, 0x76, 0x6e,
+	0xc0, 0x7e, 0x66, 0xca, 0x5b, 0xc6, 0x6e, 0x20, 0xc0, 0xa4, 0x66, 0xa4, 0x66, 0x6f, 0xc5, 0x7e,
+	0x65, 0x5a, 0x7e, 0xa2, 0x78, 0xa2, 0x77, 0x6e, 0xfd, 0xf0, 0x2c, 0x04, 0xfe, 0x7b, 0xcf, 0xfe,
+	0x31, 0x65, 0xa3, 0x67, 0xfe, 0xa5, 0x34, 0x18, 0x31, 0x66, 0x1d, 0xfe, 0x9c, 0xd3, 0xfe, 0x31,
+	0xa6, 0x0c, 0xaf, 0x10, 0xa5, 0x56, 0x6e, 0x05, 0x14, 0x19, 0x14, 0x19, 0xc0, 0x94, 0xee, 0x98,
+	0xcc, 0xfe, 0xad, 0x54, 0x2c, 0xc0, 0x31, 0x2c, 0x31, 0x2c, 0x31, 0x2c, 0xc1, 0x55, 0xfe, 0x94,
+	0x92, 0xfe, 0x42, 0x08, 0xa9, 0x33, 0xa6, 0x55, 0x28, 0x14, 0xc0, 0x19, 0xc2, 0x14, 0x05, 0x6f,
+	0x14, 0x19, 0x6f, 0x19, 0x14, 0x9b, 0xaa, 0x93, 0xee, 0x9c, 0xbb, 0x21, 0xa9, 0x44, 0x0a, 0x05,
+	0x19, 0x05, 0x35, 0x3d, 0x20, 0xfe, 0xad, 0x55, 0xfe, 0xf7, 0xbe, 0x2c, 0xc0, 0x6e, 0xcb, 0x18,
+	0x31, 0xc0, 0x04, 0x31, 0x97, 0xdd, 0x91, 0xff, 0xa8, 0x44, 0xad, 0x21, 0x31, 0x2c, 0x31, 0xc2,
+	0x2c, 0xc0, 0x31, 0xc0, 0x2c, 0x31, 0x94, 0xee, 0x35, 0x38, 0xc0, 0xb0, 0x00, 0x7e, 0x92, 0xff,
+	0x9c, 0xaa, 0x5a, 0x9d, 0xaa, 0xaa, 0x32, 0xfe, 0xb5, 0x75, 0xfe, 0xf7, 0x9e, 0xa2, 0x77, 0xc0,
+	0x31, 0xc4, 0x56, 0x2e, 0x62, 0x2c, 0x9b, 0xba, 0xfe, 0x83, 0xcd, 0xfe, 0x38, 0xe0, 0xfe, 0x9a,
+	0xe3, 0xa9, 0x53, 0x7e, 0x9a, 0xad, 0xfe, 0x59, 0x40, 0x9f, 0x6b, 0x4b, 0x5b, 0xc0, 0x14, 0x7a,
+	0x5f, 0xc0, 0x5a, 0xc5, 0x22, 0xc5, 0x6b, 0x2b, 0x29, 0x22, 0x1d, 0x7e, 0x75, 0xa2, 0x95, 0xfe,
+	0xa3, 0x87, 0xa6, 0x71, 0xa0, 0xa7, 0x9b, 0xbc, 0xfe, 0x51, 0x40, 0xa9, 0x06, 0xfe, 0xde, 0x99,
+	0x2c, 0x41, 0xa3, 0x76, 0xce, 0x2c, 0x55, 0x31, 0xc0, 0x2c, 0x5a, 0x31, 0x2e, 0x15, 0x31, 0x96,
+	0xdd, 0xfe, 0x6b, 0x8d, 0xfe, 0x29, 0x85, 0xfe, 0x8c, 0x51, 0x1d, 0x31, 0xc0, 0x29, 0x31, 0xcb,
+	0x2c, 0x31, 0xc0, 0x29, 0x6e, 0xc0, 0x69, 0xc0, 0x31, 0x1d, 0x66, 0x75, 0xfe, 0xa4, 0xd3, 0xfe,
+	0x59, 0xc4, 0x9d, 0xb7, 0xfe, 0xb3, 0x64, 0xa7, 0x73, 0x74, 0xa1, 0x59, 0x98, 0x9d, 0xfe, 0x49,
+	0x40, 0xa1, 0x4a, 0xa0, 0x6b, 0xc0, 0x75, 0xa0, 0xa7, 0x6b, 0x5a, 0x55, 0xc0, 0x24, 0xc4, 0x6f,
+	0xc0, 0x6e, 0x69, 0x22, 0xc0, 0x20, 0xc1, 0x27, 0x18, 0x7a, 0x69, 0x79, 0xa2, 0x85, 0xa1, 0x97,
+	0x79, 0xa1, 0x97, 0xa3, 0x67, 0xa4, 0x65, 0xa4, 0x65, 0xa4, 0x76, 0xa3, 0x65, 0xa3, 0x86, 0x69,
+	0x79, 0x12, 0x79, 0x6e, 0x6d, 0x6d, 0xa2, 0x65, 0xa2, 0x76, 0xa4, 0x65, 0xa5, 0x34, 0x6d, 0x6e,
+	0x65, 0xc0, 0xa0, 0x8a, 0x20, 0x9d, 0xba, 0x9c, 0xbc, 0x9b, 0xdc, 0x9f, 0x8b, 0x11, 0x5e, 0x6f,
+	0x51, 0x9f, 0x9b, 0x67, 0x22, 0xa2, 0x67, 0x4f, 0x98, 0xbe, 0xfe, 0x5a, 0x43, 0xfe, 0x29, 0x43,
+	0x6f, 0xc0, 0x69, 0x22, 0x6e, 0x2e, 0x7e, 0xc0, 0x7f, 0xa2, 0x67, 0xc0, 0x66, 0x7a, 0xc4, 0x6e,
+	0xc5, 0x11, 0x6b, 0x6e, 0x7a, 0xc0, 0x1d, 0x20, 0xc0, 0x1d, 0x18, 0x20, 0xa3, 0x67, 0xa2, 0x76,
+	0xc2, 0x7e, 0x6b, 0x0d, 0x7a, 0x51, 0xa5, 0x55, 0x0d, 0x1c, 0xfe, 0xc6, 0x18, 0xae, 0x11, 0x31,
+	0xfd, 0xf0, 0x2c, 0x97, 0xcc, 0xfe, 0x63, 0x0c, 0x92, 0xfe, 0x29, 0xfe, 0xd6, 0x79, 0x2c, 0xc0,
+	0x69, 0x3c, 0x15, 0x94, 0xef, 0x15, 0xab, 0x23, 0x66, 0xa3, 0x66, 0x65, 0x19, 0x66, 0x05, 0x0d,
+	0x9c, 0xab, 0x0c, 0xa9, 0x33, 0xfe, 0xde, 0xda, 0xa8, 0x45, 0x25, 0x31, 0xc1, 0x51, 0x31, 0x2c,
+	0x31, 0xc0, 0xfe, 0xb5, 0x96, 0xfe, 0x4a, 0x49, 0xc0, 0xac, 0x22, 0x00, 0x14, 0xa2, 0x66, 0x19,
+	0xc4, 0x1e, 0x14, 0x5a, 0x19, 0xc0, 0x05, 0x9c, 0xaa, 0x96, 0xdd, 0x98, 0xcc, 0xaa, 0x33, 0xab,
+	0x32, 0xa2, 0x77, 0xc1, 0x19, 0x1d, 0x0c, 0x29, 0x05, 0xfe, 0xef, 0x5c, 0xa4, 0x67, 0xc0, 0x31,
+	0xca, 0x9d, 0xa9, 0x31, 0xc0, 0x25, 0x56, 0xc0, 0xfe, 0xbd, 0xd7, 0x97, 0xcc, 0xa8, 0x44, 0xad,
+	0x21, 0x31, 0x55, 0x2c, 0x31, 0xc1, 0x2c, 0xc1, 0x1d, 0x31, 0xc0, 0x96, 0xdd, 0xfe, 0x7b, 0xce,
+	0xfe, 0x21, 0x24, 0x29, 0xab, 0x32, 0xa8, 0x45, 0x34, 0x96, 0xdc, 0x24, 0x55, 0xaa, 0x43, 0xfe,
+	0xa5, 0x13, 0xfe, 0xe7, 0x3c, 0x31, 0x66, 0x31, 0xc7, 0x52, 0x2c, 0x94, 0xfd, 0xfe, 0x62, 0x87,
+	0xfe, 0x41, 0x00, 0xfe, 0xb3, 0xc6, 0xa5, 0x76, 0x65, 0xfe, 0x9a, 0xe5, 0xfe, 0x51, 0x00, 0xa0,
+	0x5b, 0xa2, 0x58, 0xa2, 0x67, 0x27, 0x65, 0xc0, 0x27, 0x6f, 0x27, 0x69, 0xc9, 0x6e, 0x5a, 0xc0,
+	0x9f, 0x9b, 0x29, 0x22, 0x69, 0x72, 0x65, 0xa4, 0x84, 0xfe, 0x9b, 0x66, 0xa7, 0x81, 0x75, 0x9b,
+	0xbb, 0xfe, 0x61, 0xe2, 0x9f, 0x6b, 0xfe, 0xc5, 0xb5, 0xfe, 0xff, 0xdf, 0x31, 0xc0, 0x56, 0x31,
+	0xd2, 0x9d, 0x9a, 0x1d, 0x31, 0x9b, 0xba, 0xfe, 0x8c, 0x50, 0x20, 0x5a, 0xfe, 0x7b, 0xee, 0xfe,
+	0xef, 0x7d, 0x31, 0x29, 0x31, 0xcc, 0x2c, 0x31, 0xc0, 0x5a, 0xc3, 0x31, 0x69, 0x66, 0xfe, 0xd6,
+	0x37, 0xfe, 0x72, 0xca, 0x95, 0xf9, 0xa9, 0x60, 0xad, 0x40, 0x7d, 0x70, 0xa0, 0x5a, 0xfe, 0x8a,
+	0x81, 0xfe, 0x41, 0x40, 0xa1, 0x5a, 0xa0, 0x6b, 0x2b, 0x7a, 0x75, 0x59, 0xc0, 0x27, 0x6e, 0xc0,
+	0x33, 0xc0, 0x59, 0x6b, 0xc3, 0x65, 0x29, 0x65, 0xc0, 0x66, 0xc0, 0x6b, 0xc1, 0x18, 0x75, 0x08,
+	0x75, 0x7e, 0x7e, 0x00, 0x3b, 0xc0, 0xa3, 0x75, 0xa3, 0x76, 0x7e, 0xa5, 0x75, 0xa7, 0x53, 0xa3,
+	0x76, 0xa2, 0x86, 0xa2, 0x77, 0x7c, 0x64, 0x6d, 0x6d, 0xa4, 0x54, 0xa4, 0x64, 0xa2, 0x75, 0xa3,
+	0x56, 0x6e, 0xc0, 0x67, 0x9c, 0xbb, 0x9c, 0xab, 0x9d, 0xbb, 0x9c, 0xdc, 0x5b, 0x43, 0x5f, 0xa2,
+	0x67, 0x6f, 0x9e, 0xac, 0x52, 0x9c, 0x9a, 0x9e, 0x79, 0x9d, 0x9a, 0x9b, 0x9d, 0x9b, 0x9c, 0x9e,
+	0x7c, 0x6e, 0xc2, 0x1d, 0x22, 0x1d, 0xc0, 0x22, 0x6b, 0xc0, 0x66, 0x29, 0xc4, 0x24, 0x1f, 0x24,
+	0xc2, 0x1f, 0x24, 0xc7, 0x55, 0x24, 0x29, 0x7e, 0xc1, 0x65, 0x1d, 0xc0, 0x7f, 0x31, 0x29, 0xa4,
+	0x66, 0x9d, 0xaa, 0xa7, 0x44, 0xfe, 0xc6, 0x38, 0xae, 0x11, 0xfd, 0xef, 0x66, 0x31, 0x51, 0xfe,
+	0xb5, 0xb6, 0xfe, 0x42, 0x28, 0x29, 0xfe, 0x9c, 0xb2, 0xfe, 0xf7, 0x9e, 0x2c, 0x31, 0x9b, 0xba,
+	0xfe, 0x8c, 0x30, 0x29, 0xa3, 0x76, 0xae, 0x11, 0xa7, 0x45, 0x9d, 0xaa, 0x19, 0x65, 0x19, 0x0d,
+	0xc0, 0x56, 0x95, 0xee, 0x96, 0xdc, 0xfe, 0x9c, 0xd3, 0x1d, 0x6e, 0x7f, 0xc1, 0x2c, 0x31, 0xc0,
+	0x1d, 0x31, 0x99, 0xcc, 0xfe, 0x63, 0x2c, 0x94, 0xee, 0xaf, 0x11, 0xa6, 0x55, 0x19, 0x05, 0x19,
+	0xc6, 0x6e, 0x51, 0x6b, 0xa2, 0x77, 0x9a, 0xbb, 0x39, 0x38, 0xa6, 0x54, 0xad, 0x12, 0xa5, 0x65,
+	0x14, 0x0d, 0xa3, 0x67, 0x98, 0xcc, 0x95, 0xed, 0x9a, 0xbb, 0xfe, 0x7b, 0xef, 0xfe, 0xde, 0xfb,
+	0xa8, 0x44, 0x2c, 0x31, 0xca, 0x2c, 0x55, 0x31, 0xc0, 0x65, 0x9d, 0x9a, 0xfe, 0x94, 0xb2, 0x00,
+	0xaf, 0x00, 0x09, 0x66, 0x11, 0x2d, 0xad, 0x21, 0x2c, 0x1d, 0x31, 0x2c, 0xc0, 0x31, 0xc0, 0x2c,
+	0x96, 0xdc, 0x18, 0xfe, 0x29, 0x44, 0x6f, 0xa9, 0x43, 0xa6, 0x56, 0x96, 0xdd, 0x1d, 0xc0, 0x24,
+	0xaa, 0x33, 0xfe, 0xad, 0x34, 0xfe, 0xf7, 0x7d, 0x31, 0xc9, 0x56, 0x66, 0x0c, 0xfe, 0xa4, 0x90,
+	0xfe, 0x41, 0x62, 0xa4, 0x84, 0xfe, 0xbc, 0x08, 0xa3, 0x76, 0x9c, 0xbb, 0xfe, 0x7a, 0x03, 0x3b,
+	0xa3, 0x49, 0x46, 0x6f, 0x79, 0xc0, 0x66, 0xa0, 0x7a, 0x6f, 0x78, 0x6d, 0xc3, 0x20, 0xc5, 0x5e,
+	0xc0, 0xa0, 0x8a, 0x69, 0x22, 0x69, 0x76, 0x7a, 0xa1, 0x95, 0xfe, 0x8a, 0xe4, 0xfe, 0xcc, 0x46,
+	0xa0, 0xa7, 0x9d, 0xab, 0xfe, 0x72, 0x02, 0x9a, 0x8d, 0xfe, 0xa4, 0xb0, 0xfe, 0xff, 0x9d, 0x31,
+	0xd1, 0x2c, 0x55, 0x7e, 0x5a, 0x1d, 0x25, 0x9a, 0xcb, 0xfe, 0x9c, 0x90, 0xfe, 0x49, 0xc5, 0x9b,
+	0xaa, 0x1c, 0xac, 0x13, 0xfe, 0xde, 0xda, 0x31, 0x9d, 0x9a, 0xa3, 0x66, 0x31, 0xce, 0x2e, 0xc2,
+	0x51, 0x2a, 0x61, 0xfe, 0xd6, 0x16, 0xfe, 0x7b, 0x2a, 0xfe, 0x49, 0x42, 0xfe, 0x7a, 0x41, 0xfe,
+	0xc3, 0xe4, 0xa6, 0x65, 0x9c, 0xba, 0xc0, 0x9b, 0x8d, 0xfe, 0x69, 0xc0, 0x11, 0xa0, 0x6a, 0x29,
+	0x24, 0x76, 0x7a, 0x59, 0xc0, 0x27, 0xc0, 0x20, 0x1b, 0x27, 0x6e, 0xc2, 0x55, 0xc0, 0x24, 0x29,
+	0xc0, 0x2c, 0x27, 0x2c, 0xc0, 0x5b, 0xc0, 0x2b, 0x27, 0x20, 0x65, 0xc0, 0x1b, 0xa2, 0x76, 0xc0,
+	0x23, 0x0d, 0x65, 0x7a, 0x11, 0xa1, 0x97, 0x7e, 0xa3, 0x87, 0xa7, 0x44, 0xa6, 0x73, 0xa4, 0x83,
+	0xa2, 0x76, 0x68, 0x58, 0xa2, 0x75, 0xa3, 0x74, 0xa4, 0x65, 0xa3, 0x56, 0x6f, 0x9d, 0xba, 0x9b,
+	0xab, 0x9d, 0xab, 0x66, 0x9f, 0xb9, 0xa0, 0x7b, 0xa1, 0x69, 0x5b, 0x9c, 0x9b, 0x99, 0xbd, 0x99,
+	0xbe, 0x52, 0x9d, 0x9b, 0x9e, 0x79, 0x55, 0x9f, 0x8b, 0x5b, 0x29, 0x66, 0xc0, 0x2c, 0x66, 0x55,
+	0x27, 0xc5, 0x2b, 0xc5, 0x30, 0xc0, 0x7a, 0x30, 0xc1, 0x2c, 0x59, 0xc0, 0x66, 0xc1, 0x7e, 0x2c,
+	0xc0, 0x22, 0xc1, 0x25, 0x19, 0xc1, 0x66, 0x5a, 0x20, 0x1d, 0x18, 0x24, 0x55, 0xfe, 0x63, 0x4c,
+	0x21, 0xa8, 0x44, 0xfd, 0xef, 0x66, 0x31, 0x2c, 0xfe, 0xa5, 0x34, 0xfe, 0x31, 0xa6, 0xa5, 0x66,
+	0xfe, 0xce, 0x58, 0x2c, 0x69, 0x31, 0x93, 0xff, 0xfe, 0x4a, 0x49, 0x99, 0xcb, 0xab, 0x23, 0xa9,
+	0x43, 0xa2, 0x77, 0xa2, 0x67, 0x66, 0x55, 0x19, 0xc1, 0x9b, 0xba, 0xfe, 0x39, 0xe7, 0xa4, 0x66,
+	0xfe, 0xce, 0x79, 0xab, 0x33, 0x69, 0x31, 0x25, 0x2c, 0x31, 0xc0, 0x2c, 0xc0, 0x9d, 0xa9, 0xfe,
+	0x94, 0xb2, 0x11, 0x1c, 0x05, 0x14, 0xa2, 0x77, 0x14, 0xc0, 0x19, 0xc4, 0x05, 0x19, 0x14, 0xc0,
+	0x05, 0x95, 0xde, 0x38, 0xa5, 0x55, 0xad, 0x21, 0xa4, 0x56, 0x05, 0x14, 0xc0, 0x9d, 0x99, 0x94,
+	0xee, 0x3d, 0x35, 0xfe, 0xde, 0xda, 0xa9, 0x34, 0xcd, 0x65, 0x31, 0x9d, 0xa9, 0x25, 0x9a, 0xbb,
+	0xfe, 0x94, 0x91, 0x99, 0xbc, 0xfe, 0xc6, 0x38, 0xa9, 0x43, 0x95, 0xde, 0x05, 0x39, 0x98, 0xcc,
+	0xb1, 0x00, 0xfe, 0xde, 0xfb, 0x31, 0xc0, 0x65, 0xc0, 0x2c, 0x31, 0x96, 0xdd, 0xfe, 0x7b, 0xef,
+	0xfe, 0x31, 0x85, 0x9c, 0xaa, 0xaa, 0x33, 0xa6, 0x55, 0x98, 0xcc, 0x09, 0x38, 0x55, 0xa8, 0x54,
+	0xfe, 0xb5, 0x75, 0xfe, 0xef, 0x7d, 0xa4, 0x66, 0x66, 0xc0, 0x31, 0xc7, 0x9d, 0x9b, 0x2c, 0x99,
+	0xdb, 0xfe, 0x7b, 0x2a, 0xfe, 0x41, 0x00, 0xfe, 0x8b, 0x05, 0xaa, 0x61, 0x79, 0x99, 0xcd, 0xfe,
+	0x71, 0x80, 0x9b, 0x8d, 0xa3, 0x48, 0x41, 0xa2, 0x67, 0x79, 0xc0, 0x67, 0xa0, 0x7a, 0x6b, 0x20,
+	0xcb, 0x6e, 0x5a, 0xa0, 0x8a, 0x69, 0x22, 0x69, 0x19, 0x7a, 0x9f, 0xa6, 0xaa, 0x60, 0xfe, 0xcc,
+	0x26, 0xa2, 0x95, 0x62, 0xfe, 0x8a, 0xa3, 0xfe, 0x49, 0x40, 0xfe, 0x8b, 0x6a, 0xfe, 0xe6, 0xb9,
+	0xa9, 0x24, 0x6f, 0xc5, 0x2c, 0x31, 0xcb, 0x25, 0x2a, 0x0c, 0xfe, 0x9c, 0x4e, 0xfe, 0x51, 0xc3,
+	0x9d, 0xaa, 0xac, 0x21, 0x98, 0xcc, 0x57, 0xfe, 0xbd, 0x73, 0x2a, 0x31, 0x56, 0x31, 0xcb, 0x2c,
+	0x31, 0xc1, 0x5a, 0x29, 0x65, 0x25, 0x60, 0xfe, 0xc5, 0x93, 0xfe, 0x7a, 0xe8, 0xfe, 0x51, 0x20,
+	0xa5, 0x65, 0xfe, 0xb3, 0x85, 0xa7, 0x51, 0x67, 0xc0, 0x53, 0xfe, 0x8a, 0x83, 0x96, 0xaf, 0x15,
+	0xa0, 0x7a, 0x24, 0xc0, 0x7a, 0x66, 0x27, 0x20, 0xc3, 0x19, 0x7a, 0xc0, 0x65, 0xc1, 0x15, 0xc0,
+	0x19, 0x15, 0xc0, 0x76, 0xc0, 0x10, 0xc0, 0x17, 0x1c, 0xc0, 0x10, 0xc1, 0x17, 0x5a, 0xc1, 0x19,
+	0x7f, 0x9d, 0x99, 0x7e, 0x10, 0xc0, 0x13, 0x6e, 0xa2, 0x96, 0xa7, 0x62, 0xa7, 0x64, 0xa7, 0x42,
+	0xa2, 0x84, 0x68, 0x7d, 0x7d, 0xa3, 0x76, 0xc0, 0x14, 0x9d, 0xab, 0x6e, 0xa1, 0x79, 0x66, 0x9e,
+	0x8c, 0x31, 0x9a, 0x9b, 0x99, 0xbd, 0x9c, 0x9c, 0x53, 0x57, 0x6e, 0xc0, 0x10, 0xa0, 0x8a, 0x5a,
+	0xc2, 0x7e, 0xc0, 0x7e, 0x1c, 0x17, 0xc1, 0x1c, 0xc0, 0x23, 0x5a, 0xcb, 0x19, 0x69, 0xc1, 0x19,
+	0x1c, 0x19, 0xc0, 0x1c, 0xc1, 0x12, 0x0d, 0x1c, 0x6e, 0xc0, 0x1c, 0x19, 0x20, 0x5a, 0xc0, 0x56,
+	0xa3, 0x76, 0xfe, 0x94, 0x92, 0xfe, 0xef, 0x7e, 0xa4, 0x65, 0xfd, 0xef, 0x66, 0x31, 0x51, 0xfe,
+	0x94, 0xb2, 0x38, 0xfe, 0x7b, 0xce, 0x09, 0xa3, 0x76, 0xc0, 0x52, 0xfe, 0x9c, 0xd2, 0x38, 0xa3,
+	0x66, 0xaf, 0x10, 0xa5, 0x66, 0x9c, 0x9a, 0xa4, 0x66, 0x51, 0x7e, 0x0a, 0x19, 0x66, 0x96, 0xdc,
+	0x93, 0xef, 0xb0, 0x00, 0xfe, 0xe7, 0x5c, 0x1d, 0xa2, 0x77, 0xc0, 0x65, 0x31, 0xc1, 0x1d, 0x31,
+	0x92, 0xff, 0xfe, 0x4a, 0x49, 0x55, 0xae, 0x11, 0x14, 0xc0, 0x05, 0x19, 0xc7, 0x05, 0x19, 0x05,
+	0x95, 0xee, 0x97, 0xcc, 0x11, 0x09, 0x19, 0x14, 0x05, 0x14, 0x05, 0x95, 0xdd, 0x29, 0xa8, 0x44,
+	0xfe, 0xbd, 0xd6, 0x2c, 0x1d, 0xa2, 0x77, 0xcc, 0x65, 0x31, 0x9d, 0xa9, 0x9a, 0xbb, 0xfe, 0x84,
+	0x30, 0x99, 0xcb, 0xfe, 0xc6, 0x38, 0xa3, 0x76, 0x19, 0xfe, 0x4a, 0x48, 0x29, 0x9d, 0xa9, 0x6f,
+	0xa5, 0x66, 0x05, 0xfe, 0xde, 0xfb, 0x31, 0xc0, 0x2c, 0x1d, 0x99, 0xcb, 0xfe, 0x7b, 0xef, 0xfe,
+	0x31, 0xa6, 0x65, 0xa4, 0x66, 0x6b, 0x19, 0x9a, 0xbb, 0x6b, 0x1d, 0x39, 0xfe, 0xad, 0x55, 0x11,
+	0xa3, 0x67, 0x2c, 0xc0, 0x31, 0x2c, 0x31, 0xc2, 0x2a, 0xc0, 0x31, 0xc0, 0x52, 0x2c, 0xfe, 0xd6,
+	0x17, 0xfe, 0x62, 0x26, 0x9b, 0xb8, 0xfe, 0xab, 0xc7, 0xa4, 0x93, 0x61, 0x9a, 0xbb, 0xfe, 0x81,
+	0xc0, 0x9d, 0x8b, 0xa2, 0x48, 0x41, 0x5a, 0x61, 0xc0, 0x66, 0xa0, 0x7b, 0x1b, 0x6e, 0xcb, 0x6e,
+	0x5a, 0xa0, 0x8a, 0x29, 0x22, 0x69, 0x76, 0x08, 0x9f, 0xb7, 0xa8, 0x60, 0xfe, 0xbb, 0xa3, 0xa4,
+	0x86, 0x7a, 0x9e, 0x5c, 0xfe, 0x61, 0x80, 0xa2, 0x59, 0xfe, 0xbd, 0x32, 0xfe, 0xff, 0xbe, 0x31,
+	0x55, 0x31, 0xc3, 0x2c, 0x31, 0xc7, 0x51, 0xc0, 0x7e, 0x2c, 0x9e, 0x97, 0x95, 0xfd, 0xfe, 0x83,
+	0x8b, 0xfe, 0x51, 0xa3, 0x79, 0xa9, 0x53, 0xa9, 0x33, 0x96, 0xdd, 0x96, 0xce, 0xfe, 0x8b, 0x8b,
+	0xfe, 0xef, 0x1a, 0x31, 0x2e, 0x31, 0xcb, 0x51, 0x2a, 0x31, 0xc0, 0x2e, 0x31, 0xc0, 0x99, 0xdb,
+	0xfe, 0xb4, 0xf1, 0xfe, 0x6a, 0x25, 0x98, 0xdb, 0xa6, 0x73, 0xac, 0x31, 0xa6, 0x52, 0xa2, 0x85,
+	0x57, 0xa1, 0x69, 0x97, 0xbf, 0x1c, 0x9e, 0x7a, 0xa1, 0x69, 0x5b, 0x6b, 0xc0, 0x1d, 0x7a, 0xc3,
+	0x7d, 0x61, 0x55, 0x09, 0x00, 0xc0, 0x7e, 0x6e, 0x7e, 0xc0, 0x6f, 0x7a, 0x79, 0xc1, 0x5a, 0x24,
+	0x6e, 0x5b, 0x66, 0x1c, 0x65, 0x0d, 0x0f, 0x5e, 0x6b, 0x6f, 0x5a, 0x19, 0xa2, 0x77, 0x56, 0x19,
+	0x66, 0x6f, 0xc0, 0x17, 0x0e, 0xa4, 0x74, 0xa8, 0x52, 0xa9, 0x41, 0xa4, 0x83, 0xa2, 0x85, 0x60,
+	0xa2, 0x76, 0xc0, 0x04, 0x6b, 0xa2, 0x77, 0x23, 0x9d, 0x7b, 0x97, 0xcf, 0x97, 0xcf, 0x9b, 0x9c,
+	0x4a, 0xa1, 0x79, 0x17, 0x57, 0x69, 0x17, 0x14, 0x16, 0x0f, 0x79, 0xc1, 0x69, 0x7a, 0x6e, 0x07,
+	0x00, 0xc0, 0x07, 0x0c, 0xc0, 0x07, 0x04, 0xc6, 0x09, 0xc1, 0x04, 0xc0, 0x0c, 0xc0, 0x09, 0x0c,
+	0xc0, 0x6e, 0x0c, 0x55, 0x09, 0x0c, 0xc3, 0x04, 0xc0, 0x6f, 0xc0, 0x19, 0xc0, 0x25, 0x52, 0x39,
+	0xfe, 0xbd, 0xf8, 0xaf, 0x00, 0x31, 0xfd, 0xf1, 0x9d, 0xaa, 0xfe, 0x84, 0x10, 0xfe, 0x29, 0x45,
+	0xfe, 0xa4, 0xf3, 0x31, 0x65, 0x6b, 0x96, 0xdc, 0xfe, 0x52, 0xaa, 0x96, 0xed, 0xa9, 0x34, 0xad,
+	0x11, 0xa4, 0x66, 0x9a, 0xcb, 0xa3, 0x67, 0x69, 0x6f, 0x05, 0x14, 0x9b, 0xaa, 0x92, 0xff, 0x24,
+	0xfe, 0x94, 0x92, 0xfe, 0xf7, 0xbe, 0x31, 0xc0, 0x25, 0x31, 0xc1, 0x1d, 0xc0, 0x9d, 0xaa, 0x00,
+	0xfe, 0x29, 0x65, 0xb1, 0x00, 0x28, 0x14, 0x28, 0x05, 0x14, 0x19, 0xc5, 0x6e, 0x05, 0x00, 0x98,
+	0xcc, 0x94, 0xdd, 0x7f, 0xac, 0x22, 0x05, 0x19, 0x14, 0x19, 0x00, 0x35, 0x95, 0xed, 0x6b, 0x2d,
+	0xfe, 0xef, 0x7d, 0x31, 0x9d, 0xaa, 0xa2, 0x77, 0x31, 0xcb, 0x1d, 0x25, 0x95, 0xde, 0xfe, 0x73,
+	0xae, 0x94, 0xee, 0xfe, 0xa5, 0x34, 0xc0, 0x35, 0x29, 0x55, 0x2e, 0x29, 0x38, 0x50, 0x38, 0x00,
+	0xfe, 0xc6, 0x38, 0xa7, 0x55, 0x51, 0x96, 0xdc, 0xfe, 0x73, 0x8e, 0x29, 0x9b, 0xbb, 0x3d, 0xa4,
+	0x66, 0x05, 0x1d, 0x38, 0x69, 0xa6, 0x56, 0xfe, 0xb5, 0x96, 0xb0, 0x00, 0x2c, 0x6e, 0x2c, 0x31,
+	0xc0, 0x2c, 0x31, 0xc2, 0x2a, 0xc0, 0x31, 0xc0, 0x2c, 0x66, 0xfe, 0xac, 0xb2, 0xfe, 0x51, 0x83,
+	0xa6, 0x62, 0xfe, 0xbc, 0x27, 0xa1, 0xc3, 0x7a, 0x9d, 0xab, 0x9d, 0x8b, 0xa0, 0x6a, 0xa0, 0x6a,
+	0x45, 0x9d, 0xa9, 0x9d, 0xa9, 0x9d, 0x9a, 0x9d, 0xab, 0x9c, 0x9d, 0x9d, 0x8b, 0xa2, 0x58, 0x20,
+	0xca, 0x6d, 0x5b, 0x29, 0xc0, 0x22, 0x69, 0x1e, 0x76, 0xa3, 0x94, 0xa7, 0x61, 0xa8, 0x61, 0xa5,
+	0x85, 0x7e, 0xa1, 0x5b, 0xfe, 0x8a, 0xa4, 0x95, 0xcf, 0xfe, 0x7b, 0x09, 0xfe, 0xd6, 0x37, 0x31,
+	0xc0, 0x5a, 0x31, 0xc1, 0x66, 0xc0, 0x31, 0xc4, 0x2c, 0x69, 0x56, 0x18, 0x31, 0x2c, 0x9a, 0xbb,
+	0xfe, 0xac, 0xf2, 0xfe, 0x6a, 0xc8, 0xfe, 0x49, 0x41, 0xa4, 0x75, 0xac, 0x31, 0xa7, 0x64, 0x55,
+	0x9d, 0xaa, 0x94, 0xcf, 0x9d, 0x8b, 0xfe, 0x9c, 0x4e, 0xfe, 0xe6, 0xfa, 0xa7, 0x46, 0x31, 0xcb,
+	0x69, 0xc0, 0x25, 0x56, 0x6f, 0x30, 0x96, 0xec, 0xfe, 0x8b, 0xcd, 0xfe, 0x51, 0xa4, 0x9b, 0xc9,
+	0xa9, 0x61, 0xac, 0x31, 0xa5, 0x74, 0x68, 0x6e, 0x57, 0x99, 0x9e, 0xfe, 0x6a, 0x03, 0x98, 0xae,
+	0xa3, 0x58, 0x20, 0x5a, 0xc2, 0x6e, 0x1d, 0xc0, 0x20, 0x65, 0x69, 0x7e, 0xa1, 0x97, 0x79, 0xa2,
+	0x76, 0xa4, 0x75, 0xa4, 0x65, 0x0a, 0xa2, 0x87, 0x7e, 0x7f, 0x7e, 0x69, 0x7a, 0xc0, 0x39, 0x00,
+	0x6e, 0x5b, 0x66, 0x51, 0x65, 0x52, 0x9d, 0x9a, 0x9c, 0x9a, 0x9c, 0xab, 0x9d, 0x8a, 0x46, 0x52,
+	0xa2, 0x67, 0x5b, 0x6f, 0xc0, 0x6b, 0x14, 0x20, 0x7f, 0x9d, 0xa8, 0x05, 0xa5, 0x84, 0xa8, 0x51,
+	0xa8, 0x62, 0xa3, 0x85, 0x7e, 0x66, 0xc0, 0x6f, 0x9d, 0xaa, 0x9b, 0x8c, 0xfe, 0x72, 0x22, 0x98,
+	0xbf, 0x43, 0xa3, 0x57, 0xc0, 0x46, 0x7b, 0x55, 0x14, 0x6d, 0x79, 0xa0, 0x8a, 0x7e, 0x05, 0xa2,
+	0x77, 0xa2, 0x76, 0x66, 0x79, 0x6e, 0xa2, 0x77, 0x7a, 0xc0, 0x6e, 0x39, 0x55, 0x22, 0x1d, 0xc4,
+	0x66, 0xc0, 0x1d, 0xc1, 0x18, 0x5a, 0x62, 0x5a, 0x03, 0xc2, 0x08, 0xc3, 0x0b, 0x08, 0x6f, 0x56,
+	0x6f, 0x24, 0xc0, 0x9d, 0x9a, 0x5f, 0xa2, 0x77, 0x52, 0xfe, 0x73, 0x8e, 0xfe, 0xdf, 0x1c, 0xa7,
+	0x44, 0xc0, 0x31, 0xfd, 0xf0, 0x9c, 0xaa, 0xfe, 0x73, 0xae, 0xfe, 0x29, 0x24, 0xfe, 0xad, 0x75,
+	0x31, 0x61, 0x31, 0xfe, 0xad, 0x34, 0xfe, 0x29, 0x45, 0xa2, 0x77, 0xaf, 0x00, 0xa7, 0x54, 0x6b,
+	0xc0, 0x6e, 0x14, 0x19, 0x14, 0x55, 0x97, 0xdd, 0x92, 0xfe, 0xa2, 0x77, 0xfe, 0xbd, 0xd7, 0x2c,
+	0x6e, 0xc0, 0x9d, 0xaa, 0x31, 0xc1, 0x2c, 0xc0, 0x91, 0xff, 0xfe, 0x4a, 0x69, 0x55, 0xae, 0x22,
+	0x19, 0x05, 0x19, 0x7f, 0x14, 0xc0, 0x19, 0xc0, 0x14, 0xc2, 0x05, 0x19, 0x99, 0xcc, 0x93, 0xee,
+	0x9a, 0xbb, 0xac, 0x22, 0xa9, 0x44, 0x14, 0xa2, 0x76, 0x14, 0x69, 0x09, 0x11, 0x97, 0xdd, 0xfe,
+	0x73, 0x8d, 0xfe, 0xde, 0xfb, 0x31, 0xcf, 0x65, 0x95, 0xde, 0x35, 0x93, 0xfe, 0x09, 0xa5, 0x65,
+	0xfe, 0x42, 0x07, 0x15, 0x24, 0x31, 0x56, 0xc0, 0x15, 0x1d, 0x24, 0x38, 0x29, 0xa4, 0x66, 0xa2,
+	0x77, 0x11, 0x1d, 0x66, 0x29, 0xc0, 0x31, 0x3d, 0x24, 0x29, 0xa8, 0x44, 0xfe, 0xbd, 0xf7, 0xb0,
+	0x00, 0x66, 0xc0, 0x31, 0x2c, 0x31, 0xc0, 0x2c, 0x31, 0xc2, 0x69, 0xc0, 0x31, 0x56, 0x2c, 0x9b,
+	0xcb, 0xfe, 0x93, 0xad, 0xfe, 0x49, 0x41, 0xfe, 0x8a, 0xe5, 0xfe, 0xcc, 0x68, 0x9d, 0xe5, 0x7e,
+	0x66, 0xa2, 0x68, 0xa0, 0x7a, 0x5b, 0x5e, 0x65, 0x65, 0x6b, 0x52, 0x9c, 0x9c, 0x9c, 0x9c, 0x96,
+	0xbe, 0x5b, 0x51, 0x56, 0x56, 0x5a, 0x6b, 0x5a, 0xc0, 0x6f, 0xc0, 0x66, 0x20, 0x5e, 0xc0, 0x6b,
+	0xc0, 0x20, 0x69, 0x10, 0x7e, 0xfe, 0x8a, 0xe6, 0xaa, 0x50, 0xa1, 0xa5, 0xa0, 0xa7, 0x51, 0xa1,
+	0x69, 0x9e, 0x7b, 0xfe, 0x7a, 0x01, 0x0b, 0xfe, 0x72, 0xc8, 0xfe, 0xcd, 0xf6, 0xab, 0x23, 0xa4,
+	0x56, 0x6b, 0x31, 0x2c, 0xc1, 0x31, 0xc6, 0x60, 0x51, 0x9c, 0xaa, 0xfe, 0xb5, 0x33, 0xfe, 0x5a,
+	0x88, 0x97, 0xfb, 0x03, 0xa8, 0x52, 0xa9, 0x52, 0xa7, 0x53, 0xa2, 0x98, 0x55, 0x56, 0x98, 0xad,
+	0x0b, 0xa6, 0x35, 0xfe, 0xac, 0xd0, 0xfe, 0xde, 0xda, 0xa7, 0x45, 0x25, 0x31, 0xc0, 0x2c, 0x31,
+	0xc0, 0x2c, 0xc0, 0x31, 0xc1, 0x2c, 0x31, 0x2a, 0x9d, 0xa9, 0x9d, 0xaa, 0x9b, 0xba, 0xfe, 0x94,
+	0x2f, 0xfe, 0x41, 0x83, 0x79, 0x70, 0xac, 0x40, 0xa9, 0x52, 0xa2, 0x86, 0x7a, 0x59, 0x5f, 0x99,
+	0xad, 0xfe, 0x69, 0xe2, 0x9a, 0x9d, 0x4b, 0xa3, 0x58, 0x56, 0x66, 0x69, 0xc0, 0x79, 0xc0, 0x0d,
+	0x7a, 0xa2, 0x76, 0x25, 0xa1, 0x97, 0xa6, 0x54, 0xa5, 0x74, 0xa6, 0x64, 0x7e, 0xa2, 0x86, 0xa2,
+	0x66, 0x2e, 0x55, 0x76, 0xc0, 0x7a, 0x6e, 0x79, 0x66, 0x20, 0xc0, 0x6f, 0xc0, 0x5a, 0x1d, 0x66,
+	0xc0, 0x6f, 0x6f, 0x66, 0x9d, 0x8a, 0x9a, 0xac, 0x9b, 0xaa, 0x98, 0xbe, 0x5a, 0x47, 0x56, 0x0d,
+	0x19, 0x6f, 0x57, 0x25, 0x17, 0x9f, 0x96, 0x15, 0x1d, 0xaa, 0x51, 0xa4, 0x75, 0x20, 0xc0, 0x57,
+	0x97, 0xcd, 0x97, 0xae, 0x99, 0x8f, 0x17, 0xa1, 0x79, 0x5a, 0x55, 0xa2, 0x77, 0x2f, 0x65, 0x7c,
+	0x79, 0x69, 0x7e, 0xa3, 0x86, 0xa5, 0x74, 0xa5, 0x55, 0xa4, 0x66, 0xa2, 0x87, 0x6e, 0xa2, 0x87,
+	0xc3, 0x55, 0x16, 0x65, 0x7b, 0xc4, 0x11, 0xc0, 0x14, 0xc1, 0x11, 0xc0, 0x62, 0x56, 0x65, 0x5a,
+	0xc2, 0x33, 0xc0, 0x30, 0xc2, 0x56, 0x6f, 0x6e, 0xa0, 0x7a, 0x9a, 0xac, 0x97, 0xbe, 0x23, 0x5e,
+	0x22, 0xfe, 0x8c, 0x91, 0xfe, 0xf7, 0xbe, 0x6f, 0x7e, 0xfd, 0xef, 0x1d, 0x31, 0x9c, 0xaa, 0xfe,
+	0x7b, 0xef, 0x2c, 0xfe, 0xad, 0x34, 0xfe, 0xff, 0xdf, 0x1d, 0x09, 0xfe, 0x6b, 0x4d, 0xfe, 0x31,
+	0x65, 0xa8, 0x44, 0xae, 0x01, 0xc0, 0x7e, 0x6b, 0xc0, 0x6e, 0x9d, 0xa9, 0xa4, 0x67, 0x9b, 0xba,
+	0x92, 0xef, 0x99, 0xcb, 0xa5, 0x56, 0xfe, 0xde, 0xba, 0xa8, 0x44, 0xa2, 0x67, 0xc0, 0x66, 0x31,
+	0xc1, 0x2c, 0x9b, 0xaa, 0xfe, 0x73, 0xae, 0x11, 0xac, 0x22, 0x14, 0xc0, 0x19, 0xc5, 0x14, 0x05,
+	0x0d, 0x14, 0xc0, 0x9c, 0xa9, 0x96, 0xdd, 0x24, 0xa6, 0x54, 0xae, 0x01, 0x14, 0x0d, 0x14, 0x6e,
+	0x9b, 0xbb, 0x94, 0xee, 0x99, 0xbb, 0xa8, 0x44, 0xfe, 0xce, 0x58, 0xac, 0x23, 0x31, 0xcb, 0x2c,
+	0x31, 0x20, 0x5a, 0x95, 0xee, 0x09, 0xfe, 0x21, 0x44, 0xa7, 0x55, 0xa8, 0x44, 0x95, 0xee, 0x29,
+	0xc0, 0xa2, 0x77, 0x11, 0x65, 0x3d, 0xc0, 0x9d, 0xa9, 0xc0, 0x29, 0x61, 0x29, 0xc0, 0x24, 0xa2,
+	0x76, 0x24, 0xc0, 0x7e, 0x24, 0xc0, 0x29, 0xab, 0x33, 0xfe, 0xbd, 0xd7, 0xaf, 0x00, 0x7f, 0xc0,
+	0x6e, 0xc7, 0x69, 0x5a, 0x6b, 0xc0, 0x66, 0x2c, 0xfe, 0xde, 0x59, 0xfe, 0x72, 0x67, 0x0b, 0xfe,
+	0xa3, 0x66, 0xa7, 0x72, 0x9f, 0xc5, 0x69, 0xc0, 0x66, 0x6b, 0x11, 0xc0, 0x0c, 0x56, 0xc0, 0x6e,
+	0x7f, 0x6f, 0x9c, 0xac, 0x42, 0x9c, 0x9b, 0x9b, 0x9c, 0x9b, 0x9b, 0x9c, 0x8b, 0x47, 0x5b, 0x5a,
+	0x6f, 0x6b, 0x1b, 0xa2, 0x66, 0x4a, 0x6e, 0x67, 0x76, 0x7a, 0x75, 0x9e, 0xb7, 0xa3, 0x84, 0x33,
+	0xa8, 0x62, 0x9d, 0xb7, 0xa0, 0xa7, 0x69, 0xa0, 0x7a, 0x5b, 0x9b, 0x9c, 0xfe, 0x81, 0xe0, 0x99,
+	0x9f, 0xa9, 0x24, 0xfe, 0x9c, 0x2f, 0xfe, 0xce, 0x18, 0xa7, 0x45, 0xa5, 0x56, 0x2c, 0xc1, 0x2e,
+	0xc1, 0x66, 0x66, 0x61, 0x9d, 0xa9, 0x9b, 0xaa, 0x99, 0xca, 0x96, 0xec, 0x94, 0xfd, 0x96, 0xed,
+	0x50, 0xa3, 0x96, 0xa9, 0x52, 0xa8, 0x52, 0xa3, 0x74, 0x21, 0x77, 0x56, 0x6b, 0x4a, 0x97, 0xad,
+	0x15, 0xa2, 0x58, 0xae, 0x04, 0xfe, 0xbd, 0x95, 0xa9, 0x23, 0xa5, 0x66, 0xa3, 0x76, 0x6e, 0x6f,
+	0x31, 0x2a, 0x2c, 0xc0, 0x65, 0x51, 0x52, 0x9d, 0x89, 0x9d, 0x99, 0xfe, 0xad, 0x12, 0x94, 0xed,
+	0x96, 0xeb, 0x98, 0xcc, 0xa3, 0x86, 0xa6, 0x73, 0xa7, 0x73, 0xa7, 0x73, 0x65, 0x6b, 0xa2, 0x68,
+	0x46, 0x99, 0x9c, 0xfe, 0x61, 0xc1, 0x9d, 0x7a, 0xa0, 0x6a, 0xa0, 0x7a, 0x5b, 0xa2, 0x77, 0x9d,
+	0xaa, 0x75, 0xa0, 0xa7, 0x75, 0xa1, 0x97, 0xa4, 0x64, 0xa3, 0x76, 0xa4, 0x75, 0xa6, 0x64, 0xa4,
+	0x75, 0xa2, 0x85, 0x7d, 0x7e, 0x54, 0xc0, 0x6e, 0xc1, 0x7b, 0x66, 0x6b, 0xc1, 0x6b, 0x6e, 0xc1,
+	0x23, 0x19, 0x1c, 0x15, 0xc0, 0x5a, 0x15, 0x66, 0x15, 0x21, 0x1c, 0x9c, 0x9c, 0x9b, 0x9c, 0x9a,
+	0x9c, 0x9c, 0x8c, 0x9d, 0x7a, 0x53, 0x5f, 0x6b, 0x56, 0x6e, 0xc0, 0x19, 0xa0, 0xa7, 0xa5, 0x73,
+	0xab, 0x41, 0xa6, 0x74, 0x6f, 0x99, 0xbc, 0xfe, 0x69, 0x81, 0x9c, 0x8b, 0x17, 0xc0, 0x6f, 0x5a,
+	0x65, 0x69, 0x79, 0xa3, 0x85, 0xa4, 0x75, 0xa4, 0x85, 0xa5, 0x63, 0xa4, 0x86, 0xa3, 0x75, 0xa0,
+	0xa8, 0x1c, 0xdd, 0x17, 0x7e, 0x69, 0x15, 0x7f, 0x1c, 0xc0, 0x65, 0xa2, 0x67, 0x5f, 0xa0, 0x7b,
+	0xfe, 0x92, 0xe6, 0xfe, 0x49, 0x22, 0xa0, 0x5a, 0x5f, 0xa5, 0x54, 0xfe, 0xb5, 0xd5, 0xfe, 0xff,
+	0xfd, 0x63, 0x6f, 0x6e, 0xfd, 0xee, 0x2c, 0x31, 0x51, 0xfe, 0x94, 0xb2, 0xfe, 0x31, 0xa6, 0xb1,
+	0x00, 0xfe, 0xe6, 0xfb, 0x31, 0x94, 0xfe, 0xfe, 0x52, 0x69, 0x3d, 0xad, 0x22, 0xa9, 0x33, 0x66,
+	0x19, 0x14, 0xc0, 0x19, 0x65, 0xa2, 0x77, 0x04, 0x93, 0xfe, 0x41, 0xa9, 0x44, 0xfe, 0xe6, 0xfc,
+	0xa7, 0x44, 0x31, 0xc0, 0x2c, 0x31, 0xc0, 0x1d, 0x31, 0xfe, 0xbd, 0xf7, 0xfe, 0x4a, 0x49, 0x08,
+	0x14, 0xc1, 0x19, 0xc3, 0x14, 0x0d, 0x19, 0x0d, 0x56, 0x19, 0x05, 0x94, 0xee, 0x29, 0x3d, 0xae,
+	0x11, 0xa7, 0x54, 0xc0, 0x19, 0x05, 0x51, 0x98, 0xcc, 0x95, 0xee, 0xa2, 0x76, 0xfe, 0xb5, 0x95,
+	0xb0, 0x00, 0xa3, 0x67, 0x2c, 0x31, 0xcc, 0x1d, 0x98, 0xcc, 0xfe, 0x73, 0x8e, 0x29, 0x66, 0x3d,
+	0x65, 0xa2, 0x78, 0x39, 0x21, 0x09, 0xa2, 0x77, 0xc0, 0x35, 0x9c, 0xaa, 0x0c, 0x9b, 0xba, 0x24,
+	0xc0, 0x69, 0x24, 0x7e, 0x41, 0x29, 0x38, 0x18, 0x1d, 0x24, 0x21, 0xfe, 0xbd, 0xd7, 0xaf, 0x00,
+	0x7f, 0x51, 0x2c, 0x6e, 0xc7, 0x69, 0x5a, 0xc0, 0x2e, 0x31, 0x9d, 0xab, 0xfe, 0xa4, 0xb2, 0xfe,
+	0x49, 0x64, 0xa5, 0x73, 0xfe, 0xb4, 0x09, 0xa3, 0x85, 0x9f, 0xb6, 0xc0, 0x7e, 0x25, 0xc0, 0x69,
+	0x7b, 0xc0, 0x55, 0xc0, 0x1c, 0xc0, 0x56, 0x28, 0x56, 0xc0, 0x46, 0x9c, 0xab, 0x9c, 0x8b, 0x9c,
+	0x9b, 0x9a, 0xad, 0x9b, 0x9c, 0x56, 0xa0, 0x7a, 0x1b, 0x6f, 0x22, 0xc0, 0x6b, 0x6b, 0x27, 0x74,
+	0x74, 0xa7, 0x72, 0xfe, 0xc3, 0xe7, 0xa4, 0x84, 0x1c, 0x79, 0x66, 0x5b, 0x25, 0x57, 0x9b, 0x9d,
+	0x97, 0xae, 0x99, 0xad, 0x4b, 0xa6, 0x47, 0xaa, 0x34, 0xaa, 0x23, 0xa6, 0x55, 0xa3, 0x66, 0xa2,
+	0x87, 0x5e, 0x66, 0x11, 0x38, 0x9c, 0xaa, 0x9b, 0xbb, 0x9c, 0xa9, 0x95, 0xed, 0x99, 0xcb, 0x9e,
+	0xa7, 0xa2, 0x87, 0xa5, 0x64, 0xa6, 0x55, 0xa4, 0x94, 0xa4, 0x84, 0xa3, 0x74, 0x12, 0x79, 0x13,
+	0x6b, 0x6f, 0xa2, 0x47, 0x9e, 0x79, 0x97, 0xbf, 0x97, 0xbf, 0x9c, 0x8d, 0xa6, 0x35, 0xa7, 0x45,
+	0xaa, 0x33, 0xa7, 0x55, 0xa4, 0x66, 0xa2, 0x77, 0x6f, 0x28, 0x56, 0x51, 0x9c, 0xba, 0x9c, 0x9a,
+	0x9c, 0xaa, 0x97, 0xdc, 0x99, 0xca, 0x9a, 0xca, 0x79, 0xa3, 0x75, 0xa4, 0x66, 0xa8, 0x53, 0xa5,
+	0x74, 0xa2, 0xa5, 0xa0, 0xb6, 0x9c, 0xba, 0x6f, 0xa2, 0x68, 0x9a, 0x7d, 0xfe, 0x61, 0xe1, 0x98,
+	0xbf, 0xa2, 0x67, 0xa2, 0x68, 0x42, 0x6b, 0x65, 0x79, 0xa2, 0x86, 0xa3, 0x85, 0xa4, 0x85, 0xa5,
+	0x64, 0xa6, 0x63, 0x15, 0x7e, 0xc0, 0x79, 0x7a, 0x6e, 0x65, 0x1c, 0x21, 0x2d, 0x56, 0xc0, 0x5a,
+	0x67, 0x55, 0x56, 0x66, 0x6f, 0xc0, 0x55, 0x14, 0x0d, 0x7a, 0x24, 0x6e, 0x22, 0x25, 0x7f, 0x21,
+	0x19, 0x76, 0xc0, 0xa2, 0x67, 0x57, 0x46, 0x9b, 0x9c, 0x99, 0xbc, 0x9a, 0xac, 0x9c, 0x9b, 0x9e,
+	0x7a, 0xa0, 0x7a, 0xa2, 0x68, 0x6f, 0x20, 0x64, 0x3d, 0xa5, 0x74, 0xa9, 0x42, 0xa1, 0x89, 0x97,
+	0xcd, 0x99, 0xbd, 0xa2, 0x58, 0x20, 0xc0, 0x0d, 0x65, 0xa2, 0x96, 0xa5, 0x65, 0xa6, 0x63, 0xa4,
+	0x85, 0x05, 0xa2, 0x96, 0x7e, 0x79, 0xc0, 0x6d, 0x66, 0xd7, 0x1e, 0xc6, 0x12, 0x21, 0xc0, 0x12,
+	0xa2, 0x77, 0x15, 0xc0, 0x2a, 0x9e, 0x7b, 0xfe, 0x7a, 0x43, 0xfe, 0x41, 0x02, 0xa1, 0x69, 0x4f,
+	0xae, 0x00, 0xfe, 0xd6, 0xd9, 0xa9, 0x44, 0x66, 0x6b, 0x6e, 0xfd, 0xee, 0x2c, 0x31, 0x2c, 0xfe,
+	0xa5, 0x14, 0xfe, 0x39, 0xa6, 0xa2, 0x77, 0xfe, 0x94, 0x71, 0xfe, 0xf7, 0x7d, 0xfe, 0xb5, 0x75,
+	0xfe, 0x31, 0x86, 0xa5, 0x55, 0xaf, 0x10, 0xa3, 0x67, 0x66, 0x19, 0x65, 0x5a, 0x0d, 0x14, 0x0d,
+	0x93, 0xef, 0x24, 0xa2, 0x76, 0xad, 0x12, 0xfe, 0xef, 0x5d, 0xa5, 0x55, 0xc1, 0x66, 0x31, 0x2c,
+	0xc0, 0x31, 0x14, 0xfe, 0x42, 0x08, 0xab, 0x22, 0x19, 0x14, 0xc0, 0x19, 0xc3, 0x14, 0x69, 0x19,
+	0xc0, 0x14, 0xc0, 0x35, 0x94, 0xee, 0x51, 0xaa, 0x33, 0x14, 0xa2, 0x77, 0x50, 0x19, 0x0d, 0x9a,
+	0xbb, 0x93, 0xef, 0x29, 0xb1, 0x00, 0x04, 0x31, 0x2c, 0x69, 0x31, 0x25, 0x2c, 0x31, 0xc5, 0x2c,
+	0x31, 0x2c, 0x31, 0x98, 0xdc, 0xfe, 0x84, 0x30, 0x3d, 0x9d, 0xaa, 0x29, 0xc0, 0xa6, 0x55, 0x09,
+	0xa3, 0x76, 0x05, 0x19, 0x0d, 0x14, 0xc0, 0x39, 0x98, 0xcd, 0x00, 0x9c, 0x9a, 0x24, 0xc0, 0xa2,
+	0x76, 0x9c, 0xab, 0x31, 0x29, 0x24, 0x29, 0x7a, 0xab, 0x23, 0xfe, 0xce, 0x58, 0xab, 0x23, 0x7f,
+	0xc0, 0x6e, 0xc9, 0x2a, 0x5a, 0xc0, 0x6b, 0x31, 0x9a, 0xcc, 0xfe, 0x7b, 0x6e, 0xfe, 0x39, 0x23,
+	0xab, 0x40, 0xa7, 0x53, 0x74, 0xa2, 0x76, 0x75, 0xc0, 0x6f, 0xa2, 0x86, 0x7f, 0xc0, 0x7e, 0xa2,
+	0x77, 0x7e, 0xc0, 0x51, 0x65, 0x6d, 0x69, 0x7f, 0x6e, 0x6b, 0x22, 0x42, 0x29, 0x97, 0xbf, 0x99,
+	0xad, 0x9d, 0x8c, 0x5b, 0x6f, 0xa3, 0x64, 0x46, 0x9f, 0x9b, 0xc1, 0xa0, 0xa6, 0xa0, 0xa6, 0xfe,
+	0x8a, 0xa3, 0x38, 0x60, 0x60, 0x6f, 0x20, 0x5b, 0x5a, 0xa1, 0x79, 0xa2, 0x58, 0x42, 0x9b, 0x9c,
+	0x98, 0xbe, 0x97, 0xbd, 0x42, 0xc0, 0xa2, 0x77, 0xa3, 0x77, 0xa2, 0x67, 0x7a, 0x25, 0x65, 0x62,
+	0x51, 0x51, 0x65, 0xa2, 0x76, 0xa3, 0x76, 0xa8, 0x43, 0xa7, 0x63, 0xa4, 0x66, 0xa3, 0x76, 0x9d,
+	0xd7, 0x24, 0x1e, 0x7e, 0x61, 0x6b, 0x6b, 0x51, 0xa2, 0x57, 0xa3, 0x57, 0x4b, 0x9b, 0x9d, 0x99,
+	0xbe, 0x96, 0xae, 0x9d, 0x9b, 0x6e, 0x6f, 0xa2, 0x77, 0x19, 0x7f, 0x56, 0x19, 0x14, 0x00, 0x51,
+	0x51, 0x25, 0xa2, 0x86, 0xa4, 0x84, 0xa8, 0x54, 0xa6, 0x54, 0x39, 0xa3, 0x76, 0x9e, 0xb7, 0x9f,
+	0xb7, 0x9f, 0xb6, 0x65, 0x13, 0x5b, 0xfe, 0x92, 0xc3, 0x98, 0x8e, 0x9c, 0xab, 0x57, 0xa1, 0x79,
+	0x66, 0x61, 0x64, 0xa6, 0x64, 0xa8, 0x52, 0x29, 0xa4, 0x75, 0xa4, 0x74, 0x26, 0x68, 0xc0, 0x52,
+	0x66, 0x1a, 0x6b, 0x6b, 0x2c, 0x24, 0x53, 0x51, 0x9d, 0x9a, 0x9d, 0x89, 0x9d, 0x99, 0x41, 0x52,
+	0x51, 0x6b, 0xc2, 0x6e, 0x01, 0xa4, 0x66, 0xa3, 0x76, 0xa2, 0x86, 0xa4, 0x66, 0xa4, 0x76, 0xa3,
+	0x75, 0x65, 0x65, 0x66, 0x65, 0xc0, 0x20, 0xc0, 0x56, 0x9d, 0x9a, 0x99, 0xad, 0x96, 0xbf, 0x9d,
+	0x8b, 0x47, 0xa1, 0x69, 0x5a, 0x14, 0x7d, 0x75, 0xa2, 0x76, 0xc0, 0x57, 0x1c, 0x14, 0x5f, 0x79,
+	0x09, 0xa2, 0x96, 0x30, 0xa9, 0x52, 0xa2, 0x86, 0xa1, 0x96, 0x23, 0x69, 0x65, 0xc0, 0x1c, 0x59,
+	0x6b, 0x21, 0xc2, 0x5a, 0xc5, 0x21, 0xc0, 0x1e, 0x19, 0xc8, 0x22, 0x5a, 0xc3, 0x65, 0x6e, 0x7f,
+	0x7e, 0x51, 0x13, 0x2f, 0x9d, 0xc9, 0x12, 0x2a, 0x9a, 0x9e, 0xfe, 0x61, 0xa1, 0x9b, 0x8e, 0xa2,
+	0x68, 0xa2, 0x58, 0xfe, 0x8c, 0x91, 0xfe, 0xf7, 0xdd, 0x7f, 0x67, 0x66, 0xa2, 0x66, 0xfd, 0xf0,
+	0x2c, 0x91, 0xff, 0xfe, 0x52, 0x69, 0x98, 0xbc, 0xa4, 0x76, 0xfe, 0x84, 0x30, 0x98, 0xdc, 0xfe,
+	0x29, 0x24, 0xfe, 0x63, 0x2c, 0xa9, 0x44, 0x65, 0x6e, 0x6f, 0x0d, 0xc0, 0x19, 0xc0, 0x9a, 0xbb,
+	0xfe, 0x41, 0xe7, 0x99, 0xbc, 0x29, 0x38, 0xfe, 0xef, 0x7d, 0x31, 0x2c, 0x31, 0xc1, 0x51, 0x31,
+	0x99, 0xcc, 0xfe, 0x5a, 0xeb, 0x9d, 0xaa, 0xab, 0x22, 0x05, 0x7f, 0xc0, 0x19, 0xc2, 0x14, 0xc1,
+	0x0d, 0x19, 0x14, 0x9b, 0xaa, 0x92, 0xff, 0x9a, 0xbb, 0xa8, 0x44, 0xad, 0x21, 0x19, 0xc0, 0x0d,
+	0xc0, 0x9c, 0xab, 0x95, 0xdd, 0x15, 0x08, 0xfe, 0xce, 0x58, 0xad, 0x12, 0xcb, 0x66, 0x31, 0xc1,
+	0x9b, 0xba, 0xfe, 0x94, 0x71, 0x11, 0x29, 0xc0, 0x7f, 0xaa, 0x32, 0x05, 0x14, 0xa2, 0x77, 0x14,
+	0x05, 0x66, 0x05, 0x0d, 0x14, 0x50, 0x95, 0xde, 0x18, 0x6e, 0x7f, 0xc0, 0x56, 0x29, 0x18, 0xc0,
+	0x24, 0x21, 0xfe, 0xc6, 0x18, 0x31, 0xc0, 0x51, 0x31, 0xc0, 0x1d, 0x7f, 0x31, 0xc6, 0x2a, 0xc2,
+	0x31, 0x93, 0xff, 0xfe, 0x52, 0x29, 0x94, 0xfd, 0xa5, 0x53, 0x60, 0x7e, 0xc2, 0x7e, 0x7e, 0x7e,
+	0xa2, 0x77, 0xa3, 0x86, 0xa4, 0x65, 0xa3, 0x77, 0xa2, 0x87, 0xa4, 0x65, 0xa3, 0x66, 0x78, 0x22,
+	0x79, 0x26, 0x65, 0x55, 0x12, 0xa1, 0x79, 0x47, 0x98, 0xae, 0x97, 0xae, 0x9a, 0xbd, 0x47, 0x6d,
+	0x57, 0xa1, 0x69, 0xa1, 0x79, 0x24, 0x78, 0xa1, 0xb5, 0xfe, 0xa3, 0x04, 0xaa, 0x51, 0x64, 0x6b,
+	0x9b, 0x9c, 0x10, 0xa4, 0x56, 0x52, 0x56, 0x5f, 0xa2, 0x68, 0x5b, 0x46, 0x9b, 0xac, 0x9a, 0xbb,
+	0x9c, 0x9a, 0x56, 0xc0, 0x1d, 0xc0, 0x7a, 0xc0, 0x6f, 0x7e, 0xc0, 0x7f, 0xa6, 0x54, 0xa5, 0x65,
+	0xa3, 0x75, 0x65, 0x51, 0x60, 0xa1, 0xb6, 0x9c, 0xc9, 0xa5, 0x53, 0xa8, 0x44, 0x61, 0x9a, 0xbc,
+	0x6b, 0x5f, 0x5a, 0x5e, 0xa1, 0x79, 0x01, 0x9f, 0x8b, 0x9d, 0x7a, 0x9d, 0x8a, 0x9a, 0xbb, 0x22,
+	0x66, 0x22, 0x6b, 0x1d, 0xc0, 0x24, 0x2c, 0x6f, 0x6e, 0xa4, 0x85, 0xa3, 0x75, 0xa5, 0x74, 0xa1,
+	0x98, 0x50, 0x51, 0x65, 0x9f, 0xb7, 0xa2, 0x94, 0xa6, 0x73, 0xa5, 0x65, 0xa2, 0x77, 0x9b, 0x9c,
+	0xfe, 0x72, 0x22, 0x0e, 0x66, 0x7f, 0x61, 0x7d, 0xa5, 0x75, 0xa8, 0x52, 0xa5, 0x75, 0xa6, 0x52,
+	0xa2, 0x86, 0x74, 0x65, 0x69, 0x69, 0x07, 0x0e, 0x12, 0x5b, 0x52, 0x9c, 0x9c, 0x42, 0x9a, 0xbd,
+	0x9b, 0xab, 0x9c, 0xab, 0x56, 0x41, 0x4e, 0x7a, 0x6e, 0x6f, 0x7f, 0xc2, 0x11, 0x00, 0x05, 0x00,
+	0x08, 0xa2, 0x76, 0xa2, 0x86, 0xa5, 0x65, 0xa4, 0x76, 0x2c, 0xa5, 0x65, 0xa1, 0x97, 0x6d, 0x19,
+	0x65, 0x7f, 0x7e, 0x19, 0x99, 0xad, 0x97, 0xaf, 0x99, 0xae, 0x9f, 0x6b, 0x5b, 0x6b, 0x14, 0x6e,
+	0x79, 0x52, 0x19, 0xa2, 0x68, 0x19, 0x64, 0xa4, 0x85, 0xa7, 0x63, 0xa9, 0x52, 0xa5, 0x84, 0x70,
+	0x79, 0x7d, 0xc0, 0x67, 0x17, 0x56, 0x5f, 0x5b, 0x51, 0x56, 0x65, 0xc0, 0x6e, 0x00, 0xc5, 0x2c,
+	0xc2, 0x66, 0xc0, 0x5a, 0x69, 0xc4, 0x5f, 0xc1, 0x5a, 0xc1, 0x7e, 0xc0, 0x65, 0xc0, 0x65, 0x66,
+	0xa3, 0x75, 0xa5, 0x85, 0xc0, 0xa2, 0x68, 0x97, 0xaf, 0xfe, 0x51, 0x40, 0x9e, 0x7c, 0xa1, 0x69,
+	0xa8, 0x34, 0xfe, 0xbe, 0x17, 0xaf, 0x10, 0xc0, 0x6b, 0x62, 0x31, 0xfd, 0xf1, 0x98, 0xcc, 0xfe,
+	0x73, 0x6d, 0xfe, 0x31, 0x65, 0x51, 0x38, 0x6e, 0x38, 0xfe, 0x73, 0x8d, 0xa7, 0x45, 0x51, 0x7f,
+	0x19, 0xc0, 0x14, 0x69, 0x51, 0x97, 0xcd, 0x38, 0x50, 0x29, 0xad, 0x22, 0xfe, 0xef, 0x5c, 0xa4,
+	0x67, 0xc0, 0x31, 0xc1, 0x51, 0x31, 0xfe, 0xad, 0x55, 0xfe, 0x42, 0x08, 0xa9, 0x33, 0x05, 0x14,
+	0xc1, 0x19, 0xc2, 0x14, 0xc0, 0x0d, 0x05, 0x19, 0x9b, 0xbb, 0x96, 0xdc, 0x29, 0x7e, 0x21, 0x05,
+	0x14, 0x0d, 0x19, 0x9c, 0xaa, 0x97, 0xdd, 0x94, 0xee, 0xa2, 0x76, 0x19, 0xfe, 0xef, 0x7d, 0xa4,
+	0x66, 0xc1, 0x66, 0xc0, 0x31, 0xc6, 0x65, 0x31, 0x25, 0x09, 0xfe, 0xa5, 0x13, 0xfe, 0x39, 0xc6,
+	0x9b, 0xab, 0x24, 0xa5, 0x55, 0x30, 0xa9, 0x33, 0xa3, 0x77, 0x9c, 0xaa, 0x51, 0x9d, 0x99, 0x35,
+	0xa4, 0x66, 0x0d, 0x19, 0x0d, 0x66, 0x99, 0xbc, 0x92, 0xfe, 0x51, 0x29, 0x1d, 0x29, 0xc0, 0x7a,
+	0x31, 0xac, 0x22, 0xfe, 0xc6, 0x17, 0xae, 0x12, 0xc0, 0x6e, 0xc0, 0x2c, 0xc0, 0x31, 0xc8, 0x2a,
+	0xc2, 0x62, 0xfe, 0x9c, 0xb3, 0xfe, 0x31, 0x66, 0xa5, 0x64, 0xa8, 0x44, 0x7d, 0xa3, 0x66, 0x9d,
+	0x9a, 0x66, 0x65, 0x55, 0x9d, 0xba, 0x9d, 0x98, 0x9d, 0xba, 0x65, 0x69, 0x65, 0x7a, 0xa2, 0x77,
+	0xa3, 0x76, 0xa6, 0x54, 0xa3, 0x86, 0xa4, 0x75, 0xa3, 0x75, 0xa1, 0x96, 0x7d, 0x12, 0x6e, 0xa1,
+	0x79, 0x46, 0x9d, 0x8b, 0x97, 0xbe, 0x96, 0xdf, 0x9d, 0x9b, 0x47, 0xa2, 0x59, 0x38, 0x55, 0x9e,
+	0xb7, 0xa4, 0x93, 0xfe, 0xb3, 0x64, 0xa5, 0x74, 0x19, 0x43, 0xfe, 0x79, 0xe0, 0x18, 0x56, 0xa2,
+	0x66, 0x21, 0xc0, 0x5b, 0x6f, 0x5b, 0x6f, 0xc0, 0x46, 0x65, 0x6b, 0xa2, 0x66, 0x72, 0x66, 0x59,
+	0x6b, 0x2f, 0x34, 0xc0, 0x01, 0xc0, 0x9d, 0xa9, 0x65, 0xa2, 0x76, 0x76, 0x70, 0x9d, 0xbb, 0xfe,
+	0x8a, 0x83, 0xad, 0x11, 0x96, 0xdd, 0xfe, 0x59, 0x20, 0xc0, 0xa2, 0x68, 0x6d, 0x5a, 0x5a, 0xa1,
+	0x79, 0xa0, 0x8b, 0xa2, 0x56, 0x56, 0x36, 0xc1, 0x66, 0xc0, 0x6f, 0x31, 0x66, 0x6f, 0xc0, 0x7e,
+	0x69, 0x65, 0xa1, 0x96, 0x20, 0xc0, 0xa2, 0x77, 0x9c, 0xba, 0x75, 0xa4, 0x94, 0xfe, 0xc3, 0x43,
+	0xa7, 0x53, 0x6f, 0x98, 0xad, 0xfe, 0x61, 0x81, 0x9d, 0x7c, 0x65, 0x79, 0xa5, 0x63, 0xa9, 0x52,
+	0xa6, 0x64, 0xa5, 0x74, 0x7e, 0x79, 0x65, 0xc1, 0x21, 0x56, 0x41, 0x42, 0x9b, 0xac, 0x9a, 0xac,
+	0x9d, 0x9b, 0x0b, 0x24, 0x5b, 0x34, 0xa4, 0x67, 0xa6, 0x55, 0xa5, 0x46, 0xa5, 0x55, 0xa3, 0x67,
+	0xa3, 0x77, 0xa3, 0x66, 0xa2, 0x78, 0x7e, 0x51, 0x6e, 0x19, 0x9d, 0xa9, 0x9c, 0xaa, 0x9c, 0xaa,
+	0x9b, 0xba, 0x9a, 0xbb, 0x9a, 0xcb, 0x50, 0x79, 0x7e, 0xa1, 0x96, 0xa6, 0x64, 0xa6, 0x75, 0xa5,
+	0x64, 0x7e, 0x1c, 0xc1, 0x5a, 0x9c, 0x9c, 0x98, 0xae, 0x24, 0x04, 0xa1, 0x69, 0x2f, 0x1b, 0x59,
+	0xa2, 0x87, 0x55, 0x51, 0xa2, 0x95, 0xa6, 0x72, 0xa9, 0x52, 0xa7, 0x64, 0xa2, 0x96, 0x79, 0x60,
+	0x7a, 0x10, 0x57, 0x5b, 0x42, 0x9d, 0x8a, 0x9d, 0x9b, 0x9b, 0x9c, 0x41, 0x9c, 0xba, 0x51, 0xc0,
+	0x6f, 0xc2, 0x6e, 0xc1, 0x1f, 0x5a, 0x66, 0x69, 0xc9, 0x5e, 0xc5, 0x66, 0xc0, 0xa1, 0x97, 0x13,
+	0x7e, 0xa8, 0x51, 0xfe, 0xdc, 0x25, 0xc0, 0xa0, 0x6a, 0xfe, 0x8a, 0x83, 0x08, 0xa0, 0x6b, 0x5f,
+	0xfe, 0x6b, 0x4c, 0xfe, 0xe7, 0x3b, 0xa6, 0x55, 0xc0, 0x6b, 0x66, 0x31, 0xfd, 0xee, 0x2c, 0x31,
+	0x2c, 0x55, 0xfe, 0xa5, 0x34, 0xfe, 0x31, 0x65, 0xc0, 0x55, 0xc0, 0xa3, 0x67, 0xae, 0x11, 0xa7,
+	0x55, 0x55, 0x14, 0x69, 0x6f, 0x05, 0x09, 0x9a, 0xcb, 0x3d, 0x1d, 0x6f, 0x51, 0xa9, 0x44, 0xfe,
+	0xe7, 0x1c, 0xa6, 0x54, 0x6b, 0x31, 0x2c, 0x31, 0xc0, 0x51, 0xfe, 0x73, 0x8e, 0x93, 0xee, 0xaf,
+	0x11, 0x14, 0x5a, 0x14, 0xc0, 0x19, 0xc3, 0x14, 0x51, 0x0d, 0x5a, 0x97, 0xdd, 0x93, 0xfe, 0x51,
+	0xa8, 0x44, 0xac, 0x22, 0x19, 0x0d, 0x14, 0xc0, 0x09, 0x93, 0xff, 0x15, 0x35, 0xfe, 0xd6, 0x9a,
+	0xa9, 0x33, 0xa2, 0x77, 0x65, 0x31, 0xc2, 0x66, 0x31, 0xc5, 0x2c, 0x51, 0xfe, 0xad, 0x75, 0xfe,
+	0x4a, 0x28, 0x15, 0xa2, 0x77, 0x0c, 0x09, 0x05, 0x14, 0x9d, 0x99, 0x96, 0xdd, 0x9c, 0xaa, 0xc0,
+	0x51, 0x7e, 0xa8, 0x45, 0x05, 0x7e, 0x14, 0x9b, 0xaa, 0xfe, 0x39, 0xa6, 0x9d, 0x9a, 0x69, 0x7f,
+	0x1d, 0xc0, 0x24, 0xaf, 0x10, 0xfe, 0xce, 0x38, 0xad, 0x11, 0x6b, 0xc1, 0x6e, 0x2c, 0xc0, 0x31,
+	0xc8, 0x2a, 0xc2, 0x98, 0xdd, 0xfe, 0x62, 0xeb, 0xfe, 0x29, 0x25, 0x14, 0xfe, 0xd6, 0xba, 0xa3,
+	0x76, 0x59, 0x67, 0x5a, 0x66, 0x0d, 0x51, 0x9c, 0xb9, 0x50, 0x9d, 0xba, 0x9d, 0x99, 0x9b, 0xba,
+	0x98, 0xdc, 0x97, 0xcc, 0x98, 0xdc, 0x7b, 0x26, 0xa4, 0x74, 0xa4, 0x74, 0xa6, 0x63, 0x02, 0xa3,
+	0x76, 0x69, 0x69, 0x5a, 0xa2, 0x67, 0x9d, 0x9a, 0x99, 0xbe, 0xfe, 0x69, 0x80, 0x9d, 0x7c, 0xa1,
+	0x59, 0xa0, 0x6a, 0x65, 0xa1, 0x95, 0x3e, 0xfe, 0xcb, 0xe5, 0xa2, 0x86, 0x66, 0x9a, 0x8d, 0x13,
+	0xa7, 0x27, 0xfe, 0x9c, 0x2d, 0xa2, 0x77, 0x6b, 0x6e, 0x7f, 0x6e, 0x56, 0xc0, 0x6f, 0x5a, 0xc0,
+	0x5b, 0xc0, 0x7a, 0x7a, 0x66, 0xc1, 0x5a, 0xc0, 0xa2, 0x76, 0x31, 0x51, 0xa2, 0x76, 0x19, 0x99,
+	0xcb, 0xfe, 0x51, 0x83, 0x60, 0xfe, 0x93, 0x68, 0xa7, 0x45, 0xfe, 0x62, 0x04, 0x99, 0xbe, 0xfe,
+	0x7b, 0x2b, 0xa9, 0x35, 0x1d, 0xc0, 0x6f, 0x6f, 0x67, 0x30, 0x29, 0x2e, 0x35, 0x6e, 0x35, 0xc1,
+	0x30, 0x5a, 0x30, 0x6f, 0x37, 0x35, 0x55, 0x29, 0x7a, 0x38, 0x9d, 0xaa, 0xfe, 0x6a, 0xa9, 0xfe,
+	0x49, 0x21, 0xa5, 0x83, 0xfe, 0xcb, 0xe7, 0xa2, 0x76, 0x5a, 0x97, 0xad, 0xfe, 0x59, 0x60, 0x9c,
+	0xad, 0xa3, 0x75, 0xa9, 0x41, 0xa9, 0x50, 0xa4, 0x74, 0xa3, 0x85, 0x50, 0x7f, 0x66, 0x6b, 0xa0,
+	0x8a, 0x56, 0x9c, 0x8c, 0x9a, 0x9d, 0x9b, 0xab, 0x41, 0x9c, 0x9b, 0x42, 0xa4, 0x57, 0xac, 0x12,
+	0xa9, 0x34, 0xa7, 0x34, 0xa3, 0x77, 0xa6, 0x45, 0xa5, 0x66, 0xa2, 0x77, 0x7f, 0xa2, 0x67, 0x7f,
+	0x7f, 0xc0, 0x5a, 0x7e, 0xc1, 0x1d, 0x0e, 0x3d, 0x41, 0x9b, 0xbb, 0x9b, 0xba, 0x9d, 0x99, 0x98,
+	0xdc, 0x93, 0xfd, 0x95, 0xfd, 0x70, 0xa4, 0x74, 0xa4, 0x75, 0xa7, 0x63, 0xa8, 0x53, 0xa2, 0x87,
+	0x64, 0x7d, 0xa0, 0x7a, 0x15, 0xfe, 0x9a, 0xe5, 0x97, 0xae, 0x9a, 0xae, 0xa2, 0x58, 0x5f, 0x50,
+	0x7e, 0x74, 0xa3, 0x75, 0xaa, 0x61, 0xa7, 0x80, 0xa3, 0x87, 0x69, 0x79, 0x7f, 0x66, 0xa2, 0x68,
+	0x9c, 0x8b, 0x99, 0xad, 0x24, 0x9d, 0x8b, 0x9c, 0x9b, 0x42, 0x23, 0xa3, 0x76, 0xa4, 0x67, 0xa6,
+	0x44, 0xa5, 0x66, 0xa3, 0x66, 0x7f, 0xc2, 0x5a, 0xce, 0x79, 0xc3, 0x3f, 0xc1, 0xa2, 0x76, 0x9c,
+	0xb9, 0xfe, 0x59, 0xc4, 0x0b, 0xfe, 0x9b, 0x06, 0x25, 0x5a, 0x9b, 0xad, 0xfe, 0x69, 0xe2, 0x99,
+	0xae, 0x23, 0xa2, 0x67, 0xfe, 0x8c, 0x50, 0xfe, 0xff, 0xde, 0xc1, 0x6b, 0xc0, 0x31, 0xfd, 0xf2,
+	0x99, 0xcc, 0xfe, 0x83, 0xef, 0xfe, 0x29, 0x45, 0x55, 0xa2, 0x87, 0x24, 0xa9, 0x33, 0xaa, 0x33,
+	0xc1, 0x51, 0x9d, 0xa9, 0x9a, 0xbc, 0x9c, 0xa9, 0x51, 0x51, 0xc0, 0x6f, 0x1d, 0x31, 0xfe, 0xce,
+	0x58, 0xac, 0x23, 0x6e, 0x9c, 0xaa, 0x25, 0x31, 0x2c, 0x97, 0xcc, 0xfe, 0x52, 0x8a, 0x34, 0xb0,
+	0x00, 0xc1, 0x6e, 0xc5, 0x7e, 0x9c, 0xab, 0x19, 0x9a, 0xbb, 0x93, 0xfe, 0x24, 0xa2, 0x76, 0xae,
+	0x12, 0x14, 0x59, 0x14, 0xc0, 0x1d, 0x39, 0x15, 0xa4, 0x66, 0xfe, 0xb5, 0x96, 0x2c, 0x6e, 0xc7,
+	0x2c, 0x25, 0x31, 0xc1, 0x61, 0x25, 0x93, 0xff, 0xfe, 0x63, 0x0c, 0xfe, 0x21, 0x04, 0x7e, 0xa5,
+	0x56, 0x30, 0x00, 0xa5, 0x55, 0x95, 0xed, 0x39, 0x04, 0xfe, 0xad, 0x75, 0xa8, 0x44, 0x9c, 0xaa,
+	0xfe, 0x7b, 0xce, 0x0c, 0x25, 0xa6, 0x56, 0x14, 0x9b, 0xba, 0x92, 0xef, 0x9b, 0xba, 0x24, 0x6e,
+	0xa2, 0x77, 0xaa, 0x33, 0xac, 0x22, 0xaf, 0x10, 0xab, 0x33, 0x31, 0x2c, 0xc1, 0x31, 0xcb, 0x69,
+	0xc0, 0x66, 0x65, 0xfe, 0xad, 0x54, 0xfe, 0x31, 0x86, 0x11, 0xfe, 0xb5, 0xd7, 0xaf, 0x10, 0x6f,
+	0x6e, 0xc0, 0x29, 0xc1, 0x2c, 0x20, 0xc1, 0x65, 0x69, 0x9d, 0xaa, 0x9a, 0xbb, 0x9b, 0xbb, 0xfe,
+	0x83, 0x6d, 0x98, 0xdc, 0x99, 0xca, 0x9c, 0xb8, 0x7e, 0xa9, 0x50, 0xa9, 0x42, 0xa6, 0x64, 0xa2,
+	0x75, 0x65, 0x7d, 0x51, 0xa1, 0x89, 0xfe, 0xab, 0x45, 0xfe, 0x69, 0xa1, 0x9c, 0x7c, 0xa1, 0x69,
+	0x5a, 0xa0, 0xa5, 0xaa, 0x60, 0xfe, 0xd4, 0x05, 0x7e, 0x6b, 0xfe, 0x92, 0xc3, 0xfe, 0x49, 0x41,
+	0xfe, 0x8b, 0xce, 0xfe, 0xf7, 0x7c, 0x7b, 0xc0, 0x0d, 0xc3, 0x6b, 0x5a, 0x6e, 0x1d, 0x56, 0x1d,
+	0x7a, 0x66, 0x20, 0xc0, 0x1d, 0xc1, 0x11, 0x7e, 0x9d, 0xa9, 0x05, 0xfe, 0xac, 0xf1, 0xfe, 0x51,
+	0x83, 0x64, 0xfe, 0xa4, 0x2b, 0x9c, 0x9a, 0xfe, 0x49, 0xc3, 0xa3, 0x68, 0xfe, 0xc5, 0xf7, 0x11,
+	0xc0, 0x6d, 0xc0, 0x16, 0x6b, 0xc0, 0x16, 0xc2, 0x1d, 0xc6, 0x29, 0x15, 0x1d, 0x61, 0x6f, 0x98,
+	0xcc, 0xfe, 0x6a, 0xea, 0x07, 0xfe, 0x8a, 0xa4, 0xfe, 0xd4, 0x48, 0x65, 0xa2, 0x57, 0xfe, 0x7a,
+	0x61, 0xfe, 0x59, 0x20, 0xa5, 0x74, 0xac, 0x21, 0xa6, 0x63, 0x7c, 0x79, 0xa2, 0x75, 0x51, 0x17,
+	0xa0, 0x8a, 0x30, 0x9a, 0xac, 0x97, 0xce, 0x99, 0xae, 0x9e, 0x7b, 0xc0, 0xa4, 0x56, 0xa9, 0x25,
+	0xaf, 0x00, 0xad, 0x02, 0xa7, 0x44, 0xa2, 0x77, 0x6f, 0x6e, 0x7e, 0xc0, 0x2a, 0x31, 0xcb, 0x5a,
+	0x1a, 0xc0, 0x0e, 0x9b, 0xba, 0x98, 0xdc, 0xfe, 0x7b, 0x6b, 0x96, 0xec, 0x9a, 0xca, 0x79, 0xa6,
+	0x64, 0xaa, 0x42, 0xa6, 0x74, 0xa2, 0x84, 0x61, 0x56, 0xa0, 0x8a, 0x2b, 0xfe, 0x69, 0xa1, 0x9b,
+	0x8d, 0xa1, 0x69, 0x6e, 0x9e, 0xb7, 0xa4, 0x74, 0xfe, 0x9b, 0x24, 0xa9, 0x61, 0x9e, 0xc7, 0x6f,
+	0x66, 0xa2, 0x67, 0x11, 0x57, 0x98, 0xbd, 0x97, 0xbe, 0x9a, 0x9e, 0x5f, 0xa4, 0x57, 0xa7, 0x36,
+	0xa9, 0x33, 0xae, 0x01, 0xa7, 0x55, 0xa5, 0x66, 0xa2, 0x66, 0x7f, 0xa2, 0x77, 0xd5, 0x66, 0xc1,
+	0x6b, 0x6e, 0x51, 0x1b, 0xfe, 0xd5, 0xf6, 0xfe, 0x6a, 0x46, 0x9a, 0xca, 0xfe, 0xa3, 0x47, 0xa7,
+	0x70, 0x6e, 0x98, 0xaf, 0xfe, 0x59, 0x61, 0x9f, 0x6a, 0xa0, 0x6a, 0xa7, 0x45, 0xfe, 0xbd, 0xd7,
+	0x31, 0xc0, 0x2c, 0xc0, 0x31, 0xfd, 0xf4, 0xfe, 0xce, 0x38, 0xfe, 0x5a, 0xcb, 0x95, 0xdd, 0x65,
+	0x52, 0xa5, 0x55, 0x66, 0x3d, 0xc1, 0x65, 0x52, 0x1d, 0xc4, 0x29, 0xfe, 0xad, 0x54, 0xfe, 0xff,
+	0xde, 0x56, 0x25, 0x6f, 0x61, 0x31, 0xfe, 0xb5, 0xb6, 0xfe, 0x39, 0xe7, 0xa6, 0x55, 0xad, 0x22,
+	0x5a, 0xa2, 0x77, 0x65, 0xc6, 0x65, 0x52, 0x96, 0xdc, 0x96, 0xdd, 0x41, 0xa9, 0x44, 0xac, 0x22,
+	0x19, 0x51, 0x19, 0x05, 0x97, 0xdd, 0x38, 0x9d, 0x99, 0x30, 0xfe, 0xd6, 0xba, 0xaa, 0x33, 0x2c,
+	0x31, 0xc6, 0x2c, 0x31, 0xc3, 0x9a, 0xbb, 0xfe, 0x7b, 0xae, 0x91, 0xff, 0x24, 0x69, 0xab, 0x23,
+	0xab, 0x32, 0x14, 0x1c, 0x0d, 0xfe, 0xa5, 0x14, 0x3a, 0xa3, 0x77, 0x31, 0xc0, 0x94, 0xee, 0x0d,
+	0xa4, 0x66, 0xa8, 0x44, 0xc0, 0x9b, 0xbb, 0x92, 0xff, 0x9a, 0xbb, 0x29, 0x38, 0xfe, 0xad, 0x34,
+	0xaf, 0x01, 0xa5, 0x65, 0x31, 0xc0, 0x20, 0x1d, 0x31, 0xcc, 0x2c, 0x31, 0x69, 0x66, 0x51, 0xfe,
+	0x94, 0x91, 0x24, 0xad, 0x11, 0xfe, 0xd6, 0xbb, 0xaa, 0x22, 0xc2, 0x31, 0xc0, 0x2c, 0xc1, 0x31,
+	0x2c, 0xc0, 0x31, 0xc0, 0x2c, 0x51, 0x76, 0x98, 0xcc, 0x97, 0xdc, 0x95, 0xdc, 0xfe, 0x5a, 0x05,
+	0x97, 0xdc, 0xa3, 0x85, 0xab, 0x40, 0xa8, 0x52, 0xa3, 0x85, 0xa3, 0x85, 0x79, 0x56, 0x9f, 0x7c,
+	0xfe, 0x9a, 0xe5, 0x97, 0xae, 0x9b, 0x9c, 0x5a, 0xa3, 0x94, 0xab, 0x50, 0xaa, 0x50, 0xa2, 0x77,
+	0x9c, 0x9b, 0xfe, 0x71, 0xe1, 0x9d, 0x6d, 0xfe, 0xad, 0x35, 0xfe, 0xff, 0xdf, 0xc3, 0x25, 0xc2,
+	0x2c, 0xc2, 0x6e, 0xc8, 0x50, 0x9d, 0xba, 0xfe, 0x94, 0x4f, 0xfe, 0x49, 0x62, 0xa6, 0x63, 0xfe,
+	0xa4, 0x4a, 0x97, 0xcd, 0x94, 0xcf, 0xad, 0x25, 0xfe, 0xe7, 0x1b, 0x2e, 0x27, 0x69, 0x7a, 0xc0,
+	0x31, 0x69, 0xc2, 0x31, 0xc7, 0x56, 0xc0, 0x31, 0x66, 0x31, 0x28, 0xfe, 0x49, 0xe6, 0x9d, 0xc7,
+	0xfe, 0xab, 0x67, 0xa5, 0x83, 0x0e, 0x42, 0xfe, 0x7a, 0x20, 0xa2, 0x97, 0xa8, 0x53, 0xa5, 0x65,
+	0x7d, 0x6e, 0x26, 0x55, 0x1e, 0x4b, 0x99, 0xbe, 0x98, 0xbe, 0x98, 0xbe, 0x9c, 0x9b, 0xa4, 0x58,
+	0xaa, 0x14, 0xaf, 0x01, 0xac, 0x22, 0xa8, 0x35, 0xa4, 0x56, 0xa2, 0x76, 0x6e, 0xc3, 0x27, 0x31,
+	0xce, 0x2e, 0xc1, 0x9d, 0xa9, 0x61, 0x96, 0xdc, 0xfe, 0x94, 0x2e, 0xfe, 0x5a, 0x05, 0x97, 0xdc,
+	0xa5, 0x65, 0xa9, 0x51, 0x3e, 0xa4, 0x76, 0x79, 0x66, 0x9d, 0x9b, 0x99, 0xad, 0xfe, 0x59, 0x40,
+	0x9d, 0x9b, 0xa2, 0x67, 0xa6, 0x73, 0xab, 0x40, 0x25, 0x74, 0x7e, 0x15, 0x57, 0x4b, 0x98, 0xbd,
+	0x98, 0xae, 0x3b, 0x0c, 0xac, 0x13, 0xae, 0x02, 0xab, 0x13, 0xa9, 0x34, 0xa6, 0x55, 0xc0, 0x31,
+	0xc1, 0x55, 0x31, 0xc3, 0x2e, 0xc0, 0x31, 0xd2, 0x2e, 0x66, 0x31, 0xfe, 0xc5, 0x95, 0xfe, 0x5a,
+	0x05, 0x74, 0xfe, 0xab, 0xa8, 0xa5, 0x81, 0x5b, 0xfe, 0x92, 0xe5, 0xfe, 0x49, 0x41, 0x9f, 0x7b,
+	0x5f, 0xfe, 0x63, 0x2c, 0xfe, 0xde, 0xda, 0x31, 0xfd, 0xf7, 0x2c, 0x51, 0xfe, 0x9c, 0xd3, 0xfe,
+	0x41, 0xe7, 0x9b, 0xab, 0xc0, 0x6e, 0x24, 0xc3, 0x29, 0xc0, 0x65, 0xc3, 0x24, 0xfe, 0x7b, 0xae,
+	0xfe, 0xf7, 0x9d, 0x15, 0x21, 0x2c, 0x11, 0x2c, 0xfe, 0x8c, 0x71, 0xfe, 0x31, 0x86, 0xb0, 0x00,
+	0xa6, 0x55, 0x55, 0x19, 0xc6, 0x05, 0x19, 0x97, 0xdd, 0x95, 0xdd, 0x24, 0xa3, 0x66, 0xae, 0x11,
+	0xa7, 0x54, 0x19, 0x05, 0x19, 0x9a, 0xbb, 0x96, 0xdd, 0x95, 0xee, 0xa8, 0x43, 0xfe, 0xad, 0x54,
+	0xfe, 0xef, 0x7d, 0x31, 0x65, 0x31, 0xc9, 0x2c, 0x31, 0x9c, 0xba, 0xfe, 0x9c, 0xb2, 0x3d, 0x9c,
+	0xaa, 0xa2, 0x87, 0xa6, 0x55, 0xae, 0x01, 0x7f, 0x97, 0xcc, 0x51, 0xfe, 0x9c, 0xf3, 0x0e, 0xa3,
+	0x77, 0x25, 0x31, 0xc0, 0x09, 0xfe, 0x6b, 0x6d, 0x39, 0x05, 0x7a, 0x9a, 0xbb, 0x38, 0x9d, 0xa9,
+	0x2c, 0xa6, 0x45, 0xfe, 0xce, 0x59, 0xac, 0x22, 0x31, 0x2c, 0xc1, 0x31, 0xcd, 0x2c, 0x31, 0x65,
+	0xc0, 0x98, 0xdc, 0x0c, 0xfe, 0x29, 0x44, 0xfe, 0x8c, 0x71, 0xfe, 0xf7, 0xbe, 0x2e, 0xc0, 0x66,
+	0x31, 0xc6, 0x29, 0xc0, 0x31, 0xc4, 0x9b, 0xba, 0x94, 0xee, 0xfe, 0x83, 0xee, 0xfe, 0x5a, 0x26,
+	0x99, 0xda, 0xa4, 0x85, 0xaa, 0x50, 0xa7, 0x63, 0xa3, 0x85, 0x9d, 0xa9, 0xa3, 0x58, 0x47, 0x97,
+	0xbe, 0x94, 0xdf, 0x9c, 0x9c, 0xa6, 0x62, 0xad, 0x40, 0xa6, 0x63, 0x7f, 0x98, 0xad, 0xfe, 0x51,
+	0x40, 0xa9, 0x16, 0xfe, 0xd6, 0x9b, 0xaa, 0x32, 0x31, 0xc2, 0x2c, 0xc4, 0x31, 0xc6, 0x2e, 0xc0,
+	0x31, 0xc0, 0x2c, 0x96, 0xdc, 0xfe, 0x62, 0xea, 0xfe, 0x49, 0x20, 0xfe, 0xa3, 0x67, 0xa6, 0x34,
+	0xfe, 0x72, 0x84, 0x96, 0xbe, 0xfe, 0xa4, 0xf1, 0x25, 0x31, 0x69, 0x69, 0x69, 0x23, 0x2a, 0xc0,
+	0x31, 0xca, 0x2c, 0x65, 0x25, 0x31, 0x20, 0xfe, 0xb5, 0x33, 0xfe, 0x39, 0x01, 0xa9, 0x60, 0xfe,
+	0xcc, 0x07, 0xa0, 0xb5, 0x6e, 0x9c, 0x9b, 0x9d, 0x7b, 0xa4, 0x84, 0x1a, 0x6f, 0x1e, 0x6b, 0x6b,
+	0x1c, 0x9a, 0xac, 0x99, 0xad, 0x97, 0xbe, 0x5b, 0xa9, 0x25, 0xab, 0x23, 0xad, 0x02, 0xaa, 0x33,
+	0x20, 0xa2, 0x67, 0xc1, 0x29, 0x2e, 0x31, 0xc2, 0x66, 0x31, 0xca, 0x2a, 0x66, 0x69, 0x2a, 0x25,
+	0xc0, 0x31, 0xc2, 0x3d, 0x94, 0xfe, 0x24, 0x92, 0xff, 0x14, 0xa8, 0x51, 0xaa, 0x51, 0xa5, 0x85,
+	0x74, 0x6b, 0x6b, 0x96, 0xbf, 0xfe, 0x69, 0x40, 0xa5, 0x54, 0xfe, 0xbb, 0xa6, 0xa4, 0x84, 0x9f,
+	0xa6, 0x6b, 0xa1, 0x59, 0x5f, 0x9a, 0xad, 0x96, 0xce, 0x99, 0xad, 0xa1, 0x69, 0xad, 0x03, 0xac,
+	0x13, 0xae, 0x01, 0xa8, 0x55, 0x31, 0x65, 0xc0, 0x31, 0x25, 0xc0, 0x2c, 0x31, 0x25, 0x31, 0xd2,
+	0x5a, 0x27, 0x2a, 0xc1, 0x2e, 0x66, 0x2e, 0x64, 0xfe, 0x9c, 0x8f, 0xfe, 0x51, 0xa1, 0xa6, 0x63,
+	0xfe, 0xc4, 0x48, 0xa0, 0xa6, 0x47, 0xfe, 0x7a, 0x63, 0xfe, 0x41, 0x22, 0x4b, 0xa4, 0x57, 0xfe,
+	0x8c, 0x71, 0x0e, 0x31, 0x2c, 0x31, 0xfd, 0xf5, 0x61, 0x31, 0xfe, 0xbd, 0xb6, 0xfe, 0x4a, 0x28,
+	0x9a, 0xbb, 0x6e, 0x9d, 0xaa, 0xa2, 0x67, 0x65, 0x6b, 0x29, 0x24, 0x29, 0x69, 0x1d, 0xc4, 0xaa,
+	0x33, 0xfe, 0xde, 0xba, 0x9d, 0x9a, 0xfe, 0x8c, 0x50, 0xfe, 0xce, 0x79, 0x20, 0x41, 0xfe, 0x63,
+	0x2c, 0x24, 0xfe, 0x7b, 0xef, 0xa2, 0x77, 0xc0, 0x7f, 0xc0, 0x19, 0xc3, 0x14, 0x0d, 0xc0, 0x92,
+	0xef, 0x29, 0xc0, 0x01, 0xac, 0x23, 0x0d, 0x14, 0x19, 0x0d, 0x94, 0xef, 0x97, 0xcc, 0x1d, 0xfe,
+	0x73, 0x8e, 0xfe, 0xe7, 0x1c, 0xa7, 0x44, 0xcb, 0x66, 0xc0, 0x51, 0xfe, 0xad, 0x55, 0x28, 0x1d,
+	0x6b, 0xa4, 0x66, 0xae, 0x11, 0x05, 0x96, 0xdd, 0x9c, 0xaa, 0xfe, 0xa5, 0x34, 0xb1, 0x00, 0x2c,
+	0x55, 0x31, 0xc0, 0x25, 0x09, 0xfe, 0x6b, 0x4d, 0x97, 0xcc, 0x14, 0x0d, 0x35, 0x24, 0x38, 0x29,
+	0x35, 0xfe, 0xde, 0xdb, 0x2c, 0x31, 0xc1, 0x2c, 0xc0, 0x31, 0xcd, 0x20, 0xc0, 0x6e, 0xfe, 0xbd,
+	0xd6, 0xfe, 0x4a, 0x48, 0x3d, 0x05, 0x31, 0x2e, 0x31, 0x56, 0x31, 0xcb, 0x55, 0xc1, 0x2e, 0x31,
+	0x9a, 0xbc, 0x96, 0xec, 0xfe, 0x7b, 0x4c, 0xfe, 0x49, 0x21, 0x1f, 0xa9, 0x62, 0xaa, 0x41, 0xa1,
+	0x97, 0xa2, 0x65, 0xa2, 0x77, 0x9c, 0x9c, 0x96, 0xce, 0xfe, 0x61, 0x40, 0xa4, 0x74, 0xfe, 0xc3,
+	0xc6, 0xa4, 0x64, 0x67, 0x95, 0xbf, 0xfe, 0x51, 0x61, 0xfe, 0x83, 0xad, 0xfe, 0xe7, 0x5d, 0xa5,
+	0x65, 0xd1, 0x2c, 0x29, 0x2c, 0x55, 0x25, 0xfe, 0xbd, 0x95, 0xfe, 0x41, 0xc6, 0x9d, 0xe7, 0xfe,
+	0xc4, 0x6c, 0x9b, 0xaa, 0x92, 0xdf, 0x9d, 0x8b, 0xfe, 0xcd, 0xf6, 0x31, 0x2c, 0x6d, 0xc0, 0x23,
+	0x2a, 0x2c, 0x31, 0xcc, 0x2c, 0x60, 0x25, 0x9b, 0xca, 0xfe, 0x94, 0x0e, 0xfe, 0x38, 0xe0, 0x39,
+	0xab, 0x60, 0xa0, 0xb5, 0xc0, 0x9d, 0x8a, 0xa3, 0x48, 0x7d, 0x6e, 0x6b, 0x5b, 0x53, 0x9a, 0xad,
+	0x99, 0xad, 0x96, 0xcf, 0x5f, 0xa7, 0x36, 0xaf, 0x01, 0xfe, 0xce, 0x37, 0xa8, 0x44, 0xa5, 0x55,
+	0x2a, 0xc0, 0x25, 0x5a, 0x7f, 0xc4, 0x66, 0xc0, 0x31, 0xc9, 0x2a, 0xc0, 0x25, 0x1e, 0xc0, 0x25,
+	0xc0, 0x31, 0xc0, 0x29, 0x1d, 0x2c, 0x25, 0x9a, 0xcb, 0xfe, 0xad, 0x13, 0xfe, 0x6a, 0xc9, 0x95,
+	0xeb, 0xa4, 0x84, 0xaa, 0x62, 0xa8, 0x52, 0xa0, 0xa8, 0x79, 0x42, 0x99, 0xbc, 0xa3, 0x67, 0x27,
+	0x64, 0x78, 0xa1, 0x69, 0x9f, 0x5c, 0x99, 0xbd, 0x97, 0xbd, 0x16, 0xa9, 0x35, 0xfe, 0xa4, 0xd1,
+	0xfe, 0xde, 0xda, 0xa7, 0x45, 0xa2, 0x77, 0xc0, 0x25, 0x65, 0x66, 0x6f, 0xc0, 0x6f, 0x31, 0xc0,
+	0x2c, 0xc4, 0x31, 0xcd, 0x59, 0x2a, 0xc3, 0x22, 0x2e, 0x9a, 0xc9, 0xfe, 0x7b, 0x49, 0xfe, 0x49,
+	0x60, 0xfe, 0x8a, 0xe3, 0xad, 0x40, 0x9d, 0xa8, 0x9d, 0x9c, 0xfe, 0x69, 0xe2, 0x9a, 0x9e, 0xa0,
+	0x6a, 0xa9, 0x24, 0xfe, 0xad, 0x95, 0x25, 0x2c, 0xc2, 0x31, 0xfd, 0xf3, 0x2c, 0x51, 0xfe, 0x94,
+	0x92, 0xfe, 0x31, 0x85, 0x56, 0x3d, 0x9d, 0xaa, 0xa3, 0x76, 0x51, 0x29, 0xc0, 0x65, 0x24, 0x29,
+	0x1d, 0xc4, 0xa4, 0x66, 0xfe, 0xa5, 0x34, 0xad, 0x21, 0xfe, 0x63, 0x2c, 0x65, 0xfe, 0xb5, 0x75,
+	0x56, 0xfe, 0x42, 0x08, 0x51, 0xfe, 0x84, 0x10, 0x6e, 0xa2, 0x77, 0x55, 0x7b, 0xc0, 0x19, 0xc1,
+	0x56, 0x19, 0xc0, 0x99, 0xcb, 0x3d, 0x9d, 0x99, 0x31, 0x35, 0x19, 0x0a, 0x19, 0x6e, 0x99, 0xcc,
+	0x93, 0xfe, 0x98, 0xcd, 0xa8, 0x33, 0xfe, 0xad, 0x75, 0xfe, 0xff, 0xff, 0xc0, 0x66, 0x31, 0xca,
+	0x61, 0x96, 0xdd, 0xfe, 0x52, 0x8a, 0x96, 0xdd, 0x69, 0xa2, 0x78, 0xab, 0x32, 0x05, 0x35, 0x9b,
+	0xba, 0xfe, 0x9c, 0xf3, 0xfe, 0xf7, 0x9d, 0x6f, 0x9c, 0xaa, 0x99, 0xcc, 0xa8, 0x44, 0x25, 0x31,
+	0x98, 0xcc, 0xfe, 0x5a, 0xeb, 0x9c, 0xaa, 0x05, 0x00, 0x93, 0xfe, 0x10, 0x3d, 0x65, 0xfe, 0x8c,
+	0x71, 0xfe, 0xef, 0x7d, 0xa4, 0x66, 0x2c, 0x31, 0xc0, 0x25, 0x2c, 0x31, 0xcd, 0x18, 0x2c, 0x18,
+	0x19, 0xfe, 0x31, 0x85, 0xaa, 0x33, 0xfe, 0xde, 0xfb, 0xa8, 0x44, 0x25, 0x31, 0xcd, 0x2a, 0x5a,
+	0x52, 0xc0, 0x7f, 0xc0, 0x66, 0x98, 0xdb, 0xfe, 0xa4, 0x50, 0xfe, 0x62, 0x05, 0x99, 0xda, 0xa9,
+	0x43, 0xac, 0x30, 0xa3, 0x93, 0x7e, 0x6b, 0x9b, 0xab, 0xfe, 0x92, 0x00, 0xc0, 0xfe, 0xd4, 0x06,
+	0x2c, 0x9e, 0x7b, 0xfe, 0x7a, 0x22, 0x9b, 0x8d, 0xfe, 0xad, 0x12, 0x24, 0x31, 0xd3, 0x61, 0xc0,
+	0x65, 0xfe, 0x9c, 0x71, 0xfe, 0x41, 0x65, 0xa8, 0x81, 0xfe, 0xd4, 0x8d, 0x95, 0xbc, 0xfe, 0x51,
+	0x61, 0xab, 0x14, 0xfe, 0xee, 0xda, 0xa8, 0x25, 0xc0, 0x31, 0x2a, 0xc0, 0x31, 0x2c, 0x31, 0xcb,
+	0x2c, 0xc0, 0x14, 0xa2, 0x67, 0x94, 0xfd, 0xfe, 0x6a, 0xc8, 0xfe, 0x49, 0x20, 0xfe, 0xb3, 0x85,
+	0xa5, 0x92, 0xa0, 0xb5, 0x51, 0x57, 0xa4, 0x38, 0x59, 0xa2, 0x67, 0x47, 0x9a, 0xbd, 0x98, 0xbf,
+	0x99, 0xad, 0x9c, 0x8c, 0xab, 0x24, 0xac, 0x13, 0xae, 0x01, 0x04, 0x25, 0x22, 0x69, 0x7e, 0x2a,
+	0xc2, 0x25, 0x6f, 0xc1, 0x2c, 0xc1, 0x31, 0xcb, 0x2a, 0x65, 0xc0, 0x2a, 0x31, 0xc2, 0x2c, 0xc0,
+	0x25, 0xc0, 0x9c, 0xba, 0x96, 0xdd, 0xfe, 0x7b, 0xac, 0xfe, 0x41, 0x82, 0xa0, 0xa6, 0xfe, 0x9b,
+	0x24, 0xa7, 0x74, 0xa3, 0x85, 0x60, 0xc0, 0x7a, 0x52, 0xa2, 0x67, 0x6e, 0x9d, 0x7c, 0xfe, 0x82,
+	0xc6, 0x95, 0xce, 0xa2, 0x68, 0xfe, 0x83, 0xcd, 0xfe, 0xc6, 0x16, 0x0e, 0xa2, 0x78, 0x6e, 0x29,
+	0x65, 0x25, 0x2a, 0x25, 0x67, 0x2c, 0xd6, 0x6e, 0x2a, 0xc1, 0x69, 0x2a, 0xc0, 0x56, 0x31, 0x93,
+	0xfc, 0xfe, 0x5a, 0x44, 0x9b, 0xd9, 0xfe, 0xab, 0x84, 0xa7, 0x64, 0x50, 0x9a, 0x9e, 0xfe, 0x59,
+	0x81, 0x9e, 0x7c, 0x9e, 0x7b, 0xfe, 0x63, 0x2c, 0xfe, 0xce, 0x79, 0x2a, 0x31, 0xc0, 0x2c, 0xc0,
+	0x31, 0xfd, 0xf4, 0x94, 0xfe, 0xfe, 0x5a, 0xcb, 0x96, 0xdd, 0xa9, 0x43, 0xa5, 0x55, 0xc0, 0x52,
+	0x55, 0x51, 0x9a, 0xbb, 0x9a, 0xbb, 0xc0, 0x7e, 0x6e, 0x1d, 0xc4, 0x21, 0x3c, 0x97, 0xcc, 0xfe,
+	0x39, 0xa6, 0xa3, 0x66, 0x2d, 0x15, 0xa8, 0x44, 0xa9, 0x44, 0xa3, 0x66, 0xa6, 0x55, 0x51, 0x6f,
+	0x7a, 0x19, 0xc1, 0x11, 0x19, 0x9d, 0xaa, 0x93, 0xee, 0x97, 0xdd, 0x59, 0x2d, 0xac, 0x22, 0x19,
+	0x0a, 0x19, 0x00, 0x94, 0xee, 0x97, 0xcc, 0x24, 0xfe, 0x73, 0x8e, 0xfe, 0xef, 0x5c, 0x31, 0x2c,
+	0xc0, 0x31, 0xc6, 0x65, 0x2c, 0x31, 0x2c, 0x99, 0xcb, 0xfe, 0x84, 0x0f, 0xfe, 0x29, 0x45, 0xc1,
+	0x2d, 0xad, 0x12, 0x61, 0x08, 0xb0, 0x00, 0xfe, 0xef, 0x7d, 0xa4, 0x66, 0x2c, 0xfe, 0xbd, 0xd6,
+	0xfe, 0x63, 0x0b, 0xfe, 0xce, 0x79, 0x09, 0x31, 0x92, 0xff, 0x2d, 0x21, 0x00, 0x50, 0xfe, 0x39,
+	0xe7, 0x9a, 0xcb, 0x24, 0xa7, 0x44, 0xfe, 0xbd, 0xf7, 0xaf, 0x10, 0x31, 0x2c, 0x31, 0xd1, 0x51,
+	0x31, 0x98, 0xcd, 0x30, 0x24, 0x14, 0x25, 0xc2, 0x31, 0xcc, 0x25, 0x5a, 0x6b, 0xc1, 0x31, 0x62,
+	0xc0, 0x68, 0xfe, 0xc5, 0x93, 0xfe, 0x62, 0x45, 0x97, 0xdc, 0xab, 0x30, 0xfe, 0xc3, 0xe4, 0xa3,
+	0x86, 0x66, 0x7b, 0x99, 0xbb, 0x9d, 0xaa, 0xaa, 0x24, 0x6f, 0x9b, 0x8c, 0xfe, 0x59, 0x80, 0x21,
+	0xfe, 0xd6, 0x58, 0x31, 0x2a, 0xc3, 0x31, 0xce, 0x61, 0x25, 0x98, 0xec, 0xfe, 0x73, 0x0b, 0x94,
+	0xfd, 0xfe, 0xa3, 0xab, 0xa4, 0x74, 0x93, 0xdd, 0x97, 0xbe, 0xfe, 0xac, 0xcf, 0xfe, 0xf7, 0x7c,
+	0x31, 0x56, 0x6e, 0xc0, 0x69, 0x2e, 0x31, 0xcc, 0x2c, 0x31, 0x2c, 0x50, 0xfe, 0xa4, 0xf2, 0xfe,
+	0x39, 0x83, 0x02, 0xfe, 0xc4, 0x07, 0xa1, 0xb4, 0x9f, 0xc6, 0x55, 0xa1, 0x79, 0xa2, 0x59, 0x9f,
+	0x6a, 0x4a, 0x9b, 0xac, 0x95, 0xcf, 0x12, 0x21, 0xad, 0x03, 0xfe, 0xd6, 0x99, 0x09, 0x2c, 0xc0,
+	0x55, 0x2c, 0x31, 0x5a, 0x66, 0x22, 0x31, 0xd5, 0x2e, 0x29, 0x31, 0xc0, 0x2e, 0x31, 0x9d, 0x9a,
+	0x29, 0x31, 0x2c, 0xc0, 0x31, 0x2c, 0x99, 0xbb, 0xfe, 0x8c, 0x0e, 0xfe, 0x49, 0xa3, 0x9f, 0xa6,
+	0xab, 0x60, 0xab, 0x50, 0x24, 0x9d, 0xb9, 0xc0, 0xa2, 0x68, 0x4b, 0x9c, 0x8b, 0x98, 0xae, 0xfe,
+	0x49, 0x62, 0xa5, 0x56, 0xfe, 0xac, 0xb0, 0xfe, 0xef, 0x1a, 0xa6, 0x46, 0x1d, 0xa2, 0x77, 0xc1,
+	0x29, 0x1d, 0x11, 0xc0, 0x2c, 0xc3, 0x31, 0xd3, 0x2c, 0xc0, 0x25, 0xc1, 0x2c, 0xc0, 0x31, 0xfe,
+	0xb5, 0x33, 0xfe, 0x49, 0x82, 0xa5, 0x83, 0x19, 0xa1, 0x96, 0x59, 0xfe, 0x92, 0xc2, 0xfe, 0x49,
+	0x20, 0xa1, 0x5b, 0x47, 0xfe, 0x84, 0x51, 0xfe, 0xe7, 0x5d, 0x2a, 0x31, 0xc0, 0x2c, 0x31, 0xfd,
+	0xf5, 0xfe, 0xa4, 0xf3, 0xfe, 0x31, 0x65, 0x38, 0xb0, 0x00, 0xa6, 0x54, 0x6f, 0xc1, 0x61, 0x98,
+	0xbc, 0x96, 0xdd, 0x9c, 0xaa, 0xc0, 0x69, 0x66, 0xc3, 0x2c, 0xc0, 0xfe, 0x9c, 0xf3, 0xfe, 0xf7,
+	0x9d, 0xfe, 0x73, 0x8d, 0xfe, 0x31, 0x85, 0x52, 0x51, 0x38, 0x9d, 0x99, 0xa7, 0x54, 0xae, 0x12,
+	0xa4, 0x66, 0x0a, 0x14, 0x6e, 0xc1, 0x0a, 0x14, 0x99, 0xbb, 0x92, 0xff, 0x24, 0x29, 0x35, 0x14,
+	0x19, 0x0d, 0x14, 0x09, 0x31, 0x10, 0xa7, 0x44, 0xfe, 0xa5, 0x34, 0xfe, 0xff, 0xdf, 0x55, 0xc0,
+	0x2c, 0x6e, 0xc6, 0x65, 0x31, 0xc0, 0x9c, 0xba, 0x92, 0xef, 0xfe, 0x39, 0xc7, 0x29, 0x51, 0xa4,
+	0x76, 0xac, 0x22, 0xa6, 0x55, 0x99, 0xbc, 0x09, 0xfe, 0xe7, 0x1c, 0x25, 0x9c, 0xab, 0x2c, 0xfe,
+	0xb5, 0x95, 0xfe, 0x52, 0x8a, 0xfe, 0x9c, 0xd2, 0xa4, 0x66, 0xa7, 0x45, 0x93, 0xff, 0xfe, 0x29,
+	0x85, 0x09, 0x19, 0x98, 0xdc, 0x00, 0x51, 0x10, 0xfe, 0x63, 0x0b, 0x21, 0xa7, 0x54, 0x6f, 0xc2,
+	0x66, 0x31, 0xcc, 0x2c, 0x31, 0xc1, 0xfe, 0xc6, 0x18, 0xfe, 0x4a, 0x49, 0x9a, 0xbb, 0xfe, 0xb5,
+	0x96, 0x31, 0x61, 0x2a, 0x20, 0x31, 0xc9, 0x25, 0xc0, 0x31, 0xc0, 0x2c, 0xc3, 0x31, 0x62, 0x68,
+	0x69, 0xfe, 0xb5, 0x72, 0xfe, 0x4a, 0x04, 0x9b, 0xc9, 0xfe, 0x9b, 0x03, 0xa9, 0x62, 0x79, 0x7a,
+	0x7a, 0x9c, 0xaa, 0xa4, 0x57, 0x4b, 0x98, 0x9e, 0xfe, 0x49, 0x20, 0xfe, 0x7b, 0x4a, 0xfe, 0xef,
+	0x1b, 0x27, 0x2a, 0xc2, 0x31, 0xcc, 0x2a, 0xc0, 0x65, 0x20, 0x31, 0xfe, 0xcd, 0xd7, 0xfe, 0x51,
+	0xe6, 0x9d, 0xb8, 0xfe, 0xac, 0x0b, 0x9d, 0xa9, 0x94, 0xdd, 0x9e, 0x7b, 0xfe, 0xd6, 0x56, 0x25,
+	0x5b, 0x6e, 0xc0, 0x69, 0xc0, 0x2e, 0xc0, 0x31, 0xcb, 0x29, 0x2e, 0x31, 0x30, 0xfe, 0x7b, 0x8d,
+	0xfe, 0x30, 0xc0, 0xfe, 0x82, 0xc4, 0xfe, 0xcc, 0x46, 0xa0, 0xb5, 0x9e, 0xb7, 0x67, 0xa1, 0x69,
+	0xa0, 0x7b, 0xa1, 0x49, 0x99, 0x9e, 0x94, 0xde, 0x9d, 0x9a, 0xaa, 0x25, 0xfe, 0xb5, 0x52, 0xfe,
+	0xf7, 0x9c, 0x2a, 0x31, 0x56, 0x31, 0xc0, 0x29, 0xc0, 0x6e, 0xc0, 0x31, 0xc1, 0x65, 0x31, 0xd2,
+	0x29, 0xc0, 0x31, 0x2e, 0x29, 0x31, 0xc0, 0x29, 0x7a, 0x29, 0x2c, 0x31, 0xc1, 0x9a, 0xba, 0xfe,
+	0x8c, 0x2e, 0xfe, 0x41, 0x61, 0xa2, 0xa5, 0xfe, 0xab, 0x23, 0xa7, 0x73, 0xa1, 0x96, 0x09, 0x14,
+	0xa1, 0x59, 0x95, 0xbf, 0xfe, 0x41, 0x00, 0xa7, 0x36, 0xfe, 0xb5, 0x12, 0xfe, 0xff, 0xbd, 0x6f,
+	0x51, 0x2c, 0xc0, 0x31, 0xdf, 0x2c, 0xc4, 0x55, 0xfe, 0x9c, 0x6f, 0xfe, 0x49, 0x40, 0xab, 0x50,
+	0xae, 0x30, 0x9d, 0xa8, 0x4e, 0xfe, 0x72, 0x21, 0x00, 0xa1, 0x6a, 0xa3, 0x48, 0xfe, 0xa5, 0x55,
+	0xfe, 0xff, 0xff, 0x2a, 0x2c, 0xc1, 0x31, 0x29, 0x31, 0xfd, 0xf0, 0x2c, 0x31, 0x9a, 0xcb, 0xfe,
+	0x63, 0x2c, 0x92, 0xff, 0x7e, 0xad, 0x22, 0xaa, 0x33, 0x56, 0xc0, 0x65, 0x5a, 0x61, 0x9c, 0xaa,
+	0x9a, 0xbb, 0x9c, 0x9a, 0x9d, 0xa9, 0x31, 0x29, 0x66, 0x69, 0xc0, 0x29, 0x24, 0xad, 0x11, 0xfe,
+	0xd6, 0x99, 0x6f, 0xfe, 0x63, 0x0b, 0x93, 0xef, 0xa4, 0x66, 0x7f, 0x11, 0x7e, 0xaa, 0x34, 0xa8,
+	0x43, 0x14, 0xc0, 0x0d, 0xa2, 0x77, 0x14, 0x55, 0xc0, 0x25, 0x29, 0xc0, 0xa3, 0x77, 0xb0, 0x00,
+	0x0d, 0x14, 0x0d, 0x51, 0xfe, 0x4a, 0x49, 0x1d, 0x29, 0x35, 0xfe, 0xde, 0xdb, 0xa9, 0x33, 0xc0,
+	0x66, 0xc0, 0x31, 0xc9, 0x93, 0xff, 0xfe, 0x5a, 0xeb, 0x1d, 0x66, 0xa3, 0x67, 0xa6, 0x55, 0xac,
+	0x21, 0x99, 0xcc, 0x21, 0xfe, 0xbd, 0xd7, 0xaf, 0x10, 0x2c, 0x51, 0x2c, 0x95, 0xdd, 0xfe, 0x52,
+	0xa9, 0x97, 0xdd, 0x9c, 0xaa, 0xae, 0x11, 0x51, 0x9a, 0xbb, 0xfe, 0x84, 0x2f, 0x66, 0x94, 0xfe,
+	0x97, 0xcd, 0xc0, 0x1d, 0xfe, 0x94, 0x91, 0xfe, 0xef, 0x7d, 0xa4, 0x66, 0xd2, 0x65, 0x6b, 0xc0,
+	0x25, 0x14, 0xfe, 0x31, 0x65, 0xac, 0x12, 0xfe, 0xe7, 0x3c, 0x31, 0x20, 0x6f, 0x25, 0x31, 0xd3,
+	0x51, 0x31, 0x1d, 0x2c, 0xfe, 0xad, 0x75, 0xfe, 0x41, 0xc6, 0x9e, 0xc6, 0xfe, 0xa3, 0x47, 0xa7,
+	0x72, 0xa0, 0xa5, 0x9d, 0xb8, 0xa4, 0x66, 0x1c, 0x9f, 0x6b, 0xfe, 0x7a, 0x43, 0x97, 0xaf, 0xfe,
+	0xac, 0xf3, 0xfe, 0xff, 0x9e, 0x2c, 0x31, 0xcd, 0x2a, 0xc0, 0x31, 0x2a, 0x69, 0x55, 0xa1, 0x7a,
+	0x66, 0xfe, 0x8b, 0xd1, 0xfe, 0x49, 0x63, 0xfe, 0x82, 0x83, 0xac, 0x22, 0x9d, 0x9a, 0xfe, 0x51,
+	0x81, 0xfe, 0x7b, 0x4a, 0xfe, 0xe6, 0xfb, 0x2c, 0x31, 0xc0, 0x2a, 0xc1, 0x31, 0xcd, 0x59, 0x50,
+	0x2c, 0xfe, 0xd6, 0x3a, 0xfe, 0x62, 0x2a, 0x99, 0xe7, 0xfe, 0xb3, 0x65, 0xfe, 0xdc, 0x43, 0x79,
+	0x7a, 0xa0, 0x7b, 0xa0, 0x7a, 0x9d, 0x8c, 0x97, 0x8f, 0x97, 0xaf, 0xc0, 0xfe, 0x83, 0xcd, 0xfe,
+	0xd6, 0x98, 0x1e, 0x25, 0x2a, 0x31, 0xeb, 0x55, 0x2a, 0x9a, 0xbb, 0xfe, 0x83, 0xab, 0xfe, 0x51,
+	0x81, 0xa2, 0x95, 0xfe, 0xbb, 0xc6, 0xa3, 0x86, 0x65, 0xa2, 0x58, 0xfe, 0x8a, 0xc4, 0xfe, 0x41,
+	0x20, 0xab, 0x04, 0xfe, 0xb5, 0x75, 0x25, 0x52, 0xa2, 0x77, 0x31, 0x2c, 0x31, 0xdc, 0x5a, 0xc2,
+	0x31, 0x2c, 0x31, 0xc0, 0x4a, 0x2e, 0x09, 0xfe, 0x7a, 0xe8, 0xfe, 0x59, 0x40, 0xfe, 0xab, 0x22,
+	0xab, 0x33, 0x9d, 0x9b, 0x9e, 0x5b, 0xfe, 0x49, 0x60, 0xa2, 0x68, 0x9b, 0x9c, 0xad, 0x13, 0xfe,
+	0xde, 0xda, 0x31, 0xfd, 0xf8, 0x1d, 0xfe, 0xad, 0x34, 0x19, 0x9a, 0xbc, 0x6e, 0xab, 0x33, 0x0d,
+	0x6b, 0x65, 0xa3, 0x66, 0x08, 0x98, 0xcc, 0x9c, 0xaa, 0xa3, 0x66, 0xa2, 0x77, 0x38, 0x51, 0x41,
+	0x9c, 0xaa, 0x9b, 0xbb, 0x9d, 0x99, 0xa2, 0x77, 0x7a, 0x29, 0xfe, 0x73, 0xae, 0xfe, 0xe7, 0x1b,
+	0xfe, 0xa5, 0x34, 0x34, 0xa7, 0x44, 0xa5, 0x65, 0xc0, 0x6b, 0xa3, 0x66, 0x14, 0x69, 0xc0, 0x05,
+	0xa2, 0x77, 0x14, 0x0d, 0x1d, 0x11, 0x9b, 0xbb, 0xa2, 0x76, 0xa7, 0x45, 0xad, 0x22, 0x0d, 0x5a,
+	0x14, 0x1d, 0xfe, 0x39, 0xc7, 0x24, 0x0c, 0x19, 0xfe, 0xef, 0x7d, 0xa4, 0x66, 0x66, 0x31, 0xca,
+	0x99, 0xcc, 0x05, 0x38, 0x65, 0x38, 0x9d, 0x99, 0xfe, 0x6b, 0x6d, 0x9d, 0xaa, 0x99, 0xbb, 0xfe,
+	0xa5, 0x13, 0xfe, 0xf7, 0x9e, 0xa2, 0x77, 0x65, 0x2c, 0x31, 0xfe, 0xce, 0x38, 0x06, 0x98, 0xcd,
+	0x9b, 0xba, 0xa3, 0x66, 0x7f, 0xa8, 0x34, 0xb1, 0x00, 0x98, 0xdc, 0x92, 0xff, 0x9b, 0xba, 0x56,
+	0xa8, 0x33, 0xfe, 0xbd, 0xf6, 0xb0, 0x00, 0x6b, 0xd2, 0x61, 0xc0, 0x31, 0x99, 0xcc, 0xfe, 0x63,
+	0x0c, 0x93, 0xee, 0x08, 0xfe, 0xf7, 0xbe, 0x31, 0x2c, 0x31, 0xd4, 0x2c, 0x31, 0xc0, 0x2c, 0x1d,
+	0x9b, 0xbb, 0xfe, 0x83, 0xce, 0xfe, 0x41, 0x22, 0xa7, 0x62, 0xfe, 0xbb, 0xc7, 0xa5, 0x83, 0x9d,
+	0xb7, 0xc0, 0xa1, 0x6a, 0x9b, 0x8c, 0xfe, 0x59, 0x80, 0xa4, 0x49, 0xfe, 0xcd, 0xf7, 0x2c, 0x66,
+	0xa2, 0x66, 0xcd, 0x2a, 0x31, 0xc0, 0x2a, 0xc0, 0x55, 0x2e, 0x98, 0xdd, 0xfe, 0x6a, 0xcc, 0xfe,
+	0x49, 0x22, 0xfe, 0x93, 0x04, 0xaa, 0x24, 0x94, 0xef, 0x96, 0xcf, 0xfe, 0x9c, 0x4f, 0xfe, 0xf7,
+	0x7d, 0x2c, 0x31, 0xc0, 0x2a, 0xc1, 0x31, 0xcd, 0x59, 0x1b, 0x9e, 0xac, 0xfe, 0xb5, 0x15, 0xfe,
+	0x59, 0xa7, 0xa1, 0x92, 0xfe, 0xc3, 0xe6, 0xa3, 0x82, 0x7a, 0x56, 0xa1, 0x7a, 0x9d, 0x8c, 0xfe,
+	0x82, 0x43, 0x98, 0x8e, 0xa9, 0x16, 0xfe, 0xa4, 0xd1, 0xaf, 0x01, 0xa8, 0x44, 0x2a, 0x19, 0x2a,
+	0x6b, 0xeb, 0x55, 0x2e, 0x2a, 0x93, 0xfe, 0xfe, 0x7b, 0x28, 0xfe, 0x59, 0x80, 0xa9, 0x52, 0xaa,
+	0x42, 0x3c, 0x97, 0xad, 0xfe, 0x51, 0x60, 0xa5, 0x36, 0xfe, 0xad, 0x11, 0xfe, 0xf7, 0x9e, 0x2c,
+	0xc0, 0x6e, 0x51, 0x2c, 0x31, 0xe1, 0x2c, 0x2a, 0x31, 0x2b, 0x2e, 0x97, 0xec, 0xfe, 0x51, 0xc3,
+	0x9f, 0xb6, 0xfe, 0xb3, 0x83, 0xa6, 0x66, 0xa1, 0x69, 0xfe, 0x82, 0xe5, 0xfe, 0x41, 0x40, 0x5b,
+	0xa0, 0x8a, 0xfe, 0x8c, 0x2f, 0xfe, 0xf7, 0x9d, 0x31, 0xfd, 0xf8, 0x30, 0xfe, 0x73, 0xae, 0xfe,
+	0x29, 0x65, 0xc0, 0x61, 0xa7, 0x45, 0x1d, 0xa5, 0x66, 0x05, 0x61, 0x14, 0x00, 0x96, 0xdc, 0x99,
+	0xcc, 0xa2, 0x67, 0xa4, 0x76, 0xa7, 0x44, 0xa4, 0x66, 0x9d, 0xaa, 0x97, 0xcc, 0x97, 0xdd, 0x9d,
+	0x99, 0x2c, 0x18, 0x29, 0xfe, 0x8c, 0x50, 0xa5, 0x56, 0xfe, 0x5a, 0xcb, 0xa9, 0x33, 0xa4, 0x66,
+	0x05, 0xc1, 0x0d, 0xc0, 0x6b, 0x19, 0xc0, 0x21, 0x14, 0x97, 0xcc, 0x3d, 0x9c, 0xaa, 0x29, 0xad,
+	0x22, 0x14, 0x21, 0x14, 0x0d, 0x95, 0xde, 0x29, 0x65, 0xa8, 0x45, 0xfe, 0xbd, 0xd7, 0xb0, 0x00,
+	0xc1, 0x6e, 0xc9, 0x51, 0xfe, 0xad, 0x55, 0xfe, 0x4a, 0x28, 0x15, 0x29, 0x65, 0xa4, 0x67, 0x20,
+	0x34, 0xab, 0x22, 0xfe, 0xef, 0x3c, 0x31, 0x2c, 0x31, 0x2c, 0x99, 0xcb, 0xfe, 0x94, 0x91, 0xfe,
+	0x39, 0xc6, 0x29, 0x65, 0xc0, 0x05, 0x11, 0xa9, 0x33, 0x93, 0xff, 0x94, 0xfe, 0x51, 0x09, 0xfe,
+	0x6b, 0x4c, 0xfe, 0xe7, 0x1b, 0xa6, 0x55, 0x31, 0xd2, 0x2c, 0x25, 0x31, 0xfe, 0xbd, 0xb6, 0x0c,
+	0x6e, 0xfe, 0xb5, 0x75, 0x25, 0x6b, 0x31, 0xd7, 0x51, 0x31, 0x2c, 0xc0, 0x94, 0xed, 0xfe, 0x5a,
+	0x46, 0x99, 0xea, 0xfe, 0x9b, 0x05, 0xa9, 0x60, 0xa2, 0x86, 0x50, 0xa1, 0x69, 0xfe, 0x92, 0xe3,
+	0xfe, 0x41, 0x20, 0xfe, 0x7b, 0x4a, 0x29, 0x31, 0x56, 0x31, 0xcd, 0x2a, 0x31, 0xc1, 0x2a, 0x69,
+	0x31, 0xfe, 0xbd, 0xd7, 0xfe, 0x49, 0xc7, 0x9d, 0xc6, 0xfe, 0xab, 0xa6, 0x32, 0xfe, 0x61, 0xc2,
+	0x4b, 0xfe, 0xc5, 0x74, 0xfe, 0xff, 0xbf, 0x5a, 0x31, 0xc0, 0x2a, 0xc1, 0x31, 0xcd, 0x55, 0x2a,
+	0x9b, 0xbc, 0xfe, 0x94, 0x10, 0xfe, 0x51, 0x64, 0x1f, 0xfe, 0xcc, 0x68, 0xa0, 0xa5, 0x65, 0x5b,
+	0x9a, 0xae, 0xfe, 0x7a, 0x01, 0x9b, 0x9c, 0xab, 0x05, 0xfe, 0xad, 0x33, 0xfe, 0xf7, 0x7c, 0xa3,
+	0x67, 0x65, 0xc0, 0x6b, 0xa2, 0x67, 0xec, 0x2e, 0x31, 0xc0, 0x50, 0xfe, 0xbd, 0x73, 0xfe, 0x5a,
+	0x04, 0x9b, 0xc9, 0xad, 0x30, 0xa9, 0x43, 0xfe, 0x6a, 0x22, 0x98, 0xbe, 0xfe, 0x94, 0x0d, 0xfe,
+	0xef, 0x5b, 0x2c, 0x55, 0x2c, 0xc1, 0x6e, 0xdf, 0x2a, 0xc1, 0x25, 0xc0, 0x2a, 0x4b, 0x2e, 0xfe,
+	0xa5, 0x13, 0xfe, 0x38, 0xe0, 0xfe, 0x7a, 0x20, 0xfe, 0xcc, 0x05, 0x6f, 0xa3, 0x69, 0xfe, 0x6a,
+	0x23, 0x9a, 0xac, 0x9d, 0x8b, 0xa6, 0x46, 0xfe, 0xbd, 0xb5, 0x31, 0xfd, 0xf8, 0x2c, 0x94, 0xee,
+	0xfe, 0x52, 0xaa, 0x94, 0xee, 0xa2, 0x77, 0x66, 0xa2, 0x76, 0xaa, 0x33, 0xa9, 0x44, 0xa4, 0x56,
+	0x66, 0x9d, 0x99, 0xa2, 0x77, 0x14, 0x96, 0xdc, 0x93, 0xff, 0x51, 0xa7, 0x44, 0xac, 0x22, 0x14,
+	0x9b, 0xaa, 0x96, 0xed, 0x97, 0xcc, 0x56, 0x2c, 0x1d, 0x6f, 0xa9, 0x43, 0x51, 0x31, 0xa6, 0x55,
+	0x51, 0xc0, 0x14, 0xc0, 0x19, 0x14, 0x05, 0x66, 0x14, 0x00, 0x0d, 0x97, 0xdd, 0x15, 0xa5, 0x65,
+	0xaf, 0x01, 0x14, 0x19, 0xc0, 0x31, 0xfe, 0x39, 0xe7, 0x24, 0x15, 0xfe, 0x63, 0x4c, 0xfe, 0xe7,
+	0x1c, 0xa5, 0x55, 0x7f, 0x6e, 0xca, 0x98, 0xcc, 0xfe, 0x6b, 0x2c, 0xfe, 0x21, 0x04, 0xa3, 0x76,
+	0x55, 0x10, 0xfe, 0x6b, 0x4d, 0x50, 0x0d, 0xfe, 0xd6, 0x79, 0x31, 0x66, 0xc0, 0x31, 0x93, 0xff,
+	0x00, 0xfe, 0x42, 0x07, 0x15, 0xa3, 0x66, 0x65, 0xc0, 0xa8, 0x45, 0xad, 0x21, 0x51, 0x94, 0xee,
+	0x99, 0xcc, 0x65, 0x6e, 0xfe, 0x94, 0x91, 0xfe, 0xff, 0xde, 0x5a, 0xc0, 0x31, 0xd3, 0x9b, 0xbb,
+	0x39, 0x15, 0x0d, 0x34, 0x25, 0x31, 0xd8, 0x66, 0x31, 0xc0, 0x51, 0x25, 0xfe, 0x94, 0x4f, 0xfe,
+	0x41, 0x20, 0xa7, 0x62, 0xfe, 0xbb, 0xa5, 0xa6, 0x63, 0x0e, 0x5f, 0xfe, 0x7a, 0x62, 0x97, 0xaf,
+	0xfe, 0xa4, 0xb0, 0x16, 0x31, 0x5a, 0x31, 0xd1, 0x69, 0xc0, 0x16, 0xfe, 0x9c, 0xb2, 0xfe, 0x41,
+	0x44, 0xa7, 0x61, 0xfe, 0xbc, 0x08, 0x9c, 0x8c, 0xfe, 0x41, 0x00, 0xab, 0x13, 0xfe, 0xde, 0x78,
+	0x2c, 0x56, 0x31, 0xc1, 0x2a, 0xc0, 0x31, 0xcd, 0x22, 0x31, 0x96, 0xed, 0xfe, 0x72, 0xc9, 0xfe,
+	0x51, 0x41, 0xfe, 0x93, 0x04, 0xac, 0x40, 0x1b, 0x6b, 0x9d, 0x8b, 0xfe, 0x71, 0xe1, 0xfe, 0x40,
+	0xc0, 0xfe, 0x72, 0xa7, 0xfe, 0xd6, 0x16, 0xfe, 0xff, 0xdd, 0x2a, 0x1e, 0x66, 0x2a, 0x31, 0xee,
+	0x2e, 0x9d, 0xaa, 0xa2, 0x76, 0x9b, 0xca, 0xfe, 0x8b, 0xed, 0xfe, 0x41, 0x41, 0xa6, 0x65, 0xa6,
+	0x54, 0x95, 0xdf, 0xa9, 0x24, 0xfe, 0xce, 0x36, 0x2a, 0x2c, 0x6e, 0xc0, 0x2c, 0x31, 0x2c, 0x31,
+	0xdc, 0x2a, 0xc3, 0x66, 0xc0, 0x2a, 0x2b, 0x9d, 0xa9, 0xfe, 0x62, 0xea, 0x00, 0xfe, 0x8a, 0xa2,
+	0xfe, 0xd4, 0x46, 0x52, 0xa1, 0x79, 0xfe, 0x51, 0xa1, 0x47, 0x9c, 0xac, 0xad, 0x12, 0xfe, 0xde,
+	0xba, 0x31, 0x2c, 0x31, 0xfd, 0xf5, 0x2c, 0xc0, 0xfe, 0xb5, 0x96, 0xfe, 0x42, 0x28, 0x99, 0xcb,
+	0x7f, 0xc0, 0x1d, 0xa3, 0x77, 0xa6, 0x45, 0xa7, 0x54, 0xa5, 0x56, 0x7f, 0x6e, 0x14, 0x9d, 0xa9,
+	0x9a, 0xab, 0x97, 0xdc, 0x1d, 0x19, 0xac, 0x22, 0xa4, 0x66, 0x51, 0x97, 0xdd, 0x97, 0xcc, 0x9d,
+	0x9a, 0xa3, 0x77, 0x1d, 0x66, 0x31, 0xaa, 0x34, 0xa4, 0x66, 0xc1, 0xa2, 0x77, 0x6e, 0x25, 0x6f,
+	0xa3, 0x76, 0x14, 0x21, 0x1d, 0x19, 0x9b, 0xab, 0xc0, 0xa7, 0x55, 0x05, 0x0d, 0x05, 0xa2, 0x77,
+	0x95, 0xed, 0x93, 0xef, 0xc1, 0xfe, 0x9c, 0xd3, 0xfe, 0xff, 0xdf, 0xc0, 0x6e, 0xc8, 0x2c, 0xc0,
+	0x9d, 0x99, 0xfe, 0xa5, 0x13, 0xfe, 0x39, 0xa6, 0x9a, 0xab, 0x29, 0xc0, 0xa6, 0x55, 0xad, 0x21,
+	0x97, 0xcd, 0x14, 0xfe, 0xf7, 0x9e, 0x31, 0x2c, 0xc0, 0x9b, 0xaa, 0xfe, 0x7b, 0xcf, 0x29, 0x9d,
+	0x99, 0x29, 0x6e, 0x61, 0xa6, 0x45, 0x11, 0xa7, 0x44, 0x94, 0xfe, 0x97, 0xcd, 0x9c, 0xba, 0x5a,
+	0xa8, 0x44, 0xfe, 0xc6, 0x17, 0x31, 0x69, 0x31, 0xd2, 0x66, 0x31, 0x93, 0xff, 0x1c, 0x93, 0xfe,
+	0xfe, 0x73, 0x8e, 0xfe, 0xe7, 0x1b, 0x31, 0xc2, 0x2c, 0x31, 0xd5, 0x51, 0x2c, 0x1d, 0x31, 0x93,
+	0xfd, 0xfe, 0x51, 0xe4, 0x9c, 0xc8, 0xfe, 0xab, 0xa6, 0xa5, 0x74, 0x65, 0x9d, 0x8b, 0xfe, 0x59,
+	0xc0, 0xa2, 0x5a, 0xfe, 0xc5, 0xd5, 0xfe, 0xf7, 0xde, 0xc0, 0x31, 0xd0, 0x5a, 0x31, 0xc0, 0x2a,
+	0x29, 0xfe, 0x7b, 0x6c, 0xfe, 0x41, 0x42, 0xfe, 0x8b, 0x06, 0xa9, 0x51, 0xfe, 0x7a, 0x84, 0xfe,
+	0x38, 0xe0, 0xfe, 0x8b, 0xac, 0xfe, 0xef, 0x1b, 0xa6, 0x46, 0x31, 0xc2, 0x2a, 0xc0, 0x31, 0xce,
+	0x2c, 0xfe, 0xbd, 0x54, 0xfe, 0x51, 0xc3, 0xa0, 0xa6, 0xfe, 0xab, 0xc7, 0xa6, 0x63, 0x65, 0x9a,
+	0xbd, 0xfe, 0x7a, 0x22, 0x98, 0xae, 0xac, 0x13, 0xfe, 0xc5, 0xb4, 0xaf, 0x01, 0xa2, 0x68, 0x65,
+	0x5a, 0x2a, 0x6b, 0x25, 0x31, 0xec, 0x2a, 0x57, 0x2e, 0x29, 0x69, 0xfe, 0xc6, 0x17, 0xfe, 0x4a,
+	0x27, 0x99, 0xda, 0xa2, 0x77, 0x6f, 0xfe, 0xa4, 0xd1, 0xfe, 0xf7, 0x9d, 0xa3, 0x67, 0x2c, 0x1d,
+	0x31, 0xc1, 0x2c, 0x31, 0xdc, 0x2a, 0xc3, 0x25, 0xc0, 0x5e, 0x5b, 0xfe, 0xce, 0x79, 0xfe, 0x41,
+	0xc6, 0x9e, 0xc5, 0xfe, 0xa3, 0x45, 0xa8, 0x61, 0x52, 0x9a, 0xad, 0xfe, 0x41, 0x41, 0x5b, 0xa1,
+	0x79, 0xfe, 0x8c, 0x0f, 0xfe, 0xef, 0x5d, 0x31, 0x2c, 0x31, 0xfd, 0xf3, 0x2c, 0x31, 0xc0, 0x2c,
+	0xfe, 0xad, 0x55, 0xfe, 0x39, 0xe7, 0x9c, 0xaa, 0x66, 0xc0, 0x29, 0x7a, 0x24, 0xa3, 0x66, 0xa2,
+	0x87, 0xa5, 0x55, 0xa6, 0x55, 0xa5, 0x66, 0xa3, 0x66, 0x52, 0x3d, 0x97, 0xcd, 0x9b, 0xba, 0xa4,
+	0x66, 0xa9, 0x44, 0xa8, 0x44, 0x41, 0x98, 0xdc, 0x95, 0xdd, 0x9d, 0xaa, 0x2c, 0x55, 0x18, 0xa3,
+	0x67, 0x6e, 0xc1, 0x14, 0x55, 0xa3, 0x77, 0x6f, 0xa5, 0x55, 0xa3, 0x76, 0xa5, 0x66, 0x9a, 0xab,
+	0x94, 0xee, 0x9d, 0xaa, 0x2c, 0xa9, 0x34, 0xad, 0x21, 0x0d, 0x6b, 0x00, 0xfe, 0x42, 0x08, 0x24,
+	0x29, 0x11, 0xfe, 0xd6, 0x79, 0xac, 0x12, 0x51, 0x31, 0xc8, 0x66, 0xc0, 0x92, 0xff, 0xfe, 0x4a,
+	0x69, 0x96, 0xdd, 0x38, 0x15, 0xa2, 0x87, 0xaf, 0x01, 0x50, 0x21, 0x20, 0x1d, 0x31, 0x66, 0x31,
+	0x94, 0xee, 0xfe, 0x4a, 0x69, 0x95, 0xde, 0xa3, 0x76, 0x56, 0x69, 0xa2, 0x87, 0xac, 0x12, 0xa9,
+	0x43, 0x66, 0xfe, 0x4a, 0x27, 0x9b, 0xbb, 0xc0, 0x56, 0xb0, 0x00, 0xfe, 0xef, 0x5c, 0xa4, 0x66,
+	0x5a, 0x7f, 0xd2, 0x66, 0x25, 0xfe, 0xb5, 0x75, 0xfe, 0x42, 0x08, 0x38, 0x30, 0xfe, 0xf7, 0x9e,
+	0x31, 0xc0, 0x66, 0x31, 0x2c, 0x31, 0xd3, 0x2c, 0x31, 0x2c, 0xc0, 0x31, 0x2c, 0x9d, 0xa9, 0xfe,
+	0x73, 0x4a, 0xfe, 0x49, 0x40, 0xfe, 0x93, 0x25, 0xa9, 0x52, 0x7f, 0x96, 0xce, 0xfe, 0x49, 0x60,
+	0xaa, 0x25, 0xfe, 0xde, 0xb9, 0x31, 0x56, 0x31, 0xd0, 0x2e, 0xc1, 0x22, 0x94, 0xfd, 0xfe, 0x5a,
+	0x67, 0xfe, 0x49, 0x20, 0xfe, 0xa3, 0xa8, 0xa2, 0x95, 0xfe, 0x61, 0xe2, 0x9d, 0x7c, 0xfe, 0xb5,
+	0x33, 0xfe, 0xff, 0xbe, 0x1d, 0xa2, 0x77, 0x56, 0x31, 0xc0, 0x69, 0xc0, 0x31, 0xce, 0x0c, 0xfe,
+	0x9c, 0x2e, 0x12, 0xaa, 0x51, 0xfe, 0xc4, 0x89, 0x9d, 0xa9, 0x52, 0xfe, 0x7a, 0x42, 0x17, 0xfe,
+	0x72, 0xe9, 0xfe, 0xcd, 0xf6, 0xad, 0x02, 0x25, 0x65, 0xc0, 0x25, 0xc1, 0x31, 0xed, 0x25, 0x31,
+	0x5a, 0xc0, 0x56, 0x9d, 0xaa, 0xfe, 0x73, 0x8e, 0xfe, 0x31, 0x65, 0x65, 0xab, 0x23, 0xfe, 0xd6,
+	0x9a, 0x31, 0x52, 0x7e, 0xc2, 0x31, 0xe3, 0x2c, 0x29, 0x2e, 0x2b, 0xfe, 0xad, 0x75, 0xfe, 0x49,
+	0xc5, 0xa0, 0xb5, 0xfe, 0xbb, 0xc7, 0xa3, 0x84, 0x52, 0xfe, 0x8a, 0x42, 0xfe, 0x41, 0x42, 0x4b,
+	0xa7, 0x56, 0xfe, 0xbd, 0xb6, 0x2c, 0xc0, 0x31, 0xfd, 0xf3, 0x2c, 0xc0, 0x31, 0x2c, 0x55, 0xfe,
+	0xa5, 0x14, 0xfe, 0x39, 0xa6, 0x55, 0x51, 0x6f, 0xc0, 0x00, 0x9c, 0x9a, 0x7f, 0x1d, 0x24, 0xa3,
+	0x66, 0xa7, 0x55, 0xaa, 0x32, 0xa4, 0x67, 0x50, 0x9d, 0x9a, 0x96, 0xed, 0x96, 0xdd, 0xa7, 0x44,
+	0xa6, 0x55, 0xab, 0x23, 0x39, 0x98, 0xcc, 0x96, 0xdd, 0x18, 0xc0, 0x24, 0xc0, 0x18, 0xc0, 0x24,
+	0x7e, 0x18, 0xa2, 0x67, 0x24, 0x2c, 0x3d, 0xa2, 0x87, 0x56, 0x2c, 0x24, 0xc0, 0x14, 0xad, 0x11,
+	0xa6, 0x56, 0x55, 0x99, 0xcc, 0x24, 0x29, 0x51, 0x1d, 0xfe, 0xef, 0x7d, 0xa4, 0x66, 0xc6, 0x51,
+	0x31, 0xc0, 0x66, 0x31, 0x9a, 0xbb, 0xfe, 0x83, 0xef, 0x18, 0xc0, 0xa2, 0x77, 0x24, 0xa7, 0x44,
+	0xaa, 0x33, 0x95, 0xee, 0x34, 0x35, 0xa5, 0x66, 0x31, 0x2c, 0x31, 0xfe, 0xc6, 0x18, 0xfe, 0x39,
+	0xe7, 0x98, 0xcc, 0x3d, 0x9d, 0x9a, 0x29, 0x25, 0xad, 0x20, 0xa3, 0x77, 0x96, 0xdd, 0x94, 0xee,
+	0xa4, 0x66, 0x9c, 0xbb, 0x00, 0xfe, 0x94, 0x71, 0xfe, 0xff, 0xde, 0xc0, 0x22, 0x31, 0xd2, 0x2c,
+	0x9c, 0xaa, 0xfe, 0x94, 0x91, 0x15, 0xa9, 0x44, 0xfe, 0xce, 0x59, 0x2c, 0xc0, 0x25, 0x2c, 0x31,
+	0x2c, 0x31, 0xd3, 0x2c, 0x31, 0xc2, 0x2c, 0x65, 0xfe, 0xb5, 0x12, 0xfe, 0x49, 0x41, 0xa9, 0x51,
+	0xfe, 0xcc, 0x8b, 0x9c, 0xaa, 0x2d, 0x95, 0xcf, 0xfe, 0x9c, 0x4f, 0xfe, 0xff, 0xbd, 0x2c, 0x31,
+	0xd0, 0x2e, 0xc1, 0x66, 0x65, 0xfe, 0xac, 0xf1, 0xfe, 0x41, 0x62, 0xa6, 0x73, 0xfe, 0xab, 0xe8,
+	0x9d, 0xa9, 0xfe, 0x51, 0x82, 0xa5, 0x37, 0xfe, 0xd6, 0x57, 0x25, 0x56, 0x31, 0xcf, 0x2c, 0xc0,
+	0x31, 0xc1, 0x98, 0xec, 0xfe, 0x72, 0xe9, 0x95, 0xfa, 0xfe, 0x9b, 0x65, 0x3b, 0x9d, 0xaa, 0xfe,
+	0x82, 0x83, 0xfe, 0x49, 0x20, 0xfe, 0x7b, 0x09, 0xfe, 0xd6, 0x37, 0xab, 0x13, 0xa2, 0x68, 0x31,
+	0x2a, 0x31, 0xcb, 0x2c, 0x31, 0xc0, 0x2c, 0xc0, 0x40, 0x31, 0xc0, 0x9d, 0xaa, 0x9b, 0xaa, 0x98,
+	0xcc, 0x9a, 0xbb, 0x9d, 0xaa, 0x6e, 0x11, 0x35, 0x1d, 0x2c, 0x31, 0xd2, 0x25, 0xc0, 0x1d, 0x29,
+	0xc1, 0xfe, 0xb5, 0xd7, 0xfe, 0x31, 0x86, 0x65, 0xfe, 0x83, 0xef, 0x35, 0x31, 0x66, 0x31, 0xd8,
+	0x55, 0x31, 0x22, 0x2c, 0xc1, 0x31, 0xc0, 0x2c, 0xc0, 0x31, 0x2a, 0x25, 0x5e, 0x2c, 0x66, 0x29,
+	0x31, 0x40, 0xfe, 0x94, 0x71, 0xfe, 0x41, 0x43, 0xa9, 0x70, 0xfe, 0xc4, 0x08, 0xa2, 0x94, 0x9d,
+	0x8c, 0xfe, 0x71, 0xa0, 0x9d, 0x4d, 0x5b, 0xb0, 0x01, 0xfe, 0xe6, 0xdb, 0x31, 0x2c, 0x31, 0xfd,
+	0xf4, 0x2c, 0x31, 0xc0, 0x2c, 0xfe, 0xad, 0x55, 0xfe, 0x39, 0xe7, 0x9d, 0xa9, 0x51, 0x6b, 0x1d,
+	0x6f, 0x24, 0x29, 0x24, 0xc0, 0x65, 0x38, 0xa8, 0x44, 0xaa, 0x32, 0xa4, 0x66, 0xc0, 0x96, 0xdd,
+	0x93, 0xff, 0x31, 0xc0, 0xac, 0x23, 0xa7, 0x44, 0xa2, 0x77, 0x9a, 0xbb, 0x96, 0xed, 0x3d, 0x1d,
+	0x24, 0x38, 0xc0, 0x55, 0xc0, 0x2c, 0x24, 0xc6, 0x18, 0x24, 0xa9, 0x33, 0xaa, 0x33, 0xa3, 0x77,
+	0x08, 0x24, 0xc0, 0x29, 0x10, 0xfe, 0xff, 0xde, 0x6f, 0xc6, 0x66, 0x31, 0x2c, 0x31, 0x51, 0xfe,
+	0xb5, 0xb6, 0xfe, 0x4a, 0x48, 0x18, 0xa2, 0x77, 0x24, 0xa2, 0x76, 0xa9, 0x34, 0x7e, 0x9b, 0xab,
+	0xfe, 0xad, 0x55, 0xfe, 0xff, 0xde, 0x6f, 0xc0, 0x66, 0xc0, 0x96, 0xdd, 0x30, 0x29, 0x51, 0x29,
+	0x2d, 0xaa, 0x33, 0xaa, 0x32, 0x98, 0xdc, 0xfe, 0x41, 0xa4, 0x6e, 0xa5, 0x66, 0x97, 0xce, 0xa5,
+	0x56, 0xfe, 0xb5, 0x74, 0xfe, 0xff, 0xff, 0xd5, 0x2c, 0x98, 0xcc, 0xfe, 0x73, 0x6d, 0xfe, 0x10,
+	0xa2, 0xfe, 0x63, 0x0b, 0xfe, 0xe7, 0x1c, 0xa6, 0x54, 0x31, 0xc0, 0x2c, 0x25, 0x2c, 0xc0, 0x31,
+	0xd8, 0x27, 0xfe, 0xcd, 0xd6, 0xfe, 0x49, 0x83, 0xa4, 0x84, 0xfe, 0xc4, 0x8c, 0x99, 0xcb, 0xfe,
+	0x69, 0xe3, 0x9e, 0x7a, 0xfe, 0xc5, 0xb5, 0x31, 0x61, 0x6f, 0x25, 0x31, 0xcb, 0x2c, 0x31, 0xc1,
+	0x5a, 0xc1, 0x04, 0xfe, 0x83, 0x8c, 0xfe, 0x41, 0x00, 0xfe, 0x8b, 0x05, 0xa9, 0x53, 0x96, 0xcd,
+	0xfe, 0x41, 0x21, 0xfe, 0x73, 0x4b, 0xfe, 0xef, 0x1b, 0x25, 0x22, 0x31, 0xcf, 0x66, 0x31, 0xc2,
+	0xfe, 0xce, 0x17, 0xfe, 0x51, 0xe4, 0xa0, 0x95, 0xfe, 0xac, 0x07, 0xa2, 0x88, 0x16, 0xfe, 0x49,
+	0x40, 0xa8, 0x36, 0xfe, 0xb5, 0x53, 0x1d, 0x6f, 0xc0, 0x31, 0xcf, 0x2c, 0x31, 0xc1, 0x9a, 0xbb,
+	0x3d, 0x93, 0xff, 0x95, 0xdd, 0x98, 0xcc, 0x51, 0xc1, 0x3d, 0xa7, 0x55, 0xfe, 0x94, 0xb2, 0xfe,
+	0xf7, 0x9e, 0x2c, 0x31, 0xd0, 0x25, 0x60, 0x2a, 0x31, 0xc1, 0x5a, 0x52, 0xfe, 0x5a, 0xeb, 0x94,
+	0xef, 0xfe, 0x84, 0x31, 0x04, 0xa3, 0x67, 0x2c, 0x31, 0xd8, 0x60, 0x56, 0x65, 0x2a, 0x31, 0x11,
+	0x18, 0x20, 0x25, 0x20, 0x65, 0xc0, 0x19, 0x5a, 0x25, 0x27, 0x19, 0x11, 0x9b, 0xaa, 0xfe, 0x83,
+	0xad, 0xfe, 0x41, 0x21, 0xfe, 0x9a, 0xe6, 0xaa, 0x40, 0x7d, 0x9a, 0xbd, 0xfe, 0x61, 0x81, 0x9e,
+	0x5c, 0x5f, 0x00, 0x04, 0x2c, 0xc1, 0x31, 0xfd, 0xf7, 0x92, 0xff, 0xfe, 0x4a, 0x69, 0x98, 0xdc,
+	0x38, 0x9d, 0xa9, 0x6e, 0x15, 0x2c, 0x56, 0xc1, 0x18, 0xc0, 0x38, 0x21, 0xac, 0x22, 0xc0, 0x21,
+	0x95, 0xed, 0x1d, 0x18, 0x31, 0xa8, 0x44, 0xa9, 0x44, 0xa5, 0x55, 0x9c, 0xaa, 0x21, 0x99, 0xcb,
+	0x9b, 0xab, 0x9d, 0xaa, 0x24, 0x31, 0x29, 0x18, 0x1d, 0x24, 0x29, 0xc0, 0x2c, 0x29, 0xc1, 0x24,
+	0x10, 0x24, 0xa8, 0x44, 0xa7, 0x54, 0x95, 0xdd, 0x2c, 0x18, 0x34, 0xfe, 0xd6, 0x9a, 0xab, 0x22,
+	0x66, 0x31, 0xc4, 0x2c, 0x31, 0x2c, 0xc0, 0x31, 0x96, 0xdd, 0xfe, 0x73, 0x8e, 0x1d, 0x29, 0x7f,
+	0x24, 0x29, 0xa8, 0x54, 0x9b, 0xab, 0x19, 0xfe, 0xbd, 0xd6, 0x31, 0x61, 0x2c, 0x31, 0x2c, 0x56,
+	0x9b, 0xba, 0xfe, 0x8c, 0x51, 0x3d, 0xa2, 0x77, 0xab, 0x32, 0xa7, 0x54, 0x7a, 0x93, 0xfd, 0x98,
+	0xcc, 0xab, 0x33, 0x9a, 0xab, 0x99, 0xbd, 0xab, 0x23, 0xfe, 0xd6, 0x99, 0x31, 0xd5, 0x9d, 0xaa,
+	0x93, 0xee, 0xfe, 0x42, 0x28, 0x15, 0x2d, 0xfe, 0xff, 0xbe, 0x2c, 0x69, 0xc0, 0x31, 0xc1, 0x2c,
+	0x31, 0xd8, 0x2c, 0x94, 0xfd, 0xfe, 0x59, 0xe5, 0x74, 0xfe, 0xbc, 0x6c, 0x97, 0xdd, 0xfe, 0x51,
+	0x62, 0x1c, 0xfe, 0xee, 0xfb, 0x31, 0x20, 0xc0, 0x25, 0x31, 0xcb, 0x25, 0x31, 0xc1, 0x2e, 0xc0,
+	0x31, 0x94, 0xfe, 0xfe, 0x62, 0x46, 0x99, 0xd9, 0xfe, 0xab, 0xc8, 0xa4, 0x56, 0xfe, 0x72, 0x43,
+	0xfe, 0x39, 0x01, 0xfe, 0xad, 0x13, 0x2a, 0x25, 0x31, 0xcf, 0x2c, 0x31, 0xc1, 0x2c, 0x20, 0xfe,
+	0x9c, 0x70, 0xfe, 0x31, 0x00, 0xac, 0x40, 0xfe, 0xbc, 0x8a, 0x99, 0xbd, 0xfe, 0x51, 0x81, 0x9f,
+	0x8b, 0xfe, 0xac, 0xf2, 0xfe, 0xef, 0x5c, 0x31, 0x2e, 0x66, 0x31, 0xce, 0x2c, 0xc0, 0x31, 0x9d,
+	0xa9, 0x94, 0xef, 0xfe, 0x7b, 0xef, 0xfe, 0x42, 0x08, 0x9a, 0xba, 0x9d, 0x9a, 0x7e, 0x7f, 0x5a,
+	0xa2, 0x77, 0xc0, 0x15, 0xaa, 0x33, 0xfe, 0xad, 0x75, 0x2c, 0x6e, 0xd1, 0x64, 0x62, 0x11, 0x25,
+	0x31, 0x56, 0x31, 0x2d, 0xfe, 0x39, 0xc7, 0xfe, 0x9c, 0xd3, 0xfe, 0xf7, 0xbe, 0x2c, 0xc0, 0x31,
+	0xd7, 0x2c, 0x97, 0xdb, 0xfe, 0x94, 0x70, 0x99, 0xbc, 0x9d, 0xaa, 0xa2, 0x76, 0x6b, 0x65, 0xc0,
+	0x05, 0x79, 0x65, 0xc0, 0x6e, 0x52, 0x7f, 0x7b, 0x35, 0xc0, 0x9c, 0xaa, 0x96, 0xfc, 0x9d, 0xb9,
+	0xfe, 0xab, 0x46, 0xa8, 0x53, 0x68, 0xfe, 0x9a, 0xe5, 0xfe, 0x51, 0x40, 0xa1, 0x4a, 0xa4, 0x57,
+	0xfe, 0xa5, 0x14, 0xfe, 0xff, 0xbf, 0x2c, 0xc0, 0x31, 0xfd, 0xf8, 0x9a, 0xbb, 0xfe, 0x7b, 0xce,
+	0xfe, 0x29, 0x65, 0x7e, 0x18, 0x6f, 0x69, 0x24, 0x1d, 0xc0, 0x29, 0xc0, 0x24, 0x29, 0xa6, 0x55,
+	0xad, 0x21, 0x11, 0x94, 0xee, 0x24, 0x1d, 0x7f, 0x1d, 0x29, 0xa6, 0x65, 0x11, 0xa6, 0x55, 0x56,
+	0x11, 0x98, 0xcd, 0x9a, 0xba, 0x2c, 0x29, 0x24, 0xc2, 0x29, 0xc0, 0x24, 0xc2, 0x29, 0x24, 0x18,
+	0x29, 0xa4, 0x76, 0x24, 0x29, 0x24, 0xfe, 0x73, 0x8e, 0xfe, 0xf7, 0x9e, 0xa3, 0x66, 0x66, 0x31,
+	0xc4, 0x2c, 0x31, 0x51, 0x2c, 0x31, 0xfe, 0xad, 0x55, 0xfe, 0x42, 0x28, 0x99, 0xcc, 0x29, 0x65,
+	0x24, 0x65, 0x05, 0x9d, 0xaa, 0x29, 0xfe, 0xa5, 0x13, 0xfe, 0xf7, 0xbe, 0x66, 0xa2, 0x76, 0x6b,
+	0xc0, 0x31, 0x9b, 0xbb, 0xfe, 0x7b, 0xef, 0x05, 0xab, 0x22, 0xa6, 0x65, 0x15, 0x95, 0xfc, 0x95,
+	0xee, 0xa6, 0x54, 0xaa, 0x43, 0xfe, 0x49, 0x83, 0x9e, 0x7b, 0xfe, 0x83, 0xce, 0xfe, 0xf7, 0x9d,
+	0x25, 0x6e, 0x6b, 0xd3, 0x18, 0xfe, 0x94, 0xb2, 0xfe, 0x29, 0x24, 0xa8, 0x34, 0xfe, 0xc6, 0x38,
+	0xac, 0x32, 0x6f, 0xc1, 0x31, 0xc0, 0x2c, 0x31, 0xda, 0x95, 0xfd, 0xfe, 0x5a, 0x26, 0x9d, 0xb8,
+	0xfe, 0xbc, 0x4c, 0x95, 0xce, 0x94, 0xdf, 0xfe, 0x9c, 0x4f, 0xfe, 0xff, 0xbe, 0x5b, 0x2c, 0x69,
+	0xc0, 0x31, 0xce, 0x56, 0x22, 0x6f, 0x1d, 0xfe, 0xb5, 0x34, 0xfe, 0x51, 0x63, 0xa6, 0x61, 0xfe,
+	0xbc, 0x49, 0x9c, 0x9b, 0xfe, 0x59, 0xc2, 0xa2, 0x5a, 0xfe, 0xd6, 0x79, 0xac, 0x11, 0x1d, 0x31,
+	0x59, 0x31, 0xcd, 0x2c, 0x31, 0xc0, 0x2c, 0xc0, 0x99, 0xcb, 0xfe, 0x62, 0xe9, 0xfe, 0x31, 0x00,
+	0xfe, 0x8b, 0x67, 0xa4, 0x76, 0xfe, 0x6a, 0x44, 0x96, 0xcf, 0xfe, 0x94, 0x0e, 0xfe, 0xe7, 0x1b,
+	0xa7, 0x35, 0xc0, 0x66, 0x2c, 0x31, 0xcd, 0x2c, 0x31, 0xc0, 0x99, 0xcb, 0x10, 0xfe, 0x42, 0x08,
+	0x9b, 0xaa, 0x61, 0xa3, 0x66, 0xc0, 0x29, 0x7a, 0x6f, 0x6e, 0xa8, 0x44, 0xaa, 0x33, 0xab, 0x33,
+	0xad, 0x11, 0xa7, 0x55, 0x6e, 0xd1, 0x25, 0xc4, 0x31, 0xfe, 0xbd, 0xb6, 0x19, 0xfe, 0x8c, 0x71,
+	0xfe, 0xf7, 0x9e, 0x6e, 0x31, 0xd8, 0x25, 0xfe, 0xad, 0x54, 0xfe, 0x39, 0xa6, 0x50, 0x66, 0xc0,
+	0xa2, 0x76, 0x7a, 0x69, 0x65, 0x7e, 0x79, 0xc0, 0x55, 0xc0, 0x7b, 0x17, 0x69, 0xa2, 0x76, 0x5a,
+	0x72, 0xa5, 0x74, 0x3b, 0xa7, 0x53, 0x41, 0xfe, 0x7a, 0x63, 0xfe, 0x41, 0x00, 0xa2, 0x49, 0xaa,
+	0x24, 0xfe, 0xc5, 0xf7, 0x2c, 0x66, 0x2c, 0x31, 0xfd, 0xf8, 0x2c, 0x92, 0xff, 0xfe, 0x4a, 0x48,
+	0x96, 0xde, 0xa2, 0x76, 0x6b, 0xc4, 0x6e, 0xc1, 0x7e, 0xa7, 0x55, 0x9c, 0x9a, 0x1d, 0x29, 0x1d,
+	0xc0, 0x31, 0x1d, 0x24, 0xa5, 0x65, 0xa9, 0x33, 0xa8, 0x44, 0xa2, 0x77, 0x52, 0x9a, 0xbb, 0x3c,
+	0x9a, 0xbb, 0x51, 0x24, 0xc6, 0x65, 0xc0, 0x24, 0x2c, 0x24, 0xc2, 0x00, 0xfe, 0xa4, 0xf3, 0xfe,
+	0xff, 0xff, 0x66, 0xc0, 0x31, 0xc6, 0x2c, 0x31, 0x99, 0xcc, 0xfe, 0x73, 0x8e, 0xfe, 0x29, 0x65,
+	0x24, 0x55, 0x24, 0xa2, 0x76, 0x24, 0x29, 0xc1, 0xfe, 0x9c, 0xd3, 0xfe, 0xf7, 0x9d, 0x2c, 0x6e,
+	0x51, 0x31, 0x9c, 0xab, 0xfe, 0x9c, 0xf4, 0xfe, 0x52, 0xaa, 0xa4, 0x65, 0x39, 0xa2, 0x86, 0x51,
+	0xfe, 0x52, 0x05, 0x60, 0xae, 0x21, 0x69, 0xfe, 0x41, 0x41, 0xa3, 0x5a, 0xfe, 0xad, 0x54, 0xfe,
+	0xff, 0xde, 0x55, 0x25, 0x31, 0xd3, 0x98, 0xcc, 0xfe, 0x63, 0x2c, 0xfe, 0x21, 0x03, 0x18, 0xfe,
+	0xf7, 0x7d, 0x25, 0xc0, 0x31, 0x61, 0x55, 0x20, 0x2c, 0x31, 0x2c, 0x31, 0xd8, 0x95, 0xed, 0xfe,
+	0x52, 0x06, 0x78, 0xfe, 0xac, 0x2c, 0xfe, 0x6a, 0x45, 0x42, 0xfe, 0xbd, 0x95, 0x2c, 0x45, 0x31,
+	0xc0, 0x2a, 0x31, 0xcd, 0x2c, 0x25, 0x2a, 0x31, 0x9b, 0xcb, 0xfe, 0x8b, 0xaf, 0xfe, 0x49, 0x01,
+	0xfe, 0x8a, 0xa4, 0xfe, 0xbc, 0x69, 0x96, 0xcf, 0xfe, 0x49, 0x62, 0xfe, 0x8b, 0xce, 0x07, 0x2a,
+	0x22, 0x2a, 0x5a, 0x31, 0xcf, 0x2c, 0xc1, 0xfe, 0xbd, 0xb5, 0xfe, 0x41, 0xc4, 0x64, 0xfe, 0x8b,
+	0xa9, 0x98, 0xdc, 0x20, 0xa8, 0x36, 0xfe, 0xde, 0x9a, 0xaa, 0x13, 0x59, 0x22, 0x31, 0x25, 0x31,
+	0xcc, 0x61, 0xc0, 0x31, 0x9a, 0xcb, 0xfe, 0xa5, 0x13, 0xfe, 0x42, 0x08, 0x99, 0xcb, 0xa2, 0x77,
+	0x56, 0x18, 0x6e, 0x00, 0x20, 0x35, 0xae, 0x11, 0xac, 0x22, 0xa7, 0x55, 0xa3, 0x66, 0x7a, 0x6f,
+	0x31, 0xd1, 0x2c, 0x25, 0xc1, 0x65, 0x51, 0x9c, 0xaa, 0x93, 0xef, 0xfe, 0x42, 0x07, 0xad, 0x12,
+	0xfe, 0xef, 0x5c, 0x31, 0xd9, 0x2c, 0x96, 0xcc, 0xfe, 0x62, 0xeb, 0x95, 0xde, 0x9b, 0xba, 0xa3,
+	0x86, 0xa6, 0x54, 0xa7, 0x53, 0xa3, 0x86, 0xa2, 0x76, 0x75, 0x64, 0x69, 0x7a, 0xc1, 0x76, 0x55,
+	0xa2, 0x76, 0x6e, 0x62, 0xa2, 0x87, 0xa4, 0x75, 0xa3, 0x66, 0x9c, 0x8a, 0xfe, 0x61, 0xe2, 0x9b,
+	0x8d, 0x5b, 0xfe, 0x7b, 0xae, 0xfe, 0xde, 0xdb, 0xa8, 0x44, 0x66, 0x2c, 0x31, 0xfd, 0xf9, 0x51,
+	0xfe, 0x9c, 0xf3, 0xfe, 0x41, 0xe7, 0x9c, 0x9a, 0x65, 0x29, 0xc0, 0x7a, 0x29, 0x66, 0x1d, 0x24,
+	0xc0, 0x65, 0xa3, 0x66, 0x9d, 0x9a, 0x18, 0x31, 0x1d, 0x15, 0x29, 0xc0, 0x1d, 0x15, 0x31, 0xa7,
+	0x55, 0x20, 0xa6, 0x55, 0xc0, 0x9c, 0xaa, 0x9d, 0x9a, 0x9d, 0xa9, 0x3c, 0x99, 0xbc, 0x2c, 0x24,
+	0x65, 0xc1, 0x24, 0xc0, 0x18, 0xc0, 0x24, 0x2c, 0xc1, 0x24, 0xa8, 0x44, 0xfe, 0xc5, 0xf7, 0xfe,
+	0xff, 0xff, 0x61, 0x6f, 0x31, 0xc0, 0x2c, 0xc0, 0x31, 0xc1, 0x2c, 0x31, 0x9d, 0xaa, 0xfe, 0x9c,
+	0xd3, 0xfe, 0x39, 0xc7, 0x1d, 0x15, 0xa4, 0x66, 0xa7, 0x55, 0x9c, 0xaa, 0x9b, 0xba, 0x24, 0x1d,
+	0x34, 0xfe, 0xbd, 0xf7, 0xaf, 0x11, 0xc0, 0x31, 0x2c, 0x9b, 0xaa, 0x3c, 0xfe, 0x5a, 0xcb, 0xa2,
+	0x76, 0xab, 0x33, 0x69, 0x9b, 0xba, 0x94, 0xfd, 0x9a, 0xbb, 0xaa, 0x42, 0xae, 0x20, 0xfe, 0x7a,
+	0xa5, 0xfe, 0x41, 0x21, 0xaa, 0x16, 0xfe, 0xd6, 0x79, 0x31, 0x9d, 0xa9, 0x31, 0xd3, 0x2c, 0x92,
+	0xff, 0xfe, 0x4a, 0x48, 0x00, 0xfe, 0x8c, 0x71, 0x35, 0x51, 0x9c, 0xaa, 0x9b, 0xbb, 0x9c, 0xaa,
+	0x6e, 0xa6, 0x65, 0x35, 0x2c, 0xc1, 0x31, 0xd7, 0x94, 0xed, 0xfe, 0x4a, 0x05, 0xa1, 0x97, 0xac,
+	0x31, 0xfe, 0x51, 0xa2, 0xaa, 0x15, 0xfe, 0xde, 0xda, 0xa7, 0x46, 0x26, 0x7e, 0x2a, 0x69, 0x31,
+	0xcd, 0x2c, 0x31, 0x2a, 0xc0, 0x96, 0xee, 0xfe, 0x62, 0x69, 0x17, 0xfe, 0xa3, 0x67, 0xa6, 0x53,
+	0xfe, 0x72, 0x84, 0x99, 0xaf, 0xfe, 0xbd, 0x95, 0xfe, 0xff, 0xde, 0x31, 0x69, 0x5a, 0x2a, 0xc0,
+	0x31, 0xc3, 0x2e, 0x31, 0xca, 0x9c, 0xaa, 0xfe, 0x8c, 0x2f, 0xfe, 0x31, 0x82, 0xa8, 0x63, 0xa7,
+	0x55, 0xfe, 0x59, 0xa3, 0xa1, 0x7a, 0xfe, 0xbd, 0x55, 0x24, 0x6e, 0x5d, 0x27, 0x7a, 0x25, 0x31,
+	0xcb, 0x2c, 0x65, 0x2c, 0x9b, 0xba, 0xfe, 0xa5, 0x13, 0x08, 0x94, 0xed, 0xa2, 0x78, 0x1d, 0x66,
+	0x00, 0xac, 0x22, 0xad, 0x11, 0xaa, 0x33, 0xa9, 0x34, 0x2c, 0x31, 0x51, 0xc0, 0x31, 0x2c, 0x31,
+	0xd1, 0x29, 0x31, 0xc0, 0x9b, 0xca, 0x95, 0xdd, 0x94, 0xfe, 0x97, 0xcc, 0x99, 0xbc, 0x97, 0xcd,
+	0xab, 0x22, 0xfe, 0xd6, 0xda, 0x31, 0x55, 0x31, 0xd8, 0x51, 0x96, 0xdd, 0xfe, 0x9c, 0xb2, 0x92,
+	0xff, 0x97, 0xdb, 0x9d, 0xb9, 0xa6, 0x64, 0xa6, 0x74, 0xa7, 0x53, 0xa3, 0x85, 0x79, 0x69, 0x7d,
+	0x65, 0x7b, 0xc0, 0x69, 0x6e, 0x5a, 0x20, 0x7f, 0x64, 0x16, 0x98, 0xae, 0xfe, 0x51, 0x80, 0x9f,
+	0x6c, 0xa2, 0x68, 0xfe, 0xa5, 0x13, 0xfe, 0xf7, 0x9d, 0xa2, 0x78, 0xc1, 0x31, 0xc0, 0x2a, 0x31,
+	0xfd, 0xf4, 0x2c, 0xc0, 0x31, 0x1d, 0xfe, 0x84, 0x0f, 0xfe, 0x39, 0xa6, 0x9d, 0x9a, 0x3d, 0x51,
+	0xc1, 0x24, 0x69, 0x24, 0xc0, 0x1d, 0xa2, 0x77, 0x24, 0x31, 0x29, 0x61, 0x31, 0x1d, 0x7f, 0xc0,
+	0x1d, 0xc0, 0x29, 0xa4, 0x66, 0xaa, 0x33, 0xaa, 0x33, 0x66, 0x55, 0x7a, 0x56, 0x51, 0x9d, 0xa9,
+	0x9c, 0x9a, 0x9b, 0xbb, 0x9c, 0xaa, 0x51, 0x29, 0x7a, 0x31, 0x24, 0x18, 0x1d, 0x24, 0xc0, 0x2c,
+	0xaa, 0x33, 0xfe, 0xce, 0x59, 0xac, 0x22, 0x9d, 0xa9, 0xa2, 0x67, 0x2c, 0xc0, 0x25, 0x66, 0x2c,
+	0x6e, 0xc0, 0x25, 0x2c, 0x97, 0xcc, 0xfe, 0x52, 0x8a, 0x92, 0xff, 0xa6, 0x54, 0x24, 0x10, 0x00,
+	0x08, 0x24, 0x55, 0x66, 0xfe, 0x6b, 0x2c, 0xfe, 0xde, 0xfb, 0x2c, 0x9d, 0x99, 0x2c, 0x9c, 0xaa,
+	0x30, 0xfe, 0x4a, 0x49, 0xac, 0x22, 0xa6, 0x55, 0x39, 0x75, 0x97, 0xdb, 0xfe, 0x41, 0x00, 0xab,
+	0x31, 0xad, 0x21, 0xa3, 0x67, 0xfe, 0x59, 0xa2, 0x42, 0xfe, 0x6b, 0x0b, 0xfe, 0xe6, 0xfb, 0xa7,
+	0x44, 0x52, 0xa3, 0x66, 0x25, 0x31, 0xd1, 0x66, 0xfe, 0xa5, 0x14, 0xfe, 0x31, 0x65, 0x55, 0x34,
+	0xa4, 0x65, 0x3d, 0xc0, 0x9d, 0xaa, 0xc0, 0xa2, 0x77, 0x2c, 0xab, 0x23, 0xfe, 0xb5, 0xb6, 0xb0,
+	0x00, 0x7f, 0xc0, 0x31, 0xd6, 0x92, 0xfe, 0xfe, 0x41, 0xe5, 0xa3, 0x86, 0xa7, 0x53, 0xfe, 0x39,
+	0x21, 0xfe, 0x83, 0xac, 0xfe, 0xef, 0x7c, 0xa1, 0x79, 0x2e, 0xc0, 0x65, 0x2a, 0x31, 0xcd, 0x2c,
+	0x31, 0x2a, 0x9d, 0x9a, 0xfe, 0xc5, 0xb5, 0xfe, 0x51, 0x85, 0xa3, 0x83, 0xfe, 0xbc, 0x09, 0x45,
+	0xfe, 0x62, 0x03, 0xa2, 0x5a, 0xfe, 0xde, 0x79, 0xab, 0x13, 0x31, 0x2a, 0x22, 0x31, 0x1d, 0x31,
+	0xcd, 0x22, 0x31, 0x2c, 0x98, 0xcc, 0xfe, 0x6b, 0x2a, 0x93, 0xfd, 0xad, 0x21, 0x76, 0x94, 0xef,
+	0xad, 0x03, 0xfe, 0xff, 0x9f, 0x5e, 0x6e, 0x2e, 0x27, 0x76, 0xc0, 0x31, 0xce, 0xfe, 0xc6, 0x18,
+	0xfe, 0x52, 0xaa, 0x93, 0xfe, 0xa4, 0x66, 0x66, 0xa4, 0x66, 0xac, 0x22, 0xfe, 0xbd, 0xd7, 0x18,
+	0xa3, 0x66, 0x25, 0x31, 0x66, 0xc0, 0x31, 0xc1, 0x2c, 0x31, 0xcf, 0x2c, 0xc0, 0x24, 0x9b, 0xba,
+	0x93, 0xfd, 0xfe, 0x73, 0x0a, 0x95, 0xec, 0x9d, 0xa9, 0x6f, 0x51, 0x6f, 0xa3, 0x58, 0xfe, 0xb5,
+	0xb5, 0xfe, 0xf7, 0xde, 0x7f, 0xd9, 0x22, 0x31, 0xc0, 0x9c, 0xba, 0xfe, 0x9c, 0x91, 0xfe, 0x51,
+	0xe6, 0x99, 0xda, 0xa2, 0x86, 0xa9, 0x42, 0xa9, 0x52, 0xa6, 0x63, 0x7d, 0x16, 0xa1, 0xa7, 0x65,
+	0x66, 0x69, 0x5e, 0x5b, 0x56, 0xa1, 0x89, 0x65, 0x4b, 0x95, 0xbf, 0xfe, 0x39, 0x00, 0xa2, 0x59,
+	0xa6, 0x46, 0xfe, 0xc6, 0x17, 0x31, 0x2c, 0x31, 0x2c, 0x31, 0xfd, 0xfa, 0x65, 0x21, 0xfe, 0x73,
+	0xae, 0xfe, 0x29, 0x65, 0x61, 0x29, 0x66, 0x29, 0xc1, 0x24, 0xc0, 0x69, 0xc0, 0x24, 0xc0, 0x29,
+	0x7a, 0xc0, 0x1d, 0xc4, 0x18, 0x38, 0x0d, 0xa9, 0x43, 0xa3, 0x77, 0x6f, 0xc0, 0x6e, 0x14, 0x19,
+	0xc0, 0x9d, 0xaa, 0x9c, 0xa9, 0x9a, 0xab, 0x9a, 0xcc, 0x38, 0x1d, 0xc0, 0x24, 0xc0, 0x29, 0x24,
+	0xa9, 0x33, 0xae, 0x11, 0x10, 0x51, 0xc0, 0x65, 0xa2, 0x67, 0x7e, 0x9c, 0xab, 0xa9, 0x43, 0xaf,
+	0x00, 0xa2, 0x78, 0xc0, 0x11, 0x30, 0xfe, 0x39, 0xa6, 0x29, 0xc0, 0xa7, 0x54, 0xad, 0x12, 0x9d,
+	0xaa, 0x20, 0x9c, 0xa9, 0x24, 0x7e, 0xae, 0x11, 0xfe, 0xef, 0x3c, 0xa4, 0x66, 0x38, 0x98, 0xcc,
+	0xfe, 0x83, 0xcf, 0x98, 0xdc, 0x2f, 0x19, 0x69, 0x9d, 0xba, 0x96, 0xfc, 0xfe, 0x51, 0x40, 0xa4,
+	0x84, 0xfe, 0xb3, 0x84, 0xa7, 0x46, 0x9e, 0x7a, 0xfe, 0x49, 0x20, 0xa2, 0x59, 0x19, 0xfe, 0xf7,
+	0x9e, 0xa3, 0x66, 0xd0, 0x51, 0x31, 0xc0, 0x66, 0x31, 0x18, 0xfe, 0x73, 0x8d, 0xfe, 0x29, 0x24,
+	0xa2, 0x77, 0xc1, 0x56, 0x18, 0x2c, 0x24, 0x18, 0xa3, 0x66, 0x18, 0x00, 0xfe, 0xb5, 0xb6, 0xfe,
+	0xff, 0xff, 0x66, 0x31, 0xc0, 0x2c, 0x31, 0xce, 0x2c, 0xc1, 0x1d, 0x2c, 0xfe, 0xa4, 0xf3, 0xfe,
+	0x31, 0x64, 0xa8, 0x43, 0x9a, 0xba, 0xa3, 0x77, 0xfe, 0xb5, 0x53, 0xfe, 0xff, 0x9d, 0x2c, 0x31,
+	0xcf, 0x65, 0x31, 0x62, 0x2c, 0x5a, 0x1d, 0xfe, 0x8b, 0xee, 0xfe, 0x49, 0x02, 0xfe, 0x8a, 0xa5,
+	0xfe, 0xc4, 0x49, 0x98, 0xac, 0xfe, 0x49, 0x61, 0xfe, 0x6b, 0x6d, 0x38, 0x2c, 0x6e, 0xd1, 0x59,
+	0x7a, 0x9d, 0x9a, 0x31, 0xfe, 0xce, 0x18, 0xfe, 0x5a, 0x47, 0x99, 0xca, 0xad, 0x12, 0x97, 0xcd,
+	0x5f, 0xfe, 0xbd, 0xd6, 0x31, 0xd2, 0x66, 0x31, 0x9c, 0xba, 0xfe, 0x7b, 0xcf, 0xfe, 0x31, 0x86,
+	0x9d, 0x99, 0xa5, 0x66, 0xfe, 0x9c, 0xd3, 0xac, 0x22, 0xa8, 0x43, 0x31, 0x25, 0x31, 0xc8, 0x66,
+	0xc0, 0x31, 0xc2, 0x2c, 0x29, 0x6e, 0xc3, 0x29, 0x65, 0x51, 0x9a, 0xcb, 0x98, 0xcb, 0xfe, 0x83,
+	0xef, 0x95, 0xec, 0x97, 0xdc, 0x9e, 0xb7, 0x1a, 0xa5, 0x75, 0xa5, 0x65, 0xa7, 0x45, 0x9c, 0x9b,
+	0xfe, 0x41, 0x62, 0xa8, 0x26, 0xfe, 0xbe, 0x18, 0x29, 0x31, 0x2c, 0xc1, 0x20, 0x2c, 0x31, 0xd2,
+	0x2a, 0xc0, 0x27, 0x31, 0x51, 0x97, 0xdd, 0xfe, 0x9c, 0x71, 0xfe, 0x5a, 0x27, 0x98, 0xda, 0xa6,
+	0x63, 0xaa, 0x41, 0xa9, 0x42, 0x70, 0x9e, 0xd8, 0xa2, 0x96, 0x70, 0xa2, 0x66, 0x9f, 0x69, 0xa2,
+	0x48, 0xa2, 0x68, 0x57, 0xa2, 0x77, 0x9a, 0xad, 0xfe, 0x72, 0x03, 0x9a, 0x8e, 0x9f, 0x6b, 0xfe,
+	0x73, 0x8e, 0xfe, 0xef, 0x5d, 0x2c, 0x31, 0x2c, 0x31, 0xfd, 0xfa, 0x25, 0x31, 0x1d, 0xfe, 0x9c,
+	0xf3, 0xfe, 0x42, 0x28, 0x99, 0xcb, 0xc0, 0x24, 0x6e, 0xc1, 0x24, 0xc7, 0x1d, 0xc4, 0x29, 0x24,
+	0x1d, 0xa5, 0x56, 0xa8, 0x44, 0xa7, 0x55, 0xa4, 0x66, 0xc0, 0x65, 0x5a, 0x7e, 0x6f, 0xc0, 0x55,
+	0x9d, 0xaa, 0x9b, 0xaa, 0x99, 0xcc, 0x9a, 0xbb, 0x29, 0x24, 0xa2, 0x76, 0x29, 0xc0, 0x31, 0x66,
+	0x24, 0xc1, 0x1d, 0x2c, 0xc0, 0xaa, 0x33, 0xfe, 0xc6, 0x17, 0xae, 0x11, 0x20, 0x96, 0xdd, 0xfe,
+	0x62, 0xeb, 0x2c, 0x51, 0xa5, 0x56, 0xad, 0x11, 0xa2, 0x77, 0x95, 0xee, 0xa2, 0x76, 0xa4, 0x67,
+	0x98, 0xcc, 0x9a, 0xbb, 0x10, 0xfe, 0xc5, 0xf7, 0x51, 0x08, 0x9b, 0xab, 0x61, 0xa4, 0x76, 0xa2,
+	0x57, 0x0d, 0x55, 0x97, 0xec, 0xfe, 0x49, 0x63, 0xa0, 0xb5, 0xfe, 0xab, 0x44, 0xa8, 0x52, 0xa1,
+	0x69, 0x98, 0xae, 0xfe, 0x49, 0x41, 0xa2, 0x59, 0xfe, 0xad, 0x75, 0xfe, 0xff, 0xdf, 0x6e, 0x2c,
+	0x31, 0xce, 0x51, 0x31, 0xc2, 0x96, 0xdd, 0x34, 0x98, 0xcb, 0x6f, 0x24, 0x7e, 0xc0, 0x51, 0xc0,
+	0x24, 0x18, 0x2c, 0x18, 0x2c, 0xfe, 0x73, 0x8e, 0xfe, 0xf7, 0x9e, 0x31, 0xc1, 0x66, 0x31, 0xcd,
+	0x2c, 0xc0, 0x31, 0xc1, 0x9d, 0xba, 0xfe, 0x7b, 0xae, 0xfe, 0x31, 0x64, 0xa8, 0x43, 0x97, 0xdc,
+	0xab, 0x23, 0xfe, 0xd6, 0x57, 0xab, 0x24, 0x2c, 0xc0, 0x31, 0xce, 0x50, 0x31, 0x2c, 0xc0, 0x31,
+	0x99, 0xcb, 0xfe, 0x6a, 0xe9, 0xfe, 0x51, 0x62, 0xfe, 0xa3, 0x68, 0xa6, 0x63, 0xfe, 0x7a, 0x42,
+	0x99, 0x8f, 0xfe, 0x94, 0x91, 0xfe, 0xef, 0x7d, 0xa3, 0x77, 0x31, 0xd1, 0x69, 0xc0, 0x52, 0x18,
+	0xfe, 0xa4, 0xf4, 0xfe, 0x49, 0xc5, 0xa3, 0x75, 0xa2, 0x78, 0x99, 0xac, 0xfe, 0x83, 0xef, 0xfe,
+	0xe7, 0x3c, 0x31, 0xd4, 0xfe, 0xc5, 0xf7, 0xfe, 0x4a, 0x28, 0x99, 0xbb, 0x6f, 0x3d, 0xfe, 0xc6,
+	0x17, 0x31, 0xc1, 0x2c, 0x31, 0xc6, 0x2c, 0x31, 0xc9, 0x56, 0x31, 0x9a, 0xcb, 0x9b, 0xa9, 0x99,
+	0xdc, 0x95, 0xed, 0x94, 0xed, 0x99, 0xcb, 0x9b, 0xca, 0xa3, 0x76, 0xa4, 0x65, 0xa5, 0x74, 0xa5,
+	0x74, 0xa5, 0x64, 0x7f, 0x7f, 0x9e, 0x7a, 0xfe, 0x7a, 0x64, 0x97, 0xae, 0xfe, 0x73, 0x4b, 0xfe,
+	0xd6, 0x58, 0x2c, 0xc2, 0x31, 0xd4, 0x2a, 0xc0, 0x56, 0x6b, 0x31, 0x52, 0x38, 0x3c, 0xfe, 0x83,
+	0x4b, 0x94, 0xfc, 0x9e, 0xa7, 0xaa, 0x32, 0xaa, 0x51, 0xa0, 0xc7, 0xa1, 0xa6, 0x60, 0x6e, 0x9d,
+	0x8a, 0x9e, 0x6b, 0xa0, 0x6a, 0x5a, 0x57, 0x9c, 0x9b, 0x97, 0xce, 0x9d, 0x7c, 0xa2, 0x59, 0xfe,
+	0xa5, 0x34, 0x2c, 0x31, 0xc0, 0x2c, 0xc1, 0x31, 0xfd, 0xfa, 0x51, 0xfe, 0x9c, 0xf3, 0xfe, 0x42,
+	0x27, 0x99, 0xcc, 0x7f, 0x56, 0x6e, 0xc1, 0x24, 0xc0, 0x2c, 0xc0, 0x29, 0x24, 0xc0, 0x1d, 0xc6,
+	0x29, 0xc1, 0x24, 0x38, 0xa8, 0x44, 0xaa, 0x32, 0xa4, 0x67, 0xc1, 0x69, 0xc0, 0x14, 0xc0, 0x0d,
+	0x56, 0x9d, 0xaa, 0x9a, 0xbb, 0x98, 0xcc, 0x24, 0x29, 0x24, 0x55, 0x7a, 0x29, 0x24, 0x1d, 0x7f,
+	0x18, 0x2c, 0xc1, 0xfe, 0x7b, 0xae, 0xfe, 0xf7, 0x7d, 0x6e, 0xfe, 0xa4, 0xf3, 0xfe, 0x39, 0xc6,
+	0x18, 0x2c, 0xae, 0x11, 0xa6, 0x45, 0x94, 0xfe, 0x08, 0xa9, 0x33, 0xa3, 0x76, 0x95, 0xde, 0x2c,
+	0xc0, 0x10, 0xa3, 0x66, 0xa3, 0x77, 0x00, 0x2f, 0x07, 0xa2, 0x66, 0x39, 0x98, 0xcb, 0xfe, 0x41,
+	0x83, 0xa0, 0xa7, 0xfe, 0x9b, 0x05, 0xa9, 0x52, 0x7c, 0x32, 0xfe, 0x82, 0xa3, 0xfe, 0x41, 0x20,
+	0xa8, 0x27, 0xfe, 0xce, 0x79, 0xac, 0x22, 0xc0, 0x66, 0x31, 0xce, 0x2c, 0x31, 0x2c, 0x31, 0x51,
+	0xfe, 0xad, 0x34, 0xfe, 0x31, 0x65, 0x56, 0x69, 0x24, 0x2c, 0x24, 0xa2, 0x76, 0x24, 0x2c, 0x51,
+	0x24, 0x6e, 0x24, 0x08, 0x09, 0xa4, 0x66, 0x66, 0x31, 0x2c, 0x31, 0xcf, 0x2c, 0xc1, 0x98, 0xdc,
+	0xfe, 0x4a, 0x28, 0x2d, 0xa7, 0x44, 0x95, 0xee, 0xfe, 0x73, 0x6b, 0xfe, 0xef, 0x1b, 0xa6, 0x46,
+	0x31, 0xd0, 0x65, 0x31, 0x2c, 0x5a, 0x31, 0x92, 0xfe, 0xfe, 0x52, 0x05, 0x9e, 0xc7, 0xfe, 0xb3,
+	0xe9, 0x65, 0xfe, 0x61, 0xa0, 0x11, 0xfe, 0xbd, 0xd7, 0xfe, 0xff, 0xde, 0x31, 0xd3, 0x59, 0x31,
+	0x99, 0xcc, 0xfe, 0x73, 0x8e, 0xfe, 0x39, 0x22, 0xad, 0x20, 0x9b, 0x9c, 0x52, 0xfe, 0xc5, 0xf6,
+	0x31, 0x29, 0x31, 0xd2, 0x25, 0xfe, 0x8c, 0x71, 0x24, 0xc0, 0x7e, 0x5a, 0xfe, 0x7b, 0xcf, 0xfe,
+	0xef, 0x5c, 0x31, 0x66, 0x31, 0xc0, 0x2c, 0x31, 0xca, 0x2c, 0x56, 0x2c, 0x31, 0xc0, 0x25, 0x61,
+	0x92, 0xfe, 0xfe, 0x94, 0x0d, 0x94, 0xfe, 0x9b, 0xa9, 0x9c, 0xb9, 0xc0, 0xa5, 0x75, 0xa7, 0x73,
+	0xa6, 0x54, 0xa2, 0x87, 0x7d, 0xa2, 0x86, 0x79, 0x65, 0x56, 0xa0, 0x7a, 0x3d, 0xfe, 0x69, 0xc1,
+	0x9c, 0x8b, 0xfe, 0x83, 0x6b, 0xfe, 0xd6, 0x79, 0xaa, 0x33, 0xa2, 0x67, 0x9d, 0x9a, 0x6e, 0xa2,
+	0x77, 0xc1, 0x31, 0xd2, 0x56, 0x24, 0x29, 0xc0, 0x76, 0x20, 0x98, 0xeb, 0xfe, 0xac, 0x8f, 0xfe,
+	0x62, 0x24, 0x9a, 0xca, 0xa6, 0x73, 0x14, 0xa2, 0x95, 0x13, 0xc0, 0x9b, 0x9b, 0xfe, 0x8a, 0x00,
+	0x9c, 0x8c, 0x4a, 0x6f, 0x56, 0x9d, 0x9b, 0xa2, 0x48, 0xa7, 0x46, 0xfe, 0xd6, 0x9a, 0x31, 0x2c,
+	0x31, 0x2c, 0xc0, 0x31, 0xfd, 0xfb, 0x9b, 0xaa, 0xfe, 0x7b, 0xef, 0xfe, 0x31, 0x85, 0x9d, 0x9a,
+	0xa3, 0x77, 0x51, 0x6e, 0xc1, 0x24, 0xc0, 0x7e, 0xc1, 0x24, 0xc0, 0x69, 0xc6, 0x29, 0xc0, 0x1d,
+	0xc1, 0x2c, 0xa3, 0x67, 0xae, 0x11, 0xa3, 0x76, 0xa3, 0x67, 0x19, 0x61, 0x00, 0x6e, 0x6e, 0x7a,
+	0xa2, 0x78, 0x19, 0x97, 0xdd, 0x97, 0xcc, 0x15, 0x2c, 0xc0, 0x24, 0x1d, 0x24, 0x31, 0x2c, 0x9d,
+	0xaa, 0x6e, 0x7f, 0x18, 0xa6, 0x55, 0xfe, 0xbd, 0xb6, 0x1f, 0xfe, 0x6b, 0x0c, 0x24, 0xc0, 0xa9,
+	0x43, 0x34, 0x9a, 0xab, 0x97, 0xdd, 0xad, 0x11, 0x0d, 0x05, 0x93, 0xfe, 0x38, 0x0c, 0xa9, 0x43,
+	0xa7, 0x45, 0x08, 0x9b, 0xab, 0x99, 0xcb, 0xa4, 0x66, 0xa7, 0x44, 0x99, 0xbb, 0x1e, 0x9f, 0xb7,
+	0xfe, 0x93, 0x27, 0xaa, 0x60, 0x78, 0x9b, 0xba, 0xa4, 0x47, 0xfe, 0x72, 0x41, 0xfe, 0x39, 0x00,
+	0xfe, 0x62, 0xc9, 0xfe, 0xe6, 0xfb, 0xa8, 0x34, 0xc0, 0x66, 0x31, 0xd0, 0x2c, 0xc0, 0x9c, 0xaa,
+	0xfe, 0x7b, 0xcf, 0xfe, 0x29, 0x45, 0x29, 0x61, 0x29, 0xc0, 0x18, 0xa3, 0x67, 0x18, 0x24, 0x69,
+	0x29, 0xc0, 0x24, 0xfe, 0x6b, 0x6d, 0xfe, 0xf7, 0x9e, 0xa2, 0x77, 0x55, 0x31, 0xd1, 0x2c, 0x56,
+	0x31, 0xfe, 0xbd, 0x75, 0xfe, 0x31, 0x44, 0xa3, 0x76, 0xa3, 0x66, 0x97, 0xcc, 0xfe, 0x94, 0x70,
+	0xfe, 0xff, 0x9d, 0x31, 0xd2, 0x2c, 0x1d, 0x7e, 0xc0, 0xfe, 0xa4, 0xd1, 0xfe, 0x41, 0x62, 0xa8,
+	0x61, 0xae, 0x20, 0x99, 0xcc, 0xfe, 0x51, 0x40, 0xfe, 0x72, 0xe9, 0xfe, 0xde, 0xfb, 0xa8, 0x44,
+	0xd3, 0x5a, 0xc0, 0x31, 0x94, 0xee, 0xfe, 0x52, 0x69, 0x98, 0xea, 0xac, 0x21, 0x98, 0xbd, 0xaa,
+	0x34, 0xfe, 0xe6, 0xfb, 0x31, 0x2c, 0x31, 0xd2, 0x18, 0xfe, 0x6b, 0x4d, 0xfe, 0x29, 0x45, 0x7e,
+	0x24, 0x65, 0xa7, 0x45, 0xfe, 0xce, 0x58, 0x31, 0x61, 0x31, 0xc0, 0x66, 0x31, 0xc4, 0x51, 0x2c,
+	0x31, 0xc0, 0x2c, 0x1d, 0x2c, 0x31, 0xc0, 0x9c, 0xba, 0x97, 0xdc, 0x93, 0xfe, 0x97, 0xdb, 0xfe,
+	0x41, 0x41, 0x61, 0x10, 0xa4, 0x74, 0xa5, 0x65, 0xa7, 0x54, 0xa5, 0x74, 0xa3, 0x85, 0x7e, 0x51,
+	0x79, 0x79, 0x65, 0xc0, 0x7f, 0x5b, 0xa2, 0x59, 0x99, 0xad, 0x23, 0x9d, 0x7b, 0xfe, 0x7b, 0x8c,
+	0xfe, 0xd6, 0x78, 0x2a, 0x31, 0x56, 0x51, 0x2e, 0xc2, 0x31, 0x2a, 0x31, 0xcc, 0x66, 0x31, 0xc2,
+	0x29, 0x61, 0x31, 0x2a, 0x9a, 0xdb, 0xfe, 0xb4, 0xf1, 0xfe, 0x62, 0x45, 0x00, 0xfe, 0x82, 0x82,
+	0xa9, 0x62, 0x2d, 0x7a, 0x9c, 0xac, 0xfe, 0x92, 0x62, 0xfe, 0x59, 0x20, 0x9e, 0x7a, 0xa3, 0x57,
+	0x5a, 0x45, 0xa3, 0x67, 0xaf, 0x02, 0xfe, 0xef, 0x7d, 0x31, 0x2c, 0x31, 0xfd, 0xfd, 0xc0, 0x92,
+	0xff, 0xfe, 0x5a, 0xeb, 0x94, 0xee, 0x51, 0x7e, 0x24, 0x29, 0xc1, 0x24, 0xc1, 0x29, 0x24, 0xc9,
+	0x29, 0x24, 0x1d, 0x29, 0x24, 0x65, 0x15, 0xa4, 0x76, 0xa7, 0x45, 0xa8, 0x44, 0xa5, 0x65, 0x6e,
+	0x56, 0x0d, 0x6f, 0x05, 0x7f, 0x19, 0x05, 0x9c, 0xaa, 0xfe, 0x39, 0xc7, 0x29, 0x15, 0x24, 0xa2,
+	0x76, 0x24, 0x65, 0xc0, 0x27, 0x6e, 0x18, 0xc1, 0xad, 0x22, 0xfe, 0xa4, 0xf3, 0x00, 0x18, 0xa8,
+	0x45, 0x07, 0x6e, 0x9d, 0x99, 0xa4, 0x67, 0x14, 0x08, 0x55, 0x92, 0xff, 0x38, 0xa3, 0x76, 0xa7,
+	0x45, 0x7e, 0x9c, 0xaa, 0x1c, 0x0c, 0xa3, 0x66, 0x99, 0xbb, 0x97, 0xdc, 0x9d, 0xa9, 0xa2, 0xa5,
+	0xfe, 0xa3, 0x67, 0xa7, 0x71, 0xa1, 0x96, 0x50, 0x9f, 0x6b, 0xfe, 0x6a, 0x01, 0x9a, 0x9e, 0xfe,
+	0x7b, 0xad, 0x09, 0xa3, 0x77, 0x6e, 0x2c, 0x31, 0xd0, 0x2c, 0xc0, 0x9b, 0xaa, 0x21, 0x94, 0xfe,
+	0x5a, 0x65, 0x29, 0xc0, 0x61, 0x29, 0x9d, 0xaa, 0x18, 0x6f, 0xc0, 0x10, 0x38, 0xfe, 0xa5, 0x14,
+	0xfe, 0xf7, 0xbe, 0x7f, 0xc0, 0x31, 0xd0, 0x2c, 0xc0, 0x31, 0x62, 0xfe, 0x83, 0xae, 0xfe, 0x39,
+	0x64, 0xa4, 0x66, 0x40, 0x52, 0xfe, 0xce, 0x17, 0x2a, 0x31, 0xd1, 0x2c, 0x56, 0x2a, 0xc0, 0x99,
+	0xcb, 0xfe, 0x6a, 0xc9, 0x95, 0xeb, 0xfe, 0x8b, 0x46, 0xa8, 0x64, 0x93, 0xef, 0xfe, 0x49, 0x21,
+	0xfe, 0x94, 0x0e, 0x09, 0x31, 0xd3, 0x56, 0x2e, 0x31, 0xfe, 0xad, 0x33, 0xfe, 0x41, 0xc6, 0xa6,
+	0x63, 0x69, 0x98, 0xce, 0xfe, 0x9c, 0x70, 0xfe, 0xf7, 0x7d, 0xa3, 0x66, 0x31, 0xd3, 0x9b, 0xbb,
+	0xfe, 0x52, 0x8a, 0x96, 0xdc, 0x6b, 0x1d, 0x24, 0x15, 0xfe, 0x8c, 0x30, 0xfe, 0xef, 0x5c, 0x2c,
+	0x31, 0xc7, 0x2c, 0xc0, 0x31, 0xc1, 0x25, 0x9d, 0x9b, 0x9a, 0xbb, 0x95, 0xed, 0x93, 0xfe, 0x95,
+	0xfc, 0x99, 0xca, 0x9d, 0xb9, 0xa4, 0x74, 0xa6, 0x64, 0xa7, 0x63, 0xa5, 0x64, 0xa2, 0x87, 0xa2,
+	0x76, 0x79, 0x75, 0x69, 0x65, 0x7e, 0x7a, 0x65, 0xc0, 0xa2, 0x78, 0x42, 0x15, 0xa1, 0x6a, 0x98,
+	0xbd, 0xfe, 0x71, 0xe1, 0x9c, 0x7d, 0xab, 0x23, 0xfe, 0xb5, 0x12, 0xfe, 0xef, 0x3b, 0x25, 0x29,
+	0x2e, 0xc2, 0x7a, 0x2a, 0x31, 0xcc, 0x66, 0xc1, 0x31, 0xc2, 0x52, 0x79, 0x31, 0x9c, 0xc9, 0xfe,
+	0xb5, 0x33, 0x39, 0x96, 0xeb, 0xab, 0x60, 0xab, 0x50, 0xa2, 0x97, 0x56, 0x9b, 0x9c, 0xfe, 0x72,
+	0x03, 0x99, 0x9d, 0xa2, 0x58, 0x5a, 0x56, 0xa5, 0x55, 0xfe, 0xa5, 0x12, 0xfe, 0xff, 0xff, 0xfd,
+	0xfd, 0xc2, 0x55, 0xfe, 0xad, 0x54, 0xfe, 0x39, 0xe7, 0x9b, 0xba, 0x6f, 0x61, 0x6f, 0x29, 0xc1,
+	0x24, 0xc0, 0x1d, 0xc0, 0x24, 0xc0, 0x29, 0x7a, 0xc0, 0x24, 0xc7, 0x29, 0x24, 0xc0, 0x29, 0xc0,
+	0x7f, 0x11, 0xa3, 0x76, 0xa3, 0x77, 0xa3, 0x67, 0x65, 0xa2, 0x67, 0xa6, 0x55, 0xa3, 0x77, 0xc0,
+	0x69, 0x14, 0x9a, 0xbb, 0x96, 0xcc, 0x29, 0xc1, 0x66, 0xc0, 0x7a, 0xc1, 0x55, 0x27, 0x7f, 0x41,
+	0xaa, 0x32, 0x18, 0xa4, 0x66, 0xae, 0x12, 0xa2, 0x76, 0x56, 0x31, 0xa4, 0x66, 0x14, 0x05, 0x30,
+	0x00, 0x24, 0xa5, 0x65, 0xa7, 0x45, 0x7e, 0x30, 0xa8, 0x54, 0x40, 0x98, 0xbc, 0x97, 0xdc, 0x9c,
+	0xb9, 0xa3, 0x75, 0xa1, 0xb6, 0xfe, 0xab, 0x86, 0xa5, 0x93, 0x7d, 0xc0, 0x9c, 0x8c, 0xfe, 0x61,
+	0xc0, 0x9d, 0x7d, 0xfe, 0x9c, 0xb1, 0xfe, 0xf7, 0xbe, 0x7f, 0x6e, 0x2c, 0x31, 0xce, 0x2c, 0x31,
+	0x2c, 0xc0, 0x9b, 0xaa, 0xfe, 0x52, 0xaa, 0x95, 0xed, 0x7f, 0x56, 0xc0, 0x38, 0x55, 0x2c, 0x24,
+	0xc0, 0x29, 0x1d, 0xc0, 0xad, 0x22, 0xfe, 0xde, 0xda, 0xa8, 0x45, 0xc1, 0x31, 0xd0, 0x56, 0x31,
+	0x51, 0x97, 0xdd, 0xfe, 0x52, 0x27, 0x28, 0xa3, 0x66, 0x51, 0xa9, 0x34, 0xfe, 0xf7, 0x7c, 0xa3,
+	0x67, 0xc0, 0x31, 0xd0, 0x2c, 0x56, 0xa2, 0x75, 0x65, 0xfe, 0xc5, 0xd5, 0xfe, 0x39, 0x42, 0xa4,
+	0x84, 0xfe, 0xac, 0x07, 0x67, 0xfe, 0x69, 0xe2, 0x9d, 0x8d, 0xfe, 0xb5, 0x34, 0x2c, 0xc0, 0x31,
+	0xd1, 0x2e, 0xc0, 0x31, 0x25, 0xfe, 0x83, 0xce, 0x2d, 0xaa, 0x42, 0x98, 0xcb, 0x57, 0xfe, 0xbd,
+	0x74, 0xfe, 0xf7, 0x9e, 0x2c, 0x31, 0xd3, 0x9a, 0xbb, 0xfe, 0x4a, 0x48, 0x98, 0xcd, 0xc0, 0xa2,
+	0x76, 0x24, 0x6e, 0xa9, 0x44, 0xfe, 0xce, 0x79, 0x2c, 0x6e, 0xca, 0x18, 0x98, 0xcb, 0x94, 0xef,
+	0x97, 0xcd, 0x98, 0xcc, 0x98, 0xdc, 0x9a, 0xca, 0xa2, 0x85, 0xa7, 0x63, 0xa7, 0x63, 0xa5, 0x73,
+	0xa1, 0x96, 0xa1, 0x96, 0x7e, 0x79, 0x79, 0x6e, 0x65, 0x56, 0x0a, 0xc0, 0x65, 0xc0, 0x7e, 0x52,
+	0x6f, 0x5b, 0xa0, 0x7a, 0x5b, 0x9c, 0x8b, 0x96, 0xbf, 0x99, 0xbd, 0xa3, 0x68, 0xfe, 0x83, 0x6a,
+	0xfe, 0xbd, 0x73, 0xae, 0x02, 0x2c, 0x2e, 0xc0, 0x7a, 0xcf, 0x62, 0xc0, 0x2c, 0xc1, 0x31, 0xc0,
+	0x56, 0xc0, 0x2c, 0xc0, 0x04, 0xfe, 0xb5, 0x74, 0xfe, 0x41, 0xc3, 0xa0, 0xb6, 0xab, 0x60, 0xa7,
+	0x73, 0x7f, 0x46, 0x97, 0x9f, 0xfe, 0x49, 0x62, 0x9f, 0x6a, 0x5f, 0x6f, 0xa7, 0x54, 0xfe, 0xd6,
+	0xb9, 0x31, 0xfd, 0xfd, 0xc2, 0x65, 0xfe, 0x7c, 0x0f, 0xfe, 0x31, 0x85, 0x9d, 0x9a, 0xa2, 0x87,
+	0x56, 0x6e, 0xc2, 0x24, 0xc5, 0x29, 0xc0, 0x24, 0xca, 0x29, 0x24, 0xc2, 0x29, 0x2c, 0x29, 0x2d,
+	0xaf, 0x01, 0x7e, 0x6f, 0x66, 0xc1, 0x9b, 0xaa, 0x96, 0xdd, 0x24, 0x69, 0x29, 0x24, 0x7a, 0xc2,
+	0x55, 0x24, 0x2c, 0x27, 0xa2, 0x67, 0xab, 0x32, 0xa8, 0x44, 0x66, 0xa2, 0x67, 0x0d, 0x14, 0x0d,
+	0x98, 0xcd, 0x96, 0xdd, 0x31, 0x39, 0xa8, 0x54, 0x14, 0x65, 0x00, 0x9c, 0xaa, 0x2d, 0x31, 0x22,
+	0x65, 0x9f, 0xb7, 0xa4, 0x83, 0xfe, 0xb3, 0xa5, 0xa5, 0x93, 0x65, 0xc0, 0x9b, 0x8e, 0xfe, 0x61,
+	0xa0, 0x9f, 0x5c, 0xfe, 0xb5, 0x74, 0xfe, 0xff, 0xdf, 0x6e, 0xd2, 0x2c, 0x31, 0x2c, 0x9a, 0xbb,
+	0xfe, 0x52, 0xaa, 0x95, 0xee, 0x6e, 0x24, 0x65, 0x1d, 0x24, 0x29, 0x7a, 0x6e, 0x18, 0x1d, 0xae,
+	0x11, 0xfe, 0xc6, 0x18, 0xad, 0x11, 0xa2, 0x77, 0xd0, 0x5a, 0x31, 0xc0, 0x1d, 0x7f, 0x35, 0xfe,
+	0x94, 0x71, 0xfe, 0x31, 0x23, 0x7e, 0xa2, 0x67, 0x7f, 0xfe, 0xa4, 0xd2, 0xfe, 0xff, 0xde, 0x52,
+	0x31, 0xd2, 0x52, 0x1e, 0x51, 0xfe, 0x8c, 0x0e, 0xfe, 0x39, 0x00, 0xac, 0x30, 0xfe, 0xb4, 0x48,
+	0x9b, 0xac, 0xfe, 0x49, 0x20, 0xaa, 0x16, 0xfe, 0xde, 0x99, 0x31, 0xd3, 0x56, 0xc0, 0x31, 0x01,
+	0xfe, 0x5a, 0x88, 0x9a, 0xca, 0xa8, 0x44, 0x09, 0xab, 0x24, 0xfe, 0xd6, 0x78, 0x1d, 0x31, 0x29,
+	0x31, 0xd2, 0x30, 0xfe, 0x52, 0x89, 0x94, 0xee, 0xa3, 0x67, 0xa2, 0x77, 0x9d, 0xaa, 0xa2, 0x76,
+	0x3d, 0xfe, 0x9c, 0xf3, 0x18, 0x25, 0x1d, 0xa2, 0x77, 0xc2, 0x2c, 0x31, 0xc0, 0x1d, 0x9a, 0xbb,
+	0x96, 0xdd, 0x05, 0x95, 0xdd, 0x98, 0xdc, 0x24, 0xa3, 0x67, 0xa3, 0x76, 0x9c, 0xb9, 0x74, 0xa9,
+	0x52, 0xac, 0x30, 0xa3, 0x95, 0x9e, 0xa7, 0xa0, 0xa6, 0x15, 0x11, 0x3e, 0xc0, 0xa2, 0x67, 0x6b,
+	0xc1, 0x02, 0x7e, 0x7a, 0x51, 0x6f, 0x11, 0x15, 0xa1, 0x79, 0x5b, 0x9d, 0x8b, 0x98, 0xbd, 0x97,
+	0xbd, 0x9b, 0xad, 0xa7, 0x25, 0xad, 0x03, 0xfe, 0xbd, 0xb5, 0xab, 0x23, 0x31, 0x66, 0x18, 0x2c,
+	0xc0, 0x31, 0xcb, 0x2c, 0xc0, 0x31, 0xc3, 0x2e, 0x31, 0x56, 0xc0, 0x2c, 0x9d, 0x99, 0xfe, 0x83,
+	0xef, 0xfe, 0x49, 0x62, 0xa3, 0x94, 0xfe, 0xc3, 0xe6, 0xa3, 0x85, 0x56, 0x9e, 0x6b, 0xfe, 0x59,
+	0xe1, 0x99, 0x9f, 0xa5, 0x47, 0x9d, 0x9a, 0xfe, 0x7b, 0xae, 0xfe, 0xef, 0x3c, 0x31, 0xfd, 0xfd,
+	0xc2, 0x9d, 0xa9, 0xfe, 0x63, 0x4c, 0xfe, 0x29, 0x65, 0x51, 0xa2, 0x87, 0x55, 0x29, 0xc1, 0x66,
+	0xdc, 0xa9, 0x33, 0xb0, 0x00, 0x51, 0x19, 0xc0, 0x66, 0x69, 0x19, 0x99, 0xcc, 0x96, 0xdc, 0x29,
+	0x15, 0x7a, 0x24, 0xc1, 0x18, 0xc2, 0x24, 0xa8, 0x54, 0x2f, 0xa3, 0x66, 0x56, 0x08, 0x14, 0x19,
+	0x0c, 0x9b, 0xab, 0x9a, 0xbb, 0x9c, 0xa9, 0x20, 0xa7, 0x54, 0xa2, 0x77, 0x24, 0x9d, 0x9a, 0x9b,
+	0xba, 0x29, 0x69, 0xc0, 0x79, 0x70, 0xa4, 0x93, 0xfe, 0xbb, 0x84, 0xa5, 0x83, 0x65, 0x6b, 0x9b,
+	0x7d, 0xfe, 0x59, 0xa0, 0xa1, 0x5b, 0xfe, 0xbd, 0xf6, 0xaf, 0x12, 0x6e, 0xd2, 0x2c, 0x31, 0x2c,
+	0x9b, 0xaa, 0xfe, 0x7b, 0xcf, 0xfe, 0x29, 0x45, 0x55, 0x29, 0xa2, 0x87, 0x56, 0x69, 0xc0, 0x18,
+	0x56, 0xa6, 0x54, 0xae, 0x11, 0xfe, 0xc6, 0x17, 0xae, 0x12, 0x6e, 0xd1, 0x2e, 0x31, 0xc0, 0x61,
+	0x31, 0x94, 0xfe, 0xfe, 0x5a, 0x89, 0x95, 0xec, 0x3d, 0x42, 0xa5, 0x66, 0xfe, 0xd6, 0x58, 0x31,
+	0x51, 0x31, 0xd2, 0x52, 0xa2, 0x75, 0x99, 0xcb, 0xfe, 0x6a, 0xc8, 0xfe, 0x49, 0x41, 0xfe, 0x8b,
+	0x26, 0xaa, 0x41, 0x95, 0xcf, 0xfe, 0x38, 0xe0, 0xfe, 0x8b, 0xad, 0xfe, 0xf7, 0x7d, 0x2c, 0x31,
+	0xd2, 0x56, 0xc0, 0x2c, 0xfe, 0xad, 0x12, 0xfe, 0x41, 0xa4, 0xa3, 0x85, 0xa6, 0x45, 0xfe, 0x31,
+	0x01, 0xfe, 0x73, 0x4b, 0x22, 0xa6, 0x56, 0x31, 0x1d, 0x31, 0xd2, 0x9a, 0xcb, 0xfe, 0x6b, 0x4c,
+	0x18, 0xa2, 0x67, 0x7a, 0x10, 0xa2, 0x77, 0xc0, 0xfe, 0x7b, 0xce, 0xfe, 0xe7, 0x1b, 0x31, 0x9d,
+	0xaa, 0x1d, 0x7e, 0x31, 0xc0, 0x25, 0x9b, 0xab, 0x19, 0xfe, 0x7b, 0xef, 0x3d, 0x98, 0xcc, 0x99,
+	0xbc, 0x10, 0xa4, 0x65, 0xa7, 0x46, 0xaf, 0x01, 0xa9, 0x53, 0x96, 0xdc, 0xfe, 0x49, 0xa4, 0x60,
+	0xac, 0x40, 0xab, 0x40, 0xa0, 0xa7, 0x9f, 0xa6, 0x09, 0x79, 0x79, 0x56, 0xa2, 0x67, 0xc0, 0x02,
+	0x6f, 0x09, 0xa2, 0x77, 0xc0, 0x65, 0x66, 0xc0, 0x5f, 0xc0, 0x19, 0x6b, 0x57, 0x9b, 0x9b, 0x97,
+	0xae, 0x9a, 0xad, 0x9e, 0x7b, 0xa5, 0x46, 0xa8, 0x45, 0xad, 0x13, 0xad, 0x11, 0xab, 0x33, 0xa3,
+	0x56, 0x1b, 0xa2, 0x67, 0x31, 0xca, 0x2c, 0xc0, 0x31, 0xc0, 0x2a, 0xc0, 0x31, 0xc0, 0x2e, 0xc2,
+	0x66, 0x96, 0xee, 0xfe, 0x72, 0xea, 0x24, 0xfe, 0xab, 0x44, 0xa8, 0x61, 0x65, 0xa2, 0x49, 0xfe,
+	0x7a, 0xa2, 0xfe, 0x31, 0x20, 0xa2, 0x6a, 0x57, 0xfe, 0x9c, 0xb2, 0x1b, 0x31, 0xfd, 0xfd, 0xc2,
+	0x9b, 0xba, 0xfe, 0x5a, 0xca, 0x93, 0xef, 0xa2, 0x77, 0x7e, 0x9d, 0xaa, 0x29, 0xc1, 0x24, 0xdc,
+	0xab, 0x22, 0xaf, 0x11, 0x9c, 0xaa, 0xa3, 0x66, 0x65, 0x6b, 0x55, 0x14, 0x19, 0x9a, 0xbb, 0x95,
+	0xdd, 0x31, 0x29, 0x24, 0x29, 0x7a, 0x6f, 0x7e, 0x6b, 0x38, 0xa4, 0x66, 0xac, 0x22, 0x19, 0x14,
+	0xc0, 0x08, 0x0d, 0x51, 0x96, 0xdd, 0xa2, 0x77, 0x20, 0x9b, 0xaa, 0x61, 0x2c, 0x38, 0x2c, 0x24,
+	0x18, 0x6e, 0x6e, 0xc0, 0x76, 0x9f, 0xa6, 0xa4, 0x93, 0xfe, 0xbb, 0x84, 0xa5, 0x83, 0x0c, 0x5b,
+	0x99, 0x9f, 0xfe, 0x59, 0x61, 0xa5, 0x17, 0xfe, 0xce, 0x58, 0xac, 0x23, 0x6e, 0xd0, 0x2c, 0x31,
+	0x2c, 0x31, 0x2c, 0x55, 0x93, 0xff, 0xfe, 0x4a, 0x69, 0x24, 0x9d, 0x99, 0xa2, 0x77, 0x65, 0x6b,
+	0x01, 0x24, 0xaa, 0x32, 0xb0, 0x00, 0xfe, 0xde, 0xdb, 0x31, 0x1d, 0x31, 0xd3, 0x9d, 0xaa, 0xa2,
+	0x76, 0x9d, 0xa9, 0xfe, 0xa4, 0xb1, 0xfe, 0x31, 0x22, 0xa8, 0x43, 0xa3, 0x77, 0x98, 0xcd, 0xae,
+	0x02, 0xfe, 0xf7, 0x5d, 0x31, 0x66, 0x31, 0xd2, 0x2c, 0x6d, 0xfe, 0xcd, 0xf5, 0xfe, 0x51, 0xc4,
+	0x9e, 0xb7, 0xfe, 0xa3, 0xa8, 0xa5, 0x54, 0xfe, 0x62, 0x02, 0x9c, 0x9c, 0xfe, 0xb5, 0x54, 0x2c,
+	0x56, 0x31, 0xd2, 0x56, 0x2c, 0x99, 0xcb, 0xfe, 0x83, 0x8c, 0xfe, 0x39, 0x21, 0xab, 0x31, 0xa1,
+	0x89, 0x94, 0xce, 0xfe, 0x8b, 0xed, 0xfe, 0xf7, 0x7c, 0x2c, 0x31, 0x5a, 0x31, 0xd2, 0x1d, 0x21,
+	0xfe, 0x39, 0xc7, 0x15, 0x7e, 0x6f, 0x61, 0x56, 0xa9, 0x43, 0xfe, 0xad, 0x75, 0x31, 0xc0, 0x2c,
+	0xc0, 0x9c, 0x99, 0x2d, 0x96, 0xde, 0x95, 0xdd, 0x0c, 0x50, 0x15, 0x51, 0xa4, 0x66, 0xab, 0x33,
+	0x14, 0xac, 0x12, 0xae, 0x21, 0xa3, 0x66, 0x9a, 0xcb, 0xfe, 0x94, 0x4f, 0xfe, 0x5a, 0x05, 0x9a,
+	0xca, 0xfe, 0x93, 0x06, 0xa6, 0x73, 0xa3, 0x85, 0x78, 0xa0, 0xa7, 0x78, 0x51, 0x7e, 0x0a, 0x6f,
+	0xa1, 0x79, 0x52, 0xc0, 0x6e, 0x1c, 0x69, 0xc0, 0x1c, 0xc0, 0x19, 0x6b, 0xa3, 0x57, 0xa2, 0x69,
+	0x9e, 0x7a, 0x99, 0xbd, 0x99, 0xad, 0x99, 0xad, 0x9a, 0xac, 0x6b, 0xab, 0x23, 0xfe, 0xad, 0x14,
+	0xfe, 0xf7, 0x3c, 0x2c, 0xc0, 0x31, 0xca, 0x2c, 0xc0, 0x31, 0x2a, 0xc1, 0x31, 0xc1, 0x2e, 0xc2,
+	0x9c, 0xcc, 0xfe, 0xa4, 0x91, 0xfe, 0x51, 0x82, 0xa4, 0x92, 0xfe, 0xd4, 0x25, 0xa2, 0x85, 0x4b,
+	0x9a, 0x9e, 0xfe, 0x51, 0xc1, 0x9b, 0x9e, 0xa4, 0x58, 0x13, 0xfe, 0xff, 0xbf, 0x31, 0xfd, 0xfd,
+	0xc2, 0x35, 0xfe, 0x5a, 0xca, 0x93, 0xef, 0xa2, 0x77, 0x7e, 0x15, 0x29, 0xc1, 0x66, 0xdc, 0xab,
+	0x22, 0xaf, 0x11, 0x9c, 0xaa, 0xa3, 0x66, 0x65, 0x6b, 0xa2, 0x76, 0x14, 0x19, 0xc0, 0x9b, 0xaa,
+	0x9c, 0xaa, 0x66, 0xc0, 0x7f, 0x6e, 0xc0, 0x7f, 0xc0, 0x65, 0x18, 0x14, 0x19, 0x51, 0x14, 0xc0,
+	0x05, 0x99, 0xcb, 0x18, 0x35, 0x94, 0xee, 0x29, 0x61, 0xc0, 0x24, 0xc0, 0x69, 0x24, 0x7e, 0x59,
+	0xc0, 0x76, 0x74, 0xa4, 0x92, 0xfe, 0xbb, 0x84, 0xa5, 0x83, 0x7a, 0xa0, 0x8a, 0x98, 0x8f, 0xfe,
+	0x51, 0x41, 0xa6, 0x17, 0xfe, 0xce, 0x79, 0xab, 0x33, 0x6e, 0xd0, 0x2c, 0x31, 0x2c, 0x31, 0x2c,
+	0xc0, 0x51, 0x92, 0xfe, 0xfe, 0x7b, 0xef, 0x95, 0xee, 0x9d, 0x99, 0x7f, 0xa5, 0x55, 0xa7, 0x55,
+	0xab, 0x22, 0xac, 0x22, 0xa6, 0x55, 0xa3, 0x77, 0x6e, 0x65, 0x31, 0xd3, 0x61, 0x6d, 0xfe, 0xc5,
+	0x94, 0xfe, 0x5a, 0x46, 0x99, 0xcb, 0xae, 0x11, 0x9b, 0xab, 0x98, 0xcd, 0xfe, 0x9c, 0x91, 0x2c,
+	0xc0, 0x31, 0xd3, 0x65, 0x51, 0xfe, 0x9c, 0x90, 0xfe, 0x39, 0x01, 0xa9, 0x51, 0xaf, 0x20, 0x9c,
+	0xa9, 0xfe, 0x51, 0x81, 0xaa, 0x15, 0xfe, 0xde, 0xb9, 0x2c, 0xc0, 0x31, 0xcf, 0x2a, 0x31, 0xc0,
+	0x2c, 0x31, 0xfe, 0xce, 0x17, 0xfe, 0x62, 0x46, 0x98, 0xda, 0xfe, 0x8b, 0x26, 0x9c, 0x9c, 0x95,
+	0xcf, 0xfe, 0x9c, 0x6f, 0xfe, 0xff, 0xbd, 0x2c, 0x31, 0xd5, 0xfe, 0xc6, 0x18, 0xfe, 0x63, 0x0c,
+	0x93, 0xee, 0x51, 0x29, 0x7e, 0x52, 0xc0, 0xfe, 0x7b, 0xae, 0x38, 0x6f, 0x9a, 0xbb, 0x96, 0xdc,
+	0x92, 0xff, 0x95, 0xde, 0x31, 0x29, 0x24, 0x29, 0xa3, 0x77, 0xa9, 0x33, 0xae, 0x11, 0xae, 0x11,
+	0xa8, 0x44, 0x2c, 0x6e, 0x2c, 0x65, 0x9c, 0xa9, 0xfe, 0xb5, 0x12, 0xfe, 0x51, 0xe4, 0x99, 0xdb,
+	0xab, 0x50, 0xac, 0x30, 0xa3, 0x95, 0x74, 0x75, 0x6d, 0x65, 0x11, 0x1c, 0x46, 0x57, 0x6f, 0x10,
+	0xc0, 0x66, 0x10, 0x5a, 0xc0, 0x66, 0x56, 0x46, 0x6b, 0xa2, 0x58, 0x5b, 0x47, 0x9d, 0x9a, 0x9b,
+	0xac, 0x98, 0xcc, 0x9b, 0xab, 0xa9, 0x34, 0xfe, 0xbd, 0xb6, 0xfe, 0xff, 0xff, 0x66, 0x31, 0xca,
+	0x2c, 0x31, 0xc7, 0x2e, 0xc1, 0x62, 0xfe, 0xc5, 0xd6, 0xfe, 0x5a, 0x05, 0x9a, 0xe9, 0xfe, 0xc3,
+	0xe5, 0xa4, 0x83, 0x42, 0xa0, 0x6a, 0xfe, 0x6a, 0x42, 0xfe, 0x31, 0x21, 0xa4, 0x59, 0xfe, 0x9c,
+	0x92, 0xfe, 0xff, 0x9e, 0x31, 0xfd, 0xfd, 0xc2, 0x09, 0xfe, 0x6b, 0x6d, 0xfe, 0x29, 0x44, 0x29,
+	0xc0, 0x61, 0x29, 0xc1, 0x66, 0xdc, 0xa8, 0x43, 0xb0, 0x01, 0x65, 0x14, 0x69, 0x14, 0x6e, 0xc0,
+	0x14, 0x19, 0xc6, 0x14, 0xc0, 0x19, 0x51, 0x19, 0x56, 0x05, 0x19, 0x05, 0x51, 0x9d, 0xaa, 0x14,
+	0x92, 0xfe, 0x1d, 0x7f, 0x24, 0xc0, 0x2c, 0xc0, 0x24, 0x65, 0x1d, 0x6d, 0x22, 0x76, 0x74, 0xa4,
+	0x93, 0xfe, 0xbb, 0x85, 0xa4, 0x83, 0xa1, 0x97, 0xa0, 0x7a, 0x99, 0x9f, 0xfe, 0x51, 0x61, 0xa6,
+	0x27, 0xfe, 0xd6, 0x99, 0xaa, 0x34, 0x6e, 0xd2, 0x2c, 0x31, 0xc0, 0x2c, 0x31, 0x2c, 0x9b, 0xaa,
+	0x9b, 0xbb, 0x39, 0x6e, 0xa2, 0x88, 0x04, 0xa4, 0x65, 0xc1, 0x56, 0x25, 0x31, 0xd3, 0x2a, 0xc0,
+	0x98, 0xeb, 0xfe, 0x83, 0x8b, 0xfe, 0x39, 0x21, 0xad, 0x21, 0xa7, 0x44, 0x93, 0xef, 0xa0, 0x8a,
+	0xfe, 0xcd, 0xf7, 0x2c, 0x52, 0x31, 0xd2, 0x2a, 0x56, 0x1c, 0xfe, 0x73, 0x4b, 0xfe, 0x39, 0x00,
+	0xfe, 0x8a, 0xe6, 0xaa, 0x43, 0x95, 0xee, 0x95, 0xbf, 0xfe, 0x94, 0x0d, 0xfe, 0xf7, 0x9d, 0x2c,
+	0x5a, 0x7e, 0xce, 0x2a, 0xc1, 0x31, 0x27, 0x65, 0xfe, 0xac, 0xf2, 0xfe, 0x49, 0x62, 0xa3, 0x85,
+	0xfe, 0xa3, 0xa7, 0x99, 0x9e, 0xfe, 0x39, 0x42, 0xfe, 0x9c, 0x90, 0x25, 0x2c, 0x31, 0xd3, 0x25,
+	0x31, 0x9d, 0xaa, 0x91, 0xff, 0xfe, 0x6b, 0x4c, 0x93, 0xff, 0x9b, 0xab, 0x6e, 0xa2, 0x77, 0x15,
+	0xa9, 0x44, 0xfe, 0x8c, 0x71, 0x05, 0x95, 0xed, 0x96, 0xde, 0x40, 0x29, 0x6e, 0xa3, 0x77, 0x15,
+	0xaa, 0x34, 0xa9, 0x33, 0x08, 0xa8, 0x43, 0x31, 0xc0, 0x2c, 0xc0, 0x55, 0xc0, 0x31, 0x9a, 0xcb,
+	0xfe, 0xad, 0x12, 0xfe, 0x49, 0xc4, 0x9d, 0xc8, 0xa7, 0x62, 0xaa, 0x52, 0xa6, 0x73, 0x75, 0x64,
+	0x69, 0x12, 0x9b, 0xad, 0x97, 0xbe, 0x47, 0x42, 0x55, 0x66, 0xc0, 0x39, 0xc1, 0x56, 0x66, 0x41,
+	0x56, 0x6b, 0xa2, 0x67, 0xa1, 0x79, 0x56, 0x5a, 0x66, 0x5a, 0xa9, 0x34, 0xfe, 0xbd, 0x95, 0xfe,
+	0xff, 0xff, 0x66, 0x31, 0xd8, 0x98, 0xdc, 0xfe, 0x6b, 0x0a, 0xfe, 0x49, 0x20, 0xfe, 0xab, 0x64,
+	0xa7, 0x82, 0x51, 0xa2, 0x58, 0xfe, 0x7a, 0x83, 0xfe, 0x39, 0x21, 0xa2, 0x59, 0xfe, 0x8c, 0x0f,
+	0x1b, 0x31, 0xfd, 0xfd, 0xc3, 0xfe, 0x8c, 0x50, 0xfe, 0x31, 0xa6, 0x9d, 0xa9, 0xc1, 0x29, 0xc1,
+	0x66, 0xcf, 0x7a, 0xca, 0x24, 0xa3, 0x76, 0xfe, 0x7b, 0xcf, 0xa4, 0x66, 0x0d, 0x14, 0x0d, 0x56,
+	0x6e, 0xc0, 0x05, 0xc0, 0x6f, 0x19, 0x5a, 0xc1, 0x19, 0xc1, 0x05, 0x16, 0x11, 0xc0, 0x19, 0x16,
+	0x0a, 0x61, 0x0d, 0x9c, 0xaa, 0x3d, 0x9c, 0xba, 0x24, 0x1d, 0x24, 0xc0, 0x7e, 0xc0, 0x27, 0x5d,
+	0x69, 0x22, 0x76, 0x74, 0xa4, 0x93, 0xfe, 0xb3, 0xa5, 0xa3, 0xa4, 0x7a, 0x23, 0xfe, 0xab, 0x26,
+	0xfe, 0x59, 0x62, 0xa6, 0x17, 0xfe, 0xd6, 0xba, 0xa9, 0x44, 0x31, 0xd2, 0x2c, 0x31, 0xc0, 0x2c,
+	0x31, 0x51, 0x31, 0xc4, 0x1d, 0x65, 0x2c, 0x31, 0xc0, 0x2c, 0x31, 0xd2, 0x65, 0x9c, 0xa9, 0xfe,
+	0xa4, 0xd0, 0xfe, 0x51, 0xe4, 0x69, 0xb0, 0x10, 0x9c, 0x9a, 0xfe, 0x41, 0x82, 0xad, 0x23, 0xfe,
+	0xee, 0xfb, 0xa6, 0x46, 0x5a, 0x6e, 0x31, 0xd1, 0x69, 0x51, 0xfe, 0xbd, 0xf7, 0xfe, 0x52, 0x47,
+	0x9a, 0xe9, 0xfe, 0xab, 0xc9, 0xa2, 0x87, 0xfe, 0x7a, 0x24, 0x9c, 0x7b, 0xfe, 0xb5, 0x12, 0x2a,
+	0x2c, 0x5a, 0x31, 0xce, 0x2a, 0xc1, 0x31, 0x27, 0x9b, 0xba, 0xfe, 0x8b, 0xad, 0xfe, 0x40, 0xe0,
+	0xfe, 0x7a, 0x84, 0xac, 0x30, 0xfe, 0x7a, 0xc6, 0xfe, 0x39, 0x63, 0xfe, 0x94, 0x4f, 0xfe, 0xf7,
+	0x9d, 0x2c, 0x31, 0x29, 0x31, 0xd1, 0x25, 0xc0, 0x31, 0x9d, 0xaa, 0x94, 0xee, 0x92, 0xfe, 0x96,
+	0xde, 0x96, 0xdc, 0x3d, 0x9d, 0xa9, 0x6b, 0x3d, 0x61, 0x6f, 0x05, 0xa4, 0x67, 0xa7, 0x44, 0xa7,
+	0x55, 0xac, 0x22, 0xaa, 0x32, 0xa5, 0x56, 0xa2, 0x77, 0x31, 0x1d, 0xc0, 0x7f, 0xc0, 0x25, 0x31,
+	0x2c, 0x29, 0xc0, 0x11, 0xfe, 0xb5, 0x33, 0xfe, 0x6a, 0x87, 0xfe, 0x49, 0x00, 0xa9, 0x51, 0xad,
+	0x40, 0xa3, 0x76, 0x9f, 0x96, 0x7a, 0xa1, 0x69, 0x96, 0xbe, 0x13, 0xa3, 0x57, 0xa2, 0x58, 0x66,
+	0x6f, 0x6e, 0xa2, 0x77, 0xa2, 0x67, 0xc1, 0x25, 0x7f, 0xa2, 0x67, 0xa2, 0x77, 0x6f, 0x6e, 0x7f,
+	0x41, 0x7f, 0xa7, 0x44, 0xac, 0x22, 0xaf, 0x01, 0xa4, 0x67, 0x2c, 0x31, 0xcf, 0x2c, 0x31, 0xc3,
+	0x69, 0xc1, 0x9a, 0xbb, 0xfe, 0x7b, 0xac, 0xfe, 0x41, 0x20, 0xfe, 0x92, 0xc4, 0xfe, 0xdc, 0x26,
+	0xc0, 0x6f, 0xfe, 0x82, 0x84, 0x96, 0xaf, 0xa1, 0x5a, 0xfe, 0x83, 0xee, 0xfe, 0xff, 0x9d, 0x31,
+	0xfd, 0xfd, 0xc3, 0xfe, 0xa5, 0x13, 0xfe, 0x39, 0xe7, 0x9a, 0xbb, 0x66, 0xa3, 0x66, 0xc3, 0x66,
+	0xce, 0x7a, 0xca, 0x24, 0x65, 0xfe, 0x73, 0x8d, 0xa7, 0x55, 0x0d, 0x6f, 0x51, 0xa3, 0x76, 0x0a,
+	0x7b, 0xa2, 0x66, 0x19, 0xc2, 0x5a, 0x66, 0x0a, 0x05, 0xc1, 0xa4, 0x56, 0x16, 0xc1, 0x05, 0x19,
+	0x05, 0x19, 0xfe, 0x52, 0x8a, 0x24, 0xc0, 0x50, 0xa3, 0x77, 0xc0, 0x24, 0x69, 0x24, 0x27, 0x1d,
+	0xa2, 0x65, 0x67, 0x76, 0x70, 0xa5, 0x82, 0xfe, 0xb3, 0x85, 0xa6, 0x72, 0x7a, 0x57, 0x98, 0x9f,
+	0xfe, 0x51, 0x41, 0xa7, 0x17, 0xfe, 0xd6, 0x99, 0xaa, 0x34, 0x6e, 0xd1, 0x2c, 0x31, 0xc1, 0x2c,
+	0x31, 0x2c, 0x31, 0xc0, 0x2c, 0x31, 0x2c, 0x31, 0xc1, 0x2c, 0x69, 0x2c, 0x31, 0xd3, 0x25, 0xfe,
+	0xd6, 0x16, 0xfe, 0x62, 0x46, 0x96, 0xec, 0xfe, 0x83, 0x06, 0xaa, 0x33, 0x95, 0xcf, 0x94, 0xdf,
+	0xfe, 0x9c, 0x4f, 0xfe, 0xff, 0x9d, 0x5b, 0x31, 0x56, 0x31, 0xd1, 0x69, 0x9d, 0xaa, 0xfe, 0xad,
+	0x34, 0xfe, 0x49, 0xa4, 0xa3, 0x94, 0xfe, 0xbc, 0x2a, 0x52, 0xfe, 0x61, 0xa3, 0xa4, 0x37, 0xfe,
+	0xc5, 0xd6, 0xfe, 0xf7, 0xbd, 0x6b, 0x31, 0xce, 0x2a, 0xc0, 0x69, 0x2a, 0x31, 0x2c, 0x97, 0xec,
+	0xfe, 0x7a, 0xea, 0xfe, 0x38, 0xc0, 0xfe, 0x93, 0x25, 0xa9, 0x52, 0xfe, 0x7a, 0xe6, 0x1a, 0xfe,
+	0x8c, 0x0e, 0xfe, 0xf7, 0x5c, 0x2c, 0x31, 0x52, 0x31, 0xd2, 0x1d, 0xc0, 0x31, 0xc0, 0x9c, 0xaa,
+	0x9b, 0xba, 0x9b, 0xab, 0x95, 0xee, 0x95, 0xed, 0x9a, 0xbb, 0x9d, 0x9a, 0xa7, 0x44, 0xab, 0x33,
+	0xa9, 0x33, 0xa9, 0x44, 0x04, 0xa2, 0x77, 0x31, 0xc5, 0x2c, 0x69, 0x66, 0x04, 0x1d, 0x31, 0x5a,
+	0xc0, 0x31, 0xfe, 0xbd, 0xb4, 0xfe, 0x6a, 0x87, 0x03, 0xa5, 0x83, 0xaf, 0x10, 0xa8, 0x52, 0x50,
+	0x9e, 0x7b, 0xfe, 0x7a, 0x43, 0x99, 0xae, 0xfe, 0x9c, 0x0e, 0xfe, 0xd6, 0x38, 0xa3, 0x57, 0x6e,
+	0x7f, 0xa2, 0x67, 0xa2, 0x76, 0x6e, 0x3a, 0x7a, 0x65, 0x5a, 0x3d, 0x7e, 0x11, 0xc1, 0x6e, 0xa2,
+	0x77, 0xc0, 0x6b, 0x51, 0x2c, 0x31, 0xce, 0x2c, 0xc0, 0x31, 0x2c, 0x31, 0xc1, 0x2a, 0xc1, 0x2e,
+	0xfe, 0x83, 0xee, 0xfe, 0x49, 0x82, 0xa8, 0x71, 0xab, 0x70, 0x7e, 0x6f, 0xfe, 0x8a, 0xa4, 0xfe,
+	0x49, 0x62, 0xa1, 0x59, 0xfe, 0x84, 0x0f, 0x02, 0x31, 0xfd, 0xfd, 0xc1, 0x1d, 0x31, 0x0d, 0xfe,
+	0x6b, 0x6d, 0xfe, 0x31, 0x85, 0x56, 0xc0, 0x66, 0x69, 0x24, 0x31, 0x9d, 0xaa, 0x1d, 0xc1, 0x7f,
+	0x1d, 0xc0, 0x24, 0xc0, 0x31, 0x29, 0x2c, 0xc0, 0x29, 0x1d, 0x24, 0xcb, 0x29, 0x1d, 0x2c, 0xa9,
+	0x33, 0x09, 0xa3, 0x76, 0xa3, 0x67, 0xa3, 0x66, 0x51, 0x05, 0x0a, 0x19, 0x59, 0x19, 0xc0, 0x05,
+	0x19, 0xc0, 0x56, 0xc0, 0x19, 0xc0, 0x1e, 0x19, 0xc0, 0x1e, 0x61, 0xc0, 0x09, 0x93, 0xfe, 0x24,
+	0xc0, 0x1d, 0x24, 0xc4, 0x22, 0x4a, 0x22, 0xa0, 0xa8, 0x9d, 0xc9, 0xa2, 0x94, 0xfe, 0xab, 0x24,
+	0xa9, 0x51, 0x7d, 0x41, 0x99, 0x9f, 0xfe, 0x49, 0x60, 0xa7, 0x39, 0xfe, 0xd6, 0x79, 0xab, 0x23,
+	0xc1, 0x6e, 0x2c, 0x66, 0x2c, 0xc0, 0x31, 0xc1, 0x5a, 0xc0, 0x31, 0xe3, 0x2e, 0x31, 0x65, 0x31,
+	0x59, 0x2e, 0x59, 0x77, 0x76, 0xfe, 0xd5, 0xf8, 0xfe, 0x72, 0x89, 0xfe, 0x48, 0xe0, 0xfe, 0x82,
+	0x63, 0xfe, 0xc4, 0x48, 0x49, 0xfe, 0x49, 0xc2, 0xa1, 0x69, 0xfe, 0xb5, 0x94, 0xaf, 0x11, 0x31,
+	0xc0, 0x2c, 0x31, 0xd1, 0x9d, 0x9a, 0x79, 0xfe, 0x8b, 0xce, 0xfe, 0x51, 0x61, 0xfe, 0x9b, 0x05,
+	0xad, 0x10, 0xfe, 0x8b, 0x26, 0xfe, 0x39, 0x62, 0xfe, 0x7b, 0x8d, 0xfe, 0xef, 0x3d, 0xa3, 0x75,
+	0x25, 0x2e, 0x31, 0xcd, 0x69, 0x69, 0x69, 0x2a, 0x2c, 0x62, 0xfe, 0xc5, 0x75, 0xfe, 0x49, 0x63,
+	0xa1, 0xa4, 0xfe, 0xbc, 0x08, 0xa4, 0x73, 0xfe, 0x8b, 0x46, 0xfe, 0x31, 0x40, 0xfe, 0x7b, 0x8b,
+	0xfe, 0xef, 0x5b, 0x2c, 0xc0, 0x66, 0x2c, 0x31, 0xc1, 0x2a, 0xc0, 0x31, 0xe5, 0x2c, 0xc1, 0x2e,
+	0xc0, 0x5a, 0xc0, 0x65, 0x11, 0xfe, 0xbd, 0x94, 0xfe, 0x72, 0xa7, 0xfe, 0x40, 0xe0, 0xa8, 0x53,
+	0xfe, 0xb4, 0x0a, 0xa4, 0x55, 0x9c, 0xab, 0xfe, 0x41, 0x20, 0xa5, 0x57, 0xfe, 0xcd, 0xd6, 0xae,
+	0x02, 0x2c, 0xc1, 0x31, 0xdc, 0x2e, 0xc0, 0x31, 0xc1, 0x2c, 0xc2, 0x31, 0xc1, 0x2a, 0x5a, 0x3a,
+	0xfe, 0x73, 0x8c, 0xfe, 0x38, 0xe0, 0xfe, 0x93, 0x05, 0xa9, 0x81, 0x69, 0x27, 0xfe, 0x8a, 0xa4,
+	0xfe, 0x49, 0x21, 0xa0, 0x5a, 0xfe, 0x83, 0xef, 0xfe, 0xf7, 0x7e, 0x31, 0xfd, 0xfd, 0xc1, 0x65,
+	0x31, 0x61, 0xfe, 0xad, 0x75, 0x01, 0x95, 0xee, 0x6e, 0x56, 0x1d, 0x6b, 0xa2, 0x76, 0x66, 0x5a,
+	0x31, 0x2c, 0x1d, 0x2c, 0xc0, 0x24, 0x1d, 0x29, 0x2c, 0x24, 0x18, 0x1d, 0x2c, 0xc0, 0x24, 0xca,
+	0x29, 0x1d, 0xc0, 0x29, 0x31, 0xa4, 0x66, 0xa7, 0x44, 0xa8, 0x45, 0xa3, 0x76, 0x6f, 0xc0, 0x1e,
+	0xc0, 0x19, 0xc1, 0x1e, 0x19, 0x55, 0x6b, 0x19, 0x11, 0x19, 0xc2, 0x0d, 0x31, 0x94, 0xfe, 0x24,
+	0x18, 0x29, 0x24, 0xc5, 0x29, 0x49, 0xa0, 0xa8, 0xa0, 0xa9, 0x9d, 0xb8, 0xa1, 0xb6, 0xfe, 0xa2,
+	0xe4, 0xaa, 0x40, 0x7c, 0x5a, 0x9a, 0x9f, 0xfe, 0x51, 0x60, 0xa4, 0x4a, 0xfe, 0xce, 0x38, 0xae,
+	0x01, 0xc1, 0x56, 0xc0, 0x31, 0xc0, 0x66, 0x31, 0xc1, 0x5a, 0xc0, 0x31, 0xe5, 0x59, 0x31, 0x27,
+	0x1f, 0x2e, 0x2c, 0xfe, 0xd6, 0x38, 0xfe, 0x83, 0x4b, 0xfe, 0x51, 0x42, 0xa5, 0x74, 0xfe, 0xab,
+	0xa7, 0xa5, 0x64, 0x99, 0xbb, 0xfe, 0x41, 0x61, 0xa9, 0x25, 0xfe, 0xce, 0x37, 0x25, 0x20, 0x31,
+	0xd4, 0x99, 0xcb, 0xfe, 0x62, 0x88, 0x99, 0xf8, 0xfe, 0xb3, 0x86, 0xa5, 0x56, 0xfe, 0x72, 0x64,
+	0x9a, 0x7e, 0xfe, 0x9c, 0xd2, 0xfe, 0xff, 0xbf, 0x20, 0x31, 0x2e, 0x31, 0xcc, 0x66, 0x6d, 0x23,
+	0xc0, 0x2a, 0x2c, 0x9b, 0xcc, 0xfe, 0x9c, 0x0f, 0xfe, 0x49, 0x01, 0xfe, 0x8a, 0xa4, 0xfe, 0xc4,
+	0x27, 0x7c, 0x9b, 0x8f, 0xfe, 0x39, 0x40, 0xa7, 0x46, 0xfe, 0xd6, 0x57, 0x31, 0x2c, 0x31, 0x2c,
+	0x31, 0x2a, 0xc0, 0x31, 0xe7, 0x2c, 0xc1, 0x31, 0x2e, 0xc2, 0x31, 0x9c, 0xb9, 0xfe, 0xc5, 0xb5,
+	0xfe, 0x7b, 0x0a, 0x93, 0xfe, 0xa3, 0x75, 0xad, 0x10, 0x66, 0xfe, 0x30, 0xe0, 0xfe, 0x7b, 0x2a,
+	0xfe, 0xee, 0xfb, 0x20, 0x2c, 0xc0, 0x31, 0xdd, 0x2e, 0x31, 0xc2, 0x2c, 0xc0, 0x31, 0xc1, 0x2a,
+	0xc1, 0x2e, 0x98, 0xdb, 0xfe, 0x62, 0xe9, 0xfe, 0x41, 0x00, 0xfe, 0xab, 0x66, 0xa6, 0x82, 0xc0,
+	0xa1, 0x79, 0x38, 0xfe, 0x49, 0x41, 0xa0, 0x5b, 0x34, 0xfe, 0xf7, 0x7e, 0x31, 0xfd, 0xfd, 0xc2,
+	0x65, 0xc0, 0x9d, 0x9a, 0xfe, 0xad, 0x75, 0x10, 0x95, 0xdd, 0xc0, 0x7f, 0x51, 0xc0, 0x1d, 0x6f,
+	0x7e, 0x2c, 0x24, 0x1d, 0xc1, 0x2c, 0x1d, 0x24, 0x1d, 0xc0, 0x2c, 0x24, 0x1d, 0x24, 0xcb, 0x1d,
+	0x29, 0x2c, 0x1d, 0xc0, 0x31, 0xa7, 0x45, 0xa5, 0x65, 0x6f, 0xa2, 0x76, 0xa6, 0x56, 0x19, 0x55,
+	0xc0, 0x19, 0xc0, 0x0a, 0xc0, 0x19, 0xc0, 0x0a, 0x19, 0xc0, 0x0a, 0x19, 0x0d, 0x97, 0xdd, 0x31,
+	0x18, 0xc0, 0x2c, 0xc0, 0x24, 0xc4, 0x6e, 0x59, 0x29, 0x2c, 0x9d, 0xca, 0xa1, 0xa4, 0xaa, 0x60,
+	0xfe, 0xd4, 0x06, 0x7d, 0xc0, 0x9d, 0x7c, 0xfe, 0x61, 0xa1, 0xa0, 0x6c, 0xfe, 0xbd, 0x96, 0xfe,
+	0xff, 0xdd, 0x25, 0x6f, 0x2e, 0xc0, 0x31, 0xe7, 0x69, 0xc0, 0x31, 0xc2, 0x2a, 0x5a, 0x67, 0x2e,
+	0x31, 0x95, 0xfd, 0xfe, 0x8b, 0xac, 0xfe, 0x51, 0x61, 0xa2, 0x85, 0xae, 0x20, 0xa7, 0x64, 0x51,
+	0x96, 0xbe, 0xfe, 0x31, 0x00, 0xfe, 0x83, 0xcc, 0xfe, 0xe7, 0x1a, 0x2a, 0x62, 0x6f, 0x31, 0xd3,
+	0xfe, 0xb5, 0x95, 0xfe, 0x41, 0x83, 0xa5, 0x93, 0xfe, 0xbb, 0xe7, 0x5b, 0xfe, 0x61, 0xe2, 0xa3,
+	0x3a, 0xfe, 0xc6, 0x37, 0xae, 0x12, 0x9d, 0xb9, 0x31, 0x2e, 0x31, 0xcb, 0x2c, 0xc0, 0x2a, 0x23,
+	0xc0, 0x31, 0x2c, 0x97, 0xee, 0xfe, 0x72, 0xaa, 0x1c, 0x01, 0xa4, 0x83, 0x7d, 0x9f, 0x6c, 0xfe,
+	0x61, 0xe3, 0x9b, 0x9b, 0xfe, 0xb5, 0x32, 0xfe, 0xff, 0xde, 0x56, 0x31, 0x2a, 0xc2, 0x31, 0xe8,
+	0x2c, 0xc3, 0x25, 0x31, 0x50, 0x2a, 0x14, 0x94, 0xee, 0xfe, 0x7b, 0x8d, 0xfe, 0x41, 0x63, 0xa3,
+	0x84, 0xa2, 0x68, 0x98, 0xbd, 0xfe, 0xac, 0xd1, 0xfe, 0xff, 0x9d, 0x20, 0x2c, 0x31, 0xe4, 0x2c,
+	0x31, 0xc0, 0x25, 0xc0, 0x23, 0x2a, 0x56, 0xfe, 0xc6, 0x16, 0xfe, 0x52, 0x05, 0x9d, 0xd6, 0xfe,
+	0xc3, 0xe7, 0xa2, 0x94, 0x6b, 0xa1, 0x69, 0xfe, 0x7a, 0x63, 0xfe, 0x41, 0x42, 0xa1, 0x59, 0xfe,
+	0x8c, 0x30, 0xfe, 0xff, 0xbe, 0x31, 0xfd, 0xfd, 0xc2, 0x65, 0x20, 0x31, 0x20, 0xfe, 0xb5, 0xb6,
+	0xfe, 0x63, 0x2c, 0x95, 0xee, 0x51, 0x50, 0x6f, 0xc0, 0x66, 0x1d, 0x29, 0xc0, 0x24, 0x7e, 0x38,
+	0x29, 0x38, 0x69, 0x24, 0x65, 0x24, 0x29, 0x24, 0xcb, 0x2c, 0x29, 0x1d, 0xc0, 0x29, 0xc1, 0x1d,
+	0xa3, 0x67, 0x55, 0xa2, 0x87, 0xac, 0x12, 0x0a, 0x7f, 0x66, 0x0a, 0xc1, 0x14, 0x19, 0xc0, 0x14,
+	0xa2, 0x66, 0x14, 0x55, 0x19, 0x9c, 0xaa, 0xfe, 0x4a, 0x28, 0x18, 0x2c, 0x24, 0xc0, 0x29, 0x24,
+	0xc4, 0x29, 0x69, 0x24, 0x6b, 0x75, 0xa0, 0xb6, 0xa6, 0x82, 0xfe, 0xcc, 0x07, 0xa1, 0x95, 0x7a,
+	0x9e, 0x6b, 0xfe, 0x69, 0xc1, 0x1d, 0xfe, 0xa4, 0x91, 0xfe, 0xf7, 0xbc, 0x6f, 0x6f, 0x6b, 0x27,
+	0xc0, 0x2a, 0xc1, 0x6b, 0xe1, 0x2a, 0xc3, 0x25, 0xc0, 0x2a, 0xc0, 0x56, 0x31, 0xc0, 0xfe, 0xe6,
+	0x9b, 0xfe, 0x93, 0xcd, 0xfe, 0x51, 0x81, 0xa2, 0x95, 0xfe, 0xab, 0x84, 0xa6, 0x54, 0x9f, 0x9b,
+	0x9d, 0xab, 0xfe, 0x7a, 0x03, 0x9a, 0x6c, 0xfe, 0xb5, 0x73, 0xfe, 0xff, 0xbd, 0x2a, 0x67, 0x31,
+	0xd2, 0x2c, 0x51, 0xfe, 0x7b, 0xad, 0xfe, 0x41, 0x41, 0xfe, 0x82, 0xe5, 0xab, 0x51, 0x9b, 0x9c,
+	0xfe, 0x51, 0x82, 0xfe, 0x6b, 0x2b, 0xfe, 0xe7, 0x1b, 0x2a, 0x9d, 0xb9, 0xa2, 0x68, 0x2e, 0x7a,
+	0xcb, 0x2c, 0xc0, 0x2a, 0xc1, 0x31, 0x2c, 0xfe, 0xc5, 0xb7, 0xfe, 0x51, 0xa4, 0xa3, 0x94, 0xfe,
+	0xc4, 0x07, 0xa1, 0x95, 0xa1, 0x96, 0xa1, 0x5b, 0xfe, 0x92, 0xe5, 0xfe, 0x49, 0x40, 0xfe, 0x93,
+	0xed, 0xfe, 0xef, 0x7c, 0xa3, 0x57, 0x6f, 0x79, 0x2a, 0x23, 0x2a, 0x31, 0xe8, 0x2a, 0x25, 0xc3,
+	0x2a, 0x61, 0x31, 0xc0, 0x2e, 0xfe, 0xbe, 0x39, 0xfe, 0x6b, 0x2b, 0xfe, 0x49, 0x83, 0x01, 0xa7,
+	0x45, 0xfe, 0xd6, 0x57, 0x19, 0x25, 0x6f, 0xe2, 0x2a, 0xc1, 0x25, 0x31, 0xc0, 0x2a, 0xc2, 0x9d,
+	0xaa, 0xfe, 0x9c, 0x6f, 0xfe, 0x49, 0x41, 0xa9, 0x60, 0xfe, 0xd4, 0x47, 0x9e, 0xc7, 0xa2, 0x58,
+	0x47, 0xfe, 0x6a, 0x02, 0x0e, 0xa2, 0x5a, 0xfe, 0x9c, 0xb2, 0xfe, 0xff, 0xdf, 0x6e, 0xfd, 0xfd,
+	0xc1, 0x2c, 0x31, 0xc2, 0x20, 0x98, 0xcc, 0x96, 0xcd, 0x94, 0xfe, 0xfe, 0x42, 0x08, 0x9b, 0xaa,
+	0x7a, 0x55, 0x24, 0x29, 0x24, 0x29, 0x2c, 0x24, 0x51, 0x6e, 0x1d, 0x29, 0x24, 0x15, 0x24, 0x29,
+	0x24, 0xcb, 0x29, 0xc0, 0x1d, 0xc1, 0x29, 0x1d, 0x29, 0x1d, 0x5a, 0xa7, 0x54, 0xab, 0x33, 0xa6,
+	0x55, 0x6f, 0xc0, 0x55, 0x0d, 0x19, 0x0a, 0x19, 0xc1, 0x0d, 0x0a, 0x66, 0x98, 0xcc, 0x38, 0x1d,
+	0xa2, 0x77, 0x2c, 0x1d, 0x24, 0xc5, 0x6d, 0x1d, 0x24, 0x6b, 0x66, 0xa0, 0xa5, 0xa2, 0xb5, 0xfe,
+	0xbb, 0xa6, 0xa4, 0x84, 0x79, 0x9e, 0x7b, 0xfe, 0x82, 0x02, 0xfe, 0x40, 0xc0, 0xfe, 0x7b, 0x0b,
+	0xfe, 0xef, 0x3b, 0x2a, 0x1b, 0x27, 0xc1, 0x2a, 0xc1, 0x67, 0xc0, 0x6e, 0xdf, 0x2a, 0xc3, 0x66,
+	0x2c, 0x25, 0x1b, 0x25, 0x67, 0x95, 0xfe, 0xfe, 0x93, 0xae, 0xfe, 0x59, 0x83, 0xa0, 0x95, 0xfe,
+	0xa3, 0x62, 0xaa, 0x42, 0x9d, 0xaa, 0x9e, 0x9c, 0x9a, 0xbe, 0xfe, 0x59, 0x21, 0xfe, 0x62, 0x67,
+	0xfe, 0xde, 0xb9, 0x25, 0xc0, 0x6f, 0xd2, 0x2c, 0xc0, 0x97, 0xdc, 0xfe, 0x49, 0xe5, 0x9d, 0xb7,
+	0xfe, 0x9b, 0x87, 0xa8, 0x53, 0xfe, 0x82, 0xc5, 0xfe, 0x49, 0x62, 0xfe, 0x94, 0x71, 0xfe, 0xf7,
+	0x9d, 0x23, 0xc0, 0x25, 0x5b, 0x31, 0xcb, 0x2c, 0xc0, 0x2a, 0xc0, 0x5a, 0x2e, 0x9d, 0xba, 0xfe,
+	0x9c, 0x51, 0xfe, 0x49, 0x21, 0xfe, 0x8a, 0x83, 0xfe, 0xcc, 0x06, 0xa2, 0x95, 0x74, 0xa1, 0x6a,
+	0x9a, 0x9e, 0xfe, 0x61, 0xa1, 0xa8, 0x16, 0xfe, 0xce, 0x78, 0x2e, 0x45, 0x27, 0x2a, 0x23, 0x2a,
+	0x31, 0xe8, 0x2a, 0xc0, 0x25, 0xc2, 0x65, 0x25, 0x31, 0x41, 0x2e, 0x5a, 0xfe, 0xad, 0x95, 0xfe,
+	0x5a, 0x47, 0x96, 0xcd, 0xb1, 0x00, 0xfe, 0xf7, 0x5c, 0x25, 0xc0, 0x31, 0xc3, 0x66, 0x31, 0xd9,
+	0x2c, 0xc0, 0x31, 0x2a, 0xc3, 0x25, 0x31, 0xc0, 0x2a, 0x65, 0x10, 0xfe, 0x6a, 0xa8, 0xfe, 0x51,
+	0x20, 0xfe, 0xab, 0x03, 0xab, 0x40, 0x9c, 0xc9, 0xa3, 0x48, 0x9d, 0x6c, 0xfe, 0x51, 0xa1, 0x9d,
+	0x7c, 0xa4, 0x58, 0xfe, 0xad, 0x54, 0xfe, 0xff, 0xbe, 0x31, 0xfd, 0xfd, 0xc3, 0x2c, 0x31, 0xc2,
+	0x2c, 0x10, 0xfe, 0x73, 0x8e, 0x24, 0x6e, 0xc0, 0x24, 0x69, 0x29, 0x7a, 0x1d, 0xa3, 0x77, 0xa9,
+	0x33, 0x52, 0x38, 0x29, 0x38, 0x29, 0x1d, 0x24, 0xcb, 0x1d, 0xc0, 0x29, 0xc2, 0x1d, 0x29, 0x1d,
+	0x29, 0xc0, 0x1d, 0xa7, 0x45, 0xa9, 0x43, 0xa6, 0x45, 0xa2, 0x88, 0xc0, 0x0d, 0x14, 0x0d, 0x6f,
+	0x14, 0x0d, 0xc0, 0x19, 0x9a, 0xbb, 0x25, 0x24, 0x69, 0x66, 0x24, 0x1d, 0x29, 0x24, 0xc4, 0x79,
+	0x69, 0x24, 0x5b, 0x7b, 0x9f, 0xa6, 0x0f, 0xfe, 0xa2, 0xe4, 0xa9, 0x61, 0xa1, 0x96, 0x4b, 0xfe,
+	0x9a, 0xc4, 0xfe, 0x51, 0x00, 0xa7, 0x26, 0xfe, 0xc5, 0xf7, 0xaf, 0x00, 0x55, 0xa2, 0x68, 0x59,
+	0x2e, 0x2a, 0xc1, 0x67, 0xc2, 0x31, 0xdd, 0x2a, 0xc2, 0x31, 0x2c, 0xc1, 0x25, 0x51, 0xfe, 0xc5,
+	0xd7, 0xfe, 0x83, 0x2d, 0xfe, 0x51, 0x43, 0xa3, 0x83, 0xfe, 0xa3, 0x23, 0xfe, 0xcc, 0x43, 0x7e,
+	0x6b, 0xa0, 0x7b, 0xfe, 0x9a, 0xc5, 0xfe, 0x50, 0xe1, 0xfe, 0x8b, 0xad, 0xfe, 0xf7, 0x7c, 0xa2,
+	0x77, 0x6f, 0x31, 0xd2, 0x2c, 0x25, 0xfe, 0xb5, 0x54, 0xfe, 0x39, 0x22, 0xfe, 0x6a, 0x42, 0xae,
+	0x20, 0xa2, 0x87, 0xfe, 0x51, 0x81, 0xa2, 0x6a, 0xfe, 0xbd, 0xb7, 0x1e, 0x69, 0x23, 0x25, 0x5b,
+	0x31, 0xcb, 0x2c, 0xc0, 0x31, 0x5a, 0xc0, 0x29, 0x9b, 0xca, 0xfe, 0x6a, 0xa9, 0xfe, 0x51, 0x41,
+	0xfe, 0x9b, 0x04, 0xa8, 0x71, 0xa1, 0x95, 0x75, 0xa0, 0x7a, 0x47, 0xfe, 0x82, 0x41, 0x9a, 0x8f,
+	0xfe, 0x94, 0x90, 0xfe, 0xe7, 0x9e, 0xa3, 0x66, 0x2e, 0x2a, 0xc1, 0x31, 0xe8, 0x2a, 0xc1, 0x25,
+	0xc1, 0x51, 0x7f, 0x2a, 0x41, 0x9b, 0xab, 0x95, 0xdd, 0xfe, 0x73, 0xcd, 0x00, 0x50, 0xfe, 0x94,
+	0x70, 0x11, 0xa2, 0x77, 0x2a, 0x31, 0xc3, 0x2c, 0x31, 0xd9, 0x2c, 0x31, 0x2a, 0xc2, 0x31, 0xc0,
+	0x2c, 0x31, 0xc0, 0x51, 0x9d, 0xa9, 0xfe, 0x8c, 0x2f, 0xfe, 0x49, 0x62, 0xa6, 0x82, 0xfe, 0xc3,
+	0x84, 0xa5, 0x74, 0x65, 0xa1, 0x49, 0x98, 0x9f, 0xfe, 0x39, 0x20, 0xa2, 0x59, 0xa7, 0x36, 0xfe,
+	0xc6, 0x17, 0xad, 0x21, 0x31, 0xfd, 0xfd, 0xc2, 0x2c, 0xc0, 0x31, 0xc1, 0x2c, 0xc0, 0x51, 0xfe,
+	0xa5, 0x34, 0xfe, 0x31, 0xa6, 0x9d, 0xaa, 0x7e, 0x24, 0xc0, 0xa2, 0x76, 0x24, 0x6e, 0xaf, 0x10,
+	0xfe, 0xbd, 0xd6, 0xa2, 0x78, 0xfe, 0x7b, 0xcf, 0x91, 0xff, 0x24, 0x29, 0x24, 0xc0, 0x69, 0xc0,
+	0x24, 0x29, 0xc0, 0x1d, 0x24, 0xc4, 0x29, 0xc0, 0x1d, 0xc0, 0x29, 0xc0, 0x24, 0xc0, 0x1d, 0x29,
+	0xc0, 0x1d, 0x29, 0x11, 0xa5, 0x65, 0xa7, 0x45, 0xa4, 0x66, 0xa2, 0x77, 0x7e, 0x6b, 0x6e, 0xc0,
+	0x05, 0x19, 0x14, 0x95, 0xdd, 0x96, 0xdd, 0x24, 0xc0, 0x65, 0x24, 0x1d, 0x29, 0x24, 0xc4, 0x79,
+	0x69, 0x1d, 0x5b, 0x6b, 0x20, 0x9f, 0xb6, 0xa8, 0x81, 0xfe, 0xcb, 0xe6, 0x1c, 0x5b, 0x9c, 0x8c,
+	0xfe, 0x71, 0xc0, 0x9c, 0x7d, 0xfe, 0x94, 0x10, 0xfe, 0xf7, 0x3c, 0xa4, 0x57, 0x2e, 0xc1, 0x7a,
+	0xc1, 0x66, 0xc2, 0x31, 0xd8, 0x2c, 0x31, 0xc3, 0x2e, 0xc0, 0x31, 0x56, 0x2c, 0x31, 0x2c, 0x25,
+	0xfe, 0xc5, 0xb5, 0xfe, 0x72, 0xea, 0xfe, 0x51, 0x43, 0xa0, 0x95, 0xfe, 0xab, 0x24, 0xa8, 0x51,
+	0x7c, 0x55, 0xa2, 0x79, 0x9f, 0x7c, 0xfe, 0x82, 0x23, 0x99, 0x9e, 0xfe, 0xbd, 0x53, 0xfe, 0xff,
+	0x9d, 0xa2, 0x67, 0xc0, 0x31, 0xcf, 0x2c, 0x31, 0x2c, 0xc0, 0x9d, 0x99, 0xfe, 0x83, 0xce, 0xfe,
+	0x39, 0x00, 0xfe, 0x82, 0xc3, 0xab, 0x33, 0x9b, 0xbb, 0xfe, 0x38, 0xe0, 0xfe, 0x6a, 0xea, 0xfe,
+	0xde, 0xbb, 0xa9, 0x31, 0x6d, 0x6b, 0x25, 0x2c, 0x31, 0xcb, 0x2c, 0x31, 0x55, 0x2e, 0x56, 0x29,
+	0xfe, 0xce, 0x17, 0xfe, 0x51, 0xa4, 0xa1, 0xa4, 0xfe, 0xbb, 0xa5, 0xa5, 0x73, 0x0e, 0x75, 0xc0,
+	0xa1, 0x69, 0x9a, 0x8e, 0xfe, 0x59, 0xa0, 0xa6, 0x29, 0xfe, 0xbd, 0xd7, 0xfe, 0xff, 0xff, 0x2e,
+	0x31, 0x69, 0x31, 0x65, 0x2c, 0x31, 0xe6, 0x59, 0x31, 0xc1, 0x2c, 0xc0, 0x25, 0x2a, 0x9d, 0xa9,
+	0x93, 0xee, 0xfe, 0x7b, 0xab, 0x94, 0xde, 0x9b, 0xbc, 0x9d, 0xab, 0xa5, 0x56, 0xfe, 0xad, 0x75,
+	0xfe, 0xf7, 0xde, 0x31, 0x69, 0x31, 0xc3, 0x2c, 0x31, 0xdb, 0x2a, 0xc2, 0x2e, 0x31, 0x2c, 0x56,
+	0x2c, 0x9b, 0xbb, 0x93, 0xfd, 0xfe, 0x51, 0xc5, 0x9d, 0xc6, 0xfe, 0xab, 0x45, 0xa6, 0x82, 0x79,
+	0x5f, 0x9d, 0x7c, 0xfe, 0x6a, 0x22, 0x98, 0x9e, 0xa2, 0x69, 0xae, 0x02, 0xfe, 0xde, 0xfa, 0x2a,
+	0x31, 0xfd, 0xfd, 0xca, 0x94, 0xee, 0xfe, 0x5a, 0xeb, 0x93, 0xff, 0x6e, 0x7f, 0x69, 0x24, 0x31,
+	0xaa, 0x34, 0xfe, 0xad, 0x55, 0xfe, 0xf7, 0xbe, 0x2c, 0x97, 0xdc, 0xfe, 0x94, 0x91, 0xfe, 0x52,
+	0x69, 0x98, 0xcc, 0x56, 0x29, 0x61, 0x6e, 0x2c, 0x24, 0x29, 0x1d, 0x24, 0xc4, 0x29, 0xcb, 0x1d,
+	0xc0, 0xa3, 0x67, 0xa3, 0x66, 0xa4, 0x66, 0x35, 0xa5, 0x65, 0x0d, 0x6f, 0x0d, 0x21, 0x25, 0x92,
+	0xff, 0x29, 0x24, 0xca, 0x79, 0x68, 0xa1, 0x69, 0x5b, 0xc0, 0x1d, 0xa0, 0xa6, 0xa1, 0xc5, 0xfe,
+	0xb3, 0x64, 0xa6, 0x74, 0xc0, 0x4b, 0x95, 0xce, 0xfe, 0x51, 0x00, 0xa9, 0x17, 0xfe, 0xcd, 0xd7,
+	0xfe, 0xff, 0xbf, 0x6e, 0x45, 0xa2, 0x77, 0x7a, 0x2c, 0x65, 0xc0, 0x31, 0xc0, 0x2c, 0x31, 0xdc,
+	0x2e, 0xc2, 0x66, 0x66, 0x31, 0x24, 0x99, 0xcb, 0xfe, 0xac, 0xf2, 0xfe, 0x6a, 0x67, 0x97, 0xdc,
+	0xa6, 0x73, 0xa8, 0x62, 0xfe, 0xdc, 0x67, 0x9f, 0x96, 0x78, 0x57, 0xa1, 0x69, 0x9b, 0x9e, 0xfe,
+	0x61, 0xa1, 0xa3, 0x59, 0xfe, 0xe6, 0x99, 0xa8, 0x34, 0xa3, 0x57, 0x65, 0x31, 0xcf, 0x51, 0x31,
+	0xc0, 0x66, 0x10, 0xfe, 0x5a, 0x67, 0xfe, 0x49, 0x20, 0xfe, 0x93, 0x25, 0xa8, 0x44, 0x94, 0xef,
+	0xfe, 0x38, 0xe1, 0xfe, 0x94, 0x30, 0xfe, 0xef, 0x5d, 0x2a, 0x23, 0xc0, 0x2a, 0x2c, 0x6e, 0xcb,
+	0x2c, 0x31, 0x1d, 0x31, 0x2e, 0x1d, 0xfe, 0x9c, 0x70, 0xfe, 0x49, 0x42, 0xa7, 0x70, 0xfe, 0xcc,
+	0x06, 0xa1, 0x95, 0x75, 0x7b, 0x6c, 0x5a, 0xa0, 0x5b, 0xfe, 0x82, 0xa3, 0xfe, 0x49, 0x62, 0xfe,
+	0x73, 0x4c, 0xfe, 0xd6, 0x7a, 0x2c, 0x24, 0x65, 0x25, 0x31, 0x2c, 0x31, 0xe6, 0x5a, 0x1a, 0x6b,
+	0x2e, 0xc1, 0x9b, 0xbb, 0x95, 0xfc, 0x92, 0xfe, 0xfe, 0x5a, 0x45, 0x9a, 0xba, 0xa3, 0x76, 0xa1,
+	0x7a, 0x9a, 0x9e, 0xab, 0x22, 0x39, 0x31, 0xc6, 0x2c, 0x31, 0xd9, 0x2a, 0x5a, 0xc2, 0x2e, 0x31,
+	0x29, 0x66, 0x2c, 0x61, 0xfe, 0xbd, 0x96, 0xfe, 0x62, 0x68, 0x98, 0xd9, 0xa9, 0x61, 0xab, 0x60,
+	0xa2, 0x96, 0x69, 0x4b, 0x98, 0x9f, 0xfe, 0x49, 0x81, 0x9f, 0x6a, 0xa1, 0x79, 0xfe, 0x84, 0x50,
+	0xfe, 0xef, 0x7c, 0xa4, 0x66, 0x31, 0xfd, 0xfd, 0xc8, 0x2c, 0xc1, 0xfe, 0xb5, 0x96, 0x3c, 0x95,
+	0xde, 0xc0, 0x55, 0xa2, 0x77, 0xad, 0x22, 0xfe, 0xad, 0x75, 0xb0, 0x00, 0x31, 0xc1, 0x18, 0x38,
+	0xfe, 0x5a, 0xeb, 0x95, 0xee, 0x51, 0x69, 0x7f, 0x5a, 0x10, 0x7e, 0x2c, 0x24, 0xc4, 0x29, 0xc6,
+	0x24, 0xc3, 0x2c, 0x29, 0x15, 0x01, 0x15, 0xa4, 0x76, 0xa5, 0x55, 0xad, 0x12, 0xa3, 0x76, 0x6f,
+	0x9d, 0xa9, 0x95, 0xde, 0x29, 0x1d, 0x24, 0xca, 0x79, 0x69, 0x1d, 0x22, 0x5b, 0x22, 0x9f, 0xb7,
+	0x70, 0xa9, 0x60, 0xae, 0x30, 0xa3, 0x75, 0xc0, 0x9c, 0x9a, 0xfe, 0x71, 0xe1, 0xfe, 0x49, 0x03,
+	0xfe, 0x83, 0x4c, 0xfe, 0xe6, 0x99, 0xaa, 0x14, 0x51, 0xa2, 0x67, 0x7e, 0xc0, 0x2c, 0xc0, 0x31,
+	0xdb, 0x61, 0x25, 0x2c, 0x31, 0x2e, 0x29, 0xc0, 0x2e, 0x31, 0xc0, 0x20, 0x93, 0xee, 0xfe, 0x8b,
+	0xee, 0xfe, 0x49, 0x42, 0x9d, 0xb9, 0xab, 0x30, 0xac, 0x30, 0xa5, 0x84, 0xa1, 0x84, 0x60, 0x7a,
+	0x4b, 0x9f, 0x7b, 0xfe, 0x92, 0xc4, 0xfe, 0x49, 0x40, 0xfe, 0x83, 0x6b, 0xfe, 0xff, 0x7d, 0x20,
+	0x2c, 0xc0, 0x31, 0xcf, 0x2c, 0x31, 0xc0, 0x51, 0xfe, 0xad, 0x55, 0xfe, 0x41, 0x63, 0xa2, 0x94,
+	0xfe, 0xab, 0xc7, 0xa2, 0x78, 0xfe, 0x61, 0xe2, 0x9c, 0x7d, 0x34, 0x2c, 0x2a, 0x69, 0xc0, 0x31,
+	0xcd, 0x2c, 0xc0, 0x1d, 0x31, 0x2e, 0x99, 0xdb, 0xfe, 0x7b, 0x2a, 0xfe, 0x51, 0x61, 0xfe, 0x9a,
+	0xe3, 0xab, 0x40, 0x70, 0x7f, 0x6b, 0x6c, 0x54, 0xa0, 0x7b, 0x9d, 0x7c, 0xfe, 0x69, 0xc2, 0x1b,
+	0xfe, 0x7b, 0x4c, 0xfe, 0xf7, 0x3d, 0x2c, 0xc0, 0x1d, 0x2a, 0x25, 0xc0, 0x31, 0xde, 0x2c, 0x31,
+	0xc1, 0x2c, 0x1d, 0x6f, 0x2e, 0x56, 0x31, 0xc0, 0x9d, 0x9a, 0x98, 0xdb, 0x39, 0xfe, 0x5a, 0x47,
+	0x95, 0xec, 0x08, 0xac, 0x30, 0xa6, 0x55, 0x9a, 0x9d, 0xfe, 0x31, 0x85, 0xfe, 0x73, 0xce, 0xfe,
+	0xef, 0x9d, 0xa3, 0x77, 0xe3, 0x2a, 0xc0, 0x27, 0x2e, 0xc0, 0x29, 0x66, 0x7e, 0x61, 0xfe, 0xcd,
+	0xb6, 0xfe, 0x6a, 0xa9, 0xfe, 0x30, 0x80, 0xfe, 0x7a, 0x63, 0xac, 0x40, 0xa2, 0xa6, 0x64, 0xa3,
+	0x67, 0x05, 0xfe, 0x6a, 0x22, 0x99, 0x9e, 0xa1, 0x69, 0xa5, 0x56, 0xfe, 0xad, 0x74, 0xfe, 0xf7,
+	0xde, 0x25, 0x31, 0xfd, 0xfd, 0xc8, 0x62, 0x2c, 0x31, 0x1d, 0xfe, 0xad, 0x55, 0xfe, 0x6b, 0x4d,
+	0x9a, 0xbb, 0xa3, 0x66, 0xa9, 0x44, 0xae, 0x11, 0x18, 0x31, 0x1d, 0x2c, 0xc0, 0x31, 0x2c, 0x94,
+	0xee, 0xfe, 0x84, 0x30, 0x92, 0xff, 0x98, 0xdc, 0x55, 0xc0, 0x66, 0x1d, 0x18, 0x6f, 0xc4, 0x6e,
+	0xc5, 0x24, 0xc4, 0x2c, 0x6e, 0xc0, 0x2c, 0x29, 0xc0, 0x2c, 0xac, 0x22, 0x05, 0xa2, 0x87, 0x96,
+	0xdd, 0x94, 0xde, 0x18, 0x2c, 0x56, 0xca, 0x79, 0x69, 0x1d, 0xc0, 0x6e, 0xc0, 0x19, 0x9e, 0xb7,
+	0xa3, 0x85, 0xad, 0x40, 0xa9, 0x52, 0xa2, 0x75, 0x66, 0x99, 0xbd, 0xfe, 0x61, 0xa2, 0x9c, 0x9b,
+	0xfe, 0x9c, 0x0e, 0xfe, 0xf7, 0x3b, 0xa6, 0x36, 0x66, 0xc0, 0x31, 0xc1, 0x25, 0xc0, 0x31, 0xdf,
+	0x56, 0x2c, 0x65, 0x99, 0xca, 0xfe, 0xac, 0xf1, 0xfe, 0x6a, 0xa8, 0xfe, 0x38, 0xc0, 0xa6, 0x73,
+	0xab, 0x31, 0xaa, 0x41, 0xa1, 0x96, 0x74, 0x64, 0xa2, 0x86, 0x56, 0x19, 0x9f, 0x6b, 0xfe, 0x72,
+	0x22, 0x9b, 0x9d, 0xfe, 0xb5, 0x12, 0xfe, 0xff, 0xde, 0x67, 0x2c, 0x31, 0xd0, 0x2c, 0xc0, 0x31,
+	0x9a, 0xbb, 0xfe, 0x83, 0xef, 0xfe, 0x41, 0x21, 0xab, 0x50, 0xfe, 0xc4, 0x28, 0x9c, 0x8c, 0xfe,
+	0x49, 0x41, 0xa8, 0x17, 0xfe, 0xd6, 0x79, 0x31, 0x2a, 0xc1, 0x31, 0xd0, 0x55, 0x31, 0xfe, 0xd6,
+	0x37, 0xfe, 0x62, 0x46, 0x9b, 0xd7, 0xfe, 0xb3, 0x85, 0xa6, 0x72, 0x66, 0x56, 0x9a, 0xbd, 0xa6,
+	0x52, 0xa3, 0x65, 0x53, 0xa1, 0x69, 0x98, 0xcf, 0xfe, 0x61, 0x81, 0x9d, 0x8c, 0xfe, 0x93, 0xce,
+	0xfe, 0xde, 0x79, 0xab, 0x12, 0xc0, 0x51, 0xa2, 0x76, 0xa1, 0x79, 0xe8, 0x11, 0x96, 0xdd, 0xfe,
+	0x94, 0x4f, 0xfe, 0x62, 0x67, 0x3d, 0xa4, 0x76, 0xa7, 0x63, 0xa8, 0x53, 0xa8, 0x53, 0x9c, 0xaa,
+	0xfe, 0x6a, 0x44, 0x9d, 0x5d, 0xfe, 0xa5, 0x13, 0x31, 0x2c, 0x5a, 0x31, 0xe0, 0x2a, 0x31, 0x59,
+	0xc0, 0x6b, 0x31, 0x51, 0x2c, 0x9c, 0xb9, 0xfe, 0xb4, 0xf2, 0xfe, 0x6a, 0x46, 0x98, 0xdb, 0xa8,
+	0x52, 0xfe, 0xbb, 0xe7, 0xa4, 0x75, 0x70, 0x6f, 0x47, 0xfe, 0x8a, 0xa4, 0x14, 0x9f, 0x6a, 0x5b,
+	0xad, 0x12, 0x01, 0x31, 0x22, 0x31, 0xfd, 0xfd, 0xc8, 0x66, 0x31, 0x61, 0x31, 0x9d, 0xaa, 0x9a,
+	0xbb, 0x9b, 0xba, 0xa4, 0x56, 0xa5, 0x66, 0x2c, 0x31, 0xc0, 0x2c, 0x31, 0xc3, 0x9a, 0xbb, 0xfe,
+	0xad, 0x54, 0xfe, 0x63, 0x0c, 0x94, 0xed, 0x10, 0xa2, 0x76, 0x7f, 0x51, 0x6f, 0xc4, 0x6e, 0xc5,
+	0x24, 0xc1, 0x7a, 0xc1, 0x1d, 0xc3, 0x24, 0x2c, 0xa2, 0x77, 0xae, 0x11, 0xa5, 0x55, 0x94, 0xef,
+	0x1d, 0xc0, 0x24, 0xcb, 0x27, 0xc0, 0x1d, 0xc1, 0x6e, 0x76, 0x79, 0x74, 0xa8, 0x62, 0xac, 0x41,
+	0xa6, 0x62, 0x74, 0x5b, 0xfe, 0x9a, 0xe4, 0xfe, 0x59, 0x60, 0xa5, 0x46, 0xfe, 0x9c, 0x4e, 0xfe,
+	0xde, 0xb9, 0xa8, 0x35, 0x7f, 0x6e, 0xc2, 0x2a, 0x31, 0xd9, 0x2a, 0x31, 0x56, 0xc0, 0x31, 0xc0,
+	0x1b, 0x9c, 0xa9, 0x96, 0xec, 0xfe, 0x8b, 0x8b, 0xfe, 0x59, 0xc2, 0x9d, 0xa9, 0xa4, 0x75, 0xab,
+	0x41, 0xa7, 0x63, 0x7e, 0x25, 0xa0, 0xa7, 0x9e, 0x97, 0xa2, 0x78, 0x66, 0xa0, 0x6a, 0x9d, 0x7c,
+	0xfe, 0x61, 0xc2, 0xa4, 0x48, 0xfe, 0xce, 0x37, 0xac, 0x23, 0x6b, 0x6e, 0x31, 0x2c, 0xc0, 0x31,
+	0x2a, 0x31, 0xca, 0x2c, 0x31, 0x51, 0x31, 0x95, 0xee, 0xfe, 0x5a, 0xca, 0xfe, 0x49, 0x61, 0x34,
+	0xa6, 0x74, 0x95, 0xbf, 0xfe, 0x38, 0xe0, 0xfe, 0x7b, 0xad, 0xfe, 0xe7, 0x3c, 0xa5, 0x65, 0xc0,
+	0x31, 0xc1, 0x2a, 0x31, 0xce, 0x55, 0x2a, 0xfe, 0xb5, 0x12, 0xfe, 0x49, 0x41, 0xa6, 0x72, 0xfe,
+	0xc3, 0xc5, 0xa3, 0x75, 0x7f, 0x9a, 0xac, 0xfe, 0x89, 0xe0, 0xa8, 0x32, 0xac, 0x21, 0x7a, 0x51,
+	0x7b, 0x97, 0xbe, 0xfe, 0x61, 0x60, 0xa1, 0x59, 0xfe, 0x8b, 0xac, 0xfe, 0xce, 0x58, 0xac, 0x22,
+	0xc0, 0x65, 0x25, 0x6f, 0xdf, 0x2c, 0x55, 0x2c, 0x31, 0xc0, 0x25, 0x9c, 0xaa, 0x98, 0xdb, 0xfe,
+	0x9c, 0x6f, 0xfe, 0x6a, 0xa7, 0x98, 0xdb, 0x60, 0xa7, 0x63, 0xa8, 0x53, 0xa6, 0x55, 0xa2, 0x87,
+	0x7e, 0x98, 0xcc, 0xfe, 0x61, 0xc1, 0xa6, 0x09, 0xfe, 0xc6, 0x37, 0xae, 0x12, 0x25, 0x6b, 0x31,
+	0xe2, 0x5a, 0x22, 0x6b, 0x2c, 0x9b, 0xba, 0x07, 0xfe, 0xa4, 0x4f, 0xfe, 0x59, 0xc3, 0x9c, 0xb9,
+	0xa8, 0x62, 0xad, 0x20, 0xa3, 0x84, 0x75, 0x7f, 0xa1, 0x69, 0x97, 0xaf, 0x3c, 0x1c, 0x47, 0xa3,
+	0x76, 0xfe, 0x8c, 0x30, 0xfe, 0xef, 0x3c, 0x31, 0x2c, 0x31, 0xfd, 0xfd, 0xc8, 0x62, 0x31, 0x2c,
+	0xc0, 0x31, 0xc0, 0x2c, 0x31, 0xc1, 0x51, 0x2c, 0x31, 0x1d, 0x31, 0xc3, 0x9d, 0xaa, 0x95, 0xed,
+	0xfe, 0x84, 0x0f, 0x92, 0xff, 0x98, 0xcd, 0x69, 0x7f, 0x24, 0xc4, 0x6e, 0xc5, 0x24, 0xc0, 0x7a,
+	0xc2, 0x2c, 0xc3, 0x29, 0x1d, 0x66, 0xaa, 0x23, 0xa5, 0x65, 0x98, 0xcc, 0x1d, 0x2c, 0x1d, 0x24,
+	0xcb, 0x7b, 0x27, 0x1d, 0xc0, 0x7a, 0xc0, 0x66, 0x79, 0xa2, 0x95, 0xaa, 0x51, 0xfe, 0xc4, 0x07,
+	0xa1, 0xa6, 0x6d, 0x9f, 0x6a, 0x98, 0xbd, 0xfe, 0x59, 0xa0, 0x4b, 0xfe, 0x7b, 0xab, 0xfe, 0xc5,
+	0xf6, 0xac, 0x13, 0x31, 0xc3, 0x55, 0x31, 0xd8, 0x59, 0x2a, 0x31, 0xc0, 0x66, 0x99, 0xcc, 0x94,
+	0xfd, 0x94, 0xfd, 0x94, 0xfc, 0x10, 0xa1, 0x97, 0xaa, 0x41, 0x19, 0xa3, 0x85, 0x69, 0x9d, 0xaa,
+	0x75, 0x79, 0xa2, 0x86, 0x5b, 0x5a, 0xa0, 0x6a, 0x9a, 0x8e, 0xfe, 0x49, 0x60, 0xfe, 0x7b, 0x4a,
+	0xfe, 0xe7, 0x1b, 0xa5, 0x67, 0xc0, 0x2c, 0xc1, 0x6e, 0xc0, 0x69, 0xc0, 0x31, 0xc9, 0x2c, 0x31,
+	0x51, 0x31, 0xfe, 0xbd, 0xd7, 0xfe, 0x4a, 0x27, 0x9e, 0xc5, 0xfe, 0xb4, 0x09, 0x9f, 0xb8, 0xfe,
+	0x71, 0xe2, 0x99, 0x9e, 0xfe, 0xb5, 0x74, 0x22, 0x7a, 0xc0, 0x31, 0xc1, 0x2a, 0x31, 0xcc, 0x1d,
+	0x31, 0x2a, 0x9b, 0xba, 0xfe, 0x7b, 0x2a, 0xfe, 0x48, 0xe0, 0xfe, 0x9a, 0xe4, 0xab, 0x40, 0x9f,
+	0x96, 0xa2, 0x79, 0x95, 0xdf, 0xfe, 0x69, 0x20, 0xa5, 0x43, 0xab, 0x31, 0xa8, 0x63, 0x20, 0x79,
+	0x42, 0x99, 0x9d, 0x96, 0xaf, 0xa0, 0x5b, 0xac, 0x04, 0xfe, 0xbd, 0xd5, 0x3d, 0x25, 0xc0, 0x2c,
+	0x6e, 0xdd, 0x2c, 0x1d, 0x2c, 0x31, 0x2c, 0x9a, 0xbb, 0x96, 0xdc, 0x93, 0xfd, 0xfe, 0x6a, 0xa8,
+	0x96, 0xeb, 0x10, 0xa7, 0x62, 0x15, 0xa7, 0x63, 0x29, 0xc0, 0x67, 0x6e, 0x96, 0xce, 0xfe, 0x59,
+	0x80, 0xfe, 0x73, 0x8b, 0xfe, 0xef, 0x3b, 0x25, 0x2c, 0xc1, 0x6e, 0xde, 0x2c, 0x55, 0x2c, 0x31,
+	0xc0, 0x9d, 0xaa, 0x98, 0xdc, 0x93, 0xfe, 0xfe, 0x7a, 0xea, 0x93, 0xfc, 0xa1, 0x96, 0xaa, 0x50,
+	0xa9, 0x42, 0xa3, 0x75, 0xa0, 0xa7, 0xc0, 0xa1, 0x79, 0x99, 0xad, 0xfe, 0x71, 0xe1, 0x9b, 0x7e,
+	0xa0, 0x6a, 0x5b, 0xab, 0x43, 0xfe, 0xce, 0x17, 0xad, 0x12, 0x31, 0xfd, 0xfd, 0xca, 0x2c, 0xc0,
+	0x31, 0xc0, 0x2c, 0xc0, 0x31, 0x1d, 0xc0, 0x31, 0xc3, 0x2c, 0xc0, 0x31, 0xc1, 0x65, 0x2c, 0x51,
+	0xfe, 0xad, 0x54, 0xfe, 0x4a, 0x49, 0x98, 0xcb, 0xa2, 0x77, 0x24, 0xc4, 0x6e, 0xc5, 0x24, 0xc0,
+	0x7a, 0xc2, 0x6e, 0x1d, 0xc1, 0x6e, 0x2c, 0xc0, 0x1d, 0x2c, 0xa4, 0x66, 0x2c, 0x51, 0x31, 0x1d,
+	0x24, 0xcb, 0x6b, 0x27, 0x1d, 0x7a, 0xc0, 0x27, 0x18, 0xa1, 0x97, 0x60, 0xa4, 0x83, 0xfe, 0xab,
+	0x66, 0xa8, 0x62, 0x11, 0xa2, 0x66, 0x5b, 0x97, 0xae, 0xfe, 0x59, 0xc0, 0x9d, 0x8c, 0xa8, 0x36,
+	0xfe, 0xad, 0x33, 0xaf, 0x01, 0xa7, 0x45, 0x69, 0x56, 0x31, 0xdb, 0x59, 0x22, 0x9d, 0xaa, 0x96,
+	0xec, 0xfe, 0x7b, 0x8d, 0xfe, 0x51, 0xe5, 0x9b, 0xca, 0x74, 0xaa, 0x51, 0xac, 0x30, 0x38, 0x50,
+	0x69, 0xc0, 0x7f, 0x96, 0xec, 0x99, 0xcf, 0xfe, 0xec, 0x24, 0xc0, 0x42, 0xa2, 0x59, 0xfe, 0x92,
+	0xe5, 0xfe, 0x41, 0x00, 0x3a, 0xfe, 0xf7, 0xbe, 0x31, 0x66, 0x66, 0xc0, 0x31, 0xc0, 0x2a, 0x31,
+	0xcb, 0x2c, 0x31, 0x9c, 0xba, 0xa2, 0x77, 0xfe, 0xa5, 0x13, 0xfe, 0x39, 0x85, 0xfe, 0x72, 0x84,
+	0xfe, 0xbc, 0x49, 0x99, 0xdd, 0xfe, 0x61, 0x82, 0xa2, 0x49, 0xfe, 0xe6, 0xfb, 0x31, 0x69, 0x31,
+	0xc0, 0x56, 0x2c, 0x2a, 0x31, 0xcc, 0x9d, 0x99, 0x31, 0x65, 0x21, 0xfe, 0x49, 0xa3, 0x9e, 0xc7,
+	0xfe, 0xb3, 0x65, 0xa9, 0x41, 0x9c, 0xa9, 0xa2, 0x69, 0xfe, 0x92, 0xa3, 0xfe, 0x51, 0x00, 0x56,
+	0xa6, 0x52, 0xfe, 0xab, 0x65, 0xa7, 0x73, 0x9e, 0xb7, 0x6f, 0x4f, 0x9a, 0x9d, 0xfe, 0x62, 0x01,
+	0x99, 0x9e, 0xa7, 0x46, 0xfe, 0x94, 0x4f, 0xfe, 0xde, 0x99, 0xa8, 0x44, 0xa2, 0x68, 0x6e, 0xc2,
+	0x2c, 0x31, 0xda, 0x2c, 0x9c, 0xba, 0x93, 0xee, 0xfe, 0x6b, 0x0b, 0x95, 0xfc, 0x19, 0x65, 0xa6,
+	0x73, 0xab, 0x31, 0xa6, 0x73, 0x16, 0x12, 0x7a, 0x5b, 0xa1, 0x79, 0x5b, 0xfe, 0x92, 0x83, 0xfe,
+	0x49, 0x20, 0xfe, 0x94, 0x6f, 0xfe, 0xff, 0xbc, 0x57, 0x31, 0x66, 0x27, 0x31, 0xde, 0x2c, 0x31,
+	0x2c, 0x20, 0x9c, 0xba, 0xfe, 0xbd, 0x55, 0xfe, 0x62, 0x69, 0x98, 0xdb, 0x9a, 0xca, 0xa7, 0x62,
+	0xfe, 0xb3, 0xa7, 0x1f, 0x0f, 0x7e, 0x6f, 0x67, 0x9c, 0x9b, 0xfe, 0x79, 0xe0, 0xfe, 0x40, 0xe0,
+	0xa1, 0x5a, 0xa1, 0x69, 0xa2, 0x67, 0xfe, 0x84, 0x10, 0x07, 0xa4, 0x55, 0x31, 0x2c, 0x31, 0xfd,
+	0xfd, 0xdc, 0x2c, 0xc0, 0x1d, 0x93, 0xff, 0xfe, 0x6b, 0x6d, 0xfe, 0x31, 0x86, 0x51, 0xc0, 0x38,
+	0x24, 0x51, 0x24, 0x6e, 0x65, 0xc1, 0x24, 0x29, 0x24, 0xcc, 0x7e, 0x29, 0x1d, 0xc1, 0x2c, 0xc0,
+	0x24, 0xca, 0x7a, 0xc1, 0x24, 0x29, 0xc1, 0x27, 0x64, 0x79, 0x79, 0xa3, 0x86, 0xad, 0x20, 0xaa,
+	0x61, 0x9d, 0xc5, 0x6b, 0xa1, 0x69, 0x9c, 0x8b, 0xfe, 0x7a, 0x01, 0x0b, 0x46, 0xad, 0x03, 0xfe,
+	0xad, 0x32, 0xad, 0x12, 0xa7, 0x45, 0xa2, 0x67, 0x66, 0x25, 0x22, 0x66, 0x22, 0x7b, 0x31, 0x2c,
+	0xc2, 0x25, 0xc1, 0x2c, 0x31, 0xc3, 0x2c, 0x65, 0x2c, 0xc0, 0x31, 0x2c, 0xc0, 0x1d, 0x9a, 0xba,
+	0xfe, 0xad, 0x33, 0xfe, 0x6b, 0x0a, 0x95, 0xfc, 0x9c, 0xb9, 0xa1, 0x97, 0xa8, 0x61, 0xab, 0x41,
+	0xa4, 0x75, 0x19, 0x75, 0x0d, 0xa3, 0x48, 0x39, 0x97, 0xde, 0xfe, 0x79, 0x40, 0xfe, 0xb2, 0xc1,
+	0x15, 0x69, 0xa2, 0x68, 0x9b, 0x9f, 0xfe, 0x69, 0xc2, 0x9f, 0x5b, 0xfe, 0xb5, 0x73, 0xfe, 0xf7,
+	0xfd, 0xa0, 0x9a, 0x2c, 0xc1, 0x31, 0xcf, 0x9c, 0xba, 0xa4, 0x55, 0x98, 0xeb, 0xfe, 0x6a, 0xc9,
+	0x95, 0xfd, 0xfe, 0x93, 0x06, 0xa9, 0x53, 0x98, 0xad, 0xfe, 0x49, 0x62, 0xfe, 0x83, 0xad, 0xfe,
+	0xef, 0x5c, 0x31, 0x65, 0xc1, 0x2c, 0xc0, 0x31, 0xc6, 0x2c, 0xc4, 0x5e, 0x55, 0x66, 0xa0, 0xa8,
+	0xfe, 0xa4, 0xb1, 0xfe, 0x49, 0x20, 0xa9, 0x61, 0xfe, 0xcc, 0x05, 0x7e, 0xa2, 0x67, 0x9f, 0x6b,
+	0xfe, 0x61, 0xc1, 0x9b, 0x8d, 0xc0, 0x65, 0xa7, 0x63, 0xac, 0x50, 0xa7, 0x62, 0x79, 0x65, 0x1d,
+	0x9d, 0x8b, 0x97, 0xbe, 0x08, 0x00, 0xab, 0x14, 0xfe, 0x9c, 0x90, 0xfe, 0xd6, 0x99, 0xa9, 0x34,
+	0xc0, 0x7e, 0x6f, 0x1d, 0x31, 0xc0, 0x20, 0x69, 0x25, 0x2a, 0x31, 0xc8, 0x66, 0x25, 0x31, 0xc1,
+	0x25, 0xc0, 0x31, 0x2c, 0x51, 0x0c, 0x97, 0xdc, 0xfe, 0x9c, 0x70, 0xfe, 0x62, 0x68, 0x97, 0xdc,
+	0x65, 0xa0, 0xc6, 0xa6, 0x82, 0xaa, 0x22, 0xa6, 0x54, 0xa4, 0x65, 0x65, 0x15, 0x9e, 0xa7, 0x7f,
+	0x5a, 0xa3, 0x5a, 0x9c, 0x7c, 0xfe, 0x61, 0xa0, 0xa4, 0x39, 0xfe, 0xc5, 0xf6, 0xaf, 0x01, 0xc0,
+	0x20, 0xc0, 0xa2, 0x67, 0x20, 0x25, 0xc2, 0x31, 0xc3, 0x2c, 0xc1, 0x25, 0xc3, 0x2c, 0x31, 0x2a,
+	0xc1, 0x2c, 0x31, 0xc0, 0x25, 0x2c, 0xc0, 0x66, 0x20, 0xc0, 0x66, 0x9c, 0xa9, 0x98, 0xcb, 0x93,
+	0xfe, 0xfe, 0x62, 0x47, 0x95, 0xed, 0xa1, 0x97, 0xa6, 0x63, 0xa8, 0x53, 0xa9, 0x51, 0x29, 0x78,
+	0x79, 0x46, 0xa1, 0x5c, 0x9c, 0x9b, 0xfe, 0x6a, 0x23, 0x96, 0xdf, 0xa2, 0x58, 0xa2, 0x69, 0x5b,
+	0xfe, 0x63, 0x4d, 0xfe, 0xce, 0x9a, 0xab, 0x32, 0xc1, 0x2a, 0x31, 0xfd, 0xfd, 0xdd, 0x66, 0x31,
+	0x2c, 0x96, 0xdd, 0xfe, 0x8c, 0x71, 0xfe, 0x52, 0x8a, 0x97, 0xcc, 0x66, 0xa2, 0x77, 0x6e, 0x24,
+	0x69, 0x7f, 0x24, 0xc0, 0x29, 0x24, 0x1d, 0x24, 0xcb, 0x2c, 0x29, 0x1d, 0xc1, 0x2c, 0xc0, 0x24,
+	0xca, 0x79, 0xc1, 0x24, 0x29, 0xc1, 0x1d, 0x20, 0x79, 0x10, 0x13, 0xa7, 0x53, 0xa8, 0x61, 0xa7,
+	0x91, 0x34, 0x41, 0x6b, 0x9d, 0x8a, 0x99, 0xbc, 0x99, 0xad, 0x9b, 0x9c, 0xa1, 0x79, 0xa9, 0x25,
+	0xab, 0x24, 0xaa, 0x23, 0xa7, 0x45, 0xa7, 0x44, 0xa3, 0x66, 0xa2, 0x78, 0x31, 0x66, 0x1d, 0x2c,
+	0xc1, 0x27, 0x69, 0x25, 0x2c, 0x56, 0x2c, 0xc4, 0x25, 0x1d, 0x9d, 0xa9, 0x9b, 0xbb, 0x99, 0xcb,
+	0x9b, 0xab, 0x97, 0xdb, 0x95, 0xed, 0x98, 0xdb, 0x60, 0xa4, 0x74, 0xa6, 0x74, 0xa6, 0x64, 0xa4,
+	0x75, 0xa3, 0x76, 0x7a, 0x59, 0x62, 0x0d, 0x9a, 0x8c, 0x01, 0xfe, 0x58, 0xe0, 0xa3, 0x85, 0xfe,
+	0xc3, 0xa6, 0xa5, 0x72, 0x55, 0xa2, 0x68, 0xfe, 0xab, 0x25, 0x0b, 0xfe, 0x72, 0xe9, 0xfe, 0xe6,
+	0xf9, 0xa7, 0x35, 0x25, 0xc5, 0x6f, 0xc2, 0x25, 0xc0, 0x6e, 0xc0, 0x31, 0xc4, 0x25, 0x69, 0xfe,
+	0xbd, 0x73, 0xfe, 0x41, 0x83, 0xa1, 0x97, 0xfe, 0xb4, 0x0a, 0xa3, 0x76, 0xfe, 0x7a, 0x65, 0x9b,
+	0x8c, 0xfe, 0xb5, 0x74, 0x31, 0x20, 0x6e, 0xc0, 0x1e, 0x25, 0x6b, 0x5a, 0x31, 0xc2, 0x2c, 0xc1,
+	0x31, 0xc5, 0x29, 0x61, 0x9b, 0xca, 0xfe, 0x8b, 0xad, 0x3e, 0xfe, 0x92, 0xa3, 0x22, 0xc0, 0x5b,
+	0x99, 0xae, 0x19, 0x9d, 0x8d, 0xa2, 0x76, 0x65, 0x79, 0xa6, 0x73, 0xab, 0x40, 0xa6, 0x74, 0x7d,
+	0x79, 0xa0, 0x7a, 0x1c, 0x2d, 0x97, 0xce, 0x9a, 0xac, 0x9f, 0x6a, 0xa8, 0x35, 0xae, 0x11, 0xa9,
+	0x34, 0xa6, 0x55, 0xa6, 0x45, 0xa4, 0x67, 0xa2, 0x77, 0x25, 0x6f, 0xc1, 0x25, 0x20, 0x6b, 0x2c,
+	0xc0, 0x20, 0xc2, 0x25, 0xc4, 0x5a, 0x11, 0x9d, 0x99, 0x9b, 0xbb, 0x99, 0xcb, 0x99, 0xcb, 0xfe,
+	0x7b, 0x2a, 0x97, 0xec, 0x9b, 0xb9, 0x7a, 0xa4, 0x75, 0xa5, 0x65, 0xa6, 0x73, 0xa4, 0x93, 0xa2,
+	0x68, 0x5e, 0x7e, 0x12, 0x65, 0xa2, 0x96, 0x66, 0x5b, 0xa0, 0x6b, 0x98, 0x9f, 0x1c, 0xac, 0x04,
+	0xfe, 0xe6, 0xfb, 0xa7, 0x44, 0x20, 0xc0, 0x25, 0xc1, 0x2c, 0x25, 0xc9, 0x9d, 0x9a, 0x3d, 0xc1,
+	0x66, 0xc1, 0x3d, 0xc1, 0x38, 0xc1, 0x55, 0x61, 0x01, 0x9c, 0xba, 0x9c, 0xaa, 0x9a, 0xbb, 0x9c,
+	0xa9, 0x95, 0xfd, 0x97, 0xdc, 0x9c, 0xb9, 0xa3, 0x85, 0xa4, 0x75, 0xa4, 0x75, 0xa7, 0x54, 0xa4,
+	0x75, 0xa2, 0x86, 0x69, 0xc0, 0x69, 0x43, 0x9b, 0x7e, 0xfe, 0x59, 0xc2, 0x0c, 0xa2, 0x68, 0x56,
+	0xa1, 0x69, 0xac, 0x13, 0xfe, 0xbd, 0xf8, 0xaf, 0x00, 0xc0, 0x7e, 0xc0, 0x2a, 0x31, 0xfd, 0xfd,
+	0xdb, 0x66, 0x31, 0xc2, 0x2c, 0x9c, 0xaa, 0x94, 0xee, 0xfe, 0x6b, 0x6d, 0x92, 0xff, 0x9c, 0xaa,
+	0x7f, 0x6e, 0xc0, 0x24, 0xc0, 0x29, 0x7a, 0x24, 0x69, 0x24, 0xcb, 0x2c, 0x29, 0x1d, 0xc1, 0x2c,
+	0xc0, 0x24, 0xca, 0x79, 0xc2, 0x29, 0xc1, 0x24, 0x20, 0xc0, 0x1c, 0x60, 0x7e, 0xa4, 0x84, 0xfe,
+	0x9a, 0xe2, 0xaa, 0x43, 0xa2, 0x76, 0x65, 0x55, 0xc0, 0x9d, 0x9b, 0x9b, 0xac, 0x10, 0x99, 0xbe,
+	0x9f, 0x7b, 0xa4, 0x68, 0xa5, 0x45, 0xa9, 0x12, 0xa6, 0x55, 0xa9, 0x34, 0xa8, 0x44, 0xa5, 0x56,
+	0xa3, 0x77, 0xa2, 0x67, 0x7f, 0x6e, 0x31, 0xc0, 0x5a, 0xc0, 0x31, 0x2e, 0x29, 0x65, 0x55, 0x61,
+	0x9c, 0xaa, 0x9a, 0xbb, 0x98, 0xcb, 0x97, 0xed, 0x99, 0xbb, 0x9a, 0xbb, 0x9b, 0xba, 0x70, 0x7d,
+	0xa6, 0x64, 0xa7, 0x63, 0x38, 0xa4, 0x74, 0x7e, 0xc0, 0xa2, 0x68, 0x6f, 0x9d, 0x8a, 0x19, 0x98,
+	0xbd, 0x9a, 0x8c, 0x66, 0x72, 0xa9, 0x62, 0xfe, 0xcc, 0x08, 0xa2, 0x84, 0xc0, 0x5b, 0xfe, 0x8a,
+	0xa4, 0x03, 0xfe, 0x62, 0x88, 0xfe, 0x9c, 0x90, 0x45, 0xa2, 0x78, 0xc5, 0x7f, 0x6e, 0xa2, 0x77,
+	0x7f, 0xa2, 0x67, 0x7a, 0xa3, 0x66, 0xc0, 0x6b, 0x6e, 0x6b, 0xc1, 0x7d, 0x66, 0x65, 0xfe, 0x83,
+	0xac, 0xfe, 0x39, 0x22, 0xac, 0x20, 0xac, 0x51, 0x9d, 0xa9, 0xfe, 0x61, 0xe3, 0x9d, 0x7b, 0xfe,
+	0x7b, 0xad, 0x35, 0x51, 0x26, 0x7a, 0xc0, 0x26, 0x6b, 0xc0, 0x6e, 0x35, 0xa2, 0x67, 0x7f, 0xa2,
+	0x76, 0x31, 0x6e, 0x16, 0xc1, 0x7a, 0xc2, 0x6b, 0x9d, 0xba, 0x9a, 0xca, 0xfe, 0x6a, 0x47, 0x96,
+	0xfb, 0xfe, 0xb3, 0x87, 0xa5, 0x73, 0x6e, 0x42, 0xfe, 0x82, 0x63, 0xfe, 0x41, 0x01, 0xa1, 0x5b,
+	0x6e, 0x69, 0x1c, 0x9f, 0xb6, 0xa3, 0x85, 0xaa, 0x41, 0xab, 0x41, 0xa1, 0x97, 0x29, 0xc0, 0x6b,
+	0x9d, 0x8a, 0x9b, 0xab, 0x9a, 0x9d, 0x9a, 0x9d, 0x9c, 0xaa, 0xa3, 0x67, 0xa6, 0x45, 0xa7, 0x45,
+	0xa6, 0x46, 0xaa, 0x33, 0xa6, 0x46, 0xa6, 0x55, 0xa4, 0x67, 0xa3, 0x66, 0xa2, 0x77, 0x76, 0xc1,
+	0x6e, 0xc3, 0x65, 0x65, 0x56, 0x55, 0x51, 0x9b, 0xbb, 0x98, 0xbc, 0x98, 0xdc, 0x05, 0x99, 0xcb,
+	0x9b, 0xc9, 0x60, 0x75, 0xa0, 0xa7, 0xa6, 0x63, 0xa7, 0x64, 0xa4, 0x65, 0xa2, 0x86, 0xa2, 0x86,
+	0x59, 0x6f, 0x6f, 0x5b, 0x9e, 0xa7, 0x12, 0x75, 0x66, 0xa1, 0x89, 0x9f, 0x6c, 0xfe, 0x8a, 0x65,
+	0x97, 0xaf, 0xfe, 0x7b, 0x2c, 0xfe, 0xbd, 0xf7, 0xc1, 0x51, 0x51, 0x9d, 0xa9, 0x9d, 0x9a, 0x65,
+	0xc7, 0x5a, 0xc1, 0x9d, 0xa9, 0x56, 0x65, 0x66, 0x5a, 0xc0, 0x66, 0x65, 0xc1, 0x65, 0xc1, 0x9d,
+	0xa9, 0x51, 0x00, 0x50, 0x9d, 0x9a, 0x9d, 0xa9, 0x61, 0xa1, 0xa7, 0xa3, 0x75, 0x38, 0xa5, 0x74,
+	0xa4, 0x74, 0xa3, 0x75, 0xa2, 0x76, 0x66, 0x0f, 0xa1, 0x79, 0xa1, 0x79, 0x9b, 0xab, 0x9b, 0x9c,
+	0xfe, 0x59, 0xa2, 0x9b, 0xab, 0x6f, 0x10, 0x46, 0xab, 0x24, 0xfe, 0xad, 0x55, 0xfe, 0xf7, 0xbe,
+	0x31, 0x56, 0x31, 0x69, 0x31, 0xfd, 0xfd, 0xdd, 0x2c, 0xc0, 0x31, 0xc0, 0x1d, 0x2c, 0x1d, 0x95,
+	0xee, 0xfe, 0x84, 0x30, 0xfe, 0x42, 0x28, 0x98, 0xcc, 0xa2, 0x77, 0xc0, 0x65, 0xc1, 0x29, 0xc0,
+	0x1d, 0x6b, 0xcb, 0x7e, 0x24, 0xc0, 0x1d, 0x24, 0x29, 0xc0, 0x24, 0xca, 0x79, 0xc2, 0x24, 0x29,
+	0xc0, 0x2c, 0x20, 0xc0, 0x69, 0x10, 0xc0, 0x0c, 0xa2, 0x95, 0xa8, 0x52, 0xab, 0x31, 0xa6, 0x64,
+	0x22, 0x75, 0xc0, 0x6b, 0x9d, 0x8b, 0x9a, 0xbd, 0x9c, 0x9c, 0x9b, 0xac, 0x9a, 0x9c, 0x48, 0x6f,
+	0xa2, 0x78, 0xa5, 0x55, 0xa5, 0x56, 0xa4, 0x67, 0xa5, 0x56, 0xa3, 0x77, 0xa4, 0x56, 0xa4, 0x56,
+	0xa2, 0x77, 0x7e, 0xc1, 0x9c, 0xaa, 0x9c, 0xaa, 0x9c, 0xa9, 0x9c, 0xba, 0x9d, 0x99, 0x9a, 0xcb,
+	0x9a, 0xcb, 0x0c, 0x51, 0xa3, 0x76, 0xa4, 0x65, 0x7e, 0xa8, 0x62, 0xa4, 0x75, 0xa4, 0x76, 0xa2,
+	0x86, 0x69, 0xc0, 0x6f, 0x6b, 0x46, 0x9a, 0x9c, 0x97, 0xce, 0x9a, 0x9c, 0x9d, 0x9b, 0xa3, 0x57,
+	0x61, 0x9f, 0xb8, 0xfe, 0x92, 0xc5, 0xfe, 0xdc, 0x69, 0x9e, 0xa6, 0xa2, 0x77, 0x9c, 0x9b, 0xfe,
+	0x79, 0xe0, 0xfe, 0x48, 0xe0, 0x5f, 0xa2, 0x66, 0x5a, 0x6f, 0xc4, 0x7a, 0x6e, 0xc1, 0x6f, 0xc0,
+	0x7a, 0xc1, 0x6f, 0xc0, 0x6e, 0x6b, 0x02, 0x3d, 0x31, 0xa2, 0x76, 0x1e, 0x61, 0xfe, 0x8b, 0x26,
+	0xac, 0x41, 0x94, 0xfe, 0xfe, 0x51, 0x40, 0x42, 0x22, 0x15, 0x6f, 0x1d, 0xc2, 0x21, 0x26, 0x7a,
+	0x22, 0x29, 0xc0, 0x2e, 0x31, 0xc0, 0x3d, 0xc2, 0x02, 0xc0, 0x62, 0x7a, 0x7f, 0x65, 0x99, 0xdb,
+	0xa5, 0x73, 0xfe, 0xcb, 0xe8, 0xa2, 0x74, 0x6f, 0x9c, 0x9b, 0xfe, 0x69, 0xa1, 0x9b, 0x8e, 0xa1,
+	0x5a, 0xa2, 0x67, 0x27, 0x69, 0x15, 0x74, 0xa3, 0x85, 0xa8, 0x62, 0xac, 0x31, 0x7e, 0x65, 0xc0,
+	0x7e, 0xa2, 0x77, 0x19, 0x9b, 0x9c, 0x9c, 0xaa, 0x9b, 0xab, 0x9b, 0xac, 0x0d, 0x42, 0xa2, 0x67,
+	0x02, 0xa5, 0x56, 0xa4, 0x67, 0xa4, 0x56, 0xa4, 0x67, 0xa6, 0x66, 0xa4, 0x77, 0x5e, 0x69, 0xc1,
+	0x7a, 0xa3, 0x55, 0x9c, 0xba, 0x9b, 0xaa, 0x3a, 0x9b, 0xbb, 0x9d, 0x99, 0x36, 0x9a, 0xcb, 0x9c,
+	0xba, 0x64, 0xa2, 0x76, 0xa3, 0x86, 0xa3, 0x85, 0xa8, 0x53, 0xa4, 0x75, 0x1d, 0xa1, 0x97, 0x65,
+	0x69, 0x28, 0x29, 0x21, 0xc0, 0x9c, 0x9a, 0x9b, 0xb9, 0xa3, 0x86, 0x15, 0x66, 0xa2, 0x78, 0x9b,
+	0x9d, 0xfe, 0x71, 0x80, 0x9a, 0x9e, 0xa6, 0x35, 0x4f, 0xc0, 0xa3, 0x76, 0x02, 0x35, 0x51, 0xc2,
+	0x7e, 0xc2, 0x59, 0xc1, 0x66, 0xc1, 0x51, 0xc0, 0x66, 0xc3, 0xa2, 0x77, 0xc0, 0x79, 0xc1, 0x69,
+	0x05, 0x7e, 0xa2, 0x76, 0xa2, 0x77, 0xa2, 0x87, 0xa4, 0x66, 0xa4, 0x75, 0xa3, 0x86, 0x14, 0xa3,
+	0x76, 0xa1, 0x95, 0x69, 0x64, 0x66, 0x5b, 0xa1, 0x69, 0x5b, 0x9b, 0x9d, 0x95, 0xdf, 0x97, 0xbe,
+	0x42, 0xa4, 0x57, 0x56, 0x9c, 0x9a, 0xaa, 0x34, 0xfe, 0xa5, 0x13, 0xfe, 0xe7, 0x5c, 0xa3, 0x77,
+	0xc0, 0xa2, 0x77, 0xfd, 0xfd, 0xe5, 0x66, 0x31, 0xc0, 0x9a, 0xbb, 0xfe, 0x9c, 0xf3, 0xfe, 0x52,
+	0xaa, 0x96, 0xdd, 0x51, 0x7e, 0xc1, 0x6b, 0x7e, 0x24, 0xdf, 0x20, 0xc2, 0x24, 0x29, 0xc0, 0x7f,
+	0x2c, 0x1d, 0x76, 0x6d, 0x66, 0x79, 0x07, 0xa2, 0x75, 0xa6, 0x74, 0xab, 0x41, 0xa6, 0x63, 0xa1,
+	0x97, 0x28, 0x51, 0xc0, 0x2c, 0x53, 0x9d, 0x9a, 0x42, 0x11, 0x9c, 0xab, 0x9b, 0xaa, 0x9b, 0xbc,
+	0x03, 0xc0, 0x00, 0xc1, 0x0c, 0xc0, 0x6e, 0xc1, 0x51, 0x56, 0x7a, 0x00, 0xc0, 0xa2, 0x86, 0xa2,
+	0x76, 0x39, 0xa6, 0x65, 0xa6, 0x55, 0xa4, 0x65, 0x7e, 0xa1, 0xa6, 0x2c, 0x69, 0x56, 0x2c, 0x24,
+	0x42, 0x9b, 0x9b, 0x97, 0xbe, 0x9b, 0x9c, 0x9d, 0x8b, 0x5b, 0xa2, 0x68, 0xa2, 0x67, 0x0d, 0xa1,
+	0xb6, 0xfe, 0xa3, 0x05, 0xfe, 0xe4, 0x67, 0x9d, 0xb7, 0x6f, 0x9b, 0x9c, 0xfe, 0x92, 0x20, 0x9e,
+	0x7a, 0xa0, 0x7a, 0x08, 0x69, 0x42, 0xc4, 0x69, 0x66, 0x2a, 0x31, 0x6e, 0x7e, 0xc0, 0x31, 0xc1,
+	0x36, 0x6b, 0xc0, 0x36, 0x31, 0x25, 0x66, 0xa2, 0x76, 0xa5, 0x65, 0xaa, 0x42, 0xa5, 0x75, 0x97,
+	0xdc, 0x97, 0xbe, 0x46, 0x05, 0x36, 0xc0, 0x31, 0x2a, 0xc1, 0x31, 0x2e, 0x65, 0x25, 0x31, 0x36,
+	0x39, 0x3e, 0xc0, 0x36, 0xc2, 0x39, 0xc0, 0x52, 0x7a, 0x66, 0x7e, 0x7d, 0xa7, 0x63, 0xad, 0x10,
+	0x79, 0x29, 0x99, 0xac, 0x10, 0x9e, 0x7c, 0xa0, 0x7b, 0x5a, 0xa2, 0x66, 0x27, 0x69, 0x79, 0x11,
+	0x9d, 0xba, 0xfe, 0x72, 0x21, 0xa9, 0x53, 0xa7, 0x63, 0xa1, 0x97, 0x25, 0x60, 0xa1, 0x79, 0xa2,
+	0x67, 0x52, 0x9d, 0x9a, 0x3d, 0x9c, 0xaa, 0x9b, 0x9c, 0x39, 0x56, 0x9d, 0x9a, 0x42, 0xc0, 0x11,
+	0x18, 0x6b, 0xc0, 0x66, 0x59, 0x7a, 0x18, 0x6e, 0x55, 0x51, 0x66, 0x3a, 0xc0, 0xa2, 0x86, 0xa3,
+	0x96, 0xa5, 0x54, 0xa5, 0x76, 0xa6, 0x54, 0xa3, 0x86, 0x30, 0x64, 0x7a, 0x55, 0x65, 0xa2, 0x77,
+	0x7e, 0x24, 0x9d, 0x8c, 0x9b, 0xab, 0x9c, 0x99, 0x2d, 0x9d, 0xbb, 0xfe, 0xa2, 0xc0, 0x19, 0x75,
+	0x7e, 0x9b, 0x9d, 0xfe, 0x81, 0xe0, 0x9d, 0x8b, 0xa2, 0x67, 0x5a, 0x2c, 0xa2, 0x67, 0x31, 0x55,
+	0x31, 0xc2, 0x36, 0x3d, 0x7e, 0xc0, 0x12, 0xc0, 0x56, 0xc2, 0xa3, 0x76, 0xc2, 0x6b, 0x6e, 0x7a,
+	0xa3, 0x77, 0xc0, 0x69, 0xc1, 0x79, 0x7f, 0xa3, 0x65, 0xa2, 0x77, 0x7e, 0x7f, 0xa3, 0x66, 0xa2,
+	0x86, 0x9d, 0xba, 0x25, 0x9d, 0xb9, 0x65, 0x09, 0xc0, 0x21, 0x25, 0x0a, 0x98, 0xbe, 0x31, 0x9b,
+	0x9c, 0x5b, 0xa0, 0x8a, 0x5a, 0x51, 0xa8, 0x34, 0xfe, 0x9c, 0xd2, 0xfe, 0xe7, 0x3c, 0xa6, 0x54,
+	0x56, 0x7f, 0xc0, 0x66, 0x31, 0xfd, 0xfd, 0xe0, 0x2c, 0xc0, 0x31, 0xc0, 0x2c, 0x31, 0xc0, 0x9b,
+	0xbb, 0x96, 0xdd, 0x91, 0xff, 0xfe, 0x4a, 0x48, 0x9a, 0xbb, 0x66, 0x55, 0xc0, 0x6b, 0x6e, 0x24,
+	0xcb, 0x1d, 0x24, 0x29, 0x2c, 0x24, 0xcd, 0x79, 0xc2, 0x24, 0x29, 0xc3, 0x27, 0x6d, 0x20, 0x14,
+	0x7b, 0x0b, 0x07, 0xa4, 0x85, 0xa5, 0x74, 0xa8, 0x63, 0xa6, 0x53, 0x7d, 0x7d, 0xc0, 0x69, 0x6e,
+	0xa2, 0x78, 0x57, 0x52, 0x9d, 0x99, 0x9d, 0xaa, 0x52, 0x5a, 0x9d, 0x9a, 0x55, 0x66, 0x56, 0x55,
+	0x66, 0xc0, 0x11, 0x6f, 0x7e, 0xa2, 0x77, 0xa3, 0x76, 0x7f, 0xa2, 0x76, 0x7f, 0xa2, 0x76, 0xa2,
+	0x87, 0x6e, 0x24, 0x69, 0x75, 0x6f, 0x6f, 0x42, 0x9a, 0xac, 0x9c, 0x8b, 0x9b, 0xac, 0x9b, 0x9b,
+	0x9b, 0xac, 0xa2, 0x57, 0xa2, 0x78, 0x5b, 0x66, 0x5a, 0x09, 0x34, 0xfe, 0xbb, 0x64, 0xa8, 0x61,
+	0x9c, 0xc8, 0xa3, 0x66, 0xa0, 0x7a, 0x9e, 0x7a, 0xa0, 0x8a, 0x57, 0x7e, 0x50, 0x6f, 0x6e, 0xc4,
+	0x10, 0xc0, 0x69, 0xc0, 0x5a, 0xc1, 0x0d, 0xc4, 0x15, 0xc0, 0x09, 0x65, 0x7a, 0x19, 0x79, 0x9d,
+	0xaa, 0x08, 0x5f, 0x0d, 0xc2, 0x10, 0x09, 0x0d, 0xc1, 0x7e, 0x10, 0xc0, 0x09, 0xc0, 0x06, 0xc5,
+	0x09, 0x15, 0x7e, 0x10, 0x01, 0x09, 0xa2, 0x75, 0x7e, 0x6e, 0x57, 0xfe, 0x9a, 0xe2, 0xfe, 0x49,
+	0x00, 0x4f, 0xa0, 0x7b, 0x5b, 0x6e, 0x7f, 0x24, 0x69, 0x74, 0x09, 0x79, 0xa5, 0x74, 0xa6, 0x73,
+	0xa8, 0x53, 0xa5, 0x85, 0x79, 0x64, 0xc1, 0xa2, 0x67, 0x7f, 0x42, 0x04, 0x6e, 0x52, 0x41, 0x9d,
+	0x9a, 0x51, 0x2d, 0x42, 0x52, 0x66, 0x5a, 0x65, 0xc0, 0x6e, 0xa2, 0x77, 0x1d, 0xa2, 0x67, 0xa2,
+	0x77, 0xa2, 0x77, 0xa3, 0x76, 0xa1, 0x97, 0xa1, 0x97, 0xa2, 0x76, 0x7f, 0x2c, 0xc1, 0x6e, 0xc0,
+	0x5b, 0x56, 0x9c, 0x9a, 0x9b, 0xbb, 0x9c, 0x9c, 0x9a, 0xae, 0x9c, 0xaa, 0x55, 0x9d, 0xaa, 0xa3,
+	0x85, 0xfe, 0xb3, 0x44, 0x21, 0x64, 0x7a, 0x0e, 0x9c, 0x9b, 0xa3, 0x58, 0x06, 0x7b, 0x04, 0x6e,
+	0x10, 0xc0, 0x24, 0x10, 0xc4, 0x6e, 0xa2, 0x76, 0xc1, 0x66, 0xc8, 0x2c, 0x69, 0xc2, 0x7a, 0x21,
+	0x19, 0x79, 0x6e, 0x15, 0xc0, 0x55, 0x15, 0x29, 0x21, 0x66, 0x28, 0x52, 0x9a, 0xac, 0x9a, 0x9d,
+	0x3c, 0x9c, 0x8b, 0x9e, 0x7a, 0x5f, 0xa2, 0x79, 0x52, 0xc0, 0xab, 0x23, 0xfe, 0xad, 0x54, 0xaf,
+	0x01, 0xa5, 0x55, 0xc0, 0x7f, 0xc0, 0x66, 0x31, 0x2c, 0x31, 0xfd, 0xfd, 0xe8, 0x99, 0xcc, 0xfe,
+	0x9c, 0xd2, 0xfe, 0x42, 0x28, 0x99, 0xcc, 0x6e, 0x61, 0x24, 0x7e, 0x24, 0xcd, 0x29, 0xc0, 0x24,
+	0xcd, 0x20, 0xc2, 0x24, 0x29, 0xc0, 0x24, 0x29, 0xc0, 0x2c, 0xc1, 0x55, 0x76, 0x65, 0x7a, 0x7e,
+	0x75, 0xa3, 0x85, 0xa8, 0x52, 0xa6, 0x53, 0x08, 0xa3, 0x65, 0xa2, 0x85, 0x69, 0x66, 0x6b, 0x19,
+	0xc0, 0x66, 0xc0, 0x6f, 0x55, 0x6b, 0x6e, 0xc0, 0x27, 0xc0, 0x5a, 0xc3, 0x1d, 0x56, 0x24, 0x6e,
+	0xc3, 0x24, 0x41, 0x9d, 0x9a, 0x9c, 0x9b, 0x9a, 0xac, 0x9a, 0xac, 0x05, 0x5b, 0x6b, 0x5f, 0x6f,
+	0x66, 0x55, 0x6f, 0x25, 0x09, 0x01, 0xfe, 0xc3, 0xc5, 0xa5, 0x82, 0x9d, 0xb8, 0x6f, 0x5b, 0x5b,
+	0xa1, 0x79, 0x66, 0x7a, 0xc0, 0x69, 0x5a, 0xc0, 0x14, 0xc0, 0x69, 0x14, 0x19, 0xc2, 0x1c, 0x19,
+	0x1c, 0xc0, 0x1e, 0x19, 0xc2, 0x14, 0x1c, 0x21, 0x65, 0xc0, 0x7a, 0x7e, 0x9d, 0x9a, 0x18, 0x6f,
+	0x1c, 0x25, 0x19, 0xc8, 0x1c, 0xc8, 0x15, 0x21, 0x1c, 0x12, 0x21, 0x69, 0x55, 0x5f, 0x43, 0xfe,
+	0x7a, 0x60, 0xfe, 0x49, 0x20, 0xa2, 0x48, 0x9f, 0x7c, 0x2c, 0x65, 0x1d, 0x6f, 0x1d, 0xc0, 0x7e,
+	0x74, 0x09, 0x08, 0xa5, 0x73, 0xa8, 0x63, 0xa6, 0x65, 0xa3, 0x84, 0x7e, 0x1c, 0xc0, 0x0d, 0x14,
+	0x1c, 0xc3, 0x19, 0x0d, 0x14, 0x5f, 0xc0, 0x66, 0x69, 0x18, 0x1d, 0xc0, 0x6e, 0xc0, 0x1d, 0x5a,
+	0x1d, 0xc0, 0x7e, 0x6e, 0x25, 0xc0, 0x1d, 0x57, 0x5a, 0x9d, 0x9b, 0x9d, 0x8a, 0x9b, 0xac, 0x99,
+	0xbc, 0x9c, 0x9b, 0x57, 0x67, 0x55, 0x13, 0x64, 0xa5, 0x74, 0x3d, 0xa5, 0x83, 0x0e, 0x0a, 0x5a,
+	0xc0, 0xa3, 0x57, 0x62, 0x76, 0x5a, 0x66, 0x18, 0x10, 0x15, 0x18, 0xc3, 0x15, 0xc0, 0x18, 0xc1,
+	0x15, 0xc1, 0x18, 0xc1, 0x15, 0x18, 0xc1, 0x65, 0x5a, 0xc2, 0x0e, 0x15, 0x09, 0xc0, 0x15, 0x7e,
+	0xc0, 0x15, 0x46, 0x7f, 0x5b, 0x52, 0x9c, 0x9c, 0x99, 0xad, 0x99, 0xbd, 0x9c, 0x8b, 0x41, 0xa1,
+	0x79, 0xa3, 0x56, 0x5a, 0x56, 0xa2, 0x79, 0xae, 0x11, 0xfe, 0xbd, 0xd7, 0xaf, 0x00, 0xa2, 0x77,
+	0x59, 0xc0, 0x7a, 0x56, 0x7a, 0x31, 0x62, 0x31, 0xfd, 0xfd, 0xe9, 0x96, 0xdd, 0xfe, 0x62, 0xeb,
+	0xfe, 0x21, 0x04, 0xa3, 0x76, 0x51, 0xc0, 0x6f, 0xdf, 0x20, 0xc2, 0x24, 0xc0, 0x29, 0xc5, 0x24,
+	0x7a, 0xc0, 0x66, 0x1b, 0x7a, 0x69, 0x13, 0xa3, 0x85, 0xa5, 0x63, 0xa5, 0x63, 0xa4, 0x74, 0xa4,
+	0x75, 0xa3, 0x76, 0x19, 0xc0, 0x28, 0xc0, 0x69, 0x66, 0x19, 0xc1, 0x76, 0xc2, 0x19, 0xc0, 0x6b,
+	0x6e, 0xc0, 0x56, 0x7f, 0x5f, 0x51, 0x51, 0x9d, 0xaa, 0x9d, 0x9a, 0x41, 0x9b, 0x8d, 0x9d, 0x9a,
+	0x9d, 0x8a, 0x05, 0x5b, 0x5f, 0x6b, 0x6b, 0x5a, 0xc3, 0x6e, 0xa0, 0xa5, 0xaa, 0x60, 0xfe, 0xc4,
+	0x26, 0x1a, 0x60, 0x0e, 0x1a, 0x5f, 0x66, 0xc0, 0x1c, 0xc0, 0x7e, 0xc5, 0x1c, 0xc5, 0x6e, 0xc5,
+	0x75, 0xc7, 0x1c, 0xc3, 0x15, 0xc0, 0x1c, 0xc0, 0x65, 0xc1, 0x15, 0xc0, 0x18, 0x15, 0x10, 0xc4,
+	0x69, 0xc1, 0x10, 0xc0, 0x5e, 0xc0, 0xa2, 0x58, 0x9b, 0x9c, 0xfe, 0x61, 0xa0, 0x9c, 0x7c, 0x19,
+	0xa0, 0x7a, 0x20, 0x19, 0x1d, 0x22, 0x5b, 0xc1, 0x29, 0x19, 0x75, 0x00, 0xa1, 0x97, 0xa4, 0x75,
+	0xa6, 0x63, 0xa5, 0x73, 0xa5, 0x66, 0xa4, 0x65, 0x7e, 0xc0, 0x28, 0x15, 0x66, 0x09, 0x7a, 0xc0,
+	0x7e, 0x0c, 0x59, 0x07, 0x02, 0x09, 0xc0, 0x0e, 0x10, 0x15, 0xc0, 0x1c, 0xc0, 0x66, 0x25, 0x6f,
+	0x55, 0x52, 0x9c, 0xaa, 0x9d, 0x9b, 0x42, 0x9a, 0xac, 0x9d, 0x8b, 0x9d, 0x8a, 0x9d, 0x9b, 0x5b,
+	0xa1, 0x69, 0xc0, 0x1b, 0x6e, 0x7a, 0x04, 0xa8, 0x62, 0xfe, 0xb3, 0xe7, 0x22, 0x12, 0xa0, 0xa6,
+	0xc0, 0x07, 0xc0, 0x6b, 0x9f, 0xb9, 0xd1, 0x59, 0xc5, 0x39, 0x6b, 0x05, 0xc0, 0x6b, 0x6e, 0x09,
+	0x6b, 0x6e, 0x1c, 0xc0, 0x55, 0x57, 0x3c, 0x9d, 0x8a, 0x9a, 0xbc, 0x9a, 0xad, 0x9d, 0x8b, 0x43,
+	0x46, 0xa1, 0x79, 0xa2, 0x67, 0x56, 0x24, 0xa3, 0x76, 0xa5, 0x56, 0xfe, 0x8c, 0x72, 0xaf, 0x00,
+	0xab, 0x32, 0xa2, 0x77, 0xc0, 0x59, 0xc0, 0x2a, 0x31, 0xfd, 0xfd, 0xed, 0x9b, 0xba, 0xfe, 0x7b,
+	0xae, 0xfe, 0x20, 0xe3, 0xa4, 0x66, 0x24, 0x18, 0xa3, 0x66, 0x24, 0xde, 0x79, 0xc3, 0x24, 0xc1,
+	0x29, 0xc3, 0x24, 0x20, 0xc0, 0x5a, 0xc2, 0x79, 0x69, 0x71, 0x7d, 0xa2, 0x96, 0xa5, 0x65, 0xa4,
+	0x75, 0xa4, 0x64, 0xa2, 0x77, 0xa2, 0x87, 0xa3, 0x66, 0xa2, 0x77, 0x7e, 0x35, 0xc1, 0x79, 0xc1,
+	0x6b, 0x41, 0x66, 0x5a, 0xc0, 0x56, 0x56, 0x9c, 0xab, 0x41, 0x9d, 0x9a, 0x9d, 0x99, 0x9c, 0xab,
+	0x9c, 0xab, 0x42, 0xa1, 0x49, 0x6f, 0xc0, 0x7e, 0xc0, 0x66, 0xc0, 0x20, 0xc0, 0x24, 0xc1, 0x29,
+	0x6f, 0xa2, 0x84, 0xa9, 0x61, 0xa9, 0x61, 0xa1, 0xa6, 0x61, 0xc1, 0x5e, 0xc1, 0x77, 0xc0, 0x65,
+	0xc1, 0x7e, 0xc0, 0x6e, 0x1c, 0x7e, 0xc4, 0x21, 0xc3, 0x24, 0xc6, 0x66, 0xc0, 0x24, 0xc2, 0x21,
+	0xc5, 0x7e, 0xc2, 0x7e, 0xc0, 0x38, 0x31, 0xc4, 0x7a, 0x66, 0xc1, 0x6b, 0x38, 0x5b, 0x5a, 0x96,
+	0xbf, 0xfe, 0x49, 0x40, 0x9d, 0x8d, 0x1b, 0xa1, 0x69, 0x20, 0x19, 0x16, 0x6f, 0x5b, 0xc0, 0x6b,
+	0x7a, 0x65, 0x1b, 0x79, 0x0b, 0x65, 0x79, 0xa2, 0x76, 0xa7, 0x52, 0xa5, 0x66, 0xa5, 0x65, 0xa3,
+	0x86, 0x14, 0x10, 0xa2, 0x76, 0x7e, 0x7a, 0x65, 0xc1, 0x5d, 0x6b, 0x6e, 0x7f, 0x56, 0xc0, 0x31,
+	0xc0, 0x29, 0x66, 0x56, 0x55, 0x9d, 0x8a, 0x9c, 0x9b, 0x51, 0x9c, 0xab, 0x9c, 0xaa, 0x9c, 0x9c,
+	0x52, 0x00, 0x6b, 0xa1, 0x69, 0x6f, 0x5b, 0xc0, 0x59, 0x6d, 0x16, 0x79, 0x65, 0xab, 0x41, 0xfe,
+	0xc4, 0x8c, 0x39, 0x29, 0x75, 0x79, 0xc0, 0x20, 0xc0, 0x7a, 0xcb, 0x1c, 0xc5, 0x23, 0xc3, 0x28,
+	0xa2, 0x76, 0x6b, 0x5a, 0x34, 0x31, 0x29, 0x6f, 0x66, 0x46, 0x9d, 0xaa, 0x9c, 0xaa, 0x9d, 0x9a,
+	0x2c, 0x99, 0xbd, 0x9d, 0x9a, 0x03, 0x5f, 0xa2, 0x58, 0x6b, 0x4b, 0x6b, 0x2b, 0x55, 0xa5, 0x66,
+	0xaf, 0x11, 0xae, 0x11, 0xfe, 0xf7, 0xbf, 0xa2, 0x76, 0xc0, 0x56, 0x31, 0xc0, 0x69, 0xc0, 0x31,
+	0xfd, 0xfd, 0xed, 0x65, 0xfe, 0xa4, 0xf3, 0xfe, 0x31, 0x85, 0x9d, 0xaa, 0xa2, 0x67, 0x1d, 0x7f,
+	0x56, 0xe0, 0x79, 0xc4, 0x24, 0xc2, 0x29, 0x22, 0x79, 0x6b, 0x22, 0xc1, 0x5a, 0x1b, 0x22, 0x25,
+	0x75, 0x76, 0x65, 0x07, 0x7d, 0x6e, 0x7e, 0xa2, 0x86, 0xa4, 0x66, 0xa2, 0x77, 0xa3, 0x66, 0x7a,
+	0xc1, 0x79, 0x66, 0x6f, 0x6f, 0x41, 0x9d, 0xaa, 0x41, 0x9d, 0xaa, 0x15, 0x5b, 0xc0, 0x56, 0xc0,
+	0x56, 0xc0, 0x5b, 0xa3, 0x48, 0x5b, 0x26, 0x29, 0x22, 0x1d, 0x20, 0xc1, 0x24, 0xc0, 0x29, 0x5b,
+	0x61, 0x68, 0xa3, 0x84, 0xa2, 0x95, 0x65, 0x76, 0x6f, 0xc0, 0x69, 0x7e, 0xc0, 0x2c, 0x2f, 0x6e,
+	0x6e, 0x7a, 0xc0, 0x6e, 0xc0, 0x6f, 0x7a, 0xc4, 0x6e, 0xc5, 0x10, 0xca, 0x15, 0xc5, 0x7f, 0x6e,
+	0xc0, 0x7a, 0x6e, 0xc1, 0x00, 0xc4, 0x69, 0x76, 0x6b, 0xc1, 0x5b, 0x6e, 0x47, 0x9a, 0xac, 0x9a,
+	0xac, 0xa0, 0x6a, 0x5b, 0x5b, 0x7c, 0x79, 0x1d, 0xc0, 0x6f, 0xc0, 0x30, 0xc0, 0x65, 0xc0, 0x27,
+	0x7e, 0xc0, 0x64, 0x69, 0x69, 0x09, 0x7d, 0xa2, 0x87, 0xa2, 0x86, 0xa6, 0x64, 0xa3, 0x76, 0xa4,
+	0x75, 0x7f, 0xa2, 0x76, 0xa2, 0x77, 0x6e, 0x5a, 0x66, 0xc0, 0x6b, 0x55, 0x52, 0x51, 0x52, 0x9d,
+	0x9a, 0x9c, 0xaa, 0x34, 0x9d, 0x9a, 0x5a, 0x5b, 0x11, 0xc0, 0x09, 0xc1, 0xa1, 0x79, 0xc0, 0x28,
+	0x2f, 0x27, 0x1f, 0x6d, 0xa2, 0x65, 0x61, 0xc0, 0x12, 0xa7, 0x64, 0xac, 0x30, 0xa1, 0xa7, 0x79,
+	0x75, 0xd6, 0x6e, 0xc4, 0x55, 0x38, 0x5a, 0x29, 0x56, 0x41, 0x52, 0x9c, 0xaa, 0x9d, 0x9b, 0x41,
+	0x51, 0x08, 0xc0, 0x6b, 0x67, 0x13, 0x6f, 0x1c, 0x1d, 0x5a, 0x7f, 0x5b, 0xa2, 0x77, 0xab, 0x33,
+	0xb0, 0x11, 0xae, 0x21, 0xa7, 0x43, 0xa2, 0x66, 0xc0, 0x56, 0x31, 0xfd, 0xfd, 0xf3, 0x94, 0xfe,
+	0xfe, 0x63, 0x0b, 0x1d, 0xc0, 0x24, 0x51, 0x24, 0xdf, 0x6e, 0x24, 0xc0, 0x79, 0xc6, 0x24, 0x6d,
+	0x69, 0xc3, 0x5b, 0x22, 0xc0, 0x24, 0xc0, 0x76, 0xc0, 0x69, 0x1c, 0x69, 0x56, 0x69, 0x09, 0xc0,
+	0x6e, 0x7a, 0x66, 0xc3, 0x09, 0xc1, 0x6b, 0xc1, 0x5b, 0xc0, 0x5a, 0x6e, 0x20, 0x6e, 0x29, 0x5b,
+	0x26, 0xc0, 0x29, 0xc0, 0x1d, 0x20, 0xc1, 0x1d, 0x29, 0xc1, 0x67, 0x24, 0x6c, 0x79, 0x12, 0x1c,
+	0x66, 0x65, 0x09, 0x6d, 0xc0, 0x10, 0x17, 0x64, 0x09, 0xd9, 0x04, 0x7a, 0x69, 0xc0, 0x6e, 0x09,
+	0xc4, 0x0c, 0xc2, 0x6e, 0xc7, 0x05, 0xc0, 0x08, 0x67, 0xc1, 0x5b, 0x6b, 0x5a, 0x5f, 0x6f, 0x56,
+	0x6b, 0x24, 0x1d, 0xc1, 0x24, 0xc2, 0x29, 0x24, 0xc2, 0x1d, 0x6e, 0xc0, 0x1d, 0x79, 0x0d, 0x65,
+	0x09, 0x05, 0xc0, 0x08, 0xa2, 0x77, 0xa3, 0x76, 0xa2, 0x67, 0x6f, 0x55, 0x66, 0x5a, 0x52, 0x51,
+	0x56, 0xc1, 0x10, 0x0d, 0x66, 0x0d, 0x14, 0xc0, 0x19, 0x20, 0xc0, 0x25, 0x56, 0xc0, 0x66, 0xc0,
+	0x1b, 0x20, 0x16, 0x6d, 0x66, 0xa2, 0x77, 0x66, 0x65, 0xa1, 0x98, 0x0c, 0x7a, 0x75, 0xc1, 0x5a,
+	0x6e, 0x05, 0xd1, 0x08, 0xc5, 0x6e, 0x6b, 0xc0, 0x11, 0x0c, 0x5a, 0x15, 0xc0, 0x10, 0x5a, 0x19,
+	0xc0, 0x7b, 0x52, 0x1b, 0xc0, 0x1d, 0x22, 0xa4, 0x56, 0xa6, 0x56, 0xa7, 0x55, 0xad, 0x22, 0xac,
+	0x22, 0xa8, 0x54, 0x6e, 0xc0, 0x5a, 0x7e, 0xc3, 0x2c, 0x31, 0xfd, 0xfd, 0xef, 0x9c, 0xba, 0xfe,
+	0x94, 0x91, 0xfe, 0x39, 0xa6, 0x1d, 0xa2, 0x77, 0x18, 0x6f, 0xdf, 0x6e, 0xc0, 0x24, 0x20, 0xc7,
+	0x22, 0xc2, 0x1d, 0xc1, 0x20, 0xc0, 0x6f, 0xc0, 0x29, 0x1d, 0xc0, 0x18, 0x20, 0x25, 0xc0, 0x20,
+	0x19, 0xc3, 0x66, 0xc0, 0x1b, 0x25, 0x20, 0xc6, 0x25, 0x2c, 0xc0, 0x25, 0x55, 0x20, 0x25, 0x31,
+	0x29, 0x24, 0xc0, 0x29, 0x24, 0xc0, 0x20, 0xc1, 0x53, 0xa2, 0x76, 0x1e, 0x5a, 0x1d, 0xa0, 0x9a,
+	0x66, 0x69, 0x7c, 0x69, 0xc0, 0x20, 0x22, 0x20, 0x1e, 0xc3, 0x19, 0xc5, 0x20, 0xc1, 0x19, 0xc5,
+	0x20, 0xc2, 0x66, 0x14, 0x17, 0x10, 0xc0, 0x12, 0x19, 0xc5, 0x1c, 0xc0, 0x19, 0xc8, 0x1e, 0x69,
+	0x1e, 0x19, 0x1c, 0xc0, 0x23, 0x66, 0x1b, 0x2c, 0x20, 0x25, 0x5a, 0x24, 0xc2, 0x20, 0xc1, 0x14,
+	0x20, 0xc0, 0x1d, 0x22, 0x1d, 0x6f, 0xc0, 0x22, 0xc0, 0x20, 0x19, 0xc1, 0x1c, 0x15, 0x0d, 0xc1,
+	0x10, 0xc2, 0x6b, 0xc1, 0x14, 0xc1, 0x20, 0xc4, 0x27, 0x2c, 0x29, 0xc2, 0x22, 0x1d, 0xc0, 0x25,
+	0xc1, 0x18, 0x27, 0xc0, 0x1b, 0x14, 0x17, 0xc0, 0x10, 0x15, 0xc0, 0x1c, 0xde, 0x19, 0xc2, 0x20,
+	0x25, 0xc0, 0x1d, 0xc0, 0x31, 0x2c, 0xa3, 0x66, 0xa4, 0x66, 0xa7, 0x55, 0xaa, 0x23, 0xaa, 0x43,
+	0xa9, 0x34, 0xa7, 0x54, 0xa2, 0x67, 0x20, 0x6e, 0x31, 0x69, 0x31, 0xc2, 0x66, 0xc0, 0x31, 0xfd,
+	0xfd, 0xf0, 0x00, 0x2d, 0x1d, 0x29, 0x1d, 0x24, 0xde, 0x29, 0xc1, 0x24, 0x79, 0xc7, 0x22, 0xc1,
+	0x1d, 0x20, 0x27, 0x66, 0x27, 0x20, 0x1d, 0x6e, 0xc0, 0x5e, 0x66, 0x77, 0xcf, 0x29, 0xc0, 0x24,
+	0x1d, 0xc0, 0x24, 0x27, 0x1d, 0x18, 0x15, 0xc0, 0x5b, 0x20, 0x29, 0x30, 0xc1, 0x29, 0x24, 0x20,
+	0x19, 0x20, 0x77, 0x2f, 0x59, 0x1d, 0x29, 0x9f, 0x9b, 0x7a, 0x2e, 0x25, 0x69, 0x25, 0x27, 0x2e,
+	0x24, 0x1d, 0xc3, 0x22, 0x1d, 0xc4, 0x29, 0xc5, 0x24, 0x29, 0xc3, 0x30, 0x24, 0xc0, 0x20, 0xc2,
+	0x25, 0x29, 0xc2, 0x22, 0x7b, 0x25, 0xc1, 0x1d, 0xc1, 0x25, 0xc4, 0x1f, 0x6e, 0xc0, 0x22, 0x1d,
+	0xc0, 0x20, 0x1d, 0x18, 0x25, 0x1d, 0xa2, 0x76, 0x69, 0x9e, 0x9c, 0x2b, 0xc0, 0x24, 0x20, 0xc0,
+	0x14, 0xc1, 0x5a, 0xc0, 0x25, 0x22, 0xc1, 0x1d, 0xc0, 0x25, 0x20, 0x1d, 0x25, 0x1d, 0xc2, 0x24,
+	0x1b, 0x7a, 0xc0, 0x1b, 0x65, 0x6b, 0x1b, 0x16, 0x1b, 0xc0, 0x27, 0xc0, 0x2c, 0x20, 0x1b, 0x27,
+	0x24, 0xc1, 0x5a, 0xc0, 0x29, 0x6e, 0x7a, 0x2a, 0x22, 0x20, 0x7b, 0x56, 0xa2, 0x67, 0x66, 0x24,
+	0x66, 0x27, 0xc0, 0x20, 0x5e, 0xc2, 0x29, 0xd1, 0x24, 0xc7, 0x18, 0x1d, 0xc1, 0x29, 0x24, 0x1d,
+	0xc1, 0x29, 0x31, 0xa9, 0x33, 0xa8, 0x44, 0xad, 0x22, 0xab, 0x23, 0xa3, 0x77, 0x0c, 0xa2, 0x77,
+	0x6f, 0x20, 0xc0, 0x6e, 0x6e, 0xc2, 0x6b, 0xc2, 0x2c, 0x31, 0xfd, 0xfd, 0xee, 0x2c, 0xc0, 0x9c,
+	0xaa, 0xfe, 0x8c, 0x50, 0xfe, 0x31, 0x86, 0x9c, 0xaa, 0x38, 0x10, 0x38, 0x24, 0xc0, 0x29, 0x65,
+	0x24, 0xde, 0x79, 0xc4, 0x27, 0x29, 0xc0, 0x1d, 0x51, 0x1d, 0x18, 0x1d, 0x7f, 0x27, 0x24, 0x22,
+	0xc2, 0x24, 0xc0, 0xa3, 0x66, 0x99, 0xcb, 0x05, 0x1d, 0x2c, 0x09, 0x6f, 0x29, 0x38, 0x10, 0x24,
+	0x29, 0x2c, 0x6e, 0x24, 0xc1, 0x29, 0x2c, 0x1d, 0x18, 0x1d, 0x24, 0x18, 0x1d, 0xc1, 0xa5, 0x66,
+	0x98, 0xcc, 0x2c, 0x18, 0xc0, 0x38, 0x18, 0x2c, 0x18, 0x20, 0x24, 0x18, 0x2c, 0x1d, 0x31, 0x1f,
+	0x10, 0x1f, 0x18, 0x2c, 0x31, 0x29, 0x24, 0x29, 0x24, 0x1d, 0xc0, 0x31, 0x24, 0x18, 0x1d, 0xc0,
+	0x2c, 0x18, 0x2c, 0x18, 0x29, 0x31, 0x29, 0x15, 0x18, 0x24, 0xc0, 0x2c, 0x29, 0x38, 0x1d, 0x18,
+	0x1d, 0x18, 0x29, 0x1d, 0x18, 0xc0, 0x11, 0x2c, 0x31, 0x29, 0x24, 0x1d, 0xc0, 0x29, 0x31, 0x1d,
+	0x2c, 0x1d, 0xc0, 0x2c, 0xc0, 0x1d, 0x2c, 0x38, 0x29, 0x18, 0xc0, 0x1d, 0xc0, 0x29, 0x1d, 0x2c,
+	0x18, 0x24, 0xc0, 0x1d, 0x2c, 0xc0, 0x1d, 0xc0, 0x24, 0xa5, 0x55, 0x15, 0x24, 0x2c, 0x27, 0x31,
+	0x2c, 0x1d, 0x2c, 0x1d, 0x2c, 0x31, 0x24, 0xc1, 0x1d, 0xc3, 0x18, 0xc0, 0x2c, 0x24, 0x38, 0x18,
+	0xc1, 0xa3, 0x77, 0x09, 0x18, 0x2c, 0x1d, 0x20, 0x27, 0x2c, 0xc0, 0x24, 0x2c, 0x1d, 0x31, 0x29,
+	0x24, 0x15, 0x24, 0x29, 0x1d, 0x10, 0x1d, 0xa3, 0x66, 0x31, 0x09, 0x24, 0x38, 0x18, 0x29, 0x18,
+	0x24, 0x31, 0x1d, 0xc1, 0x15, 0x1d, 0x38, 0x29, 0xc2, 0x24, 0x15, 0x24, 0xc6, 0x29, 0xc1, 0x24,
+	0xc0, 0x31, 0xc0, 0x29, 0x24, 0xc0, 0x29, 0xc1, 0x2c, 0x29, 0x24, 0xc0, 0x29, 0xc0, 0x3d, 0xa3,
+	0x77, 0xa2, 0x77, 0xa5, 0x55, 0xaa, 0x33, 0xa9, 0x44, 0xfe, 0xef, 0x5c, 0xa3, 0x67, 0xa2, 0x77,
+	0xfd, 0xfd, 0xfd, 0xc5, 0x92, 0xff, 0xfe, 0x6b, 0x6d, 0x92, 0xff, 0x29, 0x66, 0x38, 0xa2, 0x77,
+	0x38, 0x29, 0xc0, 0x24, 0xe5, 0x69, 0x18, 0x1d, 0x0c, 0xad, 0x21, 0x9d, 0x99, 0x2c, 0x1d, 0x24,
+	0xc4, 0x1d, 0x15, 0xa2, 0x77, 0xc0, 0x09, 0x9a, 0xcb, 0x98, 0xcc, 0x18, 0x29, 0xc1, 0x7e, 0xab,
+	0x33, 0x6f, 0x3d, 0x9b, 0xbb, 0x18, 0x29, 0xc0, 0x1d, 0x6b, 0x2c, 0xc4, 0x24, 0x18, 0x31, 0x18,
+	0xfe, 0x6b, 0x4c, 0x51, 0x95, 0xde, 0x2c, 0x18, 0x2c, 0x5a, 0x1d, 0x29, 0xc1, 0x15, 0x1d, 0x34,
+	0xaa, 0x32, 0x09, 0x66, 0x09, 0x04, 0x09, 0x04, 0x0c, 0x20, 0x1d, 0x24, 0x29, 0x24, 0xc0, 0x2c,
+	0x24, 0x29, 0x15, 0x1d, 0xa6, 0x55, 0xa8, 0x44, 0x7f, 0x09, 0x0c, 0x04, 0xc0, 0x0c, 0x38, 0x95,
+	0xdd, 0x18, 0x2c, 0x24, 0x2c, 0x1d, 0x24, 0x6e, 0xc1, 0x2d, 0x0c, 0x55, 0xc0, 0x09, 0x11, 0x09,
+	0x3d, 0x09, 0x30, 0x14, 0x18, 0x2c, 0xc0, 0x18, 0x2c, 0xc0, 0x29, 0x18, 0x1d, 0xaa, 0x34, 0xa8,
+	0x44, 0x14, 0x15, 0x7a, 0x24, 0x18, 0x24, 0x1d, 0x24, 0x2c, 0xc0, 0x18, 0x24, 0x20, 0x0c, 0x04,
+	0xa2, 0x77, 0xc0, 0x3d, 0x04, 0x3d, 0xc0, 0x56, 0x94, 0xee, 0x9c, 0xba, 0x29, 0x24, 0xc1, 0x1d,
+	0xc3, 0x2c, 0xa8, 0x44, 0xa7, 0x44, 0x94, 0xef, 0x2c, 0xc0, 0x24, 0x9d, 0xa9, 0x1d, 0x3c, 0xa9,
+	0x34, 0x05, 0x1d, 0x24, 0x29, 0x2c, 0xc0, 0x24, 0x29, 0xc0, 0x1d, 0xc1, 0xa5, 0x56, 0xa8, 0x54,
+	0x38, 0xa4, 0x56, 0xc0, 0x65, 0xc0, 0x09, 0x21, 0x31, 0x29, 0x10, 0xa2, 0x76, 0x2c, 0x29, 0xc0,
+	0x1d, 0x29, 0xc0, 0x31, 0x29, 0x66, 0x29, 0xc1, 0x7f, 0x29, 0x24, 0x38, 0xc5, 0x29, 0xc0, 0x24,
+	0x1d, 0x24, 0x29, 0xc0, 0x24, 0xc1, 0x29, 0xa2, 0x77, 0x05, 0x6f, 0x34, 0xa3, 0x66, 0x30, 0x09,
+	0xa3, 0x77, 0xa5, 0x55, 0xa6, 0x55, 0xa7, 0x55, 0xa4, 0x66, 0xa3, 0x66, 0xa4, 0x66, 0xa3, 0x77,
+	0xc0, 0x6e, 0xfd, 0xfd, 0xfd, 0xc4, 0x2c, 0x31, 0x51, 0x95, 0xee, 0xfe, 0x8c, 0x51, 0x35, 0x9d,
+	0xaa, 0xa5, 0x55, 0x19, 0x35, 0x29, 0xc0, 0x61, 0x24, 0xe5, 0x18, 0xa2, 0x77, 0xac, 0x22, 0xfe,
+	0xce, 0x58, 0x9b, 0xbb, 0x3c, 0x97, 0xcd, 0xc4, 0x29, 0x2c, 0x55, 0x2c, 0xa8, 0x34, 0xfe, 0xd6,
+	0x99, 0x9d, 0xaa, 0xfe, 0x7b, 0xce, 0xfe, 0x39, 0xa6, 0x9c, 0x9a, 0x2c, 0x1d, 0xa5, 0x66, 0xfe,
+	0xbd, 0xb6, 0xa2, 0x77, 0xfe, 0x5a, 0xca, 0x1d, 0x2c, 0xc0, 0x1d, 0xc0, 0x29, 0x2c, 0x24, 0x1d,
+	0xc1, 0x2c, 0x29, 0x18, 0x1d, 0x05, 0x14, 0x9b, 0xab, 0xfe, 0x41, 0xe7, 0x1d, 0x18, 0x1d, 0x2c,
+	0x1d, 0x6b, 0x2c, 0x29, 0x24, 0xc0, 0x25, 0xfe, 0xde, 0xdb, 0x9d, 0x99, 0x9a, 0xbb, 0x7e, 0x00,
+	0x6f, 0x05, 0x3d, 0xfe, 0x62, 0xeb, 0x18, 0x1d, 0x2c, 0xc0, 0x56, 0x2c, 0xc0, 0x29, 0x1d, 0x2c,
+	0xfe, 0x73, 0x8d, 0xfe, 0xe7, 0x1b, 0x08, 0x01, 0x1c, 0x65, 0x6e, 0x7f, 0x15, 0x19, 0x18, 0x6f,
+	0x2c, 0xc0, 0x1d, 0x6f, 0xc0, 0x51, 0x29, 0x25, 0x01, 0xa2, 0x77, 0x01, 0x15, 0xa3, 0x67, 0x21,
+	0x51, 0xa2, 0x87, 0x28, 0xfe, 0x6b, 0x2c, 0x1d, 0xc1, 0x18, 0x2c, 0xc0, 0x18, 0x1d, 0xa4, 0x66,
+	0xfe, 0x94, 0x91, 0x08, 0xfe, 0x63, 0x0b, 0x1d, 0x6b, 0xc1, 0x1d, 0x6f, 0x2c, 0x1d, 0x24, 0x1d,
+	0x14, 0xfe, 0xad, 0x34, 0x35, 0x08, 0x0d, 0x15, 0x10, 0xa2, 0x67, 0x15, 0xc0, 0x21, 0x09, 0x29,
+	0xc0, 0x1d, 0x24, 0xc0, 0x1d, 0xc3, 0x05, 0xfe, 0x8c, 0x30, 0xfe, 0xd6, 0x9a, 0x94, 0xed, 0xfe,
+	0x52, 0xaa, 0x1d, 0x24, 0x1d, 0xa2, 0x77, 0xfe, 0x83, 0xef, 0xfe, 0xd6, 0x79, 0xfe, 0x73, 0x8e,
+	0x1d, 0x24, 0x29, 0x2c, 0xc0, 0x24, 0x65, 0x2c, 0x1d, 0xc0, 0x24, 0xfe, 0x7b, 0xae, 0x39, 0x2d,
+	0x51, 0x28, 0x2d, 0x19, 0x01, 0x39, 0xfe, 0x5a, 0xeb, 0x29, 0x1d, 0xc0, 0x2c, 0x29, 0x1d, 0x29,
+	0xc0, 0xa3, 0x77, 0x11, 0x34, 0x25, 0x6b, 0xc2, 0x51, 0x55, 0x21, 0x66, 0xc5, 0x21, 0x6e, 0x7f,
+	0x18, 0xa3, 0x66, 0xc0, 0x2c, 0xc0, 0xa2, 0x66, 0xa2, 0x87, 0xa3, 0x67, 0xa2, 0x77, 0xa5, 0x66,
+	0xa3, 0x66, 0x39, 0xa2, 0x77, 0xa2, 0x77, 0xa2, 0x77, 0xa2, 0x77, 0xa2, 0x77, 0x7f, 0xc1, 0x6e,
+	0xfd, 0xfd, 0xfd, 0xca, 0x2c, 0x09, 0x21, 0xc0, 0x7f, 0x09, 0x01, 0x29, 0xc1, 0x24, 0xe5, 0x69,
+	0xc0, 0xae, 0x11, 0xfe, 0xef, 0x5c, 0x9a, 0xbb, 0xfe, 0x4a, 0x49, 0x1d, 0x24, 0xc4, 0x6e, 0x24,
+	0x65, 0xa9, 0x33, 0xfe, 0xff, 0xbe, 0x55, 0x30, 0xfe, 0x94, 0x71, 0xfe, 0x31, 0xa6, 0x24, 0x7e,
+	0xa6, 0x45, 0x28, 0x10, 0xfe, 0x5a, 0xaa, 0x94, 0xde, 0x2c, 0x24, 0x1d, 0x2c, 0x29, 0x1d, 0x29,
+	0x2c, 0x29, 0x2c, 0x1d, 0x2c, 0xc0, 0x18, 0xa4, 0x66, 0x01, 0x9d, 0x9a, 0xfe, 0x42, 0x07, 0x18,
+	0x1d, 0xc0, 0x2c, 0x24, 0xc0, 0x29, 0x24, 0x29, 0x9d, 0xa9, 0xfe, 0x84, 0x0f, 0xfe, 0xf7, 0x9e,
+	0xfe, 0xad, 0x34, 0x34, 0x0c, 0x14, 0xa2, 0x77, 0xa2, 0x67, 0x2d, 0x00, 0x1d, 0x24, 0x1d, 0xc1,
+	0x2c, 0xc0, 0x24, 0x29, 0x00, 0xfe, 0x9c, 0xd3, 0xfe, 0xef, 0x5c, 0xfe, 0x9c, 0xb2, 0x93, 0xee,
+	0x66, 0x10, 0xc0, 0xad, 0x11, 0xfe, 0xe7, 0x1c, 0x18, 0x2c, 0x56, 0x1d, 0x66, 0x24, 0x6e, 0x1d,
+	0xc1, 0x14, 0xa8, 0x34, 0x65, 0xa3, 0x77, 0xfe, 0xb5, 0x95, 0xaa, 0x34, 0xfe, 0x94, 0x91, 0x93,
+	0xef, 0x15, 0xc0, 0x97, 0xcd, 0x9b, 0xbb, 0x29, 0x18, 0x2c, 0xc1, 0x41, 0x2c, 0x00, 0xfe, 0xa5,
+	0x13, 0x20, 0xfe, 0x63, 0x0c, 0x18, 0x2c, 0x1d, 0x29, 0xc0, 0x2c, 0xc0, 0x18, 0x24, 0xc0, 0xaa,
+	0x32, 0xfe, 0xc6, 0x17, 0xa7, 0x55, 0xfe, 0x83, 0xef, 0x21, 0x66, 0x69, 0x66, 0x1c, 0xae, 0x10,
+	0xfe, 0xef, 0x5d, 0xfe, 0x84, 0x30, 0xfe, 0x29, 0x45, 0xc3, 0x1d, 0xc2, 0x2c, 0x6f, 0xfe, 0x94,
+	0xb2, 0x20, 0x41, 0xfe, 0xbd, 0xb6, 0xfe, 0x5a, 0xeb, 0x2c, 0x41, 0xa3, 0x76, 0xfe, 0x8c, 0x51,
+	0xfe, 0xef, 0x3c, 0xfe, 0x7b, 0xae, 0x1d, 0x24, 0x29, 0x2c, 0xc0, 0x24, 0x1d, 0xc0, 0x18, 0x29,
+	0xa2, 0x87, 0xfe, 0xa4, 0xf3, 0xfe, 0xe7, 0x1b, 0xfe, 0x62, 0xeb, 0x9b, 0xaa, 0x39, 0x2d, 0xc0,
+	0x14, 0xac, 0x21, 0x30, 0x93, 0xee, 0x31, 0x29, 0xc0, 0x1d, 0x15, 0x29, 0xc0, 0x01, 0x19, 0x09,
+	0x66, 0xc4, 0x35, 0x66, 0xc5, 0x69, 0xc0, 0x30, 0x35, 0x7e, 0x09, 0x04, 0xc1, 0x09, 0xc0, 0x7f,
+	0x6e, 0x7f, 0xc0, 0x6e, 0xfd, 0xfd, 0xfd, 0xcf, 0x2c, 0xc0, 0x31, 0x2c, 0x31, 0xc4, 0xfe, 0xbd,
+	0xf7, 0xfe, 0x42, 0x08, 0x9b, 0xaa, 0x7e, 0x52, 0xe4, 0x29, 0x7a, 0x24, 0xad, 0x21, 0x04, 0x9a,
+	0xba, 0x39, 0x97, 0xdc, 0x6b, 0xc4, 0x29, 0xa2, 0x77, 0x1d, 0x20, 0xfe, 0xff, 0xbe, 0x9b, 0xaa,
+	0x56, 0xa5, 0x65, 0xfe, 0xad, 0x75, 0x2d, 0x96, 0xdd, 0xa7, 0x45, 0xfe, 0xce, 0x79, 0xa3, 0x76,
+	0xfe, 0x5a, 0xca, 0x1d, 0x31, 0x24, 0x1d, 0x31, 0x24, 0x1d, 0x2c, 0x1d, 0x66, 0xc2, 0xa3, 0x67,
+	0x2c, 0x00, 0x08, 0x9c, 0xaa, 0xfe, 0x41, 0xe7, 0x1d, 0x6f, 0x1d, 0x24, 0x2c, 0x24, 0xc0, 0x1d,
+	0x38, 0x9c, 0xaa, 0xfe, 0x7b, 0xef, 0xfe, 0xf7, 0x7d, 0xfe, 0xa5, 0x13, 0xfe, 0x4a, 0x49, 0x55,
+	0xa2, 0x87, 0x00, 0x9a, 0xab, 0x18, 0xa3, 0x66, 0x2c, 0x41, 0x18, 0x31, 0xc0, 0x2c, 0x1d, 0xc1,
+	0x38, 0xfe, 0xa5, 0x14, 0xfe, 0xff, 0xff, 0xfe, 0x7b, 0xce, 0x15, 0x65, 0x18, 0x29, 0x1c, 0xfe,
+	0xa4, 0xf3, 0x93, 0xee, 0x1d, 0x24, 0x18, 0xa3, 0x66, 0x1d, 0x29, 0x1d, 0x31, 0xc0, 0x15, 0x61,
+	0x09, 0x00, 0xfe, 0xad, 0x54, 0xfe, 0xf7, 0x9d, 0x25, 0xfe, 0x29, 0x44, 0x04, 0x1d, 0xc0, 0x31,
+	0xc0, 0x18, 0x31, 0x2c, 0x1d, 0x18, 0x31, 0x00, 0xfe, 0xa5, 0x13, 0x11, 0xfe, 0x62, 0xeb, 0x18,
+	0x2c, 0x18, 0xc0, 0x1d, 0x6b, 0x2c, 0x1d, 0x31, 0x18, 0x2d, 0xfe, 0xd6, 0x79, 0x35, 0xfe, 0x52,
+	0xaa, 0x93, 0xff, 0x1d, 0x29, 0x15, 0x18, 0xfe, 0x73, 0x8e, 0xfe, 0xef, 0x7d, 0xfe, 0x9c, 0xb2,
+	0x24, 0x1d, 0x2c, 0x24, 0xc0, 0x1d, 0xc2, 0x2c, 0xc0, 0x30, 0xfe, 0xef, 0x3c, 0x96, 0xdd, 0xab,
+	0x22, 0x98, 0xcc, 0xfe, 0x73, 0x8d, 0x1d, 0x66, 0xfe, 0x94, 0x92, 0xfe, 0xff, 0xbe, 0x11, 0x1d,
+	0x24, 0x29, 0x2c, 0xc0, 0x24, 0x29, 0x15, 0x29, 0x2c, 0xa3, 0x66, 0xfe, 0xad, 0x34, 0x21, 0xfe,
+	0x5a, 0xeb, 0x9d, 0xa9, 0x51, 0x9d, 0xaa, 0x6e, 0xa6, 0x55, 0xa3, 0x77, 0x00, 0x9c, 0xaa, 0x24,
+	0x29, 0x31, 0x18, 0x24, 0x2c, 0x1d, 0xa7, 0x55, 0xfe, 0xce, 0x59, 0xad, 0x11, 0xe5, 0x66, 0xc0,
+	0x31, 0xfd, 0xfd, 0xfd, 0xca, 0x2c, 0x31, 0x2c, 0xc0, 0x9c, 0xaa, 0xfe, 0x63, 0x2c, 0x24, 0xe6,
+	0x1d, 0x18, 0x1d, 0x1c, 0x3d, 0x98, 0xcc, 0xfe, 0x4a, 0x48, 0x24, 0xc5, 0x1d, 0x29, 0x51, 0xa8,
+	0x44, 0xfe, 0xf7, 0x9d, 0xfe, 0xb5, 0xb6, 0xfe, 0x73, 0xae, 0xfe, 0xc6, 0x38, 0x0c, 0x91, 0xff,
+	0x0d, 0x99, 0xcc, 0x39, 0x7e, 0xfe, 0x5a, 0xaa, 0x18, 0xa2, 0x77, 0x55, 0x24, 0x2c, 0x1d, 0x18,
+	0x1d, 0x18, 0x2c, 0x19, 0x28, 0x1d, 0xc0, 0x18, 0xa4, 0x56, 0xfe, 0xde, 0xba, 0x9c, 0xaa, 0x19,
+	0x1d, 0xc0, 0x2c, 0x1d, 0x29, 0x24, 0xc1, 0xa2, 0x77, 0x24, 0xfe, 0x84, 0x30, 0xfe, 0xf7, 0xbe,
+	0x9b, 0xbb, 0x3c, 0x08, 0x01, 0x05, 0x00, 0x9d, 0x99, 0x24, 0xc0, 0x2c, 0x6e, 0x2c, 0x1d, 0xc0,
+	0x18, 0x1d, 0xc0, 0x00, 0xfe, 0xa5, 0x13, 0xfe, 0xff, 0xdf, 0xfe, 0x7b, 0xef, 0x18, 0x1d, 0x7f,
+	0xc0, 0x38, 0x3d, 0x24, 0xa2, 0x76, 0xc0, 0x1d, 0xc1, 0x2c, 0x18, 0x15, 0x18, 0x1d, 0x38, 0x31,
+	0x3d, 0xfe, 0xa4, 0xf3, 0x11, 0xfe, 0x7b, 0xef, 0xfe, 0x31, 0x85, 0x3d, 0x2c, 0x1d, 0x18, 0xc0,
+	0x1d, 0x31, 0x24, 0x1d, 0xc0, 0x31, 0xa2, 0x77, 0xfe, 0xad, 0x34, 0x11, 0xfe, 0x6b, 0x4c, 0x1d,
+	0x2c, 0x51, 0xc0, 0x24, 0xc0, 0x2c, 0x18, 0x38, 0x18, 0x2d, 0x34, 0xa8, 0x43, 0xfe, 0x5a, 0xaa,
+	0x18, 0x24, 0x2c, 0x24, 0x2c, 0xfe, 0x73, 0xae, 0x3d, 0xfe, 0x8c, 0x50, 0x18, 0x15, 0x29, 0x24,
+	0xc0, 0x69, 0xc3, 0x38, 0xfe, 0x9c, 0xf3, 0xfe, 0xef, 0x3c, 0xfe, 0x73, 0x8d, 0xa9, 0x34, 0xfe,
+	0xde, 0xfb, 0x51, 0xfe, 0x84, 0x10, 0x14, 0xfe, 0x8c, 0x30, 0x38, 0x11, 0x1d, 0x24, 0x29, 0x2c,
+	0xc0, 0x24, 0x29, 0x18, 0xa4, 0x66, 0x1d, 0x2c, 0xfe, 0x8c, 0x50, 0xfe, 0xe7, 0x1b, 0x21, 0x61,
+	0x5a, 0x7e, 0xc0, 0x51, 0x99, 0xbc, 0xfe, 0x52, 0x69, 0x1d, 0x18, 0x1d, 0x6f, 0x1d, 0x29, 0x2c,
+	0x1d, 0xa7, 0x45, 0x01, 0xab, 0x23, 0xfd, 0xfd, 0xfd, 0xef, 0x66, 0x31, 0xc3, 0x2c, 0xc1, 0xfe,
+	0x84, 0x10, 0x18, 0x24, 0x1d, 0x7f, 0xc0, 0x1d, 0x24, 0x1d, 0x24, 0xde, 0x1d, 0xc0, 0x2c, 0xad,
+	0x11, 0xfe, 0xef, 0x5d, 0x98, 0xcb, 0xfe, 0x4a, 0x69, 0x24, 0xc4, 0x6e, 0x2c, 0x29, 0x1d, 0xa8,
+	0x45, 0xfe, 0xff, 0xde, 0xfe, 0xad, 0x54, 0x14, 0xa5, 0x55, 0xfe, 0xa5, 0x34, 0xfe, 0xef, 0x5c,
+	0x97, 0xcd, 0xfe, 0x84, 0x0f, 0xae, 0x12, 0xa8, 0x44, 0xfe, 0x5a, 0xcb, 0x94, 0xed, 0xc0, 0x18,
+	0x24, 0x2c, 0x1d, 0xc1, 0x24, 0xa7, 0x44, 0xfe, 0x94, 0x92, 0x09, 0xfe, 0x4a, 0x48, 0x2c, 0x9d,
+	0x99, 0xa5, 0x66, 0xfe, 0xde, 0xda, 0x9b, 0xbb, 0x19, 0x18, 0x1d, 0x29, 0x1d, 0x2c, 0xc0, 0x24,
+	0x1d, 0x29, 0x24, 0x39, 0xfe, 0xf7, 0x9d, 0x96, 0xdd, 0x92, 0xff, 0x56, 0xc0, 0x94, 0xfe, 0x29,
+	0x1d, 0x6b, 0xc1, 0x29, 0xc0, 0x24, 0x18, 0x1d, 0xc0, 0x2c, 0x05, 0xfe, 0xa5, 0x14, 0x20, 0xfe,
+	0x7b, 0xae, 0x18, 0x1d, 0x24, 0x1d, 0xa5, 0x56, 0x3c, 0x05, 0x1d, 0x18, 0x1d, 0x2c, 0x24, 0x29,
+	0xc2, 0x1d, 0xc1, 0x05, 0xfe, 0xa4, 0xf3, 0xfe, 0xf7, 0x9d, 0xfe, 0x7b, 0xef, 0x29, 0x1d, 0xc0,
+	0x29, 0xc1, 0x2c, 0x1d, 0x29, 0x24, 0x18, 0x2c, 0x05, 0xfe, 0xa5, 0x13, 0xfe, 0xf7, 0x7d, 0xfe,
+	0x6b, 0x2c, 0x1d, 0xc2, 0xa2, 0x77, 0x29, 0x1d, 0x18, 0x31, 0x18, 0xaa, 0x23, 0xfe, 0xd6, 0x79,
+	0x3d, 0x1c, 0x1d, 0xc0, 0x29, 0x51, 0x24, 0x20, 0xfe, 0xef, 0x5d, 0xfe, 0x94, 0xb2, 0x31, 0x24,
+	0x29, 0x24, 0xc0, 0x1d, 0xc2, 0x2c, 0x00, 0xfe, 0x9c, 0xb2, 0x0c, 0xfe, 0x5a, 0xca, 0x14, 0xfe,
+	0x8c, 0x50, 0xfe, 0xde, 0xda, 0xa2, 0x77, 0x2d, 0xa2, 0x87, 0xfe, 0xef, 0x3c, 0xfe, 0x7b, 0xef,
+	0x1d, 0x24, 0x6e, 0xc1, 0x24, 0x29, 0x1d, 0x2c, 0x18, 0x1d, 0x01, 0xad, 0x12, 0xa6, 0x55, 0x66,
+	0x04, 0x01, 0x65, 0xa9, 0x44, 0xae, 0x01, 0x31, 0x24, 0x69, 0xc1, 0x29, 0xc0, 0x7e, 0x18, 0x25,
+	0xfe, 0xce, 0x59, 0xad, 0x11, 0xc0, 0x66, 0x31, 0xdd, 0x2c, 0xc0, 0x31, 0xfd, 0xfd, 0xfd, 0xd4,
+	0x01, 0x24, 0x29, 0x1d, 0x29, 0x7a, 0x1d, 0x29, 0xc0, 0x24, 0xdf, 0x2c, 0x29, 0xac, 0x32, 0x3d,
+	0x99, 0xbc, 0xfe, 0x52, 0x69, 0x97, 0xcd, 0xc5, 0x29, 0x2c, 0x1d, 0xa7, 0x55, 0xfe, 0xff, 0xde,
+	0xfe, 0xb5, 0x75, 0xfe, 0x39, 0xc7, 0x9a, 0xba, 0xaa, 0x33, 0xfe, 0xa5, 0x13, 0xaf, 0x01, 0x7e,
+	0x9c, 0xaa, 0x6f, 0xfe, 0x52, 0x89, 0x1d, 0x6f, 0x1d, 0xc0, 0x24, 0x18, 0x24, 0xc1, 0x28, 0xfe,
+	0xde, 0xba, 0x0d, 0xfe, 0x5a, 0xca, 0x0c, 0x24, 0x28, 0xfe, 0xd6, 0x79, 0x14, 0xfe, 0x42, 0x28,
+	0x97, 0xdc, 0xa3, 0x77, 0x1d, 0x24, 0x2c, 0x29, 0x18, 0x24, 0xa2, 0x76, 0x1d, 0xfe, 0x7b, 0xcf,
+	0x3d, 0xfe, 0x9c, 0xd3, 0x00, 0xc1, 0x5a, 0x31, 0x6b, 0x65, 0x24, 0xc0, 0x18, 0x1d, 0x2c, 0x1d,
+	0x2c, 0x18, 0x1d, 0x00, 0xfe, 0xa5, 0x14, 0xfe, 0xf7, 0x7d, 0xfe, 0x83, 0xef, 0x00, 0x3d, 0x31,
+	0xa2, 0x77, 0xae, 0x11, 0xfe, 0xc6, 0x17, 0x93, 0xef, 0x31, 0x2c, 0xc0, 0x1d, 0x24, 0x29, 0xc5,
+	0x05, 0xfe, 0x9c, 0xf3, 0xfe, 0xf7, 0x9d, 0xfe, 0x7b, 0xef, 0xfe, 0x31, 0x85, 0x29, 0x24, 0xc5,
+	0x2c, 0x1d, 0x2c, 0x00, 0x04, 0x11, 0xfe, 0x62, 0xeb, 0x1d, 0x2c, 0xc0, 0x18, 0x6f, 0xc0, 0x1d,
+	0x29, 0x31, 0x9d, 0x9a, 0xaa, 0x43, 0xfe, 0xce, 0x38, 0xa6, 0x55, 0xfe, 0x63, 0x0c, 0x38, 0x3d,
+	0xc0, 0x2c, 0x38, 0xfe, 0x7b, 0xcf, 0xfe, 0xe7, 0x3c, 0xfe, 0x94, 0x91, 0x1d, 0x29, 0xc0, 0x1d,
+	0xc4, 0x7f, 0x38, 0xfe, 0x94, 0xb2, 0xfe, 0xef, 0x7d, 0xfe, 0x5a, 0xeb, 0x18, 0x00, 0x20, 0x39,
+	0x24, 0x55, 0xa4, 0x66, 0xfe, 0x7b, 0xce, 0xfe, 0x29, 0x45, 0xc5, 0x1d, 0x29, 0x31, 0xc0, 0xa9,
+	0x44, 0xa4, 0x66, 0x05, 0x00, 0x05, 0x6f, 0xc0, 0x20, 0x35, 0xfe, 0x7b, 0xef, 0xfe, 0x21, 0x24,
+	0xa3, 0x76, 0x29, 0x1d, 0x24, 0x18, 0x31, 0x18, 0xaa, 0x23, 0xfe, 0xce, 0x58, 0xad, 0x12, 0xfd,
+	0xfd, 0xfd, 0xf8, 0xfe, 0xb5, 0x96, 0xfe, 0x31, 0xa6, 0x24, 0xc0, 0x18, 0x24, 0x1d, 0x24, 0x2c,
+	0x24, 0xdf, 0x1d, 0x18, 0xb0, 0x00, 0xfe, 0xf7, 0x9d, 0x98, 0xcc, 0xfe, 0x4a, 0x28, 0x1d, 0x24,
+	0xc3, 0x1d, 0x15, 0x29, 0x9d, 0xa9, 0xa9, 0x34, 0xfe, 0xff, 0xbe, 0xfe, 0xbd, 0xb6, 0xfe, 0x39,
+	0xe7, 0x1d, 0xc0, 0x11, 0xfe, 0x84, 0x30, 0xfe, 0xde, 0xfb, 0x31, 0x97, 0xdc, 0xfe, 0x52, 0x8a,
+	0x1d, 0xa2, 0x77, 0x24, 0x1d, 0x2c, 0x1d, 0x24, 0xc0, 0x18, 0xa9, 0x33, 0xfe, 0xe6, 0xfb, 0xa5,
+	0x55, 0x92, 0xff, 0x9c, 0xab, 0x65, 0xa2, 0x77, 0x20, 0x14, 0x28, 0x98, 0xcc, 0xa2, 0x77, 0x56,
+	0xc0, 0x29, 0xc0, 0x1d, 0x29, 0xc0, 0x51, 0xfe, 0x84, 0x30, 0xfe, 0xf7, 0xbe, 0x97, 0xdd, 0x95,
+	0xed, 0xa2, 0x77, 0x55, 0x56, 0xc0, 0x7f, 0xfe, 0x5a, 0xca, 0x93, 0xff, 0xc0, 0x6e, 0xc0, 0x7f,
+	0x1d, 0xc0, 0x6b, 0x2c, 0xa2, 0x77, 0x04, 0xfe, 0xff, 0xde, 0x95, 0xde, 0x98, 0xdc, 0x55, 0x66,
+	0x1d, 0xa7, 0x55, 0x11, 0x18, 0xfe, 0x29, 0x24, 0x6e, 0x7f, 0x29, 0xc5, 0x1d, 0x52, 0x31, 0xfe,
+	0xad, 0x54, 0x11, 0xfe, 0x84, 0x0f, 0xfe, 0x29, 0x44, 0xc0, 0x24, 0xc4, 0x1d, 0x31, 0x2c, 0x24,
+	0x00, 0xfe, 0xad, 0x34, 0x20, 0xfe, 0x6b, 0x4c, 0xfe, 0x29, 0x24, 0x2c, 0xc0, 0x18, 0x1d, 0xc0,
+	0x29, 0x2c, 0xc0, 0x24, 0x3c, 0x28, 0x25, 0x92, 0xff, 0x9a, 0xbb, 0x56, 0x7a, 0xa2, 0x67, 0x66,
+	0xa9, 0x33, 0x20, 0xfe, 0x8c, 0x71, 0xfe, 0x29, 0x45, 0xc1, 0x69, 0xc4, 0x24, 0x00, 0x04, 0xfe,
+	0xf7, 0x9e, 0xfe, 0x62, 0xeb, 0x92, 0xff, 0xc0, 0x6f, 0xad, 0x11, 0xfe, 0xbd, 0xf7, 0xad, 0x21,
+	0xc0, 0xfe, 0x73, 0xae, 0x24, 0xc4, 0x6e, 0xc0, 0x31, 0x29, 0xa4, 0x76, 0xfe, 0xad, 0x54, 0xae,
+	0x11, 0x93, 0xef, 0x9d, 0xaa, 0x15, 0x7a, 0xa2, 0x77, 0xa6, 0x45, 0xab, 0x33, 0xfe, 0x84, 0x0f,
+	0xfe, 0x21, 0x24, 0xa2, 0x77, 0x7a, 0x55, 0x29, 0x61, 0x31, 0x18, 0xaa, 0x23, 0xfe, 0xce, 0x58,
+	0xad, 0x12, 0xfd, 0xfd, 0xfd, 0xf8, 0x08, 0xfe, 0x52, 0xaa, 0x15, 0x24, 0xc1, 0x1d, 0x24, 0x1d,
+	0x24, 0xde, 0x29, 0xc1, 0xad, 0x21, 0xfe, 0xde, 0xba, 0x99, 0xbb, 0xfe, 0x4a, 0x48, 0x24, 0xc4,
+	0x6e, 0x7e, 0x29, 0x1d, 0x2d, 0x10, 0x93, 0xee, 0xfe, 0x42, 0x28, 0x29, 0xc0, 0x1d, 0x29, 0xb0,
+	0x00, 0xfe, 0xce, 0x58, 0x51, 0xfe, 0x5a, 0xaa, 0x1d, 0xc1, 0x24, 0x29, 0x24, 0x2c, 0xc0, 0x1d,
+	0xa4, 0x67, 0xfe, 0x9c, 0xd2, 0xfe, 0xef, 0x5c, 0x66, 0xc0, 0xa2, 0x77, 0x9c, 0xaa, 0x6e, 0xfe,
+	0x94, 0x71, 0x31, 0x18, 0x2c, 0x1d, 0x2c, 0xc0, 0x31, 0x52, 0x18, 0x15, 0xa2, 0x77, 0xfe, 0x7b,
+	0xef, 0xfe, 0xe7, 0x1c, 0xa2, 0x77, 0x38, 0xa3, 0x67, 0x0c, 0x18, 0x6e, 0x38, 0xfe, 0x73, 0xae,
+	0xfe, 0x29, 0x44, 0xc0, 0xa3, 0x67, 0x1d, 0xc0, 0x29, 0x1d, 0xc0, 0x2c, 0xc0, 0xb0, 0x00, 0xfe,
+	0xde, 0xdb, 0x38, 0x04, 0x7e, 0xc0, 0x04, 0x0c, 0x9d, 0x99, 0xfe, 0x8c, 0x30, 0x1d, 0x24, 0x1d,
+	0x6f, 0xc6, 0x1d, 0xa5, 0x56, 0xfe, 0x9c, 0xf3, 0xaf, 0x10, 0xfe, 0x73, 0xae, 0xfe, 0x31, 0x85,
+	0x24, 0xc6, 0x2c, 0x24, 0x2c, 0xa3, 0x67, 0xfe, 0x94, 0x91, 0xb0, 0x00, 0xfe, 0x6b, 0x2c, 0x91,
+	0xff, 0x66, 0x24, 0xc0, 0x2c, 0x24, 0x2c, 0x1d, 0xc1, 0xa4, 0x66, 0xfe, 0x9c, 0xb2, 0xfe, 0xe7,
+	0x3c, 0x65, 0x04, 0x6e, 0x04, 0xa3, 0x66, 0x65, 0x51, 0x9b, 0xab, 0xfe, 0x6b, 0x6d, 0x24, 0x18,
+	0x6e, 0xc5, 0x18, 0x0c, 0x21, 0xb1, 0x00, 0xfe, 0x5a, 0xeb, 0x18, 0x1d, 0xc0, 0x51, 0x3c, 0xfe,
+	0xad, 0x54, 0x10, 0xfe, 0x6b, 0x4d, 0x24, 0xc4, 0x6e, 0xc0, 0x24, 0x18, 0x05, 0x30, 0xfe, 0xde,
+	0xfb, 0xa6, 0x55, 0x11, 0x1d, 0x11, 0x1d, 0x3d, 0x01, 0xfe, 0x63, 0x0b, 0xfe, 0x21, 0x24, 0x7e,
+	0x24, 0xc0, 0x2c, 0x18, 0x31, 0x18, 0x39, 0x2d, 0xad, 0x12, 0xfd, 0xfd, 0xfd, 0xf8, 0x51, 0xfe,
+	0x8c, 0x71, 0x00, 0x9d, 0x99, 0x2c, 0xc0, 0x24, 0xa2, 0x76, 0x1d, 0x24, 0xde, 0x2c, 0xc1, 0x31,
+	0xab, 0x33, 0x51, 0x98, 0xbc, 0x51, 0x66, 0xc3, 0x29, 0x31, 0x1d, 0x24, 0x15, 0xfe, 0x6b, 0x6d,
+	0x39, 0x31, 0x15, 0x1d, 0x2c, 0x18, 0x31, 0xa8, 0x45, 0xc0, 0x00, 0x1d, 0x24, 0x2c, 0x1d, 0x18,
+	0x1d, 0x2c, 0xc1, 0x18, 0x05, 0x10, 0xa3, 0x67, 0x69, 0xa2, 0x77, 0x29, 0x10, 0x05, 0x18, 0x1d,
+	0x2c, 0x1d, 0x2c, 0x31, 0x18, 0x24, 0x1d, 0x24, 0x6e, 0xa5, 0x66, 0xa7, 0x54, 0x6e, 0x30, 0xc1,
+	0x6e, 0x30, 0x55, 0x99, 0xcb, 0x2c, 0x1d, 0x2c, 0xc2, 0x56, 0x18, 0x1d, 0x18, 0x31, 0x39, 0xa3,
+	0x77, 0x29, 0xc0, 0x38, 0x30, 0x1c, 0x3c, 0x2c, 0x15, 0x1d, 0x24, 0x18, 0x24, 0x6e, 0xc5, 0x2c,
+	0x39, 0xa5, 0x65, 0x19, 0x9b, 0xab, 0xc0, 0x24, 0xc4, 0x1d, 0x2c, 0x18, 0x1d, 0x2c, 0xa7, 0x44,
+	0x1c, 0x00, 0x24, 0x1d, 0x29, 0x2c, 0x18, 0x24, 0x1d, 0xc1, 0x2c, 0x1d, 0xa2, 0x78, 0x10, 0x1c,
+	0xa3, 0x76, 0x35, 0x21, 0x35, 0x30, 0x1c, 0x3c, 0x29, 0x18, 0xa3, 0x67, 0x2c, 0x1d, 0xc4, 0x2c,
+	0xc0, 0xa6, 0x55, 0x3d, 0x93, 0xef, 0x29, 0x1d, 0x2c, 0x31, 0x18, 0x14, 0xa9, 0x33, 0x14, 0x24,
+	0xc4, 0x1d, 0x6f, 0x1d, 0xc0, 0x29, 0x05, 0x10, 0xa3, 0x66, 0xc0, 0x7f, 0x29, 0xa2, 0x77, 0x29,
+	0x39, 0x1d, 0xc0, 0x6f, 0xc1, 0x1d, 0x18, 0x31, 0x18, 0x39, 0xfe, 0xce, 0x58, 0xad, 0x12, 0xfd,
+	0xfd, 0xfd, 0xf9, 0x95, 0xee, 0x04, 0x2c, 0x18, 0x1d, 0xc0, 0x24, 0x1d, 0x24, 0xde, 0x1d, 0x18,
+	0x2c, 0x18, 0xc1, 0x1d, 0x2c, 0x24, 0xc4, 0x1d, 0xc0, 0xa2, 0x77, 0x99, 0xcc, 0x31, 0x18, 0x15,
+	0x29, 0x31, 0x1d, 0xc0, 0x29, 0x1d, 0x18, 0x1d, 0x18, 0x1d, 0x29, 0x2c, 0x24, 0x2c, 0x24, 0x18,
+	0x2c, 0xc1, 0x18, 0x1d, 0x51, 0x1d, 0xc0, 0x2c, 0x18, 0x1d, 0x2c, 0xc0, 0x1d, 0x24, 0x1d, 0xc0,
+	0x29, 0x24, 0xc0, 0x29, 0x24, 0xc1, 0x1d, 0x15, 0x24, 0xc0, 0x18, 0xc0, 0x2c, 0x29, 0x1d, 0xc0,
+	0x24, 0x1d, 0x29, 0xc0, 0x1d, 0x31, 0x2c, 0x1d, 0x18, 0xc0, 0x56, 0x18, 0x1d, 0x24, 0x1d, 0x24,
+	0x1d, 0x2c, 0x24, 0x2c, 0x29, 0xc5, 0x24, 0x1d, 0xc0, 0x29, 0x1d, 0xc1, 0x24, 0xc5, 0x1d, 0x29,
+	0x24, 0x2c, 0x24, 0x1d, 0xc4, 0x2c, 0x24, 0x1d, 0x18, 0x24, 0xc0, 0x2c, 0x1d, 0x15, 0x2c, 0x15,
+	0x24, 0xc0, 0x9d, 0xa9, 0x24, 0x1d, 0x24, 0x15, 0xc0, 0x29, 0xc0, 0x24, 0x1d, 0xc6, 0x04, 0x31,
+	0x10, 0x2c, 0xc0, 0x24, 0x2c, 0xc0, 0x18, 0xc0, 0x1d, 0x24, 0xc4, 0x1d, 0x31, 0x18, 0x29, 0x31,
+	0x15, 0x2c, 0x29, 0xc0, 0x1d, 0x15, 0x1d, 0x29, 0x1d, 0xc0, 0xa3, 0x67, 0x1d, 0xc1, 0x24, 0x18,
+	0x31, 0x18, 0x39, 0x2d, 0xad, 0x12, 0xfd, 0xfd, 0xfd, 0xf5, 0x66, 0x31, 0x2c, 0x31, 0x51, 0xfe,
+	0xad, 0x55, 0x39, 0x18, 0x29, 0x66, 0x18, 0x24, 0xc6, 0x27, 0x24, 0x29, 0xc2, 0x24, 0xc3, 0x29,
+	0xc0, 0x24, 0xc9, 0x22, 0x29, 0x65, 0xc0, 0x18, 0xa3, 0x66, 0xc0, 0x1d, 0x24, 0xc5, 0x7e, 0x18,
+	0x3d, 0x09, 0x31, 0x29, 0x31, 0x1d, 0xc0, 0x2c, 0x1d, 0x24, 0xa2, 0x77, 0x31, 0x2c, 0x1d, 0x2c,
+	0x1d, 0xc1, 0x2c, 0x31, 0x2c, 0x1d, 0xc2, 0x24, 0x2c, 0x38, 0x1d, 0x27, 0x1d, 0x2c, 0xc0, 0x18,
+	0x1d, 0x2c, 0x18, 0x24, 0x29, 0xc0, 0x24, 0x18, 0x24, 0xc0, 0x2c, 0x29, 0x18, 0x2c, 0x24, 0xc2,
+	0x1d, 0xc0, 0x29, 0x2c, 0xc1, 0x24, 0xc0, 0x1d, 0xc0, 0x24, 0x31, 0x1d, 0xc0, 0x2c, 0x24, 0x1d,
+	0xc0, 0x2c, 0x18, 0x1d, 0x2c, 0x18, 0x24, 0x29, 0xc4, 0x24, 0x1d, 0x2c, 0x31, 0x1d, 0x31, 0x1d,
+	0x24, 0xc4, 0x29, 0x2c, 0x1d, 0x24, 0x1d, 0x18, 0x2c, 0xc1, 0x1d, 0xc1, 0x2c, 0x24, 0x2c, 0x1d,
+	0x2c, 0x18, 0x1d, 0x2c, 0x29, 0x31, 0x15, 0x29, 0x31, 0x15, 0x38, 0x24, 0x38, 0x24, 0x2c, 0x31,
+	0x1d, 0xc6, 0x18, 0x31, 0x1d, 0x00, 0x1d, 0x2c, 0x1d, 0x24, 0x2c, 0x24, 0x2c, 0x24, 0x1d, 0x24,
+	0xc5, 0x2c, 0x18, 0x1d, 0x29, 0xc0, 0x1d, 0xc0, 0x29, 0xc4, 0x18, 0x29, 0x15, 0x24, 0x1d, 0x29,
+	0x18, 0x31, 0x18, 0x39, 0x2d, 0xad, 0x12, 0xfd, 0xfd, 0xfd, 0xfa, 0x9d, 0xaa, 0xfe, 0xa5, 0x13,
+	0x38, 0x9c, 0xa9, 0xa4, 0x66, 0x29, 0x24, 0xc1, 0x2c, 0xc1, 0x24, 0x27, 0xc0, 0x24, 0x59, 0x6e,
+	0x29, 0x1a, 0x1d, 0x10, 0x7f, 0x24, 0x6f, 0xa2, 0x67, 0x9d, 0xa9, 0xa0, 0xa7, 0x27, 0xc0, 0x24,
+	0xc4, 0x1d, 0x22, 0xc1, 0x20, 0xcc, 0x1d, 0x20, 0x1d, 0x20, 0xc0, 0x1d, 0xcf, 0x20, 0xc1, 0x2c,
+	0x27, 0xc0, 0x20, 0x56, 0xc2, 0x20, 0xc0, 0x27, 0x2c, 0xc0, 0x27, 0xd1, 0x24, 0xd3, 0x29, 0xc3,
+	0x24, 0xc6, 0x27, 0xc9, 0x2c, 0xc6, 0x24, 0xc0, 0x29, 0x24, 0xc0, 0x29, 0x24, 0xc1, 0x29, 0x5a,
+	0xc3, 0x15, 0x18, 0x20, 0xc1, 0x1d, 0xc4, 0x22, 0x18, 0x1d, 0xc0, 0x31, 0x29, 0x1d, 0xcb, 0x24,
+	0x2c, 0xcb, 0x29, 0xc4, 0x1d, 0x29, 0xc0, 0xa7, 0x54, 0xfe, 0xde, 0xda, 0xa9, 0x34, 0xfd, 0xfd,
+	0xfd, 0xfb, 0x97, 0xdd, 0xfe, 0x7b, 0xef, 0xfe, 0x31, 0x85, 0x10, 0x29, 0x1d, 0x24, 0xc0, 0x2c,
+	0xc1, 0x24, 0x76, 0xc0, 0x24, 0x29, 0x6e, 0xc0, 0x65, 0x31, 0x18, 0x1b, 0x18, 0xc0, 0x29, 0x1d,
+	0xc2, 0x24, 0xc4, 0x1d, 0x22, 0xc0, 0x1d, 0xd2, 0x20, 0xcb, 0x1d, 0x18, 0xc0, 0x1d, 0xc1, 0x20,
+	0xc0, 0x69, 0xc0, 0x66, 0xc1, 0x19, 0x20, 0xc4, 0x1b, 0xcb, 0x18, 0x1d, 0xc3, 0x18, 0xd3, 0x1d,
+	0xc3, 0x18, 0xc6, 0x1d, 0xc4, 0x20, 0xc4, 0x1b, 0xc3, 0x20, 0x1d, 0x20, 0xc0, 0x1d, 0xc2, 0x20,
+	0xc2, 0x22, 0xc1, 0x2e, 0x22, 0x7a, 0x20, 0x19, 0x14, 0x20, 0x1d, 0xc6, 0x2e, 0x1d, 0xc0, 0x22,
+	0x1d, 0x2c, 0xca, 0x1d, 0x18, 0xca, 0x5a, 0xc5, 0x1a, 0x1d, 0xc0, 0xa7, 0x45, 0xfe, 0xd6, 0x99,
+	0xaa, 0x33, 0xc0, 0x6f, 0xfd, 0xfd, 0xfd, 0xfa, 0x94, 0xee, 0xfe, 0x63, 0x0b, 0x18, 0x24, 0x6e,
+	0x24, 0xc3, 0x27, 0xc0, 0x66, 0x24, 0x29, 0x69, 0xc0, 0x65, 0x7f, 0x75, 0x17, 0xc0, 0x69, 0x1c,
+	0x6e, 0x20, 0xc2, 0x27, 0xc0, 0x24, 0xc0, 0x1d, 0xc0, 0x20, 0x19, 0x20, 0xe6, 0x12, 0xc7, 0x66,
+	0xc2, 0x12, 0xfd, 0xc1, 0x19, 0x1e, 0x6e, 0x1c, 0xc0, 0x19, 0xc6, 0x10, 0xc2, 0x69, 0x6e, 0xc0,
+	0x56, 0x12, 0x0d, 0xc1, 0x1c, 0x20, 0x1d, 0xc4, 0x2c, 0x1d, 0x29, 0x1d, 0x15, 0x1d, 0xcc, 0x24,
+	0x2c, 0xca, 0x29, 0xc7, 0x1d, 0x2d, 0x01, 0x31, 0xfd, 0xfd, 0xfd, 0xfc, 0x61, 0xfe, 0xad, 0x75,
+	0xfe, 0x4a, 0x69, 0x95, 0xee, 0x24, 0xc4, 0x27, 0xc1, 0x24, 0xc0, 0x1d, 0x16, 0x7e, 0x75, 0x13,
+	0x65, 0x7d, 0xc0, 0x03, 0xa2, 0x66, 0x5a, 0xc0, 0x6b, 0xc9, 0x66, 0xd1, 0x11, 0xcb, 0x0c, 0xc3,
+	0x11, 0xc0, 0x65, 0xc1, 0x0a, 0x0d, 0xc2, 0x6b, 0xc0, 0x6e, 0xc1, 0x0d, 0xf9, 0x6e, 0xc4, 0x7b,
+	0xc4, 0x69, 0xc5, 0x6e, 0xc0, 0x76, 0xc3, 0x56, 0x15, 0x19, 0x6b, 0xa2, 0x68, 0x9d, 0x9a, 0x5a,
+	0x1d, 0xc4, 0xa2, 0x77, 0x1d, 0xa4, 0x66, 0xa3, 0x67, 0x65, 0xc1, 0x6b, 0xca, 0x19, 0x66, 0xcb,
+	0x5a, 0xc5, 0x19, 0xc0, 0xa7, 0x45, 0xfe, 0xce, 0x99, 0xab, 0x33, 0xfd, 0xfd, 0xfd, 0xfd, 0x9c,
+	0xba, 0xfe, 0x94, 0x92, 0x05, 0x9a, 0xbc, 0xa3, 0x66, 0x24, 0xc2, 0x27, 0xc0, 0x24, 0x1f, 0x24,
+	0x1d, 0xa2, 0x76, 0xa3, 0x85, 0xa6, 0x75, 0xa2, 0x86, 0x9c, 0xc9, 0x7e, 0x79, 0x51, 0xa3, 0x66,
+	0x4a, 0xc4, 0x56, 0xc2, 0x79, 0x6b, 0xe3, 0x2e, 0xc1, 0x6b, 0x7a, 0xc1, 0x6e, 0xc1, 0x7a, 0x6f,
+	0xc0, 0x6e, 0xc0, 0x7a, 0xc0, 0x6e, 0x69, 0xd1, 0x66, 0xd1, 0x12, 0xc5, 0x0d, 0xc4, 0x12, 0xc4,
+	0x7a, 0x6b, 0xc4, 0x6e, 0xc2, 0x69, 0xc1, 0x6e, 0xc1, 0x7a, 0xc1, 0x5b, 0x7f, 0x65, 0x7a, 0x69,
+	0xc1, 0xa1, 0x79, 0x5b, 0x5f, 0xa2, 0x69, 0x9d, 0x8b, 0x96, 0xcd, 0x99, 0xad, 0x1d, 0xc4, 0x6b,
+	0x39, 0xb0, 0x00, 0xaa, 0x33, 0xa2, 0x77, 0xc0, 0x61, 0xcb, 0x6f, 0xcb, 0x11, 0xc5, 0x55, 0x7a,
+	0xc0, 0x11, 0xad, 0x22, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xc0, 0x97, 0xdd, 0xfe, 0x84, 0x10, 0xfe,
+	0x31, 0x86, 0x65, 0x24, 0xc2, 0x27, 0x2c, 0x24, 0x66, 0x2c, 0x65, 0x1e, 0xa3, 0x86, 0xac, 0x41,
+	0xa9, 0x52, 0x74, 0x75, 0x79, 0x60, 0xa3, 0x66, 0x55, 0xc2, 0x6e, 0xc0, 0x6e, 0xc2, 0x22, 0xc0,
+	0x6b, 0x66, 0xca, 0x1d, 0xc5, 0x29, 0xcc, 0x1d, 0x22, 0x29, 0xc2, 0x2c, 0xca, 0x6e, 0x65, 0xd2,
+	0x66, 0xd1, 0x25, 0xc5, 0x20, 0xc4, 0x25, 0xce, 0x69, 0xc4, 0x7a, 0xc2, 0x5f, 0x5b, 0x2a, 0x21,
+	0xc2, 0x20, 0x24, 0xa2, 0x59, 0x9e, 0x7b, 0x96, 0xbe, 0x96, 0xbe, 0x9d, 0x9b, 0x5b, 0xc4, 0x6f,
+	0xfe, 0x84, 0x0f, 0xfe, 0xde, 0xfb, 0xa8, 0x44, 0xe5, 0x65, 0x31, 0xc0, 0x66, 0x31, 0xfd, 0xfd,
+	0xfd, 0xfc, 0x25, 0x94, 0xee, 0xfe, 0x62, 0xeb, 0x94, 0xee, 0x56, 0xc0, 0x29, 0x2c, 0x24, 0x2c,
+	0x24, 0xc0, 0x7a, 0x55, 0x78, 0xa1, 0x97, 0xa5, 0x74, 0xae, 0x20, 0xa5, 0x83, 0x79, 0x9f, 0xb8,
+	0x64, 0x7e, 0x66, 0x5d, 0xc0, 0x6e, 0xc1, 0x69, 0x5a, 0xc0, 0x13, 0xc1, 0x1a, 0xe6, 0x65, 0xcc,
+	0x13, 0xca, 0x0e, 0xc5, 0x13, 0xd1, 0x0e, 0xc5, 0x13, 0xc4, 0x0e, 0xc5, 0x13, 0xc4, 0x0e, 0xc2,
+	0x69, 0xc1, 0x69, 0x07, 0xc2, 0x66, 0x5f, 0x6b, 0x0e, 0x7a, 0x65, 0x6b, 0xc0, 0x5b, 0xa1, 0x5a,
+	0xa1, 0x59, 0x97, 0xbf, 0xfe, 0x49, 0x82, 0x0d, 0x19, 0x29, 0x66, 0xc0, 0x29, 0x24, 0xc0, 0xae,
+	0x10, 0xfe, 0xc6, 0x17, 0xae, 0x11, 0x6f, 0xe5, 0x66, 0x31, 0x2c, 0x31, 0xfd, 0xfd, 0xfd, 0xfa,
+	0x2c, 0x31, 0x2c, 0xc0, 0x51, 0xfe, 0xb5, 0x95, 0xfe, 0x52, 0x69, 0x24, 0x1d, 0x7f, 0xc0, 0x9d,
+	0xaa, 0x2c, 0x24, 0xc0, 0x27, 0x69, 0x65, 0x79, 0x74, 0xa9, 0x51, 0xab, 0x51, 0xa5, 0x74, 0x74,
+	0x75, 0x7e, 0x65, 0x0c, 0x11, 0x6e, 0x6d, 0xc0, 0x55, 0xc5, 0x6b, 0xca, 0x05, 0xd9, 0x7e, 0x69,
+	0xfd, 0xcd, 0x5b, 0x6b, 0x0a, 0xc1, 0x0d, 0xc0, 0x65, 0x0d, 0x7a, 0x0d, 0x66, 0x6b, 0xc0, 0x66,
+	0x69, 0x7a, 0x66, 0x66, 0xa1, 0x69, 0x5b, 0xa2, 0x59, 0x98, 0xae, 0xfe, 0x61, 0xc1, 0x9b, 0x8c,
+	0xa1, 0x69, 0x20, 0x5b, 0x65, 0x24, 0xc0, 0xa2, 0x76, 0xa6, 0x56, 0xfe, 0xbd, 0xb6, 0xaf, 0x01,
+	0xa3, 0x66, 0xfd, 0xfd, 0xfd, 0xfd, 0xec, 0x18, 0xfe, 0xa5, 0x14, 0xfe, 0x52, 0x89, 0x95, 0xee,
+	0x1d, 0x24, 0x61, 0xa3, 0x66, 0x24, 0xc0, 0x27, 0xc0, 0x20, 0x75, 0x64, 0xa1, 0x96, 0xaa, 0x40,
+	0xac, 0x41, 0xa3, 0x95, 0x70, 0x79, 0x6d, 0x0f, 0xa2, 0x77, 0xa4, 0x54, 0x6e, 0x58, 0x6e, 0x6e,
+	0xf1, 0x7e, 0xc5, 0x6f, 0xfd, 0xc1, 0x5a, 0x6b, 0x09, 0xc1, 0x0c, 0xc0, 0x66, 0x0c, 0x67, 0x65,
+	0x6b, 0x6b, 0x62, 0x9a, 0xdc, 0x9d, 0xaa, 0x7f, 0x0a, 0x67, 0xa1, 0x69, 0x5b, 0x9c, 0x8c, 0xfe,
+	0x72, 0x02, 0x97, 0xbf, 0xa2, 0x57, 0xa2, 0x58, 0x6b, 0x9d, 0x9b, 0x18, 0xa2, 0x67, 0x51, 0x01,
+	0xfe, 0xa5, 0x14, 0xfe, 0xf7, 0xbe, 0x31, 0x66, 0x31, 0xc0, 0x2c, 0x31, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xe6, 0x2c, 0x31, 0xc1, 0xfe, 0x9c, 0xd3, 0xfe, 0x4a, 0x28, 0x24, 0x7e, 0x27, 0x24, 0x69, 0x24,
+	0x27, 0xc1, 0x69, 0x12, 0x74, 0xa1, 0x97, 0xaa, 0x50, 0xad, 0x40, 0xa2, 0x96, 0x9c, 0xb9, 0x7c,
+	0x05, 0xa5, 0x55, 0xa6, 0x33, 0xa3, 0x55, 0x68, 0xa2, 0x66, 0xc0, 0x6d, 0xc0, 0x66, 0x25, 0x1e,
+	0xe6, 0x25, 0xc4, 0x1e, 0xc5, 0x25, 0x6e, 0xfd, 0xc8, 0x25, 0x67, 0xc1, 0x29, 0x3f, 0x9a, 0xdc,
+	0x03, 0x0a, 0xa1, 0x79, 0x5b, 0xa0, 0x7a, 0x9d, 0x8b, 0xfe, 0x7a, 0x22, 0x98, 0xae, 0x09, 0x12,
+	0xa1, 0x79, 0x6b, 0x18, 0x24, 0x69, 0xa3, 0x67, 0xfe, 0x94, 0x92, 0xfe, 0xf7, 0xbe, 0xc0, 0x7e,
+	0x6b, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xed, 0x99, 0xcc, 0xfe, 0x8c, 0x51, 0xfe, 0x42, 0x08, 0x9a,
+	0xba, 0x7b, 0x1d, 0xc0, 0x24, 0x27, 0xc0, 0x24, 0x6e, 0x69, 0xa1, 0x96, 0x9d, 0xb8, 0xa2, 0x86,
+	0xab, 0x50, 0xab, 0x52, 0xa1, 0x95, 0x9e, 0xb6, 0x5d, 0xa2, 0x65, 0xa6, 0x43, 0xa5, 0x54, 0xa4,
+	0x44, 0x23, 0x69, 0x5a, 0xc1, 0x1c, 0xc0, 0x5e, 0xdf, 0x7a, 0xc4, 0x1c, 0xc5, 0x19, 0xfd, 0xc7,
+	0x1e, 0xc4, 0x21, 0xc0, 0x62, 0x6b, 0x2a, 0x62, 0x9c, 0xaa, 0xfe, 0xec, 0xa0, 0x9d, 0xbc, 0x56,
+	0xa0, 0x7a, 0xa1, 0x79, 0xa0, 0x7a, 0x9d, 0x8c, 0xfe, 0x7a, 0x64, 0x0d, 0x04, 0xa2, 0x68, 0x46,
+	0x1d, 0xc1, 0x24, 0xa3, 0x66, 0xfe, 0x7b, 0xce, 0xfe, 0xde, 0xda, 0x31, 0x61, 0x31, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xea, 0x2c, 0x31, 0xc2, 0x2c, 0x96, 0xdd, 0xfe, 0x84, 0x10, 0xfe, 0x31, 0x86, 0x9d,
+	0xa9, 0x7e, 0xc0, 0x27, 0x56, 0x6b, 0x6e, 0x6e, 0x55, 0xa2, 0x75, 0x74, 0x70, 0xa3, 0x85, 0xab,
+	0x51, 0xa8, 0x72, 0xa2, 0xa5, 0x58, 0x58, 0xa3, 0x54, 0xa5, 0x54, 0xa6, 0x43, 0xa3, 0x55, 0x23,
+	0x6d, 0xea, 0x66, 0xc4, 0x21, 0xd3, 0x1c, 0xf1, 0x21, 0x5a, 0xc0, 0x21, 0xc1, 0x1c, 0x23, 0x66,
+	0x25, 0x67, 0x9d, 0xaa, 0x9a, 0xcc, 0x9b, 0xdd, 0x77, 0x5b, 0xa0, 0x7a, 0xa1, 0x6a, 0x9b, 0x9d,
+	0x98, 0xae, 0xfe, 0x49, 0x41, 0x5b, 0x4b, 0x20, 0x1d, 0x6f, 0x24, 0xc0, 0xa3, 0x76, 0xae, 0x11,
+	0x2d, 0x2c, 0x65, 0x31, 0xc0, 0x2c, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xea, 0x2c, 0x31, 0xc0, 0x2c,
+	0x69, 0x94, 0xef, 0xfe, 0x5a, 0xcb, 0x24, 0x7a, 0x6d, 0x27, 0x56, 0x26, 0x5e, 0x6e, 0x69, 0x69,
+	0x79, 0x78, 0x9e, 0xc9, 0xa3, 0x85, 0xa7, 0x83, 0xaa, 0x82, 0xa3, 0x65, 0x5c, 0x58, 0xa4, 0x43,
+	0xa5, 0x53, 0xa6, 0x43, 0xa2, 0x66, 0x1e, 0xc0, 0x6e, 0xc3, 0x69, 0xc5, 0x6f, 0xc2, 0x23, 0xd7,
+	0x1c, 0x6e, 0xcb, 0x1c, 0xfd, 0xc7, 0x1e, 0x66, 0x6b, 0x6b, 0x9d, 0xbb, 0x2b, 0x9b, 0xcc, 0x76,
+	0x53, 0x57, 0xa2, 0x5a, 0x9f, 0x7b, 0x01, 0x14, 0x47, 0xa1, 0x69, 0x5a, 0x24, 0x29, 0x24, 0x65,
+	0x24, 0xab, 0x33, 0xfe, 0xbd, 0xd7, 0xaf, 0x11, 0x2c, 0xc0, 0x31, 0x2c, 0x31, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xef, 0x2c, 0xc0, 0x96, 0xdd, 0xfe, 0x6b, 0x4d, 0x18, 0x29, 0x24, 0x55, 0x29, 0xa2, 0x77,
+	0x9d, 0x99, 0x29, 0x69, 0xc0, 0x79, 0x65, 0x66, 0xa2, 0xa5, 0xaa, 0x71, 0xac, 0x20, 0x7d, 0x9e,
+	0x96, 0xa4, 0x63, 0x7c, 0xa6, 0x43, 0x16, 0xa3, 0x55, 0x69, 0x69, 0x6e, 0x21, 0x1c, 0x21, 0xc0,
+	0x1c, 0xc4, 0x21, 0xc2, 0x1c, 0xfd, 0xdb, 0x21, 0xc2, 0x1c, 0xc7, 0x21, 0xc3, 0x1c, 0x1e, 0x25,
+	0x67, 0x9c, 0xcc, 0x9a, 0xdc, 0x03, 0x77, 0x6b, 0x57, 0xa1, 0x69, 0x9e, 0x7c, 0xfe, 0x82, 0x84,
+	0x96, 0xae, 0x9e, 0x8c, 0xa3, 0x57, 0x5b, 0x15, 0x7f, 0xa2, 0x77, 0x9d, 0xaa, 0x18, 0xac, 0x12,
+	0xfe, 0xb5, 0x96, 0xb0, 0x00, 0x31, 0x62, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xf4, 0x2c, 0xfe, 0xbd,
+	0xb6, 0xfe, 0x63, 0x2c, 0x93, 0xfe, 0x29, 0x7a, 0x1d, 0x55, 0x31, 0x25, 0xc0, 0x22, 0xc0, 0x1d,
+	0x69, 0x10, 0xa1, 0xa6, 0xab, 0x30, 0xab, 0x40, 0xa4, 0x73, 0x9f, 0x96, 0x78, 0xa3, 0x74, 0xa3,
+	0x66, 0xa5, 0x43, 0xa3, 0x55, 0x6e, 0x1c, 0x21, 0xc1, 0x1c, 0xc6, 0x21, 0xc1, 0x1c, 0xfd, 0xdb,
+	0x21, 0xc5, 0x1c, 0xc6, 0x21, 0xc0, 0x1c, 0xc0, 0x1e, 0x67, 0x63, 0x99, 0xed, 0x99, 0xce, 0x7b,
+	0xa1, 0x99, 0x9e, 0x7a, 0xa2, 0x68, 0x9d, 0x8c, 0xfe, 0x8a, 0x83, 0x96, 0xbf, 0x9e, 0x7b, 0xa2,
+	0x58, 0x31, 0x9d, 0x9a, 0xa2, 0x77, 0x3d, 0x9b, 0xcb, 0xa2, 0x78, 0xae, 0x00, 0xfe, 0xad, 0x75,
+	0x18, 0xa3, 0x66, 0xfd, 0xfd, 0xfd, 0xfd, 0xf8, 0x18, 0x93, 0xee, 0xfe, 0x6b, 0x4c, 0x92, 0xff,
+	0x51, 0x7f, 0x1d, 0x22, 0x25, 0x22, 0xc1, 0x1d, 0x69, 0x75, 0x9f, 0xb8, 0xa3, 0x74, 0xac, 0x30,
+	0xaa, 0x51, 0xa2, 0x95, 0x9e, 0xa6, 0x69, 0x03, 0xa5, 0x54, 0xa7, 0x22, 0xa3, 0x55, 0x68, 0x5a,
+	0x21, 0x1c, 0xc2, 0x21, 0x1c, 0xc3, 0x23, 0x1c, 0xfd, 0xe9, 0x21, 0x5a, 0x66, 0x14, 0x17, 0x6b,
+	0x25, 0x9b, 0xcc, 0x9a, 0xdd, 0x9d, 0xab, 0x63, 0x67, 0x7b, 0xa1, 0x5a, 0x9b, 0x9d, 0x96, 0xbe,
+	0x10, 0x47, 0xa2, 0x58, 0x47, 0xa2, 0x67, 0x51, 0x2e, 0x66, 0x9d, 0xaa, 0xae, 0x11, 0xfe, 0xbd,
+	0xb6, 0xae, 0x01, 0xa4, 0x66, 0x66, 0xc0, 0x31, 0x2c, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xef, 0x2c,
+	0x31, 0xc0, 0x2c, 0x31, 0xc0, 0x51, 0x93, 0xff, 0xfe, 0x63, 0x2c, 0xfe, 0x29, 0x44, 0x29, 0x7e,
+	0x1d, 0x22, 0xc2, 0x1d, 0xc0, 0x79, 0x7a, 0x60, 0xa2, 0x85, 0xaa, 0x61, 0xaa, 0x51, 0xa3, 0x84,
+	0x7d, 0x07, 0xa3, 0x64, 0xa6, 0x33, 0x16, 0x6d, 0x1e, 0x6d, 0xc0, 0x56, 0x6e, 0x1c, 0x6e, 0xc0,
+	0x1c, 0xc1, 0x23, 0x1e, 0x23, 0x1c, 0xfd, 0xe8, 0x6f, 0x56, 0x14, 0x1e, 0x66, 0x62, 0x62, 0x9b,
+	0xbc, 0x9c, 0xbc, 0x63, 0xa0, 0x8a, 0x57, 0x6b, 0x9c, 0x7d, 0xfe, 0x7a, 0x43, 0x97, 0xbe, 0x0c,
+	0xa0, 0x7a, 0x5b, 0x29, 0x56, 0x2e, 0x55, 0x66, 0xaa, 0x33, 0xfe, 0xa5, 0x55, 0x09, 0xa3, 0x77,
+	0x55, 0xa2, 0x77, 0xfd, 0xfd, 0xfd, 0xfd, 0xf3, 0x1d, 0x31, 0xc4, 0x65, 0xfe, 0xc6, 0x18, 0x30,
+	0x29, 0x65, 0x29, 0x1d, 0xc6, 0x75, 0x9e, 0xb7, 0xa2, 0x96, 0xa9, 0x52, 0xaa, 0x61, 0xa6, 0x64,
+	0xa0, 0x85, 0x64, 0xa2, 0x64, 0xa5, 0x43, 0xa6, 0x43, 0xa3, 0x55, 0x1e, 0x23, 0x69, 0x6e, 0xc2,
+	0x1c, 0xc1, 0x66, 0x1e, 0xc0, 0x1c, 0xfd, 0xdc, 0x23, 0xc0, 0x1c, 0xc7, 0x21, 0x57, 0x66, 0x1e,
+	0x6b, 0x61, 0x9a, 0xdd, 0x9b, 0xcd, 0x03, 0xa1, 0x79, 0x53, 0xa1, 0x79, 0x57, 0x98, 0xbd, 0xfe,
+	0x6a, 0x02, 0x9a, 0xae, 0x42, 0x6f, 0x5b, 0x5a, 0x5f, 0xc0, 0xa2, 0x66, 0xc0, 0xa9, 0x43, 0xfe,
+	0x9d, 0x34, 0xb0, 0x00, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xf6, 0x66, 0x31, 0xc6, 0x93, 0xfe, 0xfe,
+	0x6b, 0x4d, 0x93, 0xee, 0x65, 0x1d, 0xc3, 0x7e, 0x29, 0x6b, 0x79, 0x79, 0x9c, 0xc9, 0xa1, 0xa6,
+	0xa8, 0x52, 0xaa, 0x52, 0xa6, 0x63, 0xa2, 0x74, 0x9f, 0x96, 0xa3, 0x64, 0xa5, 0x53, 0xa3, 0x65,
+	0xa5, 0x33, 0x6e, 0x6e, 0x6e, 0x69, 0xc2, 0x1c, 0xfd, 0xe1, 0x23, 0xc0, 0x1c, 0xc1, 0x21, 0xc2,
+	0x1c, 0xc1, 0x57, 0x1e, 0x6b, 0x9d, 0xba, 0x9b, 0xdc, 0x9b, 0xbd, 0x9d, 0xab, 0x67, 0xa1, 0x6a,
+	0x22, 0xa0, 0x7a, 0x99, 0xad, 0xfe, 0x61, 0xa0, 0x9c, 0x8c, 0xa0, 0x6b, 0x56, 0x7f, 0xa3, 0x57,
+	0x66, 0x40, 0xa3, 0x66, 0xc0, 0xac, 0x12, 0xfe, 0xad, 0xb6, 0xae, 0x11, 0xa4, 0x66, 0x76, 0x6e,
+	0xc1, 0x2c, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xfb, 0xfe, 0xc6, 0x18, 0xfe, 0x73, 0x6d, 0x3d, 0x1d,
+	0xc0, 0x7f, 0x59, 0x1d, 0xc0, 0x2c, 0x57, 0x65, 0x7d, 0x75, 0x64, 0xa0, 0xa7, 0xa7, 0x53, 0xab,
+	0x41, 0xa8, 0x62, 0xa1, 0x84, 0x78, 0x7c, 0x10, 0xa8, 0x21, 0xa3, 0x55, 0x6f, 0x1e, 0x69, 0xc0,
+	0x1c, 0x21, 0xc0, 0x1c, 0xfd, 0xe2, 0x21, 0xc2, 0x1c, 0x21, 0x1c, 0xc1, 0x6b, 0x67, 0x20, 0x9d,
+	0xba, 0x9b, 0xcc, 0x9b, 0xbd, 0x3e, 0xa0, 0x8a, 0x9f, 0x8b, 0xa0, 0x7a, 0x9e, 0x7b, 0x97, 0xbe,
+	0x96, 0xbe, 0x42, 0xa0, 0x7a, 0x4b, 0x67, 0xc0, 0x24, 0xc0, 0x29, 0x7e, 0xa6, 0x45, 0xfe, 0x9d,
+	0x13, 0xfe, 0xf7, 0xde, 0x7f, 0xc2, 0x66, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0x2c, 0x31, 0x96,
+	0xed, 0xfe, 0x83, 0xef, 0xfe, 0x39, 0xa6, 0x51, 0x55, 0x6e, 0x1d, 0x18, 0x7f, 0x6b, 0x27, 0xc0,
+	0x6d, 0x69, 0x65, 0x70, 0xa5, 0x84, 0xab, 0x40, 0xa8, 0x62, 0xa2, 0x85, 0x0e, 0x6c, 0xa4, 0x43,
+	0xa5, 0x64, 0xa3, 0x56, 0xa2, 0x66, 0xa2, 0x65, 0x17, 0x1c, 0x21, 0xc1, 0x5a, 0xc0, 0x21, 0x1c,
+	0xfd, 0xdd, 0x21, 0xc3, 0x1c, 0xc1, 0x23, 0x66, 0xc0, 0x0f, 0x9c, 0xbc, 0x9c, 0xbb, 0x08, 0x3e,
+	0x0c, 0x9f, 0x8c, 0xa0, 0x7a, 0x9b, 0x9d, 0x97, 0xae, 0x98, 0xad, 0x43, 0x5f, 0x5e, 0x16, 0x1d,
+	0xc0, 0x7f, 0xc0, 0x65, 0xac, 0x11, 0xfe, 0xad, 0x54, 0xb0, 0x00, 0xa4, 0x66, 0x6b, 0x31, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xc1, 0x2c, 0xc0, 0x31, 0x2c, 0x99, 0xbb, 0xfe, 0x94, 0x71, 0x91, 0xff,
+	0x94, 0xee, 0xc0, 0xa4, 0x66, 0x65, 0x9d, 0xab, 0x7f, 0x27, 0x59, 0x6e, 0xc0, 0x1b, 0x70, 0x75,
+	0xa3, 0x95, 0xa9, 0x51, 0xa8, 0x63, 0xa6, 0x63, 0xa2, 0x75, 0x9f, 0x85, 0x6e, 0x26, 0xa6, 0x44,
+	0xa4, 0x44, 0x65, 0x1e, 0x6d, 0x6e, 0xc0, 0x6e, 0x5a, 0x66, 0x1c, 0xfd, 0xdb, 0x21, 0xc4, 0x1c,
+	0xc0, 0x17, 0x6b, 0x6b, 0x62, 0x51, 0x9b, 0xcc, 0x9c, 0xbc, 0x52, 0x67, 0xa1, 0x7a, 0x9f, 0x9b,
+	0x43, 0x99, 0xae, 0x97, 0xbe, 0x9a, 0x9c, 0x10, 0xa2, 0x58, 0x22, 0xc0, 0x69, 0x25, 0xc0, 0x1d,
+	0xa3, 0x77, 0xa7, 0x54, 0xfe, 0xc6, 0x16, 0xac, 0x22, 0xa3, 0x67, 0x9d, 0xaa, 0xa2, 0x78, 0xc0,
+	0x6e, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xc1, 0x2c, 0x31, 0xc1, 0x2c, 0xfe, 0xb5, 0x75, 0xfe, 0x5a,
+	0xaa, 0x96, 0xdd, 0x1d, 0x7a, 0x27, 0x66, 0x20, 0x1d, 0x6e, 0x6e, 0xc0, 0x7a, 0x9d, 0xb9, 0x70,
+	0xa2, 0x96, 0xa7, 0x62, 0xab, 0x41, 0xa7, 0x53, 0xa1, 0x74, 0x60, 0x6d, 0xa4, 0x65, 0xa6, 0x43,
+	0xa3, 0x65, 0xa2, 0x65, 0x1e, 0x6d, 0x21, 0xc0, 0x5a, 0xc0, 0x1c, 0xfd, 0xdb, 0x21, 0x1e, 0x66,
+	0xc0, 0x1c, 0xc1, 0x67, 0x20, 0xc0, 0x67, 0x9c, 0xba, 0x9b, 0xbc, 0x63, 0x02, 0x6b, 0xa2, 0x69,
+	0xa0, 0x7a, 0x9a, 0xbe, 0x99, 0xad, 0xfe, 0x51, 0x41, 0x9e, 0x7a, 0xa1, 0x69, 0x25, 0x6b, 0x5e,
+	0x16, 0x2a, 0x6b, 0x9d, 0xa9, 0x7f, 0xb0, 0x00, 0xfe, 0xc5, 0xf6, 0xaf, 0x01, 0x65, 0x56, 0x25,
+	0x6f, 0x66, 0xc0, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xc5, 0x9d, 0xaa, 0xfe, 0xb5, 0x96, 0x35,
+	0xfe, 0x31, 0x65, 0x9d, 0x99, 0xa2, 0x77, 0x20, 0x1d, 0xc0, 0x6e, 0x6b, 0xc0, 0x1d, 0x7e, 0x76,
+	0x04, 0x79, 0xa7, 0x53, 0xa8, 0x62, 0xa8, 0x51, 0xa4, 0x65, 0xa1, 0x97, 0x9f, 0x86, 0x7d, 0xa5,
+	0x63, 0xa5, 0x44, 0x6d, 0xa2, 0x65, 0xa2, 0x66, 0xc0, 0x21, 0xc0, 0x1c, 0xfd, 0xdb, 0x5a, 0xc1,
+	0x1c, 0xc0, 0x23, 0x67, 0x66, 0x67, 0x9d, 0xbb, 0x35, 0x9c, 0xab, 0x9d, 0xaa, 0x9f, 0x9b, 0xa1,
+	0x79, 0xa2, 0x69, 0x43, 0x99, 0xad, 0x96, 0xbf, 0x99, 0xbd, 0x47, 0x5f, 0x6b, 0x1d, 0x56, 0x29,
+	0x79, 0x55, 0x62, 0xa5, 0x56, 0xaf, 0x01, 0xfe, 0xce, 0x38, 0x31, 0x69, 0x66, 0x2a, 0x31, 0x61,
+	0x6f, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xc3, 0x2c, 0x31, 0xc1, 0x9c, 0xba, 0x92, 0xff, 0xfe,
+	0x73, 0x6d, 0x93, 0xee, 0x9b, 0xbb, 0xa2, 0x66, 0x1d, 0x22, 0xc0, 0x7b, 0x66, 0x52, 0x7e, 0x7f,
+	0x68, 0x54, 0x79, 0xa2, 0x96, 0xa9, 0x50, 0xa8, 0x53, 0xa7, 0x53, 0x79, 0x9f, 0x96, 0x7c, 0xa5,
+	0x64, 0xa3, 0x64, 0xa3, 0x55, 0xa2, 0x66, 0x1e, 0x6e, 0x6e, 0x65, 0xfd, 0xdc, 0x21, 0x28, 0xc0,
+	0x23, 0x1e, 0x63, 0x9d, 0xbb, 0x52, 0x9c, 0xbb, 0x9c, 0xbc, 0x52, 0x7f, 0xa0, 0x8b, 0x9f, 0x8b,
+	0x9c, 0x8b, 0x99, 0xad, 0x98, 0xae, 0x9c, 0x8b, 0x47, 0xa1, 0x79, 0x2c, 0xc1, 0x1d, 0x16, 0x7f,
+	0x2c, 0xa5, 0x66, 0xfe, 0x84, 0x11, 0xfe, 0xd6, 0x7b, 0xab, 0x21, 0x6e, 0x56, 0x2a, 0xc1, 0x31,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xc6, 0x2c, 0x31, 0x2c, 0xc0, 0x51, 0x98, 0xcc, 0xfe, 0x8c, 0x30,
+	0xfe, 0x4a, 0x28, 0x9b, 0x99, 0x66, 0xc0, 0x20, 0x6b, 0x66, 0x6b, 0xc1, 0x6e, 0x5d, 0x1d, 0x0d,
+	0xa1, 0xb5, 0xa4, 0x75, 0xaa, 0x41, 0xa8, 0x53, 0xa2, 0x85, 0xa0, 0x95, 0x78, 0xa2, 0x65, 0xa4,
+	0x64, 0xa4, 0x55, 0x14, 0x6f, 0xa2, 0x65, 0x1c, 0xd4, 0x6e, 0xc2, 0x1c, 0xfd, 0xc2, 0x23, 0x6e,
+	0x23, 0x62, 0x52, 0x9d, 0xbb, 0x9b, 0xbc, 0x63, 0x52, 0x9f, 0xab, 0x6b, 0x66, 0x9f, 0x7b, 0x98,
+	0xbf, 0x96, 0xce, 0x9b, 0x8c, 0x4b, 0xa1, 0x69, 0x1d, 0xa1, 0x79, 0xc0, 0x55, 0x1d, 0x25, 0x65,
+	0x52, 0xa9, 0x35, 0xfe, 0x9c, 0xd4, 0xb1, 0x00, 0xa6, 0x44, 0xc0, 0x31, 0xc0, 0x5a, 0x69, 0xc1,
+	0x2a, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xca, 0x99, 0xcc, 0x93, 0xee, 0xfe, 0x4a, 0x48, 0x1d,
+	0x66, 0x7f, 0xc1, 0x6f, 0x27, 0x1f, 0x6e, 0x1d, 0x6e, 0x25, 0x9f, 0xa6, 0x76, 0x7d, 0xa7, 0x63,
+	0xaa, 0x52, 0xa7, 0x63, 0x9f, 0x96, 0x78, 0x7d, 0xa3, 0x64, 0xa4, 0x54, 0xa4, 0x55, 0x1b, 0x20,
+	0x6e, 0x1e, 0x69, 0x5a, 0x7e, 0x6e, 0xc0, 0x1c, 0xc3, 0x21, 0xc8, 0x5a, 0xc0, 0x21, 0xca, 0x1c,
+	0xc0, 0x21, 0xcb, 0x1c, 0xc0, 0x21, 0xc9, 0x1c, 0xc3, 0x21, 0xc0, 0x1c, 0xc6, 0x21, 0xc2, 0x1e,
+	0xc0, 0x66, 0x1c, 0x28, 0x23, 0x6b, 0x65, 0x66, 0x25, 0x1b, 0x9a, 0xdc, 0x9c, 0xbc, 0x67, 0x05,
+	0x43, 0xa1, 0x79, 0x36, 0x9d, 0x9b, 0x9b, 0xab, 0xfe, 0x7a, 0x64, 0x98, 0xae, 0x9c, 0xaa, 0xa3,
+	0x57, 0x6b, 0x56, 0xa2, 0x67, 0xa1, 0x79, 0x1d, 0x6f, 0x7a, 0x18, 0x1d, 0xa9, 0x44, 0xfe, 0xad,
+	0x55, 0xfe, 0xf7, 0x9e, 0xa2, 0x77, 0xc0, 0x6e, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd3, 0x9c, 0xba,
+	0x92, 0xff, 0xfe, 0x62, 0xeb, 0x94, 0xee, 0x1d, 0x2c, 0x51, 0x2c, 0xc2, 0x29, 0x66, 0x25, 0x50,
+	0x7a, 0x75, 0xa1, 0x97, 0xa5, 0x74, 0xa7, 0x64, 0xa9, 0x51, 0xa4, 0x64, 0x7c, 0x9e, 0xa7, 0x68,
+	0x17, 0xa6, 0x43, 0xa3, 0x56, 0xa2, 0x66, 0xa2, 0x66, 0x2a, 0x6d, 0x69, 0xc3, 0x66, 0xc1, 0x21,
+	0xce, 0x1c, 0xc9, 0x21, 0xc9, 0x1c, 0xc9, 0x21, 0xc0, 0x1c, 0xc4, 0x21, 0xc1, 0x1c, 0xc3, 0x66,
+	0xc1, 0x1c, 0x21, 0xc0, 0x26, 0xc0, 0x21, 0x67, 0x1e, 0x6b, 0x66, 0xc0, 0x9d, 0xba, 0x9d, 0xaa,
+	0x9d, 0xbb, 0x9c, 0xbc, 0x67, 0xa1, 0x79, 0x9c, 0xac, 0xa2, 0x69, 0x30, 0x9c, 0x8b, 0x98, 0xbd,
+	0x99, 0xbc, 0x9c, 0x7d, 0xa0, 0x6a, 0x65, 0x56, 0x7f, 0x25, 0x52, 0x65, 0xa3, 0x67, 0x5a, 0x9d,
+	0xaa, 0xa7, 0x54, 0xae, 0x11, 0xfe, 0xc5, 0xf8, 0xae, 0x00, 0xa2, 0x77, 0x1d, 0x7f, 0x31, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xd4, 0x9d, 0xa9, 0x97, 0xcd, 0xfe, 0x8c, 0x50, 0xfe, 0x42, 0x08, 0x24,
+	0x29, 0x24, 0x69, 0xc0, 0x24, 0x18, 0xc0, 0x1d, 0x6e, 0x19, 0x7a, 0x65, 0x74, 0xa3, 0x85, 0xa5,
+	0x75, 0xa7, 0x52, 0xa8, 0x52, 0xa4, 0x64, 0x79, 0x58, 0x07, 0xa3, 0x84, 0xa3, 0x66, 0xa4, 0x45,
+	0xa3, 0x55, 0x1e, 0x5d, 0x6e, 0xc1, 0x21, 0x66, 0xfb, 0x21, 0xc3, 0x1c, 0xc3, 0x21, 0xc2, 0x1c,
+	0x23, 0x66, 0x6b, 0x1b, 0x0a, 0x9d, 0xab, 0x9d, 0xaa, 0x9d, 0xab, 0x08, 0x05, 0x5b, 0xa0, 0x8a,
+	0xa0, 0x7a, 0x9c, 0x9c, 0x9a, 0xac, 0x99, 0xad, 0x9b, 0x9c, 0x9d, 0x9a, 0xa0, 0x6a, 0x6f, 0x6b,
+	0x55, 0xc0, 0x20, 0xc0, 0x56, 0xc1, 0x2f, 0xfe, 0x94, 0xb2, 0xb1, 0x00, 0x2c, 0x6e, 0x2c, 0xc0,
+	0x31, 0xc0, 0x2c, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd1, 0x2c, 0x69, 0x31, 0x9a, 0xcb, 0xfe,
+	0x9c, 0xd3, 0xfe, 0x62, 0xeb, 0x97, 0xcc, 0x9d, 0xaa, 0x56, 0x29, 0x2c, 0xc0, 0x24, 0xc0, 0x29,
+	0x1d, 0x20, 0x79, 0x15, 0x75, 0x00, 0xa3, 0x85, 0xa8, 0x41, 0xa9, 0x42, 0xa6, 0x64, 0xa2, 0x76,
+	0x70, 0x9f, 0xc5, 0xa2, 0x66, 0xa3, 0x56, 0xa4, 0x54, 0xa4, 0x55, 0xa3, 0x55, 0x1e, 0x6d, 0xfd,
+	0x6e, 0xc6, 0x28, 0xc0, 0x21, 0x1c, 0xc0, 0x23, 0x1e, 0xc0, 0x20, 0x1b, 0x9d, 0xbb, 0x33, 0x1f,
+	0x08, 0x07, 0x6b, 0x6b, 0xa0, 0x8a, 0x53, 0x42, 0x9a, 0xad, 0x98, 0xad, 0x9a, 0xac, 0x43, 0x10,
+	0x5a, 0xa2, 0x67, 0x52, 0xc0, 0xa2, 0x77, 0xc0, 0x66, 0x2c, 0x55, 0xa2, 0x78, 0xad, 0x21, 0xfe,
+	0xbd, 0xb6, 0xad, 0x12, 0xa4, 0x66, 0xc0, 0x31, 0x2c, 0xc0, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xd5, 0x2c, 0x69, 0x31, 0x9c, 0xba, 0x96, 0xcd, 0xfe, 0x7b, 0xcf, 0x91, 0xff, 0x9b, 0xbb, 0x55,
+	0xa2, 0x77, 0x7f, 0x65, 0x24, 0xc0, 0x7f, 0x1d, 0x66, 0x20, 0x19, 0x79, 0x64, 0x7a, 0xa4, 0x74,
+	0xa7, 0x54, 0xa8, 0x53, 0xa3, 0x95, 0xa1, 0xb4, 0x6d, 0x6e, 0xa2, 0x65, 0xa2, 0x65, 0xa3, 0x65,
+	0xa4, 0x55, 0xa2, 0x66, 0xa3, 0x65, 0x6e, 0x28, 0x65, 0xc0, 0x23, 0xc0, 0x1c, 0xf3, 0x21, 0xc3,
+	0x5a, 0xc0, 0x21, 0xc1, 0x1e, 0x28, 0x23, 0xc0, 0x66, 0x66, 0x1b, 0x62, 0x9d, 0xba, 0x1f, 0x12,
+	0x08, 0x56, 0xa0, 0x8b, 0xa1, 0x89, 0x56, 0x57, 0x9c, 0x9c, 0x9a, 0xac, 0x9a, 0xad, 0x99, 0xbd,
+	0x9e, 0x7a, 0x10, 0x5b, 0x1d, 0xc1, 0x20, 0x55, 0x1d, 0xc2, 0xa6, 0x55, 0xb0, 0x01, 0xfe, 0xd6,
+	0x9a, 0xaa, 0x33, 0x31, 0x2c, 0xc0, 0x31, 0xc0, 0x2c, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd6,
+	0x2c, 0x31, 0xc0, 0x2c, 0x9a, 0xbb, 0xfe, 0x9c, 0xb2, 0x93, 0xef, 0x95, 0xdd, 0x9c, 0xaa, 0x7f,
+	0x29, 0x24, 0x27, 0x33, 0x69, 0x24, 0x6d, 0xc0, 0x7a, 0x69, 0x70, 0x65, 0xa1, 0x97, 0xa5, 0x55,
+	0xa5, 0x74, 0xfe, 0xbb, 0xa4, 0xa4, 0x66, 0xa3, 0x85, 0x2b, 0x60, 0x6d, 0xa2, 0x75, 0xa3, 0x65,
+	0xa3, 0x54, 0xa3, 0x56, 0xa3, 0x65, 0x5e, 0x6e, 0x7a, 0xc0, 0x69, 0xc2, 0x6e, 0xc0, 0x5a, 0xc3,
+	0x1c, 0xe5, 0x21, 0xc7, 0x1c, 0xc2, 0x23, 0xc0, 0x66, 0x67, 0x61, 0x9d, 0xbb, 0x52, 0x9c, 0xbc,
+	0x52, 0x56, 0x67, 0x6f, 0x6e, 0x9f, 0x8c, 0x57, 0x05, 0x99, 0xbd, 0x9a, 0xac, 0x99, 0xad, 0x9c,
+	0x9c, 0xa2, 0x68, 0xa2, 0x67, 0x2c, 0x24, 0x6e, 0xc0, 0x1d, 0x7a, 0x25, 0x51, 0x56, 0xa6, 0x55,
+	0xa9, 0x44, 0xfe, 0xad, 0x55, 0xae, 0x10, 0xa7, 0x45, 0x66, 0x55, 0x31, 0x2c, 0x31, 0xc2, 0x2c,
+	0x1d, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd5, 0x2c, 0xc0, 0x31, 0xc0, 0x94, 0xfe, 0xfe, 0x7b,
+	0xef, 0xfe, 0x42, 0x08, 0x9b, 0xaa, 0xc0, 0x7a, 0x66, 0x51, 0xa2, 0x67, 0xa2, 0x66, 0x29, 0x5a,
+	0x22, 0xc0, 0x75, 0x14, 0x0b, 0x69, 0x7d, 0xa3, 0x85, 0xa8, 0x52, 0xa8, 0x54, 0xa4, 0x85, 0x79,
+	0x79, 0x7c, 0x6d, 0x6d, 0x12, 0xa4, 0x44, 0xa5, 0x54, 0xa3, 0x66, 0x1e, 0xc0, 0x23, 0xc0, 0x69,
+	0xc1, 0x21, 0x5a, 0xc0, 0x5e, 0xc0, 0x7a, 0x21, 0xc0, 0x1c, 0xc2, 0x21, 0xd9, 0x1c, 0xc1, 0x21,
+	0xc2, 0x1e, 0xc0, 0x21, 0x1c, 0xc3, 0x67, 0xc1, 0x66, 0x66, 0x66, 0x62, 0x52, 0x9c, 0xbb, 0x9d,
+	0xab, 0x0a, 0x6b, 0x57, 0x6f, 0x5b, 0x67, 0x56, 0x9d, 0x8c, 0x9b, 0xac, 0x97, 0xcd, 0x98, 0xbe,
+	0x56, 0xa2, 0x67, 0xa0, 0x7a, 0x5a, 0x6f, 0x2c, 0x5b, 0x24, 0x56, 0x29, 0x61, 0x20, 0xa3, 0x66,
+	0xa3, 0x67, 0xae, 0x12, 0xfe, 0xce, 0x58, 0xad, 0x12, 0xc9, 0x66, 0x31, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xd9, 0x2c, 0x31, 0x9c, 0xaa, 0xfe, 0xb5, 0x96, 0xfe, 0x73, 0x8e, 0x95, 0xdd, 0x9a, 0xcb,
+	0x61, 0x5a, 0xc0, 0x29, 0xc0, 0x5a, 0xc0, 0x65, 0x7a, 0x20, 0x7a, 0x66, 0x17, 0x5c, 0x7a, 0xa2,
+	0x97, 0xa6, 0x74, 0xa7, 0x73, 0xa3, 0x86, 0xa2, 0x85, 0xa2, 0x85, 0xa2, 0x65, 0x68, 0x5c, 0xa2,
+	0x66, 0xa2, 0x76, 0xa3, 0x65, 0xa2, 0x76, 0x0f, 0x6e, 0x6e, 0x6d, 0xc0, 0x6e, 0x21, 0x5a, 0xc0,
+	0x5e, 0x7a, 0x1e, 0x21, 0xc2, 0x1e, 0xd8, 0x21, 0x1e, 0x66, 0xc0, 0x21, 0xc2, 0x1e, 0x6b, 0x76,
+	0xc0, 0x1c, 0xc0, 0x17, 0x67, 0xc0, 0x14, 0x0f, 0x62, 0x61, 0x52, 0x62, 0x52, 0x52, 0x3e, 0x0c,
+	0x1a, 0x5b, 0x22, 0x57, 0x42, 0x9b, 0xab, 0x9a, 0xac, 0x9a, 0x9c, 0x9d, 0x9b, 0x52, 0x5a, 0x6b,
+	0x5f, 0x6b, 0x24, 0xc0, 0x18, 0xa2, 0x67, 0xc1, 0x65, 0x7e, 0xa3, 0x67, 0xab, 0x33, 0xfe, 0xb5,
+	0x75, 0xae, 0x11, 0xa5, 0x55, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xe8, 0x25, 0x9b, 0xab, 0xfe,
+	0xad, 0x55, 0xfe, 0x73, 0x6d, 0x93, 0xfe, 0x20, 0x18, 0xa3, 0x67, 0xc0, 0x40, 0x7b, 0x29, 0x24,
+	0x18, 0x1b, 0xc0, 0x20, 0x59, 0x19, 0x65, 0x04, 0xa3, 0x96, 0xa5, 0x75, 0xa7, 0x52, 0xa3, 0x85,
+	0xa4, 0x64, 0xa4, 0x75, 0x2b, 0x65, 0x54, 0x00, 0x7e, 0x12, 0x7e, 0xa3, 0x65, 0xa2, 0x77, 0xa2,
+	0x66, 0x14, 0x6e, 0x6e, 0xa2, 0x66, 0x23, 0xc0, 0x1c, 0xc5, 0x6e, 0xc0, 0x5a, 0x21, 0x1e, 0xd2,
+	0x1c, 0x21, 0xc0, 0x1c, 0xc1, 0x56, 0xc0, 0x7b, 0x6b, 0x2a, 0x25, 0x66, 0x65, 0x66, 0x62, 0x62,
+	0x9d, 0xab, 0x51, 0x66, 0x6b, 0x08, 0x3e, 0x5b, 0x09, 0xa0, 0x8a, 0x6b, 0x9f, 0x8b, 0x42, 0x9c,
+	0x9b, 0x9b, 0xac, 0x9b, 0x9b, 0x9c, 0x9a, 0x9c, 0xab, 0xa1, 0x69, 0x4a, 0x0d, 0x5b, 0x16, 0x1d,
+	0xc0, 0x7f, 0x51, 0xc0, 0xa3, 0x66, 0x61, 0x18, 0x2c, 0xab, 0x22, 0xb0, 0x00, 0xad, 0x12, 0xa8,
+	0x54, 0xa4, 0x56, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xec, 0x51, 0x98, 0xdc, 0xfe, 0x9c, 0xb2, 0xfe,
+	0x5a, 0xaa, 0x18, 0x9d, 0xaa, 0xa4, 0x56, 0xa3, 0x76, 0x2c, 0x5a, 0x24, 0xc0, 0x2c, 0xc0, 0x18,
+	0x24, 0x2c, 0xc0, 0x20, 0x75, 0x69, 0xa1, 0x96, 0xa2, 0x86, 0xa4, 0x85, 0xa7, 0x63, 0xa6, 0x64,
+	0xa4, 0x75, 0x7d, 0x58, 0x69, 0x79, 0x69, 0x3e, 0xa2, 0x66, 0xa2, 0x76, 0x1a, 0xa2, 0x76, 0x3b,
+	0xa3, 0x56, 0xa2, 0x66, 0xc0, 0x25, 0xc1, 0x69, 0xc1, 0x23, 0xc0, 0x1c, 0xc0, 0x56, 0xc1, 0x1c,
+	0x23, 0xc3, 0x1e, 0xc4, 0x14, 0xc1, 0x6e, 0x1c, 0xc0, 0x23, 0xc1, 0x1e, 0xc0, 0x25, 0xc1, 0x6b,
+	0x66, 0x66, 0x11, 0x9d, 0xaa, 0x52, 0x1a, 0x52, 0x7b, 0x6b, 0x52, 0x0c, 0x67, 0x10, 0x6b, 0x6f,
+	0xa1, 0x79, 0x52, 0x9c, 0x9c, 0x9a, 0xbc, 0x97, 0xbe, 0x9d, 0x9a, 0x9d, 0x8b, 0x56, 0x04, 0x6f,
+	0xa2, 0x58, 0x5a, 0xc1, 0x66, 0xc1, 0x56, 0xa3, 0x76, 0xc0, 0x9d, 0xa9, 0x66, 0xa7, 0x55, 0xfe,
+	0x94, 0x71, 0xad, 0x12, 0xab, 0x32, 0xa3, 0x67, 0x6e, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xee, 0x2c,
+	0x55, 0x93, 0xfe, 0xfe, 0x83, 0xef, 0x93, 0xee, 0x99, 0xcc, 0x52, 0x7e, 0xc0, 0x5a, 0x69, 0x6f,
+	0x7e, 0xc0, 0x27, 0x24, 0x1d, 0x24, 0x22, 0x1d, 0x74, 0x65, 0xa0, 0xa7, 0xa2, 0x87, 0xa4, 0x85,
+	0xa6, 0x65, 0xa5, 0x64, 0xa5, 0x64, 0xa2, 0x76, 0xa2, 0x76, 0x79, 0x64, 0x69, 0x69, 0x69, 0x69,
+	0xa2, 0x76, 0xa2, 0x77, 0xa2, 0x67, 0xa2, 0x76, 0xa2, 0x66, 0x6e, 0x7e, 0xa2, 0x67, 0x6e, 0x6e,
+	0xc0, 0x6d, 0xd1, 0x2a, 0x25, 0xc2, 0x66, 0x27, 0xc0, 0x22, 0x1d, 0x0c, 0x04, 0xc0, 0x9d, 0xab,
+	0x66, 0x51, 0x65, 0x08, 0x57, 0x02, 0x3d, 0x0b, 0x12, 0x6b, 0x6b, 0x6f, 0xa2, 0x67, 0x9d, 0x9a,
+	0x9c, 0x9b, 0x9d, 0x9a, 0x9b, 0xac, 0x99, 0xbd, 0x9b, 0x9b, 0x9c, 0xac, 0xa2, 0x67, 0x10, 0x6f,
+	0x56, 0x66, 0xa2, 0x57, 0x6f, 0xc3, 0x31, 0x65, 0xc0, 0x1d, 0xa4, 0x76, 0xac, 0x22, 0xb0, 0x01,
+	0xb0, 0x00, 0xa5, 0x45, 0xc0, 0x66, 0x65, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xe7, 0x2c, 0x31,
+	0xc1, 0x2c, 0x31, 0xc2, 0x9a, 0xbb, 0x94, 0xfe, 0xfe, 0x7b, 0xae, 0x94, 0xee, 0x9a, 0xbb, 0x1f,
+	0x24, 0x29, 0x55, 0xc0, 0x7e, 0x1d, 0x25, 0x29, 0x24, 0xc1, 0x2c, 0x25, 0x14, 0x60, 0x3f, 0xa3,
+	0x76, 0xa2, 0x86, 0xa4, 0x75, 0xa3, 0x76, 0xa5, 0x64, 0xa4, 0x75, 0xa3, 0x75, 0x7e, 0x7d, 0x7d,
+	0x7a, 0x69, 0x09, 0x7f, 0x6d, 0x69, 0xc0, 0x6e, 0x6e, 0x7e, 0x6e, 0x6e, 0x7f, 0x6e, 0x04, 0x0c,
+	0x6e, 0xc0, 0x6e, 0x11, 0xc9, 0x16, 0x11, 0x0c, 0x55, 0xc0, 0x66, 0x56, 0x2b, 0x32, 0x26, 0x62,
+	0x14, 0x0f, 0x55, 0xa1, 0x89, 0x65, 0x02, 0xc0, 0x09, 0xc0, 0xa1, 0x79, 0x23, 0x56, 0x67, 0x57,
+	0x9d, 0x9a, 0x52, 0x9c, 0x8b, 0x9c, 0x9a, 0x9b, 0xab, 0x9c, 0xab, 0x46, 0x57, 0x01, 0xa2, 0x68,
+	0xc0, 0x66, 0x5b, 0x7e, 0xc0, 0x24, 0x29, 0xc0, 0x24, 0x69, 0xc0, 0x25, 0x6f, 0xa5, 0x65, 0xa9,
+	0x34, 0xb0, 0x01, 0xac, 0x32, 0xa6, 0x45, 0xa2, 0x77, 0x6e, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xeb,
+	0x2c, 0x31, 0x2c, 0x31, 0xc2, 0x5a, 0xc0, 0x31, 0x51, 0x1f, 0x97, 0xdd, 0x94, 0xee, 0x93, 0xee,
+	0x97, 0xcc, 0x29, 0x5e, 0x65, 0x7e, 0x65, 0xc0, 0x22, 0x29, 0xc0, 0x67, 0x65, 0x6e, 0x29, 0xc0,
+	0x65, 0x22, 0x79, 0x01, 0xa2, 0x86, 0xa2, 0x87, 0xa3, 0x75, 0xa2, 0x96, 0xa2, 0x86, 0xa5, 0x64,
+	0xa5, 0x64, 0xa4, 0x76, 0xa2, 0x76, 0x65, 0x55, 0x7a, 0x68, 0x7a, 0xc0, 0x6e, 0xc0, 0x6e, 0x16,
+	0x69, 0xc0, 0x6e, 0x69, 0xc1, 0xa2, 0x77, 0x69, 0xc3, 0x21, 0xc5, 0x0d, 0xc2, 0x0f, 0xc0, 0x66,
+	0x11, 0x0c, 0xc0, 0x07, 0xc1, 0x13, 0xc2, 0x6b, 0x23, 0x67, 0x9c, 0x9b, 0x9c, 0x9b, 0x9b, 0xac,
+	0x20, 0x9c, 0x9c, 0x9d, 0x9a, 0x9e, 0x7a, 0x5a, 0x66, 0x5b, 0x5b, 0x5e, 0x6b, 0xc0, 0x22, 0xc0,
+	0x1d, 0xc1, 0x1f, 0x24, 0xc1, 0x79, 0x2c, 0xa4, 0x65, 0xaf, 0x11, 0xae, 0x01, 0xa9, 0x44, 0x18,
+	0xa3, 0x66, 0x66, 0xc0, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf7, 0x2c, 0x9d, 0xa9, 0x99, 0xbc,
+	0xfe, 0x9c, 0xb2, 0xfe, 0x5a, 0xcb, 0x97, 0xcc, 0x41, 0x22, 0x7a, 0x6b, 0x6e, 0x2c, 0x29, 0x24,
+	0xc2, 0x29, 0x1d, 0xc0, 0x16, 0x19, 0x69, 0x7a, 0xc0, 0x11, 0x76, 0xa2, 0x76, 0xa2, 0x86, 0xa3,
+	0x76, 0xa5, 0x55, 0xa4, 0x65, 0xa4, 0x76, 0xa3, 0x75, 0x78, 0xa1, 0x97, 0xa2, 0x66, 0x23, 0xc0,
+	0x17, 0x6e, 0x69, 0x7a, 0x69, 0x66, 0x69, 0xc0, 0x11, 0xc4, 0x0c, 0x02, 0x6b, 0xc0, 0x11, 0xc1,
+	0x0a, 0xc1, 0x11, 0x09, 0xc0, 0x67, 0xc0, 0x1a, 0x6b, 0xc0, 0x56, 0x56, 0xa2, 0x58, 0x5a, 0x66,
+	0x41, 0x9c, 0xab, 0x9c, 0xaa, 0x9b, 0xac, 0x9c, 0x9b, 0x42, 0x52, 0x56, 0xc0, 0x5b, 0x5a, 0xa2,
+	0x77, 0x6b, 0x55, 0x5a, 0x7b, 0xa2, 0x67, 0xc0, 0x9d, 0x9a, 0x65, 0xc0, 0x6e, 0x29, 0x3d, 0x24,
+	0x15, 0x24, 0xa5, 0x65, 0xad, 0x11, 0xaf, 0x01, 0xaf, 0x10, 0xa3, 0x77, 0xa2, 0x67, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xc1, 0x9d, 0xaa, 0x98, 0xcc, 0x95, 0xdd, 0xfe, 0x6b, 0x4d, 0x94, 0xed,
+	0x1d, 0x09, 0x6f, 0xa3, 0x76, 0x6f, 0x51, 0xc2, 0x7a, 0x29, 0xc0, 0x31, 0x22, 0xc1, 0x76, 0x19,
+	0x66, 0x65, 0x66, 0x3c, 0x7e, 0xa2, 0x76, 0xa3, 0x76, 0x7d, 0xa4, 0x84, 0xa2, 0x86, 0xa4, 0x66,
+	0xa4, 0x66, 0xa3, 0x76, 0xa2, 0x77, 0x79, 0x69, 0x7a, 0x7a, 0x6e, 0xc1, 0x65, 0x1e, 0xc3, 0x6e,
+	0x7a, 0x23, 0xc3, 0x1c, 0xc1, 0x1e, 0xc0, 0x6b, 0x2a, 0x6b, 0x52, 0x52, 0x51, 0x9c, 0xaa, 0x42,
+	0x9b, 0x8b, 0x56, 0x46, 0x51, 0x52, 0x41, 0x0c, 0x5f, 0xc0, 0x5b, 0xc0, 0x1d, 0xc0, 0x66, 0x1d,
+	0x29, 0x22, 0x1d, 0xc0, 0x18, 0x09, 0x1d, 0xa3, 0x77, 0xc0, 0x1d, 0xc0, 0x9d, 0xaa, 0x29, 0xaa,
+	0x33, 0xab, 0x33, 0xab, 0x22, 0xab, 0x33, 0xa9, 0x33, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xc7,
+	0x98, 0xcc, 0x95, 0xee, 0x92, 0xfe, 0x96, 0xdd, 0x97, 0xcd, 0x09, 0x1d, 0xa2, 0x77, 0x2c, 0x1d,
+	0x18, 0x1d, 0x6b, 0x29, 0x31, 0x22, 0xc1, 0x1d, 0x20, 0xc1, 0x79, 0x10, 0xc0, 0x69, 0xc0, 0x69,
+	0x66, 0x7e, 0x7e, 0xa2, 0x76, 0xa2, 0x87, 0xa2, 0x77, 0xa2, 0x76, 0x7f, 0x7e, 0xa2, 0x86, 0xa2,
+	0x77, 0xa2, 0x77, 0x7e, 0x7e, 0xc1, 0x6e, 0xc1, 0x6b, 0x7e, 0x3d, 0x36, 0x31, 0xc0, 0x5a, 0xc0,
+	0x56, 0xc0, 0x51, 0x56, 0x66, 0x52, 0x41, 0x62, 0x51, 0x51, 0x42, 0x51, 0x5e, 0x5a, 0x66, 0x56,
+	0xc0, 0x09, 0x15, 0x5a, 0x6f, 0x5a, 0x22, 0xc1, 0xa2, 0x77, 0x2c, 0x1d, 0xc0, 0x2c, 0xc1, 0x1d,
+	0x2c, 0xc0, 0x1d, 0xc0, 0xa5, 0x66, 0xad, 0x11, 0xa8, 0x45, 0xab, 0x22, 0xaa, 0x33, 0xa6, 0x55,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xc6, 0x66, 0x31, 0xc1, 0x2c, 0x35, 0x98, 0xdc, 0x95, 0xdd,
+	0x93, 0xff, 0x97, 0xcc, 0x24, 0x1d, 0xc1, 0x7f, 0xc0, 0x1d, 0x56, 0x22, 0xc1, 0x1d, 0xc1, 0x20,
+	0xc0, 0x69, 0xc0, 0x12, 0xc1, 0x7f, 0x19, 0x65, 0xc0, 0x10, 0x09, 0xc0, 0x0c, 0xc0, 0x7e, 0xc1,
+	0x7e, 0x7e, 0x69, 0x24, 0xc2, 0x7e, 0x6e, 0xc0, 0x2c, 0xc0, 0x5a, 0xc0, 0x5a, 0x66, 0xc0, 0x56,
+	0x14, 0x0c, 0xc0, 0x6b, 0xc0, 0x56, 0xc3, 0xa2, 0x66, 0x6b, 0xc0, 0x0d, 0x6f, 0xc0, 0x1e, 0x1b,
+	0x22, 0xc3, 0x66, 0x6f, 0xc0, 0x1d, 0xc0, 0x29, 0xc0, 0x7e, 0x6f, 0xa4, 0x66, 0xab, 0x32, 0xad,
+	0x22, 0xae, 0x01, 0xa4, 0x66, 0xa3, 0x77, 0xc0, 0x6e, 0xc0, 0x2c, 0x31, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xc1, 0x2c, 0xc0, 0x31, 0xc4, 0x2c, 0x51, 0x21, 0x95, 0xed, 0x95, 0xde, 0x96, 0xed,
+	0x9a, 0xbb, 0x9b, 0xab, 0x51, 0x65, 0xc0, 0x1d, 0x22, 0x29, 0xc0, 0x24, 0xc1, 0x7a, 0x6e, 0x69,
+	0x20, 0x59, 0x69, 0x16, 0x5b, 0x6b, 0x24, 0xc2, 0x18, 0x65, 0x6e, 0x7a, 0xc0, 0x19, 0x1c, 0x66,
+	0xc2, 0x1c, 0xc0, 0x17, 0x10, 0x17, 0xc3, 0x14, 0xc1, 0x20, 0xc0, 0x66, 0x20, 0x1b, 0x18, 0xc0,
+	0x7b, 0x27, 0xc0, 0x1b, 0x20, 0x2c, 0x20, 0x1d, 0x6e, 0xc4, 0x5e, 0x7a, 0x29, 0xc1, 0x1d, 0x56,
+	0x7f, 0xa4, 0x65, 0xa5, 0x56, 0xaa, 0x33, 0x35, 0xa8, 0x44, 0xa8, 0x45, 0xa7, 0x54, 0x6f, 0x6e,
+	0xc0, 0x2c, 0xc0, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xc5, 0x2c, 0xc0, 0x31, 0xc5, 0x2c,
+	0x51, 0x99, 0xbb, 0x97, 0xdd, 0x95, 0xdd, 0x96, 0xdd, 0x99, 0xcc, 0x9c, 0xa9, 0x51, 0x29, 0xc0,
+	0x24, 0xc4, 0x1d, 0xc0, 0x16, 0x6e, 0x22, 0x6f, 0x29, 0xc1, 0x1d, 0xc0, 0x7f, 0xc1, 0x25, 0x66,
+	0xc1, 0x56, 0xc1, 0x7a, 0xc4, 0x6f, 0xc2, 0x20, 0xc1, 0x1b, 0xc0, 0x18, 0x20, 0x27, 0x24, 0x27,
+	0x2c, 0xc1, 0x24, 0x66, 0xc1, 0x24, 0x29, 0x24, 0xc0, 0x1d, 0x22, 0x29, 0x22, 0x29, 0x2c, 0x18,
+	0x1d, 0x3d, 0xa5, 0x65, 0xa7, 0x45, 0xa9, 0x43, 0xad, 0x12, 0xa9, 0x43, 0xa5, 0x66, 0x6f, 0x6e,
+	0x2c, 0xc0, 0x31, 0xc1, 0x2c, 0xc0, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xc3, 0x2c, 0x31,
+	0xcb, 0x9d, 0xa9, 0x9b, 0xab, 0x96, 0xdd, 0x00, 0x97, 0xcc, 0x97, 0xdc, 0x52, 0x55, 0x24, 0xc3,
+	0x1a, 0xc0, 0x22, 0x6e, 0xc1, 0x22, 0xc0, 0x1d, 0x22, 0xc0, 0x1d, 0x7a, 0xc2, 0x25, 0x6b, 0x24,
+	0x2b, 0xc0, 0x6e, 0xc0, 0x7a, 0x30, 0x2b, 0xc0, 0x24, 0xc2, 0x18, 0xc0, 0x20, 0xc0, 0x2c, 0xc1,
+	0x20, 0x1d, 0xc2, 0x18, 0x2c, 0x24, 0xc0, 0x33, 0xc0, 0x29, 0x24, 0xc3, 0x2c, 0xc1, 0x05, 0xaa,
+	0x33, 0xac, 0x23, 0xaa, 0x33, 0xa9, 0x33, 0xa6, 0x55, 0x31, 0xc2, 0x66, 0xc0, 0x31, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xda, 0x1d, 0x9d, 0xaa, 0x92, 0xff, 0x96, 0xdd, 0x98, 0xcb, 0x9c, 0xab,
+	0x9d, 0x9a, 0x9c, 0xaa, 0x50, 0x56, 0x65, 0xc0, 0x2e, 0x22, 0x5a, 0x1e, 0xc1, 0x25, 0x1e, 0x16,
+	0xc0, 0x19, 0x25, 0x20, 0x16, 0xc0, 0x20, 0x24, 0xc1, 0x30, 0xc0, 0x24, 0xc6, 0x65, 0x6e, 0xc0,
+	0x20, 0xc0, 0x25, 0x20, 0xc1, 0x25, 0xc1, 0x1d, 0xc0, 0x24, 0xc0, 0x1d, 0xc0, 0x24, 0x7e, 0xc0,
+	0x7f, 0xa2, 0x77, 0xa4, 0x66, 0xa4, 0x66, 0xa4, 0x66, 0xa8, 0x44, 0xac, 0x11, 0xab, 0x33, 0xa5,
+	0x56, 0xc1, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xe2, 0x2c, 0x65, 0x09, 0x9d, 0xaa, 0x9d,
+	0x99, 0x0c, 0x99, 0xbb, 0x97, 0xdd, 0x9b, 0xaa, 0x9c, 0xaa, 0x9c, 0xaa, 0x9d, 0x99, 0x2e, 0x22,
+	0x1d, 0x16, 0xc0, 0x1d, 0x22, 0xc6, 0x7b, 0xc0, 0x24, 0x1d, 0x2c, 0xc0, 0x66, 0x24, 0x27, 0xc4,
+	0x2c, 0xc0, 0x29, 0xc0, 0x22, 0xc7, 0x51, 0x16, 0x22, 0x7f, 0xa2, 0x77, 0xa2, 0x77, 0xa4, 0x66,
+	0xa7, 0x55, 0xa5, 0x66, 0xa7, 0x44, 0xa7, 0x55, 0xa6, 0x55, 0xa3, 0x67, 0xa5, 0x55, 0xa2, 0x77,
+	0x6e, 0x2c, 0xc0, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xe5, 0x2c, 0x31, 0xc0, 0x2c, 0x55,
+	0x9d, 0xaa, 0x21, 0x9a, 0xbb, 0x9b, 0xaa, 0x9a, 0xbb, 0x9a, 0xbb, 0x9c, 0xba, 0x39, 0x51, 0x51,
+	0x3d, 0x29, 0x15, 0xc0, 0x6f, 0x24, 0xc0, 0x21, 0x24, 0x29, 0x7a, 0x69, 0xca, 0x24, 0x21, 0xc1,
+	0x1a, 0xc1, 0x15, 0xc0, 0x1a, 0x22, 0x7f, 0x3d, 0xa4, 0x65, 0xa4, 0x65, 0xa6, 0x56, 0xa6, 0x55,
+	0xa7, 0x55, 0xa5, 0x65, 0xa5, 0x56, 0xa6, 0x55, 0x04, 0xa2, 0x87, 0x6f, 0x6e, 0xc1, 0x6e, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xec, 0x2c, 0xc0, 0x31, 0xc3, 0x65, 0x51, 0x9a, 0xac, 0x9c, 0xba,
+	0x9b, 0xaa, 0x99, 0xbc, 0x98, 0xdc, 0x35, 0x99, 0xcc, 0x41, 0x66, 0x55, 0xc0, 0x65, 0xc0, 0x61,
+	0x69, 0x56, 0xc0, 0x7a, 0xc0, 0x1d, 0xc5, 0x6f, 0xc0, 0x6f, 0x3d, 0x7f, 0x6e, 0xc1, 0xa3, 0x67,
+	0xa6, 0x55, 0xa6, 0x55, 0xa6, 0x55, 0xa4, 0x65, 0xaa, 0x43, 0xa4, 0x56, 0xa4, 0x66, 0xa3, 0x76,
+	0xa2, 0x78, 0xc4, 0x66, 0x65, 0x5a, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf6, 0x2c, 0x31,
+	0xc0, 0x52, 0x04, 0x9d, 0x9a, 0x9c, 0xaa, 0x50, 0x66, 0x55, 0x51, 0x66, 0xc0, 0x9a, 0xbb, 0x65,
+	0x5a, 0xc0, 0x30, 0xc6, 0x2d, 0xa2, 0x77, 0x7e, 0xa2, 0x67, 0x2e, 0xa2, 0x77, 0x11, 0x20, 0xa2,
+	0x66, 0xa2, 0x78, 0xa3, 0x76, 0xa4, 0x66, 0x2c, 0x31, 0xcc, 0x1d, 0x2c, 0x31, 0xc0, 0x2c, 0x31,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xef, 0x2c, 0x65, 0x56, 0x27, 0x2c, 0x31, 0xc0, 0x2c, 0xc0,
+	0x31, 0xc4, 0x2c, 0x5a, 0x24, 0xc0, 0x29, 0xc1, 0x2c, 0xc4, 0x16, 0xc0, 0x7e, 0x6b, 0x6e, 0x31,
+	0x2a, 0x25, 0x31, 0xc2, 0x2c, 0xc0, 0x31, 0xc0, 0x2c, 0xc0, 0x31, 0xc3, 0x2a, 0xc0, 0x31, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xc7,
+};
@@ -0,0 +1,1270 @@
+// 'hedon', 480x320px, Q565 compressed (20245 bytes, raw 307200)
+// Generated by tools/compress_splash.py - do not edit
+const uint8_t splash_hedon_q565[] PROGMEM = {
+	0x51, 0x35, 0x36, 0x35, 0xe0, 0x01, 0x40, 0x01, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xe1, 0x7e, 0x00, 0xc3, 0x08, 0xc2, 0x66, 0x00, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd8, 0x6f, 0xc0, 0xa1, 0x97, 0xa2, 0x76, 0x7e, 0xa2, 0x76, 0xa2,
+	0x87, 0xa2, 0x67, 0xa2, 0x76, 0x7f, 0x98, 0xbd, 0x9b, 0xad, 0x56, 0x00, 0x08, 0xad, 0x20, 0xa3,
+	0x85, 0x65, 0x55, 0x56, 0x52, 0x55, 0x9d, 0xaa, 0x31, 0x24, 0x55, 0x08, 0x00, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xd2, 0x17, 0xab, 0x30, 0xac, 0x30, 0xa5, 0x63, 0x7e, 0xa3, 0x67, 0xa2,
+	0x77, 0xa2, 0x76, 0x42, 0xfe, 0x49, 0xc4, 0xfe, 0x08, 0x40, 0x07, 0x6d, 0xa2, 0x96, 0xfe, 0x83,
+	0x8a, 0xfe, 0xc5, 0x0c, 0x69, 0x56, 0x66, 0x55, 0x51, 0x41, 0x51, 0x42, 0x9d, 0xaa, 0x9c, 0xab,
+	0x9b, 0xbc, 0x9b, 0xab, 0x9c, 0xab, 0x9d, 0xaa, 0x9e, 0x7a, 0x0d, 0x05, 0x66, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xcb, 0xa3, 0x86, 0xfe, 0x6a, 0xc7, 0xfe, 0xb4, 0xec, 0xa4, 0x73, 0x7a,
+	0xc0, 0x6e, 0x6e, 0x9b, 0xad, 0xfe, 0x49, 0xe4, 0x0d, 0x05, 0x00, 0xa2, 0x86, 0xfe, 0x93, 0xca,
+	0xfe, 0xd5, 0x8c, 0x32, 0xc0, 0x3e, 0x7a, 0x56, 0x32, 0x65, 0x5e, 0x66, 0x67, 0x42, 0x9d, 0xaa,
+	0x9c, 0xac, 0x9c, 0xab, 0x99, 0xbd, 0x3d, 0x9a, 0xbb, 0x9c, 0x9b, 0x9d, 0xab, 0x08, 0x03, 0x00,
+	0x6f, 0xc0, 0x67, 0x07, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xc0, 0x05, 0x00, 0xa4,
+	0x75, 0xfe, 0x72, 0xe8, 0xfe, 0xc5, 0x0c, 0xa5, 0x61, 0x66, 0x66, 0x6d, 0x38, 0x9c, 0x8c, 0xfe,
+	0x4a, 0x04, 0x0d, 0x05, 0x00, 0xa2, 0x96, 0x12, 0xfe, 0xdd, 0x8b, 0x2e, 0x5a, 0x7b, 0xc0, 0x2e,
+	0x66, 0xc0, 0x2e, 0xc1, 0x67, 0x6b, 0x6f, 0x56, 0x56, 0x51, 0x9a, 0xac, 0x99, 0xbc, 0x99, 0xbd,
+	0x9a, 0xbc, 0x9a, 0xac, 0x9c, 0xab, 0x08, 0x57, 0xc1, 0x00, 0xc1, 0x05, 0xc1, 0x00, 0xc2, 0x07,
+	0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf3, 0x05, 0x76, 0xa3, 0x86, 0xfe, 0x7a, 0xe8, 0xfe,
+	0xc5, 0x0b, 0x2e, 0x69, 0x7e, 0xc0, 0x38, 0x9b, 0xad, 0xfe, 0x52, 0x04, 0x0d, 0x05, 0x00, 0x13,
+	0xfe, 0x9b, 0xea, 0xfe, 0xdd, 0x8a, 0x27, 0x2e, 0x59, 0x33, 0x2c, 0xc0, 0x27, 0x29, 0x7e, 0xc0,
+	0x2e, 0xc2, 0x65, 0x27, 0x35, 0x3e, 0x52, 0x9c, 0x9b, 0x99, 0xbd, 0x98, 0xcd, 0x96, 0xcf, 0x9a,
+	0xac, 0x9c, 0xab, 0x08, 0x00, 0xc0, 0x05, 0xc2, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf9,
+	0x03, 0xa3, 0x76, 0xfe, 0x7a, 0xc8, 0xfe, 0xc4, 0xec, 0xa4, 0x72, 0x7a, 0x29, 0x22, 0x33, 0x9b,
+	0xad, 0xfe, 0x51, 0xe4, 0xfe, 0x08, 0x40, 0x56, 0x00, 0xa2, 0x96, 0x1a, 0x33, 0x54, 0x2c, 0x33,
+	0x24, 0xc1, 0x27, 0x2e, 0xc0, 0x33, 0x27, 0x24, 0x6e, 0xc0, 0x7e, 0x65, 0x66, 0x24, 0x2b, 0x6f,
+	0xa0, 0x8a, 0x55, 0x19, 0x97, 0xcd, 0x95, 0xdf, 0x96, 0xdf, 0x9b, 0xac, 0x08, 0x00, 0xc0, 0x6e,
+	0xc0, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfa, 0x17, 0xfe, 0x72, 0xe8, 0xfe, 0xc5, 0x0c,
+	0x33, 0x2e, 0x30, 0x35, 0x33, 0x16, 0xfe, 0x51, 0xe4, 0x17, 0x00, 0xc0, 0x0b, 0x1a, 0x33, 0x2c,
+	0x33, 0xc0, 0x5a, 0xc1, 0x2b, 0x3a, 0x2e, 0xc0, 0x33, 0xc0, 0x2c, 0xc3, 0x33, 0xc0, 0x30, 0x37,
+	0x3a, 0x6f, 0x37, 0x56, 0x9a, 0xbd, 0x23, 0x05, 0x96, 0xde, 0x9b, 0xad, 0x00, 0x0f, 0x0c, 0x00,
+	0x6e, 0x00, 0x05, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf5, 0xa3, 0x75, 0xfe, 0x73, 0x08,
+	0xfe, 0xc5, 0x2b, 0x33, 0x2e, 0x35, 0xc1, 0x9d, 0x8b, 0xfe, 0x51, 0xe4, 0x17, 0x45, 0x00, 0xa2,
+	0x86, 0xfe, 0x9b, 0xeb, 0x3a, 0x2e, 0xc2, 0x35, 0x3a, 0xc0, 0x7a, 0x35, 0xc1, 0x2e, 0xc1, 0x33,
+	0x3a, 0x35, 0xc5, 0x2e, 0xc0, 0x33, 0xa1, 0x79, 0x24, 0x96, 0xde, 0xfe, 0x59, 0xe3, 0x97, 0xbf,
+	0x0b, 0x03, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf8, 0x05, 0x15, 0xfe, 0x73, 0x07, 0xfe,
+	0xc5, 0x4b, 0xa3, 0x73, 0x2c, 0x67, 0xc0, 0x33, 0x16, 0xfe, 0x51, 0xe4, 0x10, 0x46, 0x00, 0x10,
+	0xfe, 0x93, 0xea, 0x3a, 0x2e, 0x7a, 0xc0, 0x56, 0xc0, 0x35, 0xc0, 0x3a, 0x35, 0xc0, 0x66, 0x29,
+	0xc0, 0x7a, 0x35, 0x6b, 0xc0, 0x35, 0xc1, 0x29, 0xc1, 0x31, 0x2e, 0xc0, 0x55, 0x2b, 0x06, 0x9c,
+	0xac, 0xfe, 0xa4, 0x0b, 0xfe, 0x62, 0x45, 0x95, 0xdf, 0x10, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xf8, 0x15, 0x1a, 0x22, 0xa3, 0x74, 0x79, 0x2e, 0xc0, 0x33, 0x16, 0xfe, 0x51, 0xe4, 0x10,
+	0x46, 0x00, 0x10, 0x17, 0x3a, 0x33, 0x2e, 0xc1, 0x3d, 0x3a, 0x9b, 0xab, 0x5e, 0xa2, 0x88, 0x32,
+	0xc0, 0x66, 0x2e, 0xc0, 0x35, 0xc4, 0x65, 0xc0, 0x2e, 0xc0, 0x3d, 0x33, 0x2c, 0xc0, 0x2e, 0x2d,
+	0xa2, 0x78, 0x9d, 0x9b, 0x98, 0xad, 0xfe, 0x5a, 0x65, 0xfe, 0x29, 0x02, 0x0d, 0x56, 0x00, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf3, 0x6b, 0xc0, 0xa2, 0x86, 0x1a, 0x22, 0xa3, 0x84, 0x2e, 0x35,
+	0x2e, 0x33, 0x9d, 0x8b, 0xfe, 0x51, 0xe4, 0x0d, 0x00, 0xc0, 0x10, 0x12, 0x3a, 0x2c, 0x33, 0x2e,
+	0x56, 0xc0, 0x9a, 0x9c, 0xfe, 0x62, 0x44, 0x9b, 0xac, 0xa6, 0x45, 0xa6, 0x54, 0xa4, 0x76, 0xa4,
+	0x74, 0xa5, 0x54, 0xa4, 0x74, 0x7d, 0x69, 0x2b, 0x33, 0xc1, 0x2e, 0x69, 0x2e, 0xc2, 0x3a, 0xc0,
+	0x33, 0x27, 0xc0, 0x33, 0x37, 0x43, 0x95, 0xdf, 0xfe, 0x52, 0x03, 0xfe, 0x20, 0xc1, 0x9b, 0xac,
+	0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd6, 0x07, 0x00, 0xda, 0x07, 0x17, 0x13, 0x22, 0x33,
+	0x66, 0x35, 0xc0, 0x33, 0x1b, 0x05, 0xfe, 0x08, 0x40, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca, 0x3a,
+	0x2c, 0x33, 0x2e, 0xc0, 0x3a, 0x97, 0xae, 0xfe, 0x39, 0x22, 0x97, 0xbf, 0x08, 0xc0, 0xa3, 0x75,
+	0xa4, 0x76, 0xa6, 0x53, 0xa4, 0x65, 0xa8, 0x53, 0xa7, 0x53, 0xa5, 0x55, 0xa4, 0x65, 0x7e, 0x32,
+	0x30, 0x2c, 0x27, 0xc0, 0x6b, 0x3a, 0xc0, 0x2e, 0x27, 0xa2, 0x65, 0x25, 0x2c, 0x33, 0x37, 0x3e,
+	0x9a, 0xbc, 0xfe, 0x83, 0x67, 0xfe, 0x41, 0x82, 0x99, 0xad, 0x9c, 0xac, 0x00, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xd3, 0x07, 0xc1, 0x00, 0xd9, 0x07, 0xa2, 0x86, 0x13, 0xfe, 0xc5, 0x2b, 0x33,
+	0x2e, 0x35, 0x2e, 0x33, 0x1b, 0x05, 0xfe, 0x08, 0x40, 0x00, 0xc0, 0xa2, 0x86, 0x15, 0x3a, 0x2c,
+	0x33, 0x2e, 0xc0, 0x2b, 0x99, 0xae, 0xfe, 0x39, 0x42, 0x00, 0xc3, 0x03, 0x08, 0x1d, 0xa4, 0x66,
+	0x02, 0xa7, 0x53, 0xa8, 0x43, 0xa7, 0x52, 0x22, 0x2f, 0x2b, 0x2e, 0xc0, 0x35, 0x2e, 0x3a, 0x33,
+	0x51, 0x2c, 0xc1, 0x33, 0x2b, 0x30, 0x53, 0x98, 0xbf, 0x94, 0xdf, 0xfe, 0x31, 0x01, 0x10, 0x03,
+	0x07, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xca, 0x07, 0xc1, 0x6e, 0x69, 0x7a, 0x0f, 0x07,
+	0xc0, 0x00, 0xda, 0x17, 0x13, 0xfe, 0xc5, 0x4b, 0x33, 0x2e, 0x35, 0x2e, 0x33, 0x1b, 0xfe, 0x51,
+	0xe4, 0x0d, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca, 0x3a, 0x68, 0x33, 0x2e, 0xc0, 0x2b, 0x32, 0xfe,
+	0x39, 0x22, 0x00, 0xc8, 0x0d, 0x31, 0xa7, 0x53, 0x3f, 0xa7, 0x64, 0xa8, 0x42, 0xa4, 0x65, 0xa2,
+	0x86, 0x35, 0x33, 0x66, 0x35, 0x6b, 0x35, 0x2b, 0x2c, 0xc1, 0x24, 0x37, 0x6b, 0x9c, 0xab, 0xfe,
+	0x93, 0xa8, 0xfe, 0x52, 0x04, 0xfe, 0x20, 0xa1, 0x9c, 0x9b, 0x07, 0xc0, 0x00, 0x6e, 0xc0, 0x00,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xc5, 0x07, 0x0e, 0xc0, 0x0f, 0xa4, 0x64, 0xa3, 0x76, 0x29,
+	0x08, 0x00, 0x6e, 0xc0, 0x00, 0xd8, 0x17, 0x13, 0x27, 0x33, 0x2e, 0x35, 0x2e, 0x33, 0x1b, 0x02,
+	0x0d, 0x00, 0xc0, 0xa2, 0x86, 0x15, 0x3a, 0x68, 0x2e, 0xc1, 0x2b, 0x32, 0xfe, 0x39, 0x22, 0x03,
+	0x00, 0xc9, 0x08, 0xa2, 0x86, 0xa5, 0x65, 0xa8, 0x43, 0xaa, 0x31, 0xaa, 0x41, 0x22, 0xa2, 0x86,
+	0x2b, 0x35, 0x6f, 0x2d, 0x79, 0x2e, 0xc0, 0x33, 0xc0, 0x30, 0x2b, 0x35, 0x57, 0x99, 0xad, 0xfe,
+	0x6a, 0x85, 0x95, 0xcf, 0x99, 0xbe, 0x07, 0xc0, 0x0c, 0x05, 0x66, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xc5, 0x07, 0xc0, 0x17, 0xa5, 0x63, 0xac, 0x30, 0xa8, 0x43, 0x97, 0xce, 0xfe, 0x20, 0xa1,
+	0x9c, 0x9b, 0x05, 0xc0, 0x00, 0xd8, 0x17, 0x13, 0xfe, 0xc5, 0x4b, 0x33, 0x66, 0x35, 0x2e, 0x33,
+	0x1b, 0x02, 0x0d, 0x00, 0xc0, 0x10, 0x15, 0x3a, 0x68, 0x2e, 0xc1, 0x2b, 0x99, 0xae, 0xfe, 0x39,
+	0x22, 0x03, 0x00, 0xcb, 0x03, 0x08, 0xa5, 0x54, 0xa7, 0x54, 0xa9, 0x51, 0xaa, 0x41, 0xa8, 0x42,
+	0x37, 0x66, 0x79, 0xc0, 0x7b, 0x56, 0x35, 0x2e, 0x33, 0x2e, 0x65, 0x2e, 0x35, 0x9c, 0x8b, 0xfe,
+	0x8b, 0x87, 0xfe, 0x49, 0xc3, 0x97, 0xcf, 0x08, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xc6,
+	0x05, 0x00, 0xa3, 0x75, 0xa7, 0x63, 0xfe, 0x72, 0xe6, 0xfe, 0xb4, 0x8a, 0xa6, 0x44, 0x18, 0xfe,
+	0x41, 0xa3, 0xfe, 0x10, 0x40, 0x05, 0xc0, 0x00, 0xd8, 0x17, 0x13, 0x27, 0x33, 0x66, 0x35, 0x2e,
+	0x33, 0x1b, 0x02, 0x0d, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca, 0x3a, 0x68, 0x2e, 0xc1, 0x5e, 0x98,
+	0xbf, 0xfe, 0x39, 0x22, 0x03, 0x00, 0xc8, 0x6b, 0xc2, 0x0c, 0x05, 0x00, 0xa4, 0x64, 0xa7, 0x64,
+	0xaa, 0x41, 0xaa, 0x31, 0xa8, 0x52, 0xa4, 0x74, 0x2e, 0xc0, 0x35, 0x2e, 0xc2, 0x29, 0x2e, 0x69,
+	0x33, 0x42, 0x97, 0xcf, 0xfe, 0x62, 0x64, 0x39, 0x08, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xc1, 0x07, 0x00, 0xc1, 0x08, 0xa4, 0x64, 0xaa, 0x41, 0xfe, 0x8b, 0xa8, 0x15, 0x3e, 0xc0, 0x9d,
+	0x9a, 0x28, 0xfe, 0x29, 0x01, 0x08, 0x00, 0xd9, 0x17, 0x13, 0xfe, 0xc5, 0x4b, 0x33, 0x2e, 0x35,
+	0x2e, 0x33, 0x1b, 0x02, 0x0d, 0x00, 0xc0, 0xa2, 0x86, 0xfe, 0x9b, 0xca, 0xfe, 0xdd, 0x8b, 0x2c,
+	0x33, 0x2e, 0xc0, 0x30, 0x98, 0xbf, 0xfe, 0x39, 0x22, 0x03, 0x00, 0xca, 0x07, 0xc0, 0x00, 0xc3,
+	0xa2, 0x86, 0xa7, 0x53, 0xab, 0x31, 0xfe, 0x9b, 0xc7, 0xa8, 0x52, 0x2e, 0x33, 0xc1, 0x2e, 0x29,
+	0xc0, 0x2e, 0x69, 0xc0, 0x2c, 0x2b, 0x9a, 0xad, 0xfe, 0x7b, 0x07, 0xfe, 0x39, 0x43, 0x98, 0xcd,
+	0x03, 0x5a, 0xc0, 0x07, 0xc0, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf8, 0x07, 0xc1, 0x03, 0xc0,
+	0xa5, 0x64, 0xfe, 0x5a, 0x44, 0xfe, 0x9c, 0x28, 0xa9, 0x41, 0xa1, 0x98, 0x7e, 0x32, 0x5a, 0x9a,
+	0xac, 0xfe, 0x52, 0x24, 0xfe, 0x18, 0x81, 0x07, 0x00, 0xd8, 0xa2, 0x87, 0xfe, 0x73, 0x07, 0xfe,
+	0xc5, 0x4b, 0x33, 0x2e, 0x35, 0x2e, 0x33, 0x22, 0x02, 0xfe, 0x08, 0x41, 0x00, 0xc0, 0x10, 0x15,
+	0x3a, 0x33, 0xc0, 0x2e, 0xc0, 0x2b, 0x99, 0xae, 0xfe, 0x39, 0x42, 0x00, 0xd4, 0x24, 0xa6, 0x62,
+	0xab, 0x41, 0xfe, 0xac, 0x28, 0xa9, 0x41, 0x33, 0xc3, 0x2e, 0xc0, 0x29, 0x6d, 0x33, 0x5b, 0x9b,
+	0xbd, 0xfe, 0x8b, 0x47, 0xfe, 0x49, 0x83, 0x97, 0xbe, 0x03, 0x07, 0xc2, 0x00, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xf7, 0x07, 0xc0, 0x7a, 0x08, 0x39, 0xfe, 0x62, 0x85, 0xfe, 0xa4, 0x89, 0xa8, 0x51,
+	0xa1, 0x97, 0x33, 0x35, 0x29, 0x5e, 0x5a, 0xfe, 0x8b, 0xc7, 0x21, 0x08, 0x00, 0xd8, 0x17, 0x13,
+	0xfe, 0xc5, 0x4b, 0x33, 0x35, 0xc0, 0x2e, 0x33, 0x22, 0x02, 0x14, 0x00, 0xc0, 0x10, 0xfe, 0x9b,
+	0xca, 0xfe, 0xdd, 0x8b, 0x33, 0xc0, 0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00, 0xd5, 0x03, 0xa4,
+	0x74, 0x2c, 0xfe, 0x8b, 0x67, 0xaa, 0x31, 0xa6, 0x63, 0x38, 0x69, 0x56, 0x2e, 0x35, 0xc2, 0x3a,
+	0xc0, 0x1d, 0x96, 0xdf, 0xfe, 0x51, 0xc3, 0x96, 0xbf, 0x0a, 0xc0, 0x5a, 0xc0, 0x00, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xf7, 0x07, 0x0a, 0x0b, 0xa6, 0x53, 0xfe, 0x6a, 0xc5, 0xfe, 0xac, 0x8a, 0xa7,
+	0x52, 0x33, 0x65, 0x7b, 0xc0, 0x56, 0xa2, 0x65, 0x5a, 0x9c, 0x9d, 0xfe, 0x72, 0xe6, 0xfe, 0x20,
+	0xa1, 0x00, 0xd8, 0x17, 0xfe, 0x73, 0x07, 0xfe, 0xc5, 0x4b, 0x33, 0x35, 0xc0, 0x2e, 0x33, 0x22,
+	0x02, 0x14, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x99, 0x9e, 0xfe,
+	0x39, 0x42, 0x00, 0xd6, 0x7f, 0x10, 0x3e, 0xab, 0x30, 0xfe, 0x9c, 0x29, 0x22, 0x30, 0x33, 0x2e,
+	0x35, 0x7a, 0x56, 0x35, 0x3a, 0x55, 0xc0, 0x23, 0xfe, 0x94, 0x08, 0xfe, 0x52, 0x04, 0xfe, 0x20,
+	0x81, 0x03, 0x00, 0x6b, 0x00, 0xc0, 0x6e, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf1, 0x05, 0x00,
+	0xc0, 0x7b, 0x79, 0xa7, 0x42, 0xfe, 0x73, 0x06, 0xfe, 0xb4, 0xca, 0x2f, 0x2b, 0x2e, 0x76, 0xc1,
+	0x6d, 0x5e, 0x29, 0xa0, 0x8b, 0xfe, 0xa4, 0x4b, 0x21, 0x08, 0x00, 0xd7, 0x17, 0x13, 0xfe, 0xc5,
+	0x4b, 0xa2, 0x95, 0x35, 0xc0, 0x2e, 0x33, 0x22, 0x02, 0x14, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca,
+	0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00, 0xd5, 0x05, 0x6f, 0x05, 0x08, 0xa3,
+	0x75, 0xa8, 0x42, 0x0c, 0xfe, 0xb4, 0xcb, 0xa5, 0x84, 0x3d, 0x2e, 0xc1, 0x35, 0xc0, 0x3a, 0x2b,
+	0x6e, 0x46, 0x98, 0xbf, 0xfe, 0x5a, 0x24, 0x20, 0x0a, 0x07, 0x00, 0xc0, 0x05, 0x00, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xf4, 0x0b, 0x39, 0xfe, 0x6a, 0xa5, 0xfe, 0xb4, 0xea, 0x30, 0xc0, 0x72, 0x6b,
+	0x7a, 0x69, 0x59, 0xc0, 0x5e, 0x6f, 0x9d, 0x9d, 0xfe, 0x8b, 0xc9, 0xfe, 0x31, 0x43, 0x97, 0xce,
+	0x00, 0xd7, 0x17, 0x13, 0xfe, 0xc5, 0x4b, 0xa2, 0x95, 0x35, 0xc0, 0x2e, 0x33, 0x9d, 0x8c, 0x02,
+	0x14, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42,
+	0x00, 0xd5, 0x05, 0xc3, 0x08, 0x39, 0xfe, 0x6a, 0xc7, 0xfe, 0xac, 0x4a, 0xa8, 0x42, 0x33, 0x65,
+	0xc0, 0x2e, 0x35, 0xc0, 0x65, 0xa2, 0x65, 0x5f, 0x2d, 0xfe, 0xa4, 0x48, 0xfe, 0x5a, 0x23, 0xfe,
+	0x18, 0x81, 0x03, 0x00, 0xc0, 0x05, 0xc0, 0x07, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf1, 0x03,
+	0xa6, 0x63, 0xfe, 0x7b, 0x06, 0xfe, 0xbc, 0xeb, 0x37, 0x2c, 0x33, 0x2e, 0x29, 0x6b, 0x2e, 0xc1,
+	0x4b, 0x0d, 0xfe, 0x7b, 0x27, 0xfe, 0x39, 0x83, 0x97, 0xce, 0x00, 0xd8, 0x17, 0x13, 0xfe, 0xc5,
+	0x4b, 0x33, 0x67, 0xc0, 0x2e, 0x33, 0x22, 0x02, 0x14, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca, 0x3a,
+	0x33, 0xc0, 0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00, 0xdb, 0x08, 0xa4, 0x75, 0xaa, 0x41, 0xfe,
+	0x93, 0xe8, 0x27, 0xa3, 0x84, 0x2e, 0x29, 0x7b, 0x29, 0x2e, 0x6e, 0x69, 0x5b, 0xc0, 0xfe, 0xac,
+	0x69, 0xfe, 0x5a, 0x04, 0x20, 0x03, 0x5e, 0xc1, 0x07, 0xc0, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xef, 0x08, 0x39, 0xfe, 0x72, 0xe6, 0xfe, 0xbd, 0x0b, 0xa5, 0x64, 0x30, 0x75, 0x2e, 0xc3, 0x35,
+	0x5a, 0x99, 0xad, 0xfe, 0x6a, 0xa5, 0x39, 0x9b, 0x9c, 0x00, 0xd9, 0x17, 0x13, 0xfe, 0xc5, 0x4b,
+	0xa2, 0x95, 0x35, 0xc0, 0x2e, 0x33, 0x22, 0x02, 0x14, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca, 0x3a,
+	0x33, 0xc0, 0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00, 0xdd, 0xa3, 0x75, 0x1f, 0xfe, 0x7b, 0x47,
+	0xfe, 0xbc, 0xeb, 0xa4, 0x74, 0x35, 0x29, 0xc0, 0x2a, 0x6b, 0x2e, 0xc0, 0x30, 0x37, 0xfe, 0xa4,
+	0x49, 0xfe, 0x52, 0x44, 0xfe, 0x10, 0x60, 0x53, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf2, 0x7a,
+	0xa5, 0x64, 0x06, 0xfe, 0xbc, 0xec, 0x2f, 0x30, 0x33, 0x2e, 0xc0, 0x33, 0x69, 0x5a, 0x37, 0x53,
+	0x97, 0xcf, 0xfe, 0x5a, 0x44, 0xfe, 0x20, 0xc1, 0x08, 0x00, 0xda, 0xa2, 0x87, 0x13, 0xfe, 0xc5,
+	0x4b, 0x33, 0x35, 0xc0, 0x2e, 0x33, 0x22, 0x02, 0xfe, 0x08, 0x41, 0x00, 0xc0, 0x10, 0xfe, 0x9b,
+	0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x99, 0x9e, 0xfe, 0x39, 0x42, 0x00, 0xde, 0x10, 0xa7, 0x53,
+	0xfe, 0x72, 0xe7, 0xfe, 0xb4, 0xab, 0xa6, 0x63, 0x3a, 0x79, 0x55, 0xc0, 0x2e, 0x35, 0x66, 0x35,
+	0x23, 0x25, 0xfe, 0x51, 0xe4, 0xfe, 0x18, 0x61, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xef, 0x6e,
+	0xc0, 0x03, 0xa4, 0x74, 0xfe, 0x62, 0x85, 0xfe, 0xbc, 0xcc, 0x39, 0x68, 0x27, 0xc3, 0x2c, 0x5f,
+	0x9d, 0x9c, 0xfe, 0x93, 0xe9, 0xfe, 0x51, 0xe4, 0x1f, 0x41, 0x57, 0x00, 0x6e, 0x00, 0xd8, 0xa2,
+	0x87, 0x13, 0x27, 0x33, 0x67, 0xc0, 0x2e, 0x33, 0x22, 0x02, 0x14, 0x00, 0xc0, 0xa2, 0x86, 0xfe,
+	0x9b, 0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00, 0xde, 0x03, 0x08, 0x34,
+	0xfe, 0x62, 0x65, 0xfe, 0xac, 0x6a, 0xa7, 0x62, 0x33, 0x2c, 0x65, 0x6b, 0x67, 0xc0, 0x7f, 0x2e,
+	0x3e, 0xfe, 0xa4, 0x2a, 0xfe, 0x49, 0xc4, 0x10, 0x00, 0x07, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xee, 0x18, 0x12, 0xfe, 0xac, 0x8a, 0x3e, 0x35, 0x2e, 0x69, 0xc1, 0x33, 0xc0, 0x6f, 0x9d, 0x8b,
+	0xfe, 0x93, 0xc8, 0xfe, 0x49, 0xc3, 0x24, 0x03, 0x07, 0xc1, 0x05, 0x00, 0xd8, 0x17, 0x13, 0x27,
+	0x33, 0x35, 0xc0, 0x2e, 0x33, 0x22, 0x02, 0x14, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca, 0x3a, 0x33,
+	0xc0, 0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00, 0xde, 0x07, 0x00, 0x08, 0xa5, 0x74, 0x26, 0xfe,
+	0xa4, 0x29, 0xaa, 0x40, 0x2c, 0x66, 0x2c, 0x27, 0x77, 0x38, 0x35, 0x33, 0x2f, 0xfe, 0x93, 0xe9,
+	0xfe, 0x39, 0x43, 0x08, 0x07, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xed, 0xa2, 0x86, 0xfe, 0x52,
+	0x03, 0xfe, 0xac, 0x89, 0xa8, 0x51, 0x33, 0x76, 0x2c, 0x31, 0x27, 0x6e, 0x33, 0x37, 0x9c, 0xac,
+	0xfe, 0x8b, 0x67, 0xfe, 0x41, 0x82, 0xfe, 0x10, 0x61, 0x08, 0x00, 0x07, 0xc0, 0x00, 0xda, 0x17,
+	0x13, 0xfe, 0xc5, 0x4b, 0x33, 0x35, 0xc0, 0x2e, 0x33, 0x9d, 0x8c, 0x02, 0x14, 0x00, 0xc0, 0x10,
+	0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00, 0xdd, 0x07, 0x00,
+	0xc1, 0x08, 0xa3, 0x86, 0xfe, 0x52, 0x04, 0x20, 0xa9, 0x41, 0x30, 0x2c, 0x66, 0x31, 0x38, 0xc0,
+	0x9f, 0x76, 0x30, 0x9f, 0x7c, 0xfe, 0x6a, 0xc8, 0x24, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xeb,
+	0x07, 0x00, 0x08, 0xab, 0x40, 0x09, 0xfe, 0xcd, 0x8b, 0xa1, 0x94, 0x77, 0x31, 0x67, 0x38, 0x2e,
+	0x5d, 0x37, 0x9d, 0x9c, 0xfe, 0x8b, 0x88, 0xfe, 0x41, 0x63, 0x1f, 0x9e, 0x7a, 0x00, 0xde, 0x17,
+	0x13, 0xfe, 0xc5, 0x4b, 0xa2, 0x95, 0x35, 0xc0, 0x2e, 0x33, 0x22, 0x02, 0x14, 0x00, 0xc0, 0x10,
+	0xfe, 0x9b, 0xca, 0xfe, 0xdd, 0x8b, 0x33, 0xc0, 0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00, 0xdd,
+	0x07, 0x00, 0xc2, 0x0f, 0xa3, 0x75, 0xac, 0x40, 0xfe, 0xa4, 0x4a, 0xa9, 0x41, 0x30, 0x33, 0x2e,
+	0x65, 0x6e, 0x5a, 0xa2, 0x68, 0xfe, 0xac, 0x8b, 0xfe, 0x4a, 0x05, 0x10, 0x05, 0x66, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xeb, 0x7a, 0xa8, 0x51, 0xfe, 0x8b, 0xa9, 0xfe, 0xcd, 0x4c, 0x30, 0x78, 0x76,
+	0xa0, 0x8a, 0x67, 0x5b, 0x6e, 0x5d, 0x29, 0x03, 0xfe, 0x41, 0x83, 0xfe, 0x10, 0x20, 0x56, 0x0c,
+	0x05, 0x00, 0xdd, 0x17, 0x13, 0xfe, 0xc5, 0x4b, 0xa2, 0x95, 0x35, 0xc0, 0x2e, 0x33, 0x9d, 0x8c,
+	0x02, 0xfe, 0x08, 0x41, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x32,
+	0xfe, 0x39, 0x42, 0x00, 0xdf, 0x05, 0xc0, 0x00, 0x07, 0x7a, 0x1f, 0xfe, 0x5a, 0x25, 0xfe, 0xa4,
+	0x6a, 0xa9, 0x41, 0x75, 0x65, 0x24, 0x69, 0x37, 0x39, 0x12, 0xfe, 0x10, 0x60, 0x05, 0xc0, 0x00,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xe9, 0x03, 0xc0, 0xa3, 0x85, 0xfe, 0x72, 0xc5, 0x22, 0xa2, 0x87,
+	0x9f, 0x96, 0x7e, 0x65, 0x27, 0x67, 0x3c, 0xa2, 0x67, 0x9d, 0x8b, 0x95, 0xdf, 0xfe, 0x39, 0x83,
+	0x1c, 0x00, 0xe1, 0x17, 0x13, 0xfe, 0xc5, 0x4b, 0x33, 0x67, 0xc0, 0x2e, 0x33, 0x22, 0x02, 0x14,
+	0x00, 0xc0, 0xa2, 0x86, 0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x99, 0x9e, 0xfe, 0x39,
+	0x42, 0x00, 0xe2, 0x07, 0xc0, 0x03, 0xa4, 0x65, 0xfe, 0x5a, 0x65, 0xfe, 0xac, 0xab, 0x36, 0x37,
+	0x3f, 0x37, 0x05, 0xfe, 0x5a, 0x45, 0xfe, 0x18, 0x80, 0x9d, 0x8b, 0xc1, 0x00, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xe9, 0x03, 0xa3, 0x76, 0x1e, 0xfe, 0xbc, 0xca, 0xa7, 0x51, 0x35, 0x66, 0xa2, 0x76,
+	0x2e, 0x6d, 0x33, 0x5f, 0x9d, 0xac, 0xfe, 0x93, 0xc9, 0xfe, 0x41, 0xa3, 0xfe, 0x08, 0x40, 0x00,
+	0xc0, 0x05, 0x00, 0xdf, 0x17, 0x13, 0x27, 0x33, 0x35, 0xc0, 0x69, 0x33, 0x22, 0x02, 0x14, 0x00,
+	0xc0, 0x10, 0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00, 0xe5,
+	0x08, 0x1d, 0xfe, 0x62, 0x65, 0xfe, 0xac, 0x8a, 0xa8, 0x42, 0x67, 0x98, 0xce, 0x1e, 0xfe, 0x18,
+	0x60, 0x05, 0xc0, 0x0c, 0xc0, 0x07, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xe8, 0xa1, 0x97, 0xa9,
+	0x51, 0xfe, 0xac, 0x4a, 0xfe, 0xd5, 0x6a, 0x64, 0x35, 0x6b, 0x66, 0x29, 0x2c, 0xc0, 0x9f, 0x8b,
+	0xfe, 0xa4, 0x4a, 0xfe, 0x49, 0xc5, 0x10, 0x00, 0xe3, 0x17, 0x13, 0x27, 0x33, 0x35, 0xc0, 0x2e,
+	0x33, 0x22, 0x02, 0x14, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x99,
+	0x9e, 0xfe, 0x39, 0x42, 0x00, 0xe6, 0x08, 0xa5, 0x63, 0xfe, 0x62, 0xc5, 0xfe, 0xb5, 0x2d, 0x9d,
+	0xab, 0xfe, 0x5a, 0x05, 0x24, 0x08, 0x05, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xe7, 0x05, 0xc0,
+	0x00, 0x0f, 0x03, 0xa6, 0x63, 0xfe, 0x93, 0x88, 0x3e, 0x2e, 0x65, 0x33, 0x67, 0x2d, 0x29, 0xc0,
+	0x5f, 0x9c, 0x9c, 0x12, 0x17, 0x00, 0xe4, 0x17, 0x13, 0x27, 0x33, 0x35, 0xc0, 0x2e, 0x33, 0x9d,
+	0x8c, 0x02, 0xfe, 0x08, 0x41, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca, 0xfe, 0xdd, 0x8b, 0x33, 0xc0,
+	0x2e, 0xc1, 0x99, 0x9e, 0xfe, 0x39, 0x42, 0x00, 0xe7, 0x08, 0xa6, 0x53, 0xab, 0x22, 0x62, 0x24,
+	0x08, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xe9, 0x05, 0xc0, 0x00, 0x03, 0x10, 0xfe, 0x6a, 0xa6,
+	0xfe, 0xbc, 0xea, 0x3f, 0x75, 0x67, 0x2b, 0x6e, 0x2b, 0x35, 0x5b, 0x9d, 0x9b, 0xfe, 0x72, 0xa5,
+	0xfe, 0x20, 0x80, 0x03, 0x00, 0xe4, 0x17, 0x13, 0x27, 0x33, 0x35, 0xc0, 0x2e, 0x33, 0x22, 0x02,
+	0x14, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca, 0xfe, 0xdd, 0x8b, 0x33, 0xc0, 0x2e, 0xc1, 0x32, 0xfe,
+	0x39, 0x42, 0x00, 0xe9, 0xa3, 0x67, 0x14, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xed, 0x05, 0x08,
+	0xab, 0x40, 0xfe, 0xb4, 0x8c, 0x39, 0xa0, 0x95, 0x7f, 0x2e, 0x35, 0x3a, 0x2e, 0x35, 0x43, 0xfe,
+	0x83, 0x47, 0x01, 0x03, 0x00, 0xe5, 0x17, 0x13, 0xfe, 0xc5, 0x4b, 0x33, 0x35, 0xc0, 0x2e, 0x33,
+	0x22, 0x02, 0x14, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x32, 0xfe,
+	0x39, 0x42, 0x00, 0xeb, 0x05, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xec, 0x05, 0xa5, 0x73, 0xfe,
+	0x8b, 0xc9, 0xfe, 0xcd, 0x6c, 0x2d, 0x69, 0x65, 0x2e, 0x35, 0x2e, 0xc0, 0x5b, 0xfe, 0xa4, 0x4a,
+	0xfe, 0x31, 0x21, 0x98, 0xbf, 0x07, 0x00, 0xe5, 0x17, 0x13, 0x27, 0x33, 0x35, 0xc0, 0x2e, 0x33,
+	0x22, 0x02, 0x14, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x99, 0x9e,
+	0xfe, 0x39, 0x42, 0x00, 0xeb, 0x05, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xec, 0x10, 0xfe, 0x52,
+	0x64, 0xfe, 0xb5, 0x0a, 0x30, 0x35, 0xc0, 0x65, 0x33, 0x76, 0xc0, 0x29, 0x9a, 0x9e, 0xfe, 0x52,
+	0x03, 0xfe, 0x10, 0x40, 0x07, 0xc0, 0x00, 0xe5, 0x17, 0x13, 0x27, 0x33, 0x35, 0xc0, 0x2e, 0x33,
+	0x22, 0x02, 0x14, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x32, 0xfe,
+	0x39, 0x42, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd7, 0x05, 0x00, 0xc1, 0x7a, 0x15, 0xfe,
+	0x9c, 0x09, 0xfe, 0xcd, 0x89, 0x79, 0x33, 0x9f, 0x9b, 0x35, 0x33, 0x7e, 0x38, 0x9d, 0x8b, 0xfe,
+	0x7b, 0x06, 0x10, 0x00, 0x07, 0xc0, 0x00, 0xe5, 0x17, 0x13, 0x27, 0x33, 0x35, 0xc0, 0x2e, 0x33,
+	0x9d, 0x8c, 0x02, 0x14, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x32,
+	0xfe, 0x39, 0x42, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd7, 0x05, 0x00, 0xc0, 0x03, 0xa3,
+	0x75, 0xfe, 0x72, 0xc7, 0x22, 0xa4, 0x62, 0x65, 0x9f, 0xab, 0x3c, 0x35, 0x2e, 0x69, 0x3c, 0xfe,
+	0x9b, 0xc9, 0xfe, 0x30, 0xe1, 0x00, 0x0c, 0x07, 0x00, 0xe6, 0x17, 0x13, 0xfe, 0xc5, 0x4b, 0x33,
+	0x35, 0xc0, 0x2e, 0x33, 0x9d, 0x8c, 0x02, 0x14, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca, 0x3a, 0x33,
+	0xc0, 0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd7, 0x05,
+	0xc0, 0x03, 0x7a, 0xab, 0x30, 0xfe, 0xa4, 0x09, 0xfe, 0xd5, 0x8b, 0xa1, 0x84, 0x62, 0x2e, 0x67,
+	0x7f, 0x30, 0x59, 0x9c, 0x9e, 0xfe, 0x51, 0xc4, 0x0b, 0x46, 0xe9, 0xa2, 0x87, 0x13, 0x27, 0x33,
+	0x35, 0xc0, 0x2e, 0x33, 0x22, 0x02, 0x14, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0,
+	0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd7, 0x05, 0x00,
+	0x03, 0xa3, 0x85, 0x09, 0xfe, 0xc5, 0x0b, 0xa4, 0x63, 0x79, 0x66, 0x2e, 0x67, 0xc0, 0x35, 0x36,
+	0xfe, 0x7b, 0x27, 0xfe, 0x20, 0xa1, 0x00, 0x07, 0x00, 0xe8, 0x17, 0x13, 0xfe, 0xc5, 0x4b, 0x33,
+	0x35, 0xc0, 0x2e, 0x33, 0x22, 0x02, 0x14, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0,
+	0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd9, 0x0b, 0xaa,
+	0x40, 0xfe, 0xa4, 0x29, 0xaa, 0x40, 0x68, 0x7e, 0x2e, 0x29, 0xc0, 0x2e, 0x3e, 0x99, 0xaf, 0xfe,
+	0x39, 0x62, 0x00, 0xeb, 0x17, 0x13, 0x27, 0x33, 0x35, 0xc0, 0x2e, 0x33, 0x22, 0x02, 0x14, 0x00,
+	0xc0, 0x10, 0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x99, 0x9e, 0xfe, 0x39, 0x42, 0x00,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd9, 0xa4, 0x84, 0xfe, 0x72, 0xc6, 0xfe, 0xc5, 0x0b, 0xa4,
+	0x63, 0x75, 0x2e, 0x35, 0x29, 0x27, 0x30, 0x9d, 0x9d, 0xfe, 0x62, 0xa6, 0x10, 0x07, 0xc0, 0x00,
+	0xe9, 0x17, 0x13, 0xfe, 0xc5, 0x4b, 0x33, 0x35, 0xc0, 0x2e, 0x33, 0x22, 0xfe, 0x49, 0xe4, 0x14,
+	0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd7, 0x05, 0x08, 0xaa, 0x50, 0xfe, 0x9c, 0x08, 0x2b, 0x33,
+	0xc0, 0x2e, 0x35, 0x2e, 0x69, 0xa1, 0x69, 0xfe, 0x93, 0xe9, 0xfe, 0x28, 0xe2, 0x03, 0x07, 0xc0,
+	0x69, 0xe9, 0x17, 0x13, 0xfe, 0xc5, 0x4b, 0x33, 0x35, 0xc0, 0x2e, 0x33, 0x22, 0x02, 0x14, 0x00,
+	0xc0, 0xa2, 0x86, 0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd6, 0x05, 0xc0, 0xa3, 0x85, 0xfe, 0x6a, 0xa5, 0xfe, 0xbc,
+	0xea, 0x2e, 0xc0, 0x6e, 0x35, 0xc0, 0x2e, 0x33, 0x9c, 0x8d, 0xfe, 0x52, 0x24, 0x0b, 0x57, 0x07,
+	0xc0, 0x00, 0xe9, 0x17, 0x13, 0x27, 0x33, 0x35, 0xc0, 0x2e, 0x33, 0x22, 0x02, 0x14, 0x00, 0xc0,
+	0x10, 0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xd8, 0xa9, 0x50, 0xfe, 0x93, 0xc7, 0xfe, 0xcd, 0x4a, 0x2e, 0xc1, 0x3a,
+	0x35, 0x2e, 0xa1, 0x79, 0xfe, 0x93, 0xc8, 0xfe, 0x20, 0xc1, 0x03, 0x0a, 0x07, 0xc0, 0x00, 0xe9,
+	0x17, 0x13, 0x27, 0x33, 0x35, 0xc0, 0x2e, 0x33, 0x22, 0x02, 0x14, 0x00, 0xc0, 0x10, 0xfe, 0x9b,
+	0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xd7, 0xa3, 0x75, 0xfe, 0x5a, 0x44, 0xfe, 0xb4, 0xea, 0x37, 0x71, 0x35, 0xc0, 0x33, 0x2b,
+	0x3a, 0x9c, 0x9d, 0xfe, 0x52, 0x04, 0x08, 0x00, 0xc0, 0x07, 0x00, 0xea, 0xa2, 0x87, 0x13, 0x27,
+	0x33, 0x35, 0xc0, 0x2e, 0x33, 0x22, 0x02, 0x14, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca, 0x3a, 0x33,
+	0xc0, 0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd7, 0x34,
+	0xfe, 0x83, 0x66, 0xfe, 0xcd, 0x6b, 0x37, 0x2e, 0x35, 0x2e, 0x33, 0x55, 0x01, 0xfe, 0x9b, 0xe9,
+	0x34, 0x00, 0xc7, 0x07, 0x00, 0xe4, 0x17, 0xfe, 0x73, 0x07, 0x27, 0x33, 0x35, 0xc0, 0x2e, 0x33,
+	0x22, 0x02, 0x14, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x32, 0xfe,
+	0x39, 0x42, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd6, 0x08, 0xab, 0x40, 0xfe, 0xa4, 0x49,
+	0x30, 0x2b, 0x35, 0x38, 0x2e, 0x33, 0x30, 0x9d, 0xac, 0xfe, 0x62, 0x45, 0x10, 0x00, 0xc0, 0x07,
+	0x00, 0xc4, 0x07, 0x00, 0xe4, 0x17, 0x13, 0x27, 0x33, 0x35, 0xc0, 0x2e, 0x33, 0x22, 0x02, 0x14,
+	0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd6, 0x18, 0xfe, 0x6a, 0x85, 0x0e, 0xa5, 0x62, 0x30, 0x35,
+	0x38, 0x55, 0x33, 0x37, 0xfe, 0xa4, 0x4a, 0xfe, 0x39, 0x22, 0x03, 0x00, 0xee, 0x17, 0x13, 0x27,
+	0x33, 0x35, 0xc0, 0x69, 0x33, 0x22, 0x02, 0x14, 0x00, 0xc0, 0xa2, 0x86, 0xfe, 0x9b, 0xca, 0x3a,
+	0x33, 0xc0, 0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd5,
+	0x03, 0xa8, 0x52, 0xfe, 0x93, 0xa8, 0xfe, 0xd5, 0x6b, 0xa2, 0x74, 0x66, 0x2e, 0x38, 0x2e, 0x30,
+	0x27, 0xfe, 0x72, 0xe6, 0x18, 0x00, 0xef, 0x17, 0x13, 0x27, 0x33, 0x35, 0xc0, 0x2e, 0x33, 0x22,
+	0x02, 0x14, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x99, 0x9e, 0xfe,
+	0x39, 0x42, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd5, 0x7e, 0xfe, 0x51, 0xe4, 0xfe, 0xb4,
+	0x69, 0x3a, 0x33, 0xc0, 0x2e, 0x38, 0x2e, 0x37, 0x9a, 0xae, 0xfe, 0x41, 0xa3, 0x03, 0x5b, 0x00,
+	0xee, 0x17, 0x13, 0x27, 0x33, 0x35, 0xc0, 0x69, 0x33, 0x22, 0x02, 0x14, 0x00, 0xc0, 0x10, 0xfe,
+	0x9b, 0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xd5, 0x1d, 0xfe, 0x72, 0xc6, 0xfe, 0xc4, 0xea, 0x33, 0xc1, 0x3a, 0x2e, 0x33, 0x37,
+	0xfe, 0x8b, 0xc9, 0xfe, 0x20, 0xc1, 0x07, 0x00, 0xef, 0x17, 0x13, 0x27, 0x33, 0x35, 0xc0, 0x2e,
+	0x33, 0x22, 0xfe, 0x49, 0xe4, 0x14, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0, 0x2e,
+	0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd2, 0x6e, 0xc0, 0x7a,
+	0xa7, 0x53, 0x3f, 0x26, 0x2e, 0x35, 0x3a, 0x2e, 0x69, 0x33, 0x9e, 0x7b, 0xfe, 0x62, 0x65, 0x10,
+	0x07, 0x00, 0xef, 0x17, 0x13, 0x27, 0x33, 0x35, 0xc0, 0x2e, 0x33, 0x22, 0x02, 0x14, 0x00, 0xc0,
+	0x10, 0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xd1, 0x6e, 0xc0, 0x00, 0x10, 0xfe, 0x49, 0xc3, 0xfe, 0xac, 0x69, 0xa9,
+	0x40, 0x2c, 0x33, 0xc0, 0x2e, 0x2c, 0x30, 0xfe, 0xac, 0x6a, 0x15, 0x08, 0x05, 0x00, 0xef, 0x17,
+	0x13, 0x27, 0x33, 0x35, 0xc0, 0x2e, 0x33, 0x22, 0x02, 0x14, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca,
+	0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xd1, 0x05, 0xc0, 0x77, 0xa3, 0x75, 0xfe, 0x62, 0x64, 0xfe, 0xc4, 0xe9, 0x33, 0x2c, 0x33, 0x2e,
+	0xc0, 0x2c, 0x9f, 0x8b, 0xfe, 0x8b, 0x68, 0xfe, 0x20, 0x81, 0x9d, 0x8b, 0x05, 0x00, 0xef, 0x17,
+	0x13, 0xfe, 0xc5, 0x4b, 0x33, 0x35, 0xc0, 0x2e, 0x33, 0x22, 0x02, 0x14, 0x00, 0xc0, 0x10, 0xfe,
+	0x9b, 0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x99, 0x9e, 0xfe, 0x39, 0x42, 0x00, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xd1, 0x05, 0xc0, 0x03, 0xa5, 0x64, 0xfe, 0x7b, 0x26, 0x23, 0x33, 0x69, 0xc0,
+	0x2e, 0xc0, 0x33, 0x22, 0x26, 0xfe, 0x18, 0x41, 0x42, 0x05, 0x00, 0xef, 0x17, 0x13, 0x27, 0x33,
+	0x35, 0xc0, 0x2e, 0x33, 0x22, 0x02, 0xfe, 0x08, 0x41, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca, 0x3a,
+	0x33, 0xc0, 0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd1,
+	0x05, 0x00, 0x03, 0xa9, 0x51, 0x04, 0x37, 0x33, 0x2c, 0x2e, 0xc0, 0x33, 0x30, 0x99, 0xbf, 0xfe,
+	0x49, 0x83, 0xfe, 0x10, 0x21, 0x07, 0x05, 0x00, 0xef, 0x17, 0x13, 0x27, 0x33, 0x35, 0xc0, 0x2e,
+	0x33, 0x22, 0x02, 0x14, 0x00, 0xc0, 0xa2, 0x86, 0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1,
+	0x32, 0xfe, 0x39, 0x42, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd3, 0xa1, 0x97, 0xfe, 0x51,
+	0xe4, 0xfe, 0xac, 0x8a, 0x37, 0x33, 0xc0, 0x2e, 0xc0, 0x30, 0x37, 0x04, 0xfe, 0x31, 0x01, 0x03,
+	0x07, 0x00, 0xf0, 0x17, 0x13, 0x27, 0x33, 0x35, 0xc0, 0x2e, 0x33, 0x22, 0x02, 0x14, 0x00, 0xc0,
+	0x10, 0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xd2, 0x03, 0xa2, 0x86, 0x26, 0xfe, 0xbc, 0xcb, 0x33, 0xc0, 0x2e, 0xc1,
+	0x30, 0xa0, 0x7a, 0xfe, 0x7b, 0x26, 0xfe, 0x20, 0xa1, 0x00, 0xf2, 0x17, 0xfe, 0x73, 0x07, 0x27,
+	0x33, 0x35, 0xc0, 0x2e, 0x33, 0x22, 0x02, 0xfe, 0x08, 0x41, 0x00, 0xc0, 0xa2, 0x86, 0xfe, 0x9b,
+	0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xd2, 0x08, 0x20, 0xfe, 0x7b, 0x06, 0x25, 0x33, 0xc0, 0x2e, 0xc1, 0x30, 0x9d, 0x8c, 0xfe,
+	0x5a, 0x64, 0x18, 0x00, 0xf2, 0x17, 0x13, 0x27, 0x33, 0x35, 0xc0, 0x2e, 0x33, 0x22, 0x02, 0x14,
+	0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd2, 0x03, 0xa6, 0x63, 0xfe, 0x8b, 0x88, 0xfe, 0xd5, 0x4b,
+	0x2e, 0xc1, 0x7a, 0x2e, 0x30, 0x9a, 0x9f, 0xfe, 0x41, 0x83, 0x0b, 0x00, 0xf2, 0x17, 0x13, 0x27,
+	0x33, 0x2e, 0x35, 0x2e, 0x33, 0x22, 0x02, 0x14, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca, 0x3a, 0x33,
+	0xc0, 0x2e, 0xc0, 0x2b, 0x32, 0xfe, 0x39, 0x42, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd1,
+	0x07, 0x7a, 0x15, 0xfe, 0xa4, 0x08, 0xab, 0x30, 0x78, 0xc0, 0x67, 0x7b, 0x2e, 0x6e, 0xfe, 0x9c,
+	0x08, 0x01, 0x00, 0xf2, 0x03, 0x1a, 0xfe, 0x7b, 0x08, 0x22, 0x33, 0x2e, 0x35, 0x2e, 0x33, 0x9c,
+	0x9d, 0x02, 0xfe, 0x08, 0x40, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xcb, 0xfe, 0xdd, 0x6c, 0x33, 0xc0,
+	0x2e, 0xc0, 0x2b, 0x99, 0xae, 0xfe, 0x31, 0x42, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd1,
+	0x07, 0x7e, 0x36, 0xfe, 0xac, 0x88, 0x2e, 0x27, 0xc0, 0x29, 0x7b, 0x2e, 0x30, 0xfe, 0x83, 0x87,
+	0xfe, 0x20, 0xc1, 0x07, 0xc0, 0x00, 0xf1, 0x1a, 0x13, 0x22, 0xa3, 0x84, 0x2e, 0x35, 0x2e, 0x33,
+	0x1d, 0x02, 0x0d, 0x00, 0xc0, 0x10, 0x1c, 0x35, 0x33, 0xc0, 0x2e, 0xc0, 0x24, 0x32, 0x12, 0x00,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd1, 0x07, 0x17, 0xfe, 0x5a, 0x44, 0xfe, 0xc4, 0xea, 0x2e,
+	0xc0, 0x27, 0x2e, 0x67, 0x2e, 0x5f, 0xfe, 0x73, 0x06, 0xfe, 0x10, 0x81, 0x9d, 0x9c, 0xc0, 0x69,
+	0x00, 0xf0, 0xa3, 0x75, 0xfe, 0x73, 0x07, 0x22, 0x33, 0x2e, 0x35, 0x2e, 0x35, 0x1d, 0x02, 0x0d,
+	0x00, 0xc0, 0x10, 0x1c, 0x3a, 0x33, 0xc0, 0x2e, 0xc0, 0x24, 0x32, 0x12, 0x00, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xd1, 0x07, 0xa4, 0x74, 0xfe, 0x6a, 0xa5, 0x25, 0x2e, 0xc0, 0x7a, 0x2e, 0xc1,
+	0x2f, 0xfe, 0x62, 0x85, 0xfe, 0x10, 0x61, 0x43, 0x07, 0x00, 0xf1, 0x1c, 0xfe, 0x73, 0x07, 0x22,
+	0xa3, 0x84, 0x2e, 0x35, 0x2e, 0x35, 0x1d, 0x02, 0x0d, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xcb, 0x3a,
+	0x33, 0xc1, 0x2e, 0x5a, 0x39, 0x12, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd2, 0x2c, 0xfe,
+	0x7b, 0x26, 0xfe, 0xd5, 0x4b, 0x35, 0x29, 0x27, 0xc0, 0x2e, 0x3a, 0x9d, 0x8c, 0xfe, 0x52, 0x04,
+	0xfe, 0x08, 0x41, 0x07, 0xc0, 0x00, 0xed, 0x07, 0x0c, 0xc0, 0x0f, 0xa2, 0x86, 0xfe, 0x72, 0xe7,
+	0x1d, 0x33, 0x2e, 0xc2, 0x1d, 0x02, 0x0d, 0x00, 0xc0, 0x10, 0x1c, 0x3a, 0x33, 0xc2, 0x52, 0x39,
+	0xfe, 0x39, 0x22, 0xfe, 0x08, 0x01, 0x0c, 0xc2, 0x07, 0xc0, 0x00, 0xf6, 0x6e, 0xc3, 0x6f, 0x0c,
+	0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xca, 0xa6, 0x63, 0xfe, 0x83, 0x26, 0x2d, 0x3a, 0x2e, 0x33,
+	0xc0, 0x2e, 0xa1, 0x79, 0x98, 0xbe, 0xfe, 0x41, 0xa4, 0x08, 0x07, 0xc0, 0x00, 0x03, 0x00, 0x07,
+	0xed, 0x0a, 0x1f, 0x0e, 0xfe, 0xc4, 0xeb, 0x2e, 0xc2, 0x6b, 0x1d, 0x02, 0x0d, 0x00, 0xc0, 0xa2,
+	0x86, 0x1c, 0x38, 0x33, 0xc1, 0x2e, 0x26, 0x9a, 0x9f, 0xfe, 0x39, 0x22, 0x0a, 0xc0, 0x07, 0x0c,
+	0xc0, 0x07, 0xf8, 0x0c, 0xc0, 0x05, 0xc0, 0x66, 0x07, 0xc0, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xca, 0xa7, 0x62, 0xfe, 0x8b, 0x67, 0xfe, 0xd5, 0x6a, 0x33, 0x35, 0xc0, 0x2e, 0xc0, 0xa0, 0x8a,
+	0x95, 0xcf, 0xfe, 0x41, 0x62, 0x0b, 0xc0, 0x08, 0xc0, 0x0b, 0x08, 0x0f, 0xe8, 0x08, 0xc3, 0x0b,
+	0x20, 0xfe, 0x7b, 0x07, 0xfe, 0xc5, 0x0b, 0x2e, 0x27, 0x2e, 0xc0, 0x35, 0x1d, 0x02, 0x0d, 0x00,
+	0xc0, 0xa2, 0x86, 0x1c, 0x38, 0x2e, 0x33, 0x2e, 0x66, 0x35, 0xfe, 0xb4, 0x6b, 0xfe, 0x41, 0x22,
+	0x97, 0xbf, 0x0b, 0x08, 0xc1, 0x06, 0xc0, 0x0f, 0xf5, 0x08, 0xc2, 0x0d, 0x08, 0x00, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xcb, 0x05, 0xa8, 0x62, 0xfe, 0x93, 0xa7, 0x2b, 0x2e, 0x30, 0x35, 0xc2, 0xfe,
+	0xac, 0x29, 0xfe, 0x5a, 0x03, 0x99, 0xbe, 0xc0, 0x0d, 0x10, 0xc0, 0x0d, 0x6b, 0x0d, 0xe9, 0x10,
+	0xc1, 0x6e, 0xa2, 0x86, 0xfe, 0x8b, 0x67, 0xfe, 0xc4, 0xea, 0x2e, 0x27, 0x2e, 0x35, 0xc0, 0x1d,
+	0x02, 0xfe, 0x08, 0x40, 0x00, 0xc0, 0xa2, 0x86, 0x1c, 0xfe, 0xe5, 0x6b, 0x2e, 0x33, 0x2e, 0x29,
+	0x35, 0x99, 0xbf, 0xfe, 0x62, 0x25, 0x98, 0xbd, 0xc1, 0x5a, 0xc0, 0x10, 0x66, 0x0d, 0xf7, 0x12,
+	0xc1, 0x52, 0x9a, 0xbc, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xca, 0x08, 0x15, 0xfe, 0x9b, 0xe8,
+	0xfe, 0xd5, 0x6a, 0x2e, 0x35, 0x2b, 0x27, 0xc0, 0x33, 0x9c, 0xab, 0x9c, 0x9c, 0x56, 0xc2, 0x69,
+	0x7b, 0x66, 0x2d, 0xe9, 0x66, 0xc0, 0x6f, 0x66, 0x7e, 0x1d, 0xa3, 0x74, 0x2e, 0xc1, 0x6b, 0xc0,
+	0x1d, 0x02, 0xfe, 0x08, 0x41, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xcb, 0x38, 0x33, 0xc0, 0x2e, 0x27,
+	0x7f, 0x43, 0x9a, 0xbd, 0x34, 0x69, 0xc3, 0x34, 0x2d, 0xf5, 0x65, 0x2d, 0xc0, 0x34, 0x5a, 0x96,
+	0xcf, 0xfe, 0x20, 0xc1, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xca, 0x08, 0xfe, 0x41, 0x82, 0xfe,
+	0xa4, 0x08, 0x2e, 0x27, 0x2b, 0x6d, 0x7a, 0xc2, 0x5b, 0x6b, 0xc1, 0x33, 0xc0, 0x76, 0x2e, 0x35,
+	0x38, 0xe5, 0x35, 0x3a, 0xc0, 0x35, 0xc0, 0x01, 0x56, 0xc0, 0x37, 0x2e, 0xc2, 0x35, 0xc0, 0x1d,
+	0x02, 0xfe, 0x08, 0x41, 0x00, 0xc0, 0x10, 0x1c, 0x38, 0x33, 0xc0, 0x2e, 0x27, 0xc0, 0x33, 0x35,
+	0x3a, 0x37, 0x6d, 0xc1, 0x37, 0x3a, 0xc0, 0x66, 0x38, 0xf2, 0x35, 0xc2, 0x37, 0x3b, 0xfe, 0x93,
+	0xe9, 0xfe, 0x29, 0x01, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xca, 0x08, 0xfe, 0x41, 0xa3, 0x28,
+	0x33, 0x27, 0x6b, 0x33, 0x2c, 0xc0, 0x27, 0x2c, 0xc0, 0x30, 0x33, 0xc0, 0x2c, 0x76, 0xc0, 0x31,
+	0xea, 0x2e, 0xc0, 0x33, 0xc0, 0x3a, 0x33, 0xc0, 0x2e, 0x31, 0x2e, 0xc0, 0x35, 0x1d, 0x02, 0x14,
+	0x00, 0xc0, 0xa2, 0x86, 0x1c, 0x38, 0x33, 0xc0, 0x2e, 0xc3, 0x33, 0x2c, 0xc3, 0x33, 0x2e, 0x31,
+	0xf4, 0x38, 0x31, 0xc0, 0x2e, 0x4b, 0x04, 0x3e, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xca, 0x08,
+	0xfe, 0x49, 0xc3, 0x2d, 0x33, 0xc0, 0x2e, 0xc4, 0x33, 0xc1, 0x2e, 0xc2, 0x33, 0xe6, 0x2e, 0xc0,
+	0x33, 0x2e, 0x31, 0x27, 0x2c, 0xc1, 0x33, 0xc0, 0x2e, 0x31, 0x2e, 0xc1, 0x1d, 0x02, 0x14, 0x00,
+	0xc0, 0x10, 0x1c, 0x38, 0x2c, 0x33, 0x35, 0x66, 0x35, 0x2e, 0xc0, 0x33, 0xfc, 0x35, 0x2e, 0x27,
+	0xc0, 0x37, 0x04, 0xfe, 0x28, 0xe1, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xca, 0x08, 0x36, 0x2d,
+	0x33, 0xc0, 0x2e, 0xc0, 0x35, 0xc3, 0x2e, 0xc4, 0x5e, 0xe9, 0x2e, 0xc0, 0x27, 0xc0, 0x2c, 0xc0,
+	0x33, 0x2e, 0xc0, 0x31, 0x2e, 0xc1, 0x1d, 0x02, 0x14, 0x00, 0xc0, 0x10, 0x1c, 0x38, 0x2c, 0x33,
+	0x35, 0x66, 0x35, 0xc0, 0x2e, 0xc2, 0x35, 0x2e, 0xc2, 0x5e, 0xf5, 0x2e, 0x27, 0xc0, 0xa0, 0x7a,
+	0x04, 0x39, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xca, 0x08, 0x36, 0x2d, 0x33, 0x2c, 0x27, 0x2c,
+	0x2e, 0x35, 0xc1, 0x2e, 0xc0, 0x27, 0x2e, 0xc2, 0x2b, 0x33, 0x2c, 0xe3, 0x33, 0x30, 0xc0, 0x33,
+	0x2e, 0xc2, 0x33, 0x30, 0xc0, 0x2e, 0xc4, 0x1d, 0x02, 0x14, 0x00, 0xc0, 0x10, 0x1c, 0x38, 0x2c,
+	0x33, 0x35, 0x66, 0x35, 0xc0, 0x2e, 0xc2, 0x66, 0xc0, 0x2e, 0xc1, 0x2c, 0xf3, 0x33, 0xc0, 0x2e,
+	0xc1, 0xa0, 0x7a, 0x04, 0xfe, 0x28, 0xe1, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xca, 0x08, 0x36,
+	0x2d, 0x33, 0x2c, 0x27, 0x2c, 0xc0, 0x2e, 0xc1, 0x33, 0x5a, 0xc1, 0x33, 0x35, 0x2e, 0xe7, 0x33,
+	0xc0, 0x2e, 0x35, 0xc2, 0x37, 0xc1, 0x35, 0xc0, 0x2e, 0xc2, 0x1d, 0x02, 0xfe, 0x08, 0x40, 0x00,
+	0xc0, 0x10, 0x1c, 0x38, 0x33, 0xc0, 0x2e, 0xc0, 0x27, 0x2e, 0xc0, 0x33, 0x2e, 0x35, 0xc1, 0x2e,
+	0x33, 0xc0, 0x2e, 0xf6, 0x35, 0xc0, 0xa0, 0x7a, 0xfe, 0x93, 0xc9, 0x05, 0x98, 0xbe, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xca, 0x08, 0x36, 0xfe, 0xac, 0x89, 0x33, 0x27, 0xc0, 0x2c, 0x27, 0x2e, 0x27,
+	0x56, 0x5b, 0x2f, 0xc0, 0x6e, 0x2f, 0xc0, 0x76, 0xe7, 0x69, 0xc0, 0x2d, 0x5a, 0x6b, 0xc1, 0x6e,
+	0xc0, 0x7e, 0x33, 0x2e, 0x7a, 0x2e, 0xc1, 0x1d, 0x02, 0x0d, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca,
+	0x38, 0x33, 0xc0, 0x2e, 0x27, 0x69, 0xa2, 0x68, 0x2f, 0xc7, 0x2d, 0xf2, 0x26, 0x23, 0xc0, 0x2a,
+	0xc0, 0xa0, 0x8a, 0x5b, 0xfe, 0x83, 0xa9, 0xfe, 0x29, 0x22, 0x98, 0xbe, 0x66, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xc9, 0x08, 0xfe, 0x49, 0xc3, 0xfe, 0xac, 0x68, 0x2c, 0x76, 0x2e, 0xc1, 0x35, 0x2e,
+	0x99, 0xad, 0x98, 0xbf, 0x42, 0xc1, 0x69, 0x7a, 0x67, 0x1c, 0xe8, 0x6b, 0x20, 0x7b, 0x6e, 0x20,
+	0x6f, 0x2f, 0xa9, 0x51, 0xa6, 0x62, 0x27, 0x31, 0x5a, 0xc1, 0x1d, 0x02, 0x0d, 0x00, 0xc0, 0x10,
+	0x15, 0x35, 0x33, 0xc0, 0x2e, 0x29, 0x27, 0x9f, 0x6a, 0x04, 0x2a, 0x59, 0x6e, 0x69, 0x19, 0xc0,
+	0x20, 0xc0, 0x1c, 0xf6, 0x23, 0x2f, 0x57, 0x98, 0xbd, 0x94, 0xdf, 0x05, 0x00, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xc9, 0x08, 0xfe, 0x41, 0xa2, 0x21, 0x33, 0x66, 0x35, 0xc1, 0x6b, 0x5a, 0xfe, 0x8b,
+	0x67, 0xfe, 0x39, 0x42, 0x9b, 0xac, 0x5b, 0x69, 0xc0, 0x76, 0xc1, 0x29, 0xe9, 0x2c, 0xc0, 0x6e,
+	0x2c, 0xa3, 0x75, 0xfe, 0x83, 0x27, 0xfe, 0xc5, 0x0a, 0x2e, 0xc3, 0x1d, 0x02, 0x0d, 0x00, 0xc0,
+	0x10, 0xfe, 0x9b, 0xca, 0xfe, 0xe5, 0x6b, 0x33, 0xc0, 0x35, 0x67, 0xa2, 0x66, 0x98, 0xae, 0xfe,
+	0x49, 0xa4, 0x98, 0xbe, 0xc0, 0x29, 0xc1, 0x2c, 0x29, 0xf7, 0x2c, 0xc2, 0x24, 0x08, 0x00, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xca, 0x08, 0xfe, 0x41, 0x82, 0xfe, 0xa4, 0x28, 0xfe, 0xdd, 0x8a, 0x2e,
+	0x35, 0xc0, 0x3c, 0x57, 0x6f, 0x2a, 0xfe, 0x28, 0xc1, 0x9a, 0xae, 0x5a, 0xc2, 0x00, 0xee, 0x03,
+	0xa3, 0x76, 0xfe, 0x7b, 0x07, 0x1d, 0x33, 0x69, 0x2e, 0x2c, 0x33, 0x1d, 0x02, 0x0d, 0x00, 0xc0,
+	0x10, 0x15, 0xfe, 0xe5, 0x6b, 0x33, 0xc0, 0x2e, 0x35, 0x01, 0x97, 0xae, 0xfe, 0x39, 0x23, 0x03,
+	0x07, 0x00, 0xc0, 0x07, 0x00, 0xf9, 0x03, 0xc1, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xcc, 0x08,
+	0xaa, 0x40, 0xfe, 0x9c, 0x08, 0xfe, 0xd5, 0x8a, 0x2e, 0xc1, 0x3a, 0x57, 0x6f, 0xfe, 0x8b, 0xa8,
+	0xfe, 0x28, 0xe2, 0x0a, 0x07, 0xc1, 0x69, 0xec, 0x07, 0xc0, 0x00, 0xc0, 0x1f, 0xfe, 0x73, 0x08,
+	0xfe, 0xc5, 0x0c, 0x30, 0x2c, 0xc1, 0x33, 0x1d, 0x02, 0x0d, 0x00, 0xc0, 0x10, 0x15, 0x38, 0x33,
+	0xc0, 0x2c, 0x66, 0x30, 0x98, 0xae, 0xfe, 0x39, 0x62, 0x08, 0x5b, 0x00, 0x07, 0xc0, 0x00, 0xfc,
+	0x07, 0xc0, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xcb, 0xa9, 0x51, 0xfe, 0x93, 0xe8, 0x30, 0x2e,
+	0xc0, 0x27, 0x33, 0x56, 0x6f, 0xfe, 0x8b, 0xc7, 0xfe, 0x29, 0x01, 0x03, 0x00, 0xef, 0x07, 0xc0,
+	0x00, 0xc0, 0xa3, 0x76, 0xfe, 0x73, 0x08, 0x24, 0x30, 0x2e, 0xc1, 0x33, 0x9d, 0x8c, 0x02, 0xfe,
+	0x08, 0x40, 0x00, 0xc0, 0x10, 0x15, 0x38, 0x33, 0xc0, 0x2c, 0x27, 0x5e, 0x98, 0xae, 0xfe, 0x39,
+	0x41, 0x08, 0x00, 0xfd, 0xc3, 0x07, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xcb, 0xa8, 0x52, 0xfe,
+	0x8b, 0xa7, 0x2b, 0x2e, 0xc0, 0x27, 0x2e, 0x2b, 0x30, 0xfe, 0x9c, 0x27, 0xfe, 0x31, 0x41, 0x08,
+	0x00, 0x6e, 0x00, 0xc0, 0x07, 0x00, 0xea, 0x07, 0xc0, 0x00, 0xc0, 0xa3, 0x75, 0xfe, 0x72, 0xe8,
+	0x24, 0xa3, 0x84, 0x2e, 0x7a, 0x2e, 0x33, 0x22, 0x02, 0x0d, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca,
+	0x38, 0x33, 0xc0, 0x2e, 0xc0, 0x59, 0x98, 0xbf, 0xfe, 0x39, 0x22, 0x00, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xd2, 0xa7, 0x62, 0xfe, 0x83, 0x67, 0xfe, 0xcd, 0x6a, 0x2e, 0x38, 0x31, 0x38, 0x56,
+	0x37, 0x98, 0xbd, 0xfe, 0x41, 0x83, 0x08, 0x00, 0x05, 0xc0, 0x00, 0xf0, 0xa2, 0x96, 0xfe, 0x72,
+	0xe8, 0xfe, 0xc5, 0x0c, 0x35, 0x31, 0x66, 0xc0, 0x33, 0x22, 0x02, 0x0d, 0x00, 0xc0, 0xa2, 0x86,
+	0xfe, 0x9b, 0xca, 0x33, 0xc1, 0x2e, 0xc1, 0x98, 0xaf, 0x17, 0x03, 0x07, 0x00, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xd0, 0xa5, 0x74, 0xfe, 0x7b, 0x26, 0xfe, 0xcd, 0x4a, 0x2e, 0x66, 0x38, 0x35,
+	0x30, 0xa2, 0x66, 0x9b, 0x9d, 0x02, 0xfe, 0x10, 0x21, 0x07, 0x00, 0xc2, 0x05, 0xe8, 0x00, 0xc4,
+	0x13, 0xfe, 0x7a, 0xe8, 0xfe, 0xc5, 0x2c, 0x33, 0x2e, 0x76, 0x31, 0x33, 0x22, 0x02, 0x0d, 0x00,
+	0xc0, 0x10, 0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc0, 0x5a, 0x32, 0xfe, 0x31, 0x22, 0x00,
+	0xc6, 0x05, 0xf3, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd3, 0xa4, 0x75, 0xfe, 0x6a, 0xc5, 0xfe,
+	0xc5, 0x2a, 0x2e, 0xc0, 0x7b, 0x35, 0x2e, 0x5d, 0x9e, 0x8c, 0xfe, 0x5a, 0x25, 0xfe, 0x10, 0x41,
+	0x07, 0xc0, 0x00, 0xc1, 0x05, 0x00, 0xed, 0x10, 0x1a, 0xfe, 0xc5, 0x2c, 0x33, 0x2e, 0xc1, 0x33,
+	0x22, 0x02, 0xfe, 0x08, 0x41, 0x00, 0xc0, 0x10, 0x15, 0x3a, 0x33, 0x2e, 0xc1, 0x59, 0x32, 0xfe,
+	0x31, 0x42, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd2, 0xa3, 0x85, 0xfe, 0x62, 0x85, 0xfe,
+	0xc5, 0x0a, 0x33, 0x65, 0x2e, 0xc0, 0x6d, 0x59, 0xa0, 0x7a, 0x2b, 0x1c, 0x07, 0xc0, 0x00, 0xf1,
+	0x10, 0x1a, 0x29, 0x33, 0x2e, 0xc1, 0x33, 0x9d, 0x8c, 0x02, 0x14, 0x00, 0xc0, 0x10, 0x15, 0x3a,
+	0x33, 0x2e, 0xc1, 0x24, 0x32, 0x12, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd2, 0x10, 0xfe,
+	0x52, 0x03, 0xfe, 0xb4, 0xca, 0x3a, 0x27, 0x2e, 0xc0, 0x2c, 0x5a, 0xa0, 0x7a, 0xfe, 0x7b, 0x27,
+	0xfe, 0x18, 0xa1, 0x00, 0x07, 0x00, 0xf1, 0x10, 0x1a, 0x22, 0xa3, 0x74, 0x2e, 0x35, 0x33, 0xc0,
+	0x22, 0x02, 0x14, 0x00, 0xc0, 0x10, 0x15, 0x3a, 0x33, 0x2e, 0xc1, 0x24, 0x32, 0x12, 0x00, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd2, 0x08, 0xaa, 0x50, 0xfe, 0xa4, 0x29, 0xfe, 0xd5, 0x6a, 0x27,
+	0x2e, 0xc1, 0x33, 0x37, 0x09, 0xfe, 0x20, 0xe1, 0x00, 0xf3, 0x17, 0xfe, 0x73, 0x07, 0x22, 0x33,
+	0x2e, 0x35, 0x2e, 0x33, 0x22, 0x02, 0x14, 0x00, 0xc0, 0x10, 0x15, 0x3a, 0x33, 0x2e, 0xc1, 0x2b,
+	0x32, 0x12, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd2, 0x7a, 0xa8, 0x52, 0xfe, 0x9b, 0xc8,
+	0x2b, 0x78, 0x27, 0x2e, 0xc1, 0x37, 0x2a, 0xfe, 0x31, 0x62, 0xfe, 0x08, 0x20, 0x57, 0x00, 0xf1,
+	0xa2, 0x97, 0x13, 0x22, 0x33, 0x2e, 0x35, 0x2e, 0x33, 0x22, 0x02, 0x14, 0x00, 0xc0, 0x10, 0x15,
+	0x3a, 0x33, 0x2e, 0xc1, 0x30, 0x32, 0x12, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd3, 0xa5,
+	0x74, 0x1e, 0x23, 0xa2, 0x85, 0xc0, 0x2e, 0xc1, 0x37, 0x9c, 0x8c, 0xfe, 0x52, 0x24, 0x10, 0x07,
+	0x00, 0xf0, 0x07, 0x1a, 0xfe, 0x7b, 0x07, 0x22, 0x33, 0x2e, 0x35, 0x2e, 0x33, 0x22, 0x02, 0x14,
+	0x00, 0xc0, 0x10, 0x15, 0x3a, 0x33, 0x2e, 0xc1, 0x30, 0x32, 0x12, 0x00, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xd3, 0xa2, 0x96, 0xfe, 0x6a, 0x85, 0xfe, 0xbd, 0x0a, 0xa5, 0x72, 0x27, 0x6b, 0xc1,
+	0x30, 0xa0, 0x7a, 0xfe, 0x73, 0x07, 0xfe, 0x18, 0x81, 0x0a, 0x00, 0xf0, 0x07, 0xa2, 0x86, 0x13,
+	0xfe, 0xc5, 0x4b, 0x33, 0x2e, 0x35, 0x2e, 0x33, 0x22, 0x02, 0x14, 0x00, 0xc0, 0x10, 0x15, 0x3a,
+	0x33, 0x2e, 0xc1, 0x2b, 0x32, 0x12, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd1, 0x05, 0xc0,
+	0x08, 0xfe, 0x52, 0x04, 0x06, 0xa7, 0x51, 0x2c, 0x66, 0x2e, 0x33, 0x30, 0xa1, 0x79, 0x3c, 0xfe,
+	0x28, 0xc1, 0x9a, 0xae, 0x00, 0xf1, 0x17, 0x13, 0xfe, 0xc5, 0x4b, 0x33, 0x2e, 0x6b, 0x2e, 0x33,
+	0x22, 0x02, 0x14, 0x00, 0xc0, 0x10, 0x15, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42,
+	0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd1, 0x05, 0xc0, 0x08, 0xab, 0x40, 0xfe, 0x9c, 0x29,
+	0x30, 0x2c, 0x2e, 0xc0, 0x33, 0x59, 0xa1, 0x79, 0xfe, 0xa4, 0x4a, 0xfe, 0x41, 0x22, 0x97, 0xbf,
+	0x00, 0xf1, 0x17, 0xfe, 0x73, 0x07, 0x27, 0x33, 0x35, 0xc0, 0x2e, 0x33, 0x22, 0x02, 0x14, 0x00,
+	0xc0, 0x10, 0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd3, 0x7a, 0xa7, 0x53, 0xfe, 0x83, 0x87, 0x28, 0x2e, 0xc0, 0x35,
+	0x2e, 0x6d, 0x37, 0x9b, 0xbe, 0xfe, 0x5a, 0x04, 0xfe, 0x18, 0x40, 0x9e, 0x7a, 0x05, 0x00, 0xef,
+	0x17, 0xfe, 0x73, 0x07, 0x27, 0x33, 0x35, 0xc0, 0x2e, 0x33, 0x22, 0x02, 0x14, 0x00, 0xc0, 0x10,
+	0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xd4, 0x24, 0xfe, 0x6a, 0xa5, 0xfe, 0xc5, 0x0a, 0xa4, 0x74, 0x63, 0x35, 0x33,
+	0x68, 0x33, 0x9e, 0x9c, 0xfe, 0x7b, 0x07, 0xfe, 0x20, 0x80, 0x03, 0x05, 0x00, 0xef, 0x17, 0x13,
+	0x27, 0x33, 0x35, 0xc0, 0x2e, 0x33, 0x22, 0x02, 0x14, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca, 0x3a,
+	0x33, 0xc0, 0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd3,
+	0x07, 0x08, 0xfe, 0x49, 0xe3, 0xfe, 0xb4, 0xa9, 0xa7, 0x63, 0x35, 0x2e, 0x69, 0x25, 0x27, 0x01,
+	0xfe, 0xa4, 0x0a, 0xfe, 0x31, 0x02, 0x03, 0x05, 0xc0, 0x00, 0xee, 0x17, 0x13, 0xfe, 0xc5, 0x4b,
+	0x33, 0x35, 0xc0, 0x2e, 0x33, 0x9d, 0x8c, 0x02, 0x14, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca, 0x3a,
+	0x33, 0xc0, 0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd2,
+	0x0c, 0xc0, 0x03, 0x15, 0x11, 0xaa, 0x51, 0x2e, 0xc0, 0x69, 0xc1, 0x3a, 0x9a, 0xaf, 0xfe, 0x51,
+	0xe5, 0xfe, 0x10, 0x20, 0x05, 0x00, 0xef, 0xa2, 0x87, 0x13, 0xfe, 0xc5, 0x4b, 0x33, 0x35, 0xc0,
+	0x2e, 0x33, 0x22, 0x02, 0x14, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1,
+	0x32, 0xfe, 0x39, 0x42, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd3, 0x07, 0x00, 0xa6, 0x63,
+	0xfe, 0x83, 0x46, 0xfe, 0xcd, 0x2b, 0x35, 0x2e, 0x69, 0x2e, 0xc1, 0x4b, 0x1b, 0x24, 0x05, 0x00,
+	0xef, 0x17, 0x13, 0xfe, 0xc5, 0x4b, 0x33, 0x35, 0xc0, 0x2e, 0x33, 0x22, 0x02, 0x14, 0x00, 0xc0,
+	0x10, 0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xd5, 0x10, 0xfe, 0x5a, 0x44, 0xfe, 0xb4, 0xaa, 0x3a, 0x2e, 0xc0, 0x30,
+	0xc0, 0x5c, 0xa2, 0x67, 0x2a, 0x12, 0xfe, 0x08, 0x21, 0x00, 0xef, 0xa2, 0x87, 0x13, 0x27, 0x33,
+	0x67, 0xc0, 0x2e, 0x33, 0x22, 0x02, 0x14, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0,
+	0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd6, 0xfe, 0x39,
+	0x62, 0x09, 0xfe, 0xd5, 0x6b, 0x2e, 0x35, 0x30, 0xc0, 0x24, 0xa2, 0x66, 0x9c, 0x9d, 0xfe, 0x62,
+	0x85, 0x17, 0x00, 0xef, 0x17, 0x13, 0x27, 0x33, 0x35, 0xc0, 0x69, 0x33, 0x22, 0x02, 0x14, 0x00,
+	0xc0, 0x10, 0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x99, 0x9e, 0xfe, 0x39, 0x42, 0x00,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd6, 0xa5, 0x74, 0xfe, 0x72, 0xe6, 0x22, 0x33, 0x2e, 0x35,
+	0x38, 0x2e, 0x29, 0xa1, 0x69, 0xfe, 0x93, 0xe9, 0xfe, 0x28, 0xc1, 0x03, 0x00, 0xee, 0x17, 0x13,
+	0x27, 0x33, 0x35, 0xc0, 0x2e, 0x33, 0x22, 0x02, 0x14, 0x00, 0xc0, 0xa2, 0x86, 0xfe, 0x9b, 0xca,
+	0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xd6, 0x0b, 0xfe, 0x51, 0xe3, 0xfe, 0xb4, 0xa9, 0xa7, 0x52, 0x33, 0x2e, 0x7a, 0x2e, 0xc0, 0xa2,
+	0x67, 0x9a, 0xad, 0xfe, 0x49, 0xc3, 0xfe, 0x08, 0x20, 0x00, 0xee, 0x17, 0x13, 0x27, 0x33, 0x35,
+	0xc0, 0x2e, 0x33, 0x22, 0x02, 0x14, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca, 0xfe, 0xdd, 0x8b, 0x33,
+	0xc0, 0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd6, 0x03,
+	0xa7, 0x52, 0xfe, 0x8b, 0xc7, 0xfe, 0xcd, 0x8a, 0x30, 0x2e, 0xc0, 0x66, 0xc0, 0x33, 0x57, 0xfe,
+	0x8b, 0x88, 0x2c, 0x00, 0xc1, 0x05, 0x00, 0xea, 0x17, 0x13, 0x27, 0x33, 0x35, 0xc0, 0x2e, 0x33,
+	0x22, 0x02, 0x14, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca, 0xfe, 0xdd, 0x8b, 0x33, 0xc0, 0x2e, 0xc1,
+	0x99, 0x9e, 0xfe, 0x39, 0x42, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd7, 0xa3, 0x75, 0xfe,
+	0x6a, 0xc5, 0x18, 0x30, 0x2e, 0xc0, 0x31, 0xc0, 0x2e, 0x3f, 0x99, 0xae, 0xfe, 0x41, 0x83, 0x08,
+	0x00, 0xc0, 0x05, 0xc0, 0x00, 0xe9, 0x17, 0x13, 0x27, 0x33, 0x35, 0xc0, 0x2e, 0x33, 0x22, 0x02,
+	0x14, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42,
+	0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd7, 0x08, 0xfe, 0x39, 0xa3, 0xfe, 0xa4, 0x89, 0x2d,
+	0x2e, 0xc0, 0x31, 0xc0, 0x2e, 0x33, 0x43, 0xfe, 0x7b, 0x06, 0xfe, 0x18, 0x60, 0x03, 0x00, 0xc0,
+	0x05, 0x00, 0xe9, 0x17, 0x13, 0x27, 0x33, 0x35, 0xc0, 0x2e, 0x33, 0x22, 0x02, 0x14, 0x00, 0xc0,
+	0x10, 0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xd7, 0x05, 0xa5, 0x74, 0xfe, 0x7b, 0x67, 0xfe, 0xc5, 0x2a, 0x2e, 0xc0,
+	0x7a, 0x59, 0x2e, 0xc0, 0x5f, 0x98, 0xbf, 0x29, 0x08, 0xc0, 0x00, 0xeb, 0x17, 0x13, 0xfe, 0xc5,
+	0x4b, 0x33, 0x35, 0xc0, 0x2e, 0x33, 0x22, 0x02, 0x14, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca, 0x3a,
+	0x33, 0xc0, 0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd7,
+	0x6f, 0x7d, 0x3b, 0xfe, 0xac, 0x6a, 0xa8, 0x51, 0x2e, 0x69, 0xc0, 0x2e, 0x35, 0x32, 0x5b, 0xfe,
+	0x8b, 0x68, 0xfe, 0x20, 0xc1, 0x03, 0x00, 0xeb, 0x17, 0x13, 0xfe, 0xc5, 0x4b, 0x33, 0x35, 0xc0,
+	0x2e, 0x33, 0x22, 0x02, 0x14, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1,
+	0x99, 0x9e, 0xfe, 0x39, 0x42, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd7, 0x0c, 0x05, 0xa6,
+	0x63, 0xfe, 0x83, 0x67, 0xfe, 0xcd, 0x2b, 0x33, 0x65, 0x33, 0x2e, 0x35, 0x37, 0x6b, 0x9a, 0xbd,
+	0xfe, 0x52, 0x03, 0x0b, 0x0a, 0x5a, 0x00, 0xe9, 0x17, 0x13, 0xfe, 0xc5, 0x4b, 0x33, 0x35, 0xc0,
+	0x2e, 0x33, 0x22, 0x02, 0x14, 0x00, 0xc0, 0xa2, 0x86, 0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0, 0x2e,
+	0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd7, 0x0c, 0xc0, 0x10,
+	0xfe, 0x52, 0x04, 0x06, 0x37, 0x33, 0xc0, 0x2e, 0xc0, 0x37, 0x66, 0x6b, 0xfe, 0x8b, 0xa8, 0xfe,
+	0x20, 0xa0, 0x9b, 0xad, 0x07, 0xc0, 0x00, 0xe8, 0x17, 0x13, 0x27, 0x33, 0x35, 0xc0, 0x2e, 0x33,
+	0x22, 0x02, 0x14, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x99, 0x9e,
+	0xfe, 0x39, 0x42, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd7, 0x05, 0x07, 0x03, 0xa6, 0x63,
+	0xfe, 0x83, 0x87, 0x1b, 0x33, 0xc0, 0x62, 0x35, 0xc0, 0x59, 0x6b, 0x9d, 0x9b, 0xfe, 0x62, 0x64,
+	0xfe, 0x10, 0x60, 0x07, 0xc0, 0x00, 0xe8, 0x17, 0x13, 0x27, 0x33, 0x35, 0xc0, 0x2e, 0x33, 0x22,
+	0x02, 0x14, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x99, 0x9e, 0xfe,
+	0x39, 0x42, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd8, 0x07, 0xc0, 0x10, 0x0a, 0x32, 0x30,
+	0x75, 0x2e, 0x35, 0xc0, 0x3a, 0x35, 0x3e, 0x97, 0xbf, 0xfe, 0x41, 0xa3, 0x08, 0x07, 0xc0, 0x00,
+	0xe7, 0x17, 0x13, 0xfe, 0xc5, 0x4b, 0x33, 0x35, 0xc0, 0x69, 0x33, 0x22, 0x02, 0x14, 0x00, 0xc0,
+	0x10, 0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xd9, 0x07, 0x00, 0x25, 0x1c, 0x2a, 0x2b, 0xa0, 0xa8, 0x29, 0xc0, 0x7f,
+	0x56, 0x5e, 0x5f, 0xfe, 0x7b, 0x67, 0xfe, 0x20, 0xa0, 0x00, 0x07, 0xc0, 0x00, 0xe6, 0x17, 0x13,
+	0x27, 0x33, 0x35, 0xc0, 0x2e, 0x33, 0x22, 0x02, 0x14, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca, 0x3a,
+	0x33, 0xc0, 0x2e, 0xc1, 0x99, 0x9e, 0xfe, 0x39, 0x42, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xd9, 0x07, 0x00, 0x08, 0xfe, 0x49, 0xc3, 0xfe, 0xac, 0x6a, 0xa8, 0x51, 0x33, 0x7a, 0x29, 0xc0,
+	0xa2, 0x77, 0x2b, 0xa2, 0x67, 0x06, 0xfe, 0x52, 0x24, 0x0b, 0x03, 0x07, 0xc0, 0x00, 0xe5, 0x17,
+	0x13, 0x27, 0x33, 0x35, 0xc0, 0x2e, 0x33, 0x22, 0x02, 0x14, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca,
+	0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x99, 0x9e, 0xfe, 0x39, 0x42, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xdc, 0xa4, 0x75, 0xfe, 0x6a, 0xc6, 0x1d, 0x33, 0x69, 0x66, 0xc0, 0x36, 0x33, 0x5a, 0x5b,
+	0xfe, 0x9c, 0x29, 0xfe, 0x39, 0x61, 0x0b, 0x07, 0xc0, 0x00, 0xe5, 0x17, 0xfe, 0x73, 0x07, 0xfe,
+	0xc5, 0x4b, 0x33, 0x35, 0xc0, 0x2e, 0x33, 0x22, 0x02, 0x14, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca,
+	0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xda, 0x07, 0xc0, 0x7a, 0x15, 0xfe, 0xa4, 0x4a, 0x3c, 0x9e, 0xa7, 0xa2, 0x87, 0x52, 0x66, 0x35,
+	0xc0, 0x33, 0x1b, 0xfe, 0x83, 0x66, 0x25, 0x08, 0x0c, 0x00, 0xe5, 0x17, 0x13, 0xfe, 0xc5, 0x4b,
+	0x33, 0x35, 0xc0, 0x2e, 0x33, 0x9d, 0x8c, 0x02, 0x14, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca, 0x3a,
+	0x33, 0xc0, 0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00, 0xeb, 0xa3, 0x75, 0x17, 0x00, 0xc0, 0x07,
+	0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xe7, 0x07, 0xc0, 0x10, 0xfe, 0x62, 0x65, 0xfe, 0xbd, 0x0b,
+	0x30, 0x79, 0x7a, 0x2e, 0x9f, 0x9b, 0xc0, 0x35, 0x2b, 0x0e, 0x1f, 0xfe, 0x18, 0x80, 0x00, 0x0c,
+	0x00, 0xe4, 0x17, 0x13, 0x27, 0x33, 0x35, 0xc0, 0x2e, 0x33, 0x22, 0x02, 0x14, 0x00, 0xc0, 0x10,
+	0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00, 0xe9, 0x03, 0xa7,
+	0x53, 0xfe, 0x7b, 0x4a, 0x55, 0x12, 0x0b, 0x08, 0x6b, 0x07, 0x69, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xe5, 0x07, 0xc0, 0x00, 0xa6, 0x73, 0xfe, 0x8b, 0x88, 0xfe, 0xd5, 0x8d, 0x30, 0x65, 0x7a, 0x9f,
+	0x9c, 0xc0, 0x69, 0x6e, 0x5a, 0x98, 0xbf, 0xfe, 0x49, 0xe3, 0x0b, 0x03, 0x00, 0xe4, 0x17, 0x13,
+	0xfe, 0xc5, 0x4b, 0x33, 0x35, 0xc0, 0x2e, 0x33, 0x22, 0x02, 0x14, 0x00, 0xc0, 0x10, 0xfe, 0x9b,
+	0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x99, 0x9e, 0xfe, 0x39, 0x42, 0x00, 0xe7, 0x07, 0x0a, 0xa3,
+	0x75, 0xfe, 0x6a, 0xa7, 0xfe, 0xbd, 0x2d, 0x6d, 0x09, 0xfe, 0x49, 0xc2, 0x0b, 0x0a, 0x5b, 0x07,
+	0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xe4, 0x07, 0xc1, 0x03, 0x15, 0xfe, 0x9c, 0x09, 0x3e, 0x68,
+	0x2c, 0x9e, 0xac, 0xc1, 0x35, 0x3a, 0x46, 0xfe, 0x9c, 0x29, 0xfe, 0x41, 0xa3, 0x0b, 0x00, 0xe4,
+	0x17, 0x13, 0x27, 0x33, 0x35, 0xc0, 0x69, 0x33, 0x22, 0x02, 0x14, 0x00, 0xc0, 0x10, 0xfe, 0x9b,
+	0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00, 0xe7, 0x0a, 0xa2, 0x86, 0xfe,
+	0x62, 0x45, 0xfe, 0xac, 0x8a, 0x23, 0xa3, 0x64, 0x53, 0x97, 0xcf, 0xfe, 0x5a, 0x04, 0xfe, 0x20,
+	0x81, 0x07, 0xc0, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xe6, 0x07, 0xc0, 0x0b, 0xfe, 0x52, 0x24,
+	0xfe, 0xbd, 0x2c, 0xa3, 0x84, 0x2c, 0x66, 0x6b, 0xc0, 0x31, 0x33, 0x3c, 0x53, 0xfe, 0x8b, 0x89,
+	0xfe, 0x39, 0x22, 0x08, 0x00, 0xe3, 0x17, 0x13, 0xfe, 0xc5, 0x4b, 0x33, 0x35, 0xc0, 0x2e, 0x33,
+	0x22, 0x02, 0x14, 0x00, 0xc0, 0xa2, 0x86, 0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x32,
+	0xfe, 0x39, 0x42, 0x00, 0xe5, 0x07, 0x00, 0x0b, 0xfe, 0x49, 0xc4, 0xfe, 0xac, 0x4a, 0x2a, 0xa3,
+	0x73, 0x65, 0x67, 0xa1, 0x7a, 0x9a, 0x9e, 0xfe, 0x62, 0x86, 0x10, 0x00, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xe7, 0x07, 0xc0, 0x03, 0xa4, 0x64, 0xfe, 0x7b, 0x27, 0x36, 0x37, 0x68, 0x2c, 0x27, 0x2e,
+	0x33, 0x6e, 0x37, 0x9d, 0x9c, 0x1b, 0xfe, 0x28, 0xe1, 0x00, 0xe3, 0x17, 0x13, 0xfe, 0xc5, 0x4b,
+	0x33, 0x35, 0xc0, 0x2e, 0x33, 0x22, 0x02, 0xfe, 0x08, 0x41, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca,
+	0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x99, 0x9e, 0xfe, 0x39, 0x42, 0x00, 0xe6, 0x03, 0xfe, 0x39, 0x62,
+	0x18, 0xfe, 0xcd, 0x6b, 0x38, 0x2c, 0x76, 0x56, 0x35, 0x05, 0x9c, 0x9b, 0xfe, 0x6b, 0x06, 0xfe,
+	0x29, 0x01, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xe7, 0x07, 0xc0, 0x08, 0x3e, 0xfe, 0x93, 0xe9,
+	0xfe, 0xcd, 0x8c, 0x38, 0x9e, 0x97, 0x7b, 0x2e, 0x30, 0x2e, 0x3a, 0x37, 0x99, 0xbd, 0xfe, 0x72,
+	0xc5, 0xfe, 0x20, 0x80, 0x03, 0x00, 0xe1, 0x17, 0x13, 0x27, 0x33, 0x35, 0xc0, 0x2e, 0x33, 0x9d,
+	0x8c, 0x02, 0x14, 0x00, 0xc0, 0xa2, 0x86, 0xfe, 0x9b, 0xca, 0xfe, 0xdd, 0x8b, 0x33, 0xc0, 0x2e,
+	0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00, 0xe5, 0x0b, 0xa8, 0x41, 0xfe, 0x8b, 0xa7, 0xfe, 0xc5, 0x6a,
+	0xa0, 0xa8, 0x33, 0x62, 0x7f, 0x6e, 0x50, 0x24, 0xa4, 0x48, 0xfe, 0xac, 0xcc, 0xfe, 0x4a, 0x05,
+	0x03, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xe7, 0x07, 0x00, 0x03, 0xfe, 0x49, 0xa2, 0x34, 0x37,
+	0xa0, 0x85, 0x7a, 0x9e, 0xbc, 0xa0, 0x8a, 0x30, 0x2e, 0x24, 0x6f, 0x9a, 0xbf, 0xfe, 0x6a, 0xa6,
+	0xfe, 0x28, 0xc1, 0x08, 0x00, 0xe0, 0x17, 0x13, 0x27, 0x33, 0x67, 0xc0, 0x2e, 0x33, 0x9d, 0x8c,
+	0x02, 0xfe, 0x08, 0x41, 0x00, 0xc0, 0xa2, 0x86, 0xfe, 0x9b, 0xca, 0xfe, 0xdd, 0x8b, 0x33, 0xc0,
+	0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00, 0xe4, 0x10, 0x1a, 0xfe, 0x83, 0xa8, 0x27, 0xa3, 0x74,
+	0x75, 0x38, 0x67, 0x56, 0x29, 0x2c, 0x5e, 0x9f, 0x8b, 0xfe, 0x83, 0x87, 0x3e, 0x00, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xeb, 0xa3, 0x85, 0xfe, 0x5a, 0x46, 0xfe, 0xb4, 0xac, 0xa8, 0x40, 0x24, 0x7a,
+	0xc0, 0x6b, 0xc1, 0x6f, 0x01, 0x9a, 0xad, 0xfe, 0x6a, 0xa5, 0xfe, 0x20, 0xa1, 0x08, 0x0c, 0x00,
+	0xde, 0x17, 0x13, 0xfe, 0xc5, 0x4b, 0xa2, 0x95, 0x67, 0xc0, 0x2e, 0x33, 0x22, 0x02, 0x14, 0x00,
+	0xc0, 0xa2, 0x86, 0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x99, 0x9e, 0xfe, 0x39, 0x42,
+	0x00, 0xdf, 0x6e, 0xc0, 0x0c, 0x7a, 0x08, 0x15, 0xfe, 0x8b, 0xa7, 0x27, 0x37, 0x76, 0xc1, 0x2e,
+	0x69, 0xc0, 0x33, 0xa0, 0x7b, 0xfe, 0x9b, 0xea, 0xfe, 0x39, 0x21, 0x08, 0x00, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xeb, 0x7a, 0x18, 0xfe, 0x6a, 0xc7, 0xfe, 0xc5, 0x4e, 0x37, 0xa0, 0x85, 0x7a, 0x27,
+	0x35, 0x66, 0x35, 0xc0, 0x5f, 0x99, 0xbe, 0xfe, 0x62, 0x85, 0xfe, 0x20, 0xc1, 0x9b, 0xac, 0x07,
+	0xc0, 0x00, 0xdc, 0x17, 0x13, 0xfe, 0xc5, 0x4b, 0x33, 0x35, 0xc0, 0x2e, 0x33, 0x9d, 0x8c, 0x02,
+	0x14, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42,
+	0x00, 0xe2, 0x10, 0xa7, 0x53, 0xfe, 0x83, 0x48, 0x22, 0xa4, 0x64, 0x33, 0x35, 0x30, 0x2e, 0x6d,
+	0x6d, 0x24, 0x36, 0x99, 0xbf, 0xfe, 0x51, 0xe4, 0x0b, 0x03, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xeb, 0x08, 0x03, 0xa5, 0x64, 0xfe, 0x83, 0x68, 0xfe, 0xc5, 0x6c, 0xa1, 0x83, 0xa1, 0x96, 0x9f,
+	0x9b, 0x2e, 0x77, 0xc0, 0x29, 0x35, 0x3e, 0x9a, 0xad, 0xfe, 0x62, 0xc6, 0x31, 0x08, 0x57, 0xc0,
+	0x00, 0xdb, 0x17, 0x13, 0x27, 0xa2, 0x95, 0x35, 0xc0, 0x2e, 0x33, 0x22, 0x02, 0x14, 0x00, 0xc0,
+	0x10, 0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00, 0xe1, 0x10,
+	0x15, 0x2f, 0xfe, 0xc5, 0x2c, 0x37, 0x2e, 0x66, 0x30, 0xc0, 0x2e, 0x25, 0x5a, 0xa2, 0x69, 0xfe,
+	0xb4, 0xab, 0xfe, 0x5a, 0x46, 0xfe, 0x18, 0x40, 0x03, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xee,
+	0x03, 0xa9, 0x41, 0x2d, 0xfe, 0xc5, 0x4a, 0xa3, 0x74, 0x75, 0x9f, 0x9b, 0x76, 0xc1, 0x6e, 0x33,
+	0x37, 0x9a, 0xae, 0x3f, 0xfe, 0x29, 0x02, 0x99, 0xbd, 0x0a, 0x00, 0x6e, 0xc0, 0x00, 0xd8, 0x17,
+	0xfe, 0x73, 0x07, 0x27, 0x33, 0x35, 0xc0, 0x2e, 0x33, 0x9d, 0x8c, 0x02, 0x14, 0x00, 0xc0, 0x10,
+	0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00, 0xdf, 0x0a, 0x10,
+	0xaa, 0x40, 0xfe, 0x8b, 0xa7, 0xac, 0x30, 0x3a, 0x2e, 0x31, 0x38, 0x66, 0x31, 0x59, 0x6e, 0x5a,
+	0x9b, 0x9e, 0x2b, 0xfe, 0x18, 0xa1, 0x00, 0x07, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xee, 0x05,
+	0x10, 0xa8, 0x41, 0xfe, 0x8b, 0xc8, 0xfe, 0xcd, 0x8c, 0xa0, 0x85, 0x2c, 0x7a, 0x62, 0x6b, 0xc0,
+	0x27, 0x5f, 0x37, 0x0d, 0x1b, 0x15, 0x98, 0xce, 0x03, 0x00, 0xda, 0x17, 0xfe, 0x73, 0x07, 0xfe,
+	0xc5, 0x4b, 0xa2, 0x95, 0x67, 0xc0, 0x2e, 0x33, 0x22, 0x02, 0x14, 0x00, 0xc0, 0x10, 0xfe, 0x9b,
+	0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00, 0xde, 0x08, 0xa3, 0x76, 0x02,
+	0x04, 0x20, 0xa3, 0x74, 0x76, 0x67, 0x76, 0x6b, 0x31, 0x5d, 0x56, 0x9f, 0x8b, 0x42, 0xfe, 0x62,
+	0xa5, 0xfe, 0x20, 0xc1, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf1, 0x05, 0x00, 0xa2, 0x76, 0xab,
+	0x40, 0xfe, 0x94, 0x0a, 0x27, 0xa3, 0x74, 0x60, 0xa0, 0xa9, 0x6b, 0xc1, 0x2c, 0x5b, 0x37, 0x9c,
+	0xac, 0xfe, 0x8b, 0x68, 0xfe, 0x41, 0x83, 0x18, 0x08, 0x00, 0xd9, 0x17, 0x13, 0x27, 0xa2, 0x95,
+	0x67, 0xc0, 0x69, 0x33, 0x22, 0x02, 0x14, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0,
+	0x2e, 0xc1, 0x99, 0x9e, 0xfe, 0x39, 0x42, 0x00, 0xdc, 0x03, 0x08, 0xa5, 0x64, 0xfe, 0x5a, 0x44,
+	0xfe, 0xa4, 0x4a, 0xa8, 0x51, 0x30, 0x78, 0x66, 0x2e, 0xc1, 0x6d, 0x59, 0xa1, 0x7a, 0x9a, 0xbf,
+	0xfe, 0x7b, 0x28, 0x31, 0x08, 0x05, 0xc1, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xee, 0x05, 0xc0,
+	0x00, 0x10, 0xaa, 0x31, 0xfe, 0x93, 0xe9, 0xfe, 0xc5, 0x6b, 0x30, 0x79, 0x2e, 0xc1, 0x69, 0x2c,
+	0x30, 0x3a, 0x43, 0x96, 0xcf, 0xfe, 0x52, 0x24, 0xfe, 0x20, 0xc1, 0x08, 0x00, 0xd8, 0xa2, 0x87,
+	0x13, 0xfe, 0xc5, 0x4b, 0x33, 0x35, 0xc0, 0x2e, 0x33, 0x9d, 0x8c, 0x02, 0x14, 0x00, 0xc0, 0xa2,
+	0x86, 0xfe, 0x9b, 0xca, 0x3a, 0x33, 0xc0, 0x2e, 0xc1, 0x32, 0xfe, 0x39, 0x42, 0x00, 0xda, 0x03,
+	0x08, 0xa2, 0x86, 0xa5, 0x64, 0xfe, 0x72, 0xe5, 0xfe, 0xb4, 0xa9, 0x37, 0x30, 0x75, 0xc0, 0x2e,
+	0xc2, 0x24, 0x5f, 0x9d, 0x9d, 0x13, 0xfe, 0x28, 0xe2, 0x03, 0x05, 0xc1, 0x66, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xef, 0x05, 0xc0, 0x00, 0xc0, 0x08, 0x29, 0xfe, 0x8b, 0xa8, 0xfe, 0xc5, 0x4b, 0xa3,
+	0x74, 0x33, 0xc0, 0x2e, 0xc0, 0x69, 0xc1, 0xa1, 0x79, 0x43, 0x9a, 0xad, 0xfe, 0x6a, 0xe7, 0xfe,
+	0x20, 0xe2, 0x03, 0x5a, 0xd7, 0x17, 0x13, 0xfe, 0xc5, 0x4b, 0x33, 0x67, 0xc0, 0x2e, 0x33, 0x22,
+	0x02, 0x14, 0x00, 0xc0, 0x10, 0xfe, 0x9b, 0xca, 0x3a, 0x2c, 0x33, 0x2e, 0xc0, 0x5a, 0x32, 0xfe,
+	0x39, 0x43, 0x00, 0xda, 0x08, 0xa3, 0x75, 0xaa, 0x42, 0xfe, 0x8b, 0x87, 0x1a, 0xa4, 0x73, 0x24,
+	0x7a, 0x9f, 0xab, 0xc0, 0x5a, 0x2e, 0x2c, 0x5b, 0x37, 0x9a, 0xae, 0xfe, 0x72, 0xe6, 0xfe, 0x28,
+	0xe2, 0x08, 0x56, 0xc0, 0x05, 0xc0, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf4, 0x10, 0xa9, 0x41,
+	0x3c, 0xfe, 0xc5, 0x4a, 0xa3, 0x75, 0x69, 0x73, 0x6b, 0xc0, 0x2e, 0x27, 0xc0, 0x2b, 0xa1, 0x7a,
+	0xfe, 0x9c, 0x2c, 0xfe, 0x39, 0x64, 0x08, 0x00, 0xd7, 0x17, 0x13, 0xfe, 0xc5, 0x4b, 0xa2, 0x95,
+	0x35, 0xc0, 0x2e, 0x33, 0x22, 0x02, 0x14, 0x00, 0xc0, 0x10, 0x15, 0x3a, 0x2c, 0x33, 0x2e, 0xc0,
+	0x2b, 0x99, 0xae, 0xfe, 0x31, 0x43, 0x00, 0xd9, 0x08, 0xa6, 0x63, 0xa9, 0x42, 0xfe, 0x9c, 0x0a,
+	0x31, 0x37, 0x2c, 0xc0, 0x77, 0x67, 0x6b, 0x59, 0xa2, 0x65, 0x5d, 0x2d, 0x9b, 0xae, 0x13, 0x39,
+	0x08, 0x00, 0xc2, 0x6e, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf1, 0x05, 0x00, 0xc0, 0x03, 0x7e,
+	0x1a, 0xfe, 0x83, 0x87, 0xfe, 0xbd, 0x4b, 0xa3, 0x85, 0x65, 0x35, 0xc0, 0x69, 0xc1, 0x6f, 0x9d,
+	0x8c, 0x1b, 0xfe, 0x20, 0xc1, 0x00, 0xd8, 0x17, 0x13, 0x27, 0x33, 0x35, 0xc0, 0x2e, 0x33, 0x22,
+	0x02, 0x14, 0x00, 0xc0, 0x10, 0x15, 0x3a, 0x33, 0xc0, 0x2e, 0xc0, 0x5d, 0x98, 0xbf, 0xfe, 0x31,
+	0x42, 0x00, 0xd7, 0x03, 0x18, 0xa8, 0x43, 0xfe, 0x83, 0x48, 0xaa, 0x41, 0xa7, 0x52, 0x37, 0x33,
+	0x2c, 0x77, 0xc0, 0x67, 0xc0, 0x35, 0x30, 0x34, 0x9a, 0xad, 0x3f, 0xfe, 0x28, 0xe1, 0x0b, 0x00,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0x10, 0xaa, 0x31, 0xfe, 0x7b, 0x68, 0xfe, 0xbd, 0x2b, 0x34,
+	0x30, 0x2e, 0xc0, 0x31, 0x2e, 0x3e, 0x97, 0xbf, 0xfe, 0x49, 0xc3, 0xfe, 0x08, 0x40, 0x00, 0xd8,
+	0x17, 0x13, 0x27, 0xa2, 0x95, 0x35, 0xc0, 0x2e, 0x33, 0x22, 0x02, 0x14, 0x00, 0xc0, 0x10, 0x15,
+	0x3a, 0x33, 0xc0, 0x2e, 0xc0, 0x29, 0x2b, 0x12, 0x00, 0xd5, 0x05, 0x0d, 0x39, 0xab, 0x30, 0xac,
+	0x31, 0xaa, 0x51, 0xa3, 0x75, 0x35, 0x2e, 0x33, 0x7a, 0x66, 0xc0, 0x38, 0x35, 0xc0, 0x4a, 0x99,
+	0xbe, 0xfe, 0x62, 0xa5, 0xfe, 0x28, 0xe1, 0x08, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xc0,
+	0xa2, 0x87, 0x12, 0xfe, 0x73, 0x27, 0xfe, 0xb4, 0xcb, 0x3e, 0x35, 0x65, 0x2e, 0x3a, 0x9d, 0x8c,
+	0xfe, 0x73, 0x06, 0xfe, 0x20, 0xe1, 0x00, 0xd9, 0x17, 0x13, 0xfe, 0xc5, 0x4b, 0x33, 0x35, 0xc0,
+	0x2e, 0x33, 0x22, 0x02, 0x14, 0x00, 0xc0, 0x10, 0x15, 0x3a, 0x68, 0x33, 0x2e, 0xc0, 0x59, 0x32,
+	0xfe, 0x31, 0x22, 0x00, 0xd2, 0x7f, 0x65, 0x08, 0xa4, 0x64, 0x3d, 0xab, 0x40, 0xac, 0x20, 0xa6,
+	0x63, 0x3a, 0x2e, 0xc2, 0x79, 0x31, 0x2e, 0x35, 0x3c, 0x47, 0x97, 0xce, 0xfe, 0x5a, 0x45, 0xfe,
+	0x20, 0xa1, 0x9c, 0x9b, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xc2, 0x08, 0xa7, 0x52, 0xad,
+	0x30, 0xfe, 0xac, 0x8a, 0xa7, 0x63, 0x68, 0x6e, 0xa0, 0x8a, 0xfe, 0xa4, 0x4a, 0xfe, 0x41, 0xc3,
+	0xfe, 0x08, 0x40, 0x00, 0xd9, 0x17, 0x13, 0xfe, 0xc5, 0x4b, 0xa2, 0x95, 0x35, 0xc0, 0x2e, 0x33,
+	0x9d, 0x8c, 0x02, 0x14, 0x00, 0xc0, 0x10, 0x15, 0xfe, 0xdd, 0x8b, 0x68, 0x33, 0x2e, 0xc0, 0x2b,
+	0x32, 0xfe, 0x31, 0x23, 0x00, 0xce, 0x6b, 0xc2, 0x08, 0xa2, 0x86, 0x21, 0xab, 0x40, 0xac, 0x30,
+	0xa6, 0x64, 0xa3, 0x64, 0x33, 0x2c, 0x33, 0xc0, 0x2e, 0x69, 0xc1, 0x30, 0x3e, 0x43, 0xfe, 0x9b,
+	0xea, 0xfe, 0x51, 0xe4, 0xfe, 0x20, 0x81, 0x03, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xc4,
+	0x08, 0xa4, 0x75, 0xfe, 0x5a, 0x24, 0xfe, 0x93, 0xe9, 0xfe, 0xc5, 0x4b, 0xa3, 0x76, 0x9c, 0x9c,
+	0xfe, 0x6a, 0xe6, 0xfe, 0x18, 0xa1, 0x00, 0xda, 0x17, 0x13, 0x27, 0x33, 0x67, 0xc0, 0x2e, 0x33,
+	0x22, 0xfe, 0x49, 0xe4, 0xfe, 0x08, 0x41, 0x00, 0xc0, 0xa2, 0x86, 0x15, 0x3a, 0x68, 0x33, 0x2e,
+	0xc0, 0x2b, 0x99, 0xae, 0xfe, 0x31, 0x23, 0x00, 0xcd, 0x07, 0xc1, 0x0f, 0x18, 0xa9, 0x42, 0x3f,
+	0xab, 0x30, 0xa7, 0x73, 0x3a, 0x2e, 0x69, 0x33, 0x2c, 0x5a, 0x24, 0x27, 0xc0, 0x2c, 0x30, 0x3b,
+	0x9b, 0xad, 0xfe, 0x83, 0x68, 0xfe, 0x41, 0x83, 0xfe, 0x18, 0x41, 0x41, 0x00, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xc6, 0x03, 0xa4, 0x64, 0xa9, 0x42, 0xfe, 0x83, 0xa8, 0xa9, 0x42, 0x99, 0xbd,
+	0xfe, 0x39, 0x83, 0x08, 0x00, 0xda, 0x17, 0x13, 0xfe, 0xc5, 0x4b, 0x33, 0x35, 0xc0, 0x69, 0x33,
+	0x22, 0x02, 0xfe, 0x08, 0x41, 0x00, 0xc0, 0x10, 0x15, 0x3a, 0x33, 0xc0, 0x2e, 0xc0, 0x24, 0x32,
+	0xfe, 0x31, 0x22, 0x00, 0xce, 0x08, 0xa4, 0x65, 0xa8, 0x42, 0xa8, 0x52, 0xfe, 0x9c, 0x49, 0xa7,
+	0x63, 0xa2, 0x86, 0x75, 0x6d, 0xc1, 0x2e, 0xc1, 0x27, 0x2c, 0x33, 0x32, 0x56, 0x9b, 0x9d, 0x04,
+	0x0d, 0x10, 0x07, 0xc0, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xc6, 0x07, 0xc0, 0x10, 0xa6,
+	0x54, 0xa7, 0x43, 0x9d, 0x9a, 0x98, 0xcd, 0x00, 0xdb, 0x17, 0xfe, 0x73, 0x08, 0xfe, 0xc5, 0x4b,
+	0x33, 0x2e, 0x35, 0x2e, 0x33, 0x9c, 0x9d, 0x02, 0x14, 0x00, 0x6e, 0x10, 0x15, 0x3a, 0x2c, 0x33,
+	0x2e, 0xc0, 0x2c, 0x98, 0xaf, 0xfe, 0x31, 0x42, 0x00, 0xc5, 0x05, 0xc2, 0x00, 0xc0, 0x03, 0x10,
+	0xa7, 0x42, 0xa9, 0x41, 0xaa, 0x41, 0xa8, 0x42, 0xa4, 0x75, 0xa4, 0x75, 0x7e, 0x33, 0x24, 0x7a,
+	0x2e, 0xc0, 0x67, 0xc1, 0x2e, 0xa2, 0x67, 0xa1, 0x79, 0x9a, 0xbd, 0xfe, 0x8b, 0x88, 0xfe, 0x51,
+	0xe4, 0x97, 0xbe, 0x08, 0x00, 0x6f, 0xc0, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xc6, 0x07,
+	0xc1, 0x0c, 0x7d, 0xc0, 0x56, 0x00, 0xdb, 0x17, 0x1a, 0xfe, 0xc5, 0x4b, 0x33, 0x2e, 0x35, 0x2e,
+	0x33, 0x22, 0xfe, 0x51, 0xe4, 0x14, 0x00, 0x6e, 0x10, 0x15, 0x3a, 0x2c, 0xc0, 0x2e, 0xc0, 0x33,
+	0x98, 0x9f, 0xfe, 0x31, 0x42, 0x00, 0xc1, 0x07, 0xc2, 0x0c, 0x05, 0x00, 0x08, 0x10, 0xa4, 0x64,
+	0xa7, 0x54, 0xa7, 0x53, 0xaa, 0x30, 0xa8, 0x51, 0xa4, 0x75, 0xa2, 0x76, 0x2c, 0x66, 0xc0, 0x2c,
+	0x5b, 0xc1, 0x7b, 0x65, 0x66, 0x35, 0x6f, 0x56, 0x99, 0xbe, 0xfe, 0x7b, 0x08, 0xfe, 0x39, 0x43,
+	0x10, 0x00, 0xc1, 0x05, 0xc0, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xc7, 0x07, 0xc1, 0x00,
+	0xde, 0x17, 0x13, 0xfe, 0xc5, 0x4a, 0x33, 0x35, 0xc0, 0x2e, 0x33, 0x9c, 0x9d, 0xfe, 0x51, 0xe4,
+	0x14, 0x00, 0x6e, 0x10, 0x15, 0x3a, 0x33, 0xc0, 0x35, 0x66, 0x3a, 0xfe, 0xa4, 0x6a, 0x12, 0xfe,
+	0x08, 0x00, 0x00, 0xc0, 0x07, 0x7a, 0xc0, 0x0f, 0x79, 0x10, 0xa4, 0x75, 0xa6, 0x54, 0x2b, 0xa7,
+	0x52, 0xa8, 0x42, 0xa5, 0x65, 0x32, 0x69, 0x27, 0x7e, 0x66, 0x6b, 0x2e, 0xc0, 0x5e, 0xc1, 0x2b,
+	0x66, 0x32, 0x3e, 0x24, 0x97, 0xbe, 0xfe, 0x5a, 0x25, 0x96, 0xce, 0x0b, 0x0a, 0x07, 0xc0, 0x00,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xcb, 0x07, 0xc0, 0x00, 0xde, 0x17, 0xfe, 0x73, 0x07, 0x20,
+	0x33, 0x35, 0xc0, 0x2e, 0x33, 0x1d, 0xfe, 0x51, 0xe4, 0x14, 0x00, 0x6e, 0xa1, 0x97, 0x15, 0x35,
+	0x2e, 0x33, 0x35, 0x66, 0x35, 0x97, 0xaf, 0xfe, 0x39, 0x22, 0x03, 0xc0, 0x08, 0x0b, 0x7e, 0xa3,
+	0x76, 0xa3, 0x66, 0xa7, 0x63, 0xa8, 0x43, 0xa7, 0x43, 0xa6, 0x53, 0x1d, 0xa3, 0x65, 0x7d, 0x69,
+	0x2e, 0xc6, 0x33, 0x2b, 0xc0, 0x6f, 0x6f, 0x9d, 0x9a, 0x25, 0xfe, 0x62, 0x84, 0xfe, 0x31, 0x22,
+	0x18, 0x9d, 0x9b, 0x00, 0x07, 0xc1, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xcc, 0x07, 0xc0,
+	0x00, 0xdd, 0x17, 0xfe, 0x73, 0x07, 0x20, 0x33, 0x35, 0xc0, 0x2e, 0x3a, 0x1d, 0xfe, 0x51, 0xe4,
+	0x14, 0x00, 0x6e, 0xa1, 0x97, 0x15, 0xfe, 0xe5, 0x6b, 0x2e, 0xc1, 0x66, 0x2e, 0x98, 0xae, 0xfe,
+	0x51, 0xc2, 0x98, 0xbe, 0xa3, 0x66, 0xa4, 0x65, 0xa4, 0x76, 0xa5, 0x64, 0xa5, 0x65, 0xa5, 0x65,
+	0xa5, 0x64, 0xa3, 0x76, 0xa2, 0x76, 0x6e, 0x2e, 0x33, 0xc0, 0x65, 0x2e, 0x3a, 0xc2, 0x2e, 0x27,
+	0x2c, 0x27, 0x5b, 0x37, 0x5b, 0x9b, 0xad, 0xfe, 0x7b, 0x47, 0xfe, 0x41, 0xc3, 0x97, 0xce, 0x9c,
+	0xac, 0x00, 0xc0, 0x05, 0xc0, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xef, 0x17, 0x13, 0xfe,
+	0xc5, 0x4b, 0xa2, 0x95, 0x2e, 0x35, 0xc0, 0x3a, 0x1d, 0xfe, 0x51, 0xe4, 0xfe, 0x08, 0x40, 0x56,
+	0xc0, 0x10, 0x15, 0x38, 0x2e, 0xc1, 0x69, 0xc0, 0x46, 0xfe, 0x9c, 0x07, 0x57, 0xa4, 0x66, 0xa3,
+	0x75, 0x1d, 0x7d, 0x7e, 0x2b, 0xc0, 0x2e, 0xc0, 0x65, 0x27, 0x2e, 0xc3, 0x35, 0xc0, 0x2e, 0x33,
+	0x2c, 0xc0, 0x2e, 0x01, 0x1d, 0xfe, 0x8b, 0xa8, 0xfe, 0x52, 0x04, 0x96, 0xcf, 0x0d, 0x07, 0x00,
+	0xc1, 0x05, 0xc0, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xef, 0xa3, 0x76, 0x1a, 0xfe, 0xc5,
+	0x2b, 0x33, 0x2e, 0xc0, 0x35, 0x6b, 0x9d, 0x8b, 0xfe, 0x51, 0xe4, 0x0d, 0x56, 0xc0, 0x10, 0x15,
+	0x38, 0x35, 0x2e, 0x33, 0x27, 0x2c, 0xc0, 0x43, 0x6b, 0x32, 0x30, 0x33, 0x2e, 0xc0, 0x33, 0xc0,
+	0x76, 0x2e, 0xc0, 0x27, 0x2e, 0xc1, 0x27, 0x2e, 0xc2, 0x3a, 0xc0, 0x2d, 0x24, 0x95, 0xdf, 0x95,
+	0xcf, 0xfe, 0x28, 0xe1, 0x10, 0x03, 0x07, 0xc0, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf4,
+	0x1c, 0x1a, 0x22, 0x33, 0x27, 0x2e, 0x35, 0x3c, 0x24, 0xfe, 0x51, 0xe4, 0x0d, 0x56, 0xc0, 0x10,
+	0x15, 0xfe, 0xe5, 0x6c, 0x35, 0x2e, 0x33, 0xc0, 0x2c, 0xc0, 0x30, 0x33, 0x2b, 0x27, 0x2e, 0xc1,
+	0x35, 0xc2, 0x2e, 0xc0, 0x33, 0xc0, 0x2c, 0xc0, 0x27, 0x2e, 0x35, 0x01, 0x56, 0x9b, 0xad, 0x95,
+	0xdf, 0x0a, 0x97, 0xce, 0x0d, 0x00, 0xc1, 0x07, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf5,
+	0xa2, 0x96, 0x1a, 0xfe, 0xc5, 0x2c, 0x33, 0x27, 0xc0, 0x2e, 0x35, 0x1d, 0xfe, 0x51, 0xe4, 0x0d,
+	0x56, 0xc0, 0x10, 0xfe, 0x9b, 0xea, 0x3a, 0x2e, 0xc4, 0x35, 0x2e, 0xc5, 0x67, 0x7a, 0x38, 0x6d,
+	0x2e, 0x59, 0xc1, 0x66, 0xa2, 0x67, 0xa3, 0x78, 0x9d, 0x9b, 0x99, 0xbd, 0xfe, 0x7b, 0x27, 0x94,
+	0xef, 0x34, 0x10, 0x46, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfa, 0x13, 0xfe, 0x7b, 0x08,
+	0x29, 0xa3, 0x83, 0x68, 0x66, 0x2e, 0x35, 0x9d, 0x8b, 0xfe, 0x51, 0xe4, 0x14, 0x55, 0x0c, 0x10,
+	0xfe, 0x93, 0xe9, 0xfe, 0xdd, 0xaa, 0x2e, 0xc2, 0x35, 0xc2, 0x2e, 0xc5, 0x65, 0xc0, 0x27, 0x33,
+	0x2b, 0x6b, 0x3e, 0xa1, 0x79, 0x9a, 0xab, 0x97, 0xce, 0x96, 0xdf, 0x96, 0xde, 0x18, 0x03, 0xc0,
+	0x05, 0x00, 0xc1, 0x05, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf7, 0xa2, 0x97, 0xfe, 0x7a,
+	0xe8, 0x29, 0x33, 0x74, 0xc0, 0x6b, 0x33, 0x9c, 0x9c, 0xfe, 0x51, 0xe4, 0x14, 0x0c, 0xc0, 0xa1,
+	0x96, 0xfe, 0x94, 0x09, 0xfe, 0xdd, 0xa9, 0x27, 0x2e, 0xc3, 0x35, 0x2e, 0xc3, 0x2c, 0xc1, 0x27,
+	0x22, 0x2e, 0x3e, 0x57, 0x9d, 0x9b, 0x9b, 0xab, 0xfe, 0x73, 0x08, 0x02, 0x97, 0xce, 0x9b, 0xbc,
+	0x5a, 0x00, 0x07, 0x0c, 0x69, 0x00, 0xc1, 0x05, 0xc0, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xf6, 0x13, 0xfe, 0x7b, 0x08, 0xfe, 0xc5, 0x0d, 0x3a, 0x27, 0xc1, 0x2c, 0x16, 0xfe, 0x51, 0xe3,
+	0xfe, 0x10, 0x21, 0x07, 0xc0, 0x10, 0xfe, 0x94, 0x08, 0xfe, 0xd5, 0xa9, 0x27, 0x9f, 0x9b, 0x69,
+	0x27, 0xc0, 0x2c, 0xc0, 0x33, 0xc1, 0x5a, 0xc1, 0x37, 0x6f, 0xc0, 0x67, 0x9d, 0x9b, 0x97, 0xce,
+	0x96, 0xce, 0x96, 0xdf, 0x99, 0xbd, 0x0d, 0x00, 0xc1, 0x0c, 0x00, 0x07, 0xc0, 0x00, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0xa4, 0x75, 0xfe, 0x72, 0xe8, 0xfe, 0xbd, 0x0e, 0x05, 0x37, 0x65,
+	0xc1, 0x9d, 0x8b, 0xfe, 0x51, 0xe4, 0x12, 0x00, 0x07, 0xa3, 0x84, 0xfe, 0x94, 0x09, 0xfe, 0xd5,
+	0x8a, 0x32, 0x77, 0x69, 0x58, 0x6e, 0x6f, 0x6b, 0xc0, 0x6b, 0x6b, 0x3d, 0x55, 0x52, 0x9c, 0xab,
+	0x9a, 0xbc, 0x1a, 0x0a, 0x99, 0xbc, 0x18, 0x08, 0x56, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xc8, 0xa3, 0x75, 0xfe, 0x52, 0x46, 0xae, 0x30, 0xa6, 0x52, 0x21, 0xa2, 0x77, 0xa2, 0x77, 0x7a,
+	0x28, 0xfe, 0x52, 0x05, 0xfe, 0x10, 0x20, 0x00, 0xc0, 0x15, 0xfe, 0x83, 0xa9, 0xfe, 0xcd, 0xac,
+	0x73, 0x66, 0x5a, 0xa3, 0x66, 0x3d, 0x51, 0x52, 0x14, 0x9c, 0xab, 0x9c, 0xaa, 0x9b, 0xac, 0x9a,
+	0xbb, 0x9b, 0xab, 0x9b, 0xbc, 0x9c, 0x8b, 0x0d, 0x52, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xcd, 0xa4, 0x65, 0x39, 0xa3, 0x76, 0xa3, 0x76, 0xa6, 0x44, 0xa4, 0x66, 0xa3, 0x76, 0x56, 0xfe,
+	0x39, 0x43, 0x98, 0xbd, 0x00, 0xc0, 0xa4, 0x76, 0xfe, 0x62, 0xc7, 0xaa, 0x41, 0x66, 0x52, 0x61,
+	0x9d, 0x89, 0x52, 0x9c, 0xaa, 0x9b, 0xab, 0x9b, 0xbb, 0x51, 0x18, 0x52, 0x66, 0x5a, 0xc0, 0x00,
+	0xc3, 0x07, 0x00, 0xc0, 0x07, 0xc1, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xc5, 0x03,
+	0xc1, 0x08, 0xc0, 0x18, 0x6e, 0x08, 0x00, 0x6e, 0xc0, 0x00, 0xa3, 0x75, 0x1d, 0x18, 0x66, 0xc0,
+	0x0b, 0x08, 0x03, 0xc3, 0x00, 0x07, 0x7a, 0x5e, 0x05, 0xc0, 0x00, 0xc1, 0x07, 0xc4, 0x00, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xcd, 0x0c, 0x05, 0x0c, 0x07, 0x00, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd8, 0x05, 0xc0,
+	0x00, 0xfd, 0xc7, 0x07, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xeb, 0x0c, 0x00, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xe3, 0x05, 0x00, 0xfd, 0x03, 0xc2, 0x00, 0xfd, 0xc1, 0x03, 0x00,
+	0xfb, 0x05, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xdf, 0x05, 0xc0, 0x00, 0xd2, 0x03, 0xc0, 0x00, 0xc6,
+	0x03, 0xc0, 0x00, 0xca, 0x03, 0x08, 0x00, 0xd1, 0x03, 0x0b, 0xc0, 0x08, 0x03, 0x00, 0xca, 0x05,
+	0x00, 0xc9, 0x05, 0xc1, 0x00, 0xc8, 0x05, 0x00, 0xc0, 0x05, 0x00, 0xd3, 0x05, 0xc0, 0x08, 0xc0,
+	0x03, 0x00, 0xc7, 0x03, 0x00, 0xd1, 0x05, 0xc0, 0x00, 0xc6, 0x03, 0xc0, 0x00, 0x03, 0xc0, 0x00,
+	0xcc, 0x03, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xde, 0x05, 0xa2, 0x77, 0xa4, 0x74, 0x7a, 0x5b, 0x9c,
+	0xab, 0x00, 0xc6, 0x0f, 0xa8, 0x42, 0x64, 0x36, 0x21, 0x05, 0x00, 0x05, 0x0f, 0x29, 0x3e, 0x01,
+	0x6f, 0xc0, 0x3e, 0xc0, 0x6f, 0x0d, 0x66, 0xc0, 0x3e, 0x6b, 0x42, 0x9c, 0xab, 0x00, 0x6e, 0x14,
+	0x2c, 0x01, 0xc0, 0x0d, 0x56, 0x0a, 0x3e, 0xc0, 0x39, 0x2c, 0x18, 0x42, 0x03, 0x00, 0xcb, 0x0b,
+	0x1d, 0xa6, 0x54, 0xa4, 0x76, 0xa2, 0x78, 0x55, 0x9c, 0xa9, 0x9b, 0xac, 0x10, 0x00, 0xc1, 0x07,
+	0xc0, 0x00, 0xc1, 0xa2, 0x76, 0x29, 0x3e, 0x67, 0x1c, 0x9d, 0x9a, 0xc6, 0x0f, 0x2c, 0x05, 0xc0,
+	0x52, 0x0f, 0x00, 0xc6, 0x6e, 0x00, 0x0b, 0xa6, 0x52, 0x0a, 0x3e, 0x6b, 0xc1, 0x6d, 0x7a, 0xc0,
+	0x6e, 0x03, 0x3e, 0x57, 0x52, 0x9c, 0x9a, 0x00, 0xc2, 0x08, 0x10, 0x06, 0xa5, 0x56, 0xa3, 0x76,
+	0x66, 0x51, 0x0b, 0x1d, 0x9c, 0xac, 0x00, 0x7b, 0xa3, 0x66, 0x31, 0x06, 0xc0, 0x67, 0x5e, 0xc0,
+	0x3e, 0x6b, 0x0a, 0xc0, 0x69, 0x0a, 0x05, 0x0a, 0x6b, 0x51, 0x00, 0xc1, 0x6e, 0x00, 0xc0, 0x0d,
+	0x3d, 0x12, 0x39, 0x15, 0x52, 0x00, 0xc2, 0x05, 0x1c, 0x31, 0xa2, 0x87, 0xc0, 0x6e, 0x0a, 0x66,
+	0x08, 0xc0, 0x05, 0x0a, 0xc0, 0x3e, 0xc0, 0x08, 0x0d, 0x31, 0x00, 0x7e, 0x31, 0x39, 0x0a, 0xc2,
+	0x05, 0x6b, 0x0d, 0x06, 0x3e, 0xc0, 0x05, 0x35, 0x9c, 0xaa, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xd1,
+	0x0d, 0xac, 0x20, 0xfe, 0x94, 0x0b, 0xa7, 0x52, 0x9c, 0xab, 0x09, 0x0d, 0x00, 0xc4, 0x7a, 0xa8,
+	0x53, 0x38, 0xa5, 0x53, 0x38, 0xfe, 0x4a, 0x25, 0xfe, 0x00, 0x40, 0x66, 0x00, 0xa4, 0x85, 0xfe,
+	0x72, 0xc7, 0xfe, 0xbc, 0xcc, 0x7d, 0x6b, 0x6e, 0x69, 0x6e, 0x7b, 0x66, 0x66, 0x27, 0x1d, 0xa0,
+	0x8a, 0xfe, 0x8b, 0x89, 0xfe, 0x28, 0xe2, 0x99, 0xad, 0xc0, 0x3d, 0xfe, 0x93, 0xcb, 0x17, 0x6e,
+	0x28, 0x7b, 0x6d, 0x68, 0x1d, 0x1f, 0x9d, 0xab, 0x9c, 0xab, 0x9a, 0xab, 0xfe, 0x49, 0x83, 0x97,
+	0xce, 0x03, 0x6f, 0x5a, 0x05, 0xc1, 0x00, 0xc0, 0x0c, 0xc0, 0x08, 0x39, 0xfe, 0x6a, 0xc5, 0xac,
+	0x41, 0x18, 0xa2, 0x87, 0x7f, 0x56, 0x58, 0x9d, 0x9b, 0xfe, 0x83, 0x47, 0x06, 0x98, 0xcf, 0x00,
+	0x0c, 0x07, 0xc0, 0x00, 0xc0, 0xa6, 0x64, 0xfe, 0x6a, 0xe7, 0xfe, 0xb4, 0xcb, 0x53, 0xfe, 0x72,
+	0xe7, 0x31, 0x00, 0x05, 0x0c, 0xc0, 0x00, 0xc1, 0xa4, 0x75, 0xfe, 0x6a, 0xa6, 0xfe, 0xac, 0xab,
+	0xa3, 0x66, 0xfe, 0x7b, 0x69, 0x38, 0x00, 0xc6, 0x6e, 0x0f, 0xa5, 0x74, 0xfe, 0x8b, 0x87, 0x10,
+	0x1f, 0x6e, 0x1f, 0x2b, 0x6d, 0x22, 0x69, 0x22, 0x1d, 0xa1, 0x79, 0x47, 0xfe, 0x73, 0x29, 0xfe,
+	0x18, 0xa1, 0x00, 0xc0, 0x08, 0xa2, 0x86, 0xfe, 0x51, 0xe3, 0xfe, 0x9b, 0xe9, 0x17, 0xa3, 0x77,
+	0x30, 0xa3, 0x64, 0x65, 0x41, 0x9a, 0xbd, 0xfe, 0x73, 0x06, 0xfe, 0x39, 0x42, 0x98, 0xce, 0xaa,
+	0x31, 0xfe, 0x9c, 0x2a, 0xa7, 0x61, 0x7e, 0x25, 0x46, 0x22, 0x25, 0x6b, 0x1d, 0xc1, 0x22, 0x1d,
+	0x6b, 0x5f, 0xfe, 0x73, 0x27, 0xfe, 0x10, 0x80, 0x00, 0xc1, 0x05, 0xc0, 0xab, 0x51, 0xfe, 0xa4,
+	0x6a, 0xa7, 0x53, 0x9d, 0xaa, 0xfe, 0x7b, 0x48, 0xfe, 0x18, 0xa1, 0x00, 0x05, 0xc0, 0x00, 0x08,
+	0xac, 0x30, 0xfe, 0x9c, 0x4a, 0x22, 0x1b, 0xc0, 0x22, 0x1d, 0x7a, 0xc0, 0x1d, 0xc0, 0x24, 0x22,
+	0x59, 0x7f, 0x53, 0xfe, 0x7b, 0x68, 0x08, 0xa3, 0x75, 0xfe, 0x83, 0x89, 0x21, 0x6e, 0x69, 0xc0,
+	0x7b, 0x6b, 0xc0, 0x79, 0x25, 0x1b, 0x29, 0x43, 0xfe, 0x7b, 0x6a, 0xfe, 0x21, 0x02, 0x00, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xd1, 0x08, 0xfe, 0x49, 0xc4, 0xfe, 0xac, 0x8a, 0xa8, 0x51, 0x9c, 0xac, 0xfe,
+	0x5a, 0x04, 0xfe, 0x08, 0x40, 0x00, 0xc4, 0x03, 0xa7, 0x73, 0xfe, 0xbd, 0x0b, 0xa5, 0x62, 0x9b,
+	0xad, 0xfe, 0x5a, 0x45, 0x00, 0xc0, 0x08, 0xa3, 0x96, 0xfe, 0x8b, 0x47, 0x3c, 0xa0, 0x85, 0x67,
+	0x27, 0xc0, 0x6f, 0xc0, 0x51, 0xc0, 0x27, 0x5a, 0xa2, 0x69, 0xfe, 0x8b, 0xa7, 0xfe, 0x28, 0xe1,
+	0x99, 0xbe, 0x00, 0xa7, 0x63, 0xfe, 0xa4, 0x4b, 0xfe, 0xd5, 0x6b, 0x7d, 0x6b, 0x52, 0x32, 0x24,
+	0x69, 0x29, 0xa0, 0x8a, 0x3c, 0x32, 0x9b, 0xac, 0xfe, 0x83, 0x48, 0xfe, 0x41, 0x63, 0xfe, 0x10,
+	0x21, 0x45, 0x05, 0xc1, 0x00, 0x6b, 0x00, 0xa2, 0x86, 0xfe, 0x49, 0xe4, 0xfe, 0x93, 0xc8, 0xfe,
+	0xc5, 0x4b, 0xa3, 0x85, 0x61, 0x1f, 0x62, 0xa2, 0x67, 0x2e, 0x3f, 0x2f, 0xfe, 0xac, 0x6b, 0xfe,
+	0x6a, 0xa5, 0xfe, 0x20, 0xa1, 0x00, 0x6f, 0xc0, 0x07, 0x03, 0xa6, 0x53, 0xfe, 0x83, 0x67, 0xfe,
+	0xd5, 0x8a, 0x32, 0x98, 0xbf, 0xfe, 0x52, 0x04, 0xfe, 0x10, 0x60, 0x00, 0x07, 0xc0, 0x00, 0xc0,
+	0x05, 0xa2, 0x96, 0xfe, 0x7b, 0x26, 0xfe, 0xcd, 0x4a, 0xa3, 0x67, 0xfe, 0x93, 0xe9, 0x2c, 0x9b,
+	0xac, 0x00, 0xc5, 0x05, 0x0f, 0xa5, 0x74, 0xfe, 0xa4, 0x08, 0xfe, 0xdd, 0x8a, 0x65, 0x5a, 0x33,
+	0x30, 0x69, 0x69, 0x7a, 0x29, 0x24, 0xa1, 0x79, 0x47, 0xfe, 0x7b, 0x47, 0xfe, 0x18, 0xa1, 0x05,
+	0x00, 0xa4, 0x74, 0xfe, 0x62, 0x85, 0xfe, 0xb4, 0x8a, 0x26, 0x3a, 0x32, 0xc0, 0x69, 0x24, 0x6e,
+	0x30, 0xa0, 0x7b, 0xfe, 0x94, 0x0a, 0xfe, 0x41, 0x83, 0x79, 0xfe, 0xac, 0x69, 0x30, 0x60, 0xa2,
+	0x78, 0x37, 0x2b, 0x24, 0x75, 0x27, 0x2e, 0x2b, 0xc0, 0x26, 0x32, 0x57, 0xfe, 0x83, 0x68, 0x15,
+	0x00, 0xc0, 0x05, 0x00, 0xa2, 0x86, 0xfe, 0x7b, 0x07, 0x2b, 0x27, 0x2b, 0x34, 0xfe, 0x41, 0x62,
+	0x03, 0x00, 0xc0, 0x07, 0xa0, 0xa8, 0xfe, 0x41, 0xa4, 0x34, 0x24, 0x69, 0x30, 0x37, 0x2b, 0x2e,
+	0x1b, 0x27, 0xa0, 0x8a, 0x56, 0x26, 0xa2, 0x55, 0x6f, 0x9f, 0xab, 0xfe, 0x83, 0x47, 0xfe, 0x10,
+	0x00, 0x10, 0xfe, 0x9c, 0x0a, 0xfe, 0xdd, 0x8c, 0x33, 0x27, 0x66, 0x6b, 0x6b, 0x29, 0x79, 0x69,
+	0x59, 0xa0, 0x7a, 0x31, 0xfe, 0x8b, 0xa9, 0xfe, 0x29, 0x02, 0x00, 0x07, 0x00, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xcf, 0x08, 0x3d, 0xfe, 0xbc, 0xaa, 0x3f, 0x9b, 0xad, 0xfe, 0x5a, 0x25, 0x10, 0x00, 0xc4,
+	0x7a, 0xa8, 0x62, 0xfe, 0xc4, 0xeb, 0xa6, 0x51, 0x9b, 0xad, 0xfe, 0x5a, 0x45, 0x08, 0x00, 0x6e,
+	0x2c, 0xfe, 0x83, 0x46, 0x37, 0xa1, 0x96, 0x3a, 0x42, 0xc0, 0x6f, 0xc1, 0x31, 0x2a, 0x6e, 0x57,
+	0xfe, 0x8b, 0xa8, 0xfe, 0x29, 0x02, 0x00, 0xc0, 0xa6, 0x74, 0xfe, 0xac, 0x4b, 0x38, 0x69, 0x1f,
+	0xa0, 0x7b, 0xa2, 0x66, 0x68, 0xc0, 0x3e, 0x66, 0x37, 0x6d, 0xc0, 0x9d, 0x9c, 0xfe, 0x93, 0xe9,
+	0x3d, 0xfe, 0x10, 0x40, 0x00, 0x6e, 0x00, 0xc0, 0x03, 0xa3, 0x75, 0xfe, 0x52, 0x03, 0xfe, 0xa4,
+	0x69, 0x3b, 0x37, 0xc1, 0x2f, 0x6b, 0x3b, 0x69, 0x37, 0x6e, 0x62, 0x9b, 0xad, 0xfe, 0x6a, 0xa6,
+	0xfe, 0x18, 0x81, 0x05, 0x0c, 0x00, 0xc0, 0xa6, 0x74, 0x1c, 0xfe, 0xd5, 0x69, 0xa0, 0x9a, 0x57,
+	0xfe, 0x9c, 0x0a, 0xfe, 0x31, 0x63, 0x08, 0x00, 0xc3, 0x18, 0xfe, 0x83, 0x26, 0xfe, 0xcd, 0x4a,
+	0xa3, 0x67, 0xfe, 0x93, 0xc9, 0xfe, 0x28, 0xa2, 0x00, 0xc6, 0x05, 0x08, 0xa6, 0x63, 0xfe, 0x9c,
+	0x07, 0x38, 0xc0, 0x2b, 0x57, 0x31, 0x27, 0x2f, 0xc0, 0x5a, 0x2f, 0x6b, 0x9d, 0x9c, 0xfe, 0x7b,
+	0x48, 0xfe, 0x18, 0xc1, 0x00, 0xa2, 0x76, 0xfe, 0x4a, 0x04, 0xfe, 0xb4, 0xcb, 0x03, 0x7d, 0x51,
+	0x9d, 0x9b, 0x1d, 0xa1, 0x89, 0x69, 0x34, 0x3e, 0x57, 0x98, 0xbe, 0xfe, 0x41, 0xa3, 0x66, 0xfe,
+	0xa4, 0x4c, 0x3d, 0x31, 0x3d, 0x56, 0x31, 0x2b, 0x79, 0xa1, 0x79, 0x34, 0x2c, 0x3d, 0xc0, 0x6b,
+	0x57, 0xfe, 0x7b, 0x68, 0xfe, 0x10, 0x80, 0x05, 0x00, 0x0c, 0x00, 0xa6, 0x73, 0xfe, 0xac, 0x49,
+	0x3f, 0x9d, 0xa9, 0x2b, 0x9d, 0xac, 0xfe, 0x72, 0xa6, 0x18, 0x00, 0xc0, 0x05, 0x08, 0xac, 0x30,
+	0xfe, 0x9c, 0x4b, 0x36, 0x76, 0x5b, 0x5b, 0x36, 0x3a, 0x27, 0x3a, 0x9f, 0x8b, 0x33, 0x38, 0xa2,
+	0x56, 0x69, 0x63, 0xfe, 0x83, 0x8a, 0xfe, 0x08, 0x00, 0xa2, 0x77, 0xfe, 0x9c, 0x0a, 0xfe, 0xdd,
+	0xab, 0x79, 0x3a, 0x57, 0x36, 0x00, 0xc0, 0x39, 0x32, 0x65, 0x2a, 0x35, 0xfe, 0x83, 0xaa, 0xfe,
+	0x29, 0x02, 0x98, 0xbe, 0xfd, 0xfd, 0xfd, 0xfd, 0xd1, 0x08, 0xfe, 0x49, 0xc4, 0xfe, 0xb4, 0x89,
+	0xa8, 0x51, 0x1d, 0x19, 0xfe, 0x08, 0x40, 0x00, 0xc4, 0x03, 0xa8, 0x52, 0xfe, 0xbc, 0xec, 0x3a,
+	0x9b, 0xad, 0xfe, 0x5a, 0x45, 0x03, 0x00, 0xc0, 0xa5, 0x74, 0xfe, 0x83, 0x66, 0x37, 0x2b, 0x99,
+	0xbf, 0xfe, 0x7b, 0x07, 0x9d, 0x9b, 0x6e, 0xc0, 0x7f, 0x66, 0x01, 0x69, 0x06, 0x99, 0xbd, 0xfe,
+	0x10, 0x61, 0x00, 0xc0, 0xa7, 0x62, 0xfe, 0xa4, 0x6a, 0xfe, 0xd5, 0x8a, 0x69, 0xfe, 0xa4, 0x47,
+	0x16, 0x55, 0x6e, 0x69, 0x0c, 0xa3, 0x87, 0xa9, 0x31, 0xa6, 0x53, 0x2d, 0x6e, 0x6b, 0xfe, 0x94,
+	0x09, 0xfe, 0x39, 0x62, 0xfe, 0x08, 0x20, 0x57, 0xc1, 0xa1, 0x96, 0xfe, 0x49, 0xa2, 0x0a, 0x2d,
+	0x7f, 0x62, 0x9c, 0x8c, 0x96, 0xdf, 0x99, 0xbc, 0x9c, 0x9b, 0xa2, 0x76, 0xa7, 0x53, 0xaa, 0x52,
+	0xa5, 0x64, 0xa2, 0x86, 0x57, 0x9b, 0xad, 0x19, 0xfe, 0x10, 0x60, 0x00, 0xc1, 0xa6, 0x63, 0xfe,
+	0x83, 0x67, 0x2b, 0x7a, 0x6b, 0x1d, 0xfe, 0x72, 0xe6, 0x31, 0x03, 0x5b, 0x00, 0x6e, 0xc0, 0xa2,
+	0x97, 0xfe, 0x83, 0x06, 0x2a, 0xa3, 0x66, 0xfe, 0x93, 0xe9, 0x2c, 0x00, 0x05, 0x00, 0xc4, 0x05,
+	0x76, 0xa7, 0x52, 0xfe, 0x9c, 0x08, 0x3e, 0x2a, 0x98, 0xbe, 0x0e, 0x52, 0x6f, 0x66, 0x59, 0x6e,
+	0x06, 0x7a, 0x08, 0x98, 0xbd, 0x95, 0xdf, 0x00, 0x31, 0xfe, 0x83, 0x89, 0x36, 0xa1, 0x97, 0x9d,
+	0x9a, 0xfe, 0x8b, 0x86, 0xfe, 0x5a, 0x44, 0x9a, 0xcd, 0x6e, 0xa3, 0x76, 0xa6, 0x54, 0xab, 0x21,
+	0xa7, 0x45, 0x95, 0xdf, 0xfe, 0x29, 0x01, 0x57, 0xac, 0x30, 0x0e, 0x69, 0x06, 0xc0, 0xa5, 0x73,
+	0xfe, 0xbc, 0xc9, 0x33, 0x9f, 0x8b, 0xfe, 0xa4, 0x09, 0x0e, 0x65, 0x0e, 0xc0, 0x57, 0x98, 0xbd,
+	0xfe, 0x08, 0x41, 0x52, 0xc1, 0x00, 0xfe, 0x51, 0xc3, 0xfe, 0xcd, 0x2a, 0xa4, 0x54, 0x2d, 0xa2,
+	0x77, 0x9c, 0xbc, 0xfe, 0x93, 0xa8, 0xfe, 0x31, 0x01, 0x00, 0xc0, 0x05, 0xc0, 0xa7, 0x53, 0xab,
+	0x31, 0x0e, 0x65, 0x06, 0xc0, 0xa6, 0x52, 0xfe, 0xc5, 0x0a, 0x33, 0x9f, 0x8b, 0xfe, 0xa3, 0xe9,
+	0x99, 0xad, 0x0e, 0x5a, 0xc1, 0x99, 0xbd, 0x05, 0xa1, 0x97, 0xfe, 0x9c, 0x0a, 0x3a, 0x30, 0x98,
+	0xbf, 0x38, 0x57, 0x03, 0x69, 0xc0, 0x7a, 0x0b, 0xc0, 0x03, 0x99, 0xbd, 0x95, 0xdf, 0x00, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xd1, 0x7e, 0xfe, 0x51, 0xc4, 0xfe, 0xb4, 0x8a, 0xfe, 0xdd, 0xaa, 0x13, 0xfe,
+	0x52, 0x24, 0xfe, 0x08, 0x60, 0x9d, 0xab, 0xc2, 0x05, 0x00, 0x08, 0xa7, 0x63, 0xfe, 0xbd, 0x0b,
+	0xa4, 0x74, 0x18, 0xfe, 0x62, 0x25, 0xfe, 0x08, 0x00, 0x00, 0x07, 0xa5, 0x73, 0xfe, 0x83, 0x66,
+	0x30, 0x23, 0xfe, 0x8b, 0x88, 0xfe, 0x30, 0xe1, 0x9a, 0x9d, 0xc0, 0x6b, 0x14, 0x67, 0x0f, 0x08,
+	0x10, 0x08, 0x00, 0xc1, 0xa7, 0x62, 0xfe, 0xac, 0x6a, 0xfe, 0xd5, 0xab, 0x51, 0xfe, 0x7a, 0xe5,
+	0xfe, 0x20, 0x61, 0x41, 0x10, 0x5a, 0x7f, 0x79, 0xa6, 0x53, 0xac, 0x20, 0xfe, 0xa4, 0x8a, 0xa9,
+	0x40, 0x69, 0x13, 0xfe, 0x7b, 0x06, 0xfe, 0x28, 0xc2, 0x9b, 0x9c, 0x57, 0x79, 0xa6, 0x62, 0xfe,
+	0x7b, 0x05, 0xfe, 0xc5, 0x09, 0x35, 0x2f, 0xfe, 0x9c, 0x29, 0xfe, 0x5a, 0x45, 0x95, 0xcf, 0x12,
+	0x5a, 0x0d, 0xa3, 0x75, 0xa8, 0x62, 0xfe, 0x83, 0x46, 0xfe, 0xcd, 0x4b, 0xa2, 0x87, 0x6b, 0xfe,
+	0x9b, 0xe9, 0xfe, 0x31, 0x41, 0x05, 0xc1, 0xa5, 0x74, 0xfe, 0x83, 0x47, 0xfe, 0xd5, 0x6a, 0x2e,
+	0x33, 0x57, 0x98, 0xbe, 0xfe, 0x5a, 0x24, 0x18, 0x0a, 0x00, 0x05, 0xc0, 0x18, 0xfe, 0x83, 0x06,
+	0x2a, 0xa2, 0x77, 0xfe, 0x93, 0xe9, 0x2c, 0x00, 0xc6, 0x05, 0x7a, 0xa6, 0x63, 0xfe, 0x9c, 0x07,
+	0xad, 0x20, 0x9c, 0x9b, 0xfe, 0x7b, 0x26, 0xfe, 0x20, 0xc0, 0x08, 0x6b, 0xc1, 0x08, 0x7a, 0xc1,
+	0x08, 0x00, 0x08, 0xab, 0x30, 0xfe, 0xac, 0x8b, 0x3a, 0x52, 0xfe, 0x8b, 0x47, 0xfe, 0x28, 0xe0,
+	0x0b, 0x57, 0x69, 0x0b, 0x18, 0xa6, 0x54, 0xa9, 0x34, 0x9d, 0x9a, 0x95, 0xdf, 0x05, 0xa2, 0x76,
+	0x66, 0x7a, 0x08, 0x10, 0xaa, 0x40, 0xfe, 0x9c, 0x07, 0x2b, 0x9d, 0x9c, 0x02, 0x2c, 0x10, 0xc1,
+	0x6b, 0x0f, 0x07, 0xc2, 0xa4, 0x74, 0xfe, 0x7b, 0x05, 0x3a, 0x9f, 0x68, 0x99, 0xbc, 0xa5, 0x66,
+	0x2d, 0x9a, 0xbd, 0xfe, 0x51, 0xc3, 0xfe, 0x08, 0x20, 0x5b, 0xc0, 0x65, 0x05, 0x0d, 0x0b, 0xc0,
+	0x08, 0x15, 0xaa, 0x40, 0xfe, 0xa4, 0x48, 0xaa, 0x41, 0x52, 0xfe, 0x6a, 0xa5, 0x2c, 0x10, 0x15,
+	0x08, 0x10, 0x53, 0x07, 0x10, 0xfe, 0x9c, 0x0a, 0x01, 0x2d, 0xfe, 0x8b, 0x87, 0xfe, 0x18, 0x80,
+	0x08, 0x0d, 0xc1, 0x08, 0x0d, 0xc0, 0x08, 0x05, 0xc0, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xd1, 0x08,
+	0xfe, 0x49, 0xc4, 0xfe, 0xb4, 0x8a, 0xa9, 0x30, 0x1a, 0xfe, 0x52, 0x25, 0x12, 0x00, 0x07, 0xc1,
+	0x05, 0x00, 0x08, 0xa7, 0x63, 0xfe, 0xbc, 0xec, 0x37, 0x9c, 0xad, 0x19, 0x03, 0x07, 0xc0, 0x2c,
+	0xfe, 0x83, 0x66, 0xfe, 0xcd, 0xaa, 0x62, 0xfe, 0x8b, 0xa8, 0xfe, 0x20, 0xe2, 0x9a, 0xbc, 0x05,
+	0xc1, 0x0c, 0x00, 0xc3, 0x07, 0x00, 0xa7, 0x62, 0xfe, 0xac, 0x6a, 0x3e, 0x56, 0xfe, 0x72, 0xa5,
+	0xfe, 0x18, 0x20, 0x03, 0x07, 0xc1, 0x0f, 0x03, 0x1d, 0xac, 0x30, 0xfe, 0x9c, 0x29, 0x28, 0x37,
+	0x97, 0xcf, 0xfe, 0x51, 0xe4, 0x0d, 0x07, 0xa3, 0x75, 0x0a, 0xfe, 0xb4, 0x89, 0xa9, 0x41, 0x37,
+	0x1d, 0xfe, 0x41, 0xa3, 0x15, 0x00, 0xc1, 0x0c, 0x76, 0x03, 0xa8, 0x51, 0xfe, 0x83, 0x67, 0xfe,
+	0xcd, 0x4c, 0xa1, 0x96, 0x9d, 0x9a, 0xfe, 0x72, 0xe6, 0xfe, 0x10, 0x80, 0x42, 0x66, 0xa5, 0x75,
+	0xfe, 0x83, 0x48, 0xfe, 0xd5, 0x6b, 0x79, 0xc0, 0x35, 0x32, 0x95, 0xcf, 0xfe, 0x39, 0x62, 0x0b,
+	0x00, 0x05, 0xc0, 0xa2, 0x96, 0xfe, 0x83, 0x05, 0xfe, 0xd5, 0x2b, 0x3e, 0xfe, 0x93, 0xca, 0x2c,
+	0x00, 0xc6, 0x05, 0x77, 0x39, 0xfe, 0x9c, 0x07, 0xfe, 0xd5, 0xab, 0x9c, 0xac, 0xfe, 0x7b, 0x46,
+	0xfe, 0x18, 0xa0, 0x00, 0xc1, 0x6b, 0x00, 0xc1, 0x05, 0xc0, 0x6e, 0x0d, 0xfe, 0x49, 0xe3, 0xfe,
+	0xbd, 0x0b, 0xa3, 0x83, 0x9c, 0xac, 0xfe, 0x5a, 0x03, 0x08, 0x05, 0x0c, 0x07, 0x00, 0xc1, 0x08,
+	0x6f, 0x05, 0xc1, 0x00, 0x7b, 0x07, 0x03, 0xaa, 0x40, 0xfe, 0x9b, 0xe7, 0xfe, 0xd5, 0x8a, 0x31,
+	0xfe, 0x6a, 0xc7, 0xfe, 0x18, 0x61, 0x00, 0xc1, 0x07, 0xc0, 0x0c, 0x00, 0xc0, 0x03, 0xfe, 0x39,
+	0x82, 0xfe, 0xac, 0x49, 0xaa, 0x50, 0x1a, 0xfe, 0x6a, 0xa4, 0xa8, 0x53, 0xad, 0x40, 0x55, 0xfe,
+	0x72, 0xe5, 0xfe, 0x10, 0x60, 0x0c, 0x65, 0xc0, 0x6e, 0xc0, 0x03, 0x0a, 0x07, 0x08, 0xaa, 0x40,
+	0x1e, 0x30, 0x31, 0xfe, 0x62, 0x65, 0x18, 0x00, 0x05, 0x00, 0x03, 0x07, 0x6b, 0x10, 0xfe, 0x9c,
+	0x09, 0x3a, 0x51, 0xfe, 0x93, 0x87, 0xfe, 0x18, 0x40, 0x03, 0x00, 0xc5, 0x05, 0xc0, 0x00, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xd1, 0x08, 0xfe, 0x49, 0xe4, 0xfe, 0xac, 0xaa, 0x3c, 0x9b, 0xad, 0x16, 0x14,
+	0x00, 0x07, 0xc1, 0x05, 0x00, 0x03, 0xa8, 0x62, 0xfe, 0xbc, 0xec, 0xa5, 0x62, 0x1a, 0xfe, 0x52,
+	0x45, 0x05, 0x07, 0xc0, 0xa5, 0x73, 0xfe, 0x83, 0x65, 0xfe, 0xcd, 0xa9, 0x67, 0xfe, 0x8b, 0xa8,
+	0xfe, 0x20, 0xc1, 0x08, 0x05, 0x00, 0xc3, 0x05, 0xc0, 0x07, 0xc0, 0x00, 0x39, 0xfe, 0xa4, 0x6a,
+	0x37, 0x57, 0xfe, 0x72, 0xc5, 0xfe, 0x10, 0x20, 0x00, 0x05, 0xc1, 0x00, 0xc0, 0x03, 0xa3, 0x76,
+	0xfe, 0x5a, 0x04, 0xfe, 0xbc, 0xaa, 0x35, 0x42, 0x23, 0xfe, 0x18, 0xa1, 0x00, 0xa7, 0x53, 0xfe,
+	0x7b, 0x07, 0x20, 0xa4, 0x65, 0x99, 0xac, 0xfe, 0x5a, 0x64, 0xfe, 0x10, 0x80, 0x05, 0x00, 0xc1,
+	0x07, 0x0e, 0xc0, 0x08, 0xa7, 0x52, 0xfe, 0xa4, 0x28, 0xaa, 0x40, 0x26, 0xfe, 0xa4, 0x29, 0xfe,
+	0x31, 0x42, 0x98, 0xae, 0xc0, 0xa4, 0x86, 0x2a, 0x32, 0x35, 0x67, 0x59, 0xa3, 0x54, 0x9d, 0x8a,
+	0xfe, 0x7b, 0x25, 0xfe, 0x28, 0xc1, 0x03, 0x05, 0xc0, 0xa2, 0x96, 0xfe, 0x83, 0x05, 0x26, 0xa2,
+	0x68, 0xfe, 0x9b, 0xe9, 0x2c, 0x00, 0xc6, 0x05, 0x77, 0x39, 0xfe, 0x9c, 0x07, 0x3e, 0x9d, 0x8a,
+	0xfe, 0x7b, 0x27, 0xfe, 0x18, 0x80, 0x00, 0xc1, 0x07, 0x00, 0x05, 0xc0, 0x0c, 0x05, 0x00, 0x08,
+	0xfe, 0x52, 0x04, 0xfe, 0xbd, 0x0a, 0xa4, 0x83, 0x9a, 0xbe, 0xfe, 0x52, 0x03, 0xfe, 0x08, 0x40,
+	0x5a, 0x0d, 0x00, 0x6e, 0xc2, 0x00, 0xc0, 0x05, 0xc0, 0x07, 0xc1, 0x79, 0xa9, 0x51, 0xfe, 0x9b,
+	0xc7, 0x2b, 0x25, 0xfe, 0x6a, 0xa6, 0xfe, 0x10, 0x61, 0x9d, 0x9a, 0xc1, 0x07, 0xc0, 0x00, 0x05,
+	0x03, 0x7e, 0xfe, 0x6a, 0xa5, 0xfe, 0xcd, 0x4c, 0xa0, 0xa7, 0xfe, 0x9c, 0x2a, 0xfe, 0x31, 0x41,
+	0xa8, 0x63, 0xfe, 0xcc, 0xeb, 0x37, 0x96, 0xaf, 0xfe, 0x31, 0x43, 0x0c, 0x00, 0xc0, 0x05, 0x00,
+	0xc0, 0x07, 0xc0, 0x03, 0xaa, 0x40, 0xfe, 0xa4, 0x28, 0xfe, 0xd5, 0x8a, 0x53, 0xfe, 0x62, 0x65,
+	0x1c, 0x00, 0x05, 0x00, 0xc1, 0x0c, 0xa2, 0x85, 0x18, 0xfe, 0xdd, 0x8a, 0x2b, 0xfe, 0x93, 0xa7,
+	0xfe, 0x18, 0x60, 0x00, 0x05, 0x00, 0xc0, 0x07, 0xc1, 0x00, 0x05, 0xc0, 0x00, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xd1, 0x05, 0xfe, 0x41, 0xe4, 0xfe, 0xac, 0xaa, 0xa9, 0x40, 0x9a, 0xbe, 0xfe, 0x5a, 0x25,
+	0xfe, 0x10, 0x40, 0x08, 0x03, 0xc0, 0x08, 0x05, 0x08, 0x76, 0xa8, 0x52, 0xfe, 0xc4, 0xec, 0xa5,
+	0x52, 0x1a, 0xfe, 0x52, 0x25, 0x05, 0x07, 0x00, 0xa5, 0x74, 0xfe, 0x83, 0x45, 0xfe, 0xcd, 0x8a,
+	0x2f, 0xfe, 0x8b, 0x89, 0x34, 0x03, 0x0f, 0xc0, 0x08, 0x00, 0x08, 0x03, 0xc0, 0x00, 0x07, 0x00,
+	0xc0, 0x39, 0xfe, 0xa4, 0x4a, 0x37, 0x5a, 0x3b, 0xfe, 0x10, 0x20, 0x00, 0x05, 0x0a, 0x05, 0x00,
+	0xc1, 0x7b, 0xa7, 0x52, 0xfe, 0x93, 0x88, 0xfe, 0xd5, 0x4b, 0x7e, 0x20, 0x12, 0x05, 0xaa, 0x50,
+	0xfe, 0x9b, 0xe8, 0xab, 0x41, 0x6e, 0xfe, 0x83, 0x67, 0xfe, 0x29, 0x01, 0x05, 0x66, 0xc3, 0x07,
+	0xc1, 0xa4, 0x63, 0xfe, 0x62, 0xa4, 0xfe, 0xcd, 0x29, 0xa2, 0x86, 0x9b, 0x9e, 0xfe, 0x52, 0x04,
+	0xfe, 0x00, 0x40, 0xc0, 0xa5, 0x74, 0xfe, 0x83, 0x48, 0xfe, 0xdd, 0x4b, 0x69, 0x9b, 0xad, 0x46,
+	0xa7, 0x41, 0xa3, 0x64, 0x98, 0xcf, 0xfe, 0x62, 0x25, 0xfe, 0x20, 0x61, 0x08, 0x05, 0x18, 0xfe,
+	0x83, 0x26, 0xfe, 0xd5, 0x4a, 0x37, 0xfe, 0x93, 0xe9, 0xfe, 0x20, 0xa1, 0x00, 0xc6, 0x05, 0x77,
+	0xa7, 0x61, 0x11, 0xac, 0x30, 0x9d, 0x9b, 0x23, 0x2c, 0x03, 0x0a, 0xc0, 0x03, 0xc3, 0x0a, 0x5a,
+	0x08, 0xfe, 0x41, 0xc4, 0xfe, 0xb4, 0xcb, 0xa6, 0x72, 0x9d, 0x9a, 0xfe, 0x8b, 0x66, 0xfe, 0x29,
+	0x21, 0x9a, 0xad, 0x66, 0x00, 0xc0, 0x05, 0xc1, 0x07, 0x00, 0xc1, 0x07, 0x00, 0xc1, 0xa9, 0x61,
+	0xfe, 0x9b, 0xc7, 0x2e, 0x47, 0xfe, 0x6a, 0xc6, 0xfe, 0x10, 0x61, 0x9d, 0x9a, 0xc1, 0x07, 0x6e,
+	0x00, 0x08, 0x66, 0xa7, 0x51, 0xfe, 0x9b, 0xe8, 0xad, 0x30, 0x9d, 0xaa, 0xfe, 0x6a, 0xe7, 0x1a,
+	0xa6, 0x64, 0xfe, 0xa4, 0x49, 0x08, 0x99, 0xbd, 0xfe, 0x5a, 0x46, 0xfe, 0x10, 0x41, 0x00, 0xc0,
+	0x05, 0x00, 0x07, 0xc0, 0x00, 0xc0, 0x10, 0xfe, 0xa4, 0x09, 0x2e, 0x4b, 0xfe, 0x62, 0x85, 0x1c,
+	0x00, 0x05, 0x00, 0xc1, 0x6f, 0xa2, 0x85, 0xfe, 0x9c, 0x09, 0xfe, 0xdd, 0x8a, 0x56, 0xfe, 0x8b,
+	0x87, 0xfe, 0x18, 0x60, 0x42, 0x05, 0xc0, 0x00, 0x07, 0x0a, 0x0f, 0x0c, 0xc1, 0x00, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xd1, 0x05, 0xfe, 0x41, 0xe4, 0xfe, 0xac, 0xaa, 0xa8, 0x50, 0x9a, 0xce, 0xfe, 0x72,
+	0xa6, 0x10, 0x56, 0xc0, 0x66, 0x08, 0x59, 0xc0, 0x03, 0xa7, 0x62, 0xfe, 0xcd, 0x2b, 0x37, 0x9c,
+	0x9d, 0x16, 0x05, 0x00, 0xc0, 0xa4, 0x85, 0xfe, 0x83, 0x46, 0xfe, 0xd5, 0x6b, 0x2a, 0xfe, 0x9b,
+	0xc9, 0xfe, 0x49, 0x62, 0x9c, 0x8b, 0xc5, 0x9d, 0x9b, 0x9d, 0x9a, 0x07, 0x00, 0xc0, 0x39, 0xfe,
+	0xac, 0x4a, 0x37, 0x57, 0xfe, 0x6a, 0xc5, 0xfe, 0x10, 0x20, 0x00, 0x05, 0xc0, 0x00, 0xc2, 0x07,
+	0xa4, 0x64, 0xfe, 0x6a, 0xc6, 0xfe, 0xcd, 0x0a, 0x3a, 0xfe, 0xac, 0x6a, 0xfe, 0x41, 0xa3, 0x96,
+	0xbf, 0xfe, 0x41, 0xe3, 0xfe, 0xac, 0x69, 0xa9, 0x52, 0x9d, 0x9b, 0xfe, 0x6a, 0xa6, 0x24, 0x00,
+	0xc7, 0x05, 0xfe, 0x41, 0xa2, 0xfe, 0xbc, 0xc9, 0xa6, 0x73, 0x9c, 0x9d, 0xfe, 0x72, 0xc7, 0x0d,
+	0x5a, 0xa4, 0x95, 0xfe, 0x8b, 0x47, 0xfe, 0xdd, 0x4b, 0x59, 0xfe, 0x9b, 0xc7, 0x9a, 0xbd, 0xfe,
+	0xb4, 0xc9, 0xa7, 0x51, 0x67, 0xfe, 0x9b, 0xe9, 0xfe, 0x49, 0x83, 0x0d, 0x05, 0xa1, 0xa7, 0xfe,
+	0x7b, 0x05, 0xfe, 0xcd, 0x4a, 0xa2, 0x78, 0xfe, 0x93, 0xe9, 0xfe, 0x20, 0xa1, 0x9b, 0x9c, 0xc6,
+	0x05, 0x76, 0xa7, 0x62, 0xfe, 0xa4, 0x08, 0x3e, 0x9c, 0xab, 0xfe, 0x8b, 0x67, 0xfe, 0x41, 0x42,
+	0x39, 0xc5, 0x24, 0x9d, 0x9a, 0x07, 0x0c, 0xaa, 0x40, 0xfe, 0x9c, 0x2b, 0xfe, 0xd5, 0x6c, 0x32,
+	0x1d, 0xfe, 0x83, 0x88, 0x16, 0x97, 0xde, 0x9d, 0x9b, 0x17, 0x0b, 0x03, 0x00, 0xc0, 0x05, 0xc0,
+	0x00, 0x07, 0x00, 0xc0, 0x05, 0xa8, 0x72, 0xfe, 0x9b, 0xc7, 0xfe, 0xdd, 0x6a, 0x2a, 0xfe, 0x6a,
+	0xc6, 0xfe, 0x10, 0x61, 0x9d, 0x9a, 0xc1, 0x07, 0x05, 0x00, 0x03, 0xc0, 0xfe, 0x49, 0xc2, 0xfe,
+	0xc4, 0xcb, 0xa6, 0x54, 0x9b, 0x9c, 0xfe, 0x39, 0x84, 0x00, 0xa4, 0x74, 0xfe, 0x83, 0x67, 0xfe,
+	0xd5, 0x8d, 0x9d, 0xaa, 0xfe, 0x8b, 0x69, 0xfe, 0x20, 0xa1, 0x00, 0xc2, 0x07, 0x00, 0xc1, 0x10,
+	0x1b, 0x2e, 0x2a, 0xfe, 0x62, 0x85, 0xfe, 0x10, 0x61, 0x00, 0x6e, 0x00, 0xc1, 0x0c, 0x15, 0xfe,
+	0x9c, 0x09, 0xfe, 0xdd, 0x8a, 0x32, 0xfe, 0x9b, 0xc7, 0xfe, 0x39, 0x21, 0x42, 0xc0, 0x66, 0xc1,
+	0x39, 0x6f, 0x9d, 0x9b, 0x0f, 0x07, 0x69, 0xfd, 0xfd, 0xfd, 0xfd, 0xd1, 0x7e, 0xfe, 0x49, 0xe4,
+	0xfe, 0xb4, 0xaa, 0x33, 0x56, 0x99, 0xbf, 0x9d, 0x8b, 0x69, 0x1b, 0xc0, 0x6e, 0x59, 0x1d, 0x1b,
+	0xa2, 0x86, 0x26, 0x2e, 0x9d, 0x8d, 0xfe, 0x5a, 0x25, 0xfe, 0x00, 0x20, 0x00, 0xc0, 0xa4, 0x85,
+	0xfe, 0x83, 0x27, 0x32, 0x2e, 0x11, 0x14, 0x56, 0x5a, 0x0c, 0x69, 0xc0, 0x6f, 0x57, 0xfe, 0x5a,
+	0x65, 0xfe, 0x18, 0x81, 0x9d, 0x8a, 0x00, 0xc0, 0xa6, 0x74, 0xfe, 0xac, 0x2b, 0xfe, 0xd5, 0x6c,
+	0x5a, 0xfe, 0x72, 0xc6, 0x0b, 0x00, 0xc0, 0x05, 0x00, 0xc3, 0xa2, 0x77, 0xfe, 0x52, 0x04, 0xfe,
+	0xbc, 0xc9, 0x2e, 0x01, 0xfe, 0x4a, 0x04, 0xfe, 0x08, 0x60, 0xfe, 0x52, 0x44, 0xfe, 0xb4, 0xca,
+	0xa6, 0x74, 0x9b, 0x9c, 0x0a, 0xfe, 0x10, 0x40, 0x00, 0xc5, 0x05, 0xc0, 0x00, 0xa8, 0x51, 0xfe,
+	0xa4, 0x49, 0x33, 0x9d, 0x9c, 0xfe, 0x83, 0x49, 0x21, 0x41, 0x34, 0xfe, 0x8b, 0x27, 0x2e, 0x26,
+	0xfe, 0x8b, 0x86, 0xfe, 0x49, 0xa2, 0xab, 0x31, 0xfe, 0xbd, 0x0a, 0x37, 0x25, 0xfe, 0x83, 0x47,
+	0x3e, 0x99, 0xbf, 0xa2, 0x85, 0xfe, 0x83, 0x05, 0xfe, 0xcd, 0x4a, 0xa2, 0x78, 0xfe, 0x93, 0xe9,
+	0x2c, 0x00, 0xc6, 0x05, 0x77, 0xa7, 0x62, 0xfe, 0xa4, 0x08, 0x37, 0x65, 0x9c, 0x9b, 0x11, 0x09,
+	0x69, 0x69, 0xc0, 0x7b, 0x0c, 0x57, 0xfe, 0x4a, 0x04, 0xfe, 0x10, 0x60, 0x42, 0xc0, 0x24, 0xfe,
+	0x62, 0xa6, 0xfe, 0xbc, 0xeb, 0x3e, 0xc0, 0x39, 0x15, 0x9a, 0xbd, 0x99, 0xbd, 0x98, 0xcd, 0x99,
+	0xce, 0x9a, 0xac, 0x9d, 0x89, 0x52, 0x00, 0xc0, 0x6b, 0xc0, 0x05, 0xc1, 0xa8, 0x62, 0xfe, 0x9b,
+	0xc8, 0xfe, 0xdd, 0x6a, 0x47, 0x3f, 0x1c, 0x00, 0xc4, 0x0a, 0xa4, 0x63, 0xfe, 0x7a, 0xe6, 0xfe,
+	0xd5, 0x4c, 0xc0, 0x0b, 0xfe, 0x18, 0xc1, 0x05, 0x10, 0xfe, 0x5a, 0x44, 0x15, 0xa4, 0x85, 0xfe,
+	0xac, 0x4b, 0xfe, 0x41, 0x63, 0x08, 0x00, 0xc1, 0x6b, 0x05, 0xc0, 0x00, 0xa9, 0x61, 0x1b, 0xfe,
+	0xdd, 0x6a, 0x2a, 0xfe, 0x62, 0x85, 0x1c, 0x00, 0x05, 0x00, 0xc1, 0x6f, 0xa2, 0x85, 0xfe, 0x9c,
+	0x09, 0x33, 0x62, 0x9d, 0x8b, 0x98, 0xbd, 0xc1, 0x67, 0xc0, 0x69, 0x07, 0x46, 0xfe, 0x5a, 0x45,
+	0xfe, 0x18, 0x81, 0x9c, 0x9b, 0xfd, 0xfd, 0xfd, 0xfd, 0xd2, 0x08, 0xfe, 0x49, 0xc4, 0xfe, 0xb4,
+	0x8a, 0x2e, 0x33, 0x3e, 0x6b, 0x6d, 0x7a, 0x01, 0x69, 0x5e, 0xc0, 0x01, 0x66, 0x9f, 0x96, 0x6e,
+	0x1f, 0x19, 0x00, 0xc1, 0xa4, 0x85, 0xfe, 0x83, 0x27, 0xfe, 0xdd, 0x4b, 0x7e, 0x3c, 0x39, 0x03,
+	0xc0, 0x01, 0x3a, 0x5a, 0x3e, 0x9f, 0x8b, 0xfe, 0x83, 0x48, 0xfe, 0x20, 0xc1, 0x9b, 0x9c, 0x00,
+	0xc0, 0xa6, 0x74, 0x36, 0x32, 0x5b, 0xfe, 0x72, 0xc5, 0xfe, 0x10, 0x20, 0x57, 0x5a, 0x00, 0xc3,
+	0x05, 0x6e, 0xfe, 0x41, 0xc3, 0xfe, 0xb4, 0x89, 0x2e, 0x9b, 0x9d, 0xfe, 0x52, 0x25, 0x15, 0xfe,
+	0x5a, 0x84, 0xfe, 0xbc, 0xea, 0x37, 0x99, 0xce, 0xfe, 0x49, 0xa3, 0xfe, 0x08, 0x40, 0x00, 0xc1,
+	0x07, 0xc1, 0x00, 0xc2, 0xa5, 0x64, 0xfe, 0x93, 0xe9, 0xfe, 0xd5, 0x8a, 0x63, 0xfe, 0x83, 0x49,
+	0xfe, 0x10, 0x81, 0x05, 0xa5, 0x84, 0xfe, 0x8b, 0x47, 0xfe, 0xd5, 0x6a, 0x59, 0xfe, 0x8b, 0xa7,
+	0xfe, 0x31, 0x22, 0x7e, 0xfe, 0x8b, 0xa8, 0xfe, 0xcd, 0x4b, 0xa3, 0x74, 0x99, 0xbe, 0xfe, 0x62,
+	0x85, 0xfe, 0x18, 0x82, 0x75, 0xfe, 0x83, 0x25, 0x23, 0x3e, 0xfe, 0x93, 0xe9, 0x2c, 0x00, 0xc6,
+	0x05, 0x77, 0xa6, 0x73, 0xfe, 0xa3, 0xe8, 0x3a, 0xc0, 0x01, 0x5b, 0xc0, 0x6c, 0xc0, 0x37, 0x3c,
+	0x03, 0x43, 0x3f, 0x24, 0x07, 0xc0, 0x7e, 0xa7, 0x52, 0xfe, 0x73, 0x06, 0x09, 0xa3, 0x75, 0xa3,
+	0x76, 0x6e, 0xc0, 0x57, 0x9b, 0xac, 0x9b, 0xab, 0x97, 0xcf, 0x3d, 0x98, 0xbd, 0x9a, 0xbd, 0x07,
+	0xc1, 0x6d, 0xc1, 0x0d, 0xfe, 0x9b, 0xc8, 0xfe, 0xd5, 0x6a, 0x2a, 0xfe, 0x6a, 0xc6, 0x1c, 0x00,
+	0xc3, 0x6b, 0x03, 0xfe, 0x31, 0x41, 0xfe, 0xac, 0x49, 0x01, 0x9d, 0x9c, 0xfe, 0x5a, 0x65, 0xfe,
+	0x08, 0x40, 0x57, 0x08, 0xa9, 0x50, 0xfe, 0x9b, 0xe8, 0x39, 0x9c, 0xab, 0xfe, 0x72, 0xa6, 0x1d,
+	0x00, 0xc2, 0x05, 0xc1, 0xa9, 0x61, 0x20, 0xfe, 0xdd, 0x8a, 0x2a, 0xfe, 0x62, 0x85, 0x1c, 0x00,
+	0x05, 0x00, 0xc1, 0x6f, 0xa2, 0x85, 0xfe, 0x9c, 0x09, 0x3a, 0x66, 0x3a, 0x37, 0x6f, 0x3e, 0x6b,
+	0x01, 0x3a, 0x03, 0x9d, 0x9b, 0xfe, 0x7b, 0x48, 0x31, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xd2, 0x08,
+	0xfe, 0x49, 0xc4, 0xfe, 0xbc, 0x8a, 0xa7, 0x61, 0x5a, 0x9e, 0x8c, 0x5e, 0x69, 0x79, 0x1e, 0xc0,
+	0x5e, 0xc0, 0x2a, 0x76, 0x7c, 0x6f, 0x1f, 0x19, 0xfe, 0x08, 0x00, 0x00, 0x0c, 0xa3, 0x95, 0xfe,
+	0x83, 0x27, 0xfe, 0xdd, 0x4b, 0x7e, 0x28, 0x56, 0x5e, 0xc0, 0x7a, 0x65, 0x5a, 0xa0, 0x8a, 0x57,
+	0xfe, 0x73, 0x08, 0xfe, 0x20, 0xc1, 0x9b, 0x9c, 0xc0, 0x00, 0xa6, 0x74, 0xfe, 0xac, 0x4b, 0x37,
+	0x5b, 0xfe, 0x72, 0xc5, 0xfe, 0x10, 0x20, 0x9f, 0x8b, 0x07, 0x00, 0x0c, 0x00, 0xc1, 0x05, 0x6e,
+	0xfe, 0x41, 0xe3, 0xfe, 0xb4, 0xa9, 0x2e, 0x9b, 0xad, 0xfe, 0x52, 0x25, 0x12, 0xfe, 0x5a, 0x84,
+	0xfe, 0xbc, 0xe9, 0xa5, 0x64, 0x09, 0xfe, 0x49, 0xa3, 0xfe, 0x10, 0x41, 0x05, 0x00, 0xc0, 0x6b,
+	0xc2, 0x00, 0xc1, 0x29, 0x10, 0x37, 0x63, 0xfe, 0x83, 0x49, 0xfe, 0x10, 0x81, 0x05, 0xa5, 0x84,
+	0x26, 0xfe, 0xd5, 0x6a, 0x5a, 0xfe, 0x83, 0xa7, 0xfe, 0x29, 0x02, 0x9a, 0xcc, 0xfe, 0x52, 0x05,
+	0xfe, 0xac, 0x8a, 0x30, 0xc0, 0xfe, 0xa4, 0x28, 0xfe, 0x49, 0xa4, 0x99, 0xcc, 0xfe, 0x8b, 0x46,
+	0x28, 0x3e, 0xfe, 0x93, 0xc9, 0xfe, 0x20, 0xa1, 0x00, 0xc7, 0x7b, 0xa6, 0x73, 0xfe, 0xa3, 0xe8,
+	0xfe, 0xd5, 0x8b, 0x66, 0x2a, 0x57, 0xc0, 0x22, 0xc0, 0x69, 0xc0, 0x5b, 0x52, 0xfe, 0x62, 0xa6,
+	0xfe, 0x18, 0x81, 0x07, 0x6b, 0x7e, 0x08, 0xa5, 0x64, 0xfe, 0x62, 0x65, 0xaa, 0x40, 0xa8, 0x52,
+	0xa5, 0x54, 0x28, 0x30, 0x6e, 0x6e, 0x9d, 0x9c, 0x9a, 0xbe, 0xfe, 0x72, 0xc7, 0x31, 0x07, 0xc0,
+	0x00, 0x6e, 0xc1, 0xa8, 0x62, 0xfe, 0x9b, 0xc8, 0x2b, 0x2a, 0xfe, 0x6a, 0xc6, 0x21, 0x00, 0xc0,
+	0x03, 0xc0, 0x00, 0x6b, 0xa2, 0x75, 0xfe, 0x5a, 0x63, 0x2a, 0xa1, 0x97, 0x9a, 0xaf, 0xfe, 0x31,
+	0x22, 0x05, 0x07, 0x6e, 0x27, 0xfe, 0x7a, 0xe5, 0x2a, 0x32, 0xfe, 0x93, 0xc8, 0xfe, 0x29, 0x01,
+	0x98, 0xcf, 0x07, 0x00, 0x05, 0xc2, 0xa9, 0x51, 0xfe, 0xa4, 0x29, 0x30, 0x2a, 0xfe, 0x62, 0x85,
+	0x1c, 0x00, 0xc3, 0x07, 0xa2, 0x85, 0xfe, 0x9c, 0x29, 0xfe, 0xd5, 0x8b, 0x2e, 0x56, 0x1b, 0x22,
+	0x29, 0xc0, 0x22, 0xc1, 0x43, 0xfe, 0x6b, 0x08, 0xfe, 0x20, 0xc2, 0x00, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xd2, 0x08, 0xfe, 0x49, 0xc4, 0xfe, 0xb4, 0x89, 0x33, 0x9d, 0xab, 0xfe, 0x9b, 0xc8, 0x9b, 0x8b,
+	0xc0, 0x66, 0x7a, 0x0c, 0x6d, 0xc0, 0x0f, 0xa3, 0x86, 0x21, 0xa2, 0x76, 0x9c, 0x9e, 0xfe, 0x5a,
+	0x25, 0x00, 0xc0, 0x6f, 0xa4, 0x84, 0xfe, 0x83, 0x46, 0x32, 0x76, 0x99, 0xbe, 0x0f, 0x3b, 0x5e,
+	0x7a, 0x3b, 0x6b, 0x6f, 0x56, 0x98, 0xbd, 0x96, 0xcf, 0x05, 0x67, 0xc0, 0xa6, 0x73, 0xfe, 0xac,
+	0x4a, 0x37, 0x5a, 0xfe, 0x72, 0xc5, 0xfe, 0x10, 0x20, 0x9f, 0x8b, 0x07, 0x69, 0x05, 0x00, 0xc0,
+	0x07, 0x00, 0xa3, 0x65, 0xfe, 0x52, 0x44, 0xfe, 0xbc, 0xc9, 0xa6, 0x73, 0x9a, 0x9f, 0xfe, 0x4a,
+	0x05, 0xfe, 0x08, 0x40, 0x14, 0xfe, 0xb4, 0xa9, 0x33, 0x9a, 0xbe, 0xfe, 0x52, 0x04, 0xfe, 0x10,
+	0x61, 0x00, 0xc3, 0x07, 0x00, 0xc1, 0x05, 0xa6, 0x63, 0xfe, 0xa4, 0x49, 0xfe, 0xdd, 0xab, 0x9d,
+	0x9c, 0xfe, 0x7b, 0x08, 0x1c, 0x05, 0xa5, 0x85, 0xfe, 0x8b, 0x47, 0xfe, 0xd5, 0x6a, 0x28, 0xfe,
+	0x8b, 0xa8, 0xfe, 0x28, 0xe2, 0x03, 0x3b, 0xfe, 0x73, 0x07, 0xfe, 0xbd, 0x0a, 0xa5, 0x63, 0x2a,
+	0xfe, 0x93, 0x68, 0xfe, 0x49, 0x61, 0xfe, 0x83, 0x45, 0xfe, 0xcd, 0x6b, 0x7f, 0xfe, 0x93, 0xc9,
+	0x2c, 0x9b, 0x9c, 0xc7, 0x7b, 0xa6, 0x73, 0xfe, 0xa4, 0x08, 0xfe, 0xd5, 0xab, 0x28, 0x97, 0xcf,
+	0x0f, 0x42, 0x69, 0x3d, 0xc2, 0x56, 0x97, 0xbf, 0xfe, 0x08, 0x61, 0x07, 0x6b, 0xc0, 0x07, 0x05,
+	0xa1, 0x97, 0xa5, 0x64, 0xa7, 0x63, 0xa9, 0x32, 0xa7, 0x43, 0xa5, 0x64, 0xa4, 0x75, 0x3c, 0x55,
+	0xa0, 0x9a, 0x98, 0xce, 0xfe, 0x62, 0x65, 0xfe, 0x10, 0x41, 0x00, 0xc3, 0xa9, 0x51, 0xfe, 0x9b,
+	0xc8, 0x32, 0x56, 0x3f, 0x21, 0x00, 0x6b, 0x03, 0xc0, 0x00, 0xc0, 0xa6, 0x62, 0xfe, 0x83, 0xa6,
+	0xfe, 0xd5, 0xab, 0x9d, 0xca, 0xfe, 0x9b, 0xa8, 0xfe, 0x20, 0xa0, 0x10, 0x67, 0xc0, 0xa2, 0x85,
+	0xfe, 0x62, 0x03, 0xfe, 0xb4, 0x88, 0x37, 0x9a, 0xad, 0xfe, 0x52, 0x04, 0xfe, 0x10, 0x20, 0x07,
+	0x00, 0x05, 0xc1, 0x00, 0xaa, 0x40, 0xfe, 0xa4, 0x28, 0xfe, 0xd5, 0x89, 0x2f, 0xfe, 0x62, 0x66,
+	0x1c, 0x00, 0xc3, 0x7b, 0x10, 0x18, 0x37, 0x65, 0x99, 0xbe, 0xfe, 0x73, 0x05, 0x3f, 0x6e, 0xc1,
+	0x3d, 0x04, 0x52, 0x98, 0xbe, 0xfe, 0x10, 0x62, 0x07, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xd1, 0x08,
+	0xfe, 0x49, 0xe3, 0x35, 0xa9, 0x40, 0x9a, 0xbd, 0xfe, 0x6a, 0x84, 0xfe, 0x28, 0xc1, 0x45, 0x24,
+	0x7a, 0x24, 0x22, 0xc0, 0x76, 0xa7, 0x63, 0xfe, 0xc5, 0x0b, 0xa3, 0x75, 0x1f, 0xfe, 0x5a, 0x25,
+	0x00, 0x6e, 0xc0, 0xa4, 0x75, 0xfe, 0x83, 0x46, 0xfe, 0xd5, 0x8b, 0x52, 0xfe, 0x93, 0x89, 0x0d,
+	0x9b, 0x9b, 0xc0, 0x66, 0x7a, 0xc0, 0x6e, 0x24, 0x15, 0x05, 0x07, 0xc1, 0xa6, 0x73, 0xfe, 0xac,
+	0x4a, 0x33, 0x32, 0xfe, 0x72, 0xc5, 0x0b, 0x07, 0xc0, 0x05, 0xc0, 0x00, 0x07, 0x6b, 0x07, 0x29,
+	0xfe, 0x72, 0xe5, 0xfe, 0xcd, 0x29, 0x33, 0xfe, 0xac, 0x6a, 0xfe, 0x41, 0xa4, 0x08, 0xfe, 0x41,
+	0xc3, 0xfe, 0xac, 0x48, 0xaa, 0x40, 0x9d, 0x9c, 0xfe, 0x6a, 0xa6, 0x24, 0x9c, 0x9b, 0xc7, 0x08,
+	0xfe, 0x41, 0xa2, 0xfe, 0xb4, 0xc9, 0x33, 0x9d, 0x8c, 0x3a, 0xfe, 0x08, 0x40, 0x00, 0xa7, 0x53,
+	0xfe, 0x83, 0x47, 0x32, 0xc0, 0xfe, 0x8b, 0xa8, 0xfe, 0x29, 0x02, 0x03, 0x7f, 0xaa, 0x30, 0xfe,
+	0x93, 0xe8, 0xfe, 0xc5, 0x6b, 0x37, 0x0c, 0xfe, 0x82, 0xe4, 0xa4, 0x55, 0xfe, 0xcd, 0x4a, 0x3e,
+	0xfe, 0x93, 0xc9, 0xfe, 0x20, 0xa1, 0x03, 0x00, 0xc5, 0x6e, 0x03, 0xa7, 0x62, 0xfe, 0xa4, 0x07,
+	0xfe, 0xd5, 0xab, 0x22, 0xfe, 0x83, 0x67, 0xfe, 0x30, 0xe1, 0x18, 0x15, 0x1a, 0x7a, 0xc1, 0x1a,
+	0x52, 0x07, 0xc2, 0x00, 0xc0, 0x07, 0x7a, 0x7d, 0x1d, 0xa5, 0x65, 0xa5, 0x64, 0xa7, 0x64, 0xfe,
+	0xa4, 0x49, 0xa7, 0x52, 0x32, 0x23, 0xfe, 0x93, 0xa8, 0xfe, 0x28, 0xc1, 0x00, 0xc3, 0x0d, 0xfe,
+	0x9b, 0xc8, 0x32, 0x53, 0xfe, 0x6a, 0xc6, 0xfe, 0x10, 0x81, 0x00, 0x6b, 0x03, 0xc0, 0x00, 0x03,
+	0xfe, 0x41, 0xc3, 0xfe, 0xa4, 0xa9, 0xa9, 0x60, 0x9b, 0xdd, 0xfe, 0xa3, 0xc7, 0xfe, 0x5a, 0x43,
+	0x57, 0x66, 0x7a, 0x7e, 0xa5, 0x63, 0xfe, 0xb4, 0x87, 0xa8, 0x42, 0x9f, 0x7b, 0xfe, 0x73, 0x26,
+	0xfe, 0x20, 0xc2, 0x07, 0x00, 0x05, 0xc0, 0x07, 0xc0, 0xfe, 0x31, 0x42, 0xfe, 0xa4, 0x28, 0x29,
+	0x9f, 0x8b, 0x2d, 0xfe, 0x10, 0x61, 0x00, 0xc3, 0x7b, 0xa2, 0x75, 0xfe, 0x9c, 0x0a, 0xfe, 0xd5,
+	0x8b, 0x62, 0xfe, 0x93, 0xa8, 0xfe, 0x28, 0xa0, 0x18, 0x1a, 0xc2, 0x1d, 0x1a, 0x52, 0x57, 0x07,
+	0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xd1, 0x08, 0xfe, 0x49, 0xe3, 0xfe, 0xb4, 0xa8, 0xa8, 0x52, 0x9b,
+	0x9c, 0xfe, 0x5a, 0x24, 0x10, 0x52, 0xc0, 0x0a, 0x07, 0x05, 0x00, 0xa0, 0xa8, 0xa8, 0x52, 0xfe,
+	0xc5, 0x0c, 0x2b, 0x9d, 0x9c, 0xfe, 0x5a, 0x45, 0x08, 0x00, 0x05, 0xa4, 0x85, 0xfe, 0x83, 0x46,
+	0xfe, 0xd5, 0x8a, 0x2a, 0xfe, 0x8b, 0xa9, 0xfe, 0x20, 0xe2, 0x05, 0x6b, 0x07, 0xc0, 0x0c, 0x00,
+	0xc2, 0x07, 0xc1, 0xa6, 0x83, 0xfe, 0xac, 0x2a, 0x30, 0x32, 0xfe, 0x72, 0xe5, 0xfe, 0x10, 0x20,
+	0x07, 0xc0, 0x05, 0x6e, 0x62, 0x0c, 0x0e, 0x7d, 0xa8, 0x51, 0xfe, 0x9b, 0xe7, 0xab, 0x40, 0xc0,
+	0xfe, 0x9b, 0xe8, 0xfe, 0x29, 0x22, 0x98, 0xbe, 0xa9, 0x51, 0xfe, 0x93, 0xc7, 0x32, 0x2d, 0xfe,
+	0x8b, 0x87, 0x0d, 0x08, 0x66, 0x00, 0xc3, 0x03, 0xc0, 0xa3, 0x65, 0xfe, 0x6a, 0xe5, 0xfe, 0xcd,
+	0x6a, 0x2b, 0x9b, 0xae, 0xfe, 0x52, 0x04, 0x08, 0x07, 0xa7, 0x52, 0xfe, 0x83, 0x47, 0x32, 0x2d,
+	0xfe, 0x8b, 0xa8, 0xfe, 0x29, 0x02, 0x03, 0xc0, 0x15, 0xfe, 0x52, 0x24, 0xfe, 0xa4, 0x8a, 0xa8,
+	0x51, 0x2b, 0x9a, 0xbc, 0x2e, 0x32, 0x6f, 0xfe, 0x93, 0xc9, 0xfe, 0x28, 0xa1, 0x03, 0x00, 0xc6,
+	0x03, 0xa7, 0x62, 0xfe, 0xa3, 0xe7, 0xfe, 0xdd, 0x8b, 0x9d, 0x9b, 0xfe, 0x83, 0x27, 0xfe, 0x20,
+	0x81, 0x03, 0x00, 0xc0, 0x03, 0xc0, 0x6b, 0xc0, 0x00, 0xc0, 0x07, 0x00, 0xc1, 0x03, 0x07, 0x6e,
+	0xc0, 0x00, 0x7e, 0x7a, 0x27, 0xa8, 0x62, 0xfe, 0x9b, 0xa7, 0x32, 0x78, 0xfe, 0xac, 0x69, 0xfe,
+	0x39, 0x22, 0x98, 0x9e, 0x00, 0xc2, 0x0d, 0xfe, 0x9b, 0xc8, 0xac, 0x40, 0x46, 0xfe, 0x72, 0xc7,
+	0xfe, 0x18, 0x81, 0x00, 0x6b, 0xc0, 0x00, 0xc0, 0x18, 0xfe, 0x73, 0x07, 0xfe, 0xc5, 0x4b, 0xa2,
+	0x85, 0x76, 0x9c, 0xad, 0x46, 0x6d, 0xc1, 0x66, 0x7d, 0xa4, 0x64, 0xa2, 0x66, 0x28, 0xfe, 0x9c,
+	0x49, 0x35, 0x08, 0x00, 0x05, 0x00, 0x07, 0xc0, 0x12, 0x19, 0x29, 0x9e, 0x9c, 0xfe, 0x62, 0x86,
+	0xfe, 0x10, 0x61, 0x00, 0xc3, 0x7b, 0xa2, 0x85, 0x1f, 0xfe, 0xd5, 0x8b, 0x2a, 0xfe, 0x8b, 0x69,
+	0xfe, 0x18, 0x41, 0x46, 0x00, 0xc5, 0x0c, 0xc0, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xd0, 0x05, 0x08,
+	0xfe, 0x49, 0xe3, 0xfe, 0xb4, 0x89, 0xa8, 0x51, 0x0e, 0xfe, 0x5a, 0x24, 0xfe, 0x10, 0x40, 0x00,
+	0xc4, 0x03, 0xa9, 0x51, 0xfe, 0xbd, 0x0b, 0x29, 0x1d, 0xfe, 0x5a, 0x45, 0x03, 0x00, 0xc0, 0xa5,
+	0x74, 0xfe, 0x83, 0x46, 0xfe, 0xd5, 0x6b, 0x2a, 0xfe, 0x8b, 0x89, 0x3d, 0x05, 0x0c, 0x00, 0xc0,
+	0x05, 0xc0, 0x00, 0x05, 0xc1, 0x07, 0xc0, 0xa6, 0x73, 0xfe, 0xac, 0x4b, 0x2b, 0x5e, 0xfe, 0x6a,
+	0xe4, 0xfe, 0x10, 0x40, 0x07, 0xc0, 0x05, 0xc0, 0x00, 0x07, 0x0c, 0xa4, 0x74, 0xfe, 0x5a, 0x64,
+	0xfe, 0xbc, 0xc9, 0x3a, 0x9c, 0xac, 0xfe, 0x7b, 0x07, 0xfe, 0x18, 0xc1, 0x05, 0xa5, 0x74, 0xfe,
+	0x73, 0x06, 0x20, 0xa3, 0x75, 0x99, 0xad, 0xfe, 0x62, 0x64, 0xfe, 0x18, 0xa0, 0x08, 0x00, 0xc0,
+	0x6f, 0x07, 0x00, 0x03, 0x0b, 0xa9, 0x51, 0xfe, 0xa4, 0x48, 0xfe, 0xd5, 0xa9, 0x2b, 0xfe, 0x9b,
+	0xea, 0x0d, 0x00, 0xc0, 0xa7, 0x52, 0xfe, 0x83, 0x67, 0xfe, 0xd5, 0x4b, 0xc0, 0xfe, 0x8b, 0x88,
+	0xfe, 0x29, 0x02, 0x00, 0xc1, 0xa6, 0x64, 0xfe, 0x6a, 0xe7, 0xfe, 0xb5, 0x0a, 0xa5, 0x73, 0x2b,
+	0x26, 0x3a, 0x5a, 0xfe, 0x93, 0xc9, 0xfe, 0x28, 0xa1, 0x03, 0x00, 0xc6, 0x0a, 0x3c, 0xfe, 0xa3,
+	0xe8, 0xfe, 0xdd, 0x6b, 0x9d, 0x9a, 0xfe, 0x7b, 0x06, 0xfe, 0x20, 0x81, 0x00, 0xc2, 0x6e, 0x07,
+	0xc0, 0x00, 0xc1, 0x05, 0xc0, 0x08, 0x03, 0x0c, 0xc0, 0x6d, 0x05, 0x00, 0x7b, 0xc0, 0xa2, 0x95,
+	0xfe, 0x6a, 0x64, 0x19, 0x33, 0x99, 0xae, 0xfe, 0x39, 0x62, 0x05, 0x00, 0xc2, 0x0d, 0xfe, 0x9b,
+	0xc8, 0xac, 0x40, 0x46, 0xfe, 0x72, 0xc7, 0xfe, 0x18, 0x61, 0x00, 0x6b, 0xc0, 0x00, 0xc0, 0x3c,
+	0xfe, 0x9b, 0xe9, 0x32, 0x2b, 0xa1, 0x79, 0x63, 0xa2, 0x77, 0x3e, 0xc1, 0x5a, 0x7e, 0x65, 0x7a,
+	0x32, 0x9b, 0xad, 0xfe, 0x62, 0x65, 0xfe, 0x10, 0x41, 0x05, 0xc0, 0x00, 0x07, 0xc0, 0xfe, 0x31,
+	0x42, 0xfe, 0x9c, 0x48, 0x30, 0x2a, 0xfe, 0x62, 0x86, 0xfe, 0x10, 0x61, 0x00, 0xc3, 0xa0, 0x9a,
+	0xa2, 0x85, 0xfe, 0x9b, 0xea, 0xfe, 0xdd, 0x8c, 0x9d, 0xaa, 0xfe, 0x8b, 0x89, 0xfe, 0x18, 0x41,
+	0x07, 0xc0, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xd7, 0x05, 0xc0, 0x08, 0xfe, 0x49, 0xc4, 0xfe, 0xb4,
+	0x8a, 0x3a, 0x9b, 0xad, 0xfe, 0x5a, 0x05, 0xfe, 0x10, 0x40, 0x00, 0xc2, 0x05, 0x00, 0x7a, 0xa8,
+	0x62, 0xfe, 0xbd, 0x0b, 0x2b, 0x1d, 0xfe, 0x62, 0x45, 0x03, 0x07, 0x03, 0x27, 0xfe, 0x83, 0x26,
+	0xfe, 0xd5, 0x6b, 0x25, 0xfe, 0x93, 0x89, 0xfe, 0x30, 0xc2, 0x03, 0x08, 0xc0, 0x05, 0xc1, 0x00,
+	0x05, 0xc1, 0x0c, 0x07, 0x38, 0xfe, 0xa4, 0x4b, 0x37, 0x34, 0xfe, 0x72, 0xe4, 0x10, 0x07, 0x6b,
+	0x0c, 0x00, 0xc0, 0x03, 0x29, 0xfe, 0x52, 0x43, 0xfe, 0x9c, 0x28, 0x2b, 0x35, 0xfe, 0xac, 0x2a,
+	0xfe, 0x51, 0xe4, 0xfe, 0x08, 0x40, 0x56, 0x10, 0xfe, 0x49, 0xc3, 0xfe, 0xac, 0x4a, 0xa9, 0x41,
+	0x55, 0x16, 0xfe, 0x49, 0xe3, 0xfe, 0x18, 0x80, 0x00, 0x0c, 0x6b, 0x07, 0x00, 0x08, 0xa8, 0x51,
+	0xfe, 0x8b, 0x47, 0x2a, 0xa2, 0x74, 0x9d, 0x9c, 0xfe, 0x72, 0xc6, 0xfe, 0x18, 0x40, 0x00, 0xc0,
+	0x31, 0xfe, 0x7b, 0x66, 0x2b, 0x66, 0xfe, 0x8b, 0x88, 0xfe, 0x29, 0x02, 0x00, 0xc1, 0x08, 0x12,
+	0xfe, 0x83, 0xa7, 0xfe, 0xc5, 0x6b, 0x30, 0x76, 0x6e, 0x5b, 0xfe, 0x93, 0xc8, 0xfe, 0x20, 0xa1,
+	0x03, 0x00, 0xc6, 0x0a, 0xa7, 0x61, 0xfe, 0xa3, 0xe9, 0xfe, 0xdd, 0x8c, 0x9d, 0x8a, 0xfe, 0x83,
+	0x27, 0xfe, 0x20, 0x80, 0x03, 0x5e, 0x00, 0x05, 0xc6, 0xa3, 0x76, 0xa7, 0x53, 0x51, 0x9a, 0xac,
+	0x05, 0xc0, 0x6e, 0x05, 0x0e, 0x79, 0x10, 0xfe, 0x62, 0x44, 0xfe, 0xc5, 0x0a, 0x37, 0x99, 0xbe,
+	0xfe, 0x39, 0x62, 0x05, 0x00, 0xc2, 0xa9, 0x51, 0xfe, 0x9b, 0xc8, 0x35, 0x43, 0xfe, 0x72, 0xa6,
+	0x1f, 0x03, 0x5b, 0x0e, 0x00, 0x08, 0xfe, 0x5a, 0x03, 0xfe, 0xbc, 0xa9, 0x3a, 0x1b, 0xfe, 0x9c,
+	0x09, 0x9c, 0xbc, 0x7f, 0x3f, 0x6b, 0x6e, 0x5a, 0x0b, 0x3f, 0xa7, 0x53, 0xa6, 0x64, 0x5a, 0xfe,
+	0x8b, 0x67, 0xfe, 0x20, 0xc1, 0x00, 0x05, 0x00, 0xc1, 0xaa, 0x40, 0xfe, 0xa4, 0x28, 0x2e, 0x2a,
+	0xfe, 0x62, 0x86, 0x1c, 0x07, 0x00, 0xc2, 0x0a, 0xa2, 0x86, 0xfe, 0x9b, 0xe9, 0x37, 0x26, 0xfe,
+	0x93, 0x88, 0x15, 0x05, 0x00, 0xc5, 0x05, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xd0, 0x05, 0xc0, 0x7a,
+	0xfe, 0x49, 0xc4, 0x3c, 0xa8, 0x52, 0x9a, 0xbd, 0x14, 0xfe, 0x10, 0x40, 0x00, 0xc4, 0x03, 0xa8,
+	0x62, 0xfe, 0xc4, 0xeb, 0xa4, 0x63, 0x9d, 0x9c, 0xfe, 0x62, 0x26, 0xfe, 0x10, 0x01, 0x0a, 0x03,
+	0xa5, 0x64, 0xfe, 0x83, 0x46, 0xfe, 0xd5, 0x6b, 0x25, 0x3a, 0xfe, 0x41, 0x22, 0x9a, 0xac, 0x27,
+	0x59, 0xc0, 0x66, 0xc1, 0x15, 0xc0, 0x56, 0x07, 0xc0, 0xa7, 0x62, 0xfe, 0xa4, 0x2b, 0x37, 0x56,
+	0xfe, 0x83, 0x05, 0xfe, 0x28, 0xc1, 0x1f, 0x6f, 0xc0, 0x6d, 0xa1, 0x98, 0xa5, 0x54, 0xa9, 0x52,
+	0xfe, 0x9c, 0x49, 0x2a, 0x32, 0x9b, 0xbc, 0xfe, 0x7a, 0xc7, 0x3b, 0x05, 0x6b, 0x08, 0x34, 0xfe,
+	0x7b, 0x07, 0xfe, 0xc4, 0xeb, 0xa5, 0x54, 0x41, 0x95, 0xdf, 0xfe, 0x5a, 0x44, 0x96, 0xcf, 0x9c,
+	0xac, 0x56, 0xc0, 0x31, 0xa7, 0x63, 0xfe, 0x83, 0x67, 0x18, 0x39, 0x2f, 0xfe, 0x9c, 0x08, 0x21,
+	0x03, 0x5a, 0xc0, 0xa6, 0x63, 0xfe, 0x7b, 0x66, 0xfe, 0xd5, 0x6a, 0x26, 0xfe, 0x8b, 0x88, 0xfe,
+	0x21, 0x02, 0x00, 0xc2, 0x15, 0xfe, 0x49, 0xe3, 0xfe, 0xa4, 0x4a, 0x32, 0x78, 0x6e, 0xa0, 0x7a,
+	0xfe, 0x93, 0xc9, 0xfe, 0x20, 0xa1, 0x00, 0xc6, 0x05, 0x0c, 0xa6, 0x72, 0xfe, 0x9b, 0xe9, 0xfe,
+	0xd5, 0x8c, 0x9d, 0x99, 0xfe, 0x83, 0x47, 0xfe, 0x30, 0xe1, 0x9c, 0x9b, 0x5f, 0xc1, 0x15, 0xc2,
+	0x67, 0x08, 0xc0, 0xa8, 0x42, 0xfe, 0x7b, 0x89, 0x7e, 0x93, 0xff, 0x98, 0xbe, 0x24, 0x10, 0x08,
+	0x67, 0x1f, 0xa8, 0x41, 0xfe, 0x8b, 0xc7, 0xfe, 0xc5, 0x6b, 0x7f, 0xfe, 0x9c, 0x2a, 0xfe, 0x29,
+	0x02, 0x98, 0xbe, 0xc3, 0xa9, 0x50, 0xfe, 0x93, 0xc7, 0xfe, 0xdd, 0x6a, 0x42, 0xfe, 0x72, 0xc6,
+	0xfe, 0x18, 0x81, 0x07, 0xc0, 0x0e, 0x6c, 0xa5, 0x73, 0xfe, 0x8b, 0x86, 0xfe, 0xcd, 0x4a, 0x37,
+	0xfe, 0xa4, 0x09, 0xfe, 0x41, 0x83, 0x9c, 0xab, 0xc2, 0x5a, 0xc0, 0x6e, 0x7a, 0xac, 0x30, 0xfe,
+	0xbc, 0xcb, 0xa6, 0x53, 0x97, 0xce, 0xfe, 0x49, 0xa3, 0xfe, 0x10, 0x40, 0x00, 0xc1, 0x7a, 0x12,
+	0xfe, 0xa4, 0x29, 0x2e, 0x53, 0xfe, 0x62, 0x86, 0x1c, 0x07, 0xc0, 0x00, 0xc1, 0x7b, 0xa2, 0x85,
+	0xfe, 0x9b, 0xe8, 0x30, 0x26, 0xfe, 0x93, 0xa7, 0xfe, 0x20, 0xe0, 0x42, 0x52, 0x15, 0xc1, 0x18,
+	0x24, 0x59, 0xc0, 0x52, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xd1, 0x7e, 0x31, 0xfe, 0xb4, 0x89, 0xa8,
+	0x52, 0x9b, 0xad, 0x14, 0x10, 0x00, 0xc4, 0x03, 0xa8, 0x62, 0x18, 0xa5, 0x51, 0x9c, 0xad, 0xfe,
+	0x62, 0x25, 0xfe, 0x10, 0x20, 0x03, 0xc0, 0xa5, 0x64, 0xfe, 0x83, 0x46, 0xfe, 0xcd, 0x8a, 0x2b,
+	0x9a, 0xbe, 0x97, 0xcf, 0x41, 0xc2, 0x67, 0x7a, 0x6b, 0x5a, 0x41, 0xfe, 0x31, 0x43, 0x97, 0xcf,
+	0x00, 0xa8, 0x62, 0xfe, 0xa4, 0x4a, 0xa9, 0x60, 0xc0, 0x97, 0xce, 0xfe, 0x8b, 0x27, 0x25, 0x6e,
+	0x25, 0x69, 0xa3, 0x75, 0xa5, 0x65, 0xa5, 0x55, 0xa4, 0x64, 0x3e, 0x9c, 0xab, 0xfe, 0x8b, 0x68,
+	0xfe, 0x39, 0x22, 0x0b, 0x4a, 0xc0, 0x00, 0x0b, 0xa9, 0x52, 0x32, 0x2a, 0x37, 0x9d, 0xaa, 0x9c,
+	0x9b, 0x99, 0xbe, 0x9b, 0xab, 0x9c, 0xab, 0xa2, 0x76, 0xa5, 0x65, 0xa8, 0x53, 0xa5, 0x64, 0xa2,
+	0x87, 0x5b, 0x97, 0xce, 0xfe, 0x52, 0x03, 0xfe, 0x10, 0x60, 0x9d, 0x9b, 0xc1, 0xa6, 0x63, 0xfe,
+	0x7b, 0x66, 0x2d, 0x2b, 0xfe, 0x8b, 0x88, 0xfe, 0x20, 0xe2, 0x00, 0xc2, 0x05, 0xa4, 0x75, 0xfe,
+	0x62, 0x66, 0xfe, 0xb4, 0xab, 0xa7, 0x50, 0x6d, 0xa0, 0x8a, 0xfe, 0x93, 0xe9, 0xfe, 0x20, 0xa1,
+	0x00, 0xc6, 0x05, 0xc0, 0x39, 0xfe, 0x9b, 0xe9, 0xfe, 0xd5, 0x8b, 0x2b, 0x99, 0xbe, 0x97, 0xcf,
+	0x52, 0x5a, 0x6f, 0xc1, 0x79, 0x1c, 0xa0, 0x8a, 0x9b, 0xad, 0xfe, 0x20, 0xa2, 0x9c, 0xba, 0xfe,
+	0x5a, 0x46, 0xfe, 0xb4, 0xed, 0xa3, 0x74, 0x9b, 0xcb, 0x3f, 0x99, 0xce, 0x9c, 0x9a, 0x9d, 0xaa,
+	0x6e, 0xa7, 0x43, 0xa8, 0x41, 0xaa, 0x30, 0xa3, 0x77, 0x9d, 0xac, 0xfe, 0x72, 0xe7, 0x15, 0x00,
+	0xc3, 0xaa, 0x40, 0x02, 0xfe, 0xd5, 0x6a, 0x52, 0xfe, 0x6a, 0xc5, 0xfe, 0x18, 0x81, 0x00, 0x6b,
+	0x6e, 0x79, 0xfe, 0x41, 0x82, 0xfe, 0xb4, 0xc9, 0x30, 0x9d, 0xac, 0xfe, 0x6a, 0xa6, 0x0b, 0x00,
+	0x08, 0x00, 0xc3, 0x08, 0xaa, 0x40, 0xfe, 0x9c, 0x09, 0x37, 0x9c, 0xaa, 0xfe, 0x72, 0xe5, 0x2c,
+	0x9b, 0xac, 0xc2, 0xaa, 0x40, 0xfe, 0xa4, 0x29, 0xaa, 0x50, 0x53, 0xfe, 0x62, 0x86, 0xfe, 0x10,
+	0x61, 0x07, 0xc0, 0x69, 0xc1, 0x03, 0xa2, 0x86, 0xfe, 0x9c, 0x08, 0xfe, 0xd5, 0xaa, 0x61, 0x9b,
+	0xad, 0x97, 0xae, 0x57, 0x66, 0x66, 0x27, 0x20, 0x76, 0x6f, 0x27, 0x9c, 0xab, 0xfe, 0x31, 0x23,
+	0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xd1, 0x08, 0xfe, 0x49, 0xc4, 0xfe, 0xb4, 0x89, 0xa9, 0x41, 0x9a,
+	0xad, 0xfe, 0x5a, 0x24, 0xfe, 0x08, 0x40, 0x00, 0xc5, 0xa9, 0x61, 0xfe, 0xbd, 0x0b, 0xa5, 0x61,
+	0x16, 0x12, 0x0b, 0x00, 0x03, 0x2c, 0xfe, 0x83, 0x46, 0x30, 0x24, 0x26, 0x56, 0xc0, 0x6e, 0xc1,
+	0x76, 0x6b, 0x2f, 0x5a, 0x9c, 0x9c, 0xfe, 0x49, 0xe4, 0x17, 0x03, 0xa6, 0x73, 0xfe, 0xa4, 0x4a,
+	0xfe, 0xd5, 0x6a, 0x7a, 0x63, 0x56, 0x5e, 0x6d, 0x1e, 0x26, 0x69, 0x2e, 0x6b, 0x5a, 0x9b, 0xad,
+	0xfe, 0x83, 0x68, 0xfe, 0x41, 0x83, 0x96, 0xcf, 0x03, 0x00, 0xc1, 0x0a, 0xa3, 0x74, 0xaa, 0x41,
+	0xfe, 0x93, 0xc8, 0xa9, 0x52, 0xa4, 0x75, 0x32, 0x23, 0x55, 0x66, 0x14, 0x23, 0x3c, 0x56, 0x6f,
+	0x98, 0xcf, 0xfe, 0x62, 0x45, 0xfe, 0x18, 0xa0, 0x9c, 0x9c, 0x07, 0x69, 0x03, 0xa6, 0x53, 0xfe,
+	0x7b, 0x67, 0xfe, 0xcd, 0x6b, 0x66, 0xfe, 0x8b, 0xa8, 0xfe, 0x21, 0x02, 0x00, 0xc2, 0x05, 0x08,
+	0xa6, 0x64, 0xfe, 0x83, 0x48, 0xfe, 0xc5, 0x2b, 0xa4, 0x64, 0x3b, 0xfe, 0x8b, 0xea, 0xfe, 0x18,
+	0xa1, 0x05, 0xc0, 0x66, 0xc4, 0x05, 0x08, 0x37, 0xfe, 0xa3, 0xc8, 0x35, 0x68, 0x67, 0x28, 0x5a,
+	0x6e, 0x25, 0x2a, 0xc0, 0x23, 0xc0, 0x9f, 0x9b, 0x98, 0xbf, 0xfe, 0x39, 0x02, 0x9a, 0xbd, 0xfe,
+	0x62, 0x26, 0xfe, 0xb4, 0xad, 0xa6, 0x61, 0x7d, 0x52, 0x9c, 0xab, 0x55, 0x66, 0x6f, 0xa3, 0x66,
+	0xa2, 0x74, 0xa2, 0x67, 0x57, 0xfe, 0x93, 0xc8, 0xfe, 0x41, 0x63, 0x03, 0x00, 0xc3, 0xfe, 0x31,
+	0x62, 0xfe, 0x94, 0x08, 0xfe, 0xd5, 0x8b, 0x22, 0xfe, 0x6a, 0xc6, 0xfe, 0x10, 0x81, 0x00, 0x07,
+	0x6e, 0xa2, 0x85, 0xfe, 0x62, 0xa5, 0xfe, 0xc5, 0x4a, 0x3c, 0xfe, 0xac, 0x8b, 0xfe, 0x41, 0x84,
+	0xfe, 0x00, 0x00, 0xc0, 0x05, 0x07, 0xc0, 0x00, 0xc0, 0x07, 0x00, 0xa7, 0x52, 0xfe, 0x73, 0x26,
+	0x2f, 0x2d, 0xfe, 0x93, 0xe8, 0xfe, 0x39, 0x62, 0x08, 0x03, 0xc0, 0x08, 0xaa, 0x41, 0xfe, 0xa4,
+	0x2a, 0x34, 0x56, 0xfe, 0x62, 0x86, 0xfe, 0x10, 0x61, 0x00, 0xc3, 0x7f, 0x13, 0xfe, 0x94, 0x09,
+	0x3c, 0x61, 0x6b, 0x55, 0xc0, 0x2a, 0xc2, 0x25, 0x67, 0x6f, 0x99, 0xbe, 0xfe, 0x49, 0xc4, 0x03,
+	0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xd0, 0x08, 0xfe, 0x41, 0xe4, 0xfe, 0xac, 0xab, 0xa8, 0x52, 0x9a,
+	0xad, 0xfe, 0x52, 0x25, 0x0d, 0x00, 0xc0, 0x07, 0x00, 0xc0, 0x6e, 0xc0, 0xa7, 0x73, 0xfe, 0xbd,
+	0x2c, 0xa5, 0x63, 0x26, 0xfe, 0x5a, 0x65, 0x10, 0x00, 0x03, 0xa4, 0x75, 0xfe, 0x83, 0x47, 0x3e,
+	0x2b, 0x32, 0x3a, 0x59, 0xc0, 0x6e, 0x30, 0x2b, 0x3a, 0x01, 0x3e, 0x9c, 0x9c, 0xfe, 0x52, 0x04,
+	0xfe, 0x10, 0x41, 0x03, 0xa7, 0x52, 0xfe, 0xa4, 0x4b, 0xa9, 0x50, 0x3e, 0x39, 0x3e, 0x37, 0x30,
+	0x7a, 0xc1, 0x2b, 0x9b, 0xad, 0x9a, 0xac, 0xfe, 0x72, 0xc6, 0xfe, 0x31, 0x22, 0x10, 0x00, 0xc4,
+	0x03, 0xa3, 0x75, 0xa9, 0x41, 0xac, 0x31, 0xab, 0x41, 0xa8, 0x31, 0x7e, 0x30, 0x33, 0x2b, 0x37,
+	0x9f, 0x9b, 0x9b, 0xac, 0x97, 0xcf, 0xfe, 0x5a, 0x06, 0x94, 0xcf, 0x9d, 0x9a, 0x0c, 0xc0, 0x65,
+	0x03, 0xa6, 0x54, 0xfe, 0x73, 0x69, 0xfe, 0xc5, 0x8e, 0x7a, 0xfe, 0x83, 0xa9, 0xfe, 0x21, 0x02,
+	0x05, 0x66, 0xc1, 0x05, 0xc0, 0x7e, 0xaa, 0x51, 0xfe, 0x93, 0xe9, 0xfe, 0xcd, 0x8d, 0x6f, 0xfe,
+	0x8b, 0xeb, 0xfe, 0x20, 0xa2, 0x05, 0xc0, 0x00, 0xc5, 0x03, 0xa7, 0x73, 0xfe, 0xa3, 0xca, 0xfe,
+	0xe5, 0x8c, 0x58, 0x3a, 0x01, 0x32, 0x33, 0x66, 0x33, 0x5a, 0x33, 0xc0, 0x3e, 0xfe, 0xac, 0x6b,
+	0xfe, 0x39, 0x22, 0x98, 0xbe, 0xa5, 0x65, 0xfe, 0x6a, 0xa6, 0xfe, 0xa4, 0x29, 0xa7, 0x52, 0x32,
+	0x33, 0xc1, 0x67, 0x3e, 0x37, 0x9d, 0x8b, 0xfe, 0x8b, 0xc8, 0x22, 0x13, 0x00, 0xc0, 0x05, 0x00,
+	0xc1, 0xaa, 0x31, 0xfe, 0x94, 0x0a, 0xfe, 0xd5, 0x8d, 0x42, 0xfe, 0x62, 0xc7, 0xfe, 0x10, 0x81,
+	0x9d, 0x9a, 0x00, 0xc0, 0xa7, 0x53, 0xfe, 0x8b, 0xca, 0xfe, 0xc5, 0x6c, 0xa2, 0x77, 0xfe, 0x83,
+	0x8a, 0xfe, 0x20, 0xa2, 0x00, 0x05, 0x6e, 0x63, 0xc0, 0x00, 0xc2, 0xa3, 0x75, 0xfe, 0x52, 0x04,
+	0xfe, 0xbc, 0xeb, 0xa7, 0x43, 0xfe, 0xac, 0xac, 0xfe, 0x5a, 0x66, 0xfe, 0x10, 0x60, 0x00, 0xc1,
+	0xfe, 0x31, 0x83, 0xfe, 0x9c, 0x2b, 0xab, 0x41, 0x51, 0xfe, 0x5a, 0x86, 0x21, 0x00, 0xc3, 0x7b,
+	0xa3, 0x75, 0xfe, 0x93, 0xea, 0xfe, 0xcd, 0xad, 0x76, 0x75, 0x69, 0xc0, 0x6e, 0x6b, 0xc0, 0x3a,
+	0x35, 0x34, 0xa1, 0x79, 0x99, 0xbd, 0xfe, 0x51, 0xc4, 0xfe, 0x08, 0x00, 0x5a, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xd0, 0x6e, 0xaa, 0x42, 0xfe, 0x83, 0x69, 0xa6, 0x53, 0x9d, 0x9b, 0xfe, 0x39, 0xa5, 0x95,
+	0xdf, 0x00, 0x6b, 0x7a, 0x00, 0xc0, 0x05, 0xc0, 0x3b, 0xfe, 0x8b, 0xa9, 0x20, 0x9d, 0x9c, 0xfe,
+	0x41, 0xc5, 0x14, 0x07, 0xc0, 0xa3, 0x75, 0xfe, 0x62, 0x86, 0xfe, 0x9c, 0x29, 0x20, 0xa0, 0x9a,
+	0x5a, 0x69, 0xc0, 0x6e, 0x59, 0x1d, 0x7e, 0x27, 0x24, 0x42, 0xfe, 0x39, 0xa4, 0xfe, 0x08, 0x41,
+	0x07, 0x38, 0xfe, 0x7b, 0x69, 0x24, 0x6e, 0x24, 0x29, 0x22, 0x25, 0x20, 0x66, 0x41, 0x9b, 0xac,
+	0x99, 0xbd, 0x99, 0xbd, 0x9b, 0xab, 0x08, 0x5b, 0x07, 0xc0, 0x00, 0xc3, 0x05, 0xa1, 0x97, 0xa5,
+	0x64, 0xa8, 0x43, 0xab, 0x30, 0xa9, 0x42, 0xa3, 0x86, 0xa2, 0x76, 0xc0, 0x9d, 0x9b, 0x97, 0xbe,
+	0x95, 0xdf, 0x98, 0xce, 0x1f, 0x41, 0x5e, 0xc0, 0x0c, 0x75, 0xc0, 0xa5, 0x55, 0xfe, 0x5a, 0x87,
+	0xfe, 0x94, 0x2b, 0x75, 0x96, 0xbf, 0xfe, 0x18, 0xe2, 0x0c, 0x07, 0xc0, 0x00, 0x05, 0xc0, 0x08,
+	0xa2, 0x86, 0xfe, 0x4a, 0x04, 0xfe, 0x93, 0xc9, 0x24, 0x97, 0xbf, 0x30, 0x0c, 0xc0, 0x00, 0xc4,
+	0x05, 0x0c, 0xa4, 0x85, 0xfe, 0x7a, 0xe8, 0x31, 0x68, 0x31, 0x57, 0x29, 0x22, 0x76, 0xc0, 0x66,
+	0x66, 0x1b, 0x1f, 0x9b, 0x9b, 0xfe, 0x21, 0x02, 0x9a, 0xbc, 0xc0, 0xa4, 0x75, 0xa5, 0x74, 0xa9,
+	0x42, 0xa9, 0x32, 0xa7, 0x53, 0xa4, 0x64, 0x7f, 0x56, 0x9c, 0xac, 0x9b, 0xbb, 0x96, 0xbe, 0xfe,
+	0x31, 0x42, 0x15, 0x9d, 0xab, 0x5a, 0xc0, 0x05, 0xc0, 0x00, 0x0c, 0xa7, 0x53, 0xfe, 0x72, 0xe7,
+	0xa9, 0x52, 0x46, 0xfe, 0x4a, 0x26, 0xfe, 0x08, 0x81, 0x05, 0x00, 0x7f, 0xa7, 0x63, 0xfe, 0x7b,
+	0x49, 0xa7, 0x51, 0x52, 0xfe, 0x4a, 0x05, 0x14, 0x05, 0xc1, 0x67, 0xc0, 0x00, 0xc2, 0x08, 0xa8,
+	0x53, 0xfe, 0x83, 0x49, 0xa7, 0x53, 0x9d, 0x9a, 0x95, 0xbf, 0xfe, 0x10, 0x81, 0x00, 0xc0, 0x05,
+	0xa8, 0x43, 0xfe, 0x73, 0x28, 0x2e, 0x55, 0xfe, 0x4a, 0x05, 0xfe, 0x08, 0x61, 0x00, 0x05, 0xc0,
+	0x00, 0x07, 0x6b, 0xa2, 0x85, 0xfe, 0x6a, 0xe8, 0x1d, 0x2e, 0x66, 0x22, 0x20, 0x24, 0xc0, 0x1d,
+	0xc0, 0x6e, 0x6b, 0x6b, 0x9a, 0xad, 0xfe, 0x39, 0x84, 0x08, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xcf,
+	0x05, 0xc0, 0x1c, 0xa5, 0x64, 0x7e, 0x05, 0x21, 0x9d, 0x9a, 0x00, 0xc4, 0x05, 0x7f, 0xa6, 0x63,
+	0x0d, 0x05, 0x9c, 0x9c, 0x07, 0xc0, 0x0c, 0x14, 0xa4, 0x65, 0xa4, 0x74, 0x0d, 0x0f, 0xc0, 0x69,
+	0x05, 0x6e, 0xc2, 0x05, 0x0a, 0x02, 0x21, 0x0c, 0x07, 0x14, 0x09, 0x0a, 0x12, 0x0a, 0xc2, 0x0d,
+	0x05, 0x3d, 0x51, 0x1c, 0x51, 0x00, 0xc1, 0x07, 0x00, 0xc5, 0x6e, 0xc0, 0x7e, 0x29, 0x12, 0xa4,
+	0x76, 0xa3, 0x66, 0x51, 0x9d, 0x9a, 0x9b, 0xab, 0x0d, 0x05, 0x00, 0x05, 0xc2, 0x00, 0x03, 0x14,
+	0x35, 0xa3, 0x85, 0xc0, 0x36, 0x19, 0x07, 0xc1, 0x00, 0xc0, 0x05, 0xc1, 0xa3, 0x75, 0xa4, 0x75,
+	0x0d, 0x42, 0x14, 0x00, 0xc6, 0x05, 0x0c, 0x08, 0x3d, 0x12, 0x59, 0x0a, 0x5b, 0x0a, 0xc1, 0x66,
+	0x7a, 0x66, 0xc0, 0x05, 0x3d, 0x9c, 0x9a, 0x56, 0x66, 0x00, 0x7e, 0x1c, 0x36, 0x26, 0xa3, 0x65,
+	0x7f, 0x02, 0x26, 0x9c, 0xab, 0x15, 0x42, 0x00, 0xc6, 0x14, 0xa5, 0x73, 0xa2, 0x87, 0x0d, 0x29,
+	0x05, 0xc0, 0x00, 0xc0, 0x1c, 0xa5, 0x64, 0xa2, 0x76, 0x3e, 0x1c, 0x00, 0x6e, 0xc0, 0x00, 0xc6,
+	0x17, 0xa5, 0x64, 0x0d, 0xc0, 0x9d, 0x8a, 0x08, 0x56, 0xc0, 0x05, 0xa2, 0x76, 0x3d, 0x0d, 0xc0,
+	0x29, 0x05, 0x00, 0xc3, 0x6b, 0x79, 0xa7, 0x53, 0xa3, 0x65, 0x0d, 0x6b, 0x59, 0xc6, 0x6e, 0x52,
+	0x19, 0x9d, 0xaa, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd9, 0x08, 0x6e, 0x08, 0x05, 0x00, 0xca, 0x05,
+	0xc0, 0x00, 0xd9, 0x05, 0x00, 0xd1, 0x05, 0x08, 0xc1, 0x05, 0x00, 0xcb, 0x05, 0xc0, 0x00, 0xc4,
+	0x05, 0xc0, 0x00, 0xd7, 0x05, 0x00, 0xc7, 0x05, 0xc0, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xc8,
+};
@@ -0,0 +1,2253 @@
+// 'mercy', 480x320px, Q565 compressed (35983 bytes, raw 307200)
+// Generated by tools/compress_splash.py - do not edit
+const uint8_t splash_mercy_q565[] PROGMEM = {
+	0x51, 0x35, 0x36, 0x35, 0xe0, 0x01, 0x40, 0x01, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xdd, 0xa2, 0x67, 0xa2, 0x77, 0xa2, 0x77, 0xa3, 0x77, 0xa3,
+	0x66, 0xa2, 0x77, 0xa3, 0x67, 0xa2, 0x77, 0xa3, 0x76, 0x6f, 0xa2, 0x87, 0xc0, 0x6e, 0xc3, 0x6e,
+	0x9d, 0xaa, 0x66, 0x51, 0x51, 0x40, 0x09, 0x35, 0x1c, 0x39, 0x51, 0x11, 0x61, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xc8, 0x25, 0xa5, 0x56, 0x09, 0xa6, 0x55, 0x01, 0xa6, 0x55, 0xa5, 0x65,
+	0xa4, 0x67, 0xa5, 0x55, 0xa3, 0x76, 0xa2, 0x77, 0xa3, 0x67, 0xa2, 0x76, 0x7f, 0xc0, 0x6f, 0x7e,
+	0xc7, 0x66, 0x01, 0x69, 0x35, 0x56, 0x19, 0x51, 0x51, 0x51, 0x9c, 0xaa, 0x9c, 0xaa, 0x9c, 0xaa,
+	0x9b, 0xaa, 0x3c, 0x9b, 0xaa, 0x9a, 0xbb, 0x9b, 0xbb, 0x9b, 0xba, 0x9d, 0x99, 0x00, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xf8, 0xa2, 0x68, 0xa7, 0x44, 0xa7, 0x54, 0xa8, 0x44, 0xa9, 0x34, 0x0d,
+	0xa7, 0x44, 0xa5, 0x66, 0xa3, 0x76, 0x04, 0xa2, 0x66, 0x7f, 0x6e, 0xc0, 0x7a, 0xc0, 0x22, 0x1d,
+	0xcb, 0x66, 0x1d, 0xc3, 0x18, 0xc0, 0x1d, 0x18, 0x69, 0xc0, 0x56, 0xc0, 0x01, 0x51, 0x9d, 0xa9,
+	0x9c, 0xab, 0x35, 0x9a, 0xbb, 0x99, 0xcc, 0x98, 0xcc, 0x99, 0xbb, 0x99, 0xcb, 0x9a, 0xbb, 0x00,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xef, 0xa7, 0x25, 0xa9, 0x43, 0xaa, 0x43, 0xaa, 0x33, 0xa9,
+	0x43, 0x05, 0xa5, 0x65, 0x0e, 0x7f, 0x7e, 0xc2, 0x1d, 0xcb, 0x18, 0x11, 0xc8, 0x0e, 0xc3, 0x09,
+	0xc0, 0x0e, 0x09, 0x0e, 0xc0, 0x09, 0x0e, 0xc1, 0x09, 0xc0, 0x04, 0x35, 0x0d, 0x9c, 0x9a, 0x99,
+	0xcc, 0x98, 0xcc, 0x97, 0xcc, 0x96, 0xee, 0x98, 0xcc, 0x9a, 0xba, 0x00, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xe6, 0x02, 0xab, 0x42, 0xac, 0x22, 0x21, 0xa9, 0x43, 0x35, 0xa3, 0x76, 0xa2, 0x67,
+	0x25, 0xc2, 0x1d, 0xd5, 0x11, 0xc6, 0x0e, 0xc3, 0x09, 0xcd, 0x56, 0x2d, 0x9d, 0x99, 0x9a, 0xbb,
+	0x97, 0xdd, 0x96, 0xdd, 0x31, 0x08, 0x05, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xde, 0xa3,
+	0x57, 0xac, 0x22, 0xae, 0x11, 0xad, 0x21, 0xaa, 0x33, 0xa6, 0x64, 0xa3, 0x67, 0x25, 0x6b, 0x25,
+	0xc0, 0x1d, 0xd3, 0x66, 0x11, 0xc1, 0x18, 0xc0, 0x11, 0xc3, 0x5a, 0xc4, 0x09, 0x0e, 0x09, 0xc9,
+	0x04, 0xc1, 0x3d, 0xc0, 0x04, 0x3d, 0x04, 0xc0, 0x3a, 0x35, 0x0d, 0x9a, 0xab, 0x96, 0xee, 0x95,
+	0xdd, 0x94, 0xee, 0x96, 0xed, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd8, 0xa6, 0x26, 0xae,
+	0x30, 0xb0, 0x00, 0xad, 0x21, 0x35, 0x1d, 0x7e, 0x2c, 0x25, 0xc0, 0x1d, 0xd4, 0x22, 0xc0, 0x1d,
+	0xce, 0x18, 0x11, 0xc0, 0x5a, 0xc1, 0x66, 0xc9, 0x04, 0xc0, 0x3d, 0x5a, 0xc6, 0x35, 0x26, 0x9b,
+	0xbb, 0x98, 0xbc, 0x38, 0x31, 0x95, 0xed, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd2, 0xa6,
+	0x26, 0xfe, 0x52, 0xcb, 0xfe, 0x9c, 0xf3, 0xad, 0x12, 0x09, 0x25, 0x2c, 0x25, 0xc0, 0x1d, 0xc2,
+	0x25, 0x22, 0x1d, 0xc8, 0x22, 0x25, 0xc0, 0x22, 0x1d, 0xc0, 0x11, 0x09, 0xc0, 0x55, 0x35, 0xc0,
+	0x65, 0x5a, 0xc0, 0x66, 0x26, 0x2d, 0x21, 0x55, 0xc0, 0x21, 0x26, 0x21, 0xc3, 0x26, 0xc0, 0x7b,
+	0x35, 0x3a, 0x04, 0x09, 0xc1, 0x0e, 0x09, 0xc3, 0x04, 0x3d, 0x04, 0xc0, 0x3d, 0xc0, 0x3a, 0xc2,
+	0x35, 0xc5, 0x30, 0x0d, 0x98, 0xcc, 0x94, 0xef, 0x93, 0xee, 0x93, 0xfe, 0x00, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xcc, 0xa2, 0x68, 0xfe, 0x4a, 0x8b, 0xfe, 0x94, 0xf3, 0xad, 0x22, 0x09, 0x2c,
+	0xc1, 0x25, 0x22, 0x1d, 0xc0, 0x25, 0xc2, 0x22, 0x1d, 0xc2, 0x22, 0x25, 0xc1, 0x1d, 0xc0, 0x09,
+	0x04, 0x35, 0x30, 0x21, 0x26, 0x2d, 0x30, 0x6f, 0x09, 0xc0, 0x7f, 0x1d, 0x2c, 0xc0, 0x6e, 0xca,
+	0x2c, 0x5a, 0x1d, 0x18, 0x09, 0x04, 0x35, 0x2d, 0x21, 0x56, 0xc1, 0x21, 0x26, 0x35, 0x3a, 0x09,
+	0xc2, 0x04, 0x69, 0x3a, 0xc3, 0x35, 0xc8, 0x30, 0x0d, 0x98, 0xbc, 0x93, 0xff, 0xfe, 0x42, 0x29,
+	0x94, 0xed, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xc7, 0xfe, 0x29, 0xc8, 0xfe, 0x84, 0x51,
+	0xb0, 0x10, 0x09, 0x25, 0x6b, 0xc0, 0x25, 0x1d, 0x25, 0xc5, 0x1d, 0xc1, 0x25, 0xc1, 0x1d, 0x65,
+	0x09, 0x35, 0x56, 0x21, 0x30, 0x3c, 0x09, 0x1d, 0x2c, 0x31, 0xc2, 0x1d, 0x18, 0x04, 0x30, 0x51,
+	0x51, 0x39, 0x52, 0x50, 0xc0, 0x52, 0x55, 0x7a, 0x6e, 0x38, 0x04, 0xa2, 0x77, 0xc0, 0xa3, 0x66,
+	0x39, 0xa2, 0x77, 0x1c, 0x30, 0xa2, 0x77, 0xa2, 0x77, 0x1d, 0xa2, 0x77, 0xc2, 0x66, 0x1d, 0x09,
+	0x51, 0x21, 0x0d, 0xc0, 0x12, 0x21, 0x35, 0x6e, 0x04, 0x09, 0x04, 0x3a, 0x35, 0xc7, 0x30, 0xc1,
+	0x35, 0xc0, 0x26, 0x05, 0x96, 0xdd, 0x92, 0xff, 0xfe, 0x29, 0x86, 0x96, 0xdd, 0x00, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xc1, 0xa4, 0x47, 0xfe, 0x63, 0x4d, 0x3d, 0xac, 0x22, 0x25, 0x2c, 0x31,
+	0x25, 0x66, 0x25, 0xc4, 0x1d, 0xc0, 0x25, 0xc2, 0x1d, 0x09, 0x3a, 0x2d, 0xc0, 0x35, 0x09, 0x1d,
+	0x31, 0xc1, 0x2c, 0x09, 0x9c, 0xaa, 0x34, 0x9c, 0x9a, 0x9a, 0xbb, 0x9b, 0xbb, 0x9b, 0xab, 0x9b,
+	0xaa, 0x9c, 0xaa, 0x9d, 0x9a, 0x41, 0x41, 0x66, 0xc0, 0x7e, 0x6f, 0x7a, 0x1e, 0x7e, 0x6b, 0xc1,
+	0x35, 0xc1, 0x5a, 0xc0, 0x7e, 0xc0, 0x7f, 0xa2, 0x77, 0xa3, 0x66, 0xa3, 0x76, 0xa4, 0x76, 0xa5,
+	0x55, 0xa5, 0x66, 0xa4, 0x76, 0xa5, 0x55, 0xa4, 0x67, 0xa4, 0x65, 0x2c, 0x31, 0xc1, 0x51, 0x04,
+	0x9d, 0x99, 0x51, 0xc1, 0x21, 0xa2, 0x77, 0x6e, 0x7a, 0x3a, 0x35, 0xc5, 0x66, 0xc1, 0x59, 0x30,
+	0xc1, 0x21, 0x9a, 0xbb, 0x2a, 0xfe, 0x4a, 0xaa, 0xfe, 0x10, 0xc3, 0x00, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfb, 0xac, 0x03, 0x20, 0x08, 0x18, 0x2c, 0x31, 0x65, 0xc7, 0x1d, 0x25, 0x2c, 0x25, 0x22,
+	0x0e, 0x35, 0x56, 0xc0, 0x04, 0x1d, 0x31, 0xc1, 0x9d, 0x9a, 0x21, 0x9a, 0xbb, 0x98, 0xcd, 0x98,
+	0xbc, 0x98, 0xcc, 0x98, 0xbd, 0x9a, 0x8b, 0x9d, 0xba, 0x6e, 0xa3, 0x87, 0x19, 0xa3, 0x76, 0xa2,
+	0x77, 0x11, 0x6f, 0x7e, 0x6e, 0x6b, 0x7a, 0xc0, 0x39, 0xc1, 0x01, 0x39, 0xc0, 0x01, 0xc0, 0x6b,
+	0xc0, 0x6e, 0xc4, 0x08, 0x39, 0x31, 0x25, 0x41, 0x51, 0x32, 0x3a, 0xa4, 0x66, 0xa5, 0x76, 0x20,
+	0xa8, 0x33, 0xa6, 0x66, 0x21, 0x18, 0xa3, 0x66, 0xc1, 0x18, 0x9d, 0x99, 0x9c, 0xab, 0x05, 0x7e,
+	0x21, 0x35, 0x6e, 0xc0, 0x35, 0xc0, 0x30, 0xc4, 0x5a, 0x69, 0xc3, 0x05, 0x97, 0xcd, 0xfe, 0x6b,
+	0x6e, 0xfe, 0x29, 0x65, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf7, 0xfe, 0x42, 0x4a, 0xfe, 0xa5,
+	0x55, 0x30, 0xa6, 0x54, 0x6b, 0xc0, 0x25, 0xc8, 0x2c, 0x25, 0x56, 0x04, 0x30, 0x5a, 0xa2, 0x77,
+	0x1d, 0x31, 0xc0, 0x1d, 0x30, 0x99, 0xbb, 0x96, 0xde, 0x96, 0xcd, 0x95, 0xde, 0x12, 0x9b, 0xdb,
+	0x12, 0xa6, 0x64, 0xa3, 0x87, 0xa3, 0x65, 0x11, 0x6e, 0x6b, 0xc6, 0x7a, 0x6e, 0xc2, 0x6f, 0x39,
+	0x09, 0xa7, 0x54, 0xc0, 0x31, 0x39, 0xc2, 0x6e, 0xc0, 0x7b, 0xc1, 0x0d, 0xc0, 0x6e, 0x1c, 0x21,
+	0xc1, 0x1c, 0x0d, 0x39, 0x25, 0x09, 0x9d, 0x9a, 0xa2, 0x76, 0x31, 0xa8, 0x53, 0xa9, 0x44, 0xa9,
+	0x33, 0xa7, 0x54, 0x2c, 0x6e, 0xc0, 0x18, 0x9c, 0xaa, 0x9d, 0x99, 0x05, 0x0d, 0xa2, 0x77, 0x35,
+	0xc1, 0x30, 0xc2, 0x26, 0xc1, 0x21, 0xc1, 0x26, 0xc0, 0x52, 0x99, 0xbb, 0x3d, 0xfe, 0x39, 0xe7,
+	0x93, 0xff, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf2, 0x25, 0x0c, 0xad, 0x11, 0x31, 0xc0, 0x65,
+	0xc8, 0x31, 0x25, 0x18, 0x40, 0x26, 0x30, 0x09, 0x31, 0xc0, 0x2c, 0x30, 0x97, 0xcc, 0x95, 0xde,
+	0x93, 0xef, 0xfe, 0x01, 0x06, 0xfe, 0x00, 0x03, 0xa7, 0x13, 0x0a, 0xa4, 0x76, 0x02, 0x6b, 0x7a,
+	0x09, 0xc4, 0x7e, 0xc1, 0x1d, 0xc1, 0x25, 0xc3, 0x6f, 0xc0, 0x9b, 0xbb, 0xfe, 0x8c, 0x92, 0x05,
+	0x94, 0xee, 0xfe, 0x42, 0xab, 0x3e, 0x39, 0xc0, 0x3e, 0x6b, 0x08, 0xc1, 0x6e, 0xc3, 0x6e, 0x7b,
+	0xc0, 0x6e, 0xc1, 0x6e, 0xc0, 0x21, 0x1c, 0x08, 0x9d, 0x99, 0x9c, 0x9a, 0x2d, 0x09, 0x1c, 0xaa,
+	0x32, 0xaa, 0x33, 0xa9, 0x43, 0x2c, 0x6e, 0xc0, 0x9c, 0xaa, 0x19, 0x50, 0x6b, 0xa3, 0x76, 0x30,
+	0x35, 0x30, 0x59, 0xc3, 0x21, 0xc4, 0x66, 0x9b, 0xaa, 0x93, 0xef, 0xfe, 0x42, 0x49, 0xfe, 0x08,
+	0x61, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xee, 0xfe, 0x63, 0x4d, 0xfe, 0xc6, 0x38, 0x18, 0x2c,
+	0x6e, 0x65, 0xc7, 0x31, 0xc0, 0x51, 0x9d, 0xa9, 0x42, 0x35, 0x18, 0x31, 0xc0, 0x09, 0x98, 0xcc,
+	0x93, 0xef, 0x2a, 0x06, 0x99, 0xfc, 0xa8, 0x04, 0xa7, 0x63, 0xa3, 0x77, 0x02, 0x66, 0xc0, 0x3a,
+	0xc0, 0x3d, 0xc1, 0x6f, 0xc2, 0x11, 0xc1, 0x6f, 0xc0, 0x7e, 0xc2, 0x2a, 0xc0, 0x34, 0x25, 0x1d,
+	0xfe, 0xb5, 0xd7, 0x30, 0x21, 0x93, 0xef, 0x0d, 0x25, 0xa2, 0x77, 0x08, 0xc2, 0x0d, 0xc3, 0x6e,
+	0xc0, 0x7b, 0xc1, 0x6e, 0xc3, 0x6e, 0x7b, 0xc1, 0x26, 0x21, 0x08, 0x2a, 0x9c, 0xab, 0x9d, 0x9a,
+	0x09, 0x21, 0xab, 0x32, 0xab, 0x33, 0xa9, 0x33, 0x31, 0xc0, 0x15, 0x9a, 0xcb, 0x9d, 0x99, 0x05,
+	0x1c, 0xa2, 0x77, 0xc0, 0x59, 0x66, 0xc8, 0x1c, 0x9c, 0x9a, 0x93, 0xff, 0xfe, 0x4a, 0x6a, 0xfe,
+	0x08, 0x62, 0x9d, 0xa9, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xe9, 0x6b, 0x01, 0xfe, 0xc6, 0x38, 0xac,
+	0x22, 0x2c, 0x6e, 0x65, 0xc6, 0x2c, 0x31, 0x1d, 0x51, 0x26, 0x30, 0x18, 0x31, 0xc0, 0x9b, 0xbb,
+	0x95, 0xdd, 0x92, 0xef, 0xfe, 0x29, 0xe8, 0x07, 0x2b, 0xaa, 0x22, 0x35, 0x3d, 0x3a, 0x35, 0xc3,
+	0x3a, 0x3d, 0xc1, 0x6f, 0xc0, 0x7e, 0xc5, 0x09, 0xc1, 0x0c, 0x11, 0xc0, 0x6f, 0x7e, 0xc0, 0xfe,
+	0xbd, 0xf8, 0xac, 0x21, 0x21, 0x56, 0x94, 0xee, 0x95, 0xde, 0x9c, 0xaa, 0x11, 0xa4, 0x66, 0xc3,
+	0x6e, 0xc0, 0x08, 0x0d, 0xc0, 0x6e, 0x7a, 0x6b, 0x6e, 0xc3, 0x6e, 0xc1, 0x7b, 0xc0, 0x35, 0xc1,
+	0x30, 0x21, 0x15, 0x3e, 0x25, 0x3a, 0x32, 0xa6, 0x65, 0xac, 0x31, 0xac, 0x22, 0x04, 0xa5, 0x55,
+	0xc0, 0x9c, 0xab, 0x19, 0x9d, 0xa9, 0x6f, 0xa3, 0x76, 0x7f, 0x59, 0x21, 0xc5, 0x66, 0x21, 0x1c,
+	0xc0, 0x9c, 0x9a, 0x94, 0xee, 0xfe, 0x4a, 0x6a, 0xfe, 0x08, 0x61, 0x9d, 0xaa, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xe6, 0xfe, 0x5b, 0x2d, 0xfe, 0xc6, 0x38, 0xab, 0x33, 0x2c, 0x6e, 0x65, 0xc6, 0x31,
+	0x2c, 0x50, 0x30, 0x21, 0x09, 0x31, 0xc0, 0x04, 0x95, 0xdd, 0x2e, 0xfe, 0x01, 0x46, 0x00, 0x06,
+	0xa9, 0x53, 0xa2, 0x77, 0xc0, 0x65, 0x5a, 0xc0, 0x29, 0x6b, 0x35, 0xc1, 0x3d, 0xc0, 0x6f, 0xc1,
+	0x3d, 0x3a, 0x35, 0xc1, 0x09, 0xa2, 0x77, 0x39, 0x0d, 0xa2, 0x77, 0xa2, 0x77, 0xa2, 0x77, 0x7e,
+	0x6f, 0x6e, 0x7a, 0x41, 0xa8, 0x54, 0xaf, 0x10, 0x6e, 0x9d, 0xaa, 0x51, 0x94, 0xef, 0x96, 0xcd,
+	0x66, 0x97, 0xcc, 0x12, 0x25, 0x1d, 0xc2, 0x66, 0x09, 0x66, 0x35, 0x55, 0x66, 0x66, 0x55, 0x12,
+	0x1c, 0xc0, 0x21, 0xc0, 0x30, 0xc1, 0x35, 0xc3, 0x7e, 0xc0, 0x35, 0x26, 0x15, 0x08, 0x2a, 0x9d,
+	0x9a, 0x32, 0xa4, 0x76, 0xad, 0x21, 0xad, 0x21, 0xab, 0x32, 0x31, 0xc0, 0x9b, 0xbb, 0x05, 0x61,
+	0xa3, 0x66, 0xa2, 0x77, 0x6e, 0x21, 0xc4, 0x66, 0xc2, 0x5a, 0x9c, 0xaa, 0x93, 0xef, 0xfe, 0x42,
+	0x29, 0x91, 0xff, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xe2, 0xfe, 0x4a, 0xab, 0x1d, 0xac, 0x32,
+	0xa2, 0x77, 0x6e, 0x65, 0xc5, 0x2c, 0x31, 0x25, 0x9c, 0xaa, 0x21, 0xa2, 0x77, 0x2c, 0x31, 0x18,
+	0x96, 0xcd, 0x02, 0xfe, 0x09, 0x47, 0x00, 0x06, 0xa9, 0x53, 0xa2, 0x77, 0x29, 0x21, 0xc1, 0x6e,
+	0xc0, 0x29, 0x6b, 0x35, 0x6e, 0x7a, 0xc0, 0x35, 0x29, 0x21, 0xc0, 0x3d, 0xa4, 0x66, 0xa4, 0x66,
+	0xa4, 0x66, 0xa3, 0x66, 0x7f, 0x7e, 0x1d, 0x51, 0x35, 0x9c, 0xba, 0x9d, 0x99, 0x9d, 0xa9, 0x9d,
+	0x9a, 0x9d, 0xa9, 0x51, 0x9c, 0xab, 0xa3, 0x66, 0xfe, 0xb5, 0xd7, 0xab, 0x32, 0x6e, 0x9d, 0xaa,
+	0x51, 0x94, 0xef, 0x96, 0xcd, 0xc0, 0x97, 0xcd, 0x08, 0x11, 0x9a, 0xbb, 0xa3, 0x67, 0xa2, 0x77,
+	0xa3, 0x76, 0xa3, 0x67, 0xa3, 0x76, 0x01, 0xa3, 0x67, 0xa3, 0x76, 0xa2, 0x77, 0x6f, 0x7e, 0x1d,
+	0x66, 0x55, 0x51, 0x55, 0x21, 0xc1, 0x7f, 0x35, 0xc2, 0x3d, 0xc0, 0x6b, 0x09, 0xc0, 0x3d, 0x51,
+	0x12, 0x3e, 0x52, 0x9d, 0xa9, 0x32, 0xa5, 0x65, 0x25, 0xaf, 0x10, 0xaa, 0x33, 0xa2, 0x77, 0x1d,
+	0x9a, 0xbb, 0x9b, 0xab, 0x39, 0xa3, 0x77, 0xa2, 0x66, 0x21, 0x1c, 0x21, 0x1c, 0xc1, 0x19, 0xc0,
+	0x1c, 0xc0, 0x0d, 0x9b, 0xab, 0x93, 0xee, 0xfe, 0x31, 0xc7, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xdf, 0xfe, 0x29, 0xe8, 0xfe, 0xad, 0x96, 0xaf, 0x10, 0x2c, 0x6e, 0x65, 0xc0, 0x2c, 0x25, 0xc2,
+	0x31, 0xc0, 0x51, 0x9b, 0xbb, 0x1c, 0x09, 0x31, 0xc0, 0x21, 0xfe, 0x9c, 0xf4, 0xfe, 0x32, 0x29,
+	0x00, 0xa4, 0x48, 0xab, 0x31, 0xa2, 0x77, 0x56, 0xc4, 0x26, 0x29, 0x6f, 0xc1, 0x26, 0x12, 0xc0,
+	0x26, 0xa5, 0x66, 0xa6, 0x54, 0xa5, 0x66, 0xa2, 0x77, 0x7e, 0x51, 0x9c, 0xaa, 0x9b, 0xba, 0x9a,
+	0xbc, 0x9a, 0xbb, 0x9b, 0xba, 0x9c, 0xaa, 0x9d, 0x99, 0x66, 0xc6, 0xa4, 0x56, 0xfe, 0xc6, 0x38,
+	0xa8, 0x44, 0x3a, 0x9d, 0xaa, 0x0d, 0x94, 0xef, 0x96, 0xcd, 0xc0, 0x98, 0xcc, 0xa2, 0x77, 0xfe,
+	0x19, 0x04, 0x00, 0xc6, 0x05, 0xa3, 0x67, 0xa3, 0x77, 0xa5, 0x55, 0xa5, 0x66, 0xa6, 0x54, 0xa5,
+	0x56, 0x3d, 0x1d, 0x7e, 0x1d, 0x11, 0x52, 0x55, 0x66, 0x35, 0xc0, 0x3d, 0x04, 0xc1, 0x09, 0xc0,
+	0x7a, 0x09, 0x3d, 0x9d, 0x9a, 0x9d, 0xaa, 0x39, 0x2a, 0x9d, 0x9a, 0x32, 0x3e, 0xb0, 0x10, 0xae,
+	0x11, 0x31, 0xc0, 0x9b, 0xab, 0x99, 0xcb, 0x56, 0xa3, 0x76, 0xa2, 0x77, 0xc0, 0x66, 0xc3, 0x19,
+	0x69, 0x19, 0xc0, 0x0d, 0x9a, 0xab, 0x29, 0xfe, 0x21, 0x45, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xdb, 0xa6, 0x26, 0xfe, 0x94, 0xd3, 0xfe, 0xe7, 0x3c, 0xa5, 0x66, 0x6e, 0x65, 0xc0, 0x2c, 0xc0,
+	0x25, 0xc1, 0x31, 0xc0, 0x9d, 0xa9, 0x9b, 0xab, 0xc0, 0xa5, 0x66, 0x31, 0x51, 0x94, 0xee, 0xfe,
+	0x6b, 0xaf, 0xfe, 0x00, 0x02, 0x00, 0xfe, 0x21, 0xa7, 0xa4, 0x76, 0x56, 0x55, 0xc0, 0x7a, 0x21,
+	0xc1, 0x26, 0x7b, 0xc0, 0x26, 0x9d, 0xaa, 0x56, 0x21, 0xa7, 0x54, 0xa7, 0x44, 0xa5, 0x66, 0x7e,
+	0x51, 0x9b, 0xbb, 0x99, 0xbb, 0x98, 0xcc, 0x99, 0xcb, 0x14, 0x00, 0xcb, 0x6e, 0x00, 0xad, 0x11,
+	0xfe, 0xd6, 0x9a, 0x35, 0x6e, 0x9d, 0xaa, 0x55, 0x95, 0xef, 0x94, 0xde, 0xc0, 0x99, 0xbc, 0x7e,
+	0x09, 0x00, 0x05, 0x00, 0xcb, 0x05, 0xa5, 0x66, 0xa6, 0x55, 0xa7, 0x45, 0xa7, 0x44, 0xa6, 0x55,
+	0x1d, 0x7f, 0x1d, 0x51, 0x3d, 0x35, 0x3d, 0x04, 0x09, 0xc2, 0x11, 0x6b, 0x11, 0x3d, 0x9c, 0xaa,
+	0x39, 0xc0, 0x2a, 0x9b, 0xbb, 0x5b, 0x0c, 0xfe, 0xc6, 0x59, 0xab, 0x32, 0xa2, 0x77, 0x9d, 0xaa,
+	0x08, 0x41, 0xa3, 0x76, 0x21, 0xc0, 0x56, 0xc3, 0x0d, 0xc2, 0x56, 0x97, 0xcd, 0x39, 0xfe, 0x10,
+	0xa2, 0x9b, 0xbb, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd8, 0xfe, 0x6b, 0xaf, 0x12, 0xa8, 0x55, 0x6e,
+	0x65, 0xc0, 0x2c, 0xc1, 0x25, 0xc0, 0x31, 0xc0, 0x9c, 0xaa, 0x19, 0x7e, 0xa7, 0x45, 0x31, 0x09,
+	0xfe, 0xa5, 0x75, 0xfe, 0x3a, 0x6a, 0x00, 0xa6, 0x27, 0xa9, 0x52, 0x6f, 0x55, 0xc2, 0x15, 0x21,
+	0xc0, 0x7e, 0xc0, 0x42, 0x9d, 0xa9, 0x0a, 0xa6, 0x65, 0xa8, 0x54, 0xa7, 0x44, 0xa2, 0x77, 0x11,
+	0x99, 0xbb, 0x96, 0xee, 0x10, 0x14, 0x00, 0xd2, 0xfe, 0x42, 0x69, 0xfe, 0xde, 0xdb, 0xa3, 0x66,
+	0x6e, 0x9d, 0xaa, 0x0d, 0x30, 0x94, 0xde, 0x7e, 0x99, 0xbc, 0x56, 0x2c, 0x00, 0xd2, 0x6e, 0xa6,
+	0x55, 0xa8, 0x44, 0xa8, 0x45, 0xa7, 0x44, 0x1d, 0xa2, 0x77, 0x1d, 0x65, 0x56, 0x04, 0x09, 0x11,
+	0xc1, 0x6b, 0x1d, 0xc0, 0x09, 0x9d, 0x99, 0x9c, 0xaa, 0x62, 0x39, 0x9d, 0x9a, 0x32, 0xa9, 0x53,
+	0xfe, 0xb5, 0x96, 0xaf, 0x00, 0xa4, 0x66, 0x51, 0x98, 0xcc, 0x9c, 0xaa, 0x08, 0x21, 0x1c, 0x59,
+	0x6b, 0x12, 0xc0, 0x0d, 0xc3, 0x9d, 0x9a, 0x94, 0xee, 0xfe, 0x42, 0x49, 0x05, 0x00, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xd4, 0xfe, 0x32, 0x09, 0xfe, 0xbd, 0xf7, 0x1d, 0x7f, 0x69, 0xc0, 0x2c, 0xc1,
+	0x25, 0xc0, 0x6f, 0xc0, 0x09, 0x1c, 0x6f, 0x2c, 0x31, 0x99, 0xcc, 0x39, 0x17, 0x00, 0xab, 0x04,
+	0x21, 0x15, 0x56, 0xc0, 0x6e, 0xc1, 0x21, 0xc0, 0x6e, 0x0d, 0x41, 0x7f, 0xa9, 0x43, 0x35, 0xa5,
+	0x66, 0x69, 0x99, 0xbb, 0x95, 0xfe, 0x96, 0xcd, 0x99, 0xcb, 0x00, 0xd6, 0xfe, 0x63, 0x2d, 0xfe,
+	0xde, 0xfb, 0x3a, 0xc0, 0x21, 0x1c, 0x96, 0xcd, 0x93, 0xef, 0x3d, 0x9a, 0xac, 0x9d, 0xa9, 0x51,
+	0x00, 0xd7, 0xa6, 0x55, 0xa9, 0x34, 0xaa, 0x23, 0x04, 0x2c, 0x6e, 0x51, 0x0c, 0x5a, 0x7e, 0x6b,
+	0xc0, 0x1d, 0xc0, 0x7e, 0x1d, 0x35, 0x9b, 0xbb, 0x2a, 0x39, 0x2a, 0x9a, 0xbc, 0x22, 0xfe, 0x9d,
+	0x14, 0xfe, 0xe7, 0x3c, 0xa6, 0x55, 0x66, 0x19, 0x9b, 0xba, 0xa3, 0x67, 0x1c, 0xc0, 0x55, 0xc6,
+	0x05, 0x9b, 0xaa, 0xfe, 0x73, 0xf0, 0xfe, 0x21, 0x45, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd0,
+	0x6e, 0x9f, 0x9c, 0xfe, 0x8c, 0x92, 0xfe, 0xef, 0x5c, 0x2c, 0x31, 0x65, 0x2c, 0xc2, 0x25, 0x31,
+	0xc0, 0x9c, 0xaa, 0x9b, 0xaa, 0x7f, 0x31, 0xc0, 0x21, 0x16, 0xfe, 0x00, 0x02, 0x00, 0xad, 0x02,
+	0xa3, 0x67, 0x51, 0xc2, 0x6e, 0xc0, 0x21, 0xc0, 0x12, 0x9c, 0x9b, 0x36, 0xaa, 0x43, 0xaa, 0x32,
+	0xa5, 0x66, 0x16, 0x96, 0xee, 0x94, 0xed, 0x96, 0xdd, 0x00, 0xda, 0xfe, 0x7c, 0x10, 0xfe, 0xdf,
+	0x1c, 0xa2, 0x87, 0x59, 0x9d, 0xaa, 0xc0, 0x95, 0xde, 0x93, 0xef, 0x7f, 0x9b, 0xaa, 0x1d, 0x7e,
+	0x00, 0xda, 0x14, 0xa8, 0x44, 0xab, 0x23, 0x35, 0xa5, 0x65, 0x31, 0x61, 0x18, 0x11, 0x6f, 0xc1,
+	0x25, 0x6b, 0x25, 0x04, 0x0d, 0x2a, 0x39, 0xc0, 0x9a, 0xbb, 0x6f, 0xfe, 0x94, 0xd3, 0x2d, 0xa7,
+	0x54, 0x66, 0x97, 0xcd, 0x9c, 0xa9, 0xa3, 0x67, 0x1c, 0x59, 0x66, 0xc6, 0x9d, 0x9a, 0x98, 0xbc,
+	0xfe, 0x52, 0xcb, 0xfe, 0x08, 0x41, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xce, 0xfe, 0x4a, 0xab,
+	0xfe, 0xce, 0x79, 0xab, 0x32, 0x6f, 0x25, 0xc0, 0x2c, 0xc1, 0x25, 0x31, 0xc0, 0x9d, 0xa9, 0x12,
+	0x6b, 0x2c, 0x31, 0x21, 0x0c, 0x00, 0xc0, 0xfe, 0x29, 0xc8, 0x7e, 0x52, 0x5a, 0x0d, 0xc1, 0x6e,
+	0x7f, 0x15, 0x36, 0x41, 0xa9, 0x53, 0xab, 0x43, 0xa7, 0x44, 0x1d, 0x95, 0xed, 0x93, 0xfe, 0x96,
+	0xdd, 0x00, 0xdd, 0xfe, 0x94, 0xd3, 0xfe, 0xe7, 0x1c, 0xa2, 0x77, 0x59, 0x9d, 0xaa, 0xc0, 0x95,
+	0xde, 0x93, 0xef, 0xa2, 0x77, 0x9a, 0xbb, 0x9b, 0xab, 0xa3, 0x76, 0xfe, 0x08, 0x61, 0x00, 0xdd,
+	0x10, 0xac, 0x12, 0x35, 0xa5, 0x66, 0x31, 0x65, 0x56, 0x20, 0x25, 0xc1, 0x31, 0xc0, 0x09, 0x0d,
+	0x9c, 0xaa, 0x7f, 0x39, 0x9b, 0xab, 0x55, 0xfe, 0x94, 0xb3, 0xfe, 0xdf, 0x1c, 0xa7, 0x54, 0x66,
+	0x96, 0xcd, 0x9d, 0xa9, 0xa3, 0x77, 0x1c, 0x55, 0xc3, 0x08, 0xc0, 0x0d, 0x55, 0x9b, 0xbb, 0x93,
+	0xdf, 0xfe, 0x29, 0x86, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xca, 0x6e, 0xa0, 0x8b, 0xfe, 0x94,
+	0xd3, 0xfe, 0xef, 0x7d, 0x2c, 0xc0, 0x69, 0x2c, 0xc1, 0x25, 0x2c, 0x31, 0x51, 0x1c, 0x41, 0x1d,
+	0x31, 0x9a, 0xbb, 0xfe, 0x8c, 0x71, 0x00, 0xc0, 0xfe, 0x29, 0xc8, 0x12, 0x51, 0xc0, 0x7b, 0x0d,
+	0xc0, 0x12, 0x7f, 0x0d, 0x9b, 0x9b, 0x3e, 0xad, 0x21, 0xaa, 0x43, 0x6f, 0x96, 0xec, 0xfe, 0x31,
+	0x86, 0x95, 0xdd, 0x00, 0xe0, 0xfe, 0xad, 0x96, 0x30, 0xa3, 0x66, 0x55, 0x9d, 0xaa, 0x1c, 0x35,
+	0x93, 0xef, 0xa2, 0x77, 0x9b, 0xbb, 0x9a, 0xab, 0xa3, 0x76, 0xfe, 0x18, 0xc3, 0x00, 0xe0, 0xa9,
+	0x34, 0xad, 0x11, 0x09, 0x31, 0xc0, 0x25, 0xc0, 0x6b, 0xc0, 0x31, 0x34, 0x31, 0x9d, 0xa9, 0x99,
+	0xbc, 0x9c, 0xaa, 0x7f, 0x39, 0x9b, 0xab, 0x55, 0xfe, 0x94, 0xf3, 0xb2, 0x00, 0xa6, 0x54, 0x9d,
+	0xaa, 0x97, 0xcc, 0x51, 0xa4, 0x66, 0x6f, 0x0d, 0xc2, 0x66, 0xc2, 0x9d, 0x9a, 0x99, 0xbb, 0xfe,
+	0x52, 0xec, 0x14, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xc8, 0x3a, 0x39, 0xab, 0x33, 0x31, 0x65,
+	0x2c, 0xc2, 0x25, 0x31, 0xc0, 0x30, 0x39, 0xa8, 0x44, 0x31, 0x09, 0xfe, 0x94, 0xd3, 0xfe, 0x00,
+	0x02, 0x00, 0xfe, 0x29, 0xc8, 0x12, 0x51, 0xc1, 0x7b, 0x0d, 0x12, 0x15, 0x9d, 0x9a, 0x9c, 0x8a,
+	0xaa, 0x53, 0xae, 0x10, 0xa6, 0x65, 0x9a, 0xbb, 0xfe, 0x42, 0x28, 0x92, 0xff, 0x00, 0xe2, 0xa6,
+	0x45, 0xfe, 0xbe, 0x18, 0x30, 0x09, 0x51, 0x51, 0x56, 0x96, 0xdd, 0x93, 0xef, 0xa2, 0x77, 0x9c,
+	0xaa, 0x99, 0xbc, 0xa3, 0x76, 0xfe, 0x21, 0x45, 0x00, 0xe2, 0x14, 0xab, 0x23, 0xad, 0x11, 0xaa,
+	0x33, 0xa2, 0x77, 0x56, 0x25, 0x31, 0xc1, 0x39, 0xc0, 0x11, 0x98, 0xcd, 0x1d, 0xa3, 0x76, 0xc0,
+	0x9a, 0xbb, 0xa2, 0x67, 0xfe, 0xa5, 0x55, 0xb1, 0x00, 0xa4, 0x65, 0x9b, 0xbb, 0x97, 0xcc, 0x6f,
+	0xa3, 0x76, 0xc0, 0x66, 0xc2, 0x5a, 0xc0, 0x08, 0x51, 0x9c, 0x9a, 0x92, 0xff, 0xfe, 0x21, 0x45,
+	0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xc5, 0x07, 0x11, 0x04, 0x2c, 0xc0, 0x69, 0x2c, 0xc1, 0x25,
+	0x6f, 0xc0, 0x9c, 0xaa, 0x98, 0xcc, 0xa4, 0x66, 0x31, 0x2c, 0xfe, 0xad, 0x96, 0x1f, 0x00, 0xad,
+	0x02, 0x12, 0x9d, 0xaa, 0x3e, 0xc1, 0x6b, 0x12, 0xc0, 0x9c, 0x9a, 0x0b, 0x1d, 0xad, 0x21, 0xa3,
+	0x76, 0x94, 0xee, 0xfe, 0x21, 0x24, 0x00, 0xe5, 0xab, 0x23, 0xfe, 0xce, 0x79, 0xa5, 0x66, 0x09,
+	0x51, 0x21, 0x19, 0x96, 0xdd, 0x93, 0xef, 0xa2, 0x77, 0x9c, 0xaa, 0x9a, 0xbb, 0xa2, 0x77, 0x95,
+	0xed, 0x00, 0xe5, 0xa7, 0x44, 0xae, 0x01, 0xac, 0x23, 0xa5, 0x65, 0xc0, 0x56, 0x7a, 0xc0, 0x39,
+	0x6f, 0x39, 0x09, 0x98, 0xcc, 0x9d, 0x9a, 0x39, 0xc0, 0x99, 0xbc, 0x25, 0xfe, 0xb5, 0xd7, 0x2c,
+	0x6e, 0x98, 0xcc, 0x99, 0xbc, 0xa3, 0x76, 0x0d, 0x08, 0xc2, 0x5a, 0x39, 0x05, 0x39, 0x1d, 0x97,
+	0xcd, 0xfe, 0x4a, 0x6a, 0xfe, 0x00, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xc2, 0x6f, 0x27, 0xfe,
+	0xbd, 0xd7, 0xfe, 0xff, 0xde, 0x31, 0x25, 0x2c, 0xc1, 0x25, 0xc0, 0x31, 0x61, 0x0d, 0x56, 0x2c,
+	0x31, 0x93, 0xff, 0xfe, 0x4a, 0xab, 0x00, 0xab, 0x04, 0x12, 0x9d, 0xaa, 0xc0, 0x3e, 0xc1, 0x7f,
+	0x12, 0x1a, 0x56, 0xfe, 0x5b, 0x2d, 0xac, 0x22, 0x65, 0xfe, 0x4a, 0x8a, 0xfe, 0x10, 0x82, 0x00,
+	0xe7, 0xfe, 0x42, 0x49, 0xfe, 0xd6, 0xba, 0xa4, 0x66, 0xa2, 0x77, 0x35, 0x21, 0x19, 0x96, 0xdd,
+	0x93, 0xef, 0xa2, 0x87, 0x9c, 0x9a, 0x9b, 0xab, 0xc0, 0x99, 0xdb, 0x00, 0xe7, 0x14, 0xad, 0x12,
+	0xaf, 0x00, 0xa8, 0x44, 0x6b, 0x39, 0xc1, 0x00, 0x7e, 0x39, 0x35, 0x98, 0xcc, 0xc0, 0xa2, 0x77,
+	0x2a, 0x99, 0xbd, 0x21, 0xfe, 0xce, 0x9a, 0xab, 0x32, 0x66, 0x95, 0xdd, 0x1d, 0xa4, 0x76, 0x0d,
+	0x05, 0xc1, 0x39, 0xc2, 0x51, 0x9b, 0xab, 0xfe, 0x6b, 0x8e, 0xfe, 0x10, 0xa2, 0x9b, 0xbb, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xc0, 0x2a, 0xfe, 0xde, 0xfb, 0x2c, 0xc0, 0x69, 0x2c, 0xc1, 0x25, 0x31,
+	0xc0, 0x9a, 0xbb, 0x98, 0xcc, 0x04, 0x31, 0x35, 0x3d, 0x00, 0xa7, 0x16, 0xa8, 0x63, 0x9d, 0x9a,
+	0xc1, 0x3e, 0xc0, 0x7f, 0x6e, 0x1a, 0x56, 0xfe, 0x5b, 0x4d, 0xac, 0x32, 0x9c, 0xaa, 0xfe, 0x42,
+	0x08, 0x91, 0xff, 0x00, 0xe9, 0xfe, 0x5b, 0x0c, 0x21, 0x35, 0x09, 0x35, 0x21, 0x19, 0x96, 0xdd,
+	0x93, 0xef, 0x11, 0x9c, 0x9a, 0x9b, 0xbb, 0x22, 0x61, 0x00, 0xea, 0xac, 0x12, 0xb0, 0x00, 0xa9,
+	0x34, 0xa2, 0x77, 0x66, 0x05, 0x00, 0x7e, 0x6e, 0x31, 0x98, 0xcc, 0x99, 0xbc, 0x2a, 0x3e, 0x1d,
+	0x9b, 0xab, 0xfe, 0x8c, 0x92, 0x04, 0xa5, 0x55, 0x9b, 0xab, 0x96, 0xdd, 0xa2, 0x77, 0xa3, 0x76,
+	0x56, 0x65, 0xc4, 0x51, 0x9c, 0xab, 0x96, 0xcd, 0x35, 0x94, 0xfe, 0xfd, 0xfd, 0xfd, 0xfd, 0xfb,
+	0x07, 0xfe, 0x8c, 0x92, 0x09, 0x2c, 0x69, 0xc0, 0x2c, 0xc0, 0x25, 0xc0, 0x6f, 0x51, 0x39, 0x05,
+	0x31, 0xc0, 0xfe, 0xad, 0x76, 0xfe, 0x00, 0x23, 0x00, 0xfe, 0x29, 0xe8, 0x51, 0x36, 0x7a, 0xc1,
+	0x7f, 0x6e, 0x9c, 0x9a, 0x06, 0xfe, 0x5b, 0x2d, 0xad, 0x21, 0x0c, 0xfe, 0x31, 0xc7, 0x00, 0xec,
+	0xfe, 0x7b, 0xef, 0xfe, 0xde, 0xfb, 0xa3, 0x66, 0x7f, 0x51, 0x21, 0x19, 0x96, 0xdd, 0x93, 0xef,
+	0xa3, 0x76, 0x9c, 0xab, 0x9c, 0x99, 0x9c, 0xab, 0x7e, 0x00, 0xec, 0xaa, 0x23, 0xfe, 0x63, 0x6e,
+	0xaa, 0x33, 0xa2, 0x87, 0x5a, 0x08, 0x05, 0x7e, 0xc0, 0x9b, 0xab, 0x96, 0xdd, 0x9d, 0x99, 0xa2,
+	0x88, 0x39, 0x9a, 0xbb, 0xa2, 0x78, 0xfe, 0xb5, 0xd7, 0xfe, 0xff, 0xff, 0xc0, 0x95, 0xde, 0x9b,
+	0xba, 0xa4, 0x66, 0x05, 0x39, 0xc2, 0x66, 0xc0, 0x5a, 0x09, 0x99, 0xbc, 0xfe, 0x4a, 0x8a, 0x00,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xf8, 0xa2, 0x67, 0x0b, 0x09, 0xfe, 0xff, 0xde, 0x6f, 0x25, 0x2c, 0xc1,
+	0x25, 0x31, 0xc0, 0x99, 0xcb, 0x98, 0xbd, 0xab, 0x32, 0x31, 0x97, 0xdd, 0xfe, 0x5b, 0x0d, 0x00,
+	0xac, 0x03, 0xa2, 0x77, 0x9d, 0x9a, 0x39, 0xc1, 0x6e, 0x0d, 0x9d, 0x99, 0x9a, 0xbc, 0xfe, 0x53,
+	0x0c, 0xae, 0x21, 0x9c, 0xaa, 0xfe, 0x31, 0xa7, 0x00, 0xee, 0xfe, 0x94, 0xb3, 0xfe, 0xde, 0xfb,
+	0xa3, 0x77, 0x09, 0x51, 0x1c, 0x21, 0x96, 0xde, 0x30, 0x11, 0x30, 0x9c, 0x9a, 0x9b, 0xba, 0xa4,
+	0x66, 0xfe, 0x08, 0x61, 0x00, 0xed, 0xaa, 0x23, 0xfe, 0x63, 0x6e, 0xab, 0x32, 0xa2, 0x77, 0x08,
+	0xc0, 0x0d, 0x6f, 0x08, 0x98, 0xbc, 0x97, 0xcd, 0x7e, 0xa2, 0x77, 0x2a, 0x99, 0xbc, 0x35, 0xfe,
+	0xde, 0xfc, 0xa8, 0x43, 0x9b, 0xbb, 0x95, 0xdd, 0xa2, 0x77, 0xa3, 0x67, 0x65, 0x66, 0xc1, 0x5a,
+	0xc1, 0x11, 0x9b, 0xab, 0xfe, 0x63, 0x6e, 0xfe, 0x08, 0x61, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xf5,
+	0x07, 0xfe, 0x3a, 0x4a, 0xfe, 0xd6, 0xba, 0x2c, 0xc0, 0x69, 0x2c, 0xc1, 0x25, 0x6f, 0x61, 0x34,
+	0x39, 0x31, 0xc0, 0xfe, 0xa5, 0x34, 0x00, 0x1a, 0xad, 0x00, 0x36, 0x66, 0x7e, 0xc1, 0x0d, 0x39,
+	0x2b, 0xfe, 0x42, 0x8a, 0xb1, 0x00, 0x61, 0xfe, 0x3a, 0x08, 0x00, 0xf0, 0x21, 0xad, 0x21, 0x09,
+	0xc0, 0x51, 0x1c, 0x5a, 0x98, 0xcc, 0x30, 0xa4, 0x65, 0x9d, 0x9a, 0x9c, 0xaa, 0x9a, 0xbb, 0xa5,
+	0x55, 0xfe, 0x10, 0xc3, 0x00, 0xef, 0xab, 0x22, 0xfe, 0x6b, 0x8e, 0xab, 0x23, 0x7e, 0xc1, 0x6f,
+	0x7e, 0x31, 0x95, 0xed, 0x11, 0xa3, 0x67, 0x7e, 0x11, 0x46, 0xfe, 0xad, 0x96, 0xfe, 0xff, 0xff,
+	0xc0, 0x94, 0xee, 0x9b, 0xbb, 0x39, 0xc0, 0x56, 0xc2, 0x65, 0x31, 0x9d, 0xaa, 0x9c, 0x9a, 0x95,
+	0xed, 0xfe, 0x19, 0x04, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xf4, 0xfe, 0x63, 0x6e, 0xfe, 0xe7, 0x3c,
+	0x2c, 0x69, 0xc0, 0x2c, 0xc0, 0x25, 0x2c, 0x6e, 0x35, 0x96, 0xcd, 0x35, 0x31, 0x98, 0xcc, 0x2a,
+	0x00, 0xad, 0x02, 0x5a, 0x51, 0x36, 0x7a, 0xc0, 0x3e, 0x7b, 0x98, 0xbc, 0x08, 0xfe, 0x84, 0x52,
+	0xa4, 0x65, 0xfe, 0x4a, 0x69, 0x00, 0xf1, 0xa5, 0x46, 0xfe, 0xbd, 0xf7, 0x21, 0xa4, 0x66, 0xc0,
+	0x51, 0x1c, 0x5a, 0x98, 0xcc, 0xfe, 0x6b, 0xd0, 0xa4, 0x75, 0x9d, 0x9a, 0x0d, 0x9a, 0xbb, 0xa4,
+	0x66, 0xfe, 0x21, 0x25, 0x00, 0xf1, 0xad, 0x12, 0x35, 0xa9, 0x43, 0x6b, 0x6e, 0xc0, 0x7e, 0x19,
+	0x3d, 0x16, 0x7f, 0x39, 0x66, 0x26, 0x35, 0xfe, 0xe7, 0x1c, 0xa7, 0x44, 0x9a, 0xbb, 0x09, 0xa3,
+	0x76, 0xa2, 0x77, 0x56, 0xc0, 0x66, 0x25, 0xc1, 0x56, 0x9c, 0xaa, 0x98, 0xcc, 0xfe, 0x31, 0xa6,
+	0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xf1, 0x07, 0x25, 0xfe, 0xf7, 0x9d, 0xa3, 0x67, 0x65, 0x6b, 0xc1,
+	0x25, 0x31, 0xc0, 0x95, 0xee, 0x1d, 0x2c, 0x31, 0x35, 0x00, 0x1a, 0xad, 0x00, 0x2a, 0xc0, 0x36,
+	0x7a, 0xc0, 0x0d, 0x9b, 0xab, 0x9c, 0xaa, 0xfe, 0x6b, 0xaf, 0xaa, 0x43, 0x92, 0xfe, 0xfe, 0x08,
+	0x61, 0x00, 0xf2, 0xaa, 0x23, 0xfe, 0xc6, 0x59, 0xa5, 0x65, 0xa5, 0x56, 0x65, 0x51, 0x9d, 0x99,
+	0x21, 0x98, 0xcc, 0xfe, 0x6b, 0xcf, 0xa4, 0x76, 0x9d, 0x9a, 0x9d, 0x99, 0x9a, 0xbc, 0xa3, 0x76,
+	0x04, 0x00, 0xf2, 0xa2, 0x77, 0xfe, 0x42, 0x49, 0xfe, 0x84, 0x72, 0xa6, 0x55, 0x7a, 0xc0, 0x6e,
+	0x6f, 0x9a, 0xbb, 0x39, 0x9c, 0xaa, 0xa3, 0x66, 0x39, 0x11, 0x56, 0xfe, 0xb5, 0xd7, 0xfe, 0xff,
+	0xff, 0x2c, 0x92, 0xef, 0x65, 0xa3, 0x77, 0x56, 0x69, 0xc3, 0x1d, 0x9c, 0xaa, 0x9a, 0xbb, 0xfe,
+	0x42, 0x49, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xef, 0xa0, 0x8b, 0x21, 0xfe, 0xff, 0xbe, 0xa2, 0x67,
+	0x65, 0x6b, 0xc1, 0x25, 0x31, 0x51, 0x11, 0xa5, 0x66, 0x31, 0x9c, 0xaa, 0xfe, 0x73, 0xcf, 0x00,
+	0xac, 0x03, 0x3e, 0x51, 0x6b, 0x36, 0xc0, 0x3e, 0xc0, 0x1a, 0xfe, 0x4a, 0xab, 0x05, 0x99, 0xcb,
+	0xfe, 0x19, 0x04, 0x00, 0xf4, 0xfe, 0x3a, 0x08, 0x08, 0xa3, 0x66, 0xa5, 0x66, 0x09, 0x51, 0x9d,
+	0x99, 0x21, 0x98, 0xcc, 0x26, 0xa4, 0x76, 0x3d, 0x9c, 0xab, 0x9b, 0xaa, 0x6e, 0x99, 0xdc, 0x00,
+	0xf4, 0xa5, 0x55, 0xfe, 0x5b, 0x0c, 0xae, 0x11, 0xa4, 0x66, 0x66, 0x21, 0x6f, 0x19, 0x29, 0x97,
+	0xbd, 0x25, 0xa2, 0x77, 0x2a, 0x98, 0xbd, 0xfe, 0x8c, 0x72, 0xfe, 0xef, 0x9e, 0xa3, 0x76, 0x08,
+	0x99, 0xbb, 0xa5, 0x56, 0x66, 0x69, 0xc0, 0x66, 0x5a, 0xc1, 0x9b, 0xbb, 0x05, 0xfe, 0x52, 0xcb,
+	0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xec, 0x6e, 0xa6, 0x27, 0xfe, 0xbd, 0xf7, 0xaf, 0x11, 0x6e, 0x65,
+	0x2c, 0xc1, 0x25, 0x31, 0x35, 0x94, 0xde, 0xad, 0x22, 0x31, 0x94, 0xee, 0x36, 0x00, 0xfe, 0x29,
+	0xc8, 0x9d, 0x99, 0xc0, 0x6b, 0x36, 0x7a, 0x0d, 0x06, 0xa2, 0x77, 0xfe, 0x7c, 0x31, 0xa5, 0x65,
+	0xfe, 0x42, 0x08, 0x00, 0xf6, 0x19, 0xfe, 0xd6, 0xdb, 0xa2, 0x76, 0x18, 0x55, 0x35, 0x12, 0x7f,
+	0x11, 0xfe, 0x6b, 0xcf, 0xa4, 0x76, 0x51, 0x9d, 0x9a, 0x9b, 0xab, 0x55, 0x9d, 0xb9, 0x00, 0xf6,
+	0xab, 0x23, 0xfe, 0x73, 0xf0, 0xaa, 0x33, 0x7e, 0xc0, 0x2d, 0x7a, 0x98, 0xbc, 0x22, 0x66, 0xa2,
+	0x76, 0x7f, 0x9a, 0xab, 0x39, 0xfe, 0xd6, 0xba, 0xaa, 0x33, 0x9a, 0xbb, 0x94, 0xee, 0xa3, 0x67,
+	0x7e, 0x66, 0xc0, 0x1d, 0xc2, 0x9c, 0xaa, 0x9c, 0xaa, 0x92, 0xff, 0xfe, 0x00, 0x20, 0x00, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xe9, 0x14, 0xa9, 0x15, 0x34, 0x2c, 0xc0, 0x69, 0x2c, 0xc0, 0x25, 0x2c, 0x6e,
+	0x96, 0xdd, 0x98, 0xcd, 0x2c, 0x31, 0x21, 0x00, 0xa8, 0x15, 0xa5, 0x75, 0x9d, 0x9a, 0x6e, 0x6b,
+	0xc0, 0x3e, 0x66, 0xfe, 0x00, 0x03, 0xfe, 0x52, 0xec, 0xfe, 0x9d, 0x14, 0x93, 0xff, 0xfe, 0x08,
+	0x61, 0x00, 0xf7, 0xfe, 0x73, 0xaf, 0xfe, 0xde, 0xdb, 0xa2, 0x77, 0xa5, 0x55, 0x09, 0x51, 0x12,
+	0x7f, 0x98, 0xcc, 0x26, 0xa4, 0x76, 0x51, 0x9d, 0x9a, 0x9c, 0xaa, 0x9c, 0xaa, 0x25, 0x00, 0xf7,
+	0x6f, 0xfe, 0x4a, 0x8a, 0xfe, 0x8c, 0xb3, 0xa5, 0x65, 0xc0, 0x2d, 0x7e, 0x9b, 0xbb, 0x93, 0xde,
+	0x11, 0xa3, 0x66, 0x7b, 0x41, 0x32, 0xfe, 0xb5, 0xb6, 0xfe, 0xff, 0xff, 0x51, 0xfe, 0xb5, 0xd7,
+	0xc0, 0xa3, 0x76, 0x56, 0xc2, 0x66, 0x1d, 0x35, 0x0d, 0x94, 0xee, 0x19, 0x00, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xe7, 0xa2, 0x67, 0xfe, 0x2a, 0x08, 0xfe, 0xd6, 0xba, 0x2c, 0x69, 0xc0, 0x2c, 0xc0, 0x25,
+	0x31, 0xc0, 0x1d, 0xc0, 0x31, 0x9d, 0xaa, 0xfe, 0x73, 0xf0, 0x00, 0x01, 0x56, 0x51, 0x6e, 0xc0,
+	0x36, 0x01, 0x0e, 0x0b, 0xfe, 0x84, 0x51, 0xa3, 0x77, 0xfe, 0x31, 0xa6, 0x00, 0xf9, 0xfe, 0x8c,
+	0x72, 0xfe, 0xde, 0xfb, 0xa2, 0x77, 0xa4, 0x66, 0x51, 0x35, 0x12, 0x21, 0x98, 0xcc, 0x26, 0xa4,
+	0x76, 0x52, 0x9d, 0x99, 0x9c, 0xaa, 0x9c, 0x9a, 0x39, 0x19, 0x00, 0xf8, 0xa8, 0x44, 0x21, 0xac,
+	0x22, 0x2d, 0x7a, 0x6e, 0x2d, 0x29, 0x96, 0xce, 0xa3, 0x76, 0x6e, 0xc0, 0x1e, 0xfe, 0x8c, 0x92,
+	0x1d, 0x31, 0x92, 0xff, 0x9c, 0xaa, 0x25, 0x56, 0xc0, 0x66, 0x69, 0xc1, 0x35, 0x9b, 0xab, 0x97,
+	0xdd, 0xfe, 0x10, 0xa2, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xe5, 0xa2, 0x67, 0xfe, 0x3a, 0x4a, 0xfe,
+	0xde, 0xfb, 0x2c, 0x69, 0x2c, 0xc1, 0x25, 0x31, 0x51, 0xfe, 0xad, 0x96, 0xa8, 0x54, 0x31, 0x99,
+	0xbc, 0xfe, 0x3a, 0x4a, 0x00, 0xfe, 0x29, 0xc8, 0x9c, 0xaa, 0xc0, 0x6e, 0xc0, 0x7f, 0x6e, 0xfe,
+	0x00, 0x03, 0xfe, 0x4a, 0xab, 0xfe, 0x9d, 0x14, 0x93, 0xff, 0xfe, 0x00, 0x20, 0x00, 0xfa, 0xfe,
+	0xa5, 0x34, 0x21, 0xa3, 0x66, 0x1d, 0x51, 0x51, 0x12, 0x21, 0x98, 0xcc, 0x26, 0xa4, 0x76, 0x04,
+	0x9d, 0x99, 0x9d, 0x99, 0x0e, 0x3e, 0xfe, 0x10, 0xc3, 0x00, 0xf9, 0x05, 0xfe, 0x4a, 0x6a, 0xfe,
+	0x8c, 0xb3, 0xa6, 0x55, 0x7a, 0x6e, 0xc0, 0x97, 0xcd, 0x0e, 0xa2, 0x87, 0x6e, 0x7f, 0x99, 0xbc,
+	0xaa, 0x43, 0xfe, 0xe7, 0x3c, 0xa6, 0x55, 0x96, 0xdd, 0x97, 0xcd, 0xa4, 0x66, 0xc0, 0x65, 0xc3,
+	0x30, 0x9c, 0x9a, 0x99, 0xcb, 0xfe, 0x18, 0xc3, 0x9a, 0xbb, 0xfd, 0xfd, 0xfd, 0xfd, 0xe3, 0x0c,
+	0xfe, 0x4a, 0xab, 0xfe, 0xe7, 0x1c, 0x2c, 0x69, 0x2c, 0xc1, 0x25, 0x31, 0x09, 0xfe, 0xa5, 0x55,
+	0x30, 0x31, 0x93, 0xef, 0xfe, 0x00, 0x03, 0xa3, 0x55, 0x01, 0x9d, 0x8a, 0x7e, 0xc1, 0xa2, 0x77,
+	0x2a, 0x15, 0xfe, 0x73, 0xf0, 0x05, 0xfe, 0x39, 0xc7, 0x00, 0xfb, 0xa5, 0x46, 0xfe, 0xb5, 0xb6,
+	0xa9, 0x44, 0xa4, 0x66, 0xa3, 0x66, 0x09, 0x51, 0x12, 0x1c, 0x99, 0xbb, 0x26, 0xa4, 0x76, 0x52,
+	0x26, 0x9c, 0xbb, 0x9b, 0xaa, 0xa5, 0x55, 0xfe, 0x21, 0x25, 0x00, 0xfb, 0xaa, 0x23, 0xfe, 0x73,
+	0xf0, 0xab, 0x32, 0xa2, 0x77, 0xc0, 0x7f, 0x99, 0xbb, 0xfe, 0x52, 0xec, 0x56, 0xa2, 0x76, 0x7b,
+	0x11, 0x1d, 0xfe, 0xce, 0x9a, 0xab, 0x32, 0x99, 0xbc, 0x93, 0xff, 0xa4, 0x65, 0x18, 0x11, 0xc0,
+	0x66, 0x5a, 0x11, 0x30, 0x39, 0x9a, 0xbb, 0xfe, 0x18, 0xe3, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xe1,
+	0xa2, 0x67, 0xfe, 0x4a, 0xab, 0xfe, 0xe7, 0x3c, 0x2c, 0x69, 0x2c, 0xc1, 0x25, 0x31, 0x99, 0xcc,
+	0xfe, 0xa5, 0x35, 0xfe, 0xef, 0x7e, 0x31, 0xfe, 0xad, 0x96, 0x00, 0xaa, 0x14, 0xa2, 0x77, 0x22,
+	0x7e, 0xc1, 0xa2, 0x87, 0x99, 0xad, 0x39, 0xfe, 0x94, 0xd3, 0x3d, 0xfe, 0x10, 0x82, 0x00, 0xfc,
+	0xaa, 0x23, 0xfe, 0xc6, 0x38, 0xa5, 0x66, 0xa5, 0x55, 0xa2, 0x77, 0x09, 0x51, 0x12, 0x6b, 0x99,
+	0xcb, 0x26, 0xa4, 0x76, 0x56, 0x29, 0x9d, 0x9a, 0x9a, 0xbb, 0xa4, 0x66, 0x94, 0xfe, 0x00, 0xfc,
+	0x14, 0xfe, 0x5a, 0xec, 0xfe, 0x9d, 0x14, 0xa4, 0x66, 0xc0, 0xa2, 0x77, 0x9b, 0xbb, 0x39, 0x11,
+	0xa2, 0x77, 0x6e, 0x25, 0x9a, 0xac, 0x0c, 0x31, 0x9c, 0xaa, 0x35, 0xa2, 0x77, 0x7e, 0x09, 0xc3,
+	0x9d, 0xa9, 0x9a, 0xbc, 0x9d, 0x89, 0xfe, 0x19, 0x04, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xdf, 0xa2,
+	0x67, 0xfe, 0x5b, 0x0d, 0xfe, 0xe7, 0x3c, 0x2c, 0x69, 0x2c, 0xc1, 0x25, 0x31, 0x97, 0xdc, 0x94,
+	0xdf, 0x2c, 0x31, 0xfe, 0x94, 0xb3, 0x00, 0xad, 0x02, 0x41, 0x66, 0x2a, 0xc0, 0x36, 0x7e, 0xfe,
+	0x00, 0x02, 0xfe, 0x4a, 0xcc, 0xfe, 0x9d, 0x35, 0xfe, 0x52, 0xcb, 0x00, 0xfd, 0xc0, 0xaf, 0x01,
+	0xfe, 0xce, 0x79, 0xa3, 0x77, 0xa6, 0x44, 0x7f, 0x51, 0x35, 0x12, 0x1c, 0x9a, 0xab, 0x26, 0xa4,
+	0x76, 0x56, 0x9d, 0xaa, 0x9d, 0x99, 0x9b, 0xab, 0xa2, 0x77, 0x99, 0xdb, 0x00, 0xfd, 0xc0, 0x18,
+	0xfe, 0x8c, 0x92, 0xa8, 0x44, 0x6f, 0x7e, 0x35, 0xfe, 0x6b, 0x8e, 0x98, 0xbd, 0xa4, 0x65, 0x66,
+	0x2a, 0x1e, 0x21, 0xfe, 0xff, 0xff, 0x51, 0x35, 0x7f, 0xa2, 0x76, 0x56, 0xc1, 0x04, 0x09, 0x9d,
+	0x99, 0x9a, 0xbc, 0x9c, 0xaa, 0xfe, 0x19, 0x04, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xdd, 0x6f, 0xfe,
+	0x4a, 0xab, 0xfe, 0xe7, 0x3c, 0xa5, 0x66, 0x69, 0x2c, 0xc1, 0x25, 0x6f, 0x39, 0x26, 0x31, 0x2c,
+	0xfe, 0x7b, 0xf0, 0x00, 0xfe, 0x29, 0xc7, 0x9c, 0xab, 0xc0, 0x6e, 0xc0, 0x7f, 0xc0, 0xfe, 0x00,
+	0x02, 0x30, 0xa9, 0x33, 0xfe, 0x29, 0x66, 0x00, 0xfd, 0xc1, 0xfe, 0x52, 0xab, 0xfe, 0xd6, 0xba,
+	0x1c, 0xa6, 0x55, 0xc0, 0x55, 0x35, 0x12, 0x1c, 0x9b, 0xaa, 0xfe, 0x6b, 0xcf, 0xa4, 0x76, 0x56,
+	0x9d, 0xaa, 0x9d, 0x99, 0x9c, 0xaa, 0x5a, 0x61, 0x00, 0xfd, 0xc1, 0xa7, 0x45, 0xfe, 0x73, 0xf0,
+	0xac, 0x22, 0x04, 0x6e, 0x04, 0x35, 0x02, 0xa4, 0x66, 0x25, 0x7f, 0x1e, 0xfe, 0x8c, 0xb3, 0xfe,
+	0xff, 0xff, 0x2c, 0xfe, 0xb5, 0xb6, 0x56, 0xa3, 0x76, 0x09, 0xc0, 0x04, 0x3d, 0x09, 0x21, 0x9a,
+	0xbb, 0x9d, 0x9a, 0xfe, 0x18, 0xe3, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xdb, 0xa2, 0x67, 0xfe, 0x4a,
+	0xab, 0xfe, 0xe7, 0x3c, 0x2c, 0x69, 0x2c, 0xc1, 0x25, 0x31, 0x92, 0xff, 0x9b, 0xab, 0x31, 0x18,
+	0xfe, 0x63, 0x4d, 0x00, 0xfe, 0x29, 0xc8, 0x9c, 0x9a, 0x7a, 0x6e, 0xc0, 0x3e, 0x22, 0x9b, 0xbb,
+	0xfe, 0x8c, 0x92, 0x51, 0xfe, 0x08, 0x82, 0x00, 0xfd, 0xc2, 0xfe, 0x6b, 0x6e, 0xfe, 0xd6, 0xdb,
+	0x7e, 0x1d, 0x18, 0x55, 0x51, 0x12, 0x1c, 0x9a, 0xbb, 0x26, 0x11, 0x56, 0x51, 0x9d, 0x99, 0x9c,
+	0xaa, 0x9d, 0xaa, 0xa3, 0x76, 0x00, 0xfd, 0xc2, 0xa2, 0x77, 0x2d, 0xfe, 0xa5, 0x55, 0x04, 0x6e,
+	0xc0, 0x93, 0xef, 0x92, 0xff, 0xa4, 0x66, 0xc0, 0x34, 0x99, 0xab, 0x09, 0x1d, 0x31, 0xfe, 0xb5,
+	0xd7, 0x51, 0x09, 0x04, 0x69, 0xc2, 0x9c, 0xab, 0x9a, 0xab, 0x9d, 0xa9, 0x3c, 0x00, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xd9, 0xa2, 0x67, 0xfe, 0x3a, 0x4a, 0xfe, 0xe7, 0x1c, 0x2c, 0x69, 0x2c, 0xc2, 0x31,
+	0xfe, 0xbe, 0x18, 0x9c, 0xaa, 0x31, 0x9c, 0xaa, 0xfe, 0x4a, 0xab, 0x00, 0x0d, 0x22, 0x7a, 0x6e,
+	0xc0, 0x3e, 0x99, 0xbd, 0x0d, 0xfe, 0x9d, 0x14, 0x93, 0xfe, 0x00, 0xfd, 0xc4, 0xfe, 0x84, 0x31,
+	0xfe, 0xde, 0xdb, 0x6e, 0xa6, 0x55, 0x18, 0x55, 0x51, 0x9d, 0x99, 0x21, 0x9a, 0xbb, 0xfe, 0x6b,
+	0xcf, 0xa4, 0x76, 0x56, 0x51, 0x9d, 0x9a, 0x34, 0x9c, 0x9a, 0xa6, 0x54, 0xfe, 0x08, 0x61, 0x00,
+	0xfd, 0xc3, 0xfe, 0x42, 0x49, 0x05, 0x04, 0x6e, 0x7f, 0x94, 0xee, 0xfe, 0x42, 0x6a, 0xa4, 0x66,
+	0xc0, 0x6e, 0x9a, 0xbc, 0x26, 0xfe, 0xef, 0x9e, 0xa3, 0x76, 0xfe, 0xbd, 0xd7, 0x9d, 0x9a, 0x09,
+	0x65, 0xc1, 0x56, 0x3d, 0x0d, 0x9b, 0xab, 0x9d, 0x99, 0xfe, 0x10, 0xa2, 0x00, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xd7, 0x14, 0x17, 0x21, 0x2c, 0x69, 0x2c, 0xc2, 0x31, 0xfe, 0xbd, 0xf7, 0x04, 0x31, 0x9b,
+	0xab, 0xfe, 0x32, 0x09, 0x07, 0xad, 0x01, 0x22, 0x7a, 0x6e, 0xc0, 0x01, 0xfe, 0x00, 0x23, 0x02,
+	0xfe, 0x9d, 0x35, 0xfe, 0x4a, 0x8a, 0x00, 0xfd, 0xc4, 0x6f, 0xfe, 0x94, 0xf3, 0xb0, 0x10, 0x7f,
+	0xa5, 0x55, 0x66, 0x55, 0x51, 0x12, 0xa2, 0x78, 0x99, 0xcb, 0x26, 0xa4, 0x76, 0x56, 0x51, 0x9d,
+	0xaa, 0x9d, 0x99, 0x9b, 0xab, 0xa6, 0x65, 0xfe, 0x10, 0xc3, 0x00, 0xfd, 0xc4, 0xad, 0x11, 0xfe,
+	0x8c, 0x92, 0x04, 0xa2, 0x76, 0x6f, 0x95, 0xde, 0xfe, 0x42, 0x6a, 0xa4, 0x66, 0xc0, 0x6e, 0x9b,
+	0xab, 0xa8, 0x54, 0xfe, 0xef, 0x7d, 0xa4, 0x66, 0xfe, 0xbd, 0xf8, 0x9c, 0x99, 0xa3, 0x77, 0x61,
+	0x5a, 0xc2, 0x9a, 0xbb, 0x9c, 0xab, 0x9c, 0xa9, 0xfe, 0x08, 0x61, 0x00, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xd5, 0x6e, 0xaa, 0x15, 0xfe, 0xd6, 0xba, 0x2c, 0x69, 0x2c, 0xc1, 0x25, 0x6f, 0x09, 0x04, 0x31,
+	0x30, 0xfe, 0x29, 0xe8, 0x0e, 0x01, 0x22, 0x7a, 0x6e, 0xc0, 0x01, 0x0e, 0xfe, 0x5b, 0x2d, 0xb0,
+	0x00, 0xfe, 0x31, 0xa6, 0x00, 0xfd, 0xc5, 0xa5, 0x56, 0x35, 0xaa, 0x43, 0xa3, 0x66, 0x2c, 0x51,
+	0x55, 0x35, 0x0d, 0x21, 0x9a, 0xbb, 0xfe, 0x6b, 0xcf, 0xa4, 0x76, 0x56, 0x51, 0x51, 0x9d, 0x99,
+	0x9a, 0xbc, 0x08, 0xfe, 0x21, 0x45, 0x00, 0xfd, 0xc5, 0xa8, 0x44, 0xfe, 0x7c, 0x31, 0xac, 0x22,
+	0xa2, 0x87, 0x1d, 0x96, 0xdd, 0xfe, 0x42, 0x6a, 0xa4, 0x66, 0xc0, 0x6e, 0x9c, 0xab, 0x3e, 0xfe,
+	0xef, 0x5d, 0x31, 0x18, 0x9b, 0xaa, 0xa3, 0x77, 0x55, 0xc3, 0x99, 0xbc, 0x9d, 0xaa, 0x9a, 0xba,
+	0x05, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xd4, 0xa7, 0x16, 0xfe, 0xce, 0x59, 0x2c, 0x69, 0x2c, 0xc1,
+	0x25, 0x6f, 0xfe, 0xbd, 0xf7, 0x04, 0x31, 0x30, 0x2e, 0xfe, 0x00, 0x03, 0xfe, 0x29, 0xa7, 0x22,
+	0x7a, 0x6e, 0xc0, 0xa2, 0x77, 0x07, 0xfe, 0x6b, 0xaf, 0xaa, 0x33, 0xfe, 0x19, 0x04, 0x00, 0x6e,
+	0x00, 0xfd, 0xc4, 0xa9, 0x34, 0xfe, 0xbd, 0xf8, 0xa7, 0x54, 0xa3, 0x66, 0x2c, 0x51, 0x55, 0x35,
+	0x9c, 0xaa, 0x1c, 0x9b, 0xaa, 0x26, 0xa4, 0x76, 0x56, 0x55, 0x21, 0x9d, 0x99, 0x9b, 0xab, 0x3e,
+	0x94, 0xfe, 0x00, 0xfd, 0xc6, 0xa5, 0x55, 0xfe, 0x73, 0xaf, 0xaf, 0x00, 0xa3, 0x77, 0x25, 0x39,
+	0xfe, 0x3a, 0x6a, 0xa4, 0x76, 0x56, 0xa2, 0x76, 0x02, 0xa5, 0x66, 0xfe, 0xef, 0x5d, 0x31, 0x18,
+	0x9b, 0xaa, 0xa3, 0x76, 0x35, 0xc3, 0x20, 0x5a, 0x97, 0xdc, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xd3,
+	0x15, 0xfe, 0xbd, 0xf7, 0x2c, 0x69, 0x2c, 0xc1, 0x25, 0x31, 0x11, 0x9c, 0xab, 0x31, 0x99, 0xcc,
+	0x2e, 0x98, 0xec, 0xaa, 0x22, 0x22, 0x7a, 0xc0, 0x6f, 0x7e, 0x07, 0xfe, 0x7c, 0x11, 0xa5, 0x55,
+	0xfe, 0x10, 0x82, 0x00, 0x05, 0x00, 0xfd, 0xc5, 0x09, 0xfe, 0xc6, 0x59, 0x1c, 0xa4, 0x66, 0x2c,
+	0x51, 0x55, 0x51, 0x0d, 0xa2, 0x77, 0x9a, 0xbb, 0x26, 0xa4, 0x76, 0x56, 0x65, 0x9d, 0x9a, 0x08,
+	0x9b, 0xaa, 0xa4, 0x66, 0x99, 0xcb, 0x00, 0xfd, 0xc7, 0x14, 0xfe, 0x63, 0x6e, 0xfe, 0xad, 0x96,
+	0xa4, 0x66, 0x7f, 0x95, 0xdd, 0x3a, 0xa4, 0x76, 0x56, 0x2a, 0x02, 0xa5, 0x66, 0x04, 0xa5, 0x55,
+	0xfe, 0xb5, 0xd7, 0x9c, 0xaa, 0xa3, 0x76, 0x35, 0xc0, 0x66, 0xc0, 0x59, 0x97, 0xdd, 0x6f, 0x93,
+	0xfe, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xd1, 0x07, 0x21, 0xfe, 0xff, 0xdf, 0xc0, 0x69, 0x2c, 0xc0,
+	0x25, 0x31, 0xfe, 0xbe, 0x18, 0x21, 0x31, 0x9b, 0xab, 0x12, 0x15, 0x3e, 0x22, 0x7a, 0xc0, 0x6f,
+	0x7e, 0xfe, 0x00, 0x02, 0xfe, 0x84, 0x72, 0x11, 0x05, 0x00, 0xfd, 0xc8, 0xfe, 0x4a, 0x8a, 0xfe,
+	0xce, 0x9a, 0x1c, 0xa5, 0x55, 0x2c, 0x18, 0x09, 0x51, 0x9c, 0xaa, 0x1c, 0x9b, 0xaa, 0xfe, 0x6b,
+	0xcf, 0x11, 0x56, 0x65, 0x9d, 0x9a, 0x51, 0x9b, 0xab, 0x7e, 0x61, 0x00, 0xfd, 0xc8, 0x6e, 0xfe,
+	0x5b, 0x0c, 0xfe, 0xad, 0x96, 0xa4, 0x66, 0x7f, 0x96, 0xcc, 0x3a, 0x25, 0x56, 0x2a, 0x02, 0xa6,
+	0x56, 0xfe, 0xef, 0x7d, 0xa4, 0x66, 0xfe, 0xb5, 0xb7, 0x9d, 0x99, 0x35, 0x30, 0xc0, 0x69, 0x30,
+	0x21, 0x97, 0xcd, 0xa2, 0x77, 0xfe, 0x42, 0x49, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xd0, 0xfe, 0x8c,
+	0x92, 0xfe, 0xff, 0xbe, 0xa2, 0x67, 0x65, 0x6b, 0xc0, 0x25, 0x31, 0x34, 0x95, 0xce, 0x31, 0x9c,
+	0xaa, 0xfe, 0x32, 0x09, 0x0e, 0xad, 0x00, 0x22, 0x7a, 0xc0, 0x36, 0x39, 0x0e, 0xfe, 0x8c, 0x92,
+	0x3d, 0x00, 0xfd, 0xca, 0xfe, 0x63, 0x4d, 0xfe, 0xd6, 0xba, 0x1c, 0xa6, 0x45, 0x2c, 0x18, 0x09,
+	0x51, 0x0d, 0x1c, 0x9b, 0xaa, 0x26, 0x11, 0x56, 0x3d, 0x26, 0x9d, 0xaa, 0x9c, 0xaa, 0x56, 0xa3,
+	0x76, 0x00, 0xfd, 0xca, 0x19, 0xfe, 0xa5, 0x76, 0xa5, 0x65, 0xa2, 0x77, 0x94, 0xee, 0xfe, 0x3a,
+	0x4a, 0x25, 0x56, 0x2a, 0x9b, 0xbb, 0x0d, 0x18, 0xa3, 0x66, 0xfe, 0xad, 0x96, 0x51, 0x35, 0x29,
+	0xc0, 0x21, 0x29, 0x9d, 0x9a, 0x98, 0xcc, 0xa3, 0x67, 0xfe, 0x31, 0xa6, 0x00, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xcd, 0x07, 0xfe, 0x63, 0x6e, 0xfe, 0xf7, 0x9d, 0x31, 0x65, 0x2c, 0xc0, 0x25, 0x31, 0x96,
+	0xdd, 0xfe, 0x8c, 0xb3, 0xfe, 0xff, 0xff, 0x18, 0xfe, 0x4a, 0xab, 0x07, 0xad, 0x01, 0x22, 0x7a,
+	0xc0, 0x36, 0x7a, 0xfe, 0x00, 0x03, 0xfe, 0x8c, 0xb3, 0x99, 0xcb, 0x00, 0xfd, 0xcb, 0xfe, 0x7b,
+	0xf0, 0x1c, 0xc0, 0x18, 0xa2, 0x76, 0x18, 0x55, 0x51, 0x0d, 0x1c, 0x9b, 0xaa, 0x26, 0xa4, 0x76,
+	0x56, 0x66, 0x26, 0x9d, 0xaa, 0x2a, 0x9c, 0xab, 0xa6, 0x64, 0xfe, 0x08, 0x61, 0x00, 0xfd, 0xca,
+	0xfe, 0x4a, 0x8a, 0x2d, 0x25, 0x6f, 0x93, 0xef, 0xfe, 0x3a, 0x2a, 0xa6, 0x54, 0x16, 0x2a, 0x9a,
+	0xbc, 0x29, 0xfe, 0xf7, 0xbe, 0x2c, 0x21, 0xc0, 0x7f, 0x59, 0x21, 0xc0, 0x26, 0x9b, 0xbb, 0x9a,
+	0xbb, 0x11, 0xfe, 0x18, 0xe4, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xcb, 0x0c, 0x35, 0xfe, 0xe7, 0x3c,
+	0xa6, 0x55, 0x65, 0x2c, 0xc0, 0x25, 0x31, 0x99, 0xcb, 0x11, 0x2c, 0xc0, 0x01, 0x00, 0xad, 0x02,
+	0x22, 0x7a, 0xc0, 0x6f, 0x7e, 0x15, 0xfe, 0x94, 0xd3, 0x97, 0xdd, 0x00, 0xfd, 0xcb, 0x19, 0xfe,
+	0x8c, 0xb2, 0x1c, 0xc0, 0x1d, 0x6e, 0x18, 0x51, 0x35, 0x9c, 0xaa, 0x1c, 0x9c, 0x9a, 0xfe, 0x6b,
+	0xaf, 0x11, 0x56, 0x66, 0x51, 0x9d, 0x99, 0x9d, 0x9a, 0x9c, 0xaa, 0x0d, 0xfe, 0x10, 0xc3, 0x00,
+	0xfd, 0xcb, 0x05, 0x2d, 0xa6, 0x65, 0x6e, 0xfe, 0x84, 0x72, 0xfe, 0x3a, 0x4a, 0xa5, 0x65, 0x16,
+	0xa2, 0x77, 0x99, 0xbc, 0xb0, 0x10, 0xfe, 0xff, 0xff, 0x51, 0xfe, 0x9d, 0x14, 0xa2, 0x77, 0x6e,
+	0x21, 0xc2, 0x9a, 0xbb, 0x04, 0x55, 0x19, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xca, 0x0b, 0xfe, 0xd6,
+	0xba, 0xa9, 0x44, 0x69, 0x2c, 0xc0, 0x25, 0x31, 0x9c, 0xaa, 0xfe, 0x7c, 0x31, 0xfe, 0xef, 0x9e,
+	0x31, 0x38, 0x00, 0xfe, 0x29, 0xc8, 0x9c, 0x9a, 0x7a, 0x6e, 0x6b, 0x7e, 0x0e, 0xfe, 0x8c, 0xb3,
+	0x24, 0x00, 0xfd, 0xcc, 0xa6, 0x45, 0x21, 0xad, 0x21, 0xc0, 0x2c, 0x1d, 0x18, 0x51, 0x55, 0x9c,
+	0xaa, 0x21, 0x9c, 0xab, 0xfe, 0x6b, 0xaf, 0x11, 0x09, 0xc0, 0x30, 0x40, 0x9d, 0xaa, 0x9b, 0xab,
+	0xa7, 0x54, 0xfe, 0x21, 0x45, 0x96, 0xed, 0xfd, 0xcc, 0x05, 0x2d, 0xa6, 0x65, 0x6e, 0x3d, 0xfe,
+	0x3a, 0x4a, 0xa5, 0x65, 0x51, 0xa3, 0x66, 0x97, 0xcd, 0xfe, 0x94, 0xb3, 0xfe, 0xff, 0xff, 0x04,
+	0xfe, 0x94, 0xf4, 0x26, 0x66, 0xc2, 0x66, 0x98, 0xbc, 0x7e, 0x0d, 0x00, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xc9, 0x07, 0xfe, 0xb5, 0xd7, 0xb0, 0x10, 0x69, 0x2c, 0xc0, 0x25, 0x31, 0x1d, 0x11, 0xfe, 0xe7,
+	0x1c, 0x31, 0x34, 0x00, 0xfe, 0x29, 0xc8, 0x22, 0x7a, 0x6e, 0xc0, 0x7f, 0x0e, 0xfe, 0x8c, 0x92,
+	0x9a, 0xbb, 0x00, 0xfd, 0xcd, 0xaa, 0x23, 0xfe, 0xb5, 0xb7, 0xaa, 0x32, 0x6e, 0x2c, 0x1d, 0x18,
+	0x51, 0x55, 0x9c, 0xaa, 0x6f, 0x9d, 0xaa, 0xfe, 0x6b, 0xaf, 0x11, 0x56, 0xc0, 0x9d, 0xaa, 0x41,
+	0x9d, 0xa9, 0x9b, 0xab, 0xa7, 0x54, 0x93, 0xfe, 0xfe, 0x00, 0x00, 0xfd, 0xcd, 0xfe, 0x4a, 0x8a,
+	0xfe, 0xad, 0x96, 0xa6, 0x55, 0x65, 0x21, 0x3a, 0xa4, 0x76, 0x51, 0x25, 0x96, 0xbe, 0xfe, 0xa5,
+	0x55, 0xfe, 0xff, 0xff, 0x98, 0xcd, 0xfe, 0x94, 0xd3, 0xa5, 0x55, 0x21, 0xc0, 0x1c, 0xc0, 0x55,
+	0x97, 0xcd, 0xa4, 0x66, 0x05, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xc8, 0xfe, 0x8c, 0x92, 0xfe, 0xff,
+	0xde, 0x2c, 0x25, 0x2c, 0xc1, 0x31, 0x39, 0xad, 0x22, 0x31, 0xfe, 0xad, 0x76, 0xfe, 0x00, 0x00,
+	0xfe, 0x29, 0xc7, 0x22, 0x7a, 0x2a, 0xc0, 0xa2, 0x77, 0x07, 0x1d, 0x3d, 0x00, 0xfd, 0xce, 0x09,
+	0xfe, 0xc6, 0x38, 0xa6, 0x55, 0x7f, 0x2c, 0x55, 0x18, 0x04, 0x55, 0x9c, 0xaa, 0x21, 0x9c, 0xab,
+	0xfe, 0x6b, 0xaf, 0xa5, 0x65, 0x56, 0xc0, 0x51, 0x9d, 0xaa, 0x40, 0x9b, 0xab, 0xa4, 0x76, 0x99,
+	0xcb, 0xfe, 0x00, 0x00, 0xfd, 0xce, 0xfe, 0x52, 0xcb, 0xfe, 0xad, 0x96, 0xa6, 0x55, 0x9d, 0xaa,
+	0x39, 0x9b, 0xaa, 0xa2, 0x78, 0x65, 0xa2, 0x77, 0x96, 0xbe, 0xfe, 0xbd, 0xf7, 0xb0, 0x00, 0x94,
+	0xef, 0x93, 0xee, 0xa4, 0x66, 0x66, 0xc0, 0x59, 0x1c, 0x39, 0x98, 0xcd, 0xa5, 0x55, 0xfe, 0x31,
+	0x86, 0x94, 0xee, 0xfd, 0xfd, 0xfd, 0xfd, 0xc5, 0x0c, 0xfe, 0x53, 0x0c, 0xfe, 0xef, 0x7d, 0x31,
+	0x65, 0x2c, 0xc0, 0x25, 0x31, 0x35, 0x7f, 0x31, 0xfe, 0xc6, 0x39, 0x00, 0x01, 0x9d, 0x9a, 0xc0,
+	0x6e, 0xc0, 0x01, 0x07, 0xfe, 0x7c, 0x11, 0xa2, 0x76, 0x00, 0xfd, 0xcf, 0xfe, 0x42, 0x6a, 0xfe,
+	0xce, 0x79, 0xa3, 0x77, 0xa3, 0x66, 0x31, 0x51, 0x66, 0x51, 0x35, 0x0d, 0xa3, 0x67, 0x9b, 0xbb,
+	0xfe, 0x6b, 0xaf, 0x11, 0x56, 0xc0, 0x51, 0x21, 0x3e, 0x9b, 0xbb, 0xa3, 0x66, 0x19, 0xfe, 0x00,
+	0x00, 0xfd, 0xcf, 0xfe, 0x5b, 0x0c, 0xfe, 0xad, 0xb7, 0x39, 0x9a, 0xbc, 0xfe, 0x42, 0x8b, 0x11,
+	0xc1, 0x6f, 0x99, 0xbc, 0xfe, 0xd6, 0x9a, 0x31, 0xfe, 0xbd, 0xf7, 0x97, 0xcd, 0xa4, 0x66, 0x12,
+	0xc0, 0x66, 0x7f, 0x9a, 0xbb, 0x35, 0xa2, 0x77, 0xfe, 0x10, 0xa2, 0x00, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xc4, 0x27, 0xfe, 0xde, 0xfb, 0xa7, 0x55, 0x69, 0x2c, 0xc0, 0x25, 0x31, 0x94, 0xee, 0x93, 0xef,
+	0x31, 0x28, 0xfe, 0x00, 0x03, 0xaa, 0x11, 0x6e, 0x25, 0x2a, 0xc0, 0xa2, 0x87, 0xfe, 0x00, 0x02,
+	0xfe, 0x6b, 0xaf, 0xa8, 0x44, 0xfe, 0x00, 0x20, 0x00, 0xfd, 0xcf, 0xfe, 0x5b, 0x2d, 0xfe, 0xd6,
+	0xba, 0x7f, 0xa4, 0x66, 0xa5, 0x55, 0x51, 0x18, 0x04, 0x55, 0x0d, 0x28, 0x9c, 0xaa, 0x21, 0xa5,
+	0x65, 0x09, 0xc0, 0x51, 0x21, 0x9d, 0x9a, 0x9c, 0xaa, 0xc0, 0x39, 0xfe, 0x00, 0x00, 0xfd, 0xcf,
+	0x6e, 0xfe, 0x63, 0x4d, 0xfe, 0xb5, 0xd7, 0xa5, 0x66, 0x97, 0xcc, 0xfe, 0x32, 0x29, 0xa4, 0x76,
+	0xc1, 0x56, 0x6e, 0xfe, 0xe7, 0x3d, 0x31, 0x21, 0x9d, 0xaa, 0xa2, 0x77, 0x55, 0xc2, 0x98, 0xcc,
+	0x6f, 0x9b, 0xba, 0xfe, 0x00, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xc3, 0x07, 0xfe, 0xbd, 0xd7, 0x2c,
+	0x69, 0x2c, 0xc0, 0x25, 0x31, 0x9a, 0xbb, 0x09, 0x31, 0x18, 0xfe, 0x3a, 0x4a, 0xfe, 0x00, 0x63,
+	0xa9, 0x33, 0x51, 0x2a, 0xc0, 0xa2, 0x77, 0x1a, 0xfe, 0x5b, 0x2d, 0xae, 0x11, 0xfe, 0x10, 0x82,
+	0x00, 0xfd, 0xcf, 0x6f, 0x29, 0xfe, 0xd6, 0xda, 0x7b, 0xa5, 0x55, 0x31, 0x51, 0x18, 0x04, 0x55,
+	0x9c, 0xaa, 0xa3, 0x67, 0x9b, 0xbb, 0xfe, 0x6b, 0xaf, 0xa5, 0x65, 0x56, 0xc0, 0x51, 0x21, 0x9d,
+	0xaa, 0x9d, 0x99, 0x0e, 0xa6, 0x65, 0xfe, 0x08, 0x61, 0x9d, 0xaa, 0xfd, 0xcf, 0xa2, 0x77, 0x21,
+	0xfe, 0xbd, 0xf8, 0xa4, 0x66, 0x34, 0x1e, 0x16, 0x52, 0xa2, 0x77, 0x9b, 0xbb, 0x15, 0xfe, 0xf7,
+	0xdf, 0x65, 0x05, 0x7e, 0xc3, 0x51, 0x98, 0xcc, 0xa5, 0x56, 0xfe, 0x4a, 0x8a, 0xfe, 0x00, 0x00,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xc2, 0x11, 0xfe, 0xff, 0xde, 0x2c, 0x25, 0x2c, 0x25, 0x31, 0x51, 0xfe,
+	0x7c, 0x31, 0xfe, 0xe7, 0x5d, 0x31, 0xfe, 0x73, 0xef, 0x00, 0xad, 0x02, 0x22, 0x2a, 0xc0, 0x3e,
+	0x99, 0xbc, 0xae, 0x20, 0xfe, 0x9d, 0x35, 0xfe, 0x19, 0x04, 0x00, 0xfd, 0xd0, 0xa4, 0x56, 0xfe,
+	0x84, 0x72, 0x1c, 0x5a, 0xa6, 0x54, 0x31, 0x51, 0x66, 0x04, 0x55, 0x9c, 0xaa, 0x2d, 0x9b, 0xbb,
+	0x21, 0x11, 0x09, 0xc0, 0x51, 0x21, 0x51, 0x9d, 0x99, 0x02, 0xa8, 0x55, 0xfe, 0x18, 0xc3, 0x9a,
+	0xbb, 0xfd, 0xd0, 0xa5, 0x55, 0x09, 0xaf, 0x10, 0xa3, 0x76, 0x3d, 0xfe, 0x32, 0x09, 0xa5, 0x65,
+	0x56, 0xa2, 0x77, 0x98, 0xbc, 0xfe, 0x8c, 0xb2, 0x31, 0x99, 0xcc, 0xfe, 0x8c, 0x92, 0xa5, 0x55,
+	0x66, 0xc0, 0x66, 0x0d, 0x25, 0x99, 0xbc, 0xa6, 0x55, 0xfe, 0x21, 0x45, 0x00, 0xfd, 0xfd, 0xfd,
+	0xfd, 0x6e, 0xfe, 0x42, 0x6a, 0x04, 0x31, 0x65, 0x2c, 0xc0, 0x25, 0x31, 0xfe, 0x9c, 0xf3, 0xab,
+	0x23, 0xad, 0x21, 0xfe, 0xa5, 0x55, 0x00, 0xfe, 0x29, 0xc8, 0x22, 0x7e, 0xc0, 0x7f, 0x22, 0x0d,
+	0xfe, 0x9d, 0x35, 0xfe, 0x31, 0xa6, 0x00, 0x05, 0x00, 0xfd, 0xcf, 0xa7, 0x34, 0x08, 0xfe, 0xde,
+	0xfb, 0x56, 0x18, 0x31, 0x51, 0x18, 0x04, 0x55, 0x9c, 0xaa, 0xa3, 0x67, 0x9b, 0xbb, 0xfe, 0x6b,
+	0xaf, 0xa5, 0x65, 0x56, 0xc0, 0x55, 0x21, 0x51, 0x9d, 0x9a, 0x9b, 0xba, 0x1c, 0xfe, 0x21, 0x45,
+	0x96, 0xed, 0xfd, 0xd1, 0xa8, 0x34, 0xfe, 0x8c, 0x92, 0xae, 0x11, 0x66, 0xfe, 0x5b, 0x2d, 0x9a,
+	0xab, 0xa2, 0x87, 0x56, 0xa2, 0x77, 0x95, 0xae, 0xfe, 0xb5, 0xb7, 0xfe, 0xff, 0xff, 0x93, 0xff,
+	0x25, 0xa4, 0x66, 0x08, 0xc2, 0x9a, 0xab, 0x51, 0xc0, 0x14, 0x00, 0xfd, 0xfd, 0xfd, 0xfc, 0x1a,
+	0xfe, 0xce, 0x79, 0xab, 0x33, 0x69, 0x2c, 0xc0, 0x25, 0x31, 0xfe, 0xc6, 0x18, 0x99, 0xac, 0x31,
+	0x39, 0x00, 0xad, 0x02, 0x9d, 0x9a, 0x2a, 0xc0, 0x36, 0x7a, 0x99, 0xbc, 0x0d, 0xfe, 0x4a, 0x8a,
+	0x00, 0x6e, 0x00, 0xfd, 0xd0, 0x21, 0xfe, 0xad, 0x96, 0xab, 0x32, 0x66, 0xa7, 0x44, 0x31, 0x1d,
+	0x18, 0x51, 0x55, 0x9b, 0xbb, 0xa3, 0x67, 0x9c, 0xaa, 0xfe, 0x6b, 0xaf, 0xa5, 0x65, 0x09, 0xc0,
+	0x65, 0x41, 0x9d, 0xaa, 0x51, 0x02, 0x0d, 0x93, 0xfe, 0xfe, 0x00, 0x00, 0xfd, 0xd2, 0xac, 0x12,
+	0xfe, 0x9d, 0x14, 0xab, 0x32, 0x9a, 0xbc, 0xfe, 0x3a, 0x4a, 0xa2, 0x77, 0xc1, 0x7e, 0x0a, 0xfe,
+	0xd6, 0xdb, 0x31, 0xfe, 0xad, 0x96, 0x9a, 0xbb, 0x0d, 0x66, 0x59, 0x7a, 0x39, 0x21, 0xa5, 0x65,
+	0x95, 0xee, 0x00, 0xfd, 0xfd, 0xfd, 0xfc, 0x39, 0x2c, 0xc2, 0x69, 0x31, 0x30, 0xfe, 0x7c, 0x31,
+	0x31, 0x9c, 0xaa, 0x36, 0x9c, 0xaa, 0xa4, 0x76, 0x51, 0x2a, 0xc0, 0xa2, 0x77, 0xfe, 0x00, 0x02,
+	0xfe, 0x8c, 0x92, 0x97, 0xdc, 0x00, 0xfd, 0xd3, 0xae, 0x01, 0xfe, 0xb5, 0xd7, 0xa9, 0x43, 0x1c,
+	0x2c, 0xc0, 0x1d, 0x18, 0x51, 0x55, 0x9b, 0xab, 0x21, 0x9c, 0xab, 0xfe, 0x6b, 0xaf, 0x11, 0x56,
+	0xc0, 0x3d, 0x26, 0x9d, 0xaa, 0x51, 0x9b, 0xab, 0xa6, 0x55, 0x99, 0xca, 0xfe, 0x00, 0x00, 0xfd,
+	0xd3, 0xfe, 0x42, 0x29, 0xfe, 0xad, 0x76, 0xa9, 0x33, 0x08, 0x0a, 0xa7, 0x64, 0x02, 0x11, 0x9d,
+	0x9a, 0xa6, 0x55, 0x18, 0xa2, 0x67, 0xfe, 0x94, 0xd3, 0x01, 0x08, 0x59, 0x39, 0x3e, 0x9c, 0xbb,
+	0x21, 0xa6, 0x55, 0xfe, 0x29, 0x86, 0x00, 0xfd, 0xfd, 0xfd, 0xf9, 0x6e, 0x11, 0xfe, 0xef, 0x7d,
+	0xa4, 0x66, 0x65, 0x6b, 0x25, 0x31, 0x25, 0xfe, 0x84, 0x31, 0xfe, 0xe7, 0x3c, 0x31, 0xfe, 0x73,
+	0xcf, 0x00, 0xad, 0x02, 0x9d, 0x9a, 0x2a, 0xc0, 0x01, 0x0e, 0xfe, 0x73, 0xd0, 0xa4, 0x65, 0x00,
+	0xfd, 0xd4, 0xfe, 0x42, 0x4a, 0xfe, 0xc6, 0x38, 0xa6, 0x55, 0xc0, 0x2c, 0xc0, 0x55, 0x18, 0x04,
+	0x35, 0x9b, 0xaa, 0x21, 0x9d, 0x9a, 0xfe, 0x6b, 0xaf, 0x11, 0x56, 0xc0, 0x3d, 0x29, 0x41, 0x9d,
+	0xaa, 0x9c, 0xaa, 0xa3, 0x67, 0x60, 0x00, 0xfd, 0xd4, 0x28, 0xfe, 0xb5, 0xd7, 0xa5, 0x66, 0x3d,
+	0xfe, 0x29, 0xe8, 0x11, 0x51, 0x11, 0x98, 0xad, 0xfe, 0x8c, 0x92, 0xfe, 0xff, 0xff, 0x98, 0xcd,
+	0xfe, 0x84, 0x72, 0x08, 0x55, 0xc2, 0x9a, 0xbb, 0x30, 0x3d, 0x14, 0x51, 0xfd, 0xfd, 0xfd, 0xf8,
+	0xa0, 0x8b, 0xfe, 0xce, 0x79, 0x2c, 0x69, 0x2c, 0xc0, 0x25, 0x31, 0xfe, 0xad, 0x75, 0x09, 0x31,
+	0xfe, 0xad, 0x76, 0x00, 0xfe, 0x29, 0xc8, 0x9c, 0xaa, 0x2a, 0xc0, 0xa2, 0x77, 0x99, 0xbd, 0xfe,
+	0x4a, 0xcc, 0xfe, 0x94, 0xf4, 0xfe, 0x08, 0x82, 0x00, 0xfd, 0xd4, 0xfe, 0x52, 0xec, 0x39, 0xa4,
+	0x66, 0x2d, 0x31, 0x2c, 0x55, 0x18, 0x04, 0x35, 0x9b, 0xaa, 0x21, 0x52, 0xfe, 0x6b, 0xaf, 0xa5,
+	0x65, 0x56, 0xc0, 0x3d, 0x52, 0x41, 0x50, 0x9c, 0xab, 0x25, 0xa2, 0x87, 0x00, 0xfd, 0xd4, 0xa2,
+	0x77, 0xfe, 0x73, 0xcf, 0xfe, 0xc6, 0x39, 0x69, 0x1d, 0x9c, 0xaa, 0xa2, 0x77, 0x65, 0xa2, 0x77,
+	0x94, 0xbf, 0xfe, 0xbd, 0xf8, 0x31, 0x18, 0x95, 0xdd, 0x08, 0x55, 0xc1, 0x55, 0x97, 0xde, 0xa6,
+	0x44, 0x94, 0xfe, 0x00, 0xfd, 0xfd, 0xfd, 0xf8, 0x25, 0xfe, 0xff, 0xde, 0x6b, 0xc1, 0x25, 0x31,
+	0x97, 0xdc, 0xfe, 0x84, 0x72, 0x31, 0x98, 0xcc, 0x00, 0xac, 0x03, 0x55, 0xc1, 0x39, 0x2a, 0xa2,
+	0x77, 0xfe, 0x9d, 0x35, 0xfe, 0x29, 0x66, 0x00, 0xfd, 0xd4, 0x14, 0x1c, 0xfe, 0xd6, 0xba, 0x21,
+	0xa2, 0x77, 0x31, 0x2c, 0x55, 0x55, 0x04, 0x35, 0x9b, 0xaa, 0x21, 0x52, 0xfe, 0x6b, 0xaf, 0xa5,
+	0x65, 0x56, 0xc0, 0x66, 0x51, 0x1c, 0x40, 0x9c, 0xbb, 0x55, 0xa7, 0x54, 0xfe, 0x08, 0x41, 0x00,
+	0xfd, 0xd4, 0xa7, 0x44, 0xfe, 0x8c, 0x92, 0xaf, 0x11, 0x99, 0xbb, 0x0a, 0xa6, 0x65, 0x3d, 0xc1,
+	0x41, 0xfe, 0xe7, 0x3c, 0x31, 0x08, 0x51, 0x6e, 0xc0, 0x34, 0x39, 0x9c, 0xaa, 0x9a, 0xab, 0xa7,
+	0x55, 0xfe, 0x29, 0x45, 0x96, 0xdd, 0xfd, 0xfd, 0xfd, 0xf6, 0xfe, 0x32, 0x09, 0xfe, 0xef, 0x5c,
+	0x31, 0x65, 0x2c, 0x25, 0x31, 0x51, 0xfe, 0x7c, 0x10, 0xfe, 0xef, 0x7d, 0x31, 0xfe, 0x52, 0xec,
+	0x1a, 0xac, 0x00, 0x2a, 0x6b, 0x6e, 0x3e, 0x1a, 0x39, 0xfe, 0x52, 0xcb, 0x00, 0xfd, 0xd5, 0xa4,
+	0x66, 0xfe, 0x7c, 0x31, 0xfe, 0xd6, 0xda, 0x7f, 0xa3, 0x66, 0xa5, 0x66, 0x2c, 0x1d, 0x0e, 0x62,
+	0x35, 0x9b, 0xaa, 0xa3, 0x78, 0x51, 0xfe, 0x6b, 0xaf, 0x11, 0x09, 0xc0, 0x66, 0x30, 0x21, 0x9d,
+	0x9a, 0x25, 0x9d, 0x9a, 0x21, 0xfe, 0x18, 0xc3, 0x00, 0xfd, 0xd5, 0xad, 0x12, 0xfe, 0xa5, 0x55,
+	0xaa, 0x33, 0xfe, 0x84, 0x72, 0xfe, 0x21, 0xa8, 0x09, 0x55, 0x09, 0x9a, 0xbb, 0xfe, 0x73, 0xf0,
+	0x31, 0x9b, 0xab, 0x1d, 0x39, 0xc0, 0x34, 0xc1, 0x29, 0x35, 0x29, 0xfe, 0x00, 0x20, 0x00, 0xfd,
+	0xfd, 0xfd, 0xf5, 0xfe, 0xbd, 0xf7, 0x2c, 0x69, 0x2c, 0xc0, 0x25, 0x31, 0x21, 0xa6, 0x55, 0x31,
+	0xfe, 0x9d, 0x14, 0x00, 0xfe, 0x29, 0xc8, 0x2a, 0x6b, 0xc0, 0xa2, 0x86, 0xfe, 0x00, 0x03, 0x35,
+	0x3d, 0x00, 0xfd, 0xd6, 0xa7, 0x45, 0x39, 0xfe, 0xde, 0xfb, 0x66, 0xa5, 0x55, 0xa4, 0x66, 0x2c,
+	0x55, 0x0e, 0x62, 0x55, 0x3e, 0xa4, 0x77, 0x14, 0xfe, 0x6b, 0xaf, 0xa5, 0x65, 0x56, 0xc1, 0x51,
+	0x21, 0x9d, 0xaa, 0x40, 0x9b, 0xbb, 0x21, 0xfe, 0x21, 0x45, 0x00, 0xfd, 0xd6, 0xfe, 0x52, 0xab,
+	0x18, 0xa3, 0x66, 0x2a, 0x26, 0x3d, 0x3a, 0xa2, 0x87, 0xfe, 0x00, 0xe6, 0xfe, 0xb5, 0x96, 0xfe,
+	0xff, 0xff, 0xfe, 0xc6, 0x18, 0x92, 0xef, 0x39, 0x34, 0x5a, 0x34, 0x41, 0x98, 0xcc, 0xa7, 0x55,
+	0x91, 0xfe, 0x00, 0xfd, 0xfd, 0xfd, 0xf4, 0xfe, 0x6b, 0xaf, 0xfe, 0xf7, 0xbe, 0xa2, 0x77, 0x25,
+	0x2c, 0x25, 0x31, 0x1c, 0x18, 0x31, 0x97, 0xcd, 0x00, 0x01, 0x41, 0x6b, 0x6e, 0x7e, 0x9b, 0xab,
+	0xad, 0x31, 0xfe, 0x94, 0xf4, 0xfe, 0x10, 0x82, 0x00, 0xfd, 0xd6, 0xaa, 0x23, 0xfe, 0xa5, 0x35,
+	0xae, 0x10, 0x12, 0xa5, 0x66, 0xa4, 0x66, 0x2c, 0x1d, 0x55, 0x04, 0x55, 0x9b, 0xaa, 0x30, 0x9d,
+	0x9a, 0xfe, 0x6b, 0xaf, 0xa5, 0x65, 0x56, 0xc1, 0x51, 0x21, 0x0d, 0x9d, 0x9a, 0x3d, 0xa9, 0x44,
+	0x93, 0xfd, 0x00, 0xfd, 0xd6, 0xa2, 0x77, 0x29, 0xfe, 0xce, 0x79, 0x99, 0xbc, 0xfe, 0x21, 0xa8,
+	0x3d, 0x3a, 0x3d, 0xc0, 0x9c, 0x8a, 0x30, 0xa7, 0x44, 0xfe, 0x94, 0xf4, 0x9d, 0xa9, 0x34, 0x5a,
+	0x69, 0x31, 0x9a, 0xbb, 0x1c, 0xa6, 0x54, 0xfe, 0x10, 0xc3, 0x00, 0xfd, 0xfd, 0xfd, 0xf2, 0xa6,
+	0x26, 0x12, 0x2c, 0x69, 0x2c, 0x25, 0x6f, 0x25, 0x09, 0xfe, 0xe7, 0x5d, 0x31, 0xfe, 0x5b, 0x0c,
+	0x1a, 0xac, 0x00, 0x51, 0x36, 0x7a, 0xc0, 0x0b, 0xfe, 0x9d, 0x14, 0xfe, 0x39, 0xc7, 0x00, 0xfd,
+	0xd7, 0xae, 0x01, 0xfe, 0xad, 0xb6, 0xab, 0x32, 0x12, 0xa6, 0x66, 0x31, 0x2c, 0x1d, 0x0e, 0x04,
+	0x55, 0x9b, 0xaa, 0x30, 0x9d, 0x9a, 0x21, 0x11, 0x56, 0xc1, 0x51, 0x21, 0x51, 0x9d, 0x9a, 0x9c,
+	0xaa, 0x0d, 0x3d, 0x00, 0xfd, 0xd7, 0xa9, 0x33, 0x05, 0xad, 0x21, 0x11, 0x36, 0x3d, 0x56, 0xa2,
+	0x76, 0x99, 0xbd, 0xfe, 0x73, 0xf0, 0xfe, 0xff, 0xff, 0x30, 0x11, 0xa4, 0x66, 0x55, 0x66, 0x2a,
+	0x62, 0x0d, 0xa5, 0x66, 0x99, 0xbb, 0x00, 0xfd, 0xfd, 0xfd, 0xf2, 0xfe, 0x94, 0xd3, 0x2c, 0x69,
+	0x2c, 0xc0, 0x25, 0x31, 0xfe, 0xb5, 0xb6, 0x56, 0x31, 0xfe, 0xad, 0x76, 0x00, 0xfe, 0x29, 0xc8,
+	0x9d, 0x99, 0x36, 0xc0, 0x0d, 0xfe, 0x00, 0x03, 0x11, 0x99, 0xcc, 0x00, 0xfd, 0xd8, 0xfe, 0x42,
+	0x4a, 0xfe, 0xbd, 0xf7, 0x26, 0x62, 0x1d, 0x31, 0x2c, 0x1d, 0x0e, 0x62, 0x55, 0x9a, 0xbb, 0xa4,
+	0x67, 0x14, 0x21, 0xa5, 0x65, 0x56, 0xc1, 0x51, 0x21, 0x51, 0x51, 0x9b, 0xab, 0x39, 0x51, 0x00,
+	0xfd, 0xd8, 0xfe, 0x42, 0x29, 0xfe, 0xb5, 0xd7, 0xa3, 0x77, 0xfe, 0x4a, 0xab, 0x9c, 0x9a, 0x7f,
+	0xc0, 0xa2, 0x77, 0xfe, 0x00, 0xa5, 0xfe, 0xbd, 0xf7, 0x31, 0xfe, 0xb5, 0xd7, 0x94, 0xee, 0x34,
+	0x55, 0xc1, 0x9c, 0xaa, 0x08, 0xa9, 0x33, 0xfe, 0x29, 0x65, 0x00, 0xfd, 0xfd, 0xfd, 0xf0, 0xfe,
+	0x29, 0xe8, 0xfe, 0xe7, 0x3c, 0x31, 0x65, 0x6b, 0x25, 0x31, 0x9b, 0xba, 0xfe, 0x74, 0x10, 0x31,
+	0x35, 0xfe, 0x00, 0x24, 0xab, 0x10, 0x36, 0xc0, 0x39, 0x6e, 0x9a, 0xac, 0xfe, 0x52, 0xec, 0x34,
+	0xfe, 0x00, 0x20, 0x00, 0xfd, 0xd8, 0x25, 0xfe, 0xc6, 0x58, 0xa6, 0x55, 0x1c, 0xa7, 0x44, 0x31,
+	0x2c, 0x1d, 0x0e, 0x04, 0x35, 0x9a, 0xbb, 0xa5, 0x56, 0x14, 0xfe, 0x6b, 0xaf, 0x11, 0x56, 0xc1,
+	0x51, 0x55, 0x0d, 0x51, 0x9c, 0xaa, 0x25, 0xa3, 0x76, 0x00, 0xfd, 0xd8, 0x05, 0x0d, 0xfe, 0xce,
+	0x79, 0x97, 0xcd, 0x1f, 0xa9, 0x63, 0x56, 0xc0, 0x65, 0x35, 0xfe, 0xef, 0x7d, 0x2c, 0xfe, 0x8c,
+	0x92, 0xc3, 0x20, 0x99, 0xab, 0xa2, 0x88, 0x55, 0x00, 0xfd, 0xfd, 0xfd, 0xf0, 0xfe, 0xad, 0x96,
+	0x2c, 0x69, 0x2c, 0xc0, 0x25, 0x31, 0x34, 0xaf, 0x10, 0x31, 0xfe, 0x7b, 0xf0, 0x00, 0xfe, 0x29,
+	0xc8, 0x9d, 0x9a, 0x7e, 0xc0, 0x3e, 0x9c, 0x9b, 0xfe, 0x9d, 0x14, 0xfe, 0x31, 0xa6, 0x00, 0xfd,
+	0xd8, 0xa2, 0x77, 0xfe, 0x63, 0x6e, 0xfe, 0xce, 0x79, 0xa4, 0x66, 0xc0, 0x2c, 0x6e, 0x2c, 0x1d,
+	0x0e, 0x04, 0x55, 0x39, 0x28, 0x51, 0xfe, 0x6b, 0xaf, 0xa5, 0x65, 0x56, 0xc1, 0x51, 0x26, 0x12,
+	0x9d, 0xaa, 0x9d, 0x9a, 0x65, 0xa7, 0x54, 0xfe, 0x08, 0x61, 0x00, 0xfd, 0xd8, 0xa7, 0x44, 0xfe,
+	0x94, 0xd3, 0xae, 0x11, 0xfe, 0x73, 0xcf, 0xfe, 0x21, 0xa8, 0xa6, 0x54, 0x61, 0xa2, 0x77, 0x95,
+	0xbf, 0xfe, 0x8c, 0xb3, 0xfe, 0xff, 0xff, 0x08, 0xfe, 0x7c, 0x10, 0xa5, 0x56, 0x65, 0x20, 0x25,
+	0x3d, 0x9a, 0xab, 0xa8, 0x55, 0xfe, 0x39, 0xe8, 0x00, 0xfd, 0xfd, 0xfd, 0xee, 0x11, 0xfe, 0xef,
+	0x7d, 0xa4, 0x66, 0x65, 0x2c, 0x25, 0x31, 0x08, 0xfe, 0x8c, 0x92, 0x31, 0x93, 0xef, 0x00, 0xfe,
+	0x29, 0xc8, 0x9d, 0x9a, 0x7e, 0xc0, 0x0d, 0xfe, 0x00, 0x23, 0xfe, 0x7c, 0x31, 0x10, 0x00, 0xfd,
+	0xd9, 0xa5, 0x55, 0x38, 0xfe, 0xd6, 0xba, 0xa2, 0x77, 0xc0, 0xa8, 0x44, 0xc0, 0x2c, 0x55, 0x0e,
+	0x04, 0x55, 0x9a, 0xbb, 0xa5, 0x56, 0x14, 0xfe, 0x6b, 0xaf, 0xa5, 0x65, 0x09, 0xc1, 0x3d, 0x26,
+	0x51, 0x3e, 0x9d, 0xaa, 0x9d, 0x9a, 0x26, 0xfe, 0x18, 0xc3, 0x00, 0xfd, 0xd9, 0x29, 0xfe, 0xbd,
+	0xf8, 0xc0, 0x0a, 0xa4, 0x76, 0x66, 0x29, 0xa2, 0x77, 0xfe, 0x00, 0xe6, 0xfe, 0xd6, 0xba, 0x31,
+	0xfe, 0x9d, 0x14, 0x11, 0xa2, 0x77, 0x20, 0xc0, 0x5a, 0x99, 0xcc, 0x21, 0xa2, 0x77, 0xfe, 0x08,
+	0x41, 0x00, 0xfd, 0xfd, 0xfd, 0xed, 0xfe, 0xbe, 0x18, 0x2c, 0x69, 0x2c, 0xc1, 0x25, 0xfe, 0x7c,
+	0x10, 0x04, 0x2c, 0xfe, 0x4a, 0x8b, 0x06, 0xa6, 0x64, 0x66, 0xc0, 0x3e, 0x9c, 0xab, 0xac, 0x31,
+	0xfe, 0x94, 0xd3, 0x19, 0x00, 0xfd, 0xd9, 0xa8, 0x34, 0x20, 0xfe, 0xd6, 0xda, 0x7f, 0x7f, 0x31,
+	0xc0, 0x2c, 0x55, 0x51, 0x04, 0x55, 0x9a, 0xbb, 0x2d, 0x9d, 0xaa, 0xfe, 0x6b, 0xaf, 0xa5, 0x65,
+	0x56, 0xc1, 0x3d, 0x51, 0x42, 0x50, 0x9d, 0xaa, 0x9c, 0xaa, 0x26, 0x24, 0x00, 0xfd, 0xd9, 0x6e,
+	0x21, 0xfe, 0xce, 0x7a, 0x91, 0xff, 0x17, 0x3d, 0x51, 0x6f, 0x9b, 0xab, 0x15, 0x31, 0x9a, 0xbb,
+	0xfe, 0x7c, 0x10, 0x25, 0x20, 0x5a, 0x20, 0x3d, 0x99, 0xbc, 0xa9, 0x33, 0xfe, 0x42, 0x49, 0xfe,
+	0x00, 0x00, 0xfd, 0xfd, 0xfd, 0xec, 0x39, 0xfe, 0xf7, 0x9e, 0xa3, 0x66, 0x65, 0x2c, 0x25, 0x31,
+	0xfe, 0xbd, 0xf7, 0x9b, 0xab, 0x31, 0xfe, 0xad, 0x76, 0x00, 0xfe, 0x31, 0xe8, 0x36, 0x7a, 0xc0,
+	0x7f, 0x98, 0xbc, 0xfe, 0x94, 0xf4, 0xfe, 0x42, 0x08, 0x00, 0xfd, 0xda, 0xab, 0x23, 0xfe, 0x9c,
+	0xf4, 0xfe, 0xde, 0xfb, 0xc0, 0xa2, 0x77, 0x31, 0xc0, 0x2c, 0x55, 0x51, 0x04, 0x51, 0x9b, 0xaa,
+	0x2d, 0x21, 0xfe, 0x6b, 0xaf, 0xa5, 0x65, 0x56, 0xc1, 0x3d, 0x52, 0x1c, 0x41, 0x50, 0x9b, 0xbb,
+	0x21, 0xfe, 0x39, 0xe7, 0x00, 0xfd, 0xda, 0xa9, 0x34, 0xfe, 0xa5, 0x55, 0xa7, 0x55, 0x3d, 0x9d,
+	0x9a, 0x29, 0x5a, 0x3d, 0xfe, 0x00, 0x04, 0xfe, 0xbd, 0xf8, 0x31, 0xfe, 0xad, 0x96, 0x95, 0xdd,
+	0xa3, 0x77, 0x56, 0x69, 0x66, 0x9a, 0xbb, 0x56, 0xa5, 0x65, 0xfe, 0x08, 0x61, 0x00, 0xfd, 0xfd,
+	0xfd, 0xeb, 0xfe, 0xc6, 0x38, 0xad, 0x22, 0x69, 0x2c, 0x25, 0x31, 0x9d, 0xa9, 0xfe, 0x73, 0xf0,
+	0xfe, 0xf7, 0xbe, 0x51, 0x1f, 0xa1, 0x98, 0x7e, 0xc1, 0xa2, 0x77, 0x97, 0xcd, 0xfe, 0x6b, 0xaf,
+	0x3d, 0x00, 0xfd, 0xdb, 0xfe, 0x31, 0xe8, 0xfe, 0xa5, 0x75, 0xad, 0x21, 0x62, 0x04, 0xa5, 0x55,
+	0xc0, 0x2c, 0x1d, 0x09, 0x04, 0x51, 0x9b, 0xaa, 0x28, 0xc0, 0x21, 0xa5, 0x65, 0x56, 0xc1, 0x3d,
+	0x52, 0x21, 0x9d, 0xaa, 0x41, 0x9b, 0xba, 0xa8, 0x44, 0x98, 0xdc, 0xfe, 0x00, 0x00, 0xfd, 0xdb,
+	0xfe, 0x4a, 0xab, 0xfe, 0xc6, 0x59, 0x97, 0xcc, 0xfe, 0x00, 0xc5, 0xac, 0x31, 0x51, 0x29, 0x41,
+	0xa6, 0x55, 0x1d, 0x56, 0x09, 0xa2, 0x87, 0x16, 0x66, 0x16, 0x9d, 0xaa, 0x99, 0xbc, 0x09, 0x93,
+	0xfe, 0x00, 0xfd, 0xfd, 0xfd, 0xea, 0xfe, 0x63, 0x4d, 0xfe, 0xf7, 0x9e, 0xa3, 0x66, 0x25, 0x2c,
+	0x25, 0x31, 0xfe, 0xad, 0x96, 0xa2, 0x77, 0x31, 0xfe, 0x94, 0xd3, 0x00, 0x12, 0x9d, 0xaa, 0xc0,
+	0x6e, 0x39, 0x7f, 0xfe, 0x9c, 0xf4, 0xfe, 0x19, 0x04, 0x00, 0xfd, 0xdb, 0xfe, 0x42, 0x4a, 0xfe,
+	0xb5, 0xb7, 0x26, 0x1c, 0xa5, 0x55, 0x31, 0xc0, 0x2c, 0x1d, 0x09, 0x66, 0x55, 0x9a, 0xbb, 0xa4,
+	0x66, 0x28, 0xfe, 0x6b, 0xaf, 0x11, 0x56, 0xc1, 0x3d, 0x30, 0x21, 0x9d, 0xaa, 0x41, 0x9c, 0xaa,
+	0xa6, 0x54, 0x9d, 0xba, 0x00, 0xfd, 0xdb, 0xa4, 0x56, 0xfe, 0x8c, 0x92, 0xae, 0x21, 0xfe, 0x5b,
+	0x0c, 0x0a, 0x29, 0x56, 0xa3, 0x76, 0xfe, 0x00, 0x03, 0xfe, 0xa5, 0x75, 0xfe, 0xff, 0xff, 0xfe,
+	0xbd, 0xf7, 0xfe, 0x73, 0xf0, 0x20, 0x55, 0xc1, 0x99, 0xbc, 0xc0, 0xa6, 0x55, 0xfe, 0x10, 0x82,
+	0x00, 0xfd, 0xfd, 0xfd, 0xe8, 0x07, 0xfe, 0xc6, 0x38, 0x2c, 0x69, 0x2c, 0x25, 0x31, 0x9c, 0xaa,
+	0x35, 0x31, 0x9a, 0xbb, 0x15, 0xfe, 0x29, 0xa7, 0x56, 0xc1, 0xa2, 0x77, 0x2b, 0xfe, 0x84, 0x52,
+	0x97, 0xdb, 0x00, 0xfd, 0xdc, 0xfe, 0x52, 0xcb, 0xfe, 0xbe, 0x18, 0xa8, 0x54, 0x1c, 0xa6, 0x44,
+	0x31, 0xc0, 0x2c, 0x55, 0x09, 0x04, 0x55, 0x34, 0x35, 0x56, 0xfe, 0x6b, 0xaf, 0x11, 0x56, 0xc1,
+	0x66, 0x55, 0x21, 0x51, 0x51, 0x9c, 0xaa, 0x2a, 0x0d, 0x00, 0xfd, 0xdc, 0xae, 0x01, 0xfe, 0xbe,
+	0x18, 0x9a, 0xcb, 0xfe, 0x00, 0xc5, 0xac, 0x31, 0x51, 0x6e, 0x21, 0x12, 0xfe, 0xef, 0x7d, 0xa2,
+	0x77, 0xfe, 0x84, 0x51, 0xc3, 0x9d, 0x9a, 0x99, 0xcc, 0xa9, 0x33, 0x05, 0x00, 0xfd, 0xfd, 0xfd,
+	0xe8, 0xfe, 0x63, 0x4d, 0x1d, 0x31, 0x25, 0xc1, 0x31, 0x24, 0xa6, 0x45, 0x31, 0x11, 0x00, 0x12,
+	0x9d, 0xaa, 0x6e, 0x7b, 0x40, 0xa9, 0x43, 0xfe, 0x94, 0xd3, 0xfe, 0x08, 0x61, 0x00, 0xfd, 0xdb,
+	0x19, 0xfe, 0x63, 0x4e, 0xfe, 0xc6, 0x59, 0x30, 0x1c, 0xa6, 0x55, 0xa3, 0x66, 0xc0, 0x2c, 0x55,
+	0x51, 0x66, 0x30, 0x9a, 0xbb, 0xa7, 0x44, 0x2d, 0xfe, 0x6b, 0xaf, 0x11, 0x56, 0xc1, 0x66, 0x55,
+	0x21, 0x0d, 0x51, 0x9d, 0x99, 0x6b, 0x21, 0x19, 0x00, 0xfd, 0xdb, 0x6e, 0xfe, 0x73, 0xcf, 0xfe,
+	0xce, 0x79, 0x0d, 0x36, 0x26, 0x66, 0xa2, 0x77, 0xfe, 0x00, 0x24, 0xfe, 0x9c, 0xf4, 0x31, 0x92,
+	0xff, 0x29, 0xa5, 0x56, 0x11, 0xc0, 0x09, 0x0d, 0x66, 0x04, 0xfe, 0x08, 0x62, 0x00, 0xfd, 0xfd,
+	0xfd, 0xe7, 0x25, 0x2c, 0x69, 0xc1, 0x31, 0x9b, 0xbb, 0xfe, 0x7c, 0x10, 0x31, 0x98, 0xcc, 0x00,
+	0xfe, 0x29, 0xc8, 0x51, 0x3e, 0xc0, 0x0d, 0x97, 0xcd, 0xfe, 0x8c, 0xb3, 0xfe, 0x4a, 0x69, 0x00,
+	0xfd, 0xdc, 0xa5, 0x56, 0x29, 0xfe, 0xce, 0x99, 0xa4, 0x66, 0x21, 0xa6, 0x55, 0xa2, 0x77, 0xc0,
+	0x2c, 0x1d, 0x51, 0x04, 0x30, 0x9a, 0xbb, 0xa7, 0x44, 0x2d, 0xfe, 0x6b, 0xaf, 0x11, 0x56, 0xc2,
+	0x51, 0x21, 0x51, 0x51, 0x9d, 0x9a, 0x51, 0xaa, 0x43, 0x3c, 0x00, 0xfd, 0xdc, 0xaa, 0x23, 0xfe,
+	0xb5, 0xb7, 0x55, 0xfe, 0x00, 0xc5, 0xab, 0x41, 0x56, 0xc1, 0x9c, 0x8a, 0xfe, 0xe7, 0x3d, 0x2c,
+	0x11, 0x66, 0x11, 0x0c, 0x11, 0x9c, 0xaa, 0x9a, 0xab, 0xa9, 0x44, 0xfe, 0x4a, 0x69, 0x00, 0xfd,
+	0xfd, 0xfd, 0xe6, 0xfe, 0x52, 0xec, 0x18, 0x31, 0x65, 0xc1, 0x31, 0xfe, 0xa5, 0x55, 0xa7, 0x54,
+	0x31, 0x09, 0x07, 0x12, 0x51, 0xc0, 0x7f, 0x22, 0x2a, 0xab, 0x43, 0x00, 0xfd, 0xdd, 0xa8, 0x44,
+	0x11, 0xfe, 0xd6, 0xba, 0x26, 0x66, 0x2c, 0x31, 0xc0, 0x2c, 0x55, 0x51, 0x55, 0x62, 0x34, 0xa7,
+	0x44, 0x2d, 0xfe, 0x6b, 0xaf, 0x11, 0x56, 0xc2, 0x51, 0x21, 0x51, 0x51, 0x51, 0x9c, 0xaa, 0xab,
+	0x33, 0xfe, 0x29, 0x45, 0x00, 0xfd, 0xdd, 0x0d, 0xfe, 0xc6, 0x59, 0xfe, 0x6b, 0x6e, 0x22, 0xa6,
+	0x65, 0x66, 0xa2, 0x76, 0xfe, 0x00, 0x24, 0xfe, 0x94, 0xd3, 0xfe, 0xff, 0xff, 0xfe, 0xc6, 0x18,
+	0xfe, 0x6b, 0xcf, 0x11, 0x09, 0xc0, 0x65, 0x9a, 0xab, 0x0d, 0x3d, 0xfe, 0x08, 0x41, 0x00, 0xfd,
+	0xfd, 0xfd, 0xe5, 0xfe, 0xbd, 0xd7, 0x2c, 0x69, 0xc1, 0x31, 0x9b, 0xbb, 0x35, 0x31, 0x98, 0xcc,
+	0x00, 0xfe, 0x29, 0xc8, 0x55, 0xc1, 0x12, 0x06, 0x39, 0xfe, 0x3a, 0x08, 0x00, 0xfd, 0xdd, 0xac,
+	0x12, 0xfe, 0x94, 0xb3, 0xfe, 0xde, 0xdb, 0x21, 0xc0, 0x2c, 0x31, 0xc0, 0x2c, 0x55, 0x51, 0x3a,
+	0x62, 0x9a, 0xbb, 0xa7, 0x44, 0x2d, 0xfe, 0x6b, 0xaf, 0x11, 0x56, 0xc2, 0x51, 0x21, 0x55, 0x9d,
+	0xaa, 0x51, 0x9c, 0xaa, 0x26, 0xfe, 0x39, 0xe7, 0x00, 0xfd, 0xdd, 0xa8, 0x34, 0xfe, 0xad, 0x96,
+	0x65, 0xfe, 0x00, 0x85, 0xfe, 0x3a, 0x29, 0x51, 0x6b, 0x6e, 0x9b, 0x8b, 0x3c, 0x2c, 0xfe, 0x84,
+	0x31, 0x09, 0xc2, 0x9c, 0xaa, 0x25, 0xab, 0x22, 0xfe, 0x3a, 0x08, 0x00, 0xfd, 0xfd, 0xfd, 0xe4,
+	0x38, 0xfe, 0xef, 0x7d, 0x31, 0x65, 0xc1, 0x31, 0xfe, 0xad, 0x75, 0xa4, 0x67, 0x31, 0xfe, 0x84,
+	0x51, 0x00, 0xfe, 0x29, 0xe8, 0x3e, 0xc0, 0x7f, 0x9b, 0x9b, 0x39, 0x0c, 0x00, 0xfd, 0xde, 0xaf,
+	0x01, 0xfe, 0x9d, 0x14, 0xaf, 0x10, 0xc0, 0x30, 0x31, 0xc1, 0x2c, 0x55, 0x09, 0x3a, 0x30, 0x34,
+	0xa7, 0x44, 0x52, 0xfe, 0x6b, 0xaf, 0x11, 0x56, 0xc2, 0x51, 0x26, 0x51, 0x51, 0x9d, 0xaa, 0x3d,
+	0xa9, 0x44, 0x97, 0xdc, 0xfe, 0x00, 0x00, 0xfd, 0xde, 0xfe, 0x5b, 0x0d, 0xfe, 0xc6, 0x39, 0xfe,
+	0x63, 0x4d, 0x22, 0xa6, 0x65, 0x55, 0xa2, 0x87, 0xfe, 0x00, 0x03, 0xfe, 0x94, 0xf3, 0x31, 0xfe,
+	0xbd, 0xf8, 0xfe, 0x6b, 0xaf, 0x11, 0x51, 0x09, 0x35, 0x34, 0xa4, 0x56, 0xa2, 0x86, 0x00, 0xfd,
+	0xfd, 0xfd, 0xe4, 0xfe, 0xa5, 0x55, 0x31, 0x65, 0xc1, 0x31, 0x9c, 0xaa, 0x29, 0xfe, 0xff, 0xdf,
+	0x30, 0xfe, 0x00, 0x02, 0xfe, 0x29, 0xc8, 0x55, 0xc0, 0x6b, 0x12, 0x99, 0xad, 0xfe, 0x94, 0xd3,
+	0xfe, 0x31, 0xa7, 0x00, 0xfd, 0xde, 0xfe, 0x42, 0x6a, 0xfe, 0xad, 0x96, 0xac, 0x21, 0x62, 0xa3,
+	0x66, 0x31, 0xc1, 0x2c, 0x1d, 0x09, 0x3a, 0x30, 0x9a, 0xab, 0x30, 0x2d, 0xfe, 0x6b, 0xaf, 0x11,
+	0x56, 0xc2, 0x51, 0x55, 0x19, 0x50, 0x52, 0x02, 0x08, 0x50, 0x00, 0xfd, 0xde, 0xa7, 0x44, 0xfe,
+	0xad, 0x76, 0x55, 0xfe, 0x00, 0x24, 0xfe, 0x32, 0x09, 0x55, 0xc0, 0x7a, 0x9e, 0x7a, 0xfe, 0xef,
+	0x7d, 0x1d, 0xfe, 0x7c, 0x10, 0x6f, 0x69, 0x3d, 0xc0, 0x9b, 0xab, 0x9c, 0xaa, 0x11, 0xfe, 0x29,
+	0x86, 0x00, 0xfd, 0xfd, 0xfd, 0xe2, 0xac, 0x03, 0xfe, 0xe7, 0x1c, 0xa7, 0x44, 0x65, 0xc1, 0x31,
+	0xfe, 0xb5, 0xd6, 0x52, 0x31, 0xfe, 0x94, 0xb3, 0x00, 0x15, 0x41, 0x7b, 0x12, 0x1a, 0xfe, 0x63,
+	0x4d, 0x0c, 0x00, 0xfd, 0xde, 0x6e, 0xfe, 0x52, 0xcc, 0xfe, 0xb5, 0xd7, 0x30, 0x1c, 0x3a, 0x31,
+	0xc1, 0x2c, 0x1d, 0x51, 0x3a, 0x30, 0x9a, 0xaa, 0x30, 0x5a, 0xfe, 0x6b, 0xaf, 0x11, 0x56, 0xc2,
+	0x51, 0x26, 0x62, 0x51, 0x41, 0x9c, 0xaa, 0x31, 0x0d, 0x00, 0xfd, 0xdf, 0xfe, 0x5b, 0x2d, 0xfe,
+	0xbe, 0x38, 0xfe, 0x52, 0xec, 0x94, 0xdf, 0x15, 0x12, 0xa2, 0x87, 0x0e, 0xfe, 0xa5, 0x55, 0xfe,
+	0xff, 0xff, 0xfe, 0xb5, 0xb6, 0xfe, 0x6b, 0xaf, 0xa4, 0x66, 0x65, 0xc0, 0x51, 0x25, 0x26, 0x01,
+	0x00, 0xfd, 0xfd, 0xfd, 0xe2, 0xfe, 0x8c, 0x72, 0xfe, 0xff, 0xde, 0xc2, 0x2c, 0x1d, 0x35, 0xfe,
+	0xf7, 0x9e, 0x55, 0x17, 0xa4, 0x95, 0x6b, 0xc0, 0x6e, 0x12, 0x99, 0xad, 0xfe, 0x94, 0xd3, 0xfe,
+	0x31, 0xc7, 0x00, 0xfd, 0xde, 0xa3, 0x66, 0xfe, 0x5b, 0x4d, 0xfe, 0xc6, 0x38, 0x30, 0x51, 0xa4,
+	0x66, 0x31, 0xc1, 0x2c, 0x1d, 0x51, 0x3a, 0x30, 0x2a, 0x30, 0xc0, 0x21, 0x11, 0x56, 0xc2, 0x3d,
+	0x26, 0x62, 0x51, 0x41, 0x9d, 0xa9, 0x6f, 0x21, 0x19, 0x00, 0xfd, 0xde, 0xa7, 0x34, 0xfe, 0xad,
+	0x76, 0x9c, 0xaa, 0xfe, 0x00, 0x03, 0xfe, 0x32, 0x09, 0x0d, 0x6e, 0x62, 0xa4, 0x66, 0x18, 0x55,
+	0x26, 0x3d, 0xc1, 0x35, 0x9a, 0xbb, 0x51, 0xab, 0x32, 0xfe, 0x18, 0xe4, 0x00, 0xfd, 0xfd, 0xfd,
+	0xe0, 0xa4, 0x47, 0xfe, 0xd6, 0x9a, 0x2c, 0x69, 0xc1, 0x6f, 0x2a, 0x95, 0xef, 0x31, 0xfe, 0xa5,
+	0x55, 0x00, 0xfe, 0x32, 0x09, 0x9d, 0x9a, 0x0d, 0x12, 0x27, 0x39, 0x11, 0x00, 0xfd, 0xdf, 0xa6,
+	0x55, 0xfe, 0x6b, 0xaf, 0xfe, 0xce, 0x59, 0xa6, 0x55, 0x51, 0x09, 0x31, 0xc1, 0x2c, 0x55, 0x09,
+	0x3a, 0x30, 0x2a, 0x30, 0x6e, 0x26, 0x11, 0x56, 0xc2, 0x3d, 0x52, 0x21, 0x51, 0x39, 0x9c, 0xaa,
+	0xc0, 0xaa, 0x33, 0x3c, 0x00, 0xfd, 0xdf, 0xfe, 0x63, 0x4d, 0xfe, 0xbd, 0xf8, 0xfe, 0x3a, 0x4a,
+	0x9b, 0xaa, 0x12, 0x66, 0xa3, 0x76, 0x00, 0xfe, 0xb5, 0xd7, 0x31, 0xfe, 0xa5, 0x35, 0x21, 0x3d,
+	0x66, 0x3d, 0x9c, 0xaa, 0x9a, 0xac, 0xaa, 0x32, 0x95, 0xfe, 0x00, 0xfd, 0xfd, 0xfd, 0xe0, 0x01,
+	0xfe, 0xf7, 0x9e, 0x2c, 0x25, 0xc1, 0x31, 0xfe, 0x84, 0x51, 0xfe, 0xe7, 0x1c, 0x2c, 0x35, 0x99,
+	0xbc, 0x0d, 0xc1, 0x7e, 0x0b, 0xfe, 0x8c, 0xb3, 0xfe, 0x42, 0x08, 0x00, 0xfd, 0xdf, 0xa9, 0x34,
+	0x3d, 0xfe, 0xd6, 0x9a, 0xa4, 0x65, 0x56, 0x18, 0xa3, 0x66, 0xc1, 0x2c, 0x55, 0x51, 0x55, 0x30,
+	0x2a, 0x30, 0x6e, 0x26, 0x11, 0x56, 0xc2, 0x3d, 0x52, 0x55, 0x51, 0x39, 0x9d, 0x9a, 0x50, 0xab,
+	0x33, 0x24, 0x00, 0xfd, 0xdf, 0xa8, 0x34, 0xfe, 0xad, 0x96, 0x97, 0xdd, 0xfe, 0x00, 0x03, 0xfe,
+	0x32, 0x09, 0x51, 0x7e, 0x9b, 0x9b, 0xae, 0x31, 0x31, 0x98, 0xcc, 0xfe, 0x63, 0x6e, 0x3d, 0x56,
+	0x38, 0x55, 0x9a, 0xab, 0x39, 0x3d, 0xfe, 0x08, 0x41, 0x00, 0xfd, 0xfd, 0xfd, 0xdf, 0xfe, 0xb5,
+	0xb6, 0x2c, 0x25, 0xc1, 0x31, 0x21, 0x11, 0x31, 0xfe, 0xbe, 0x18, 0x00, 0xfe, 0x32, 0x09, 0x51,
+	0xc0, 0x12, 0x9d, 0xaa, 0xaa, 0x33, 0xae, 0x20, 0xfe, 0x00, 0x20, 0x00, 0xfd, 0xdf, 0xad, 0x11,
+	0xfe, 0x84, 0x72, 0xfe, 0xd6, 0xda, 0xa2, 0x77, 0x66, 0xa6, 0x55, 0x31, 0xc1, 0x2c, 0x1d, 0x51,
+	0x3a, 0x62, 0x9a, 0xab, 0xa7, 0x54, 0xc0, 0xfe, 0x6b, 0xcf, 0x11, 0x56, 0xc2, 0x65, 0x52, 0x55,
+	0x51, 0x51, 0x51, 0x9c, 0xaa, 0x30, 0xfe, 0x39, 0xe8, 0x00, 0xfd, 0xe0, 0x29, 0xaf, 0x10, 0xfe,
+	0x19, 0x67, 0xa3, 0x76, 0xc1, 0xa2, 0x77, 0x00, 0xfe, 0xce, 0x7a, 0xac, 0x21, 0xfe, 0x8c, 0x92,
+	0x29, 0x38, 0x5a, 0xc0, 0x9b, 0xaa, 0x9b, 0xbb, 0xad, 0x11, 0xfe, 0x31, 0xc7, 0xfe, 0x00, 0x00,
+	0xfd, 0xfd, 0xfd, 0xde, 0x0d, 0xfe, 0xe7, 0x3c, 0x31, 0x65, 0xc0, 0x66, 0x31, 0xfe, 0x9d, 0x14,
+	0xaa, 0x33, 0xad, 0x21, 0xfe, 0x6b, 0x8e, 0xfe, 0x00, 0xc5, 0xa9, 0x52, 0x56, 0xc0, 0x21, 0x0b,
+	0xfe, 0x84, 0x72, 0xfe, 0x4a, 0x8a, 0x00, 0xfd, 0xe0, 0xfe, 0x3a, 0x08, 0xfe, 0x94, 0xf3, 0xb0,
+	0x10, 0xc1, 0xa6, 0x55, 0x31, 0xc1, 0x2c, 0x1d, 0x51, 0x3a, 0x62, 0x9a, 0xab, 0xa7, 0x55, 0x35,
+	0x26, 0xa4, 0x76, 0x56, 0xc2, 0x66, 0x51, 0x55, 0x51, 0x39, 0x51, 0x9c, 0xaa, 0x21, 0x05, 0x00,
+	0xfd, 0xe0, 0xac, 0x12, 0xfe, 0xb5, 0xb7, 0xfe, 0x6b, 0x8e, 0xfe, 0x00, 0xa5, 0xaa, 0x31, 0x62,
+	0xa2, 0x76, 0xfe, 0x00, 0x03, 0x0c, 0xfe, 0xff, 0xff, 0x93, 0xef, 0xfe, 0x63, 0x4e, 0xa6, 0x54,
+	0x56, 0xc0, 0x9d, 0xa9, 0x16, 0x21, 0x0d, 0x00, 0xfd, 0xfd, 0xfd, 0xde, 0x11, 0xfe, 0xff, 0xde,
+	0xc2, 0x2c, 0x9d, 0x99, 0x29, 0x2c, 0x99, 0xbb, 0xfe, 0x00, 0x02, 0xfe, 0x31, 0xe8, 0x56, 0xc0,
+	0x12, 0x0d, 0xa4, 0x66, 0xfe, 0x94, 0xd3, 0xfe, 0x10, 0x82, 0x00, 0xfd, 0xe0, 0xfe, 0x42, 0x6a,
+	0xfe, 0xa5, 0x35, 0xfe, 0xdf, 0x1b, 0x21, 0xc0, 0x2c, 0x6e, 0xc1, 0x2c, 0x1d, 0x09, 0x3a, 0x62,
+	0x9a, 0xab, 0xa7, 0x55, 0x69, 0xfe, 0x6b, 0xcf, 0x11, 0x56, 0xc2, 0x66, 0x51, 0x55, 0x51, 0x51,
+	0x51, 0x3d, 0x0d, 0x9d, 0xa9, 0x00, 0xfd, 0xe1, 0xfe, 0x84, 0x72, 0xa5, 0x65, 0xfe, 0x00, 0x03,
+	0x12, 0x52, 0x7e, 0xc0, 0x9a, 0x9c, 0xfe, 0xe7, 0x5d, 0xa3, 0x76, 0x29, 0x6f, 0xc0, 0x30, 0x26,
+	0x25, 0xc0, 0xab, 0x22, 0xfe, 0x18, 0xc3, 0x00, 0xfd, 0xfd, 0xfd, 0xdc, 0xa2, 0x68, 0xfe, 0xce,
+	0x59, 0x2c, 0x69, 0xc0, 0x20, 0xa2, 0x67, 0xfe, 0xc6, 0x18, 0x1c, 0x31, 0xfe, 0x94, 0xd3, 0x00,
+	0xfe, 0x32, 0x09, 0x0d, 0x6e, 0x21, 0x1a, 0xfe, 0x74, 0x10, 0x9a, 0xcb, 0x00, 0xfd, 0xe1, 0xfe,
+	0x52, 0xcc, 0xfe, 0xad, 0x96, 0xac, 0x32, 0x55, 0x6e, 0x31, 0xc2, 0x2c, 0x1d, 0x51, 0x51, 0x30,
+	0x99, 0xbb, 0x35, 0xc0, 0xfe, 0x6b, 0xcf, 0x11, 0x56, 0xc3, 0x51, 0x51, 0x51, 0x55, 0x2a, 0x9c,
+	0xab, 0xa5, 0x65, 0x10, 0x00, 0xfd, 0xe1, 0xfe, 0x42, 0x49, 0xfe, 0xb5, 0xb7, 0xfe, 0x4a, 0x8a,
+	0x22, 0xa4, 0x76, 0x56, 0xa3, 0x76, 0x00, 0xfe, 0xad, 0x75, 0xfe, 0xff, 0xff, 0xfe, 0xa5, 0x55,
+	0xfe, 0x63, 0x6e, 0x35, 0x65, 0xc0, 0x3e, 0x9b, 0xab, 0xab, 0x43, 0x92, 0xfe, 0x00, 0xfd, 0xfd,
+	0xfd, 0xdc, 0xfe, 0x4a, 0x8b, 0xfe, 0xef, 0x7d, 0xa4, 0x66, 0x65, 0xc1, 0x31, 0x11, 0x30, 0x1d,
+	0xfe, 0x32, 0x09, 0x9d, 0x99, 0x12, 0xc1, 0x7a, 0x3e, 0xfe, 0x94, 0xd3, 0xfe, 0x21, 0x24, 0x00,
+	0xfd, 0xe0, 0x19, 0xfe, 0x5b, 0x2d, 0xfe, 0xbd, 0xd7, 0xab, 0x22, 0x51, 0x30, 0x31, 0xc2, 0x2c,
+	0x1d, 0x09, 0x35, 0x30, 0x99, 0xbb, 0x35, 0xc0, 0x26, 0x11, 0x56, 0xc3, 0x51, 0x51, 0x0d, 0x55,
+	0x52, 0x9c, 0xaa, 0xa3, 0x76, 0x29, 0x19, 0x00, 0xfd, 0xe0, 0xa3, 0x67, 0xfe, 0x9d, 0x14, 0x11,
+	0xfe, 0x00, 0x03, 0x12, 0x51, 0x7f, 0x1a, 0xad, 0x41, 0x2c, 0x99, 0xbb, 0xfe, 0x5b, 0x4d, 0x35,
+	0x29, 0xc0, 0x9d, 0x9a, 0x9a, 0xbb, 0x08, 0xa3, 0x76, 0x00, 0xfd, 0xfd, 0xfd, 0xdc, 0xfe, 0x94,
+	0xf3, 0xfe, 0xff, 0xde, 0xc2, 0x6f, 0x30, 0xfe, 0x7c, 0x10, 0x31, 0x92, 0xff, 0x00, 0xfe, 0x3a,
+	0x29, 0x12, 0xc0, 0x7f, 0x36, 0xae, 0x20, 0x3d, 0x00, 0xfd, 0xe1, 0x3c, 0xfe, 0x63, 0x8f, 0x25,
+	0x30, 0x55, 0xa2, 0x77, 0x31, 0xc2, 0x2c, 0x1d, 0x51, 0x35, 0x30, 0x25, 0x35, 0xc0, 0x26, 0xa4,
+	0x76, 0x56, 0xc3, 0x51, 0x51, 0x0d, 0x3e, 0x52, 0x9d, 0xa9, 0xc0, 0x35, 0x3c, 0x00, 0xfd, 0xe1,
+	0x01, 0xb0, 0x00, 0xfe, 0x09, 0x06, 0xa5, 0x75, 0x55, 0x6e, 0xa2, 0x87, 0x00, 0xfe, 0xd6, 0x9a,
+	0xab, 0x22, 0xfe, 0x84, 0x51, 0x9b, 0xab, 0x7e, 0xc0, 0x21, 0x9a, 0xbb, 0x16, 0x11, 0xfe, 0x21,
+	0x04, 0x00, 0xfd, 0xfd, 0xfd, 0xda, 0xa6, 0x26, 0xfe, 0xce, 0x9a, 0x2c, 0x65, 0x6e, 0x1d, 0x31,
+	0xfe, 0xb5, 0x96, 0xa2, 0x67, 0x31, 0x3d, 0xfe, 0x00, 0x84, 0xac, 0x21, 0x12, 0xc0, 0x21, 0x1f,
+	0xfe, 0x8c, 0x92, 0xfe, 0x42, 0x29, 0x00, 0xfd, 0xe1, 0xaa, 0x23, 0x35, 0xfe, 0xce, 0x79, 0xa5,
+	0x66, 0x55, 0xa3, 0x77, 0x31, 0xc2, 0x66, 0x1d, 0x51, 0x51, 0x30, 0x99, 0xbb, 0x35, 0xc0, 0x26,
+	0x11, 0x56, 0xc3, 0x51, 0x51, 0x55, 0x51, 0x52, 0x9d, 0xa9, 0x56, 0xac, 0x21, 0xfe, 0x29, 0x45,
+	0x00, 0xfd, 0xe1, 0xaa, 0x23, 0xfe, 0xa5, 0x75, 0x2d, 0x06, 0xa6, 0x75, 0x55, 0xa3, 0x66, 0x00,
+	0xfe, 0x8c, 0x92, 0xfe, 0xff, 0xff, 0xfe, 0xb5, 0xd7, 0xfe, 0x5b, 0x2d, 0x35, 0x51, 0x6e, 0x39,
+	0x9b, 0xab, 0x35, 0x95, 0xed, 0x00, 0xfd, 0xfd, 0xfd, 0xda, 0xfe, 0x52, 0xcb, 0xfe, 0xef, 0x7d,
+	0x2c, 0x69, 0xc2, 0x3d, 0x09, 0xc0, 0xfe, 0x01, 0x46, 0x12, 0xc1, 0x7f, 0x12, 0xa4, 0x66, 0xfe,
+	0x8c, 0xb3, 0xfe, 0x08, 0x61, 0x00, 0xfd, 0xe1, 0xad, 0x12, 0xfe, 0x7c, 0x31, 0xfe, 0xd6, 0xba,
+	0xa3, 0x76, 0x56, 0xa4, 0x66, 0xa4, 0x66, 0xc2, 0x2c, 0x1d, 0x09, 0x51, 0x30, 0x99, 0xbb, 0x35,
+	0xc0, 0x26, 0xa4, 0x76, 0x56, 0xc3, 0x51, 0x51, 0x55, 0x52, 0x61, 0x41, 0x9d, 0xa9, 0x35, 0xfe,
+	0x39, 0xe8, 0x00, 0xfd, 0xe2, 0x11, 0x6e, 0xfe, 0x00, 0x03, 0xfe, 0x29, 0xc8, 0x51, 0x6e, 0x51,
+	0xa4, 0x67, 0xfe, 0xf7, 0x9e, 0x41, 0xfe, 0x5b, 0x4d, 0xa4, 0x76, 0x21, 0xc0, 0x51, 0x9a, 0xbb,
+	0x3e, 0x29, 0x00, 0xfd, 0xfd, 0xfd, 0xda, 0xfe, 0x9c, 0xf3, 0x2c, 0x69, 0xc1, 0x31, 0x98, 0xcc,
+	0xfe, 0x84, 0x51, 0x31, 0xfe, 0xb5, 0xd7, 0x00, 0xfe, 0x3a, 0x29, 0x41, 0x7a, 0x6f, 0x9b, 0x9b,
+	0xfe, 0x73, 0xd0, 0x9d, 0xa8, 0x00, 0xfd, 0xe2, 0x29, 0xfe, 0x8c, 0x92, 0xfe, 0xde, 0xdb, 0xa2,
+	0x66, 0x66, 0xa4, 0x66, 0x31, 0xc2, 0x2c, 0x55, 0x09, 0x51, 0x66, 0x99, 0xbb, 0x35, 0x6b, 0xfe,
+	0x6b, 0xcf, 0x11, 0x56, 0xc3, 0x51, 0x51, 0x55, 0x05, 0x65, 0x41, 0x3d, 0x26, 0x96, 0xed, 0x00,
+	0xfd, 0xe2, 0x05, 0xfe, 0x9d, 0x35, 0xfe, 0x19, 0x67, 0x7e, 0xc1, 0xa3, 0x66, 0x00, 0xfe, 0xc6,
+	0x59, 0xad, 0x21, 0xfe, 0x8c, 0x72, 0x0d, 0x21, 0xc0, 0x65, 0x9a, 0xac, 0x0e, 0x11, 0x10, 0x00,
+	0xfd, 0xfd, 0xfd, 0xd8, 0xa6, 0x26, 0xfe, 0xce, 0x9a, 0x2c, 0x55, 0x7e, 0x1d, 0x31, 0xfe, 0xad,
+	0x75, 0xa4, 0x66, 0x31, 0xfe, 0x73, 0xcf, 0x0b, 0xa8, 0x64, 0x65, 0x21, 0x6e, 0x36, 0xfe, 0x8c,
+	0xb3, 0xfe, 0x31, 0x86, 0x00, 0xfd, 0xe2, 0xfe, 0x4a, 0x8a, 0xfe, 0x9c, 0xf4, 0xfe, 0xde, 0xfb,
+	0x6e, 0x21, 0x18, 0xa3, 0x66, 0xc2, 0x2c, 0x1d, 0x51, 0x51, 0x30, 0x99, 0xbb, 0x35, 0x09, 0xfe,
+	0x73, 0xd0, 0xa4, 0x65, 0x56, 0xc3, 0x51, 0x55, 0x51, 0x62, 0x55, 0x51, 0x3d, 0x12, 0x2d, 0x00,
+	0xfd, 0xe2, 0xa6, 0x55, 0xfe, 0x9c, 0xf4, 0x2d, 0xfe, 0x00, 0xc5, 0xa7, 0x53, 0x66, 0xa2, 0x77,
+	0x00, 0x11, 0x31, 0xfe, 0xbd, 0xf8, 0xfe, 0x53, 0x0d, 0x29, 0x56, 0xc0, 0x9b, 0xaa, 0x3d, 0xad,
+	0x11, 0xfe, 0x4a, 0x6a, 0xfe, 0x00, 0x00, 0xfd, 0xfd, 0xfd, 0xd8, 0x05, 0xfe, 0xef, 0x7d, 0x2c,
+	0x69, 0xc2, 0xfe, 0x7c, 0x10, 0x09, 0x66, 0x17, 0xa7, 0x74, 0xc2, 0x0d, 0xa8, 0x44, 0xad, 0x21,
+	0xfe, 0x00, 0x20, 0x00, 0xfd, 0xe2, 0xfe, 0x52, 0xec, 0xfe, 0xa5, 0x55, 0xae, 0x21, 0x55, 0xc0,
+	0xa6, 0x55, 0xa2, 0x77, 0xc2, 0x2c, 0x51, 0x09, 0x51, 0x30, 0x99, 0xbb, 0x35, 0x09, 0xfe, 0x73,
+	0xd0, 0x11, 0x56, 0xc3, 0x3d, 0x9d, 0x9a, 0x12, 0x62, 0x55, 0x51, 0x9d, 0x9a, 0xa6, 0x54, 0xa2,
+	0x87, 0x00, 0xfd, 0xe3, 0x29, 0xa3, 0x66, 0xfe, 0x00, 0x03, 0xfe, 0x21, 0xa7, 0x36, 0x7a, 0x51,
+	0x0a, 0x18, 0x04, 0xfe, 0x5b, 0x2d, 0x21, 0x66, 0x21, 0x39, 0x9b, 0xaa, 0xa6, 0x56, 0x21, 0x00,
+	0xfd, 0xfd, 0xfd, 0xd8, 0xfe, 0x8c, 0x92, 0xfe, 0xff, 0xde, 0xc1, 0x66, 0x31, 0x98, 0xcc, 0xfe,
+	0x7c, 0x31, 0x31, 0x0c, 0x00, 0xfe, 0x3a, 0x4a, 0x51, 0xc0, 0x7e, 0x36, 0x3a, 0x2d, 0x00, 0xfd,
+	0xe2, 0xa3, 0x66, 0x39, 0xfe, 0xb5, 0xb6, 0xac, 0x22, 0x51, 0xc0, 0x2c, 0x31, 0xc2, 0x2c, 0x18,
+	0x55, 0x35, 0x66, 0x99, 0xbb, 0x04, 0x09, 0xfe, 0x73, 0xd0, 0x11, 0x56, 0xc3, 0x65, 0x26, 0x52,
+	0x08, 0x39, 0x51, 0x9d, 0x9a, 0x2a, 0xa6, 0x65, 0xfe, 0x08, 0x61, 0x00, 0xfd, 0xe2, 0xfe, 0x42,
+	0x49, 0xfe, 0x94, 0xd3, 0xfe, 0x11, 0x26, 0xa2, 0x77, 0xc1, 0x0d, 0x00, 0xfe, 0xc6, 0x59, 0xad,
+	0x21, 0x11, 0x99, 0xbc, 0xa2, 0x77, 0x65, 0x08, 0x9b, 0xaa, 0xc0, 0xac, 0x22, 0x3c, 0x00, 0xfd,
+	0xfd, 0xfd, 0xd6, 0xa3, 0x57, 0xfe, 0xc6, 0x38, 0x2c, 0x55, 0x7e, 0x1d, 0x31, 0xfe, 0xb5, 0xb6,
+	0x6b, 0x31, 0xfe, 0x7c, 0x10, 0x06, 0xaa, 0x52, 0x56, 0xc0, 0x29, 0x9c, 0x9b, 0xfe, 0x8c, 0xb3,
+	0xfe, 0x29, 0x65, 0x00, 0xfd, 0xe2, 0x3c, 0x0d, 0xfe, 0xbd, 0xf7, 0x35, 0x51, 0x6e, 0x2c, 0x6e,
+	0xc2, 0x2c, 0x18, 0x55, 0x35, 0x66, 0x99, 0xbb, 0x09, 0x66, 0xfe, 0x73, 0xd0, 0xa4, 0x65, 0x56,
+	0xc3, 0x3d, 0x41, 0x52, 0x08, 0x55, 0x51, 0x0e, 0x7f, 0x3d, 0x3c, 0x00, 0xfd, 0xe2, 0x3c, 0xfe,
+	0x8c, 0xb3, 0xfe, 0x4a, 0x8b, 0x06, 0xa5, 0x75, 0x56, 0xa2, 0x87, 0x00, 0xfe, 0x8c, 0x92, 0xfe,
+	0xff, 0xff, 0xfe, 0xb5, 0xb7, 0xfe, 0x52, 0xec, 0xa6, 0x55, 0x15, 0x0d, 0x1d, 0x9c, 0xaa, 0x09,
+	0xfe, 0x3a, 0x08, 0x00, 0xfd, 0xfd, 0xfd, 0xd6, 0xfe, 0x31, 0xe8, 0xfe, 0xe7, 0x3c, 0x2c, 0x55,
+	0x7e, 0x1d, 0x31, 0x11, 0x35, 0x18, 0x0a, 0xa2, 0x87, 0xc1, 0x6e, 0x52, 0xa7, 0x54, 0x16, 0xfe,
+	0x00, 0x20, 0x00, 0xfd, 0xe2, 0xaa, 0x23, 0xfe, 0x6b, 0xcf, 0xfe, 0xc6, 0x38, 0x35, 0x51, 0x7f,
+	0x31, 0xc3, 0x2c, 0x18, 0x55, 0x35, 0x30, 0x25, 0x09, 0x66, 0xfe, 0x73, 0xd0, 0x11, 0x56, 0xc3,
+	0x3d, 0x26, 0x52, 0x61, 0x55, 0x2a, 0x9d, 0xaa, 0x0c, 0xac, 0x22, 0x29, 0x00, 0xfd, 0xe3, 0xfe,
+	0x73, 0xcf, 0x56, 0xfe, 0x00, 0x23, 0xab, 0x11, 0x55, 0x39, 0x9c, 0x9a, 0xaa, 0x43, 0xfe, 0xf7,
+	0xbf, 0x9b, 0xaa, 0xfe, 0x52, 0xec, 0x21, 0x0d, 0x7e, 0x25, 0x35, 0x19, 0x9d, 0xb9, 0x00, 0xfd,
+	0xfd, 0xfd, 0xd6, 0x21, 0xfe, 0xf7, 0xbe, 0x7e, 0x1d, 0xc0, 0x2c, 0x9c, 0xa9, 0xfe, 0x73, 0xf0,
+	0x31, 0x93, 0xff, 0x07, 0xfe, 0x3a, 0x4a, 0x51, 0xc0, 0x7f, 0x39, 0xfe, 0x73, 0xf0, 0x3c, 0x00,
+	0xfd, 0xe3, 0xae, 0x01, 0xfe, 0x7c, 0x10, 0xfe, 0xce, 0x99, 0xa4, 0x77, 0x55, 0xa2, 0x77, 0x31,
+	0xc3, 0x2c, 0x18, 0x55, 0x35, 0x65, 0x99, 0xbc, 0x09, 0x66, 0xfe, 0x73, 0xd0, 0xa4, 0x65, 0x56,
+	0xc3, 0x66, 0x26, 0x19, 0x08, 0x55, 0x55, 0x9d, 0xaa, 0x02, 0x3a, 0xfe, 0x3a, 0x08, 0x00, 0xfd,
+	0xe3, 0xfe, 0x4a, 0x6a, 0xaf, 0x00, 0xfe, 0x00, 0xa4, 0xa6, 0x55, 0x65, 0xc0, 0xa3, 0x76, 0xfe,
+	0x00, 0x00, 0xfe, 0xd6, 0xbb, 0x2c, 0xfe, 0x73, 0xcf, 0x0d, 0xc1, 0x39, 0x9a, 0xbb, 0xa4, 0x66,
+	0xa9, 0x43, 0xfe, 0x08, 0x41, 0x00, 0xfd, 0xfd, 0xfd, 0xd5, 0xfe, 0xa5, 0x55, 0xfe, 0xff, 0xde,
+	0x56, 0x25, 0x1d, 0xa2, 0x77, 0x93, 0xfe, 0x95, 0xdf, 0x31, 0xfe, 0x94, 0xb3, 0xfe, 0x00, 0x64,
+	0xfe, 0x3a, 0x4a, 0x51, 0x6e, 0x7b, 0x0a, 0xfe, 0x8c, 0x93, 0xfe, 0x31, 0xa6, 0x00, 0xfd, 0xe3,
+	0xfe, 0x42, 0x29, 0x11, 0xfe, 0xd6, 0xba, 0xa3, 0x76, 0x56, 0xa3, 0x66, 0x31, 0xc3, 0x55, 0x18,
+	0x55, 0x51, 0x55, 0x99, 0xcc, 0x09, 0x66, 0xfe, 0x73, 0xd0, 0x11, 0x56, 0xc3, 0x66, 0x40, 0x19,
+	0x61, 0x39, 0x2a, 0x52, 0x9d, 0xa9, 0x30, 0x96, 0xdc, 0x00, 0xfd, 0xe3, 0x10, 0xfe, 0x84, 0x52,
+	0xfe, 0x29, 0xc8, 0x9b, 0xab, 0x7e, 0xc0, 0xa3, 0x77, 0x00, 0xfe, 0xa5, 0x55, 0x31, 0xfe, 0x9d,
+	0x14, 0x2a, 0x15, 0x56, 0x65, 0x9a, 0xac, 0x51, 0x11, 0xfe, 0x21, 0x45, 0x00, 0xfd, 0xfd, 0xfd,
+	0xd4, 0xa7, 0x25, 0xfe, 0xce, 0x9a, 0xaa, 0x43, 0x55, 0x7e, 0x1d, 0x31, 0xfe, 0x9c, 0xf3, 0xac,
+	0x22, 0x31, 0xfe, 0x52, 0xec, 0x96, 0xce, 0xa4, 0x75, 0x5a, 0x29, 0x26, 0x09, 0xfe, 0x8c, 0x92,
+	0xfe, 0x08, 0x61, 0x00, 0xfd, 0xe3, 0x0c, 0xfe, 0x8c, 0xb3, 0xfe, 0xde, 0xfb, 0x6e, 0x21, 0xa3,
+	0x77, 0xa5, 0x55, 0xc2, 0x2c, 0x22, 0x62, 0x55, 0x51, 0x26, 0x99, 0xcc, 0x09, 0x04, 0x30, 0x11,
+	0x56, 0xc3, 0x66, 0x40, 0x52, 0x61, 0x55, 0x51, 0x56, 0x3d, 0x1c, 0x9c, 0xa9, 0x00, 0xfd, 0xe3,
+	0x6e, 0xfe, 0x73, 0xcf, 0x97, 0xcd, 0xfe, 0x00, 0xa4, 0xa6, 0x54, 0x66, 0xa2, 0x77, 0xfe, 0x00,
+	0x02, 0x0d, 0x31, 0x94, 0xee, 0x11, 0x15, 0x0d, 0x08, 0x11, 0x9c, 0x9a, 0xaf, 0x10, 0xfe, 0x4a,
+	0x69, 0x00, 0xfd, 0xfd, 0xfd, 0xd4, 0xfe, 0x42, 0x49, 0xfe, 0xef, 0x5c, 0xa4, 0x66, 0x56, 0x25,
+	0xc0, 0x1d, 0xfe, 0x7b, 0xf0, 0x18, 0x9c, 0xaa, 0xfe, 0x00, 0xc5, 0xac, 0x31, 0x26, 0xc0, 0x35,
+	0x9c, 0xaa, 0x1c, 0x6d, 0x00, 0xfd, 0xe3, 0x05, 0xfe, 0x52, 0xec, 0xfe, 0x9d, 0x14, 0xfe, 0xdf,
+	0x1b, 0xc0, 0x21, 0xa4, 0x66, 0xa4, 0x66, 0xc2, 0x2c, 0x22, 0x18, 0x09, 0x51, 0x26, 0x99, 0xcc,
+	0x09, 0x66, 0xfe, 0x73, 0xd0, 0xa4, 0x65, 0x56, 0xc4, 0x29, 0x19, 0x08, 0x55, 0x51, 0x56, 0x9d,
+	0xa9, 0x08, 0x15, 0x00, 0xfd, 0xe4, 0xfe, 0x52, 0xeb, 0xa4, 0x67, 0xfe, 0x00, 0x43, 0x2a, 0x66,
+	0xc1, 0x9b, 0xac, 0xfe, 0xef, 0x7d, 0xc0, 0xfe, 0x53, 0x0d, 0x0d, 0xc1, 0x9b, 0xbb, 0x9b, 0xaa,
+	0x0d, 0xc0, 0x00, 0xfd, 0xfd, 0xfd, 0xd4, 0xfe, 0x73, 0xcf, 0xfe, 0xf7, 0xbe, 0x7e, 0x1d, 0xc0,
+	0xa2, 0x77, 0x99, 0xcb, 0xfe, 0x7c, 0x10, 0x31, 0xfe, 0xbd, 0xf7, 0x0e, 0xfe, 0x42, 0x6a, 0x41,
+	0x7a, 0x6f, 0x9b, 0xab, 0xfe, 0x84, 0x72, 0xfe, 0x4a, 0x49, 0x00, 0xfd, 0xe3, 0xa3, 0x66, 0x39,
+	0xfe, 0xa5, 0x75, 0xae, 0x21, 0x55, 0x21, 0x18, 0x31, 0xc2, 0x2c, 0x22, 0x18, 0x09, 0x35, 0x26,
+	0x99, 0xcc, 0x09, 0x04, 0x30, 0xa4, 0x65, 0x56, 0xc4, 0x9d, 0xa9, 0x42, 0x08, 0x39, 0x51, 0x56,
+	0x51, 0xa4, 0x66, 0xa7, 0x54, 0xfe, 0x08, 0x61, 0x00, 0xfd, 0xe3, 0xad, 0x12, 0x30, 0xfe, 0x00,
+	0xa4, 0xa5, 0x65, 0x5a, 0xc0, 0xa3, 0x86, 0x00, 0xfe, 0xc6, 0x59, 0xad, 0x21, 0xfe, 0x7c, 0x10,
+	0x39, 0x0d, 0xc0, 0x9c, 0xaa, 0x9b, 0xab, 0xa3, 0x76, 0x3d, 0x14, 0x00, 0xfd, 0xfd, 0xfd, 0xd3,
+	0xfe, 0xa5, 0x55, 0xfe, 0xff, 0xde, 0x56, 0x25, 0x1d, 0x31, 0xfe, 0xc6, 0x18, 0x99, 0xbc, 0x31,
+	0xfe, 0x8c, 0x72, 0xfe, 0x01, 0x06, 0xab, 0x41, 0x61, 0x6b, 0x35, 0x51, 0xfe, 0x8c, 0xb3, 0xfe,
+	0x19, 0x04, 0x00, 0xfd, 0xe3, 0xa6, 0x55, 0xfe, 0x63, 0x6e, 0xfe, 0xb5, 0xb6, 0xac, 0x22, 0x26,
+	0x66, 0x1d, 0xa2, 0x77, 0xc2, 0x2c, 0x59, 0x18, 0x55, 0x35, 0x65, 0x98, 0xbd, 0x09, 0xc0, 0xfe,
+	0x73, 0xf0, 0xa3, 0x76, 0x56, 0xc4, 0x9d, 0xaa, 0x41, 0x08, 0x39, 0x51, 0x56, 0x51, 0x25, 0xa9,
+	0x43, 0x3c, 0x00, 0xfd, 0xe3, 0xa5, 0x55, 0xfe, 0x73, 0xcf, 0xfe, 0x21, 0x87, 0x9c, 0xaa, 0xa2,
+	0x67, 0x66, 0x01, 0x00, 0xfe, 0x9c, 0xf3, 0x31, 0xfe, 0xa5, 0x55, 0xfe, 0x4a, 0xcc, 0x0d, 0x08,
+	0x51, 0x9b, 0xaa, 0x52, 0xfe, 0x7c, 0x51, 0xfe, 0x21, 0x24, 0x00, 0xfd, 0xfd, 0xfd, 0xd2, 0x02,
+	0xfe, 0xce, 0x79, 0x2c, 0x55, 0x6e, 0x1d, 0x31, 0x01, 0xac, 0x23, 0x31, 0xfe, 0x4a, 0xcc, 0x99,
+	0xbb, 0xa3, 0x77, 0x30, 0x35, 0x55, 0x25, 0xab, 0x32, 0xfe, 0x00, 0x20, 0x66, 0xfd, 0xe3, 0xaa,
+	0x33, 0xfe, 0x6b, 0xaf, 0xfe, 0xbe, 0x18, 0xa9, 0x43, 0x55, 0xc0, 0x22, 0x31, 0xc2, 0x2c, 0x22,
+	0x18, 0x55, 0x35, 0x26, 0x1d, 0x09, 0x6b, 0xfe, 0x73, 0xf0, 0x11, 0x56, 0xc4, 0x9d, 0xaa, 0x19,
+	0x08, 0x55, 0x25, 0x56, 0x51, 0x7e, 0xac, 0x22, 0xfe, 0x29, 0x65, 0x00, 0xfd, 0xe4, 0xfe, 0x63,
+	0x4d, 0x97, 0xcd, 0x95, 0xcf, 0xa4, 0x75, 0x56, 0xa2, 0x86, 0x95, 0xff, 0x39, 0x31, 0x94, 0xee,
+	0xfe, 0x42, 0x8b, 0x0d, 0x65, 0x56, 0x09, 0x9c, 0xaa, 0xfe, 0x74, 0x10, 0xfe, 0x42, 0x29, 0x00,
+	0xfd, 0xfd, 0xfd, 0xd2, 0xfe, 0x32, 0x08, 0xfe, 0xe7, 0x3c, 0xa5, 0x65, 0x56, 0xc2, 0xfe, 0x7c,
+	0x10, 0xfe, 0xef, 0x7d, 0x35, 0xfe, 0x01, 0x06, 0xaa, 0x52, 0xc1, 0x6e, 0x9c, 0xaa, 0xaf, 0x10,
+	0x9d, 0xa9, 0x00, 0xfd, 0xe4, 0xae, 0x01, 0x30, 0xfe, 0xce, 0x59, 0xa7, 0x44, 0x55, 0xc0, 0xa6,
+	0x66, 0x31, 0xc2, 0x2c, 0x1d, 0x18, 0x55, 0x35, 0x26, 0x98, 0xcd, 0x09, 0x6f, 0xfe, 0x74, 0x10,
+	0xa2, 0x87, 0x56, 0xc4, 0x30, 0x19, 0x08, 0x39, 0x51, 0x56, 0x55, 0x66, 0xac, 0x32, 0xfe, 0x3a,
+	0x08, 0x00, 0xfd, 0xe4, 0xfe, 0x4a, 0x8a, 0x25, 0x2b, 0xa7, 0x43, 0x56, 0x25, 0x1d, 0x9c, 0xab,
+	0xfe, 0xef, 0x7d, 0x66, 0xfe, 0x4a, 0xec, 0x08, 0x01, 0x39, 0x9b, 0xab, 0x21, 0xac, 0x21, 0x9d,
+	0xba, 0x00, 0xfd, 0xfd, 0xfd, 0xd2, 0x01, 0xfe, 0xf7, 0x9d, 0xa2, 0x77, 0x56, 0xc0, 0x2c, 0x9c,
+	0x99, 0xfe, 0x73, 0xf0, 0x31, 0xfe, 0xc6, 0x18, 0xfe, 0x00, 0x03, 0xfe, 0x42, 0x8a, 0x52, 0xc0,
+	0x7e, 0x9c, 0x9a, 0xfe, 0x84, 0x72, 0xfe, 0x42, 0x29, 0x00, 0xfd, 0xe4, 0xfe, 0x42, 0x49, 0xaf,
+	0x01, 0xfe, 0xd6, 0xba, 0xa3, 0x77, 0x26, 0x30, 0xa7, 0x44, 0xc3, 0x66, 0x55, 0x18, 0x55, 0x51,
+	0x26, 0x99, 0xcc, 0x09, 0x10, 0xfe, 0x74, 0x10, 0xa2, 0x87, 0x56, 0xc4, 0x9d, 0xaa, 0x40, 0x52,
+	0x39, 0x51, 0x56, 0x0e, 0x02, 0xab, 0x33, 0x95, 0xed, 0x00, 0xfd, 0xe4, 0xac, 0x22, 0x39, 0x1f,
+	0xa8, 0x33, 0x56, 0xc0, 0xa3, 0x76, 0x00, 0xfe, 0xce, 0x7a, 0x31, 0xfe, 0x6b, 0xcf, 0x9a, 0xcc,
+	0x01, 0x5a, 0x9b, 0xbb, 0x9c, 0x9a, 0xa6, 0x65, 0xa8, 0x43, 0xfe, 0x00, 0x00, 0xfd, 0xfd, 0xfd,
+	0xd2, 0xfe, 0x8c, 0x92, 0xfe, 0xf7, 0xde, 0x66, 0xc1, 0x31, 0x94, 0xee, 0x93, 0xef, 0x31, 0xfe,
+	0x9c, 0xf3, 0xfe, 0x00, 0xe5, 0x3d, 0x56, 0xc0, 0x3d, 0x26, 0x25, 0xfe, 0x21, 0x04, 0x00, 0xfd,
+	0xe4, 0x11, 0xae, 0x11, 0xfe, 0xde, 0xdb, 0xa2, 0x76, 0x56, 0xa2, 0x77, 0x31, 0xc3, 0x2c, 0x55,
+	0x18, 0x55, 0x35, 0x55, 0x99, 0xcc, 0x18, 0x09, 0x3a, 0xa2, 0x87, 0x56, 0xc4, 0x30, 0x12, 0x3e,
+	0x66, 0x51, 0x56, 0x0e, 0x3d, 0xaa, 0x33, 0x39, 0x00, 0xfd, 0xe4, 0xa6, 0x55, 0xfe, 0x63, 0x6e,
+	0xfe, 0x00, 0xc5, 0xa3, 0x76, 0x66, 0xc0, 0xa4, 0x65, 0x00, 0xfe, 0xa5, 0x55, 0x31, 0xfe, 0x94,
+	0xd3, 0xfe, 0x4a, 0xab, 0xa5, 0x65, 0x56, 0x9d, 0xaa, 0x9b, 0xab, 0xa2, 0x66, 0x09, 0xfe, 0x10,
+	0xa2, 0x00, 0xfd, 0xfd, 0xfd, 0xd0, 0xa2, 0x68, 0xfe, 0xb5, 0xb6, 0xfe, 0xff, 0xde, 0x56, 0xc1,
+	0x31, 0xfe, 0xad, 0x96, 0xa2, 0x77, 0x31, 0xfe, 0x6b, 0x8e, 0x0a, 0xa5, 0x75, 0x56, 0x3d, 0x35,
+	0xa4, 0x66, 0xac, 0x31, 0x14, 0x00, 0xfd, 0xe4, 0xfe, 0x5b, 0x0c, 0xae, 0x11, 0x26, 0xc0, 0x66,
+	0xa3, 0x66, 0x31, 0xc3, 0x2c, 0x55, 0x66, 0x55, 0x51, 0x26, 0x99, 0xcc, 0xab, 0x23, 0x09, 0xfe,
+	0x74, 0x10, 0x11, 0x56, 0xc4, 0x9d, 0xaa, 0x12, 0x3e, 0x52, 0x65, 0x56, 0x0e, 0x3d, 0x0d, 0x7e,
+	0x00, 0xfd, 0xe4, 0x6e, 0x01, 0xfe, 0x21, 0x87, 0x9b, 0xab, 0x7f, 0x69, 0xa3, 0x76, 0x00, 0xfe,
+	0x7b, 0xf0, 0xfe, 0xff, 0xff, 0xfe, 0xbd, 0xd7, 0xfe, 0x3a, 0x6a, 0x01, 0x56, 0x25, 0x9b, 0xab,
+	0x9d, 0xaa, 0xfe, 0x7c, 0x31, 0xfe, 0x29, 0x65, 0x00, 0xfd, 0xfd, 0xfd, 0xd0, 0xa9, 0x24, 0xfe,
+	0xce, 0x9a, 0xaa, 0x42, 0x56, 0xc1, 0x31, 0xfe, 0x8c, 0x92, 0xfe, 0xde, 0xdb, 0x1d, 0xfe, 0x32,
+	0x2a, 0x35, 0x3a, 0xc0, 0x3d, 0x51, 0x12, 0xa1, 0x98, 0x00, 0xfd, 0xe4, 0xa3, 0x66, 0x01, 0xae,
+	0x11, 0xfe, 0xe7, 0x3c, 0x26, 0x21, 0x04, 0x31, 0xc3, 0x2c, 0x1d, 0x66, 0x55, 0x35, 0x26, 0x99,
+	0xcc, 0x18, 0x09, 0xfe, 0x74, 0x10, 0xa2, 0x87, 0x56, 0xc4, 0x30, 0x9d, 0x99, 0x3e, 0x52, 0x65,
+	0x56, 0x0e, 0x3d, 0x39, 0xa6, 0x55, 0x19, 0x00, 0xfd, 0xe4, 0xfe, 0x52, 0xab, 0x9d, 0x8a, 0xfe,
+	0x00, 0x84, 0xa4, 0x66, 0x69, 0x7f, 0x98, 0xdd, 0x35, 0x2c, 0x98, 0xbc, 0xfe, 0x3a, 0x6a, 0x01,
+	0x39, 0x55, 0x3a, 0x9b, 0xbb, 0xfe, 0x73, 0xf0, 0x93, 0xfe, 0x00, 0xfd, 0xfd, 0xfd, 0xd0, 0xfe,
+	0x3a, 0x08, 0xfe, 0xe7, 0x3c, 0xa5, 0x65, 0x56, 0xc0, 0x22, 0x1d, 0xfe, 0x73, 0xf0, 0xfe, 0xf7,
+	0x9e, 0x21, 0xfe, 0x01, 0x06, 0x02, 0x3a, 0x3d, 0x6f, 0x9c, 0xaa, 0xb0, 0x10, 0x96, 0xdc, 0x00,
+	0xfd, 0xe4, 0xa7, 0x44, 0xfe, 0x63, 0x6e, 0xfe, 0xad, 0x75, 0xae, 0x11, 0x26, 0x66, 0xa4, 0x66,
+	0xa4, 0x66, 0xc3, 0x2c, 0x1d, 0x18, 0x09, 0x35, 0x26, 0x98, 0xdd, 0xac, 0x12, 0x09, 0xfe, 0x74,
+	0x10, 0xa2, 0x87, 0x56, 0xc4, 0x9d, 0xaa, 0x0d, 0x3e, 0x52, 0x65, 0x51, 0x0e, 0x3d, 0x25, 0x09,
+	0x3c, 0x00, 0xfd, 0xe4, 0xfe, 0x3a, 0x08, 0xa6, 0x56, 0x1a, 0xa8, 0x23, 0x55, 0x7a, 0x1d, 0x00,
+	0xfe, 0xe7, 0x3d, 0xa2, 0x76, 0xfe, 0x4a, 0xcc, 0x39, 0xc0, 0x65, 0x3d, 0x9c, 0x9a, 0xad, 0x21,
+	0x2d, 0x00, 0xfd, 0xfd, 0xfd, 0xd0, 0x2d, 0x09, 0xa3, 0x76, 0x56, 0xc0, 0x25, 0x9c, 0x9a, 0xfe,
+	0x73, 0xf0, 0xfe, 0xff, 0xff, 0xfe, 0xc6, 0x18, 0xfe, 0x00, 0x65, 0xfe, 0x42, 0x8b, 0x3d, 0xc0,
+	0x09, 0x9c, 0xaa, 0xfe, 0x84, 0x72, 0xfe, 0x31, 0xc7, 0x00, 0xfd, 0xe4, 0xab, 0x22, 0xfe, 0x6b,
+	0x8f, 0xfe, 0xb5, 0xd7, 0xab, 0x32, 0x26, 0x66, 0x18, 0x31, 0xc3, 0x2c, 0x55, 0x18, 0x55, 0x35,
+	0x26, 0x99, 0xcc, 0x18, 0x09, 0xfe, 0x74, 0x10, 0xa2, 0x87, 0x56, 0xc4, 0x9d, 0xa9, 0x0d, 0x39,
+	0x56, 0x65, 0x51, 0x56, 0x3d, 0x11, 0xac, 0x22, 0xfe, 0x29, 0x65, 0x00, 0xfd, 0xe4, 0xaa, 0x23,
+	0x39, 0x1a, 0xa7, 0x33, 0x56, 0x0e, 0xa3, 0x86, 0x00, 0xfe, 0xce, 0x79, 0xac, 0x22, 0xfe, 0x6b,
+	0xaf, 0x25, 0xa2, 0x77, 0x34, 0x3d, 0x9c, 0xab, 0x25, 0x24, 0x00, 0xfd, 0xfd, 0xfd, 0xd0, 0xfe,
+	0x7c, 0x31, 0x1d, 0xc2, 0x31, 0x96, 0xdd, 0xfe, 0x8c, 0x92, 0x31, 0xfe, 0x9d, 0x14, 0xfe, 0x01,
+	0x06, 0xac, 0x51, 0x3d, 0xc0, 0x6f, 0x3d, 0x25, 0x01, 0x00, 0xfd, 0xe4, 0xaf, 0x00, 0xfe, 0x6b,
+	0xcf, 0xfe, 0xc6, 0x38, 0x35, 0x55, 0x66, 0x1d, 0x31, 0xc3, 0x2c, 0x1d, 0x18, 0x55, 0x35, 0x21,
+	0x25, 0x18, 0x09, 0x3a, 0xa2, 0x87, 0x56, 0xc4, 0x9d, 0x99, 0x9d, 0xaa, 0x39, 0x2a, 0x52, 0x65,
+	0x56, 0x3d, 0x09, 0xad, 0x21, 0xfe, 0x3a, 0x08, 0x00, 0xfd, 0xe4, 0xa5, 0x55, 0xfe, 0x63, 0x4d,
+	0xfe, 0x00, 0xa4, 0x0e, 0x66, 0xc0, 0xa4, 0x75, 0x00, 0xfe, 0xad, 0x96, 0x31, 0xfe, 0x8c, 0x92,
+	0xfe, 0x42, 0xab, 0x39, 0x34, 0x02, 0x9c, 0xab, 0x3d, 0xae, 0x11, 0xfe, 0x08, 0x41, 0x00, 0xfd,
+	0xfd, 0xfd, 0xcf, 0xfe, 0x9d, 0x14, 0xfe, 0xff, 0xde, 0x56, 0xc1, 0x31, 0xfe, 0xbd, 0xf7, 0x9c,
+	0xab, 0x31, 0xfe, 0x7c, 0x10, 0x0a, 0xa6, 0x65, 0x65, 0x09, 0x3d, 0xa4, 0x66, 0xab, 0x32, 0x14,
+	0x00, 0xfd, 0xe4, 0xfe, 0x42, 0x49, 0xad, 0x12, 0xfe, 0xce, 0x79, 0xa6, 0x55, 0x55, 0xc0, 0x1d,
+	0xa2, 0x77, 0xc3, 0x2c, 0x1d, 0x18, 0x55, 0x35, 0x51, 0x9a, 0xbb, 0x18, 0x09, 0x3a, 0x11, 0x56,
+	0xc4, 0x9d, 0x99, 0x9d, 0xaa, 0x51, 0x51, 0x56, 0x65, 0x56, 0x3d, 0xc0, 0xac, 0x22, 0x96, 0xdc,
+	0x00, 0xfd, 0xe4, 0x6e, 0x39, 0xfe, 0x19, 0x46, 0x9c, 0x9a, 0x7f, 0xc0, 0xa3, 0x86, 0x00, 0xfe,
+	0x8c, 0x72, 0x31, 0x30, 0xfe, 0x3a, 0x4a, 0x39, 0x65, 0x0c, 0x9c, 0x9a, 0xc0, 0xfe, 0x84, 0x51,
+	0xfe, 0x18, 0xe3, 0x00, 0xfd, 0xfd, 0xfd, 0xce, 0xa4, 0x56, 0xfe, 0xb5, 0xf7, 0xaf, 0x20, 0x56,
+	0xc1, 0x31, 0xfe, 0xa5, 0x34, 0xa8, 0x45, 0x31, 0x2a, 0x99, 0xcd, 0xa3, 0x66, 0xc1, 0x55, 0x0d,
+	0xa3, 0x76, 0x00, 0xfd, 0xe5, 0x19, 0xab, 0x23, 0xfe, 0xd6, 0xba, 0xa3, 0x77, 0x59, 0x7a, 0xa6,
+	0x56, 0x31, 0xc3, 0x2c, 0x1d, 0x18, 0x55, 0x51, 0x51, 0x9a, 0xbb, 0x18, 0x09, 0xfe, 0x74, 0x10,
+	0x11, 0x56, 0xc4, 0x9c, 0xaa, 0x9d, 0x9a, 0x39, 0x51, 0x56, 0x55, 0x66, 0x3d, 0x56, 0xac, 0x21,
+	0x9b, 0xcb, 0x00, 0xfd, 0xe5, 0x19, 0x99, 0xbc, 0x94, 0xef, 0xa4, 0x56, 0xc0, 0xa2, 0x87, 0x00,
+	0x3c, 0x31, 0xfe, 0xc6, 0x39, 0xfe, 0x32, 0x09, 0x39, 0x2a, 0x9d, 0xaa, 0x9c, 0x9a, 0x9d, 0x9a,
+	0xfe, 0x7c, 0x31, 0xfe, 0x29, 0x86, 0x00, 0xfd, 0xfd, 0xfd, 0xce, 0xa9, 0x24, 0xfe, 0xce, 0x9a,
+	0xaa, 0x42, 0x56, 0xc1, 0x25, 0x16, 0xfe, 0xde, 0xfc, 0xa5, 0x55, 0x21, 0x02, 0x6b, 0xc0, 0x11,
+	0x9d, 0x9a, 0xad, 0x21, 0x9a, 0xca, 0x00, 0xfd, 0xe4, 0x6e, 0x34, 0xab, 0x22, 0xfe, 0xde, 0xfb,
+	0x29, 0x5a, 0x7f, 0x31, 0xc4, 0x66, 0x55, 0x18, 0x55, 0x35, 0x21, 0x9a, 0xbb, 0x18, 0xc0, 0xfe,
+	0x7c, 0x31, 0xc6, 0x9c, 0xaa, 0x3e, 0x52, 0x65, 0x11, 0x56, 0x02, 0x56, 0x66, 0xa9, 0x43, 0x21,
+	0x00, 0xfd, 0xe5, 0xfe, 0x42, 0x69, 0x02, 0xfe, 0x00, 0x02, 0xa7, 0x24, 0x66, 0xa2, 0x76, 0x1a,
+	0xad, 0x00, 0x1d, 0x9a, 0xbb, 0xfe, 0x32, 0x29, 0x39, 0x2a, 0x9d, 0xaa, 0x26, 0x9b, 0xbb, 0xfe,
+	0x74, 0x10, 0xfe, 0x42, 0x29, 0x00, 0xfd, 0xfd, 0xfd, 0xce, 0xae, 0x01, 0x21, 0xa7, 0x54, 0x1d,
+	0xc2, 0xfe, 0x73, 0xcf, 0x18, 0x28, 0xfe, 0x01, 0x47, 0x11, 0x56, 0xc0, 0x11, 0x35, 0xfe, 0x7c,
+	0x51, 0xfe, 0x4a, 0x6a, 0xfe, 0x00, 0x00, 0xfd, 0xe4, 0xa3, 0x66, 0x08, 0xac, 0x21, 0xfe, 0xe7,
+	0x1b, 0xc0, 0x5a, 0x7f, 0xa6, 0x55, 0xc4, 0x66, 0x1d, 0x18, 0x55, 0x35, 0x21, 0x9a, 0xbb, 0x18,
+	0x1d, 0xfe, 0x7c, 0x31, 0xc6, 0x9c, 0xaa, 0x9c, 0xaa, 0x56, 0x51, 0x11, 0x56, 0x3d, 0x5a, 0x61,
+	0x39, 0x38, 0x19, 0x00, 0xfd, 0xe4, 0xae, 0x01, 0xa9, 0x34, 0xfe, 0x00, 0x02, 0xa7, 0x24, 0x04,
+	0x09, 0x7a, 0x00, 0xfe, 0xe7, 0x5d, 0x7e, 0xfe, 0x42, 0x8b, 0x2a, 0xc0, 0x51, 0x9b, 0xab, 0x9b,
+	0xbb, 0x21, 0x99, 0xcb, 0x00, 0xfd, 0xfd, 0xfd, 0xce, 0xfe, 0x4a, 0x8a, 0xfe, 0xef, 0x5d, 0xa3,
+	0x66, 0xc1, 0x7e, 0x35, 0xfe, 0x63, 0x6e, 0xfe, 0xff, 0xff, 0x93, 0xff, 0x12, 0x16, 0x09, 0xc0,
+	0x11, 0x9d, 0x9a, 0xfe, 0x84, 0x72, 0xfe, 0x31, 0xa7, 0x00, 0xfd, 0xe4, 0xa7, 0x44, 0x0d, 0xae,
+	0x20, 0xb0, 0x00, 0x55, 0xc0, 0xa2, 0x87, 0x31, 0xc4, 0x2c, 0x55, 0x18, 0x55, 0x35, 0x51, 0x9a,
+	0xbb, 0x18, 0x1d, 0xfe, 0x7c, 0x31, 0xc4, 0x6e, 0x09, 0x9b, 0xaa, 0x9d, 0xaa, 0x51, 0x56, 0x55,
+	0x66, 0x65, 0x56, 0x55, 0x25, 0xaa, 0x33, 0x01, 0x00, 0xfd, 0xe4, 0xaa, 0x23, 0x39, 0xfe, 0x00,
+	0x02, 0xa7, 0x24, 0x55, 0xc0, 0xa4, 0x76, 0x00, 0xfe, 0xd6, 0xba, 0x2c, 0x39, 0x9d, 0xaa, 0x2a,
+	0x20, 0x26, 0x9c, 0xaa, 0xad, 0x21, 0x7e, 0x00, 0xfd, 0xfd, 0xfd, 0xce, 0xfe, 0x63, 0x4d, 0xfe,
+	0xef, 0x9d, 0x7f, 0xc1, 0x31, 0x93, 0xef, 0xfe, 0x6b, 0xaf, 0xfe, 0xff, 0xff, 0xfe, 0xb5, 0xb6,
+	0x17, 0xad, 0x41, 0x51, 0x11, 0xc0, 0x09, 0xfe, 0x8c, 0x92, 0x10, 0x00, 0xfd, 0xe4, 0xab, 0x22,
+	0xfe, 0x6b, 0x8f, 0xfe, 0xad, 0x96, 0xad, 0x21, 0x55, 0xc0, 0xa3, 0x77, 0x31, 0xc4, 0x2c, 0x55,
+	0x18, 0x09, 0x35, 0x51, 0x9a, 0xbb, 0x1d, 0x18, 0xfe, 0x7c, 0x31, 0xc4, 0x7e, 0x51, 0x9b, 0xab,
+	0x9d, 0x9a, 0x65, 0x51, 0x56, 0x65, 0x5a, 0x66, 0x55, 0x11, 0xad, 0x11, 0xfe, 0x29, 0x66, 0x00,
+	0xfd, 0xe4, 0xa6, 0x45, 0xfe, 0x5b, 0x2d, 0x1a, 0xa5, 0x45, 0x59, 0xc0, 0xa4, 0x86, 0x00, 0xfe,
+	0xbe, 0x18, 0xaf, 0x10, 0xfe, 0x73, 0xcf, 0x11, 0x2a, 0x20, 0x9b, 0xaa, 0x9d, 0x9a, 0xa8, 0x44,
+	0xa8, 0x53, 0x00, 0xfd, 0xfd, 0xfd, 0xce, 0xfe, 0x7c, 0x10, 0xfe, 0xf7, 0xbe, 0xc3, 0xfe, 0x95,
+	0x14, 0x9c, 0xba, 0x31, 0xfe, 0x9d, 0x14, 0xfe, 0x19, 0x88, 0xaa, 0x42, 0x11, 0xc1, 0x1d, 0xad,
+	0x21, 0xfe, 0x10, 0x82, 0x00, 0xfd, 0xe4, 0xaf, 0x01, 0xae, 0x01, 0xfe, 0xbd, 0xf7, 0xaa, 0x33,
+	0x55, 0x66, 0xa5, 0x55, 0x31, 0xc4, 0x2c, 0x55, 0x66, 0x55, 0x35, 0x21, 0x9a, 0xbb, 0x1d, 0x18,
+	0xfe, 0x7c, 0x31, 0xc4, 0x7e, 0x9d, 0x9a, 0x9b, 0xab, 0x51, 0x51, 0x65, 0x56, 0x65, 0x56, 0xc0,
+	0x51, 0x02, 0xad, 0x22, 0xfe, 0x3a, 0x08, 0x00, 0xfd, 0xe4, 0xa3, 0x66, 0x39, 0x3a, 0x66, 0x3a,
+	0x35, 0xa5, 0x75, 0x00, 0xfe, 0xad, 0x75, 0xfe, 0xff, 0xff, 0xfe, 0x8c, 0x92, 0xfe, 0x3a, 0x4a,
+	0x2a, 0x20, 0x9b, 0xaa, 0x9d, 0x9a, 0x3d, 0xad, 0x21, 0xfe, 0x00, 0x20, 0x00, 0xfd, 0xfd, 0xfd,
+	0xcd, 0xfe, 0x94, 0xb2, 0x22, 0x66, 0xc1, 0x9b, 0xab, 0xfe, 0x63, 0xaf, 0xad, 0x31, 0x31, 0xfe,
+	0x84, 0x51, 0xfe, 0x29, 0xe9, 0xa7, 0x54, 0x65, 0xc1, 0x39, 0x09, 0x05, 0x00, 0xfd, 0xe4, 0xfe,
+	0x4a, 0x6a, 0xab, 0x12, 0xfe, 0xc6, 0x38, 0xa8, 0x44, 0x55, 0xc0, 0x18, 0x31, 0xc4, 0x2c, 0x55,
+	0x18, 0x55, 0x35, 0x51, 0x25, 0x1d, 0x18, 0xfe, 0x7c, 0x31, 0xc4, 0x7e, 0x9d, 0x9a, 0x39, 0x51,
+	0x56, 0x51, 0x65, 0x5a, 0x66, 0x29, 0x56, 0x35, 0xae, 0x20, 0x95, 0xee, 0xfe, 0x00, 0x00, 0xfd,
+	0xe4, 0x05, 0xfe, 0x5b, 0x0c, 0xfe, 0x19, 0x46, 0x24, 0xa3, 0x56, 0x66, 0xa4, 0x76, 0x00, 0xfe,
+	0x8c, 0xb2, 0x31, 0xfe, 0xa5, 0x35, 0x21, 0xa8, 0x43, 0x62, 0x29, 0x0d, 0x21, 0xfe, 0x84, 0x31,
+	0xfe, 0x10, 0x82, 0x00, 0xfd, 0xfd, 0xfd, 0xcc, 0xa2, 0x67, 0x1c, 0x22, 0x66, 0xc0, 0x9d, 0x99,
+	0x97, 0xce, 0xfe, 0x32, 0x6b, 0xfe, 0xbd, 0xf7, 0x31, 0xfe, 0x6b, 0xcf, 0x94, 0xef, 0xa4, 0x66,
+	0x65, 0x1d, 0x11, 0xa6, 0x55, 0xa4, 0x66, 0x00, 0xfd, 0xe5, 0xfe, 0x52, 0xec, 0xa6, 0x55, 0xfe,
+	0xc6, 0x58, 0x3a, 0x51, 0xc0, 0xa5, 0x66, 0x31, 0xc4, 0x2c, 0x1d, 0x18, 0x55, 0x51, 0x51, 0x9a,
+	0xbb, 0x1d, 0x18, 0xfe, 0x7c, 0x31, 0xc4, 0x7e, 0x9b, 0xab, 0x9b, 0xab, 0x65, 0x51, 0x56, 0x65,
+	0x56, 0x65, 0xc0, 0x56, 0x29, 0xad, 0x22, 0x3c, 0x00, 0xfd, 0xe5, 0x25, 0x98, 0xcc, 0xfe, 0x00,
+	0x02, 0xa6, 0x24, 0x66, 0xa4, 0x75, 0x00, 0x38, 0xfe, 0xff, 0xff, 0xfe, 0xb5, 0xb6, 0xfe, 0x29,
+	0xe8, 0xa9, 0x43, 0x20, 0x29, 0x12, 0x51, 0xfe, 0x84, 0x51, 0xfe, 0x18, 0xe3, 0x00, 0xfd, 0xfd,
+	0xfd, 0xcc, 0xa4, 0x56, 0xfe, 0xb5, 0xd7, 0xfe, 0xff, 0xde, 0x1d, 0x9d, 0x9a, 0x99, 0xbc, 0x98,
+	0xbc, 0xfe, 0x00, 0xc6, 0xfe, 0xce, 0x9a, 0x2c, 0x39, 0x9b, 0xab, 0xa2, 0x77, 0xc1, 0x09, 0xa9,
+	0x43, 0x61, 0x00, 0xfd, 0xe4, 0x6e, 0xfe, 0x6b, 0x8e, 0x6b, 0xa7, 0x43, 0xfe, 0xde, 0xdb, 0xa4,
+	0x55, 0x26, 0xa5, 0x66, 0x31, 0xc4, 0x2c, 0x1d, 0x18, 0x55, 0x51, 0x51, 0x9a, 0xbb, 0x1d, 0x18,
+	0xfe, 0x7c, 0x31, 0xc5, 0x0d, 0x9c, 0xaa, 0x56, 0x51, 0x65, 0x56, 0x29, 0x5a, 0xc0, 0x29, 0x35,
+	0xaa, 0x33, 0x38, 0x00, 0xfd, 0xe5, 0xfe, 0x4a, 0xab, 0x09, 0x07, 0xa6, 0x35, 0x56, 0xa3, 0x76,
+	0x00, 0xfe, 0x5b, 0x0d, 0x31, 0xfe, 0xc6, 0x39, 0xfe, 0x19, 0xa8, 0xab, 0x41, 0x20, 0x9c, 0x9a,
+	0x12, 0x9c, 0xaa, 0xfe, 0x84, 0x51, 0xfe, 0x21, 0x45, 0x00, 0xfd, 0xfd, 0xfd, 0xcc, 0xa6, 0x45,
+	0xfe, 0xc6, 0x38, 0xad, 0x21, 0x9d, 0x9a, 0x99, 0xbc, 0x99, 0xbc, 0x97, 0xbd, 0x00, 0xfe, 0xde,
+	0xfb, 0xa6, 0x55, 0xfe, 0x42, 0x8b, 0x7e, 0x6f, 0xc0, 0x7e, 0x09, 0xab, 0x32, 0x2d, 0x00, 0xfd,
+	0xe3, 0x6e, 0xfe, 0x52, 0xcb, 0xa7, 0x45, 0xa4, 0x66, 0x35, 0x0d, 0xfe, 0xbe, 0x18, 0xa9, 0x43,
+	0x22, 0x31, 0xc4, 0x66, 0x55, 0x18, 0x55, 0x35, 0x51, 0x9b, 0xab, 0x1d, 0x18, 0xfe, 0x7c, 0x31,
+	0xc3, 0x7e, 0x51, 0x99, 0xbc, 0x25, 0x51, 0x55, 0x56, 0x66, 0x29, 0x7f, 0x41, 0x0e, 0x11, 0x39,
+	0xaa, 0x33, 0x97, 0xdc, 0x00, 0xfd, 0xe4, 0xfe, 0x42, 0x49, 0xa8, 0x35, 0x1f, 0xa3, 0x56, 0xc0,
+	0xa2, 0x77, 0x00, 0x29, 0x2c, 0x96, 0xdd, 0xfe, 0x19, 0xa8, 0x25, 0x55, 0x9c, 0xab, 0x12, 0x9b,
+	0xab, 0xfe, 0x7c, 0x31, 0xfe, 0x31, 0xa6, 0x00, 0xfd, 0xfd, 0xfd, 0xcc, 0xa9, 0x34, 0xfe, 0xce,
+	0x79, 0xaa, 0x33, 0x98, 0xbc, 0x99, 0xbc, 0x99, 0xbc, 0x1e, 0x00, 0xfe, 0xe7, 0x3d, 0xa2, 0x76,
+	0xfe, 0x32, 0x2a, 0xa5, 0x65, 0xc1, 0x25, 0x9d, 0x9a, 0xad, 0x21, 0x94, 0xfd, 0x00, 0xfd, 0xe2,
+	0xa5, 0x55, 0xfe, 0x63, 0x6e, 0xa2, 0x77, 0xa7, 0x54, 0xfe, 0xd6, 0xda, 0xa4, 0x66, 0x95, 0xef,
+	0xfe, 0x6b, 0x8f, 0x25, 0xfe, 0xe7, 0x3c, 0xa6, 0x55, 0xc4, 0x2c, 0x55, 0x66, 0x55, 0x35, 0x51,
+	0x9b, 0xab, 0x1d, 0x18, 0xfe, 0x7c, 0x31, 0xc3, 0x7e, 0x9c, 0xaa, 0x9a, 0xab, 0x52, 0x51, 0x65,
+	0x56, 0x3d, 0x35, 0xfe, 0x00, 0x03, 0xfe, 0x19, 0x87, 0xfe, 0x9d, 0x14, 0x21, 0x99, 0xbc, 0xfe,
+	0x6b, 0x8e, 0xa6, 0x56, 0x50, 0x2d, 0x00, 0xfd, 0xe2, 0xaf, 0x01, 0xfe, 0x6b, 0xd0, 0x36, 0x24,
+	0xa2, 0x67, 0x7e, 0x0e, 0xaa, 0x12, 0xfe, 0xf7, 0xbe, 0x21, 0xfe, 0x29, 0xe8, 0xa8, 0x54, 0x16,
+	0x9c, 0xab, 0x12, 0x9a, 0xac, 0xfe, 0x7c, 0x10, 0xfe, 0x3a, 0x08, 0x00, 0xfd, 0xfd, 0xfd, 0xcc,
+	0xac, 0x12, 0xfe, 0xd6, 0xdb, 0x3a, 0x95, 0xcf, 0x99, 0xcc, 0x99, 0xbc, 0x94, 0xee, 0x2b, 0xfe,
+	0xef, 0x9e, 0x9c, 0xba, 0xfe, 0x29, 0xe9, 0x25, 0x56, 0x25, 0xc0, 0x9d, 0xaa, 0xae, 0x10, 0xfe,
+	0x42, 0x49, 0x00, 0xfd, 0xe1, 0xab, 0x22, 0xfe, 0x6b, 0xaf, 0x56, 0xad, 0x30, 0xaf, 0x00, 0x7f,
+	0x30, 0xa4, 0x65, 0x56, 0xfe, 0xb5, 0x96, 0x93, 0xdf, 0xfe, 0xce, 0x9a, 0xab, 0x32, 0xc3, 0x2c,
+	0x55, 0x66, 0x09, 0x30, 0x55, 0x9a, 0xbc, 0xac, 0x22, 0x18, 0xfe, 0x7c, 0x31, 0xc4, 0x9a, 0xbb,
+	0x9b, 0xab, 0x55, 0x61, 0xc1, 0x94, 0xcf, 0x9d, 0xba, 0xfe, 0x94, 0xb3, 0xfe, 0xdf, 0x1c, 0xa3,
+	0x76, 0x51, 0xc0, 0x9b, 0xaa, 0xfe, 0x7c, 0x31, 0x51, 0xa5, 0x65, 0xfe, 0x29, 0x66, 0x00, 0xfd,
+	0xe1, 0xac, 0x12, 0xfe, 0x74, 0x31, 0x94, 0xde, 0xfe, 0x00, 0xe5, 0x9d, 0xb9, 0x6f, 0x29, 0x9c,
+	0xcb, 0xfe, 0xef, 0x7d, 0x3c, 0xfe, 0x32, 0x09, 0x20, 0x16, 0x9c, 0xab, 0x9c, 0xaa, 0x9b, 0x8a,
+	0xfe, 0x73, 0xf0, 0xfe, 0x4a, 0x49, 0x00, 0xfd, 0xfd, 0xfd, 0xcc, 0xae, 0x01, 0xfe, 0xde, 0xfb,
+	0x05, 0x94, 0xdf, 0x9a, 0xbb, 0x99, 0xbc, 0x92, 0xef, 0x60, 0xfe, 0xf7, 0xbe, 0x99, 0xcc, 0x02,
+	0xab, 0x41, 0x20, 0x6e, 0xc0, 0x51, 0xae, 0x11, 0xfe, 0x39, 0xe7, 0x00, 0xfd, 0xe0, 0xfe, 0x42,
+	0x49, 0xac, 0x23, 0x59, 0xfe, 0xbd, 0xf7, 0xaa, 0x33, 0x65, 0x5a, 0x29, 0x21, 0x35, 0xa5, 0x66,
+	0x9c, 0xaa, 0xfe, 0xa5, 0x55, 0xc0, 0xfe, 0xef, 0x7d, 0xa4, 0x66, 0xc1, 0x2c, 0x55, 0x18, 0x09,
+	0x9d, 0xaa, 0x55, 0x9b, 0xab, 0x24, 0x1d, 0xfe, 0x84, 0x51, 0x56, 0x11, 0x09, 0x11, 0x9d, 0x9a,
+	0x2a, 0x9d, 0xaa, 0x56, 0x0c, 0x36, 0x07, 0xfe, 0x84, 0x51, 0x1c, 0x18, 0x3a, 0x21, 0x26, 0xc0,
+	0x7f, 0x21, 0xfe, 0x9c, 0xf4, 0x94, 0xde, 0xaa, 0x33, 0xfe, 0x4a, 0x6a, 0xfe, 0x00, 0x00, 0xfd,
+	0xe0, 0xa9, 0x34, 0xfe, 0x7c, 0x72, 0x98, 0xcc, 0x0f, 0x97, 0xdd, 0x61, 0xa2, 0x87, 0x9a, 0xca,
+	0x35, 0xa2, 0x77, 0xfe, 0x3a, 0x4a, 0xa3, 0x76, 0xc0, 0x35, 0x9c, 0xaa, 0x9a, 0x9b, 0xfe, 0x6b,
+	0xcf, 0x14, 0x00, 0xfd, 0xfd, 0xfd, 0xcc, 0xfe, 0x42, 0x49, 0xfe, 0xd6, 0xdb, 0x98, 0xbc, 0x15,
+	0x9a, 0xab, 0x99, 0xbb, 0xfe, 0x00, 0x03, 0xfe, 0x3a, 0x09, 0x2c, 0x96, 0xdd, 0x02, 0xab, 0x42,
+	0x25, 0xc0, 0x2a, 0x11, 0xaf, 0x00, 0xfe, 0x31, 0xa6, 0x00, 0xfd, 0xde, 0xa2, 0x77, 0xfe, 0x5a,
+	0xec, 0xa6, 0x45, 0xa5, 0x65, 0x3e, 0xa5, 0x66, 0x55, 0x7a, 0xc0, 0x56, 0x04, 0x1d, 0x2c, 0x6e,
+	0xc0, 0x30, 0x94, 0xde, 0x39, 0x2c, 0x31, 0x2c, 0x1d, 0x18, 0x09, 0x30, 0x21, 0x9b, 0xab, 0x1d,
+	0xc0, 0xfe, 0x84, 0x72, 0x51, 0x11, 0x09, 0x7a, 0x9a, 0xab, 0x9b, 0xab, 0xc0, 0x99, 0xbb, 0x00,
+	0xfe, 0x73, 0xcf, 0x08, 0xa9, 0x33, 0x51, 0x21, 0x26, 0xc1, 0x7a, 0x26, 0x29, 0x6f, 0x95, 0xdd,
+	0xfe, 0x63, 0x8e, 0xa7, 0x55, 0x01, 0xfe, 0x00, 0x20, 0x00, 0xfd, 0xde, 0xa7, 0x44, 0x22, 0x9d,
+	0x9a, 0x94, 0xdf, 0x98, 0xdc, 0x97, 0xdd, 0xa3, 0x76, 0x00, 0x21, 0xa6, 0x55, 0xfe, 0x42, 0x8b,
+	0x7e, 0xc0, 0x9d, 0xaa, 0x9c, 0x9a, 0x9b, 0x9a, 0xfe, 0x6b, 0x8e, 0x28, 0x00, 0xfd, 0xfd, 0xfd,
+	0xcc, 0xfe, 0x52, 0xaa, 0x31, 0x96, 0xce, 0x16, 0x99, 0xcc, 0x99, 0xbb, 0x00, 0xfe, 0x4a, 0xab,
+	0xfe, 0xff, 0xff, 0x93, 0xff, 0xfe, 0x19, 0xa8, 0xab, 0x52, 0x25, 0xc0, 0x6f, 0x51, 0xae, 0x20,
+	0xfe, 0x29, 0x45, 0x00, 0xfd, 0xdd, 0x01, 0xfe, 0x6b, 0x6e, 0x6f, 0xab, 0x32, 0x21, 0x35, 0x26,
+	0x29, 0x26, 0xc0, 0xa4, 0x76, 0xa3, 0x67, 0xc5, 0x21, 0x9a, 0xbb, 0x35, 0x31, 0x2c, 0x18, 0x55,
+	0x9d, 0xaa, 0x21, 0x9b, 0xab, 0xab, 0x33, 0x69, 0xfe, 0x84, 0x72, 0x51, 0xc0, 0x7e, 0x9d, 0x9a,
+	0x34, 0x9a, 0xab, 0xfe, 0x00, 0x03, 0xfe, 0x63, 0x6e, 0x39, 0x2c, 0x18, 0x26, 0x21, 0x26, 0x7f,
+	0xc1, 0x26, 0xc0, 0x29, 0x26, 0x35, 0x39, 0xfe, 0x7c, 0x10, 0x5a, 0x3d, 0x01, 0x00, 0xfd, 0xdd,
+	0xa5, 0x55, 0xfe, 0x8c, 0xb3, 0x6f, 0x94, 0xde, 0x9a, 0xbb, 0x27, 0x9d, 0xca, 0x00, 0xfe, 0xd6,
+	0xba, 0xa9, 0x34, 0xfe, 0x52, 0xec, 0x9d, 0x99, 0x7f, 0x9d, 0x9a, 0x9b, 0xbb, 0x9c, 0x8a, 0xfe,
+	0x63, 0x4d, 0x66, 0x00, 0xfd, 0xfd, 0xfd, 0xcc, 0x28, 0xfe, 0xb5, 0xf8, 0xfe, 0x74, 0x32, 0x95,
+	0xdd, 0x0a, 0x9a, 0xcb, 0x00, 0xfe, 0x5b, 0x2d, 0xfe, 0xff, 0xff, 0x92, 0xff, 0x0a, 0x34, 0x55,
+	0x2a, 0x6b, 0x20, 0x1d, 0xfe, 0x21, 0x24, 0x00, 0xfd, 0xdc, 0xae, 0x01, 0xaf, 0x01, 0xc0, 0xfe,
+	0xb5, 0xb6, 0xac, 0x22, 0x65, 0x26, 0x29, 0x26, 0x35, 0xa5, 0x65, 0x6f, 0xc8, 0x98, 0xcd, 0x51,
+	0xa6, 0x54, 0x18, 0x09, 0x30, 0x55, 0x9c, 0xaa, 0x2c, 0x55, 0xfe, 0x84, 0x72, 0x51, 0x7e, 0xc0,
+	0x2a, 0xfe, 0x01, 0x06, 0x01, 0xfe, 0xc6, 0x59, 0x2c, 0xc0, 0x29, 0x21, 0x35, 0xa2, 0x77, 0xa2,
+	0x77, 0xa2, 0x77, 0xc1, 0x1d, 0x35, 0x26, 0x29, 0x26, 0x35, 0x9d, 0xaa, 0xfe, 0x94, 0xd3, 0x97,
+	0xcd, 0xa6, 0x55, 0xfe, 0x31, 0xc7, 0x00, 0xfd, 0xdc, 0xa3, 0x67, 0xfe, 0x8c, 0xb3, 0xa7, 0x44,
+	0x94, 0xdf, 0x9a, 0xbb, 0x98, 0xcc, 0x98, 0xdc, 0x00, 0xfe, 0xce, 0x7a, 0x2c, 0xfe, 0x5b, 0x2d,
+	0x9a, 0xbb, 0xa2, 0x77, 0x9d, 0x9a, 0x9b, 0xaa, 0x9c, 0x9b, 0x39, 0x01, 0xfe, 0x00, 0x00, 0xfd,
+	0xfd, 0xfd, 0xcc, 0x39, 0xfe, 0x9d, 0x76, 0xfe, 0x53, 0x6e, 0x0f, 0x97, 0xdd, 0x7a, 0x00, 0xfe,
+	0x63, 0x6e, 0xfe, 0xff, 0xff, 0xfe, 0xbd, 0xd7, 0xfe, 0x21, 0xe9, 0x39, 0x51, 0x6f, 0xc0, 0x25,
+	0x1d, 0xfe, 0x18, 0xe3, 0x00, 0xfd, 0xdb, 0xfe, 0x4a, 0x8a, 0x21, 0xa3, 0x76, 0xfe, 0xc6, 0x59,
+	0xa7, 0x54, 0x26, 0x29, 0xc0, 0x26, 0xa3, 0x77, 0xa4, 0x66, 0xcb, 0x2c, 0x35, 0x30, 0xa2, 0x66,
+	0x30, 0x55, 0x9c, 0xaa, 0x2c, 0x55, 0xfe, 0x84, 0x72, 0x65, 0x56, 0x93, 0xef, 0xa5, 0x65, 0xfe,
+	0xc6, 0x18, 0x2c, 0x31, 0x9b, 0xba, 0x21, 0x35, 0xa3, 0x76, 0x2c, 0x31, 0xc5, 0x9c, 0xaa, 0x26,
+	0xc1, 0x30, 0xc0, 0x94, 0xde, 0xfe, 0x6b, 0x8f, 0x1d, 0xfe, 0x52, 0xaa, 0x00, 0xfd, 0xdb, 0x6f,
+	0xfe, 0x94, 0xd3, 0xaa, 0x33, 0x96, 0xce, 0x9a, 0xab, 0x99, 0xbb, 0x96, 0xed, 0x00, 0xfe, 0xc6,
+	0x59, 0xad, 0x21, 0xfe, 0x63, 0x6e, 0x97, 0xcd, 0xa3, 0x76, 0x35, 0x9b, 0xaa, 0x1a, 0xfe, 0x53,
+	0x0c, 0xa4, 0x76, 0x00, 0xfd, 0xfd, 0xfd, 0xcc, 0x0d, 0xac, 0x12, 0xfe, 0x32, 0x6b, 0x93, 0xff,
+	0x9b, 0xda, 0xa6, 0x44, 0x00, 0xfe, 0x73, 0xcf, 0x31, 0xfe, 0xb5, 0xd7, 0xfe, 0x29, 0xe9, 0xaa,
+	0x42, 0x2a, 0x6b, 0x34, 0x2a, 0xab, 0x33, 0xfe, 0x18, 0xe3, 0x00, 0xfd, 0xd9, 0xa4, 0x66, 0x39,
+	0xa4, 0x66, 0xa8, 0x54, 0xfe, 0xd6, 0xda, 0xa3, 0x77, 0x51, 0x7e, 0x26, 0x29, 0xa5, 0x56, 0xa2,
+	0x77, 0xca, 0x2c, 0xc0, 0x31, 0xc0, 0x2c, 0x04, 0x30, 0x12, 0x9d, 0xaa, 0x2c, 0x1d, 0xfe, 0x84,
+	0x51, 0x9b, 0xab, 0x7f, 0xfe, 0xbd, 0xf7, 0x1d, 0x31, 0x9d, 0xa9, 0x26, 0x35, 0x18, 0x1d, 0x2c,
+	0xc2, 0x31, 0xc4, 0x1d, 0x9b, 0xbb, 0x26, 0xc1, 0x35, 0x99, 0xbb, 0xfe, 0x73, 0xf0, 0x7f, 0x10,
+	0xfe, 0x08, 0x61, 0x00, 0xfd, 0xda, 0xfe, 0x94, 0xd3, 0xaf, 0x00, 0x96, 0xde, 0x9a, 0xab, 0x9a,
+	0xbb, 0x95, 0xee, 0x00, 0xfe, 0xc6, 0x38, 0x31, 0x15, 0x95, 0xde, 0xa4, 0x66, 0x9d, 0x9a, 0x9b,
+	0xaa, 0x1a, 0xae, 0x30, 0x15, 0x00, 0xfd, 0xfd, 0xfd, 0xcc, 0x0d, 0xa8, 0x34, 0xfe, 0x09, 0x47,
+	0x13, 0xa2, 0x67, 0x05, 0x00, 0xfe, 0x73, 0xcf, 0x31, 0xfe, 0xb5, 0xb6, 0xfe, 0x2a, 0x09, 0xa9,
+	0x53, 0x56, 0xc0, 0x7a, 0x31, 0xab, 0x32, 0xfe, 0x10, 0xc3, 0x00, 0xfd, 0xd8, 0xa9, 0x34, 0x15,
+	0x21, 0xae, 0x20, 0xad, 0x21, 0x30, 0x59, 0xc0, 0x66, 0x3a, 0x2c, 0x6e, 0xca, 0x2c, 0x59, 0x66,
+	0x18, 0xc0, 0x31, 0xc1, 0x9c, 0xaa, 0x99, 0xbc, 0x2c, 0x56, 0xfe, 0x8c, 0xb3, 0xaa, 0x43, 0x1d,
+	0xa2, 0x77, 0x2c, 0x9b, 0xaa, 0xc0, 0x09, 0x6f, 0x7a, 0xc0, 0x1d, 0xc0, 0x6f, 0x2c, 0xc1, 0x31,
+	0xc4, 0x9b, 0xba, 0x21, 0x26, 0xc0, 0x35, 0x9c, 0xaa, 0xfe, 0x8c, 0x92, 0x9a, 0xab, 0xa1, 0x98,
+	0xfe, 0x21, 0x04, 0x00, 0xfd, 0xd9, 0xfe, 0x8c, 0x72, 0xfe, 0xdf, 0x1c, 0x99, 0xbb, 0x9a, 0xac,
+	0x2e, 0x95, 0xee, 0x00, 0xfe, 0xbd, 0xf7, 0x31, 0xfe, 0x6b, 0x8e, 0x95, 0xde, 0xa4, 0x66, 0x9d,
+	0x9a, 0x3e, 0x9c, 0x9a, 0xae, 0x31, 0xa6, 0x55, 0x00, 0xfd, 0xfd, 0xfd, 0xcc, 0xfe, 0x63, 0x6e,
+	0xa3, 0x67, 0xfe, 0x00, 0x01, 0xa3, 0x57, 0x1f, 0xa5, 0x54, 0x00, 0xfe, 0x73, 0xcf, 0x31, 0xfe,
+	0xad, 0x96, 0xfe, 0x32, 0x09, 0xa9, 0x43, 0x56, 0x34, 0xc0, 0x39, 0xaa, 0x33, 0x28, 0x00, 0xfd,
+	0xd7, 0xaf, 0x01, 0xae, 0x01, 0xa2, 0x77, 0xfe, 0xbe, 0x18, 0xa9, 0x43, 0x55, 0xc1, 0x66, 0x09,
+	0xa4, 0x66, 0xca, 0x2c, 0xc0, 0x55, 0x66, 0xc0, 0x09, 0x66, 0x35, 0x09, 0x31, 0xc0, 0x2c, 0x31,
+	0xc0, 0x2c, 0x31, 0xc0, 0x04, 0x21, 0x30, 0x35, 0x6f, 0x04, 0x09, 0xc0, 0x18, 0xc0, 0x1d, 0xc0,
+	0x2c, 0xc1, 0x31, 0xc4, 0x9d, 0x99, 0x26, 0xc1, 0x30, 0x26, 0xfe, 0xa5, 0x55, 0xfe, 0x6b, 0x8f,
+	0xa5, 0x55, 0xfe, 0x39, 0xe8, 0x00, 0xfd, 0xd8, 0xfe, 0x84, 0x72, 0x35, 0x12, 0x9a, 0xbc, 0x9a,
+	0xac, 0x96, 0xcd, 0x00, 0xfe, 0xbd, 0xd7, 0x31, 0xfe, 0x73, 0xf0, 0xfe, 0x32, 0x09, 0x11, 0x9d,
+	0x9a, 0x9a, 0xbb, 0x9d, 0x8a, 0x11, 0x38, 0x00, 0xfd, 0xfd, 0xfd, 0xcc, 0x0d, 0x56, 0x00, 0xa4,
+	0x47, 0x1f, 0xa5, 0x54, 0x00, 0x38, 0x31, 0xfe, 0xad, 0x96, 0xfe, 0x32, 0x2a, 0xa8, 0x53, 0x34,
+	0x39, 0xc1, 0xa9, 0x44, 0xfe, 0x10, 0xa2, 0x00, 0xfd, 0xd5, 0x6e, 0xfe, 0x52, 0xab, 0xa8, 0x34,
+	0xa7, 0x54, 0xfe, 0xd6, 0xba, 0xa4, 0x66, 0x26, 0xc0, 0x66, 0x30, 0xa5, 0x55, 0x31, 0xc9, 0x2c,
+	0xc0, 0x1d, 0xc0, 0x66, 0x55, 0xc0, 0x3a, 0x30, 0x21, 0x66, 0x0d, 0x09, 0x31, 0xc2, 0x04, 0x9a,
+	0xbb, 0xa2, 0x67, 0x1c, 0x21, 0x6f, 0x35, 0xc0, 0x04, 0x09, 0xc0, 0x6f, 0x18, 0x1d, 0xc1, 0x2c,
+	0xc1, 0x31, 0xc3, 0x55, 0x35, 0x21, 0x26, 0xc0, 0x35, 0x97, 0xcd, 0xfe, 0x73, 0xcf, 0xa2, 0x78,
+	0x96, 0xdc, 0x00, 0xfd, 0xd7, 0xfe, 0x84, 0x72, 0x35, 0x30, 0x41, 0x9a, 0xab, 0x96, 0xdd, 0x00,
+	0x0c, 0x31, 0x38, 0xfe, 0x32, 0x09, 0x11, 0x9d, 0x99, 0x9a, 0xbc, 0x9d, 0x8a, 0x11, 0x38, 0x00,
+	0xfd, 0xfd, 0xfd, 0xcc, 0xfe, 0x63, 0x6e, 0x9c, 0xaa, 0x00, 0xa4, 0x47, 0x1f, 0xa5, 0x54, 0x00,
+	0x38, 0x31, 0xfe, 0xad, 0x96, 0xfe, 0x32, 0x2a, 0xa9, 0x42, 0x66, 0xc2, 0xa9, 0x43, 0xfe, 0x10,
+	0xa2, 0x00, 0xfd, 0xd4, 0xa5, 0x56, 0x3c, 0xa4, 0x56, 0xac, 0x31, 0xae, 0x11, 0xa2, 0x77, 0x26,
+	0xc0, 0x21, 0xa3, 0x77, 0x31, 0xc9, 0x2c, 0xc0, 0x22, 0x66, 0x18, 0x09, 0xc0, 0x04, 0x35, 0x21,
+	0xc0, 0x12, 0x9c, 0xab, 0xc0, 0x09, 0xa4, 0x66, 0xc2, 0x04, 0x97, 0xcc, 0x6f, 0xa3, 0x76, 0x1c,
+	0xc0, 0x21, 0x30, 0x35, 0xc0, 0x04, 0x09, 0xc0, 0x6f, 0x18, 0x1d, 0xc1, 0x2c, 0xc1, 0x6e, 0xc3,
+	0x09, 0x21, 0x26, 0xc0, 0x35, 0x08, 0xfe, 0x84, 0x71, 0x9b, 0xac, 0x9d, 0xb9, 0x28, 0x00, 0xfd,
+	0xd5, 0xfe, 0x84, 0x72, 0x35, 0xc1, 0x12, 0x95, 0xdf, 0xfe, 0x00, 0x24, 0x0c, 0x31, 0x38, 0xfe,
+	0x32, 0x09, 0xa5, 0x65, 0x2e, 0x9a, 0xbc, 0x13, 0x11, 0x38, 0x00, 0xfd, 0xfd, 0xfd, 0xcc, 0xfe,
+	0x63, 0x6e, 0x99, 0xbc, 0x00, 0x29, 0x1f, 0x05, 0x00, 0xfe, 0x73, 0xcf, 0x31, 0xfe, 0xad, 0x96,
+	0xfe, 0x32, 0x2a, 0x3e, 0x66, 0xc2, 0xa9, 0x43, 0xfe, 0x10, 0xa2, 0x00, 0xfd, 0xd3, 0xab, 0x23,
+	0xfe, 0x6b, 0x8e, 0xa3, 0x67, 0xfe, 0xbd, 0xf7, 0xaa, 0x33, 0x65, 0x26, 0xc1, 0x18, 0x31, 0xc9,
+	0x2c, 0xc0, 0x55, 0x18, 0x0e, 0x66, 0x04, 0x35, 0x26, 0x66, 0xc0, 0x9c, 0xaa, 0x25, 0x21, 0x31,
+	0xc0, 0x2c, 0x31, 0xc0, 0x2c, 0x31, 0xc0, 0x1c, 0x9a, 0xab, 0xa2, 0x87, 0x19, 0x1c, 0x21, 0x6f,
+	0x7a, 0x35, 0x01, 0x04, 0x09, 0xc0, 0x18, 0xc0, 0x6e, 0xc0, 0x6f, 0x2c, 0xc0, 0x31, 0xc3, 0x18,
+	0x26, 0x21, 0x26, 0x35, 0x21, 0xfe, 0x9d, 0x14, 0x95, 0xde, 0xa2, 0x77, 0xfe, 0x21, 0x45, 0x00,
+	0xfd, 0xd4, 0xfe, 0x84, 0x72, 0xfe, 0xe7, 0x3c, 0xc2, 0x98, 0xbd, 0xfe, 0x01, 0x88, 0x0c, 0x31,
+	0x38, 0xfe, 0x32, 0x09, 0xa5, 0x65, 0x9c, 0xaa, 0x9b, 0x9b, 0x9c, 0xaa, 0x11, 0x38, 0x00, 0xfd,
+	0xfd, 0xfd, 0xcc, 0xfe, 0x63, 0x6d, 0x97, 0xde, 0x00, 0xa4, 0x47, 0x1f, 0x05, 0x00, 0xfe, 0x73,
+	0xcf, 0x31, 0xfe, 0xb5, 0xb6, 0xfe, 0x32, 0x4a, 0xa8, 0x63, 0x56, 0xc1, 0x56, 0xaa, 0x32, 0xfe,
+	0x10, 0xc3, 0x00, 0xfd, 0xd2, 0xfe, 0x42, 0x49, 0xab, 0x23, 0xa5, 0x65, 0xfe, 0xce, 0x79, 0x35,
+	0x26, 0xc0, 0x66, 0x35, 0x2c, 0x6e, 0xc8, 0x2c, 0xc0, 0x55, 0xc0, 0x18, 0x09, 0x04, 0x35, 0x30,
+	0x21, 0xc0, 0x08, 0x9c, 0x9a, 0xa4, 0x66, 0xa9, 0x43, 0x31, 0xc0, 0xfe, 0xc6, 0x18, 0xfe, 0x5b,
+	0x2d, 0x18, 0x1d, 0xfe, 0x5b, 0x0c, 0xfe, 0xbd, 0xf7, 0x31, 0xc0, 0x1d, 0x96, 0xde, 0x9d, 0x99,
+	0x05, 0x1c, 0xc0, 0x21, 0x6f, 0x35, 0xc0, 0x04, 0x09, 0xc1, 0x18, 0x6e, 0xc1, 0x2c, 0xc1, 0x31,
+	0xc2, 0x2c, 0x35, 0x21, 0x26, 0x7a, 0x35, 0x95, 0xde, 0xfe, 0x6b, 0xcf, 0x7f, 0xfe, 0x42, 0x28,
+	0xfe, 0x00, 0x00, 0xfd, 0xd3, 0xfe, 0x84, 0x72, 0x3a, 0x66, 0xc1, 0x19, 0xfe, 0x32, 0x6b, 0x09,
+	0x31, 0x15, 0x95, 0xde, 0xa4, 0x66, 0x29, 0x9a, 0xab, 0x9c, 0x9b, 0xfe, 0x52, 0xec, 0xa6, 0x65,
+	0x00, 0xfd, 0xfd, 0xfd, 0xcc, 0xfe, 0x63, 0x6e, 0x38, 0x00, 0xa4, 0x47, 0x1f, 0xa5, 0x54, 0x00,
+	0xfe, 0x73, 0xcf, 0x31, 0xfe, 0xbd, 0xf7, 0x32, 0xa8, 0x64, 0x39, 0xc0, 0x6f, 0x50, 0xa9, 0x44,
+	0xfe, 0x18, 0xe3, 0x00, 0xfd, 0xd0, 0xa2, 0x77, 0x25, 0xa6, 0x55, 0xaa, 0x43, 0x1c, 0x35, 0x51,
+	0x6e, 0x21, 0xa4, 0x66, 0x31, 0xc8, 0x2c, 0xc0, 0x22, 0x66, 0x18, 0x09, 0xc0, 0x3a, 0x35, 0x21,
+	0xc0, 0x12, 0x9b, 0xbb, 0x6b, 0x04, 0x31, 0xc0, 0x96, 0xdd, 0x29, 0xfe, 0x01, 0x46, 0x62, 0x09,
+	0x6f, 0xfe, 0x00, 0x44, 0x00, 0xfe, 0x63, 0x6d, 0xfe, 0xd6, 0x9a, 0x31, 0xc0, 0x04, 0x2c, 0x25,
+	0x0d, 0x7f, 0xc0, 0x21, 0x30, 0x35, 0xc0, 0x04, 0x09, 0xc0, 0x15, 0x18, 0x1d, 0xc1, 0x7f, 0xc1,
+	0x31, 0xc2, 0x09, 0x21, 0x6e, 0xc0, 0x35, 0x9a, 0xbb, 0xfe, 0x84, 0x51, 0x9c, 0x9b, 0x99, 0xca,
+	0xfe, 0x00, 0x20, 0x00, 0xfd, 0xd1, 0xfe, 0x94, 0xb2, 0x35, 0xc3, 0xfe, 0x5b, 0x4d, 0xfe, 0xbd,
+	0xf8, 0x31, 0xfe, 0x63, 0x6e, 0x97, 0xcd, 0xa3, 0x76, 0x9c, 0xaa, 0x9a, 0xab, 0x9c, 0x9b, 0xfe,
+	0x52, 0xec, 0xa6, 0x54, 0x00, 0xfd, 0xfd, 0xfd, 0xcc, 0xfe, 0x63, 0x4d, 0x9a, 0xab, 0x00, 0xa4,
+	0x47, 0x1f, 0xa4, 0x65, 0x9a, 0xca, 0x10, 0x31, 0xfe, 0xbd, 0xf7, 0x32, 0xa8, 0x64, 0x55, 0xc0,
+	0x08, 0x25, 0xaa, 0x33, 0xfe, 0x18, 0xe3, 0x00, 0xfd, 0xcf, 0x01, 0xfe, 0x63, 0x4d, 0xa4, 0x56,
+	0x3d, 0xab, 0x32, 0xc0, 0x21, 0xc0, 0x29, 0x1d, 0x31, 0xc8, 0x2c, 0xc0, 0x1d, 0x66, 0x59, 0x66,
+	0x04, 0x55, 0x55, 0x21, 0xc0, 0x9b, 0xab, 0x51, 0x21, 0xa8, 0x44, 0xc0, 0x35, 0x2d, 0xfe, 0x09,
+	0x47, 0xa6, 0x74, 0x25, 0x17, 0x04, 0x18, 0x36, 0xa5, 0x75, 0x98, 0xad, 0x00, 0xfe, 0x84, 0x51,
+	0x30, 0x31, 0xc0, 0x98, 0xcc, 0x1d, 0xa2, 0x77, 0x19, 0x1c, 0x21, 0xc0, 0x30, 0x35, 0x6f, 0x04,
+	0x09, 0xc0, 0x18, 0xc0, 0x6e, 0xc0, 0x6f, 0x2c, 0xc0, 0x6e, 0xc2, 0x1d, 0x30, 0x21, 0xc0, 0x35,
+	0x1c, 0x91, 0xff, 0x96, 0xce, 0x0d, 0xfe, 0x10, 0xc3, 0x00, 0xfd, 0xd0, 0xfe, 0x94, 0xd3, 0x35,
+	0xc2, 0x09, 0xfe, 0x73, 0xf0, 0xfe, 0xbe, 0x18, 0x31, 0x0d, 0x97, 0xcd, 0xa4, 0x65, 0x9a, 0xbc,
+	0x2a, 0x06, 0x25, 0xa6, 0x54, 0x00, 0xfd, 0xfd, 0xfd, 0xcc, 0xfe, 0x5b, 0x2c, 0x9b, 0xbc, 0x00,
+	0xa4, 0x48, 0x65, 0xa3, 0x76, 0x9a, 0xca, 0xfe, 0x5b, 0x0c, 0x31, 0xfe, 0xc6, 0x39, 0xfe, 0x32,
+	0x4a, 0x0d, 0x51, 0x3e, 0x08, 0x9c, 0xaa, 0xab, 0x22, 0xfe, 0x21, 0x24, 0x00, 0xfd, 0xce, 0xad,
+	0x12, 0xfe, 0x63, 0x8f, 0x09, 0xfe, 0xc6, 0x38, 0xa8, 0x44, 0x55, 0x66, 0xc0, 0x35, 0xa5, 0x66,
+	0x31, 0xc7, 0x2c, 0xc0, 0x55, 0xc0, 0x18, 0x55, 0x66, 0x35, 0x66, 0x21, 0xc0, 0x9d, 0x99, 0x9b,
+	0xbb, 0xa5, 0x56, 0x2c, 0x31, 0x18, 0xfe, 0xad, 0x75, 0xfe, 0x32, 0x09, 0x9d, 0x99, 0xa8, 0x54,
+	0xc1, 0xfe, 0x00, 0x03, 0xfe, 0xe7, 0x5d, 0x09, 0xfe, 0x11, 0x87, 0xa3, 0x86, 0x21, 0x7e, 0xfe,
+	0x00, 0x02, 0x06, 0xfe, 0xa5, 0x14, 0xfe, 0xef, 0x9e, 0x31, 0x2c, 0x05, 0x9b, 0xbb, 0xa4, 0x65,
+	0x1c, 0xc0, 0x6e, 0x6f, 0x30, 0x35, 0x04, 0xc0, 0x09, 0xc0, 0x7f, 0xc0, 0x1d, 0xc0, 0x2c, 0xc1,
+	0x31, 0xc1, 0x2c, 0x3a, 0x21, 0xc0, 0x7e, 0x30, 0x3d, 0xfe, 0x6b, 0xcf, 0x66, 0xfe, 0x29, 0x86,
+	0x00, 0xfd, 0xce, 0x07, 0xfe, 0x9c, 0xf4, 0x3a, 0x66, 0xc1, 0x09, 0xfe, 0x84, 0x51, 0xaf, 0x11,
+	0x31, 0xfe, 0x5b, 0x0d, 0x9b, 0xaa, 0x16, 0x9a, 0xbb, 0x2a, 0x9a, 0xbc, 0xfe, 0x5b, 0x2d, 0xa2,
+	0x86, 0x00, 0xfd, 0xfd, 0xfd, 0xcc, 0xfe, 0x5a, 0xec, 0x5a, 0x00, 0x35, 0x24, 0xa3, 0x66, 0x00,
+	0xfe, 0x4a, 0xab, 0x31, 0x94, 0xee, 0x32, 0x0d, 0x55, 0xc0, 0x0d, 0x16, 0xab, 0x33, 0xfe, 0x29,
+	0x45, 0x00, 0xfd, 0xcd, 0xfe, 0x4a, 0x6a, 0x21, 0xa9, 0x43, 0xaf, 0x10, 0xa4, 0x66, 0x51, 0xc1,
+	0xa4, 0x66, 0x31, 0xc7, 0x66, 0xc0, 0x1d, 0xc0, 0x18, 0x09, 0xc0, 0x3a, 0x35, 0x21, 0xc0, 0x0d,
+	0x9b, 0xab, 0x7e, 0x09, 0x31, 0xc0, 0x1d, 0xfe, 0x52, 0xec, 0x17, 0x0c, 0x11, 0x02, 0x6b, 0x0c,
+	0xfe, 0x00, 0x00, 0x35, 0xa2, 0x77, 0xfe, 0x21, 0xc8, 0xa2, 0x87, 0x51, 0xc0, 0x21, 0x65, 0x00,
+	0xfe, 0x3a, 0x29, 0xfe, 0xbd, 0xd7, 0x31, 0xc0, 0x09, 0x96, 0xde, 0x1d, 0xa5, 0x65, 0x1c, 0xc0,
+	0x6e, 0x30, 0x35, 0xc0, 0x04, 0x09, 0xc0, 0x6f, 0x18, 0x6e, 0xc1, 0x7f, 0xc1, 0x31, 0xc1, 0x09,
+	0x21, 0xc0, 0x6e, 0x35, 0x99, 0xbb, 0xfe, 0x7c, 0x31, 0x9c, 0xaa, 0x95, 0xed, 0x00, 0xfd, 0xcd,
+	0x6f, 0xfe, 0xa5, 0x55, 0xfe, 0xef, 0x5c, 0x35, 0xc1, 0xa2, 0x77, 0xfe, 0x84, 0x51, 0xb1, 0x00,
+	0x2c, 0x25, 0x02, 0x7f, 0x9a, 0xbb, 0x9c, 0x9a, 0x9a, 0xbc, 0x3e, 0x7a, 0xfe, 0x00, 0x00, 0xfd,
+	0xfd, 0xfd, 0xcc, 0xfe, 0x52, 0xcb, 0xa3, 0x67, 0x00, 0xa5, 0x47, 0x51, 0xa3, 0x66, 0x00, 0x29,
+	0x2c, 0x96, 0xdd, 0xfe, 0x3a, 0x6a, 0xa8, 0x54, 0x3e, 0x7b, 0x0d, 0x11, 0xab, 0x32, 0xfe, 0x31,
+	0x86, 0x00, 0xfd, 0xcb, 0xa4, 0x66, 0xfe, 0x5b, 0x0c, 0xa6, 0x45, 0xad, 0x31, 0xad, 0x11, 0x7a,
+	0x56, 0xc0, 0x30, 0x1d, 0xa2, 0x77, 0xc7, 0x2c, 0xc0, 0x1d, 0x18, 0x59, 0x09, 0x04, 0x55, 0x26,
+	0x21, 0x1c, 0x9b, 0xaa, 0x51, 0xa8, 0x45, 0x31, 0xc0, 0x96, 0xdd, 0xfe, 0x73, 0xcf, 0x06, 0xac,
+	0x41, 0x16, 0x02, 0xc1, 0x7b, 0x3d, 0x00, 0x21, 0x30, 0xfe, 0x21, 0xa8, 0x3d, 0x12, 0x66, 0xc1,
+	0xa3, 0x76, 0x9c, 0x9a, 0x00, 0x01, 0xfe, 0xce, 0x9a, 0x31, 0xc0, 0x99, 0xbc, 0x97, 0xdd, 0x25,
+	0xa5, 0x56, 0x1c, 0xc0, 0x21, 0x30, 0x35, 0x6f, 0x04, 0x09, 0xc0, 0x7f, 0xc0, 0x1d, 0xc0, 0x6f,
+	0x2c, 0xc1, 0x31, 0xc0, 0x1d, 0x35, 0x21, 0xc0, 0x35, 0x9d, 0x99, 0xfe, 0x94, 0xd3, 0x97, 0xcd,
+	0x9a, 0xbb, 0x14, 0x00, 0xfd, 0xcb, 0xa2, 0x68, 0xfe, 0xad, 0x96, 0xae, 0x20, 0x56, 0xc1, 0x09,
+	0xfe, 0x84, 0x51, 0xfe, 0xd6, 0xba, 0x1d, 0x02, 0x0c, 0x6e, 0x99, 0xbc, 0x9d, 0xaa, 0x1f, 0xfe,
+	0x6b, 0x8e, 0x9c, 0xaa, 0x00, 0xfd, 0xfd, 0xfd, 0xcc, 0xfe, 0x4a, 0x8a, 0xa7, 0x45, 0x00, 0xa6,
+	0x36, 0x24, 0xa2, 0x67, 0x07, 0x2a, 0x1d, 0x1c, 0xfe, 0x3a, 0x6b, 0x0d, 0x08, 0xc0, 0x0d, 0x11,
+	0xaa, 0x33, 0xfe, 0x39, 0xe7, 0x00, 0xfd, 0xca, 0xa9, 0x33, 0x08, 0xa6, 0x54, 0xb0, 0x00, 0xa9,
+	0x43, 0x26, 0x66, 0xc0, 0x04, 0x31, 0xc7, 0x2c, 0xc0, 0x55, 0xc0, 0x66, 0x09, 0x04, 0x35, 0x30,
+	0x21, 0xc0, 0x9c, 0xaa, 0x9b, 0xab, 0xa6, 0x55, 0x31, 0xc0, 0x35, 0xfe, 0x8c, 0x92, 0xfe, 0x01,
+	0x46, 0xa6, 0x85, 0xa6, 0x64, 0x0c, 0x02, 0xc3, 0x9b, 0xbb, 0x00, 0x05, 0xa2, 0x77, 0xfe, 0x29,
+	0xe9, 0xa6, 0x64, 0x9c, 0x9a, 0x9d, 0xaa, 0xc2, 0x6e, 0xa2, 0x87, 0x97, 0xae, 0x00, 0xfe, 0x84,
+	0x31, 0x30, 0x31, 0xc0, 0x95, 0xee, 0x09, 0x39, 0xa3, 0x77, 0xc0, 0x6e, 0x6f, 0x30, 0x35, 0x04,
+	0xc0, 0x6e, 0xc0, 0x18, 0xc0, 0x1d, 0xc0, 0x2c, 0xc2, 0x31, 0xc0, 0x04, 0x21, 0xc0, 0x7e, 0x5a,
+	0x93, 0xff, 0xfe, 0x6b, 0xaf, 0x51, 0xfe, 0x18, 0xe4, 0x00, 0xfd, 0xca, 0xa4, 0x47, 0xfe, 0xb5,
+	0xd7, 0xac, 0x31, 0x35, 0xc1, 0xa2, 0x77, 0xfe, 0x84, 0x30, 0x28, 0x18, 0xfe, 0x32, 0x29, 0x11,
+	0xc0, 0x98, 0xcc, 0x56, 0xfe, 0x00, 0x02, 0xfe, 0x73, 0xcf, 0x98, 0xcc, 0x00, 0xfd, 0xfd, 0xfd,
+	0xcc, 0xfe, 0x42, 0x49, 0xaa, 0x34, 0x00, 0xa6, 0x36, 0x24, 0xa2, 0x67, 0x9c, 0xcb, 0x2b, 0xfe,
+	0xef, 0x7e, 0x30, 0xfe, 0x42, 0xab, 0x0d, 0x66, 0xc0, 0xa2, 0x66, 0x98, 0xcd, 0x29, 0x93, 0xff,
+	0x00, 0xfd, 0xc9, 0xaf, 0x01, 0xad, 0x02, 0x25, 0xfe, 0xce, 0x99, 0xa5, 0x66, 0x51, 0xc0, 0x6e,
+	0xa4, 0x77, 0xa3, 0x66, 0xc6, 0x66, 0xc0, 0x1d, 0xc0, 0x18, 0x55, 0xc0, 0x55, 0x30, 0x21, 0xc0,
+	0x51, 0x9a, 0xbb, 0x7f, 0x18, 0x31, 0x18, 0xfe, 0xa5, 0x55, 0xfe, 0x29, 0xe8, 0x51, 0xa8, 0x54,
+	0xc0, 0x02, 0xc3, 0x6b, 0x9c, 0xaa, 0x01, 0x00, 0xfe, 0xbe, 0x18, 0xa3, 0x76, 0x0f, 0x11, 0x41,
+	0x21, 0x51, 0xc3, 0xa2, 0x76, 0x7f, 0xfe, 0x00, 0x03, 0xa4, 0x45, 0xfe, 0x9d, 0x14, 0x18, 0x31,
+	0x18, 0x95, 0xde, 0x50, 0xa5, 0x66, 0xa2, 0x77, 0xc0, 0x6e, 0x7f, 0x35, 0xc0, 0x04, 0x6e, 0xc0,
+	0x6f, 0x18, 0x6e, 0xc1, 0x7f, 0xc1, 0x31, 0xc0, 0x18, 0x26, 0x21, 0x26, 0x35, 0x20, 0xfe, 0x7c,
+	0x10, 0x9c, 0xab, 0xfe, 0x31, 0xa7, 0x00, 0xfd, 0xc9, 0xa7, 0x35, 0xfe, 0xbe, 0x18, 0xaa, 0x42,
+	0x35, 0xc1, 0x09, 0xfe, 0x7b, 0xf0, 0xfe, 0xe7, 0x5d, 0xc0, 0x12, 0x16, 0x66, 0x3e, 0x66, 0xfe,
+	0x00, 0x02, 0xfe, 0x73, 0xf0, 0x95, 0xed, 0x00, 0xfd, 0xfd, 0xfd, 0xcc, 0xfe, 0x3a, 0x08, 0xae,
+	0x01, 0x00, 0xa6, 0x36, 0x51, 0x6b, 0x7e, 0x00, 0xfe, 0xe7, 0x3d, 0x09, 0xfe, 0x4a, 0xec, 0xa4,
+	0x76, 0x66, 0xc0, 0x19, 0x98, 0xcc, 0xa9, 0x43, 0x05, 0x00, 0xfd, 0xc7, 0x6e, 0xfe, 0x4a, 0x8a,
+	0x21, 0xac, 0x31, 0xae, 0x11, 0x7f, 0x21, 0xc0, 0xa2, 0x77, 0x2c, 0x31, 0xc6, 0x2c, 0x59, 0x66,
+	0x18, 0x59, 0x66, 0x66, 0x35, 0x55, 0x21, 0x66, 0x9a, 0xab, 0x51, 0x30, 0x31, 0xc0, 0x1d, 0xfe,
+	0x52, 0xcc, 0x94, 0xae, 0x11, 0xc0, 0x02, 0xc4, 0x6b, 0x2e, 0x3e, 0x39, 0x00, 0xfe, 0xb5, 0xd7,
+	0x1d, 0xfe, 0x2a, 0x09, 0x16, 0x9d, 0xaa, 0x51, 0x51, 0x56, 0xc4, 0xa2, 0x77, 0x1a, 0x00, 0x21,
+	0xfe, 0xbd, 0xd7, 0x31, 0xc0, 0x35, 0x96, 0xdd, 0x1d, 0xa5, 0x65, 0x7f, 0xc0, 0x6e, 0x30, 0x35,
+	0x01, 0x04, 0x6e, 0xc0, 0x18, 0xc0, 0x6e, 0xc0, 0x6f, 0x2c, 0xc1, 0x31, 0x2c, 0x35, 0x21, 0xc0,
+	0x35, 0x9b, 0xbb, 0x25, 0x99, 0xbc, 0x96, 0xed, 0xfe, 0x00, 0x00, 0xfd, 0xc8, 0xaa, 0x13, 0xfe,
+	0xc6, 0x59, 0xa8, 0x53, 0x35, 0x6e, 0x3d, 0xc0, 0xfe, 0x73, 0xcf, 0xfe, 0xef, 0x9e, 0x9b, 0xba,
+	0xfe, 0x19, 0xa8, 0xaa, 0x52, 0x9d, 0xaa, 0x39, 0xc0, 0xfe, 0x00, 0x02, 0xfe, 0x7c, 0x11, 0xfe,
+	0x42, 0x28, 0x00, 0xfd, 0xfd, 0xfd, 0xcc, 0xad, 0x11, 0xfe, 0x7c, 0x10, 0x00, 0xa6, 0x36, 0x51,
+	0xc0, 0xa4, 0x76, 0x00, 0x21, 0x1d, 0xfe, 0x5b, 0x2d, 0x7f, 0x6e, 0xc0, 0x7f, 0x99, 0xbb, 0x0d,
+	0x9c, 0xba, 0x00, 0xfd, 0xc6, 0xa6, 0x45, 0xfe, 0x5b, 0x0c, 0xa7, 0x45, 0xaf, 0x10, 0x30, 0x26,
+	0x21, 0xc0, 0xa4, 0x66, 0xa4, 0x66, 0xc6, 0x2c, 0xc0, 0x1d, 0xc0, 0x18, 0x09, 0x66, 0x55, 0x30,
+	0x21, 0xc0, 0x9b, 0xbb, 0x9b, 0xaa, 0xa8, 0x44, 0x31, 0xc0, 0x0d, 0xfe, 0x6b, 0xaf, 0xfe, 0x01,
+	0x05, 0xab, 0x52, 0x16, 0x51, 0xc6, 0x52, 0x9c, 0xaa, 0x9d, 0x9a, 0x79, 0x00, 0xfe, 0xa5, 0x75,
+	0xa2, 0x88, 0xfe, 0x32, 0x09, 0xa6, 0x55, 0x51, 0x3d, 0x51, 0x12, 0x0d, 0xc5, 0x29, 0x3e, 0x00,
+	0xfe, 0x5b, 0x2d, 0xfe, 0xce, 0x9a, 0xab, 0x32, 0xc0, 0x96, 0xde, 0x99, 0xbb, 0xa4, 0x66, 0xa4,
+	0x76, 0xc0, 0x6e, 0x6f, 0x30, 0x6e, 0x01, 0x7a, 0x6e, 0xc0, 0x18, 0xc0, 0x6e, 0xc0, 0x2c, 0xc1,
+	0x6e, 0xc0, 0x09, 0x21, 0xc0, 0x30, 0x21, 0x93, 0xef, 0x93, 0xef, 0x9b, 0xba, 0xfe, 0x10, 0x82,
+	0x00, 0xfd, 0xc6, 0xac, 0x13, 0xfe, 0xd6, 0x9a, 0xa6, 0x54, 0x35, 0x3a, 0x3d, 0x35, 0xfe, 0x73,
+	0xaf, 0x2c, 0x08, 0x23, 0xad, 0x50, 0x02, 0x2a, 0x7f, 0x0e, 0xfe, 0x84, 0x51, 0xfe, 0x31, 0xc7,
+	0x00, 0xfd, 0xfd, 0xfd, 0xcc, 0xa9, 0x33, 0xfe, 0x7c, 0x31, 0x00, 0xa6, 0x36, 0x52, 0x69, 0xa5,
+	0x65, 0x00, 0x05, 0x2c, 0xfe, 0x6b, 0x8f, 0x51, 0x6e, 0xc0, 0x1c, 0x16, 0xa2, 0x78, 0xa2, 0x86,
+	0x00, 0xfd, 0xc5, 0xab, 0x22, 0x0d, 0xa8, 0x44, 0x34, 0x35, 0x51, 0xc0, 0x6e, 0xa5, 0x66, 0xa2,
+	0x77, 0xc5, 0x2c, 0xc0, 0x1d, 0xc0, 0x18, 0x55, 0xc0, 0x3a, 0x62, 0x21, 0xc0, 0x9d, 0xaa, 0x99,
+	0xbc, 0xa4, 0x65, 0x1d, 0x31, 0x35, 0xfe, 0x8c, 0x72, 0x17, 0xa7, 0x74, 0xa6, 0x64, 0x0c, 0x02,
+	0xc6, 0x2e, 0x12, 0x39, 0x41, 0x7a, 0x00, 0xfe, 0x9d, 0x14, 0xa3, 0x77, 0xfe, 0x32, 0x2a, 0xa5,
+	0x65, 0x51, 0x65, 0x56, 0x55, 0x12, 0x66, 0xc5, 0x12, 0xa2, 0x87, 0x98, 0xad, 0x00, 0xfe, 0x7c,
+	0x30, 0xfe, 0xe7, 0x1c, 0x31, 0x56, 0x94, 0xee, 0x9c, 0xaa, 0x05, 0xa2, 0x87, 0xc0, 0x6e, 0x6f,
+	0x7e, 0xc0, 0x7f, 0x6e, 0xc1, 0x18, 0x6e, 0xc1, 0x2c, 0xc1, 0x6e, 0x1d, 0x9b, 0xaa, 0x21, 0x26,
+	0x30, 0x97, 0xcc, 0xfe, 0x73, 0xf0, 0x9c, 0xaa, 0xfe, 0x21, 0x25, 0x00, 0xfd, 0xc5, 0xfe, 0x3a,
+	0x29, 0xfe, 0xde, 0xdb, 0xa4, 0x65, 0x56, 0x3a, 0x04, 0x50, 0xfe, 0x7b, 0xf0, 0x31, 0x92, 0xff,
+	0xfe, 0x09, 0x67, 0xac, 0x51, 0x9c, 0xaa, 0x97, 0xcd, 0x39, 0x95, 0xff, 0x20, 0xfe, 0x29, 0x45,
+	0x00, 0xfd, 0xfd, 0xfd, 0xcc, 0xa7, 0x44, 0xfe, 0x7c, 0x31, 0x07, 0xa5, 0x36, 0x66, 0xc0, 0xa5,
+	0x65, 0x00, 0xfe, 0xbd, 0xf8, 0x31, 0xfe, 0x7c, 0x11, 0x99, 0xbb, 0xa3, 0x66, 0x0d, 0x7f, 0x9b,
+	0xaa, 0x16, 0xa7, 0x55, 0x00, 0xfd, 0xc4, 0xfe, 0x42, 0x29, 0x1c, 0xac, 0x21, 0xae, 0x10, 0xa3,
+	0x77, 0x51, 0xc0, 0x35, 0xa5, 0x66, 0x31, 0xc4, 0x2c, 0xc0, 0x59, 0x1d, 0x66, 0x55, 0xc0, 0x66,
+	0x35, 0x26, 0xc0, 0x12, 0x11, 0x56, 0x04, 0x31, 0x1d, 0xfe, 0xa5, 0x55, 0xfe, 0x29, 0xe8, 0x52,
+	0x16, 0x66, 0x55, 0xc6, 0x3d, 0x51, 0x12, 0x3e, 0x2a, 0x52, 0x7e, 0x00, 0xfe, 0x94, 0xb3, 0x0d,
+	0xfe, 0x3a, 0x4a, 0xa4, 0x76, 0x11, 0x56, 0x3d, 0x29, 0x56, 0x12, 0x66, 0xc6, 0x7e, 0x29, 0x1a,
+	0xc0, 0xfe, 0x9d, 0x14, 0x18, 0x31, 0x9c, 0xaa, 0x94, 0xee, 0x6b, 0xa6, 0x54, 0xa2, 0x77, 0x66,
+	0x21, 0x7f, 0x6e, 0xc0, 0x04, 0x09, 0xc0, 0x6f, 0x7a, 0x6e, 0xc1, 0x2c, 0xc0, 0x31, 0x2c, 0x3a,
+	0x21, 0xc0, 0x35, 0x9a, 0xbb, 0xfe, 0x8c, 0x72, 0x99, 0xbc, 0x94, 0xed, 0x00, 0xfd, 0xc4, 0x19,
+	0x26, 0xa2, 0x87, 0x3a, 0xc0, 0x09, 0x0d, 0xfe, 0x84, 0x31, 0x31, 0xfe, 0xb5, 0xb6, 0x33, 0xab,
+	0x52, 0x9b, 0xab, 0x97, 0xcd, 0x2a, 0x9b, 0xab, 0xfe, 0x84, 0x72, 0x01, 0x00, 0xfd, 0xfd, 0xfd,
+	0xcc, 0x28, 0xfe, 0x7c, 0x31, 0xfe, 0x08, 0xc4, 0x9d, 0xaa, 0xa2, 0x67, 0x66, 0xa6, 0x54, 0x00,
+	0xfe, 0xad, 0x75, 0x31, 0xfe, 0x8c, 0x92, 0x94, 0xdf, 0x1c, 0x55, 0xa2, 0x77, 0x9a, 0xbb, 0x9c,
+	0xaa, 0xac, 0x22, 0xfe, 0x00, 0x20, 0x00, 0xfd, 0xc1, 0xa2, 0x77, 0xfe, 0x52, 0xab, 0xa9, 0x34,
+	0xae, 0x10, 0x26, 0xc0, 0x66, 0xc0, 0xa4, 0x66, 0xa4, 0x66, 0xc5, 0x2c, 0xc0, 0x55, 0x18, 0xc0,
+	0x09, 0x04, 0x55, 0x26, 0x21, 0xc0, 0x9a, 0xbb, 0x9b, 0xab, 0xaa, 0x33, 0x31, 0xc0, 0x11, 0xfe,
+	0x4a, 0xab, 0x95, 0xae, 0x11, 0xc0, 0x02, 0xc7, 0x3d, 0x41, 0x12, 0x3e, 0x36, 0x51, 0x51, 0x7e,
+	0x00, 0xfe, 0x84, 0x51, 0xa4, 0x66, 0x3d, 0xa4, 0x66, 0x51, 0x56, 0x3d, 0x56, 0x65, 0x56, 0x12,
+	0x66, 0xc7, 0x21, 0x69, 0x00, 0x12, 0xfe, 0xb5, 0xb7, 0x31, 0xc0, 0x98, 0xcc, 0x04, 0xa4, 0x65,
+	0xa5, 0x66, 0xc0, 0x21, 0x2d, 0x7a, 0x6e, 0x6f, 0x7a, 0x6e, 0xc0, 0x18, 0xc0, 0x1d, 0xc0, 0x2c,
+	0xc1, 0x31, 0x09, 0x21, 0xc0, 0x30, 0x1c, 0x92, 0xef, 0x95, 0xde, 0x14, 0x05, 0x00, 0xfd, 0xc2,
+	0xfe, 0x63, 0x6e, 0x35, 0x7e, 0xc1, 0x09, 0x98, 0xcc, 0xfe, 0x8c, 0x92, 0x31, 0xfe, 0x9d, 0x14,
+	0x0a, 0xa9, 0x53, 0x29, 0x98, 0xbd, 0x7e, 0x2a, 0x20, 0x28, 0x00, 0xfd, 0xfd, 0xfd, 0xcc, 0x05,
+	0xfe, 0x7c, 0x10, 0xfe, 0x21, 0x87, 0x95, 0xff, 0xa4, 0x45, 0x66, 0xa5, 0x65, 0x00, 0x34, 0x31,
+	0xfe, 0xa5, 0x35, 0xfe, 0x52, 0xec, 0x21, 0x51, 0x21, 0x9b, 0xab, 0x98, 0xcc, 0xfe, 0x7c, 0x31,
+	0x28, 0x00, 0xfd, 0xc0, 0xa7, 0x44, 0xfe, 0x5b, 0x2d, 0xa9, 0x43, 0xaf, 0x10, 0xa8, 0x44, 0x51,
+	0xc0, 0x7f, 0xa5, 0x55, 0xa2, 0x77, 0xc4, 0x2c, 0xc0, 0x1d, 0xc0, 0x18, 0x55, 0xc0, 0x55, 0x30,
+	0x21, 0xc0, 0x9d, 0x99, 0x99, 0xbc, 0xa5, 0x66, 0xad, 0x21, 0xc0, 0x08, 0xfe, 0x6b, 0x8e, 0x06,
+	0xac, 0x41, 0xa3, 0x66, 0x02, 0xc7, 0x3d, 0x56, 0x51, 0x12, 0x52, 0x65, 0x51, 0x56, 0x0e, 0x7a,
+	0x00, 0x38, 0xa5, 0x55, 0xfe, 0x42, 0x8b, 0xa3, 0x76, 0x51, 0x09, 0x02, 0x3d, 0x35, 0x29, 0x21,
+	0x12, 0x66, 0xc8, 0x29, 0x9c, 0xab, 0x00, 0xfe, 0x5b, 0x0c, 0xfe, 0xce, 0x7a, 0x31, 0xc0, 0x94,
+	0xee, 0x9a, 0xbc, 0x39, 0xa4, 0x66, 0x66, 0x21, 0x6f, 0x7e, 0xc0, 0x7f, 0x6e, 0xc1, 0x18, 0xc0,
+	0x6e, 0xc0, 0x2c, 0xc0, 0x31, 0x1d, 0x30, 0x1c, 0xa2, 0x66, 0x7a, 0x96, 0xcd, 0xfe, 0x73, 0xf0,
+	0x9a, 0xbb, 0xfe, 0x18, 0xc3, 0x9a, 0xbb, 0xfd, 0xc1, 0xfe, 0x7c, 0x10, 0xfe, 0xef, 0x5c, 0xc2,
+	0xa2, 0x77, 0x94, 0xef, 0x9a, 0xab, 0x31, 0xfe, 0x8c, 0x72, 0xfe, 0x32, 0x09, 0x25, 0x98, 0xcc,
+	0x9a, 0xac, 0x69, 0x15, 0xfe, 0x84, 0x51, 0xfe, 0x00, 0x20, 0x00, 0xfd, 0xfd, 0xfd, 0xcd, 0xfe,
+	0x73, 0xcf, 0x93, 0xef, 0x07, 0xa6, 0x35, 0x56, 0xa3, 0x86, 0x00, 0xfe, 0x73, 0xcf, 0x31, 0xfe,
+	0xb5, 0xd7, 0xfe, 0x4a, 0xcc, 0xa7, 0x54, 0x55, 0x21, 0x39, 0x0d, 0xfe, 0x7c, 0x31, 0xfe, 0x19,
+	0x04, 0x00, 0xfd, 0xad, 0x11, 0xae, 0x02, 0xab, 0x32, 0xae, 0x21, 0xa5, 0x55, 0x51, 0xc0, 0x04,
+	0x31, 0xc4, 0x2c, 0xc0, 0x59, 0x66, 0x18, 0x55, 0xc0, 0x04, 0x35, 0x21, 0x26, 0x51, 0x98, 0xcd,
+	0xc0, 0xad, 0x21, 0x31, 0x35, 0xfe, 0x84, 0x71, 0x17, 0xa8, 0x73, 0xa5, 0x65, 0x52, 0x59, 0xc7,
+	0x66, 0x29, 0x55, 0x56, 0x52, 0x65, 0x2a, 0x56, 0x0e, 0x06, 0x0e, 0x00, 0xfe, 0x6b, 0x8e, 0xa5,
+	0x56, 0x93, 0xef, 0x25, 0x51, 0xc0, 0x09, 0x3d, 0x5a, 0x66, 0x29, 0x56, 0x12, 0x66, 0xc8, 0x12,
+	0x29, 0x22, 0x00, 0xfe, 0x7c, 0x10, 0x30, 0x31, 0x18, 0x93, 0xef, 0x55, 0xa7, 0x54, 0xa2, 0x77,
+	0x1c, 0x21, 0x30, 0x6e, 0xc0, 0x04, 0x6e, 0xc0, 0x6f, 0x7a, 0x1d, 0xc1, 0x2c, 0x31, 0x2c, 0x04,
+	0x21, 0xc0, 0x35, 0x99, 0xbb, 0xfe, 0x84, 0x51, 0x99, 0xbc, 0xfe, 0x29, 0x86, 0x00, 0xfd, 0xc0,
+	0xfe, 0x94, 0xd3, 0x09, 0x65, 0xc1, 0xa2, 0x77, 0xfe, 0xb5, 0x96, 0xa2, 0x67, 0x31, 0xfe, 0x6b,
+	0xaf, 0x96, 0xdd, 0x25, 0x97, 0xcd, 0x22, 0x06, 0x02, 0xac, 0x32, 0x00, 0xfd, 0xfd, 0xfd, 0xce,
+	0xfe, 0x63, 0x6d, 0x9b, 0xbc, 0x00, 0xa6, 0x37, 0x55, 0xa3, 0x76, 0x00, 0x20, 0x31, 0x94, 0xee,
+	0xfe, 0x4a, 0xcc, 0x21, 0x66, 0x21, 0x9d, 0x99, 0x93, 0xef, 0xfe, 0x7c, 0x11, 0xfe, 0x31, 0xa6,
+	0x00, 0xfc, 0xfe, 0x42, 0x49, 0x21, 0xae, 0x20, 0xac, 0x22, 0x26, 0x62, 0x21, 0x18, 0xa3, 0x66,
+	0xc4, 0x2c, 0xc0, 0x55, 0x18, 0xc0, 0x55, 0x66, 0x55, 0x26, 0xc0, 0x21, 0x9a, 0xbb, 0x9b, 0xab,
+	0x2d, 0x31, 0x1d, 0xfe, 0xa5, 0x34, 0x0a, 0xc0, 0xa8, 0x53, 0x66, 0x02, 0xc7, 0x66, 0x56, 0x51,
+	0x65, 0x0d, 0x05, 0x65, 0x55, 0x22, 0x66, 0x0e, 0x51, 0x7f, 0x00, 0xfe, 0x63, 0x4d, 0xa5, 0x56,
+	0x11, 0xa2, 0x77, 0x52, 0x11, 0x56, 0x02, 0x3d, 0x56, 0x65, 0x5a, 0x21, 0x12, 0x0d, 0xc9, 0x15,
+	0x29, 0xfe, 0x00, 0x64, 0x9d, 0xb9, 0xfe, 0x94, 0xd3, 0xfe, 0xf7, 0x9e, 0x31, 0x30, 0x95, 0xde,
+	0xa3, 0x76, 0xa6, 0x45, 0x1c, 0x6e, 0xc0, 0x30, 0x6e, 0x6f, 0x7a, 0x6e, 0xc0, 0x18, 0xc0, 0x6e,
+	0xc1, 0x2c, 0x31, 0x9d, 0xa9, 0x21, 0x1c, 0x30, 0x9d, 0x99, 0xfe, 0x9c, 0xf4, 0x96, 0xcd, 0x94,
+	0xfe, 0x00, 0xfc, 0xa2, 0x68, 0xfe, 0xad, 0x96, 0x09, 0x65, 0xc1, 0x11, 0xfe, 0xa5, 0x34, 0xaa,
+	0x34, 0xab, 0x32, 0xfe, 0x53, 0x0c, 0x9d, 0xaa, 0x6f, 0x96, 0xdd, 0x51, 0x1f, 0xfe, 0x5b, 0x2d,
+	0xa4, 0x65, 0xfe, 0x00, 0x00, 0xfd, 0xfd, 0xfd, 0xce, 0xfe, 0x52, 0xcb, 0xa4, 0x67, 0x00, 0xa7,
+	0x26, 0x51, 0x09, 0x9a, 0xdc, 0x22, 0xfe, 0xf7, 0xbe, 0x2d, 0xfe, 0x4a, 0xec, 0x21, 0x66, 0x21,
+	0x08, 0x3e, 0xfe, 0x73, 0xf0, 0x93, 0xfe, 0x00, 0xfa, 0x28, 0x19, 0xab, 0x23, 0xae, 0x20, 0x30,
+	0x55, 0x66, 0xa3, 0x66, 0x2c, 0x6e, 0xc3, 0x2c, 0xc0, 0x1d, 0xc0, 0x66, 0x55, 0x04, 0x35, 0x30,
+	0x21, 0xc0, 0x9c, 0xaa, 0x99, 0xbc, 0xa7, 0x55, 0x31, 0xc0, 0x11, 0xfe, 0x42, 0x8b, 0x96, 0xbd,
+	0xab, 0x52, 0xc0, 0x02, 0xc7, 0x66, 0x56, 0x29, 0x56, 0x12, 0x66, 0x3e, 0x66, 0x56, 0x25, 0x56,
+	0x55, 0x56, 0x3a, 0xc0, 0x9a, 0xea, 0xfe, 0x52, 0xcc, 0xa7, 0x44, 0x98, 0xcd, 0xa2, 0x76, 0x56,
+	0x11, 0xc0, 0x09, 0x3d, 0xc0, 0x35, 0x29, 0x26, 0x66, 0x65, 0x12, 0x0d, 0xc9, 0x21, 0x69, 0x00,
+	0x3e, 0xfe, 0xb5, 0xb6, 0xfe, 0xff, 0xff, 0xc0, 0x95, 0xde, 0x98, 0xcc, 0xa6, 0x65, 0xa5, 0x55,
+	0x1c, 0x21, 0x2d, 0x30, 0x6e, 0x04, 0xc0, 0x6e, 0xc0, 0x7f, 0xc0, 0x6e, 0xc0, 0x2c, 0x31, 0x1d,
+	0x35, 0x1c, 0xa2, 0x66, 0xc0, 0x94, 0xef, 0xfe, 0x73, 0xd0, 0x19, 0xfe, 0x08, 0x61, 0x00, 0xfa,
+	0xa6, 0x36, 0xfe, 0xc6, 0x38, 0x09, 0x65, 0x04, 0x3d, 0xa2, 0x77, 0xfe, 0x8c, 0xb2, 0xfe, 0xe7,
+	0x1c, 0x09, 0xfe, 0x32, 0x2a, 0xa6, 0x64, 0x51, 0x95, 0xde, 0x6e, 0x07, 0xfe, 0x6b, 0xaf, 0x9b,
+	0xba, 0x00, 0xfd, 0xfd, 0xfd, 0xce, 0xfe, 0x42, 0x29, 0xae, 0x01, 0x00, 0xa8, 0x25, 0x9d, 0x9a,
+	0x7e, 0x7f, 0x00, 0xfe, 0xe7, 0x3c, 0x09, 0xfe, 0x5b, 0x4d, 0x21, 0xc1, 0x51, 0x93, 0xef, 0xad,
+	0x21, 0x9c, 0xba, 0x00, 0xf9, 0xa9, 0x33, 0xfe, 0x5b, 0x2d, 0xac, 0x22, 0xae, 0x20, 0x35, 0x51,
+	0xc0, 0x09, 0xa4, 0x66, 0xc3, 0x66, 0xc0, 0x1d, 0xc0, 0x18, 0x09, 0xc0, 0x04, 0x35, 0x21, 0x26,
+	0x9d, 0xaa, 0x98, 0xcc, 0xa2, 0x78, 0x1d, 0x31, 0x95, 0xee, 0xfe, 0x63, 0x6e, 0x06, 0xac, 0x41,
+	0x16, 0x02, 0xc7, 0x3d, 0xc0, 0x29, 0x56, 0x1a, 0x12, 0x66, 0x55, 0x66, 0x56, 0x25, 0x56, 0x0e,
+	0x66, 0x56, 0x3a, 0xc0, 0x00, 0x02, 0xa8, 0x44, 0x9a, 0xbc, 0x7e, 0x1d, 0x65, 0xc0, 0x56, 0xc0,
+	0x3d, 0x5a, 0x66, 0x29, 0x5a, 0x21, 0x65, 0x5a, 0x0d, 0xca, 0x29, 0x0d, 0x00, 0x25, 0xfe, 0xce,
+	0x79, 0xac, 0x22, 0x51, 0x93, 0xef, 0x9d, 0xaa, 0x08, 0xa3, 0x66, 0x1c, 0x21, 0x30, 0x6e, 0xc0,
+	0x7f, 0x6e, 0xc0, 0x6f, 0x7a, 0x6e, 0xc1, 0x2c, 0xc0, 0x09, 0x21, 0xc0, 0x35, 0x98, 0xcc, 0xfe,
+	0x84, 0x51, 0x97, 0xcd, 0xfe, 0x19, 0x04, 0x00, 0xf9, 0xac, 0x13, 0xfe, 0xd6, 0xba, 0x09, 0x65,
+	0x04, 0xc0, 0x09, 0x11, 0x18, 0x21, 0xfe, 0x19, 0xa8, 0xab, 0x41, 0x9c, 0xaa, 0x95, 0xdf, 0xa3,
+	0x76, 0x00, 0xfe, 0x7c, 0x31, 0xfe, 0x4a, 0x69, 0x00, 0xfd, 0xfd, 0xfd, 0xce, 0xac, 0x12, 0x09,
+	0x00, 0x0c, 0x45, 0xc0, 0xa4, 0x86, 0x00, 0x05, 0x31, 0xfe, 0x73, 0xcf, 0x41, 0x7f, 0xc0, 0x12,
+	0x94, 0xef, 0x2a, 0xa4, 0x76, 0x00, 0xf8, 0xae, 0x01, 0xae, 0x02, 0xae, 0x20, 0xac, 0x22, 0x30,
+	0x1c, 0xa2, 0x66, 0xa5, 0x66, 0x31, 0xc3, 0x2c, 0xc0, 0x1d, 0x18, 0x59, 0x66, 0x04, 0x55, 0x26,
+	0xc0, 0x66, 0x99, 0xbb, 0x9d, 0xaa, 0xac, 0x23, 0x31, 0x35, 0x11, 0xfe, 0x01, 0x06, 0xa9, 0x62,
+	0xa5, 0x65, 0x42, 0x02, 0xc7, 0x66, 0x56, 0x29, 0x56, 0x65, 0x5a, 0x66, 0x3e, 0x66, 0x56, 0x65,
+	0x5a, 0x65, 0x56, 0x06, 0x3a, 0x66, 0xc0, 0x00, 0x29, 0xa9, 0x44, 0x20, 0x6e, 0x56, 0x65, 0xc1,
+	0x09, 0x02, 0x3d, 0x5a, 0x66, 0x29, 0x5a, 0x21, 0x1a, 0x12, 0x0d, 0xca, 0x12, 0x29, 0x22, 0x00,
+	0xfe, 0x73, 0xef, 0x30, 0xa7, 0x44, 0x04, 0x93, 0xef, 0xa2, 0x77, 0xa7, 0x44, 0x7e, 0x1c, 0x21,
+	0x30, 0x6e, 0x6f, 0x7a, 0x6e, 0xc0, 0x7f, 0xc0, 0x6e, 0xc0, 0x6f, 0x2c, 0x18, 0x9c, 0x99, 0x1c,
+	0x30, 0x9c, 0xaa, 0x92, 0xef, 0x95, 0xde, 0xfe, 0x31, 0xa7, 0x00, 0xf8, 0x3d, 0x26, 0x09, 0x65,
+	0x6b, 0x09, 0x35, 0xfe, 0x84, 0x51, 0x31, 0x92, 0xff, 0x33, 0xac, 0x52, 0x9a, 0xab, 0x0e, 0xa3,
+	0x86, 0x07, 0xfe, 0x84, 0x72, 0xfe, 0x31, 0xa7, 0x00, 0xfd, 0xfd, 0xfd, 0xce, 0xa7, 0x44, 0x11,
+	0xfe, 0x00, 0x02, 0xa7, 0x24, 0x55, 0xc0, 0x28, 0x00, 0xfe, 0xb5, 0xb6, 0x31, 0xfe, 0x8c, 0x92,
+	0x96, 0xde, 0xa3, 0x66, 0xc0, 0x66, 0x96, 0xcc, 0x02, 0xab, 0x33, 0xfe, 0x00, 0x41, 0x00, 0xf5,
+	0x6e, 0xfe, 0x42, 0x6a, 0x35, 0xaf, 0x10, 0x26, 0x66, 0x66, 0xa3, 0x66, 0x2c, 0x31, 0xc2, 0x2c,
+	0xc0, 0x55, 0xc0, 0x18, 0x55, 0x66, 0x35, 0x30, 0x21, 0xc0, 0x9b, 0xab, 0x9a, 0xbb, 0xa9, 0x44,
+	0xaa, 0x32, 0x1d, 0xfe, 0x9d, 0x14, 0x36, 0xa2, 0x87, 0xa8, 0x43, 0x66, 0x02, 0xc7, 0x3d, 0x56,
+	0x65, 0x56, 0xc0, 0x12, 0x0d, 0x66, 0x3e, 0x66, 0x56, 0x65, 0x22, 0x66, 0x55, 0x66, 0x3a, 0xc0,
+	0x66, 0xc0, 0x07, 0x15, 0xaa, 0x33, 0x51, 0xc0, 0x56, 0xc0, 0x11, 0xc0, 0x56, 0xc0, 0x3d, 0xc0,
+	0x56, 0xc0, 0x29, 0x5a, 0x21, 0x1a, 0x12, 0x0d, 0xcb, 0x15, 0x29, 0xfe, 0x00, 0x84, 0x07, 0xfe,
+	0x94, 0xd3, 0x18, 0xa3, 0x66, 0x19, 0x96, 0xdd, 0xa6, 0x55, 0x1c, 0xc0, 0x6e, 0x6f, 0x7a, 0x6e,
+	0x04, 0xc0, 0x6e, 0xc0, 0x18, 0xc0, 0x6e, 0xc0, 0x2c, 0x1d, 0x35, 0x1c, 0xa2, 0x66, 0x21, 0x94,
+	0xee, 0x93, 0xdf, 0x95, 0xed, 0x00, 0xf7, 0xfe, 0x6b, 0x8e, 0xfe, 0xe7, 0x5c, 0x04, 0xc1, 0xa2,
+	0x66, 0x9a, 0xcb, 0xfe, 0x94, 0xb3, 0xfe, 0xff, 0xff, 0xfe, 0xa5, 0x55, 0x0a, 0x2a, 0x98, 0xcd,
+	0x98, 0xbc, 0xa2, 0x87, 0x9a, 0xbc, 0xfe, 0x8c, 0x92, 0xfe, 0x19, 0x04, 0x00, 0xfd, 0xfd, 0xfd,
+	0xce, 0xa2, 0x77, 0xfe, 0x7c, 0x31, 0xfe, 0x21, 0x66, 0x30, 0xa3, 0x66, 0x55, 0x28, 0x00, 0xfe,
+	0x94, 0xb2, 0x31, 0xfe, 0xa5, 0x75, 0xfe, 0x5b, 0x2d, 0xa5, 0x65, 0x56, 0xc0, 0x3d, 0x9d, 0x9a,
+	0xfe, 0x7c, 0x31, 0xfe, 0x18, 0xc3, 0x00, 0xf4, 0xa5, 0x55, 0xfe, 0x52, 0xec, 0xac, 0x22, 0xaf,
+	0x10, 0xa6, 0x65, 0x55, 0xc0, 0xa4, 0x66, 0xa4, 0x66, 0xc2, 0x2c, 0xc0, 0x55, 0xc0, 0x18, 0x09,
+	0xc0, 0x55, 0x30, 0x21, 0x6e, 0x9c, 0xbb, 0x99, 0xbb, 0xa4, 0x66, 0x2c, 0x31, 0xfe, 0xbd, 0xf7,
+	0xfe, 0x42, 0x6a, 0x27, 0xaa, 0x53, 0xc0, 0x02, 0xc7, 0x3d, 0x56, 0x65, 0x5a, 0x66, 0x65, 0x12,
+	0x66, 0x3e, 0x66, 0x5a, 0x65, 0x66, 0x22, 0x66, 0x0e, 0x66, 0x06, 0x65, 0xc0, 0x62, 0x61, 0x00,
+	0x3e, 0x20, 0x5a, 0x7e, 0xc0, 0x1d, 0x11, 0xc1, 0x56, 0x02, 0x3d, 0xc0, 0x35, 0xc0, 0x29, 0x26,
+	0x21, 0x1a, 0x12, 0xc0, 0x0d, 0xcb, 0x21, 0xc0, 0x00, 0x36, 0xfe, 0xb5, 0xb6, 0x31, 0xc0, 0x93,
+	0xef, 0x3d, 0xa7, 0x45, 0xa3, 0x76, 0x1c, 0x21, 0x7f, 0x6e, 0xc0, 0x04, 0x6e, 0xc0, 0x6f, 0x18,
+	0x6e, 0xc0, 0x6f, 0x2c, 0x09, 0x21, 0xc0, 0x30, 0x97, 0xcc, 0xfe, 0x7c, 0x31, 0x25, 0xfe, 0x10,
+	0x82, 0x00, 0xf5, 0xfe, 0x8c, 0x92, 0xfe, 0xef, 0x7d, 0x04, 0x09, 0x04, 0x18, 0x96, 0xcc, 0x99,
+	0xcd, 0xfe, 0xff, 0xff, 0xfe, 0x84, 0x71, 0xfe, 0x3a, 0x29, 0xa6, 0x55, 0x0d, 0x9b, 0xab, 0x65,
+	0xa5, 0x65, 0xfe, 0x8c, 0x92, 0xfe, 0x08, 0x61, 0x00, 0xfd, 0xfd, 0xfd, 0xcf, 0xfe, 0x73, 0xcf,
+	0x94, 0xef, 0xfe, 0x00, 0x02, 0xa7, 0x24, 0x66, 0xa3, 0x76, 0x00, 0xfe, 0x63, 0x6e, 0x31, 0x92,
+	0xff, 0xfe, 0x53, 0x0d, 0xa6, 0x65, 0x59, 0xc0, 0x97, 0xdd, 0x99, 0xbc, 0xfe, 0x7c, 0x11, 0xfe,
+	0x31, 0xa6, 0x00, 0xf3, 0xaa, 0x33, 0xfe, 0x63, 0x4e, 0xae, 0x10, 0xad, 0x21, 0xa3, 0x76, 0x41,
+	0xa2, 0x88, 0xa5, 0x55, 0xa2, 0x77, 0xc2, 0x2c, 0xc0, 0x1d, 0x18, 0x59, 0x66, 0x66, 0x35, 0x55,
+	0xc0, 0x1c, 0x99, 0xbb, 0x56, 0xad, 0x21, 0x31, 0x95, 0xee, 0xfe, 0x63, 0x4d, 0x06, 0x02, 0xa2,
+	0x77, 0x02, 0xc7, 0x66, 0x56, 0x65, 0xc0, 0x56, 0x1a, 0x56, 0x66, 0xc0, 0x3e, 0x39, 0x36, 0x65,
+	0x66, 0x22, 0x66, 0x55, 0xc0, 0x66, 0x06, 0x61, 0x1f, 0x66, 0x2a, 0xaa, 0x43, 0xa9, 0x33, 0xa2,
+	0x77, 0x9b, 0xbb, 0x9b, 0xbb, 0x11, 0x6f, 0xc0, 0x11, 0xc0, 0x56, 0xc0, 0x02, 0x3d, 0x5a, 0x66,
+	0xc0, 0x29, 0x5a, 0x21, 0x69, 0x66, 0x12, 0x66, 0xcc, 0x29, 0x0d, 0x00, 0x11, 0xfe, 0xce, 0x79,
+	0x31, 0x10, 0x93, 0xee, 0xc0, 0xa7, 0x54, 0xa2, 0x77, 0x1c, 0x21, 0x30, 0x6e, 0x6f, 0x04, 0x6e,
+	0xc0, 0x18, 0xc0, 0x6e, 0xc0, 0x2c, 0x18, 0x30, 0x1c, 0x30, 0x39, 0xfe, 0x8c, 0xb3, 0x95, 0xdd,
+	0xfe, 0x21, 0x45, 0x00, 0xf3, 0x07, 0xfe, 0xad, 0x96, 0x09, 0x04, 0x09, 0x04, 0x1d, 0xfe, 0xb5,
+	0xb6, 0xa4, 0x67, 0xae, 0x10, 0xfe, 0x63, 0x4e, 0x11, 0x20, 0x2a, 0x25, 0x9b, 0xab, 0x02, 0xad,
+	0x21, 0x00, 0xfd, 0xfd, 0xfd, 0xd0, 0xfe, 0x63, 0x2d, 0x5a, 0x00, 0xa8, 0x25, 0x56, 0x11, 0x1f,
+	0xab, 0x22, 0x1d, 0x9a, 0xbc, 0xfe, 0x53, 0x0d, 0xa6, 0x65, 0x59, 0x30, 0x99, 0xbb, 0x97, 0xcd,
+	0x26, 0x96, 0xed, 0x00, 0xf2, 0xaf, 0x01, 0x26, 0x3d, 0xaa, 0x33, 0xc0, 0x55, 0x04, 0xa5, 0x55,
+	0xc2, 0x66, 0xc0, 0x1d, 0xc0, 0x66, 0x55, 0x04, 0x55, 0x66, 0x59, 0x21, 0x9a, 0xbb, 0x9b, 0xab,
+	0x28, 0x31, 0x9a, 0xbb, 0xfe, 0x84, 0x31, 0xfe, 0x00, 0xc5, 0x29, 0xa5, 0x65, 0x42, 0x69, 0xc6,
+	0x66, 0x3a, 0x2e, 0x29, 0x56, 0xc0, 0x55, 0xc0, 0x0d, 0x56, 0x69, 0x66, 0x56, 0x2a, 0x22, 0x66,
+	0xc0, 0x0e, 0xc0, 0x66, 0x51, 0x1f, 0xa4, 0x45, 0x21, 0xaa, 0x32, 0xa4, 0x66, 0x9b, 0xbb, 0x95,
+	0xed, 0xc0, 0xac, 0x22, 0xa6, 0x55, 0x26, 0x9a, 0xbc, 0x9d, 0xa9, 0x66, 0x11, 0xc0, 0x56, 0xc0,
+	0x02, 0x66, 0x5a, 0x66, 0xc0, 0x29, 0xc0, 0x21, 0xc0, 0x15, 0x12, 0x0d, 0xcc, 0x12, 0x29, 0x2a,
+	0x00, 0xfe, 0x73, 0xcf, 0x30, 0xa7, 0x44, 0x99, 0xbc, 0x94, 0xee, 0x25, 0x1c, 0x6e, 0xc0, 0x2d,
+	0x30, 0x6e, 0x6f, 0x04, 0x6e, 0xc0, 0x18, 0xc0, 0x6e, 0x6f, 0x1d, 0x9d, 0x99, 0x9c, 0xaa, 0xa2,
+	0x77, 0x1c, 0x94, 0xde, 0xfe, 0x6b, 0x8f, 0x93, 0xfe, 0x00, 0xf2, 0xa8, 0x24, 0xfe, 0xc6, 0x59,
+	0x09, 0x04, 0x09, 0xc0, 0x1d, 0xfe, 0x9c, 0xf4, 0x30, 0x09, 0xfe, 0x3a, 0x6a, 0xa4, 0x76, 0x0c,
+	0x95, 0xce, 0x2a, 0x07, 0xfe, 0x63, 0x6e, 0x7a, 0x00, 0xfd, 0xfd, 0xfd, 0xd0, 0xfe, 0x4a, 0x69,
+	0xac, 0x13, 0x00, 0x1d, 0x51, 0x0e, 0xa1, 0x98, 0x00, 0x30, 0xa4, 0x66, 0x0d, 0xa3, 0x76, 0x5a,
+	0x35, 0x99, 0xbc, 0x97, 0xcc, 0x3e, 0x7a, 0x00, 0xf0, 0xa3, 0x66, 0xfe, 0x4a, 0x8a, 0xae, 0x11,
+	0xaf, 0x10, 0xa7, 0x54, 0x52, 0x6e, 0x18, 0xa3, 0x66, 0xc1, 0x2c, 0xc0, 0x55, 0xc0, 0x18, 0x55,
+	0xc0, 0x55, 0x30, 0x59, 0xc0, 0x9c, 0xaa, 0x98, 0xcd, 0xa7, 0x55, 0x31, 0x18, 0xfe, 0x9d, 0x14,
+	0x33, 0xa2, 0x97, 0x16, 0x66, 0x02, 0xc6, 0x3d, 0xc0, 0x56, 0x65, 0x5a, 0x66, 0x15, 0x12, 0x0d,
+	0xc0, 0x55, 0x66, 0x36, 0x66, 0x65, 0x22, 0x66, 0xc0, 0x65, 0x56, 0x51, 0x61, 0x2a, 0xaa, 0x33,
+	0xa7, 0x55, 0x7a, 0x97, 0xdc, 0x94, 0xed, 0x99, 0xcc, 0xc2, 0x01, 0x05, 0xaa, 0x33, 0xa2, 0x67,
+	0x9a, 0xcc, 0x9b, 0xaa, 0x56, 0x11, 0x09, 0xc0, 0x02, 0x3d, 0x5a, 0x66, 0xc0, 0x65, 0xc0, 0x21,
+	0xc0, 0x1a, 0x12, 0xc0, 0x0d, 0xcc, 0x15, 0x29, 0xfe, 0x00, 0x84, 0x00, 0xfe, 0x94, 0xd3, 0x18,
+	0xa3, 0x66, 0x94, 0xef, 0x99, 0xbb, 0xa7, 0x54, 0xa4, 0x66, 0x66, 0x21, 0x7f, 0x6e, 0xc0, 0x04,
+	0x6e, 0xc1, 0x18, 0xc0, 0x6e, 0x2c, 0x09, 0x21, 0xc0, 0x6e, 0x96, 0xde, 0x92, 0xef, 0x05, 0x14,
+	0x51, 0xf0, 0xfe, 0x3a, 0x09, 0x21, 0xa4, 0x66, 0xc3, 0xfe, 0x8c, 0x92, 0x1d, 0x99, 0xbc, 0xfe,
+	0x19, 0xa8, 0xab, 0x52, 0x38, 0x95, 0xce, 0xa4, 0x75, 0x00, 0xfe, 0x7c, 0x10, 0x95, 0xed, 0x00,
+	0xfd, 0xfd, 0xfd, 0xd0, 0xac, 0x12, 0xfe, 0x84, 0x51, 0x00, 0xa9, 0x15, 0x09, 0xc0, 0x2d, 0x00,
+	0xfe, 0xc6, 0x38, 0x31, 0x11, 0x9b, 0xab, 0x7f, 0x6e, 0x9b, 0xaa, 0x96, 0xde, 0xa5, 0x65, 0x35,
+	0xfe, 0x00, 0x20, 0x00, 0xee, 0x01, 0xfe, 0x5b, 0x0c, 0xaf, 0x00, 0xad, 0x22, 0xa4, 0x75, 0x41,
+	0xa2, 0x88, 0x2c, 0x31, 0xc0, 0x2c, 0xc0, 0x59, 0x66, 0x18, 0x59, 0x66, 0x04, 0x55, 0x26, 0xc0,
+	0x12, 0x98, 0xcd, 0x7f, 0x1d, 0x31, 0xfe, 0xbd, 0xd7, 0xfe, 0x3a, 0x4a, 0x99, 0xac, 0x11, 0xc0,
+	0x55, 0xc6, 0x66, 0xc0, 0x35, 0x65, 0x5a, 0x21, 0x1a, 0x56, 0x66, 0xc0, 0x56, 0x69, 0x66, 0x36,
+	0x2a, 0x66, 0x5a, 0x66, 0xc0, 0x51, 0x9d, 0xaa, 0xa2, 0x66, 0x12, 0xaa, 0x43, 0xa4, 0x66, 0x39,
+	0x94, 0xfe, 0x14, 0x00, 0xc6, 0x14, 0xac, 0x12, 0xac, 0x22, 0xa6, 0x55, 0x21, 0x9a, 0xbb, 0x9c,
+	0xaa, 0xc0, 0x6f, 0x02, 0x3d, 0x5a, 0x35, 0xc0, 0x29, 0xc0, 0x56, 0xc0, 0x1a, 0x15, 0x12, 0x0d,
+	0xcd, 0x21, 0xc0, 0x00, 0x17, 0xfe, 0xb5, 0xb6, 0x2c, 0x55, 0x93, 0xef, 0x9d, 0xaa, 0xa8, 0x43,
+	0xa2, 0x77, 0x1c, 0x21, 0x7f, 0x6e, 0x6f, 0x7a, 0x6e, 0xc0, 0x6f, 0x7a, 0x6e, 0x6f, 0x1d, 0x30,
+	0x1c, 0x30, 0x9a, 0xbb, 0x92, 0xef, 0x94, 0xde, 0xfe, 0x18, 0xc3, 0x00, 0xef, 0xfe, 0x63, 0x6d,
+	0xfe, 0xef, 0x5c, 0x09, 0xc1, 0x7a, 0x35, 0xfe, 0x94, 0xb3, 0x31, 0xfe, 0xb5, 0xd7, 0xfe, 0x19,
+	0xa8, 0xab, 0x52, 0x1a, 0x97, 0xce, 0xa4, 0x65, 0x00, 0x25, 0xfe, 0x31, 0xa6, 0x00, 0xfd, 0xfd,
+	0xfd, 0xd0, 0xa5, 0x55, 0xfe, 0x84, 0x72, 0xfe, 0x00, 0xe5, 0x09, 0x6e, 0x09, 0xa4, 0x76, 0x00,
+	0xfe, 0x9c, 0xf4, 0x31, 0xfe, 0xa5, 0x55, 0xfe, 0x63, 0x6e, 0xa4, 0x66, 0xc0, 0x0d, 0x96, 0xdd,
+	0xc0, 0xb0, 0x00, 0xfe, 0x18, 0xe3, 0x00, 0xed, 0xac, 0x12, 0x0d, 0xfe, 0xad, 0x96, 0x1c, 0x6e,
+	0x55, 0xa5, 0x66, 0x31, 0xc0, 0x2c, 0xc1, 0x55, 0xc0, 0x18, 0x09, 0x04, 0x55, 0x56, 0x69, 0x21,
+	0x99, 0xbc, 0x9d, 0xa9, 0xac, 0x23, 0x31, 0x95, 0xee, 0xfe, 0x63, 0x4d, 0xfe, 0x00, 0xc5, 0xfe,
+	0x42, 0x8a, 0x16, 0x02, 0xc6, 0x66, 0xc0, 0x56, 0x29, 0x5a, 0x66, 0xc0, 0x55, 0xc0, 0x66, 0x66,
+	0x3e, 0x66, 0x36, 0x66, 0x65, 0xc0, 0x22, 0x66, 0x40, 0x9d, 0xbb, 0x22, 0xaa, 0x43, 0xa7, 0x54,
+	0x7e, 0x98, 0xcc, 0x93, 0xfe, 0x00, 0xcc, 0xa7, 0x45, 0xae, 0x00, 0xa9, 0x44, 0x6f, 0x9b, 0xaa,
+	0x09, 0x3d, 0xc2, 0x56, 0xc0, 0x65, 0xc0, 0x26, 0x21, 0xc0, 0x65, 0x12, 0xc0, 0x66, 0xcd, 0x29,
+	0x12, 0x00, 0x11, 0xfe, 0xce, 0x79, 0xac, 0x22, 0x9b, 0xab, 0x93, 0xff, 0xa3, 0x66, 0x1c, 0x6e,
+	0xc0, 0x2d, 0x7a, 0x6e, 0x01, 0x7a, 0x6e, 0xc0, 0x18, 0xc0, 0x6e, 0xc0, 0x04, 0x1c, 0xa2, 0x66,
+	0x9d, 0xaa, 0x94, 0xde, 0xfe, 0x63, 0x4e, 0xfe, 0x29, 0x66, 0x00, 0xee, 0xfe, 0x94, 0xb3, 0x09,
+	0xc2, 0x18, 0x98, 0xcc, 0x97, 0xbc, 0x31, 0xfe, 0x8c, 0xb2, 0xfe, 0x32, 0x29, 0xa7, 0x54, 0x95,
+	0xde, 0x9b, 0xbb, 0x6f, 0x06, 0xfe, 0x8c, 0xb3, 0xfe, 0x10, 0xc3, 0x00, 0xfd, 0xfd, 0xfd, 0xd1,
+	0xfe, 0x7c, 0x10, 0x29, 0x2b, 0xa5, 0x55, 0x11, 0x25, 0x00, 0xfe, 0x63, 0x6e, 0xfe, 0xff, 0xff,
+	0x93, 0xef, 0xfe, 0x5b, 0x2d, 0xa6, 0x55, 0xc0, 0x51, 0x96, 0xdd, 0x9d, 0x9a, 0xfe, 0x74, 0x10,
+	0xfe, 0x39, 0xe8, 0x00, 0xec, 0xfe, 0x3a, 0x08, 0xb0, 0x00, 0xaf, 0x10, 0xa9, 0x33, 0x1c, 0x6e,
+	0xa6, 0x55, 0xa2, 0x77, 0xc0, 0x2c, 0xc0, 0x1d, 0xc0, 0x66, 0x09, 0xc0, 0x55, 0x62, 0x26, 0xc0,
+	0x9b, 0xbb, 0x9a, 0xab, 0xa8, 0x55, 0x31, 0x9a, 0xbb, 0xfe, 0x84, 0x31, 0xfe, 0x00, 0xc5, 0xac,
+	0x31, 0xa4, 0x75, 0x42, 0x02, 0xc5, 0x66, 0xc0, 0x35, 0x29, 0xc0, 0x56, 0xc0, 0x15, 0x5a, 0x66,
+	0xc0, 0x3e, 0xc0, 0x66, 0x56, 0x69, 0x25, 0xc0, 0x55, 0x9d, 0x9a, 0xc0, 0x12, 0xa9, 0x44, 0xa5,
+	0x65, 0x9b, 0xba, 0x95, 0xee, 0x95, 0xed, 0x00, 0xd0, 0x14, 0xac, 0x12, 0xad, 0x12, 0xa5, 0x65,
+	0x21, 0x99, 0xbc, 0x9d, 0xa9, 0xc2, 0x35, 0xc0, 0x29, 0xc0, 0x56, 0xc0, 0x1a, 0x12, 0xc0, 0x66,
+	0xcd, 0x12, 0x29, 0x9a, 0xac, 0x00, 0xfe, 0x73, 0xcf, 0x30, 0xa7, 0x44, 0x97, 0xcd, 0x96, 0xdd,
+	0xa6, 0x55, 0xa5, 0x65, 0x1c, 0x21, 0x6f, 0x7e, 0xc0, 0x7f, 0x6e, 0xc1, 0x18, 0xc0, 0x6e, 0x09,
+	0x21, 0xc1, 0x96, 0xdd, 0xfe, 0x73, 0xd0, 0x92, 0xfe, 0x00, 0xec, 0xa3, 0x57, 0xfe, 0xb5, 0xd7,
+	0xae, 0x20, 0x56, 0xc1, 0xa2, 0x77, 0xfe, 0xbd, 0xd7, 0x31, 0xad, 0x21, 0xfe, 0x63, 0x6e, 0x9a,
+	0xbb, 0x6e, 0xfe, 0x11, 0x26, 0xc0, 0x9c, 0xaa, 0xac, 0x31, 0xfe, 0x84, 0x51, 0x00, 0xfd, 0xfd,
+	0xfd, 0xd2, 0xfe, 0x63, 0x6d, 0x0d, 0x07, 0x25, 0x51, 0x1d, 0x01, 0x2e, 0x18, 0x9d, 0x99, 0xfe,
+	0x5b, 0x4e, 0xa5, 0x65, 0xc0, 0x30, 0x96, 0xcd, 0x9c, 0xaa, 0xac, 0x21, 0x9b, 0xcb, 0x00, 0xea,
+	0xa4, 0x66, 0xfe, 0x4a, 0xab, 0xb0, 0x00, 0xae, 0x20, 0x26, 0x51, 0xa3, 0x77, 0x2c, 0x6e, 0x2c,
+	0xc0, 0x59, 0x66, 0x18, 0x55, 0xc0, 0x04, 0x35, 0x26, 0xc0, 0x9d, 0xaa, 0x99, 0xbc, 0xa4, 0x66,
+	0x2c, 0x18, 0xfe, 0x9d, 0x14, 0xfe, 0x01, 0x46, 0xa5, 0x85, 0xa7, 0x64, 0x11, 0x02, 0xc5, 0x66,
+	0xc0, 0x56, 0x29, 0xc0, 0x21, 0xc0, 0x15, 0x12, 0x66, 0xc0, 0x56, 0x3e, 0x66, 0x36, 0x2a, 0xc0,
+	0x25, 0x0e, 0x9d, 0xaa, 0xa5, 0x55, 0x3d, 0xa8, 0x44, 0xc0, 0x98, 0xdc, 0x94, 0xed, 0x99, 0xcc,
+	0xd6, 0xa8, 0x34, 0xad, 0x22, 0x30, 0x6e, 0x9a, 0xbb, 0x3d, 0x56, 0x3d, 0xc0, 0x35, 0x29, 0xc0,
+	0x5a, 0x21, 0x1a, 0x15, 0x12, 0xc0, 0x66, 0xcd, 0x15, 0x29, 0x94, 0xdf, 0x00, 0xfe, 0x94, 0xd3,
+	0xfe, 0xef, 0x7e, 0x2c, 0x31, 0x9b, 0xba, 0x08, 0xa3, 0x66, 0x66, 0x21, 0x7f, 0x6e, 0xc0, 0x04,
+	0x6e, 0xc0, 0x6f, 0x18, 0x1d, 0xc0, 0x35, 0x1c, 0xa2, 0x66, 0x99, 0xcc, 0xfe, 0x84, 0x72, 0x11,
+	0xfe, 0x08, 0x61, 0x00, 0xea, 0xac, 0x03, 0xfe, 0xd6, 0xba, 0xa7, 0x54, 0x09, 0xc1, 0xa2, 0x77,
+	0xfe, 0x9d, 0x14, 0xfe, 0xe7, 0x5d, 0x04, 0xfe, 0x32, 0x2a, 0xa7, 0x53, 0x9b, 0xbb, 0x94, 0xdf,
+	0xa3, 0x76, 0x07, 0xfe, 0x63, 0x4d, 0xa2, 0x77, 0x00, 0xfd, 0xfd, 0xfd, 0xd2, 0xfe, 0x4a, 0x49,
+	0xfe, 0x84, 0x52, 0x00, 0x25, 0x52, 0xc0, 0xa3, 0x76, 0x00, 0xfe, 0xd6, 0xba, 0x2c, 0xfe, 0x73,
+	0xf0, 0x66, 0x35, 0xc0, 0x16, 0x29, 0xa6, 0x55, 0xa7, 0x54, 0x00, 0xe9, 0xa8, 0x44, 0xfe, 0x5b,
+	0x2d, 0xfe, 0xa5, 0x55, 0x0d, 0xa2, 0x77, 0x1c, 0xa5, 0x55, 0xa4, 0x66, 0xc0, 0x2c, 0xc0, 0x1d,
+	0x66, 0xc0, 0x09, 0x04, 0x55, 0x26, 0xc0, 0x1c, 0x9a, 0xaa, 0x66, 0x09, 0x2c, 0x11, 0xfe, 0x3a,
+	0x29, 0x99, 0x9c, 0xab, 0x52, 0xc0, 0x02, 0xc5, 0x3d, 0xc0, 0x56, 0x29, 0xc0, 0x5a, 0x66, 0x1a,
+	0x12, 0x66, 0xc0, 0x05, 0x3e, 0x66, 0xc0, 0x56, 0x69, 0x22, 0x9d, 0x9a, 0x3a, 0xa7, 0x65, 0x25,
+	0xa5, 0x55, 0x9c, 0xba, 0x95, 0xee, 0x95, 0xed, 0x00, 0xda, 0x14, 0xad, 0x11, 0xac, 0x13, 0xa5,
+	0x55, 0x9c, 0xab, 0x99, 0xcb, 0x35, 0xc2, 0x29, 0xc0, 0x21, 0xc0, 0x1a, 0x56, 0xc0, 0x66, 0xce,
+	0x1a, 0x24, 0x00, 0xa8, 0x06, 0xfe, 0xb5, 0xb6, 0x2c, 0x09, 0x94, 0xee, 0xc0, 0xa7, 0x45, 0x7e,
+	0xc1, 0x7f, 0x6e, 0x6f, 0x7a, 0x09, 0xc0, 0x6f, 0x18, 0x1d, 0x04, 0x1c, 0x21, 0x9d, 0xaa, 0x94,
+	0xde, 0xfe, 0x5b, 0x2d, 0xfe, 0x19, 0x04, 0x00, 0xe9, 0x2d, 0xfe, 0xe7, 0x5c, 0x09, 0xc3, 0xfe,
+	0x94, 0xd3, 0xfe, 0xff, 0xff, 0x94, 0xee, 0xfe, 0x19, 0xa8, 0xac, 0x41, 0x97, 0xcd, 0x96, 0xce,
+	0x2a, 0x00, 0xfe, 0x7c, 0x31, 0x93, 0xfe, 0x00, 0xfd, 0xfd, 0xfd, 0xd2, 0xa9, 0x33, 0xfe, 0x94,
+	0xd3, 0x0e, 0x7b, 0x6e, 0xc0, 0xa3, 0x86, 0x00, 0xfe, 0xad, 0x76, 0x31, 0xfe, 0x9c, 0xf4, 0x96,
+	0xcd, 0xa3, 0x76, 0xc0, 0x98, 0xcd, 0x9a, 0xab, 0xc0, 0x09, 0xfe, 0x18, 0xe3, 0x00, 0xe7, 0xad,
+	0x12, 0xfe, 0x73, 0xcf, 0xb0, 0x00, 0xa9, 0x43, 0x1c, 0x21, 0xa6, 0x55, 0x31, 0x2c, 0xc0, 0x1d,
+	0xc0, 0x66, 0x55, 0xc0, 0x3a, 0x62, 0x59, 0x21, 0x9b, 0xab, 0x9b, 0xbb, 0xab, 0x22, 0xa7, 0x54,
+	0x95, 0xee, 0xfe, 0x5b, 0x2d, 0xfe, 0x00, 0xc5, 0xfe, 0x42, 0x8a, 0x7f, 0x02, 0xc5, 0x66, 0xc0,
+	0x35, 0xc0, 0x65, 0x5a, 0x66, 0x1a, 0x56, 0xc0, 0x66, 0x66, 0x3e, 0x66, 0xc0, 0x36, 0x2a, 0x9d,
+	0xaa, 0x9d, 0x9a, 0x13, 0xa9, 0x54, 0xa8, 0x43, 0x7f, 0x98, 0xdc, 0x94, 0xee, 0x99, 0xcb, 0xe0,
+	0x10, 0xae, 0x01, 0xa9, 0x34, 0x66, 0x9a, 0xab, 0x9a, 0xbb, 0x29, 0x35, 0xc0, 0x29, 0x26, 0x21,
+	0xc0, 0x65, 0x12, 0xc0, 0x66, 0xce, 0x24, 0x12, 0x00, 0xfe, 0x4a, 0x8b, 0xfe, 0xce, 0x79, 0xac,
+	0x22, 0x2d, 0x95, 0xed, 0xa4, 0x66, 0x1c, 0x6e, 0xc0, 0x2d, 0x7e, 0xc0, 0x7f, 0xc0, 0x09, 0xc0,
+	0x18, 0x1d, 0x56, 0x21, 0xc0, 0x1c, 0x96, 0xcd, 0xfe, 0x6b, 0xaf, 0xfe, 0x31, 0xa6, 0x00, 0xe8,
+	0xfe, 0x8c, 0x92, 0x09, 0xc2, 0x18, 0x9b, 0xaa, 0xfe, 0xa5, 0x35, 0x31, 0xfe, 0xa5, 0x34, 0xfe,
+	0x32, 0x09, 0x34, 0x94, 0xde, 0x9b, 0xab, 0xa3, 0x76, 0x07, 0xfe, 0x8c, 0xb3, 0xfe, 0x29, 0x65,
+	0x00, 0xfd, 0xfd, 0xfd, 0xd2, 0x14, 0x31, 0xfe, 0x4a, 0xab, 0x2b, 0x25, 0x56, 0x39, 0x00, 0xfe,
+	0x73, 0xcf, 0xfe, 0xff, 0xff, 0xfe, 0xbe, 0x18, 0xfe, 0x63, 0x6e, 0xa5, 0x66, 0xc0, 0x0d, 0x97,
+	0xcd, 0x26, 0xae, 0x21, 0xfe, 0x3a, 0x08, 0x00, 0xe5, 0x6e, 0xb0, 0x01, 0xfe, 0x84, 0x72, 0xaf,
+	0x10, 0xa5, 0x65, 0x56, 0x3a, 0xa5, 0x66, 0xc0, 0x66, 0x55, 0xc0, 0x18, 0x55, 0xc0, 0x66, 0x55,
+	0x55, 0xc0, 0x9c, 0xbb, 0x9a, 0xab, 0xa6, 0x55, 0x2c, 0x35, 0xfe, 0x84, 0x31, 0xfe, 0x00, 0x84,
+	0xae, 0x10, 0xa4, 0x75, 0x42, 0x02, 0xc4, 0x66, 0xc0, 0x35, 0xc0, 0x65, 0x5a, 0x66, 0x1a, 0x12,
+	0xc0, 0x66, 0xc0, 0x55, 0x39, 0xc0, 0x56, 0x25, 0x06, 0x61, 0x3e, 0xa9, 0x44, 0xa5, 0x65, 0x9d,
+	0xa9, 0x95, 0xee, 0x14, 0x00, 0xe4, 0xa3, 0x66, 0xac, 0x23, 0x0d, 0xa4, 0x66, 0x0d, 0x09, 0x29,
+	0x6e, 0x6b, 0x29, 0x26, 0x21, 0x1a, 0x12, 0xc0, 0x66, 0xce, 0x12, 0x29, 0x36, 0x00, 0xfe, 0x73,
+	0xcf, 0xfe, 0xdf, 0x1c, 0x2c, 0x08, 0x99, 0xbb, 0xa6, 0x55, 0xa4, 0x66, 0x66, 0x21, 0x7f, 0x6e,
+	0xc0, 0x7f, 0x6e, 0xc1, 0x7f, 0xc0, 0x35, 0x1c, 0x21, 0x9a, 0xbb, 0xfe, 0x7c, 0x31, 0xfe, 0x42,
+	0x29, 0xfe, 0x00, 0x20, 0x00, 0xe5, 0xa3, 0x57, 0xfe, 0xbd, 0xf7, 0xad, 0x21, 0x56, 0xc1, 0xa2,
+	0x77, 0x93, 0xff, 0x25, 0xae, 0x11, 0xfe, 0x6b, 0xaf, 0x98, 0xcc, 0x6f, 0x93, 0xef, 0x69, 0x52,
+	0xa5, 0x65, 0xfe, 0x8c, 0x92, 0x19, 0x00, 0xfd, 0xfd, 0xfd, 0xd3, 0x29, 0xa2, 0x77, 0x00, 0xab,
+	0x04, 0x1d, 0x7e, 0x09, 0xa6, 0x55, 0x18, 0x35, 0xfe, 0x63, 0x6e, 0xa5, 0x66, 0xc0, 0x21, 0x96,
+	0xdd, 0x51, 0x0d, 0x61, 0x00, 0xe4, 0xa5, 0x55, 0xfe, 0x52, 0xcc, 0xfe, 0x9d, 0x14, 0xad, 0x21,
+	0xa2, 0x77, 0x1c, 0xa6, 0x45, 0xa3, 0x76, 0x66, 0x59, 0x66, 0x18, 0xc0, 0x55, 0x66, 0x35, 0x55,
+	0xc0, 0x51, 0x99, 0xcc, 0xa2, 0x77, 0x18, 0x15, 0xfe, 0x9d, 0x14, 0x17, 0xa6, 0x74, 0xa7, 0x64,
+	0x56, 0x02, 0xc5, 0x3d, 0x56, 0xc0, 0x29, 0x5a, 0x66, 0xc0, 0x12, 0xc0, 0x66, 0xc0, 0x3e, 0xc0,
+	0x39, 0x56, 0x51, 0x9c, 0xaa, 0x0e, 0x26, 0xa8, 0x54, 0xa2, 0x77, 0x98, 0xdc, 0x94, 0xee, 0x99,
+	0xcb, 0xea, 0x10, 0x19, 0xa8, 0x45, 0x59, 0x99, 0xcc, 0x29, 0x5a, 0x29, 0xc0, 0x21, 0xc0, 0x65,
+	0x12, 0xc0, 0x66, 0xce, 0x15, 0x29, 0x35, 0x00, 0xfe, 0x94, 0xd3, 0x09, 0x18, 0x95, 0xdd, 0x51,
+	0xa6, 0x55, 0xa2, 0x77, 0xc1, 0x7f, 0x6e, 0x6f, 0x04, 0x09, 0xc0, 0x18, 0x6e, 0x09, 0x21, 0xc0,
+	0x9d, 0x99, 0x39, 0xfe, 0x4a, 0xcb, 0x28, 0x00, 0xe4, 0xae, 0x02, 0x21, 0xa5, 0x65, 0x09, 0xc1,
+	0x1d, 0xfe, 0xa5, 0x55, 0x35, 0x09, 0xfe, 0x3a, 0x6a, 0xa5, 0x65, 0x3d, 0x93, 0xdf, 0xa4, 0x76,
+	0x96, 0xfe, 0xfe, 0x52, 0xec, 0xa8, 0x54, 0x00, 0xfd, 0xfd, 0xfd, 0xd4, 0xfe, 0x4a, 0x8a, 0xfe,
+	0x9c, 0xf4, 0x0e, 0xab, 0x01, 0x66, 0xc0, 0xa2, 0x77, 0x00, 0x0d, 0xaa, 0x33, 0xfe, 0x7c, 0x31,
+	0x51, 0x7f, 0x35, 0x95, 0xde, 0x3d, 0xa2, 0x77, 0x38, 0x14, 0x00, 0xe2, 0xa9, 0x34, 0xfe, 0x63,
+	0x6e, 0xfe, 0xb5, 0xb7, 0xa9, 0x43, 0xc0, 0x30, 0x1d, 0x31, 0x2c, 0x1d, 0xc0, 0x18, 0x55, 0x66,
+	0x55, 0x30, 0x59, 0x66, 0x9a, 0xbb, 0x51, 0x01, 0x1d, 0xfe, 0xbd, 0xd7, 0xfe, 0x32, 0x29, 0x1f,
+	0xab, 0x52, 0xc0, 0x02, 0xc5, 0x3d, 0x5a, 0x66, 0x29, 0xc0, 0x56, 0xc0, 0x15, 0x12, 0x66, 0xc0,
+	0x55, 0x39, 0xc0, 0x2a, 0x9c, 0xab, 0x51, 0x36, 0x11, 0xa5, 0x66, 0x50, 0x96, 0xdd, 0x95, 0xed,
+	0x00, 0xee, 0x19, 0xac, 0x23, 0xac, 0x22, 0xa4, 0x56, 0x08, 0x3d, 0x21, 0x29, 0xc0, 0x21, 0x1a,
+	0x15, 0x12, 0x0d, 0xcf, 0x1a, 0x29, 0x00, 0xa8, 0x06, 0xfe, 0xb5, 0xb6, 0x1d, 0x01, 0x0c, 0x25,
+	0x1c, 0x6e, 0xc0, 0x6f, 0x30, 0x6e, 0x04, 0xc0, 0x6e, 0xc0, 0x7f, 0x5a, 0x9c, 0xa9, 0x21, 0x55,
+	0x96, 0xde, 0x08, 0xfe, 0x21, 0x24, 0x00, 0xe3, 0xfe, 0x6b, 0x8e, 0x09, 0xc2, 0x7e, 0x09, 0xfe,
+	0x9c, 0xf4, 0x31, 0x93, 0xff, 0xfe, 0x21, 0xc8, 0xab, 0x42, 0x96, 0xdd, 0x97, 0xbe, 0xa4, 0x75,
+	0x00, 0xfe, 0x7c, 0x10, 0x96, 0xdd, 0x00, 0xfd, 0xfd, 0xfd, 0xd4, 0xa9, 0x33, 0xfe, 0xa5, 0x55,
+	0x29, 0x06, 0x25, 0xc0, 0xa3, 0x76, 0x00, 0xfe, 0xa5, 0x35, 0x31, 0x21, 0x93, 0xef, 0xa4, 0x66,
+	0xc0, 0x96, 0xdd, 0x9c, 0xaa, 0x56, 0x09, 0xfe, 0x29, 0x65, 0x00, 0xe1, 0xae, 0x01, 0xfe, 0x7c,
+	0x31, 0xfe, 0xc6, 0x38, 0xa6, 0x55, 0x66, 0x04, 0x2c, 0xc0, 0x1d, 0xc0, 0x18, 0x55, 0xc0, 0x55,
+	0x66, 0x26, 0xc0, 0x9c, 0xaa, 0x9a, 0xbc, 0x1c, 0x2c, 0x96, 0xdd, 0x39, 0x37, 0xfe, 0x4a, 0x8b,
+	0x6e, 0x02, 0xc5, 0x3d, 0x5a, 0x66, 0x65, 0xc0, 0x56, 0xc0, 0x65, 0x5a, 0x0d, 0xc0, 0x55, 0x66,
+	0x36, 0x51, 0x9c, 0xaa, 0x06, 0x21, 0xa8, 0x44, 0xa2, 0x76, 0x99, 0xdc, 0x94, 0xee, 0x99, 0xcb,
+	0xf4, 0xa9, 0x33, 0x19, 0xa8, 0x45, 0x55, 0x99, 0xbc, 0x9b, 0xaa, 0x66, 0x26, 0x21, 0x1a, 0x12,
+	0xc0, 0x0d, 0xcf, 0x29, 0x12, 0x00, 0x0c, 0xfe, 0xce, 0x79, 0xab, 0x23, 0x1c, 0x09, 0x39, 0xa4,
+	0x66, 0xc1, 0x7f, 0x6e, 0xc0, 0x04, 0x6e, 0xc0, 0x18, 0xc0, 0x35, 0x21, 0xc0, 0x99, 0xbc, 0xfe,
+	0x73, 0xf0, 0xfe, 0x31, 0xc7, 0x00, 0xe2, 0xfe, 0xa5, 0x55, 0xfe, 0xf7, 0x9d, 0x56, 0xc1, 0xa2,
+	0x77, 0x1c, 0x95, 0xde, 0xfe, 0xff, 0xff, 0xfe, 0x9c, 0xf4, 0xfe, 0x3a, 0x4a, 0xa6, 0x54, 0xfe,
+	0x19, 0x46, 0x41, 0x25, 0x00, 0xfe, 0x8c, 0xb3, 0xfe, 0x29, 0x66, 0x00, 0xfd, 0xfd, 0xfd, 0xd4,
+	0x6e, 0xfe, 0x94, 0xd3, 0x97, 0xdd, 0xfe, 0x00, 0x02, 0xac, 0x01, 0x25, 0x39, 0xfe, 0x00, 0x03,
+	0xfe, 0x63, 0x4d, 0xfe, 0xff, 0xff, 0x95, 0xde, 0xfe, 0x63, 0x6e, 0xa6, 0x55, 0xc0, 0x01, 0x3d,
+	0x35, 0xab, 0x32, 0x98, 0xdc, 0x00, 0xdf, 0xa2, 0x77, 0x3d, 0xfe, 0x94, 0xf4, 0xad, 0x21, 0xa3,
+	0x76, 0xc0, 0x18, 0x31, 0x2c, 0x1d, 0x18, 0x59, 0x66, 0x04, 0x55, 0x55, 0xc0, 0x9d, 0xaa, 0x9a,
+	0xbb, 0xa4, 0x66, 0x1d, 0x9b, 0xbb, 0xfe, 0x84, 0x31, 0xfe, 0x00, 0x24, 0xfe, 0x3a, 0x4a, 0x19,
+	0x42, 0x02, 0xc4, 0x3d, 0xc0, 0x35, 0x65, 0xc0, 0x56, 0xc0, 0x65, 0x12, 0x66, 0x66, 0x59, 0x66,
+	0x55, 0x9d, 0x9a, 0x9d, 0xaa, 0x2a, 0x09, 0xa6, 0x54, 0x9d, 0xaa, 0x96, 0xed, 0x96, 0xdc, 0x00,
+	0xf8, 0x19, 0xad, 0x12, 0x10, 0xa4, 0x56, 0x3e, 0x98, 0xcd, 0x15, 0x21, 0xc0, 0x1a, 0x12, 0x0d,
+	0xcf, 0x12, 0x29, 0x36, 0x00, 0xfe, 0x73, 0xcf, 0xfe, 0xde, 0xfc, 0xa6, 0x54, 0x96, 0xdd, 0x9b,
+	0xab, 0xa6, 0x65, 0xa3, 0x66, 0x1c, 0x21, 0x30, 0x6e, 0x6f, 0x7a, 0x6e, 0xc0, 0x18, 0x09, 0x21,
+	0xc0, 0x39, 0xfe, 0x8c, 0xb3, 0xfe, 0x42, 0x4a, 0x14, 0x00, 0xdf, 0xa9, 0x14, 0x05, 0x18, 0x09,
+	0x7e, 0x09, 0xa3, 0x76, 0xfe, 0xbd, 0xf7, 0x05, 0xab, 0x32, 0xfe, 0x63, 0x4d, 0x20, 0x51, 0xfe,
+	0x00, 0xc5, 0xa2, 0x86, 0x3a, 0xa7, 0x64, 0xfe, 0x8c, 0x92, 0x19, 0x00, 0xfd, 0xfd, 0xfd, 0xd5,
+	0xfe, 0x6b, 0xae, 0xaa, 0x44, 0x07, 0xac, 0x02, 0x2a, 0x6b, 0x7a, 0x2b, 0xfe, 0xe7, 0x5d, 0x18,
+	0xfe, 0x73, 0xd0, 0xa3, 0x66, 0x7e, 0x9b, 0xab, 0x3d, 0xc0, 0xa4, 0x66, 0x29, 0x00, 0xde, 0xa6,
+	0x45, 0xfe, 0x5b, 0x0d, 0xfe, 0xad, 0x96, 0xaa, 0x32, 0x1c, 0xa2, 0x77, 0x2c, 0xc0, 0x1d, 0xc0,
+	0x18, 0x55, 0x04, 0x55, 0x30, 0x26, 0x66, 0x9a, 0xbb, 0x66, 0x09, 0xc0, 0xfe, 0x9d, 0x14, 0xfe,
+	0x01, 0x06, 0xa7, 0x63, 0xa7, 0x64, 0x0c, 0x02, 0xc4, 0x3d, 0xc0, 0x56, 0x65, 0xc0, 0x56, 0xc0,
+	0x15, 0x12, 0x66, 0x56, 0x69, 0x66, 0x51, 0x06, 0xc0, 0x12, 0xa8, 0x54, 0xa3, 0x66, 0x3d, 0x95,
+	0xed, 0x00, 0xfd, 0xc0, 0xa9, 0x33, 0x19, 0xa8, 0x44, 0x56, 0x98, 0xcc, 0x12, 0x7a, 0x6f, 0x69,
+	0x12, 0x66, 0xcf, 0x12, 0xa2, 0x87, 0x94, 0xdf, 0x00, 0xfe, 0x94, 0xd3, 0x09, 0xc0, 0x95, 0xde,
+	0xc0, 0xa6, 0x55, 0x7e, 0xc0, 0x2d, 0x30, 0x6e, 0x01, 0x04, 0x09, 0x18, 0x09, 0x30, 0x21, 0x51,
+	0x95, 0xde, 0xfe, 0x53, 0x0c, 0xfe, 0x10, 0xc3, 0x00, 0xde, 0x25, 0xfe, 0xef, 0x5c, 0xa2, 0x77,
+	0x09, 0x11, 0x09, 0xa2, 0x77, 0xfe, 0xa5, 0x35, 0x18, 0x2d, 0xfe, 0x2a, 0x09, 0xa9, 0x53, 0x97,
+	0xcd, 0x3a, 0xa4, 0x76, 0x00, 0x39, 0xa5, 0x65, 0x00, 0xfd, 0xfd, 0xfd, 0xd6, 0xfe, 0x3a, 0x08,
+	0xfe, 0xad, 0xb6, 0x15, 0x9a, 0xac, 0xa2, 0x87, 0x31, 0xa3, 0x76, 0x00, 0xfe, 0xbd, 0xf7, 0xb0,
+	0x00, 0xfe, 0x94, 0xd3, 0x99, 0xbc, 0xa3, 0x76, 0x51, 0x94, 0xdf, 0xc0, 0x65, 0xae, 0x11, 0xfe,
+	0x21, 0x24, 0x00, 0xdc, 0xaa, 0x23, 0xfe, 0x73, 0xd0, 0xfe, 0xbe, 0x18, 0xa6, 0x65, 0xc0, 0xa5,
+	0x55, 0x2c, 0xc0, 0x55, 0x18, 0x09, 0xc0, 0x55, 0x62, 0x26, 0x66, 0x9c, 0xaa, 0x9c, 0xaa, 0x30,
+	0x18, 0x92, 0xff, 0xfe, 0x32, 0x29, 0x1f, 0xab, 0x52, 0xc0, 0x02, 0xc4, 0x3d, 0xc0, 0x56, 0x65,
+	0xc0, 0x56, 0xc0, 0x12, 0xc0, 0x0d, 0x55, 0x66, 0x36, 0x9d, 0x9a, 0x9c, 0xba, 0x22, 0x3d, 0xa6,
+	0x55, 0x51, 0x96, 0xed, 0x96, 0xdc, 0x00, 0xfd, 0xc4, 0xa3, 0x67, 0xad, 0x21, 0xac, 0x12, 0xa2,
+	0x78, 0x9b, 0x9a, 0x26, 0x0d, 0x7e, 0xc0, 0x12, 0x0d, 0xcf, 0xa2, 0x76, 0x29, 0x00, 0x0b, 0xfe,
+	0xb5, 0xb6, 0x18, 0x9c, 0xaa, 0x97, 0xcc, 0xa3, 0x67, 0x1c, 0x6e, 0xc0, 0x30, 0x6e, 0xc0, 0x7f,
+	0x09, 0xc0, 0x18, 0x35, 0x21, 0x1c, 0x11, 0xfe, 0x6b, 0xaf, 0xfe, 0x21, 0x45, 0x00, 0xdd, 0x08,
+	0xfe, 0xf7, 0x9d, 0x09, 0x11, 0xc0, 0x1d, 0x35, 0xfe, 0xa5, 0x55, 0xfe, 0xff, 0xff, 0xfe, 0xad,
+	0x96, 0x1e, 0x39, 0x92, 0xef, 0x9c, 0xab, 0xa3, 0x76, 0x00, 0xfe, 0x84, 0x51, 0xfe, 0x4a, 0x6a,
+	0xfe, 0x00, 0x00, 0xfd, 0xfd, 0xfd, 0xd6, 0xa4, 0x66, 0xfe, 0xad, 0x76, 0x92, 0xef, 0xfe, 0x00,
+	0x03, 0x3e, 0x52, 0xa2, 0x87, 0x07, 0xfe, 0x7c, 0x10, 0xfe, 0xff, 0xff, 0xfe, 0xc6, 0x18, 0x21,
+	0x11, 0x66, 0x97, 0xbc, 0x02, 0x52, 0xac, 0x21, 0x96, 0xed, 0x00, 0xdb, 0xfe, 0x31, 0xe8, 0xfe,
+	0x8c, 0xb3, 0xae, 0x20, 0xa4, 0x66, 0xc0, 0x18, 0x2c, 0x1d, 0x18, 0x59, 0x66, 0x04, 0x55, 0x55,
+	0xc0, 0x9d, 0xaa, 0x9a, 0xbb, 0x0d, 0x18, 0x97, 0xcd, 0xfe, 0x5b, 0x2d, 0xfe, 0x00, 0x84, 0xfe,
+	0x4a, 0x8b, 0x6e, 0x02, 0xc4, 0x66, 0xc0, 0x56, 0x29, 0xc0, 0x56, 0xc0, 0x12, 0x66, 0xc0, 0x3e,
+	0x66, 0x25, 0x06, 0x65, 0x0d, 0xa9, 0x33, 0xa2, 0x87, 0x9a, 0xba, 0x95, 0xee, 0x98, 0xdc, 0xfd,
+	0xca, 0xaa, 0x23, 0xad, 0x11, 0x24, 0x41, 0x99, 0xbc, 0x9a, 0xbb, 0xc0, 0x12, 0xc0, 0x0d, 0xcf,
+	0x29, 0x15, 0x00, 0x11, 0xfe, 0xce, 0x79, 0x18, 0x99, 0xbb, 0x9a, 0xbb, 0xa5, 0x56, 0xa3, 0x76,
+	0xc1, 0x7f, 0x6e, 0x01, 0x04, 0x6e, 0x6f, 0x09, 0x21, 0x1c, 0x9c, 0x9a, 0xfe, 0x84, 0x72, 0xfe,
+	0x31, 0xe8, 0x00, 0xdb, 0xa8, 0x14, 0x39, 0x18, 0x09, 0x7e, 0x09, 0xa3, 0x76, 0x39, 0x52, 0xae,
+	0x10, 0xfe, 0x73, 0xf0, 0x96, 0xdd, 0xc0, 0x06, 0xa1, 0x97, 0xc0, 0x9b, 0xbb, 0xfe, 0x94, 0xd3,
+	0xfe, 0x18, 0xe3, 0x00, 0xfd, 0xfd, 0xfd, 0xd7, 0xfe, 0x84, 0x51, 0xa6, 0x55, 0xfe, 0x00, 0x01,
+	0x08, 0x55, 0xc0, 0x56, 0x6e, 0xfe, 0xef, 0x7e, 0x04, 0xfe, 0x6b, 0xd0, 0x11, 0x6b, 0x99, 0xbb,
+	0x3d, 0x6f, 0x2a, 0xa6, 0x65, 0xfe, 0x00, 0x20, 0x00, 0xd8, 0x19, 0xfe, 0x4a, 0xab, 0xfe, 0xa5,
+	0x75, 0xaa, 0x43, 0x1c, 0xa3, 0x66, 0xa5, 0x55, 0x7b, 0x51, 0xc0, 0x55, 0x04, 0x35, 0x30, 0x59,
+	0x1c, 0x20, 0xa2, 0x77, 0x09, 0x9c, 0xab, 0xfe, 0x84, 0x31, 0xfe, 0x00, 0x24, 0xfe, 0x3a, 0x4a,
+	0xa4, 0x75, 0x42, 0x02, 0xc3, 0x3d, 0xc0, 0x35, 0x65, 0xc0, 0x56, 0x1a, 0x12, 0x66, 0x56, 0x3e,
+	0x39, 0x9d, 0x9a, 0x9c, 0xaa, 0x1d, 0xa9, 0x43, 0xa6, 0x55, 0x65, 0x97, 0xdc, 0x95, 0xed, 0x00,
+	0xfd, 0xce, 0xa4, 0x66, 0xac, 0x12, 0xab, 0x23, 0xa2, 0x77, 0x25, 0x99, 0xbc, 0x9d, 0xa9, 0x6f,
+	0x12, 0xc0, 0x0d, 0xcd, 0x12, 0x29, 0x36, 0x00, 0xfe, 0x73, 0xcf, 0x1c, 0xa5, 0x55, 0x97, 0xcd,
+	0x51, 0xa5, 0x65, 0xa2, 0x77, 0xc0, 0x6f, 0x30, 0x6e, 0x6f, 0x04, 0x09, 0xc0, 0x30, 0x21, 0x0d,
+	0x94, 0xef, 0xfe, 0x4a, 0x8a, 0x19, 0x00, 0xd9, 0x25, 0xfe, 0xef, 0x5c, 0xa2, 0x77, 0x66, 0x11,
+	0xc0, 0x7f, 0xfe, 0xad, 0x96, 0x09, 0x04, 0xfe, 0x3a, 0x4a, 0xa7, 0x54, 0x98, 0xcc, 0x94, 0xdf,
+	0xa4, 0x66, 0x97, 0xfd, 0xfe, 0x4a, 0x8b, 0xae, 0x10, 0x00, 0xfd, 0xfd, 0xfd, 0xd8, 0x05, 0xfe,
+	0xb5, 0xf7, 0x15, 0x9b, 0xac, 0xa2, 0x76, 0xc0, 0x15, 0x00, 0xfe, 0xc6, 0x38, 0xae, 0x11, 0xfe,
+	0x94, 0xb3, 0x9b, 0xab, 0xa3, 0x66, 0x9c, 0xaa, 0x02, 0x7f, 0x51, 0xae, 0x11, 0xfe, 0x21, 0x45,
+	0x00, 0xd7, 0xa7, 0x44, 0xfe, 0x63, 0x6e, 0xfe, 0xbd, 0xf7, 0xa7, 0x54, 0x6f, 0xa4, 0x66, 0xa3,
+	0x77, 0x55, 0x18, 0x09, 0xc0, 0x55, 0x30, 0x26, 0x21, 0x9b, 0xab, 0x61, 0xa9, 0x33, 0x7f, 0xfe,
+	0x9d, 0x14, 0x17, 0x12, 0xa7, 0x64, 0x0c, 0x02, 0xc3, 0x3d, 0xc0, 0x56, 0x29, 0x5a, 0x66, 0x1a,
+	0x12, 0x66, 0x56, 0x3e, 0x51, 0x9c, 0xab, 0x55, 0x05, 0xa8, 0x53, 0xa3, 0x77, 0x9b, 0xa9, 0x95,
+	0xee, 0x00, 0xfd, 0xd4, 0xa9, 0x34, 0x19, 0xa7, 0x45, 0x9d, 0x9a, 0x99, 0xbb, 0x3e, 0xc0, 0x7f,
+	0x12, 0x0d, 0xcd, 0x12, 0x29, 0x94, 0xdf, 0x00, 0xfe, 0x94, 0xd3, 0xfe, 0xe7, 0x3c, 0xc0, 0x97,
+	0xcd, 0x25, 0xa5, 0x66, 0x6e, 0xc0, 0x2d, 0x35, 0xc0, 0x04, 0x6e, 0xc0, 0x55, 0x21, 0x55, 0x98,
+	0xcd, 0xfe, 0x63, 0x4d, 0xfe, 0x18, 0xe3, 0x00, 0xd8, 0xfe, 0x9d, 0x14, 0x18, 0x55, 0x7e, 0xc0,
+	0x6f, 0x04, 0xfe, 0xa5, 0x55, 0xfe, 0xff, 0xff, 0xfe, 0xb5, 0xd7, 0xfe, 0x2a, 0x09, 0xa9, 0x53,
+	0x2a, 0x9b, 0xac, 0xa4, 0x75, 0x00, 0xfe, 0x7c, 0x10, 0x98, 0xcc, 0x00, 0xfd, 0xfd, 0xfd, 0xd8,
+	0xa7, 0x44, 0xfe, 0xb5, 0xb7, 0x91, 0xff, 0xfe, 0x00, 0x03, 0xfe, 0x29, 0xc8, 0x51, 0x0d, 0xfe,
+	0x00, 0x02, 0xfe, 0x84, 0x31, 0x31, 0x20, 0xfe, 0x6b, 0xd0, 0xa5, 0x65, 0x65, 0x94, 0xef, 0x41,
+	0x65, 0xaa, 0x33, 0x19, 0x00, 0xd6, 0xab, 0x23, 0x11, 0xb0, 0x00, 0x1c, 0xa2, 0x77, 0x18, 0x22,
+	0x18, 0x55, 0xc0, 0x66, 0x35, 0x55, 0xc0, 0x9c, 0xab, 0x9c, 0xaa, 0xa7, 0x54, 0x09, 0x93, 0xef,
+	0xfe, 0x3a, 0x29, 0x99, 0x8c, 0xab, 0x62, 0xc0, 0x02, 0xc3, 0x3d, 0xc0, 0x56, 0x29, 0x5a, 0x66,
+	0x65, 0x5a, 0x0d, 0x3e, 0x39, 0x41, 0x9c, 0xaa, 0xa2, 0x78, 0x29, 0xa6, 0x55, 0x19, 0x97, 0xdd,
+	0x96, 0xdc, 0x00, 0xfd, 0xd8, 0x28, 0xac, 0x12, 0xaa, 0x33, 0x6f, 0x9b, 0xab, 0x12, 0x39, 0xa2,
+	0x77, 0x12, 0xc0, 0x0d, 0xcc, 0x1a, 0x29, 0x00, 0x17, 0xfe, 0xb5, 0x96, 0xaf, 0x00, 0x9c, 0xaa,
+	0x98, 0xcd, 0xa4, 0x65, 0x21, 0xc1, 0x30, 0x6e, 0xc0, 0x7f, 0x09, 0xc0, 0x9d, 0x99, 0x62, 0x9b,
+	0xaa, 0xfe, 0x7c, 0x31, 0xfe, 0x29, 0x66, 0x00, 0xd6, 0xa9, 0x24, 0xfe, 0xd6, 0xba, 0xa7, 0x55,
+	0x55, 0x7e, 0xc0, 0xa2, 0x77, 0x39, 0x52, 0xae, 0x10, 0xfe, 0x7c, 0x10, 0x95, 0xde, 0xc0, 0x3a,
+	0xa2, 0x87, 0xc0, 0x00, 0xfe, 0x94, 0xd3, 0xfe, 0x29, 0x45, 0x00, 0xfd, 0xfd, 0xfd, 0xd9, 0xfe,
+	0x8c, 0x92, 0xa7, 0x44, 0xfe, 0x00, 0x03, 0x12, 0x3e, 0x08, 0x55, 0x5b, 0x09, 0xc0, 0xfe, 0x73,
+	0xf0, 0xa4, 0x66, 0xc0, 0x97, 0xdd, 0x99, 0xbb, 0xa2, 0x77, 0xa2, 0x77, 0x35, 0x14, 0x00, 0xd3,
+	0x6e, 0x29, 0xfe, 0x9d, 0x14, 0xac, 0x32, 0x1c, 0xa3, 0x66, 0xa4, 0x66, 0xc0, 0x55, 0x09, 0x04,
+	0x35, 0x66, 0x59, 0x51, 0x9b, 0xbb, 0x08, 0x09, 0x98, 0xcc, 0x3c, 0xfe, 0x00, 0x84, 0xfe, 0x4a,
+	0x8b, 0x11, 0x02, 0xc3, 0x3d, 0xc0, 0x56, 0x29, 0x5a, 0x66, 0x55, 0x66, 0x66, 0x3e, 0x52, 0x9d,
+	0x99, 0x3a, 0xa6, 0x65, 0xa8, 0x44, 0xa4, 0x65, 0x9a, 0xcb, 0x96, 0xdd, 0x00, 0xfd, 0xde, 0xa9,
+	0x34, 0xac, 0x22, 0xa6, 0x45, 0x51, 0x29, 0x9b, 0xab, 0x3e, 0x7f, 0x12, 0x0d, 0xcc, 0x21, 0x65,
+	0x00, 0x11, 0x2c, 0x04, 0x9a, 0xab, 0x9c, 0xaa, 0xa5, 0x65, 0xa2, 0x77, 0xc1, 0x7f, 0x6e, 0x6f,
+	0x7e, 0xc0, 0x30, 0x21, 0x05, 0x93, 0xff, 0x29, 0xfe, 0x00, 0x20, 0x00, 0xd4, 0xfe, 0x63, 0x6e,
+	0x09, 0x7e, 0xc2, 0xa2, 0x77, 0xfe, 0xad, 0x96, 0x09, 0x01, 0xfe, 0x3a, 0x4a, 0xa7, 0x54, 0x1a,
+	0x95, 0xdf, 0x16, 0x98, 0xee, 0xfe, 0x3a, 0x4a, 0xfe, 0x8c, 0x92, 0x00, 0xfd, 0xfd, 0xfd, 0xda,
+	0xfe, 0x52, 0xaa, 0xfe, 0xc6, 0x38, 0x3d, 0x97, 0xbe, 0xa4, 0x75, 0x56, 0xa3, 0x76, 0x00, 0x1d,
+	0xaf, 0x10, 0xfe, 0x94, 0xf4, 0x9a, 0xbb, 0xa3, 0x76, 0x9b, 0xab, 0x02, 0x7f, 0x3d, 0xad, 0x22,
+	0xfe, 0x31, 0xc7, 0x00, 0xd2, 0xa4, 0x56, 0x2a, 0xfe, 0xb5, 0xd7, 0xa7, 0x54, 0xa2, 0x77, 0xa4,
+	0x66, 0xa2, 0x77, 0x18, 0x09, 0xc0, 0x55, 0x30, 0x59, 0x21, 0x9b, 0xab, 0xc0, 0x01, 0x9c, 0xba,
+	0xfe, 0x84, 0x31, 0x2b, 0xfe, 0x3a, 0x4a, 0xa4, 0x75, 0x42, 0x02, 0xc2, 0x3d, 0xc0, 0x35, 0x65,
+	0x56, 0xc0, 0x12, 0x66, 0x56, 0x65, 0x51, 0x06, 0x0e, 0x21, 0xa7, 0x54, 0x19, 0x97, 0xdd, 0x96,
+	0xdc, 0x00, 0xfd, 0xe2, 0x28, 0xab, 0x23, 0xaa, 0x23, 0x7f, 0x09, 0x0d, 0x51, 0x0d, 0x12, 0xc0,
+	0x0d, 0xca, 0x12, 0x29, 0x9b, 0x9b, 0x00, 0xfe, 0x73, 0xcf, 0xfe, 0xd6, 0xbb, 0xa4, 0x66, 0x31,
+	0x65, 0xa5, 0x56, 0x7e, 0xc0, 0x6f, 0x7e, 0xc0, 0x7f, 0x6e, 0x35, 0x21, 0x51, 0x98, 0xcc, 0xfe,
+	0x52, 0xec, 0xfe, 0x08, 0x82, 0x00, 0xd2, 0x07, 0x3d, 0x1d, 0x65, 0xc1, 0x1d, 0x04, 0xfe, 0xad,
+	0x76, 0xfe, 0xff, 0xff, 0x3d, 0x1e, 0x34, 0xfe, 0x11, 0x26, 0x9d, 0xaa, 0xa3, 0x76, 0x00, 0xfe,
+	0x73, 0xf0, 0x9b, 0xba, 0x00, 0xfd, 0xfd, 0xfd, 0xda, 0xa7, 0x44, 0xfe, 0xb5, 0xd7, 0x95, 0xee,
+	0xfe, 0x00, 0x03, 0xfe, 0x31, 0xe8, 0x52, 0x15, 0x2b, 0x35, 0x31, 0x94, 0xee, 0xfe, 0x73, 0xd0,
+	0xa6, 0x54, 0x51, 0x94, 0xef, 0x55, 0x02, 0xa7, 0x55, 0xc0, 0x00, 0xd1, 0xa8, 0x34, 0x35, 0x2c,
+	0x1c, 0xa2, 0x77, 0xa4, 0x66, 0x6e, 0x51, 0xc0, 0x66, 0x55, 0x26, 0x21, 0x9d, 0x99, 0x9d, 0xaa,
+	0x2d, 0x30, 0xfe, 0x9c, 0xf4, 0xfe, 0x01, 0x46, 0x12, 0xa7, 0x64, 0x52, 0x02, 0xc2, 0x66, 0xc0,
+	0x56, 0x65, 0x56, 0x69, 0x12, 0x66, 0x55, 0x66, 0x13, 0x9d, 0xaa, 0x36, 0x02, 0xa3, 0x77, 0x9b,
+	0xba, 0x96, 0xdd, 0x00, 0xfd, 0xe8, 0xa9, 0x34, 0x11, 0xa5, 0x65, 0x25, 0x21, 0x39, 0x3e, 0x7f,
+	0x12, 0x0d, 0xca, 0x15, 0x29, 0x94, 0xdf, 0x00, 0xfe, 0x94, 0xd3, 0x2d, 0xc0, 0x99, 0xcb, 0xa2,
+	0x77, 0xa3, 0x77, 0x6e, 0xc0, 0x30, 0x6e, 0xc0, 0x04, 0xc0, 0x2d, 0x1c, 0x25, 0xfe, 0x73, 0xcf,
+	0xfe, 0x19, 0x04, 0x00, 0xd1, 0x1a, 0xfe, 0xe7, 0x1b, 0x18, 0x69, 0xc1, 0xa2, 0x77, 0x39, 0x6f,
+	0xab, 0x32, 0xfe, 0x6b, 0xaf, 0x9a, 0xbb, 0x02, 0xfe, 0x00, 0x84, 0x0e, 0x7a, 0x00, 0xfe, 0x94,
+	0xd3, 0xfe, 0x29, 0x65, 0x00, 0xfd, 0xfd, 0xfd, 0xdb, 0xfe, 0x84, 0x71, 0xab, 0x33, 0xfe, 0x00,
+	0xe6, 0x12, 0x66, 0xc0, 0x12, 0x98, 0xbe, 0x35, 0x1d, 0xfe, 0x7c, 0x31, 0xa2, 0x77, 0x7e, 0x97,
+	0xcd, 0x02, 0x7f, 0x5a, 0x09, 0xfe, 0x18, 0xe3, 0x00, 0xcf, 0xad, 0x02, 0x39, 0x05, 0x1c, 0x04,
+	0xa3, 0x66, 0x18, 0x55, 0x04, 0x35, 0x66, 0x26, 0x9d, 0xaa, 0x9c, 0xaa, 0xa5, 0x56, 0x3c, 0x94,
+	0xee, 0xfe, 0x3a, 0x4a, 0x1f, 0x11, 0xc0, 0x02, 0xc2, 0x3d, 0x35, 0x2e, 0x66, 0x56, 0x15, 0x12,
+	0x66, 0x3e, 0x51, 0x06, 0x0b, 0x12, 0xa7, 0x55, 0x11, 0x98, 0xdb, 0x96, 0xdd, 0x00, 0xfd, 0xec,
+	0x28, 0xab, 0x23, 0xa9, 0x33, 0x6f, 0x9a, 0xbb, 0x9a, 0xbc, 0x55, 0x0d, 0x12, 0xc0, 0x0d, 0xc9,
+	0x1a, 0x29, 0x00, 0xa9, 0x05, 0xfe, 0xad, 0x96, 0xad, 0x21, 0x14, 0x9b, 0xba, 0x05, 0xa3, 0x76,
+	0xc1, 0x30, 0x35, 0x6f, 0x7a, 0x35, 0x21, 0x9c, 0xaa, 0xfe, 0x8c, 0xb3, 0xfe, 0x29, 0xa7, 0x00,
+	0xd0, 0xfe, 0x8c, 0x92, 0xfe, 0xf7, 0x9e, 0x69, 0xc2, 0x6f, 0xfe, 0xad, 0x96, 0x1d, 0x21, 0x1e,
+	0xa9, 0x53, 0x01, 0x98, 0xbd, 0xa3, 0x76, 0x98, 0xed, 0x3d, 0x25, 0x00, 0xfd, 0xfd, 0xfd, 0xdc,
+	0xfe, 0x42, 0x49, 0xfe, 0xc6, 0x59, 0xfe, 0x63, 0x4d, 0xfe, 0x01, 0x06, 0x15, 0x0d, 0xa2, 0x77,
+	0x00, 0xfe, 0xad, 0x75, 0xfe, 0xff, 0xff, 0xfe, 0xad, 0x76, 0x95, 0xde, 0xa4, 0x66, 0x9c, 0xa9,
+	0x94, 0xdf, 0xa2, 0x76, 0x9d, 0xaa, 0xab, 0x22, 0x97, 0xed, 0x00, 0xcd, 0x6e, 0x3d, 0xfe, 0xad,
+	0x96, 0xa9, 0x43, 0xa3, 0x66, 0xa3, 0x77, 0x1d, 0x09, 0x66, 0x59, 0x62, 0x26, 0x1c, 0x9c, 0x9a,
+	0xa2, 0x77, 0xa5, 0x65, 0x98, 0xcd, 0x01, 0xfe, 0x00, 0xa5, 0xfe, 0x42, 0x8b, 0x7e, 0x02, 0xc2,
+	0x3d, 0x56, 0x65, 0x5a, 0x21, 0x55, 0x66, 0x08, 0x55, 0x9d, 0x9a, 0x9d, 0x9a, 0x2a, 0xa8, 0x44,
+	0xa3, 0x77, 0x9c, 0xb9, 0x96, 0xdd, 0x00, 0xfd, 0xf2, 0xa9, 0x34, 0xab, 0x22, 0xa5, 0x56, 0x1d,
+	0x21, 0x9c, 0xaa, 0x7e, 0x6f, 0x12, 0x0d, 0xc9, 0x21, 0x15, 0x00, 0x11, 0x20, 0xa9, 0x33, 0x9a,
+	0xbc, 0x50, 0xa4, 0x66, 0xa2, 0x77, 0xc0, 0x6f, 0x30, 0x35, 0x04, 0x35, 0x21, 0x0d, 0x96, 0xde,
+	0x3d, 0xfe, 0x00, 0x21, 0x65, 0xcd, 0xa7, 0x26, 0xfe, 0xce, 0x79, 0xaa, 0x33, 0x65, 0xc1, 0x7f,
+	0x9b, 0xab, 0x96, 0xcd, 0xfe, 0xff, 0xff, 0xfe, 0x9d, 0x14, 0x3a, 0xa4, 0x76, 0xfe, 0x00, 0xc4,
+	0x7f, 0xa2, 0x87, 0x00, 0xfe, 0x7c, 0x31, 0x96, 0xed, 0x00, 0xfd, 0xfd, 0xfd, 0xdc, 0xa4, 0x56,
+	0xfe, 0xad, 0x96, 0x9d, 0xaa, 0xfe, 0x00, 0x03, 0xfe, 0x32, 0x09, 0x51, 0x7f, 0x9c, 0x9a, 0xac,
+	0x31, 0xfe, 0xff, 0xdf, 0x99, 0xbc, 0xfe, 0x73, 0xf0, 0xa5, 0x66, 0x55, 0x95, 0xdd, 0x9d, 0xaa,
+	0xc0, 0x25, 0xa8, 0x54, 0x19, 0x00, 0xcb, 0xa4, 0x66, 0xfe, 0x63, 0x6e, 0xfe, 0xbe, 0x18, 0xa6,
+	0x55, 0xa3, 0x76, 0x18, 0xc0, 0x55, 0x04, 0x35, 0x55, 0x66, 0x39, 0x66, 0x2d, 0x9d, 0xa9, 0xfe,
+	0x7c, 0x30, 0x3c, 0xad, 0x20, 0xa4, 0x75, 0x41, 0xc2, 0x3d, 0x35, 0x29, 0x56, 0x69, 0x12, 0x66,
+	0x3e, 0x51, 0x06, 0xc0, 0x12, 0x11, 0xc0, 0x98, 0xdc, 0x97, 0xcc, 0x00, 0xfd, 0xf6, 0x28, 0xab,
+	0x23, 0xa8, 0x34, 0x6e, 0x9b, 0xab, 0x08, 0x3e, 0x0d, 0x12, 0x0d, 0xc9, 0x29, 0x36, 0x00, 0xfe,
+	0x73, 0xcf, 0xfe, 0xce, 0x9a, 0x2d, 0x9a, 0xbb, 0x34, 0xa4, 0x66, 0x6e, 0xc0, 0x30, 0x6e, 0x6f,
+	0x7a, 0x30, 0x41, 0x1d, 0xfe, 0x63, 0x6e, 0x28, 0x00, 0xcc, 0xfe, 0x63, 0x8e, 0x09, 0x7f, 0x69,
+	0x18, 0x11, 0xa2, 0x78, 0x1d, 0x30, 0xa5, 0x55, 0x25, 0x7f, 0x98, 0xcc, 0x94, 0xde, 0xa3, 0x67,
+	0xc0, 0x9a, 0xdc, 0xfe, 0x94, 0xf4, 0xfe, 0x21, 0x04, 0x00, 0xfd, 0xfd, 0xfd, 0xdd, 0xfe, 0x73,
+	0xaf, 0x31, 0xfe, 0x42, 0x4a, 0x08, 0xa2, 0x76, 0x5a, 0xa2, 0x87, 0x0e, 0xfe, 0xce, 0x7a, 0xac,
+	0x21, 0xfe, 0x94, 0xd3, 0x9d, 0x9a, 0xa2, 0x77, 0x98, 0xcc, 0x02, 0x25, 0x02, 0xac, 0x32, 0xfe,
+	0x3a, 0x08, 0xfe, 0x00, 0x00, 0xca, 0xa9, 0x24, 0xfe, 0x84, 0x72, 0xfe, 0xce, 0x79, 0x1c, 0x04,
+	0x18, 0x55, 0x04, 0x35, 0x30, 0x26, 0x9d, 0xaa, 0x9d, 0x9a, 0x1c, 0x6e, 0xfe, 0x9c, 0xf4, 0xfe,
+	0x11, 0x67, 0x12, 0xa7, 0x64, 0x52, 0x02, 0xc1, 0x66, 0x56, 0x29, 0x56, 0x15, 0x12, 0x66, 0x51,
+	0x22, 0x9c, 0xab, 0x22, 0x35, 0xa3, 0x76, 0x9c, 0xba, 0x97, 0xcc, 0x00, 0xfd, 0xfc, 0xa9, 0x34,
+	0xaa, 0x33, 0x2a, 0x11, 0x15, 0x3e, 0x7a, 0x6f, 0x12, 0x0d, 0xc7, 0x12, 0x29, 0x94, 0xdf, 0x9b,
+	0xd9, 0xfe, 0x94, 0xb2, 0xb1, 0x00, 0x6e, 0x31, 0xa2, 0x77, 0x1c, 0x21, 0xc0, 0x30, 0x6e, 0x04,
+	0x35, 0x1c, 0x9d, 0x99, 0xfe, 0x84, 0x51, 0xfe, 0x21, 0x25, 0x00, 0xca, 0xa2, 0x68, 0xfe, 0xbd,
+	0xf7, 0xae, 0x11, 0x65, 0x6b, 0xc0, 0x1d, 0x11, 0xfe, 0xad, 0x96, 0xfe, 0xff, 0xff, 0xfe, 0xc6,
+	0x18, 0x1e, 0xa9, 0x53, 0xfe, 0x11, 0x25, 0x9d, 0x9a, 0xa2, 0x87, 0x00, 0x2a, 0xa9, 0x54, 0x00,
+	0xfd, 0xfd, 0xfd, 0xde, 0xac, 0x12, 0xfe, 0xc6, 0x59, 0x92, 0xff, 0xfe, 0x00, 0x24, 0x29, 0x15,
+	0x29, 0x95, 0xcf, 0x0c, 0xfe, 0xff, 0xff, 0x93, 0xff, 0xfe, 0x7c, 0x11, 0xa5, 0x65, 0x9d, 0x99,
+	0x93, 0xef, 0x6f, 0x11, 0x39, 0xa5, 0x65, 0x00, 0xc9, 0x15, 0xfe, 0xa5, 0x55, 0xab, 0x32, 0xa3,
+	0x67, 0x09, 0x6e, 0x62, 0x55, 0x30, 0x26, 0x51, 0x9c, 0xbb, 0x0d, 0xa2, 0x78, 0x95, 0xdd, 0x3d,
+	0x1f, 0x11, 0xc0, 0x02, 0xc0, 0x3d, 0xc0, 0x56, 0x65, 0x56, 0x55, 0x66, 0x66, 0x41, 0x9d, 0x99,
+	0x06, 0x0d, 0xa6, 0x55, 0x79, 0x99, 0xcc, 0x97, 0xcc, 0x00, 0xfd, 0xfd, 0xc2, 0xa4, 0x66, 0xaa,
+	0x23, 0x19, 0x6f, 0x35, 0x9b, 0xba, 0x3e, 0x0d, 0x12, 0x0d, 0xc7, 0xa2, 0x76, 0x29, 0x00, 0x27,
+	0xfe, 0xad, 0x75, 0xac, 0x23, 0x50, 0x9d, 0x9a, 0x0d, 0xa2, 0x77, 0xc0, 0x2d, 0x30, 0x6e, 0xc0,
+	0x21, 0x0d, 0x94, 0xef, 0x15, 0x00, 0xc9, 0x11, 0xfe, 0xe7, 0x5c, 0xa3, 0x77, 0x65, 0x18, 0xc0,
+	0xa2, 0x76, 0x96, 0xde, 0x56, 0xac, 0x21, 0xfe, 0x73, 0xf0, 0x97, 0xcd, 0x3d, 0xfe, 0x00, 0x63,
+	0xa4, 0x56, 0xa2, 0x87, 0x97, 0xeb, 0xfe, 0x8c, 0x92, 0xfe, 0x4a, 0x49, 0x00, 0xfd, 0xfd, 0xfd,
+	0xde, 0x6e, 0xfe, 0x94, 0xf3, 0xa9, 0x44, 0xfe, 0x19, 0x67, 0xa5, 0x65, 0xc2, 0x23, 0xfe, 0xe7,
+	0x3c, 0xa4, 0x66, 0xfe, 0x84, 0x52, 0xa2, 0x77, 0x6e, 0x95, 0xed, 0x9b, 0xab, 0xa2, 0x77, 0x9d,
+	0x9a, 0xad, 0x21, 0xfe, 0x31, 0xa6, 0x00, 0xc6, 0xa2, 0x67, 0x25, 0xfe, 0xbd, 0xf7, 0xa7, 0x45,
+	0x35, 0xa2, 0x77, 0xc0, 0x3a, 0x35, 0x26, 0x66, 0x9c, 0xaa, 0x6f, 0x28, 0x99, 0xcb, 0x01, 0x06,
+	0x02, 0x7f, 0x02, 0xc0, 0x66, 0xc0, 0x55, 0x56, 0x66, 0x12, 0x66, 0x55, 0x22, 0x06, 0x22, 0x26,
+	0xa3, 0x87, 0x9d, 0x99, 0x10, 0x00, 0xfd, 0xfd, 0xc8, 0xa9, 0x33, 0x38, 0x25, 0x9d, 0x9a, 0x12,
+	0x3e, 0x7a, 0x0d, 0x12, 0x0d, 0xc6, 0x21, 0x12, 0x00, 0x11, 0xfe, 0xbd, 0xf7, 0x28, 0x05, 0x61,
+	0x19, 0x7e, 0xc0, 0x2d, 0x35, 0xc0, 0x30, 0x19, 0x99, 0xbb, 0x25, 0xfe, 0x00, 0x41, 0x00, 0xc6,
+	0x07, 0xfe, 0xa5, 0x75, 0x1d, 0x65, 0x6b, 0x1d, 0x18, 0x7e, 0xfe, 0xb5, 0xb6, 0xb1, 0x00, 0x21,
+	0xfe, 0x32, 0x2a, 0xa8, 0x53, 0x92, 0xff, 0x9a, 0xac, 0xa2, 0x77, 0x9d, 0xa9, 0x01, 0xfe, 0x94,
+	0xd3, 0xfe, 0x08, 0x61, 0x00, 0xfd, 0xfd, 0xfd, 0xdf, 0xfe, 0x4a, 0x8a, 0xfe, 0xce, 0x9a, 0xfe,
+	0x7b, 0xf0, 0xfe, 0x01, 0x06, 0xa9, 0x62, 0x56, 0xa2, 0x77, 0xfe, 0x00, 0x24, 0x1c, 0xfe, 0xff,
+	0xff, 0xfe, 0xb5, 0xd7, 0x93, 0xef, 0x39, 0x9a, 0xbb, 0x94, 0xdf, 0x25, 0x51, 0xa6, 0x55, 0x7e,
+	0x00, 0xc5, 0xa5, 0x56, 0xfe, 0x73, 0xf0, 0xfe, 0xce, 0x59, 0xa5, 0x55, 0xa3, 0x77, 0x6e, 0x04,
+	0x55, 0x30, 0x21, 0x08, 0x55, 0x21, 0x9c, 0xab, 0xfe, 0x7c, 0x30, 0x06, 0xab, 0x42, 0xa4, 0x75,
+	0x42, 0x69, 0x66, 0x35, 0x29, 0x56, 0x1a, 0x56, 0x66, 0x51, 0x13, 0x06, 0x3e, 0x3d, 0xc0, 0x9a,
+	0xca, 0x97, 0xcd, 0x9c, 0xba, 0xfd, 0xfd, 0xcc, 0xa4, 0x66, 0xaa, 0x23, 0x11, 0xc0, 0x29, 0x01,
+	0x3e, 0x0d, 0x12, 0x0d, 0xc6, 0x29, 0x36, 0x00, 0xfe, 0x73, 0xaf, 0x34, 0xa5, 0x55, 0x9c, 0xaa,
+	0xc0, 0xa3, 0x77, 0x21, 0xc0, 0x30, 0x6e, 0x30, 0x1c, 0x34, 0xfe, 0x73, 0xf0, 0xfe, 0x10, 0xa3,
+	0x00, 0xc5, 0x29, 0x30, 0x1d, 0x65, 0x1d, 0x18, 0xa2, 0x76, 0x9a, 0xbb, 0x98, 0xbd, 0x31, 0xfe,
+	0x94, 0xd3, 0xfe, 0x42, 0x8b, 0x7e, 0xfe, 0x00, 0x83, 0xa3, 0x67, 0x7e, 0x00, 0x35, 0x9c, 0xb9,
+	0x00, 0xfd, 0xfd, 0xfd, 0xe0, 0x34, 0xfe, 0xad, 0xb6, 0x7f, 0xfe, 0x00, 0xc6, 0xac, 0x30, 0x51,
+	0x7e, 0x52, 0xa4, 0x55, 0x18, 0x55, 0xfe, 0x7c, 0x31, 0x39, 0x52, 0x94, 0xde, 0x50, 0x7f, 0x51,
+	0x09, 0xfe, 0x29, 0x65, 0x00, 0xc3, 0xab, 0x23, 0xfe, 0x94, 0xf3, 0xae, 0x21, 0xa3, 0x77, 0xa3,
+	0x66, 0xc0, 0x51, 0x30, 0x59, 0x0d, 0x51, 0xa3, 0x67, 0x0d, 0xfe, 0x94, 0xd3, 0x36, 0x12, 0xa7,
+	0x64, 0x0c, 0x02, 0x66, 0x56, 0x65, 0x21, 0x65, 0x56, 0x55, 0x51, 0x06, 0xa2, 0x87, 0x21, 0x02,
+	0x29, 0x97, 0xdc, 0x00, 0xfd, 0xfd, 0xd2, 0xa9, 0x33, 0xa8, 0x45, 0x11, 0x3d, 0x12, 0x3e, 0x7f,
+	0xc7, 0x12, 0x29, 0x95, 0xce, 0x00, 0xfe, 0x8c, 0x92, 0xfe, 0xd6, 0xba, 0x6f, 0x9d, 0xa9, 0x7f,
+	0xa2, 0x77, 0x6e, 0xc0, 0xa2, 0x77, 0xc0, 0x21, 0x0d, 0x92, 0xef, 0x2d, 0x00, 0xc4, 0xfe, 0x9d,
+	0x14, 0xfe, 0xf7, 0xbe, 0x65, 0x1d, 0xc0, 0x18, 0xa2, 0x77, 0x91, 0xff, 0x09, 0xc0, 0xfe, 0x42,
+	0x8b, 0xa5, 0x65, 0x01, 0x97, 0xce, 0xa3, 0x66, 0x7a, 0x07, 0xfe, 0x94, 0xf4, 0xfe, 0x21, 0x45,
+	0x00, 0xfd, 0xfd, 0xfd, 0xe1, 0xfe, 0x6b, 0x6e, 0xfe, 0xd6, 0xba, 0xfe, 0x6b, 0x8e, 0xfe, 0x19,
+	0x88, 0xa5, 0x75, 0x59, 0xa2, 0x87, 0xfe, 0x00, 0x04, 0xfe, 0xb5, 0xd7, 0xfe, 0xff, 0xff, 0xfe,
+	0xad, 0x76, 0x98, 0xbc, 0xa3, 0x77, 0x99, 0xbb, 0x96, 0xdd, 0xa2, 0x77, 0x11, 0xa7, 0x44, 0x66,
+	0xfe, 0x00, 0x00, 0xc2, 0xfe, 0x42, 0x49, 0xfe, 0xb5, 0xb6, 0xa9, 0x44, 0xa3, 0x66, 0xa2, 0x77,
+	0x04, 0x51, 0x59, 0x1c, 0x9d, 0x99, 0xa2, 0x77, 0x19, 0x95, 0xee, 0xfe, 0x42, 0x6a, 0x98, 0xad,
+	0x11, 0xc0, 0x3d, 0xc0, 0x56, 0x29, 0x56, 0x55, 0x66, 0x51, 0x9d, 0x9a, 0x06, 0x39, 0x35, 0x3d,
+	0x9a, 0xca, 0x28, 0x00, 0xfd, 0xfd, 0xd6, 0x28, 0xa9, 0x34, 0xa7, 0x44, 0x5b, 0x9d, 0x99, 0x01,
+	0xc0, 0x0d, 0x12, 0x0d, 0xc4, 0x1a, 0x21, 0x00, 0x36, 0xfe, 0xa5, 0x35, 0x19, 0x65, 0x51, 0x0d,
+	0xa2, 0x77, 0xc0, 0x7f, 0x6e, 0x30, 0x51, 0x97, 0xcc, 0x31, 0x00, 0xc2, 0xfe, 0x31, 0xe8, 0xfe,
+	0xdf, 0x1b, 0xa5, 0x66, 0x18, 0x1d, 0xc0, 0x7e, 0x9c, 0xaa, 0x95, 0xde, 0xb0, 0x00, 0xfe, 0xad,
+	0x75, 0xfe, 0x3a, 0x4a, 0xa5, 0x65, 0xfe, 0x00, 0x84, 0xa2, 0x76, 0xa2, 0x77, 0x00, 0xfe, 0x5b,
+	0x0d, 0xa9, 0x43, 0x00, 0xfd, 0xfd, 0xfd, 0xe2, 0xaa, 0x23, 0xfe, 0xbe, 0x18, 0x9c, 0xaa, 0x3c,
+	0xfe, 0x42, 0x6a, 0x51, 0x6f, 0x12, 0x34, 0x2c, 0x9b, 0xaa, 0xfe, 0x7c, 0x31, 0xa5, 0x66, 0x50,
+	0x93, 0xef, 0x66, 0x25, 0x51, 0x09, 0xfe, 0x29, 0x65, 0x95, 0xee, 0xa3, 0x66, 0xfe, 0x63, 0x6e,
+	0xfe, 0xc6, 0x39, 0xa6, 0x54, 0xa3, 0x67, 0x7a, 0x35, 0x66, 0x21, 0x08, 0x5a, 0xa2, 0x77, 0x99,
+	0xcb, 0xfe, 0x63, 0x4d, 0xfe, 0x01, 0x06, 0x02, 0x7f, 0x02, 0x3d, 0x56, 0x55, 0x1a, 0x56, 0x62,
+	0x2a, 0x9c, 0xab, 0xa2, 0x67, 0x12, 0x3d, 0x9d, 0xa9, 0x98, 0xcc, 0x00, 0xfd, 0xfd, 0xdb, 0x6e,
+	0xa8, 0x44, 0xa8, 0x35, 0xa4, 0x56, 0x51, 0x12, 0x51, 0x7f, 0xc6, 0xa2, 0x77, 0x12, 0x00, 0x11,
+	0xfe, 0xb5, 0xb7, 0x1c, 0x41, 0x39, 0x19, 0x7e, 0xc0, 0x30, 0xc0, 0x1c, 0x9c, 0x9a, 0xfe, 0x63,
+	0x6e, 0xfe, 0x00, 0x41, 0x00, 0xc0, 0xfe, 0x9d, 0x14, 0xfe, 0xf7, 0xbe, 0x18, 0x1d, 0xc0, 0x18,
+	0xa3, 0x66, 0x92, 0xff, 0xa8, 0x45, 0x1d, 0xfe, 0x53, 0x0c, 0x7f, 0x12, 0x94, 0xff, 0xa3, 0x66,
+	0xa2, 0x77, 0x00, 0xfe, 0x94, 0xd3, 0xfe, 0x42, 0x08, 0x00, 0xfd, 0xfd, 0xfd, 0xe3, 0xfe, 0x7c,
+	0x31, 0xfe, 0xd6, 0xba, 0x01, 0x12, 0x35, 0x66, 0xa2, 0x76, 0x37, 0x25, 0x31, 0xfe, 0xa5, 0x55,
+	0x9a, 0xbb, 0xa3, 0x67, 0x97, 0xcc, 0x97, 0xdd, 0xa2, 0x77, 0x16, 0xa6, 0x55, 0x7a, 0xfe, 0x18,
+	0xe4, 0xfe, 0x84, 0x72, 0x0d, 0xa3, 0x67, 0xa2, 0x87, 0x59, 0x62, 0x55, 0x0d, 0x56, 0x19, 0x2c,
+	0xfe, 0x7c, 0x10, 0x17, 0x35, 0x16, 0x02, 0x66, 0x29, 0x56, 0x65, 0x56, 0x3e, 0x22, 0x06, 0xa4,
+	0x76, 0x29, 0x7f, 0x9a, 0xba, 0x28, 0x00, 0xfd, 0xfd, 0xe0, 0x28, 0xa9, 0x23, 0x3d, 0x02, 0x21,
+	0x9d, 0xa9, 0xc0, 0x0d, 0x6e, 0x0d, 0xc2, 0x12, 0x29, 0x36, 0x00, 0xfe, 0x6b, 0xae, 0xfe, 0xc6,
+	0x38, 0x19, 0x05, 0x7a, 0x1c, 0x6e, 0x2d, 0x30, 0x21, 0x51, 0xfe, 0x8c, 0x72, 0xfe, 0x18, 0xe4,
+	0xa7, 0x35, 0xfe, 0xe7, 0x1b, 0xa5, 0x56, 0x18, 0x1d, 0xc0, 0x7a, 0x41, 0x93, 0xef, 0xfe, 0xff,
+	0xff, 0x09, 0x32, 0xa5, 0x75, 0xfe, 0x00, 0x84, 0xa2, 0x76, 0x6f, 0x99, 0xec, 0x38, 0xfe, 0x94,
+	0xb3, 0xfe, 0x00, 0x20, 0x00, 0xfd, 0xfd, 0xfd, 0xe3, 0xae, 0x01, 0xfe, 0xc6, 0x79, 0x99, 0xcc,
+	0xfe, 0x00, 0xe6, 0x02, 0x52, 0x7e, 0x12, 0xac, 0x32, 0x31, 0x2d, 0xfe, 0x84, 0x51, 0xa5, 0x66,
+	0x9d, 0x99, 0xfe, 0x52, 0xcc, 0x6e, 0xc1, 0x26, 0xad, 0x32, 0x1c, 0xa3, 0x66, 0x6e, 0x35, 0x55,
+	0x61, 0x42, 0x7e, 0x51, 0x34, 0x0a, 0x12, 0x16, 0x02, 0x52, 0x65, 0x56, 0x12, 0x66, 0x41, 0x9c,
+	0xaa, 0x6b, 0x0d, 0x35, 0x60, 0x98, 0xdc, 0x99, 0xbb, 0x00, 0xfd, 0xfd, 0xe4, 0x05, 0xa7, 0x45,
+	0x1d, 0x02, 0x35, 0x12, 0x01, 0x6f, 0xc4, 0x12, 0x29, 0x95, 0xcf, 0x9a, 0xeb, 0xfe, 0x8c, 0x71,
+	0x39, 0xa3, 0x67, 0x51, 0x7e, 0x1c, 0x6e, 0x2d, 0xc0, 0x21, 0xfe, 0x9d, 0x14, 0xc0, 0xfe, 0xf7,
+	0xbe, 0x18, 0x1d, 0xc1, 0x31, 0x93, 0xff, 0xa7, 0x44, 0xa5, 0x66, 0xfe, 0x5b, 0x4d, 0x52, 0x97,
+	0xdc, 0x24, 0xa3, 0x66, 0xa2, 0x77, 0x00, 0xfe, 0x8c, 0x92, 0x14, 0x00, 0xfd, 0xfd, 0xfd, 0xe4,
+	0xa2, 0x67, 0x25, 0xfe, 0xd6, 0xba, 0xfe, 0x63, 0x4d, 0x96, 0xce, 0xa3, 0x76, 0x56, 0xa2, 0x77,
+	0xfe, 0x00, 0xe6, 0xfe, 0xc6, 0x59, 0xad, 0x21, 0xfe, 0xa5, 0x35, 0x9c, 0x9a, 0x08, 0x96, 0xcd,
+	0x98, 0xcc, 0xa3, 0x77, 0x3d, 0xfe, 0xa5, 0x34, 0xaf, 0x11, 0x6e, 0xc0, 0x26, 0x66, 0x51, 0xc0,
+	0x05, 0x96, 0xdd, 0x02, 0x36, 0x11, 0x09, 0x51, 0x29, 0x56, 0x12, 0x51, 0x9d, 0xaa, 0x0b, 0xa3,
+	0x86, 0x21, 0xa2, 0x76, 0x9a, 0xcb, 0x28, 0x00, 0xfd, 0xfd, 0xea, 0x28, 0x35, 0x38, 0x5e, 0x21,
+	0x51, 0x65, 0x0d, 0xc3, 0xa2, 0x76, 0x21, 0x0e, 0x36, 0xfe, 0x9d, 0x14, 0xac, 0x32, 0x6e, 0x05,
+	0x0d, 0xa2, 0x77, 0xc0, 0x30, 0x19, 0x30, 0x1d, 0xc2, 0x7e, 0x9d, 0x9a, 0x93, 0xef, 0xfe, 0xff,
+	0xff, 0xfe, 0xbd, 0xd7, 0xfe, 0x32, 0x2a, 0xa6, 0x64, 0xfe, 0x00, 0x83, 0xa2, 0x67, 0x7a, 0x9c,
+	0xbb, 0x01, 0xfe, 0x94, 0xf4, 0xfe, 0x08, 0x61, 0x00, 0xfd, 0xfd, 0xfd, 0xe5, 0xfe, 0x42, 0x29,
+	0xfe, 0xce, 0x9a, 0x97, 0xdc, 0xfe, 0x01, 0x27, 0xab, 0x51, 0x65, 0x09, 0x9b, 0xab, 0xad, 0x30,
+	0x31, 0x99, 0xbc, 0xfe, 0x84, 0x52, 0xa6, 0x54, 0x9c, 0xaa, 0x93, 0xef, 0x6e, 0x11, 0x05, 0x04,
+	0x30, 0x21, 0x51, 0xc1, 0x98, 0xcc, 0xfe, 0x5b, 0x2d, 0xfe, 0x09, 0x46, 0x02, 0x7b, 0x2e, 0x52,
+	0x65, 0x56, 0x51, 0x9d, 0x8a, 0x65, 0xa5, 0x76, 0xa4, 0x65, 0x61, 0x99, 0xbb, 0x99, 0xcb, 0x00,
+	0xfd, 0xfd, 0xef, 0x0d, 0x15, 0xa4, 0x66, 0x29, 0x12, 0x01, 0x6f, 0xc3, 0x21, 0x12, 0x00, 0x11,
+	0xfe, 0xad, 0x96, 0xa9, 0x43, 0xc0, 0x66, 0xa2, 0x67, 0x7e, 0xc0, 0x30, 0x1d, 0xc2, 0x31, 0x93,
+	0xff, 0xa7, 0x44, 0xa5, 0x66, 0xfe, 0x5b, 0x2d, 0x56, 0x96, 0xdd, 0x24, 0x3a, 0xa2, 0x87, 0x00,
+	0xfe, 0x84, 0x51, 0x97, 0xdc, 0x00, 0xfd, 0xfd, 0xfd, 0xe6, 0xa3, 0x66, 0xfe, 0x94, 0xd3, 0xaf,
+	0x10, 0xfe, 0x63, 0x6e, 0x96, 0xcd, 0x09, 0x3d, 0xa2, 0x77, 0xfe, 0x01, 0x06, 0xfe, 0xc6, 0x39,
+	0xae, 0x10, 0xfe, 0xa5, 0x75, 0x9a, 0xbc, 0xa3, 0x76, 0x96, 0xcd, 0x09, 0xa8, 0x53, 0x21, 0x7e,
+	0x41, 0x66, 0xc0, 0x9b, 0xab, 0xfe, 0x7b, 0xf0, 0xfe, 0x11, 0x67, 0xa7, 0x64, 0x11, 0x9c, 0xaa,
+	0x56, 0x55, 0x52, 0x50, 0x0e, 0x22, 0x21, 0x29, 0x9b, 0xba, 0x28, 0x00, 0xfd, 0xfd, 0xf4, 0xa4,
+	0x56, 0xa7, 0x55, 0x29, 0x6f, 0x21, 0x51, 0x01, 0x0d, 0xc2, 0x29, 0x36, 0x00, 0xfe, 0x6b, 0x6e,
+	0xfe, 0xbd, 0xf7, 0xa6, 0x56, 0x08, 0x6e, 0x7f, 0x6e, 0xa5, 0x66, 0x6e, 0xc0, 0x7e, 0x9d, 0xaa,
+	0x11, 0xb0, 0x00, 0xfe, 0xbd, 0xd7, 0x32, 0xa5, 0x75, 0xfe, 0x00, 0x43, 0x3a, 0xc0, 0x61, 0xa5,
+	0x66, 0xfe, 0x9d, 0x14, 0xfe, 0x10, 0xa2, 0x00, 0xfd, 0xfd, 0xfd, 0xe7, 0x3d, 0xfe, 0xce, 0x9a,
+	0x99, 0xcb, 0x33, 0xa9, 0x63, 0x02, 0x09, 0x9d, 0xa9, 0xaa, 0x33, 0x31, 0x9a, 0xbb, 0xfe, 0x84,
+	0x72, 0xa5, 0x66, 0x9d, 0x99, 0x09, 0xac, 0x31, 0x1c, 0x55, 0xc0, 0x2c, 0x93, 0xee, 0x12, 0xc0,
+	0xa5, 0x76, 0x40, 0x51, 0x52, 0x51, 0x9d, 0x9a, 0x0e, 0x3e, 0x29, 0x51, 0x99, 0xcb, 0x99, 0xcb,
+	0x00, 0xfd, 0xfd, 0xf8, 0x05, 0xa6, 0x56, 0xa7, 0x45, 0xa4, 0x56, 0x55, 0x12, 0x65, 0x6b, 0xc1,
+	0x12, 0x29, 0x96, 0xbe, 0x99, 0xfd, 0xfe, 0x84, 0x31, 0xfe, 0xc6, 0x59, 0xa4, 0x66, 0x61, 0x6e,
+	0xa7, 0x54, 0x6f, 0xc0, 0xa2, 0x77, 0x34, 0xa8, 0x34, 0xa4, 0x66, 0xfe, 0x5b, 0x2d, 0x56, 0x95,
+	0xed, 0x24, 0x3a, 0xa2, 0x87, 0x00, 0xfe, 0x7c, 0x31, 0x99, 0xcb, 0x00, 0xfd, 0xfd, 0xfd, 0xe8,
+	0xa3, 0x67, 0xfe, 0x94, 0xd3, 0x19, 0xfe, 0x73, 0xd0, 0x92, 0xef, 0xa5, 0x65, 0x56, 0xa2, 0x77,
+	0x23, 0xfe, 0xbd, 0xf8, 0xfe, 0xff, 0xff, 0xfe, 0xad, 0x96, 0x99, 0xbc, 0xa4, 0x66, 0x93, 0xff,
+	0x3d, 0xfe, 0xd6, 0xdb, 0x9d, 0xa9, 0x95, 0xde, 0xfe, 0x42, 0x6a, 0x9a, 0x9b, 0x3d, 0x56, 0x9d,
+	0xa9, 0x56, 0x9d, 0x9a, 0x0e, 0x22, 0x12, 0xa1, 0x98, 0x9c, 0xa9, 0x28, 0x00, 0xfd, 0xfd, 0xfd,
+	0xc0, 0xa4, 0x56, 0xa7, 0x55, 0xa6, 0x45, 0x6f, 0x21, 0x0d, 0xc2, 0x1a, 0x21, 0xfe, 0x00, 0x03,
+	0x36, 0xfe, 0x9c, 0xf3, 0xad, 0x12, 0x7e, 0xa6, 0x55, 0xa2, 0x87, 0x6e, 0x09, 0x95, 0xde, 0xaf,
+	0x10, 0xfe, 0xb5, 0x96, 0xfe, 0x3a, 0x6a, 0x16, 0xfe, 0x00, 0x23, 0xa5, 0x44, 0x5a, 0x9d, 0xba,
+	0xa6, 0x45, 0xfe, 0x9d, 0x14, 0xfe, 0x10, 0xa3, 0x00, 0xfd, 0xfd, 0xfd, 0xe9, 0xfe, 0x42, 0x69,
+	0x39, 0x9d, 0xaa, 0xfe, 0x2a, 0x09, 0x11, 0x56, 0x11, 0x51, 0xa5, 0x56, 0xfe, 0xf7, 0xbe, 0x51,
+	0xfe, 0x8c, 0x92, 0xa5, 0x56, 0x9c, 0xaa, 0x9a, 0xbb, 0xac, 0x32, 0xfe, 0x5b, 0x0d, 0x92, 0xcf,
+	0xa8, 0x64, 0xc0, 0x12, 0x3e, 0x22, 0x0e, 0xa4, 0x76, 0x21, 0x65, 0x99, 0xcb, 0x99, 0xcb, 0x00,
+	0xfd, 0xfd, 0xfd, 0xc4, 0x05, 0xa6, 0x56, 0x10, 0x35, 0x26, 0x12, 0x61, 0x6f, 0x12, 0xa3, 0x87,
+	0x29, 0x00, 0xa6, 0x27, 0xfe, 0xad, 0x96, 0x1d, 0xc0, 0xa2, 0x77, 0x92, 0xff, 0xab, 0x23, 0x7a,
+	0xfe, 0x4a, 0xcc, 0xa3, 0x76, 0xfe, 0x19, 0x46, 0x9a, 0xbb, 0x6f, 0xa3, 0x76, 0x00, 0xfe, 0x7c,
+	0x31, 0x99, 0xcb, 0x00, 0xfd, 0xfd, 0xfd, 0xea, 0xa3, 0x66, 0xfe, 0x8c, 0x92, 0xfe, 0xde, 0xdb,
+	0xfe, 0x8c, 0xb2, 0xfe, 0x29, 0xe9, 0xa7, 0x64, 0x55, 0xa2, 0x77, 0x96, 0xbe, 0xfe, 0xad, 0x96,
+	0x31, 0xfe, 0xbd, 0xf8, 0x96, 0xcd, 0xa5, 0x65, 0x96, 0xdd, 0x1e, 0xa3, 0x76, 0x61, 0x3e, 0x51,
+	0x9b, 0xac, 0xa3, 0x66, 0x0d, 0xa2, 0x76, 0x9c, 0xba, 0x28, 0x00, 0xfd, 0xfd, 0xfd, 0xca, 0xa4,
+	0x56, 0xa7, 0x55, 0x29, 0x6f, 0x1a, 0x3e, 0x00, 0xc0, 0xfe, 0x52, 0xec, 0x21, 0xaf, 0x10, 0xa4,
+	0x76, 0x6f, 0x35, 0x99, 0xbc, 0xad, 0x21, 0xfe, 0x9d, 0x14, 0xfe, 0x42, 0x8b, 0x69, 0xfe, 0x00,
+	0x02, 0xa6, 0x34, 0x5a, 0x9c, 0xcb, 0x2a, 0x0d, 0x2d, 0x00, 0xfd, 0xfd, 0xfd, 0xeb, 0xfe, 0x42,
+	0x29, 0xfe, 0xc6, 0x39, 0xa2, 0x76, 0x25, 0x11, 0x1d, 0x11, 0xc0, 0x52, 0xfe, 0xef, 0x5d, 0xa4,
+	0x66, 0xfe, 0x94, 0xd3, 0xa3, 0x67, 0x61, 0x93, 0xef, 0x55, 0x25, 0x09, 0x9c, 0xaa, 0x11, 0x9b,
+	0xbb, 0x98, 0xcb, 0x05, 0x00, 0xfd, 0xfd, 0xfd, 0xce, 0x05, 0xa6, 0x56, 0xa8, 0x34, 0x02, 0xfe,
+	0x9d, 0x14, 0xaa, 0x43, 0xa9, 0x33, 0x31, 0x65, 0x56, 0x25, 0xfe, 0xbe, 0x18, 0x2c, 0x35, 0xfe,
+	0x3a, 0x6a, 0xa5, 0x76, 0xfe, 0x00, 0xc4, 0x62, 0x6e, 0xa3, 0x76, 0x00, 0xfe, 0x84, 0x72, 0x96,
+	0xec, 0x00, 0xfd, 0xfd, 0xfd, 0xec, 0xa2, 0x67, 0xfe, 0x84, 0x51, 0x1c, 0x95, 0xdd, 0x1e, 0xa7,
+	0x64, 0x56, 0x25, 0x21, 0xfe, 0x94, 0xd3, 0x31, 0x95, 0xee, 0xfe, 0x8c, 0xb3, 0xa6, 0x55, 0x98,
+	0xcc, 0x25, 0xa2, 0x77, 0xc0, 0x56, 0xa8, 0x54, 0x94, 0xed, 0x00, 0xfd, 0xfd, 0xfd, 0xd2, 0xa5,
+	0x37, 0xfe, 0xc6, 0x18, 0x2c, 0x6e, 0x65, 0x56, 0xc0, 0x31, 0x1c, 0x56, 0x31, 0x11, 0x94, 0xdf,
+	0x24, 0x0e, 0x3a, 0x3d, 0x0e, 0x15, 0xfe, 0x9c, 0xf4, 0xfe, 0x08, 0x61, 0x00, 0xfd, 0xfd, 0xfd,
+	0xed, 0xae, 0x01, 0xfe, 0xb5, 0xd7, 0xa8, 0x44, 0xfe, 0x7c, 0x10, 0x93, 0xef, 0xa4, 0x66, 0x1d,
+	0x25, 0x1e, 0x14, 0x31, 0xfe, 0xa5, 0x55, 0x0d, 0x21, 0xfe, 0x6b, 0x8f, 0x9c, 0x99, 0x39, 0xc0,
+	0x34, 0x11, 0xfe, 0x21, 0x25, 0x00, 0xfd, 0xfd, 0xfd, 0xd0, 0x6f, 0xfe, 0x84, 0x71, 0xfe, 0xf7,
+	0x9e, 0x6e, 0xc2, 0x7e, 0x1d, 0x93, 0xef, 0x31, 0x94, 0xee, 0x32, 0xa5, 0x75, 0xfe, 0x00, 0x22,
+	0x35, 0x30, 0xa4, 0x65, 0x00, 0xfe, 0x8c, 0xb3, 0xfe, 0x52, 0xab, 0x00, 0xfd, 0xfd, 0xfd, 0xef,
+	0xfe, 0x73, 0xcf, 0xfe, 0xd6, 0xba, 0x9c, 0xab, 0xfe, 0x4a, 0xab, 0x25, 0xc1, 0x9d, 0x9a, 0x29,
+	0xfe, 0xff, 0xff, 0x9b, 0xab, 0xfe, 0x8c, 0xb3, 0x2d, 0x9b, 0xba, 0x2a, 0x7f, 0xc0, 0x2a, 0xa4,
+	0x77, 0x7e, 0xfe, 0x00, 0x20, 0x00, 0xfd, 0xfd, 0xfd, 0xce, 0x05, 0x2e, 0xfe, 0xe7, 0x1c, 0xa6,
+	0x54, 0x56, 0xc0, 0x7a, 0x1d, 0xa2, 0x77, 0x94, 0xee, 0xa7, 0x55, 0xa4, 0x66, 0xfe, 0x63, 0x4e,
+	0x41, 0x93, 0xfe, 0x1f, 0x35, 0x7e, 0x00, 0x11, 0xb0, 0x10, 0x00, 0xfd, 0xfd, 0xfd, 0xf0, 0xaa,
+	0x23, 0xfe, 0xa5, 0x76, 0xab, 0x42, 0x94, 0xde, 0xfe, 0x3a, 0x4a, 0xa6, 0x65, 0x55, 0xa2, 0x77,
+	0x1e, 0xfe, 0xb5, 0xd7, 0xfe, 0xff, 0xff, 0xfe, 0xbe, 0x18, 0x97, 0xcd, 0xa4, 0x76, 0x95, 0xde,
+	0x25, 0x39, 0xc0, 0x2a, 0x04, 0x95, 0xdc, 0x00, 0xfd, 0xfd, 0xfd, 0xce, 0xa4, 0x47, 0x1d, 0xae,
+	0x20, 0x56, 0xc2, 0x31, 0x9b, 0xba, 0x98, 0xcd, 0x31, 0xfe, 0xa5, 0x75, 0xfe, 0x42, 0x8b, 0x02,
+	0x0e, 0x3a, 0x62, 0xa3, 0x76, 0x00, 0xfe, 0x9d, 0x14, 0xfe, 0x39, 0xe8, 0x00, 0xfd, 0xfd, 0xfd,
+	0xf1, 0x39, 0xfe, 0xc6, 0x59, 0xa3, 0x76, 0xfe, 0x7c, 0x10, 0x95, 0xce, 0xa3, 0x87, 0x2a, 0xc0,
+	0x52, 0xfe, 0xef, 0x5d, 0xa5, 0x55, 0xfe, 0x9d, 0x14, 0x21, 0x66, 0x92, 0xef, 0x39, 0xc2, 0xa9,
+	0x33, 0xfe, 0x29, 0x45, 0x00, 0xfd, 0xfd, 0xfd, 0xcc, 0x07, 0xfe, 0x8c, 0x72, 0xfe, 0xf7, 0xbe,
+	0xc2, 0x7a, 0x25, 0xc0, 0xfe, 0xbe, 0x18, 0x31, 0x99, 0xcc, 0xfe, 0x3a, 0x8b, 0x2a, 0x29, 0x6b,
+	0xc0, 0x0c, 0x00, 0xfe, 0x6b, 0x8e, 0xa5, 0x66, 0x00, 0xfd, 0xfd, 0xfd, 0xf2, 0xa5, 0x55, 0xfe,
+	0x94, 0xd3, 0xaf, 0x10, 0x9d, 0x9a, 0xfe, 0x53, 0x0d, 0x2a, 0x34, 0x6e, 0x09, 0xaf, 0x20, 0xfe,
+	0xff, 0xff, 0x98, 0xcc, 0xfe, 0x94, 0xd3, 0xa6, 0x55, 0x99, 0xcc, 0x2a, 0xa2, 0x77, 0xc0, 0x66,
+	0xa3, 0x66, 0xa3, 0x77, 0xfe, 0x08, 0x41, 0x00, 0xfd, 0xfd, 0xfd, 0xca, 0x6e, 0x11, 0xfe, 0xe7,
+	0x3c, 0x25, 0x56, 0xc0, 0x7a, 0x1d, 0x31, 0x0d, 0xa3, 0x77, 0x31, 0xfe, 0x7b, 0xf0, 0x98, 0xac,
+	0x96, 0xed, 0x13, 0xa4, 0x46, 0xc0, 0x61, 0x6f, 0xfe, 0x9d, 0x35, 0xfe, 0x21, 0x04, 0x00, 0xfd,
+	0xfd, 0xfd, 0xf3, 0xfe, 0x42, 0x49, 0xfe, 0xb5, 0xf7, 0xa7, 0x65, 0x96, 0xcd, 0x09, 0x39, 0x66,
+	0x3e, 0x98, 0xcd, 0xfe, 0xc6, 0x38, 0xae, 0x11, 0xfe, 0xbd, 0xf7, 0x99, 0xbd, 0xa4, 0x65, 0x3d,
+	0x2a, 0xa2, 0x87, 0x3e, 0x34, 0xa7, 0x44, 0x99, 0xcb, 0x00, 0xfd, 0xfd, 0xfd, 0xca, 0xa8, 0x15,
+	0xfe, 0xce, 0x79, 0xab, 0x32, 0x1d, 0xc0, 0x20, 0x1d, 0x2c, 0x9d, 0x99, 0x97, 0xcd, 0xad, 0x21,
+	0xfe, 0xb5, 0xd7, 0xfe, 0x3a, 0x6a, 0xa1, 0x98, 0x07, 0xa5, 0x36, 0x29, 0xa4, 0x66, 0x00, 0xfe,
+	0x84, 0x72, 0x01, 0x00, 0xfd, 0xfd, 0xfd, 0xf4, 0x05, 0xfe, 0x73, 0xf0, 0x39, 0x0d, 0xfe, 0x8c,
+	0x92, 0xfe, 0x4a, 0xab, 0x01, 0x56, 0xc0, 0x56, 0xfe, 0xef, 0x7d, 0x2c, 0xfe, 0x9d, 0x14, 0xa3,
+	0x77, 0x55, 0xfe, 0x63, 0x6e, 0x39, 0x01, 0xc0, 0x39, 0xa9, 0x33, 0xfe, 0x3a, 0x08, 0x00, 0xfd,
+	0xfd, 0xfd, 0xc8, 0x13, 0x21, 0x20, 0x5a, 0xc0, 0x20, 0x6e, 0xc1, 0x93, 0xef, 0xae, 0x11, 0x9a,
+	0xbb, 0xfe, 0x42, 0xab, 0xa2, 0x87, 0x24, 0x6f, 0xc0, 0xa2, 0x76, 0x00, 0xfe, 0x4a, 0x8a, 0xfe,
+	0x94, 0xf3, 0xfe, 0x00, 0x20, 0x00, 0xfd, 0xfd, 0xfd, 0xf5, 0xaa, 0x23, 0xfe, 0xa5, 0x55, 0xab,
+	0x32, 0x51, 0xfe, 0x73, 0xcf, 0x2a, 0x01, 0x08, 0x9c, 0x9a, 0xae, 0x20, 0x31, 0x99, 0xbc, 0xfe,
+	0x94, 0xf4, 0xa6, 0x65, 0x99, 0xbb, 0xfe, 0x53, 0x0d, 0x01, 0xc0, 0x5a, 0x08, 0xa7, 0x44, 0x10,
+	0x00, 0xfd, 0xfd, 0xfd, 0xc6, 0x6f, 0xfe, 0x73, 0xf0, 0xfe, 0xf7, 0x7d, 0xa3, 0x66, 0x56, 0x20,
+	0x25, 0x1d, 0xa2, 0x77, 0x0d, 0xa4, 0x66, 0x31, 0xfe, 0x7c, 0x10, 0x96, 0xce, 0x96, 0xed, 0x13,
+	0x30, 0x69, 0xa2, 0x77, 0x00, 0x19, 0xfe, 0x39, 0xe7, 0x00, 0xfd, 0xfd, 0xfd, 0xf7, 0xfe, 0x52,
+	0xcb, 0xfe, 0xbe, 0x18, 0x0d, 0x9a, 0xbc, 0xfe, 0x5b, 0x2d, 0x01, 0xc0, 0x6f, 0x99, 0xbc, 0x1d,
+	0x31, 0xfe, 0xc6, 0x18, 0x99, 0xac, 0x04, 0x95, 0xdd, 0x96, 0xce, 0x0d, 0x01, 0x3e, 0xa3, 0x77,
+	0xa2, 0x77, 0xfe, 0x08, 0x41, 0x00, 0xfd, 0xfd, 0xfd, 0xc4, 0x6e, 0xfe, 0x42, 0x6a, 0xfe, 0xe7,
+	0x1c, 0x25, 0x56, 0x7a, 0x25, 0x20, 0xa2, 0x67, 0x9b, 0xba, 0x99, 0xbc, 0x31, 0xfe, 0xad, 0x96,
+	0x3a, 0x7a, 0x07, 0xa5, 0x36, 0x24, 0xa4, 0x66, 0x00, 0xfe, 0x7c, 0x10, 0x55, 0x00, 0xfd, 0xfd,
+	0xfd, 0xf8, 0x14, 0x11, 0xb0, 0x10, 0xa3, 0x66, 0x96, 0xdd, 0xfe, 0x52, 0xec, 0xa4, 0x66, 0x08,
+	0xc0, 0x2a, 0xfe, 0xe7, 0x3c, 0x31, 0x26, 0x7f, 0xc0, 0x21, 0x9c, 0xaa, 0x0d, 0xc0, 0x39, 0xa7,
+	0x44, 0x01, 0x00, 0xfd, 0xfd, 0xfd, 0xc4, 0xaa, 0x04, 0xfe, 0xce, 0x79, 0xab, 0x32, 0x1d, 0x20,
+	0x25, 0xc1, 0x1d, 0x94, 0xee, 0x31, 0x98, 0xcc, 0x09, 0xa2, 0x87, 0xfe, 0x00, 0x02, 0xa4, 0x46,
+	0x69, 0x7f, 0x00, 0x1a, 0xfe, 0x9d, 0x34, 0x28, 0x00, 0xfd, 0xfd, 0xfd, 0xf9, 0xab, 0x23, 0xfe,
+	0xa5, 0x76, 0x39, 0x7f, 0x92, 0xef, 0x2a, 0x0d, 0xc0, 0x51, 0xa7, 0x55, 0x31, 0x9c, 0xaa, 0xfe,
+	0x9d, 0x14, 0xa5, 0x66, 0x9c, 0xaa, 0x3e, 0x7b, 0x6e, 0xc0, 0x39, 0xa8, 0x44, 0x93, 0xfe, 0x00,
+	0xfd, 0xfd, 0xfd, 0xc2, 0x24, 0xfe, 0xb5, 0xb6, 0xfe, 0xff, 0xde, 0x1d, 0x7a, 0x25, 0xc1, 0x31,
+	0x94, 0xee, 0xa9, 0x34, 0x2c, 0xfe, 0x63, 0x8e, 0x9b, 0xbb, 0xfe, 0x11, 0x05, 0x1f, 0x29, 0xc0,
+	0xa2, 0x77, 0x00, 0xfe, 0x9d, 0x15, 0xfe, 0x42, 0x49, 0x00, 0xfd, 0xfd, 0xfd, 0xfb, 0xfe, 0x52,
+	0xcb, 0x18, 0xa5, 0x55, 0x39, 0xfe, 0x84, 0x31, 0x98, 0xbc, 0x12, 0x7b, 0x25, 0xfe, 0xa5, 0x55,
+	0xfe, 0xff, 0xff, 0x96, 0xdd, 0x14, 0xa6, 0x54, 0x97, 0xdd, 0x39, 0xa2, 0x77, 0xc1, 0x08, 0xa8,
+	0x43, 0xfe, 0x31, 0xc7, 0x00, 0xfd, 0xfd, 0xfd, 0xc0, 0x13, 0xfe, 0x94, 0xd3, 0x1d, 0x20, 0x1d,
+	0x7e, 0xc0, 0x20, 0x31, 0x98, 0xcc, 0xc0, 0x31, 0x39, 0xfe, 0x42, 0x8b, 0x9b, 0xba, 0x0e, 0xa5,
+	0x35, 0x24, 0xa4, 0x66, 0x00, 0xfe, 0x7c, 0x10, 0x66, 0x00, 0xfd, 0xfd, 0xfd, 0xfc, 0xa2, 0x77,
+	0xfe, 0x7c, 0x31, 0xb0, 0x10, 0x05, 0x9d, 0xa9, 0xfe, 0x6b, 0xcf, 0x0d, 0x7e, 0x6f, 0x9a, 0xab,
+	0xfe, 0xce, 0x79, 0x31, 0xfe, 0xbe, 0x18, 0x9a, 0xbb, 0xa4, 0x66, 0x11, 0x97, 0xcd, 0x0d, 0xc2,
+	0xa7, 0x44, 0xfe, 0x21, 0x24, 0x00, 0xfd, 0xfd, 0xfc, 0x6f, 0xfe, 0x73, 0xcf, 0xfe, 0xef, 0x7d,
+	0xa3, 0x76, 0x56, 0x25, 0xc0, 0x20, 0x31, 0x09, 0x98, 0xcc, 0x31, 0xfe, 0xbe, 0x18, 0xfe, 0x3a,
+	0x4a, 0x7e, 0x00, 0xa5, 0x37, 0x24, 0xa3, 0x66, 0x00, 0xfe, 0x42, 0x49, 0xfe, 0x9d, 0x14, 0xfe,
+	0x08, 0x61, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xa9, 0x34, 0xfe, 0x9d, 0x15, 0xaa, 0x32, 0x7f, 0x9b,
+	0xaa, 0xfe, 0x63, 0x6e, 0x7e, 0x6f, 0x15, 0x08, 0xfe, 0xe7, 0x5d, 0xa5, 0x65, 0xfe, 0xad, 0x96,
+	0x6e, 0x04, 0x29, 0x3e, 0x0d, 0xc1, 0x21, 0xa3, 0x76, 0xfe, 0x10, 0xa2, 0x9b, 0xbb, 0xfd, 0xfd,
+	0xfa, 0xa2, 0x67, 0xfe, 0x52, 0xec, 0xfe, 0xe7, 0x3c, 0xa5, 0x65, 0x56, 0x25, 0xc1, 0x6b, 0x1d,
+	0x95, 0xde, 0xad, 0x21, 0x99, 0xbc, 0xfe, 0x42, 0xab, 0x7a, 0xfe, 0x00, 0x02, 0xa4, 0x45, 0xc2,
+	0x00, 0xfe, 0x9d, 0x55, 0xfe, 0x39, 0xe7, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xc1, 0x36, 0x04, 0xa5,
+	0x65, 0x39, 0x98, 0xcd, 0x08, 0x21, 0xc0, 0x0d, 0xa6, 0x55, 0x2c, 0x51, 0xfe, 0xa5, 0x35, 0xa5,
+	0x55, 0x30, 0x0d, 0xc1, 0x12, 0x0d, 0xa4, 0x66, 0x65, 0xfe, 0x08, 0x41, 0x00, 0xfd, 0xfd, 0xf8,
+	0x6e, 0xfe, 0x3a, 0x29, 0xfe, 0xde, 0xfb, 0x25, 0x1d, 0x25, 0xc2, 0x31, 0x34, 0x1d, 0xc0, 0x0d,
+	0x9a, 0xbb, 0xfe, 0x08, 0xc4, 0x1f, 0xa2, 0x66, 0x24, 0xa4, 0x66, 0x00, 0xfe, 0x8c, 0x92, 0x97,
+	0xdd, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xc3, 0x15, 0xfe, 0xbe, 0x18, 0xa2, 0x77, 0x39, 0x96, 0xcd,
+	0x08, 0xa3, 0x66, 0x7e, 0x9b, 0xab, 0xaf, 0x10, 0xfe, 0xff, 0xff, 0x99, 0xcc, 0xfe, 0x9d, 0x35,
+	0x1d, 0x1c, 0x91, 0xff, 0xa2, 0x67, 0x15, 0x6b, 0x55, 0xa5, 0x65, 0x15, 0x05, 0x00, 0xfd, 0xfd,
+	0xf6, 0x05, 0xac, 0x03, 0xfe, 0xd6, 0x9a, 0x2c, 0x55, 0x7e, 0xc2, 0x31, 0x96, 0xdd, 0xa4, 0x67,
+	0x31, 0xfe, 0x8c, 0x72, 0xfe, 0x42, 0x8b, 0x98, 0xdc, 0x0e, 0xa4, 0x45, 0x1f, 0xa5, 0x54, 0x00,
+	0x39, 0xac, 0x32, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xc4, 0xa5, 0x55, 0x20, 0xae, 0x10, 0x6f, 0xc0,
+	0x94, 0xee, 0x94, 0xef, 0x21, 0x7e, 0x9a, 0xac, 0xfe, 0xb5, 0xd7, 0xfe, 0xff, 0xff, 0x0d, 0x95,
+	0xde, 0xa6, 0x55, 0x97, 0xcd, 0x93, 0xee, 0xa3, 0x77, 0x1c, 0x21, 0x51, 0xa6, 0x55, 0x01, 0x00,
+	0xfd, 0xfd, 0xf6, 0xa9, 0x05, 0xfe, 0xc6, 0x59, 0xac, 0x31, 0x56, 0x25, 0xc1, 0x66, 0xa2, 0x67,
+	0x99, 0xbb, 0x52, 0x31, 0xfe, 0xad, 0x76, 0xfe, 0x3a, 0x4a, 0x60, 0x00, 0xa4, 0x47, 0x24, 0xa2,
+	0x67, 0x00, 0xac, 0x03, 0xfe, 0xa5, 0x55, 0xfe, 0x18, 0xe4, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xc5,
+	0xab, 0x23, 0xfe, 0x9d, 0x35, 0xa8, 0x53, 0xc1, 0x93, 0xef, 0x0d, 0xa3, 0x66, 0x7a, 0x9b, 0xab,
+	0xfe, 0xce, 0x9a, 0x31, 0x92, 0xff, 0x9b, 0xab, 0xa4, 0x66, 0x94, 0xee, 0x01, 0xa3, 0x67, 0xc1,
+	0x15, 0xa6, 0x55, 0x96, 0xdd, 0x00, 0xfd, 0xfd, 0xf4, 0xa7, 0x16, 0xfe, 0xbd, 0xf7, 0xaf, 0x10,
+	0x56, 0x25, 0xc2, 0x31, 0x9b, 0xbb, 0x05, 0x31, 0x92, 0xff, 0x32, 0xa0, 0xa8, 0x00, 0xa4, 0x48,
+	0x24, 0xc0, 0x6e, 0x00, 0x19, 0xfe, 0x42, 0x49, 0x00, 0x6e, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xc5,
+	0xfe, 0x4a, 0x6a, 0x35, 0x25, 0xc0, 0x66, 0x92, 0xef, 0x0d, 0xa3, 0x76, 0x21, 0x0d, 0xfe, 0xe7,
+	0x1c, 0xa7, 0x44, 0xfe, 0xb5, 0xd7, 0x66, 0xa3, 0x66, 0x11, 0x0d, 0x26, 0x21, 0x26, 0x15, 0xa6,
+	0x56, 0x94, 0xed, 0xfe, 0x00, 0x00, 0xfd, 0xfd, 0xf2, 0xa4, 0x48, 0x09, 0xfe, 0xff, 0xde, 0x56,
+	0x7a, 0x25, 0xc1, 0x31, 0x9d, 0xa9, 0x97, 0xcd, 0x31, 0x97, 0xdd, 0xfe, 0x42, 0x8b, 0x02, 0x07,
+	0xa4, 0x46, 0x24, 0x1f, 0xa5, 0x54, 0x00, 0xfe, 0x8c, 0x92, 0x15, 0x00, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xc9, 0x01, 0xfe, 0xb5, 0xd7, 0xa3, 0x76, 0xc0, 0x52, 0x92, 0xef, 0x12, 0xa2, 0x87, 0x52, 0x29,
+	0xfe, 0xef, 0x7d, 0x31, 0x35, 0xa3, 0x66, 0x18, 0x92, 0xef, 0x12, 0x29, 0x26, 0x29, 0x21, 0xa6,
+	0x55, 0x19, 0x00, 0xfd, 0xfd, 0xf0, 0xa5, 0x37, 0xfe, 0xb5, 0xb6, 0xfe, 0xff, 0xde, 0x20, 0xc0,
+	0x25, 0xc1, 0x2c, 0x55, 0x95, 0xde, 0xad, 0x21, 0x9b, 0xbb, 0xfe, 0x53, 0x0d, 0x02, 0x1f, 0x24,
+	0xc0, 0x1f, 0x05, 0x00, 0x1c, 0xa8, 0x43, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xca, 0xa3, 0x66, 0xfe,
+	0x7c, 0x10, 0xaf, 0x10, 0x7f, 0xc0, 0x11, 0x3d, 0x15, 0xa3, 0x67, 0x0d, 0xa7, 0x54, 0xfe, 0xf7,
+	0xdf, 0x2c, 0xfe, 0xad, 0x96, 0xa4, 0x66, 0x18, 0x3d, 0x21, 0x7e, 0xc1, 0x21, 0xa6, 0x55, 0x93,
+	0xfe, 0x00, 0xfd, 0xfd, 0xee, 0xa5, 0x37, 0xfe, 0xb5, 0xb6, 0xfe, 0xff, 0xde, 0x66, 0xc0, 0x25,
+	0xc3, 0x94, 0xef, 0x2c, 0x55, 0x1c, 0x97, 0xcc, 0x93, 0xef, 0x9b, 0xcc, 0x24, 0x1f, 0x3d, 0x00,
+	0x02, 0xfe, 0x9d, 0x35, 0x28, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xcb, 0x08, 0xfe, 0x8c, 0xb3, 0xaa,
+	0x42, 0x6f, 0xc0, 0x51, 0x92, 0xff, 0x1c, 0xa3, 0x66, 0x9b, 0xbb, 0x31, 0xfe, 0xff, 0xff, 0x9d,
+	0xaa, 0xfe, 0xad, 0x76, 0xa6, 0x54, 0x09, 0x35, 0x21, 0x35, 0x29, 0x35, 0x29, 0xa5, 0x56, 0x93,
+	0xfe, 0x00, 0xfd, 0xfd, 0xec, 0xa4, 0x48, 0xfe, 0xb5, 0xb6, 0xfe, 0xff, 0xde, 0x20, 0x5a, 0x25,
+	0xc2, 0x2c, 0x39, 0x1d, 0x31, 0xfe, 0x7c, 0x10, 0xfe, 0x3a, 0x4a, 0x96, 0xed, 0x98, 0xdd, 0x24,
+	0x1f, 0xa3, 0x56, 0x00, 0xa8, 0x25, 0xfe, 0xa5, 0x75, 0xfe, 0x29, 0x65, 0x00, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xcd, 0xac, 0x12, 0xfe, 0x9d, 0x14, 0xa7, 0x55, 0x6e, 0xc0, 0x09, 0x3d, 0x21, 0xa2, 0x77,
+	0x3e, 0x0d, 0x31, 0x9c, 0xaa, 0xfe, 0xad, 0x76, 0xa7, 0x44, 0x9c, 0xaa, 0x35, 0x55, 0x35, 0xc1,
+	0x65, 0xa5, 0x56, 0x2d, 0x00, 0xfd, 0xfd, 0xea, 0x06, 0x09, 0x25, 0x20, 0x5a, 0x25, 0xc2, 0x6f,
+	0x95, 0xde, 0xa7, 0x54, 0x31, 0xfe, 0x8c, 0x92, 0xfe, 0x32, 0x2a, 0x99, 0xdb, 0x07, 0x24, 0x1f,
+	0xa2, 0x66, 0x1f, 0x00, 0xfe, 0x9d, 0x35, 0xfe, 0x4a, 0x69, 0x00, 0x6e, 0x00, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xcd, 0xfe, 0x3a, 0x29, 0xfe, 0xa5, 0x55, 0x18, 0x69, 0x6f, 0x9d, 0xa9, 0x93, 0xef, 0x9d,
+	0x9a, 0xa2, 0x87, 0x9a, 0xab, 0xfe, 0xa5, 0x55, 0x31, 0x04, 0xfe, 0xa5, 0x76, 0xa7, 0x54, 0x9c,
+	0xaa, 0x35, 0x65, 0x35, 0xc0, 0x3d, 0x35, 0xa4, 0x66, 0x96, 0xed, 0x05, 0x00, 0xfd, 0xfd, 0xe6,
+	0x05, 0xa8, 0x16, 0x11, 0xaf, 0x10, 0x20, 0xc0, 0x25, 0xc2, 0x6f, 0x95, 0xde, 0xa7, 0x54, 0x31,
+	0xfe, 0x94, 0xd3, 0xfe, 0x32, 0x29, 0x9b, 0xcb, 0x07, 0xa4, 0x46, 0x1f, 0x24, 0xa2, 0x77, 0x00,
+	0x39, 0x01, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xd1, 0xfe, 0x52, 0xab, 0x30, 0x11, 0x66, 0x11, 0x51,
+	0x93, 0xef, 0x9d, 0x9a, 0x3d, 0x99, 0xbc, 0xfe, 0xad, 0x96, 0x31, 0x9a, 0xbc, 0x35, 0x34, 0x9c,
+	0x9a, 0xfe, 0x73, 0xf0, 0xc0, 0x3d, 0xc1, 0x35, 0x1d, 0x10, 0xfe, 0x08, 0x41, 0x00, 0xfd, 0xfd,
+	0xe4, 0x6f, 0xac, 0x02, 0xfe, 0xc6, 0x59, 0x25, 0x56, 0x20, 0x25, 0xc2, 0x6f, 0x96, 0xdd, 0x04,
+	0x31, 0xfe, 0x9d, 0x14, 0xfe, 0x2a, 0x09, 0x9d, 0xb9, 0x07, 0x29, 0x1f, 0xc0, 0xa4, 0x65, 0x9a,
+	0xca, 0xfe, 0x84, 0x72, 0x9c, 0xba, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xd3, 0x39, 0xfe, 0xad, 0x96,
+	0x11, 0x09, 0x11, 0x51, 0x93, 0xef, 0x21, 0x3d, 0x9a, 0xab, 0xfe, 0xb5, 0xb6, 0x31, 0x3c, 0x35,
+	0xa7, 0x54, 0x09, 0x92, 0xff, 0x56, 0x3d, 0xc2, 0x1d, 0x9b, 0xba, 0xfe, 0x10, 0xa2, 0x00, 0xfd,
+	0xfd, 0xe2, 0xa2, 0x67, 0xaf, 0x01, 0xfe, 0xd6, 0x9a, 0x25, 0x56, 0x20, 0x25, 0xc2, 0x31, 0x96,
+	0xdd, 0x04, 0x31, 0xfe, 0xa5, 0x35, 0x1e, 0x01, 0x00, 0x24, 0x1f, 0x13, 0xa6, 0x44, 0x00, 0x35,
+	0xa5, 0x65, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xd4, 0x6e, 0x15, 0xb0, 0x00, 0xa3, 0x76, 0x09, 0x7a,
+	0x55, 0x94, 0xdf, 0x21, 0xa3, 0x76, 0x3e, 0xfe, 0xb5, 0xb6, 0x31, 0x3c, 0x35, 0x39, 0x9b, 0xab,
+	0x92, 0xff, 0x56, 0xa2, 0x77, 0x3d, 0x09, 0x3d, 0xa2, 0x77, 0x3d, 0xfe, 0x21, 0x24, 0x00, 0xfd,
+	0xfd, 0xe0, 0x6f, 0xfe, 0x52, 0xec, 0xfe, 0xde, 0xfb, 0x2c, 0x1d, 0x7e, 0xc3, 0x31, 0x0d, 0x04,
+	0x31, 0x1c, 0xfe, 0x29, 0xe9, 0x01, 0x00, 0x24, 0x1f, 0x13, 0xa6, 0x44, 0x00, 0xfe, 0x63, 0x6e,
+	0xab, 0x32, 0x14, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xd5, 0xa3, 0x66, 0xfe, 0x73, 0xcf, 0xae, 0x11,
+	0xa2, 0x77, 0x66, 0x09, 0x65, 0x11, 0x9b, 0xab, 0xa3, 0x76, 0x3e, 0xfe, 0xb5, 0xb6, 0x31, 0x9b,
+	0xbb, 0x35, 0x34, 0x18, 0x92, 0xef, 0x65, 0x09, 0xc2, 0x11, 0xc0, 0xfe, 0x31, 0xc7, 0x00, 0xfd,
+	0xfd, 0xde, 0x13, 0x29, 0xfe, 0xe7, 0x3c, 0x2c, 0x1d, 0x25, 0xc3, 0x2c, 0x97, 0xcc, 0xa6, 0x55,
+	0x31, 0x1c, 0xfe, 0x21, 0xe9, 0x9d, 0xc9, 0x07, 0xa4, 0x46, 0x1f, 0xc0, 0xa5, 0x55, 0x00, 0xfe,
+	0x5b, 0x0c, 0xb0, 0x00, 0xfe, 0x10, 0xa2, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xd7, 0xa4, 0x66, 0x3d,
+	0xac, 0x22, 0xa2, 0x77, 0x65, 0x6b, 0x3d, 0x96, 0xde, 0x21, 0xa3, 0x76, 0x9a, 0xbc, 0x35, 0x31,
+	0x9c, 0xaa, 0x35, 0xa6, 0x55, 0x51, 0x11, 0x3d, 0x11, 0x56, 0x11, 0xc1, 0xa2, 0x77, 0xfe, 0x4a,
+	0x6a, 0xfe, 0x00, 0x00, 0xfd, 0xfd, 0xdc, 0x24, 0x39, 0xfe, 0xef, 0x7d, 0xa3, 0x76, 0x56, 0x25,
+	0xc2, 0x2c, 0x25, 0x96, 0xde, 0xa7, 0x45, 0xa4, 0x65, 0x0d, 0x0f, 0x3c, 0x0e, 0x29, 0x24, 0x1f,
+	0x0c, 0x00, 0xfe, 0x4a, 0xab, 0x1c, 0xfe, 0x18, 0xe3, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xd9, 0xa6,
+	0x45, 0xfe, 0x7c, 0x11, 0x35, 0xa2, 0x77, 0x65, 0xc1, 0x98, 0xbc, 0x21, 0xa3, 0x76, 0x9a, 0xbc,
+	0xfe, 0xa5, 0x55, 0x31, 0x9d, 0xaa, 0xfe, 0xb5, 0xb7, 0xa4, 0x66, 0xc0, 0x93, 0xee, 0x3d, 0xa2,
+	0x77, 0xc3, 0x25, 0x95, 0xde, 0x14, 0x00, 0xfd, 0xfd, 0xd8, 0x6e, 0xa9, 0x15, 0xfe, 0xb5, 0xb6,
+	0x1d, 0x7e, 0x1d, 0x25, 0xc2, 0x31, 0x61, 0x97, 0xbd, 0x1d, 0x31, 0xfe, 0x94, 0xd3, 0xfe, 0x19,
+	0xa8, 0x70, 0x0e, 0xa4, 0x46, 0x24, 0xc0, 0x0c, 0x00, 0xfe, 0x42, 0x6a, 0x21, 0x15, 0x00, 0x6e,
+	0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xd9, 0x01, 0x11, 0x35, 0x7e, 0x35, 0xc0, 0x3d, 0x39, 0x98, 0xbc,
+	0xa2, 0x87, 0x9b, 0xab, 0xad, 0x21, 0x31, 0x66, 0x09, 0xa3, 0x76, 0x6f, 0x39, 0x3d, 0x11, 0xc1,
+	0x6e, 0x11, 0xa2, 0x77, 0x9a, 0xbb, 0xfe, 0x19, 0x04, 0x00, 0xfd, 0xfd, 0xd6, 0x6f, 0xfe, 0x42,
+	0x6a, 0xfe, 0xce, 0x79, 0xab, 0x32, 0x20, 0x1d, 0x25, 0xc2, 0x6f, 0x18, 0x98, 0xbc, 0x2c, 0x31,
+	0xfe, 0x8c, 0x92, 0x02, 0x2d, 0x96, 0xef, 0xa4, 0x45, 0x65, 0x24, 0xa5, 0x55, 0x00, 0x3d, 0x21,
+	0xfe, 0x29, 0x65, 0x00, 0x6e, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xdb, 0xa7, 0x45, 0xfe, 0x84, 0x51,
+	0xaa, 0x33, 0x7e, 0x35, 0xc0, 0x3d, 0x9b, 0xab, 0x97, 0xcd, 0x7e, 0x12, 0xa9, 0x44, 0x1d, 0xa2,
+	0x77, 0xfe, 0xbe, 0x18, 0xc0, 0xa3, 0x77, 0x0d, 0x99, 0xbb, 0x16, 0x6b, 0xc1, 0x16, 0x25, 0x11,
+	0xfe, 0x39, 0xe7, 0xfe, 0x00, 0x00, 0xfd, 0xfd, 0xd4, 0x13, 0x35, 0xfe, 0xe7, 0x1c, 0xa6, 0x54,
+	0x56, 0xc0, 0x25, 0xc2, 0x31, 0x9c, 0xaa, 0x99, 0xbc, 0x31, 0x1d, 0x3d, 0xfe, 0x19, 0x87, 0x71,
+	0x1f, 0xa3, 0x56, 0x66, 0x69, 0xa4, 0x66, 0x00, 0xfe, 0x42, 0x6a, 0x21, 0xfe, 0x29, 0x65, 0x00,
+	0x6e, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xdd, 0x08, 0xfe, 0x84, 0x51, 0xa9, 0x44, 0x6e, 0xc2, 0x1c,
+	0x97, 0xcc, 0x56, 0x51, 0x11, 0x09, 0x31, 0x93, 0xef, 0x9c, 0xaa, 0xa6, 0x55, 0x30, 0x96, 0xcd,
+	0xa2, 0x77, 0xc1, 0x7a, 0x6e, 0xc0, 0x6b, 0x93, 0xfe, 0x14, 0x00, 0xfd, 0xfd, 0xd0, 0x6e, 0xa7,
+	0x26, 0xfe, 0xa5, 0x55, 0xfe, 0xf7, 0x7d, 0xa3, 0x66, 0x56, 0x7a, 0x25, 0xc2, 0x6f, 0x9a, 0xbb,
+	0x9c, 0xaa, 0x31, 0x9b, 0xbb, 0xfe, 0x6b, 0x8e, 0x36, 0x9c, 0xca, 0x9c, 0x9b, 0xa2, 0x66, 0x66,
+	0x30, 0x14, 0x00, 0xfe, 0x42, 0x6a, 0x21, 0x29, 0x00, 0x05, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xdf,
+	0x01, 0xfe, 0x7c, 0x10, 0xab, 0x23, 0x7e, 0xc0, 0x66, 0x35, 0x21, 0x11, 0x9d, 0x9a, 0x65, 0x35,
+	0xfe, 0xdf, 0x1c, 0x31, 0x96, 0xde, 0x98, 0xcc, 0xa7, 0x44, 0x9a, 0xbb, 0x16, 0xc0, 0x7f, 0xc3,
+	0x6f, 0x35, 0xfe, 0x21, 0x45, 0x00, 0xfd, 0xfd, 0xce, 0x07, 0xfe, 0x4a, 0xab, 0x39, 0x20, 0x6e,
+	0x1d, 0x20, 0x25, 0xc2, 0x6f, 0x98, 0xcc, 0xc0, 0x31, 0x97, 0xdd, 0xfe, 0x52, 0xec, 0x95, 0xde,
+	0x9b, 0xbb, 0x41, 0x3a, 0x35, 0xc0, 0xa4, 0x76, 0x00, 0xfe, 0x52, 0xcb, 0xfe, 0xa5, 0x55, 0xfe,
+	0x29, 0x65, 0x00, 0x6e, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xe1, 0xa6, 0x45, 0xfe, 0x73, 0xf0, 0x21,
+	0x30, 0xc0, 0x69, 0x30, 0x29, 0x99, 0xbc, 0x35, 0xc0, 0x51, 0xfe, 0xce, 0x79, 0x31, 0x9a, 0xbb,
+	0x04, 0x39, 0x9d, 0x9a, 0x95, 0xde, 0x16, 0x25, 0xc3, 0x31, 0x51, 0xfe, 0x4a, 0x6a, 0x05, 0x66,
+	0xfd, 0xfd, 0xca, 0x05, 0xa3, 0x58, 0xfe, 0x8c, 0x72, 0x35, 0xa5, 0x65, 0x56, 0xc0, 0x7a, 0x25,
+	0xc0, 0x20, 0xa2, 0x67, 0x25, 0x0d, 0xa5, 0x56, 0x31, 0xfe, 0xc6, 0x39, 0x32, 0x9a, 0xcb, 0x9a,
+	0xbb, 0x3a, 0xc2, 0xa3, 0x87, 0x00, 0xfe, 0x5b, 0x2d, 0xb0, 0x10, 0xfe, 0x21, 0x24, 0x00, 0x05,
+	0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xe3, 0xa4, 0x66, 0xfe, 0x73, 0xcf, 0xac, 0x22, 0x7e, 0xc0, 0x5a,
+	0xc0, 0x29, 0x9b, 0xab, 0x9a, 0xbb, 0x56, 0x9c, 0xaa, 0x09, 0x31, 0x1d, 0x09, 0x2c, 0xa2, 0x76,
+	0x95, 0xde, 0x16, 0x7f, 0x2a, 0xc0, 0x6b, 0xc0, 0x7a, 0x6e, 0x97, 0xcd, 0xfe, 0x19, 0x04, 0x00,
+	0xfd, 0xfd, 0xc8, 0x07, 0xfe, 0x3a, 0x49, 0xfe, 0xbe, 0x18, 0xad, 0x21, 0x7e, 0x1d, 0xc0, 0x7a,
+	0x25, 0xc1, 0x6f, 0x9d, 0xa9, 0x98, 0xcd, 0x1d, 0x31, 0xfe, 0xad, 0x96, 0xfe, 0x11, 0xa8, 0x9f,
+	0xb8, 0x9a, 0xbb, 0x6f, 0x66, 0xc1, 0xa3, 0x76, 0x00, 0xfe, 0x6b, 0x8e, 0xac, 0x22, 0xfe, 0x18,
+	0xe3, 0x00, 0x05, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xe5, 0xa3, 0x66, 0x15, 0x1c, 0x6e, 0x26, 0x21,
+	0xc0, 0x26, 0x0d, 0x99, 0xbc, 0x65, 0x12, 0x0d, 0xfe, 0xf7, 0xbf, 0x31, 0x93, 0xef, 0x9d, 0xaa,
+	0xa5, 0x55, 0x35, 0x97, 0xdd, 0x6e, 0x6f, 0xc0, 0x34, 0xc1, 0x6e, 0x9d, 0x9a, 0xfe, 0x4a, 0x6a,
+	0xfe, 0x00, 0x20, 0x66, 0xfd, 0xfd, 0xc4, 0x05, 0xa4, 0x48, 0x16, 0xfe, 0xe7, 0x1c, 0xa6, 0x54,
+	0x56, 0xc1, 0x7a, 0x25, 0x20, 0x25, 0x6f, 0x9a, 0xbb, 0x9c, 0xaa, 0x31, 0x1d, 0xfe, 0x8c, 0x72,
+	0x17, 0xa2, 0xa6, 0x04, 0x6e, 0xc1, 0x7e, 0x6e, 0x00, 0x3d, 0x39, 0xfe, 0x10, 0xa2, 0x00, 0x05,
+	0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xe7, 0x05, 0xfe, 0x5b, 0x2d, 0xaf, 0x10, 0x21, 0xc3, 0x1c, 0x20,
+	0x3d, 0x9d, 0x9a, 0xa5, 0x65, 0x35, 0x31, 0x97, 0xdd, 0x98, 0xbc, 0xa5, 0x66, 0x9d, 0x99, 0x96,
+	0xdd, 0x51, 0x39, 0xc5, 0x98, 0xcc, 0xfe, 0x29, 0x65, 0x95, 0xee, 0xfd, 0xfd, 0xc2, 0x07, 0xfe,
+	0x4a, 0xab, 0xfe, 0xc6, 0x38, 0xab, 0x33, 0xa2, 0x76, 0x56, 0xc1, 0x7a, 0x25, 0x20, 0x6f, 0x25,
+	0x1c, 0xa2, 0x67, 0x31, 0x30, 0xfe, 0x63, 0x6e, 0xfe, 0x01, 0x06, 0xa2, 0xa6, 0x9d, 0x8a, 0x7e,
+	0x09, 0xc0, 0xa2, 0x77, 0x09, 0x00, 0xfe, 0x8c, 0x72, 0x6e, 0xfe, 0x08, 0x41, 0x00, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xec, 0xfe, 0x52, 0xab, 0xfe, 0x94, 0xf4, 0xa3, 0x76, 0xc1, 0x66, 0xc0, 0x21, 0x34,
+	0x9c, 0x9a, 0x9d, 0xaa, 0x55, 0xfe, 0xc6, 0x59, 0xad, 0x21, 0x10, 0x94, 0xed, 0xa2, 0x78, 0xa2,
+	0x76, 0x97, 0xcd, 0x25, 0xa2, 0x77, 0xc2, 0x6e, 0x39, 0x05, 0x51, 0xfe, 0x5a, 0xec, 0xfe, 0x10,
+	0xa2, 0x00, 0xfd, 0xfd, 0xaa, 0x14, 0xfe, 0x9c, 0xf4, 0xfe, 0xe7, 0x5c, 0xa4, 0x76, 0x56, 0xc2,
+	0x7a, 0xc1, 0xa2, 0x67, 0x9d, 0xa9, 0x99, 0xbc, 0x18, 0x31, 0xfe, 0xc6, 0x18, 0xfe, 0x32, 0x2a,
+	0x22, 0x76, 0x0e, 0x7a, 0xc0, 0x56, 0xa3, 0x76, 0x9a, 0xbc, 0x9c, 0xca, 0x05, 0x38, 0x00, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xef, 0xfe, 0x42, 0x29, 0xfe, 0x8c, 0xb3, 0x1c, 0xc2, 0x59, 0x1c, 0x08, 0x9b,
+	0xaa, 0x3d, 0x9c, 0x9b, 0x21, 0xfe, 0xff, 0xdf, 0x6e, 0x94, 0xee, 0x9c, 0xab, 0xa5, 0x55, 0x9a,
+	0xbb, 0x34, 0xc0, 0x3e, 0xc2, 0x08, 0xc1, 0x9b, 0x9a, 0xfe, 0x42, 0x29, 0xfe, 0x00, 0x20, 0x00,
+	0xfd, 0xf9, 0xa3, 0x58, 0xfe, 0x73, 0xcf, 0x0d, 0x1d, 0x7e, 0x1d, 0xc2, 0x7a, 0x1d, 0x25, 0x6b,
+	0x9a, 0xbb, 0x41, 0x31, 0x2c, 0x3e, 0xfe, 0x01, 0x06, 0xa3, 0x95, 0x42, 0x66, 0x69, 0xc1, 0x2d,
+	0x07, 0xac, 0x02, 0x21, 0xfe, 0x63, 0x4d, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xf1, 0xac, 0x12, 0xfe,
+	0x84, 0x72, 0xa6, 0x54, 0x7a, 0x12, 0xc0, 0x66, 0xc1, 0x9c, 0xaa, 0x9d, 0x9a, 0x9c, 0xaa, 0xa5,
+	0x65, 0xfe, 0xdf, 0x1c, 0x31, 0x9a, 0xbb, 0x95, 0xde, 0xa4, 0x76, 0x5a, 0x12, 0x9c, 0xbb, 0x3e,
+	0x08, 0xc1, 0x0d, 0xc1, 0x56, 0x29, 0xfe, 0x31, 0x86, 0x00, 0xfd, 0xf6, 0x07, 0xfe, 0x52, 0xec,
+	0xfe, 0xbe, 0x18, 0xac, 0x31, 0xa2, 0x77, 0x56, 0xc4, 0x20, 0xa2, 0x67, 0x9d, 0xaa, 0x9a, 0xaa,
+	0xa4, 0x67, 0x31, 0x98, 0xcc, 0xfe, 0x63, 0x6e, 0xfe, 0x00, 0xa5, 0x39, 0x9d, 0x9a, 0xc3, 0xa2,
+	0x86, 0x00, 0xfe, 0x4a, 0xcb, 0xfe, 0xa5, 0x76, 0xfe, 0x4a, 0x49, 0x00, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xf3, 0xa7, 0x44, 0xfe, 0x73, 0xf0, 0xa9, 0x43, 0xc5, 0x51, 0x9d, 0x9a, 0x35, 0x51, 0xfe, 0xbd,
+	0xf8, 0x31, 0x2c, 0x94, 0xde, 0x51, 0xa4, 0x66, 0x09, 0x39, 0x3e, 0x0d, 0xc5, 0x39, 0x95, 0xde,
+	0xfe, 0x21, 0x45, 0x00, 0xfd, 0xf2, 0x07, 0x2e, 0xfe, 0xad, 0x96, 0xae, 0x20, 0x25, 0x56, 0x66,
+	0x1d, 0xc3, 0x25, 0xc0, 0x9b, 0xab, 0x9c, 0xab, 0x2c, 0x6e, 0xfe, 0xb5, 0xb6, 0xfe, 0x21, 0xc8,
+	0x9a, 0xbc, 0xa3, 0x85, 0x42, 0xc2, 0x7e, 0xc0, 0x00, 0xfe, 0x6b, 0xcf, 0xab, 0x33, 0xfe, 0x29,
+	0x65, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xf5, 0xa3, 0x66, 0xfe, 0x63, 0x4d, 0xad, 0x12, 0x7e, 0xc2,
+	0x08, 0x0d, 0x08, 0x9d, 0x99, 0x9d, 0x9a, 0x9b, 0xab, 0xa9, 0x43, 0xfe, 0xef, 0x5d, 0xa5, 0x55,
+	0x35, 0x96, 0xde, 0xa4, 0x65, 0x56, 0x98, 0xcc, 0x9c, 0xaa, 0x0d, 0xc2, 0x6e, 0xc0, 0x7a, 0x5b,
+	0x9c, 0xaa, 0x94, 0xee, 0xfe, 0x21, 0x24, 0x00, 0xfd, 0xef, 0xfe, 0x31, 0xe8, 0x0d, 0x35, 0xa4,
+	0x66, 0xc0, 0x66, 0x1d, 0xc3, 0x20, 0xa2, 0x67, 0x11, 0x9a, 0xac, 0xa4, 0x66, 0x31, 0x35, 0xfe,
+	0x7c, 0x10, 0xfe, 0x00, 0x24, 0xab, 0x10, 0x51, 0xc2, 0x56, 0x39, 0x9a, 0xab, 0x9a, 0xed, 0xfe,
+	0x8c, 0xb3, 0x65, 0xfe, 0x10, 0x82, 0x00, 0x6e, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xf6, 0xfe, 0x4a,
+	0x6a, 0x31, 0x08, 0x0d, 0x08, 0xc1, 0x69, 0x08, 0x55, 0x9d, 0xaa, 0x9c, 0x9a, 0x56, 0xfe, 0xbe,
+	0x18, 0xaf, 0x10, 0xc0, 0x94, 0xee, 0x1d, 0xa3, 0x77, 0x9c, 0xa9, 0x0d, 0x08, 0x12, 0xc1, 0x6b,
+	0x1c, 0x6e, 0xc1, 0x9b, 0xab, 0x94, 0xee, 0xfe, 0x21, 0x24, 0x97, 0xdd, 0xfd, 0xeb, 0xfe, 0x31,
+	0xe8, 0x0d, 0xfe, 0xdf, 0x1b, 0xa5, 0x66, 0xc0, 0x18, 0x1d, 0xc4, 0x7e, 0xc0, 0x30, 0x51, 0xa9,
+	0x33, 0xc0, 0xfe, 0xb5, 0xd7, 0x1e, 0x96, 0xde, 0xa6, 0x74, 0x41, 0xc3, 0xa2, 0x77, 0x07, 0xfe,
+	0x32, 0x09, 0xfe, 0x9d, 0x55, 0xfe, 0x6b, 0x8e, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfb, 0xac, 0x12,
+	0xfe, 0x84, 0x31, 0x08, 0x69, 0x08, 0x3e, 0xc0, 0x66, 0xc1, 0x2a, 0x9d, 0xaa, 0x9a, 0xac, 0xa9,
+	0x43, 0xfe, 0xe7, 0x3c, 0xa6, 0x55, 0x9c, 0xaa, 0x95, 0xde, 0xa2, 0x77, 0x7e, 0x9a, 0xab, 0x0d,
+	0xc0, 0xa2, 0x77, 0xc6, 0x9b, 0xab, 0x94, 0xee, 0xfe, 0x21, 0x45, 0x00, 0xfd, 0xe6, 0x07, 0xfe,
+	0x3a, 0x29, 0x0d, 0x26, 0xa5, 0x66, 0xc0, 0x18, 0xc0, 0x1d, 0xc3, 0x7e, 0xc0, 0x09, 0x9a, 0xbb,
+	0x09, 0xa4, 0x66, 0x30, 0xfe, 0x73, 0xf0, 0xfe, 0x00, 0x03, 0xac, 0x00, 0xc0, 0x55, 0xc1, 0x66,
+	0x39, 0x2a, 0x00, 0xfe, 0x63, 0x6e, 0xaf, 0x10, 0xfe, 0x42, 0x49, 0x00, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xa5, 0x55, 0xfe, 0x6b, 0x6e, 0xac, 0x12, 0x3e, 0x01, 0x56, 0xc3, 0x66, 0x55, 0x9c, 0x9a,
+	0x9d, 0xaa, 0xb0, 0x10, 0x2c, 0x6e, 0x1c, 0x9a, 0xab, 0xa3, 0x76, 0x56, 0x99, 0xcc, 0x9d, 0x99,
+	0xa2, 0x77, 0xc3, 0x6e, 0xc0, 0x7a, 0x26, 0x9b, 0xbb, 0x96, 0xdd, 0xfe, 0x31, 0xa7, 0x95, 0xed,
+	0x00, 0xfd, 0xe1, 0x13, 0xfe, 0x4a, 0xab, 0x26, 0xad, 0x32, 0xa5, 0x55, 0xc0, 0x18, 0xc0, 0x1d,
+	0xc3, 0x7a, 0x2c, 0x50, 0x1c, 0x30, 0xa7, 0x44, 0x2c, 0xfe, 0xad, 0x76, 0x36, 0x9a, 0xbc, 0xa7,
+	0x63, 0x56, 0x56, 0xc2, 0x01, 0x99, 0xac, 0x6b, 0xfe, 0x8c, 0xb3, 0x34, 0xfe, 0x18, 0xe4, 0x00,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xc2, 0xfe, 0x42, 0x6a, 0xb1, 0x00, 0x3e, 0x66, 0xc2, 0x34, 0xc1,
+	0x31, 0x51, 0x9a, 0xbb, 0xa5, 0x65, 0xfe, 0xd6, 0x9a, 0xab, 0x22, 0x66, 0x96, 0xcd, 0x9c, 0xaa,
+	0xa3, 0x76, 0x1d, 0x26, 0x12, 0x7f, 0x26, 0xc2, 0x29, 0xc0, 0x6f, 0xc0, 0x0d, 0x97, 0xcd, 0x93,
+	0xfe, 0x2d, 0x00, 0xfd, 0xdd, 0xa7, 0x26, 0xfe, 0x63, 0x8e, 0xfe, 0xbd, 0xf7, 0xab, 0x22, 0xa3,
+	0x77, 0xc0, 0x65, 0x18, 0x1d, 0xc4, 0x7e, 0x1d, 0x9b, 0xaa, 0x66, 0x2c, 0x6e, 0x39, 0xfe, 0x5b,
+	0x2d, 0xfe, 0x00, 0x03, 0xfe, 0x29, 0xa7, 0xc0, 0x56, 0xc3, 0x6e, 0x07, 0xfe, 0x4a, 0xab, 0xfe,
+	0xa5, 0x55, 0x10, 0x00, 0xc0, 0x6e, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xc2, 0xaa, 0x23, 0x35,
+	0xa8, 0x44, 0x65, 0xc1, 0x34, 0xc0, 0x5a, 0x34, 0x31, 0x69, 0x9d, 0xaa, 0x9b, 0xab, 0x05, 0xfe,
+	0xe7, 0x3c, 0xa6, 0x55, 0x18, 0x96, 0xcd, 0x65, 0xa2, 0x77, 0x9c, 0xab, 0x9c, 0x99, 0x66, 0x26,
+	0x30, 0xc0, 0x6e, 0xc4, 0x26, 0x98, 0xdd, 0x95, 0xdd, 0x92, 0xff, 0x97, 0xdc, 0x00, 0xfd, 0xd7,
+	0x07, 0xfe, 0x32, 0x08, 0xfe, 0x8c, 0x92, 0x39, 0xa8, 0x44, 0x1d, 0xc0, 0x65, 0xc0, 0x1d, 0xc4,
+	0x7e, 0x1d, 0x9c, 0xaa, 0x9d, 0x9a, 0xa6, 0x65, 0xa3, 0x66, 0x35, 0xfe, 0x84, 0x51, 0xfe, 0x00,
+	0x24, 0x22, 0xa4, 0x76, 0x51, 0xc3, 0x0d, 0x9a, 0xbc, 0x2b, 0xfe, 0x7c, 0x31, 0xa7, 0x54, 0xfe,
+	0x39, 0xe7, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xc7, 0x14, 0xfe, 0x52, 0xcb, 0xaf, 0x01, 0x7e,
+	0x34, 0xc1, 0x31, 0x2a, 0x66, 0xc2, 0x9c, 0xaa, 0x41, 0xae, 0x21, 0xb0, 0x10, 0xa3, 0x66, 0x9c,
+	0xaa, 0x97, 0xcd, 0x66, 0xa2, 0x76, 0x9c, 0xaa, 0x9c, 0x9a, 0xc0, 0x35, 0xc4, 0x7e, 0xc1, 0x35,
+	0x0d, 0x97, 0xcd, 0x93, 0xfe, 0x95, 0xed, 0x00, 0xfd, 0xd3, 0xa9, 0x24, 0xfe, 0x63, 0x6e, 0x3d,
+	0xab, 0x32, 0x18, 0x1d, 0x18, 0x69, 0xc0, 0x18, 0x1d, 0xc3, 0x7e, 0x1d, 0x9c, 0xaa, 0x9d, 0x9a,
+	0x09, 0xa4, 0x66, 0x18, 0xfe, 0xa5, 0x35, 0xfe, 0x11, 0x67, 0x99, 0xdc, 0xab, 0x31, 0x52, 0x3e,
+	0xc1, 0x66, 0x08, 0xc0, 0xfe, 0x00, 0x03, 0xfe, 0x42, 0x8b, 0xfe, 0x9d, 0x35, 0x96, 0xed, 0xfe,
+	0x08, 0x61, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xca, 0xac, 0x12, 0xfe, 0x7c, 0x10, 0xa6, 0x55,
+	0x34, 0x5a, 0x2a, 0x66, 0xc4, 0x20, 0x9c, 0x9a, 0x6e, 0xaf, 0x20, 0x1d, 0xa2, 0x77, 0x9b, 0xab,
+	0x98, 0xcc, 0x2c, 0x7e, 0x11, 0x9d, 0x9a, 0x65, 0x35, 0xc1, 0x6e, 0xc0, 0x7a, 0xc0, 0x6b, 0x6e,
+	0xc0, 0x35, 0x39, 0x96, 0xdd, 0x94, 0xee, 0x96, 0xdd, 0x00, 0xfd, 0xcd, 0xa8, 0x14, 0xaf, 0x21,
+	0xfe, 0x9d, 0x14, 0xad, 0x21, 0xa6, 0x55, 0xa2, 0x77, 0x18, 0x69, 0xc1, 0x18, 0xc0, 0x1d, 0xc2,
+	0x7e, 0x1d, 0x9c, 0xaa, 0x9d, 0xaa, 0x09, 0xa4, 0x66, 0x1d, 0x3d, 0xfe, 0x3a, 0x4a, 0xfe, 0x00,
+	0x02, 0xfe, 0x29, 0xc8, 0x6e, 0x61, 0xc1, 0x3e, 0x08, 0x12, 0x99, 0xbd, 0x06, 0xfe, 0x84, 0x51,
+	0xa7, 0x44, 0xfe, 0x42, 0x49, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xcd, 0x14, 0xfe, 0x52, 0xcb,
+	0xae, 0x11, 0x7f, 0x25, 0xc3, 0x20, 0xc1, 0x25, 0x56, 0x9b, 0xbb, 0xa3, 0x66, 0xfe, 0xc6, 0x38,
+	0xad, 0x22, 0x6e, 0x9b, 0xbb, 0x98, 0xbc, 0x66, 0x31, 0x51, 0x9c, 0xaa, 0xc1, 0x3d, 0xc2, 0x6b,
+	0x6e, 0xc1, 0x7e, 0x09, 0x35, 0x34, 0x97, 0xbc, 0x94, 0xfe, 0x97, 0xdd, 0x05, 0x00, 0xfd, 0xc6,
+	0xa9, 0x14, 0xae, 0x21, 0xb0, 0x10, 0xac, 0x21, 0xa7, 0x54, 0x18, 0xc0, 0x69, 0xc3, 0x18, 0xc2,
+	0x6e, 0x7e, 0x1d, 0x9c, 0xaa, 0x1c, 0xa5, 0x55, 0xa4, 0x66, 0x52, 0x92, 0xfe, 0xfe, 0x4a, 0xcc,
+	0x0e, 0x01, 0xa2, 0x77, 0x0d, 0x66, 0xc2, 0xa2, 0x66, 0x01, 0xfe, 0x00, 0x23, 0xfe, 0x53, 0x0c,
+	0x1e, 0x95, 0xed, 0x28, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd0, 0xaa, 0x23, 0xfe, 0x73, 0xcf,
+	0xa8, 0x44, 0x51, 0x20, 0x25, 0xc0, 0x20, 0xc0, 0x5a, 0xc1, 0x20, 0x55, 0x9c, 0x9a, 0xa3, 0x77,
+	0xfe, 0xc6, 0x38, 0xad, 0x22, 0x31, 0x9c, 0xaa, 0x98, 0xcc, 0x25, 0x6f, 0x51, 0x51, 0x51, 0x7e,
+	0x09, 0xc4, 0x6e, 0x7a, 0xc0, 0x1d, 0x11, 0x3a, 0x9a, 0xbc, 0x29, 0x96, 0xdd, 0x97, 0xcc, 0x99,
+	0xcc, 0x00, 0xfd, 0xa3, 0x57, 0xab, 0x33, 0xae, 0x10, 0xae, 0x11, 0xaa, 0x33, 0xa6, 0x64, 0xa2,
+	0x77, 0x18, 0x11, 0x56, 0xc0, 0x11, 0xc2, 0x18, 0xc1, 0x6e, 0x7e, 0x11, 0x9c, 0xab, 0x1c, 0x09,
+	0xa4, 0x66, 0x24, 0x92, 0xfe, 0xfe, 0x52, 0xec, 0xfe, 0x00, 0x02, 0xac, 0x01, 0xa4, 0x66, 0x0d,
+	0xc3, 0x12, 0x7a, 0x97, 0xbe, 0x12, 0xfe, 0x8c, 0xb3, 0xa2, 0x77, 0xfe, 0x39, 0xe7, 0x00, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xd3, 0x6e, 0xfe, 0x42, 0x49, 0xb0, 0x01, 0xa3, 0x66, 0x20, 0xc1, 0x5a,
+	0xc0, 0x69, 0x66, 0xc1, 0x1d, 0x0c, 0x9d, 0x89, 0x11, 0xae, 0x11, 0xad, 0x21, 0xa2, 0x77, 0x9d,
+	0xaa, 0x98, 0xcc, 0x9d, 0x99, 0x6f, 0x25, 0x51, 0x51, 0xc0, 0x6f, 0xc1, 0x6e, 0x11, 0xc2, 0x6f,
+	0xc2, 0x0e, 0x9c, 0xaa, 0x99, 0xcc, 0x97, 0xcd, 0x97, 0xdc, 0x97, 0xdd, 0x9b, 0xaa, 0x00, 0xf5,
+	0xa3, 0x57, 0x39, 0x2d, 0xac, 0x22, 0x11, 0xa8, 0x44, 0xa4, 0x66, 0x7e, 0x18, 0x11, 0x09, 0xc0,
+	0x7a, 0x11, 0xc4, 0x18, 0x6e, 0xc0, 0x09, 0x21, 0xc0, 0x18, 0xa3, 0x66, 0x1d, 0xfe, 0xb5, 0xd7,
+	0xfe, 0x52, 0xec, 0xfe, 0x00, 0x02, 0x39, 0xa4, 0x76, 0x15, 0x12, 0xc1, 0x66, 0x12, 0x7f, 0x9b,
+	0xaa, 0x9d, 0x9b, 0xfe, 0x73, 0xf0, 0xab, 0x32, 0xfe, 0x63, 0x2d, 0x05, 0x00, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xd6, 0xa5, 0x56, 0x2d, 0xac, 0x22, 0xc0, 0x51, 0x16, 0xc0, 0x11, 0xc5, 0x56, 0x9c,
+	0xaa, 0xa3, 0x76, 0x04, 0xae, 0x10, 0x31, 0x2c, 0x99, 0xbb, 0x9b, 0xab, 0x65, 0xc0, 0x56, 0x55,
+	0x66, 0xc0, 0x7e, 0xc2, 0x1d, 0xc2, 0x25, 0xc3, 0x11, 0x9c, 0x9b, 0x99, 0xcb, 0x99, 0xbc, 0x98,
+	0xcb, 0x98, 0xdd, 0x9a, 0xbb, 0x9c, 0xa9, 0x00, 0xeb, 0x6b, 0xa8, 0x24, 0x24, 0xab, 0x21, 0xaa,
+	0x44, 0xa9, 0x43, 0xa7, 0x44, 0xa5, 0x55, 0x7f, 0x7e, 0xc0, 0x5a, 0x09, 0xc1, 0x11, 0xc5, 0x6f,
+	0xc0, 0x11, 0x9d, 0x9a, 0x51, 0x35, 0x2c, 0x6e, 0x09, 0xfe, 0xad, 0x76, 0xfe, 0x42, 0x8b, 0xfe,
+	0x00, 0x02, 0x3e, 0xa4, 0x76, 0x56, 0x65, 0x12, 0x15, 0x12, 0x15, 0x21, 0x3e, 0x01, 0xfe, 0x5b,
+	0x2d, 0xb0, 0x00, 0x98, 0xdc, 0xfe, 0x21, 0x04, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xda, 0xaa,
+	0x33, 0xfe, 0x6b, 0xaf, 0xa8, 0x44, 0x20, 0x55, 0xc4, 0x0c, 0x5a, 0xc0, 0x11, 0x09, 0x21, 0x6e,
+	0xac, 0x32, 0xad, 0x22, 0xa8, 0x43, 0xc0, 0x9b, 0xbb, 0x9a, 0xab, 0x9d, 0xa9, 0xc1, 0x56, 0x65,
+	0xc1, 0x1d, 0xc3, 0x25, 0xc2, 0x6f, 0xc1, 0x7a, 0x31, 0x25, 0x9d, 0x9a, 0x21, 0x9a, 0xbb, 0x99,
+	0xbc, 0x99, 0xcc, 0x9a, 0xba, 0x9a, 0xbb, 0x9c, 0xaa, 0x9d, 0x99, 0x00, 0xdf, 0xa2, 0x68, 0xa4,
+	0x56, 0xa6, 0x65, 0xa7, 0x44, 0xa9, 0x43, 0x25, 0xa8, 0x44, 0x31, 0xa5, 0x65, 0xa3, 0x76, 0x6f,
+	0x7e, 0xc0, 0x09, 0xc4, 0x11, 0xc4, 0x6b, 0x6e, 0xc0, 0x09, 0x21, 0xc0, 0x09, 0xa4, 0x66, 0xc0,
+	0x21, 0xfe, 0x94, 0xd3, 0xfe, 0x29, 0xc8, 0xfe, 0x00, 0x03, 0x0d, 0x29, 0x56, 0x65, 0xc2, 0x6e,
+	0x6f, 0x0d, 0x99, 0xac, 0xae, 0x30, 0xfe, 0x94, 0xf4, 0x39, 0xfe, 0x39, 0xe8, 0x00, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xde, 0xaf, 0x00, 0xfe, 0x7c, 0x10, 0xa5, 0x56, 0x9d, 0xa9, 0x0c, 0x11, 0xc0,
+	0x0c, 0x5a, 0xc1, 0x02, 0xc0, 0x09, 0x3d, 0x9d, 0x9a, 0x51, 0x25, 0xae, 0x11, 0x1d, 0xa2, 0x77,
+	0x56, 0x9a, 0xbb, 0x9b, 0xba, 0x51, 0xc1, 0x56, 0xc3, 0x25, 0xc2, 0x6e, 0xc0, 0x6b, 0xc1, 0x39,
+	0xc1, 0x6e, 0xc0, 0x39, 0x31, 0x55, 0x9d, 0xaa, 0x9c, 0xaa, 0x9c, 0xaa, 0x9b, 0xab, 0x9b, 0xba,
+	0x9c, 0xaa, 0x9b, 0xab, 0x9c, 0xaa, 0x9d, 0xa9, 0x9d, 0x9a, 0x9d, 0xa9, 0x52, 0x65, 0x55, 0x66,
+	0x00, 0xc7, 0x07, 0x0c, 0x6f, 0xa2, 0x67, 0xa3, 0x76, 0xa3, 0x66, 0x3c, 0xa5, 0x55, 0xa5, 0x65,
+	0x0d, 0xa5, 0x65, 0xa6, 0x55, 0xa6, 0x55, 0x25, 0xa4, 0x66, 0xa3, 0x66, 0x3a, 0x7f, 0xcc, 0x7e,
+	0x66, 0x11, 0xc0, 0x6f, 0xc0, 0x09, 0x9d, 0xaa, 0x55, 0xa2, 0x77, 0xa5, 0x66, 0x6e, 0x9d, 0xaa,
+	0x25, 0xfe, 0x73, 0xcf, 0x01, 0x66, 0xab, 0x31, 0xa2, 0x77, 0x21, 0xc4, 0x7e, 0x15, 0x99, 0x9d,
+	0xab, 0x51, 0xfe, 0x8c, 0xb3, 0xa3, 0x76, 0xfe, 0x52, 0xaa, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xe1, 0x14, 0xfe, 0x42, 0x49, 0xaf, 0x01, 0xa4, 0x66, 0x9d, 0xa9, 0x02, 0x09, 0xc1, 0x02, 0x66,
+	0xc4, 0x51, 0x9c, 0xab, 0xa4, 0x66, 0xad, 0x21, 0x28, 0xa8, 0x43, 0xc0, 0x18, 0x9b, 0xaa, 0x34,
+	0x25, 0xc6, 0x2a, 0x6b, 0xc2, 0x7e, 0xc4, 0x6f, 0xc0, 0x7e, 0xc4, 0x05, 0x39, 0x31, 0x51, 0x51,
+	0x55, 0x51, 0x52, 0x61, 0x55, 0x66, 0x41, 0xc0, 0x69, 0x1d, 0xc1, 0xa2, 0x76, 0x39, 0x08, 0xa3,
+	0x66, 0xa2, 0x77, 0x09, 0xa2, 0x77, 0x31, 0xa2, 0x87, 0xa2, 0x77, 0xa2, 0x66, 0x7f, 0x7e, 0x6f,
+	0xc3, 0x04, 0xc2, 0x09, 0xc8, 0x7e, 0xc0, 0x6f, 0x11, 0x09, 0x9d, 0xaa, 0x55, 0x30, 0x1d, 0xa2,
+	0x77, 0xc0, 0x21, 0xfe, 0x9d, 0x14, 0xfe, 0x42, 0x8a, 0xfe, 0x00, 0x03, 0xab, 0x01, 0xa6, 0x64,
+	0x6f, 0x51, 0xc4, 0x29, 0x51, 0x9a, 0x9c, 0x35, 0xfe, 0x84, 0x92, 0xa5, 0x65, 0xfe, 0x63, 0x2c,
+	0xfe, 0x08, 0x61, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xe4, 0x19, 0xfe, 0x4a, 0x8a, 0xad, 0x12,
+	0xa3, 0x76, 0x9d, 0xaa, 0x55, 0xc5, 0x38, 0x5a, 0x38, 0x3d, 0x35, 0x9c, 0xaa, 0x55, 0xa8, 0x54,
+	0xad, 0x21, 0xab, 0x23, 0xa5, 0x65, 0xc0, 0x18, 0x9b, 0xaa, 0x9c, 0xaa, 0x51, 0xc1, 0x6f, 0xc4,
+	0x39, 0xc3, 0x6e, 0xc0, 0x6b, 0xc1, 0x08, 0x6e, 0xc2, 0x6e, 0x1c, 0xc0, 0x21, 0xc0, 0x26, 0xc2,
+	0x30, 0xc0, 0x6e, 0xc3, 0x6e, 0xc0, 0x35, 0x3a, 0x7a, 0xcd, 0x04, 0x6e, 0xc8, 0x7e, 0xc1, 0x09,
+	0x3d, 0x26, 0x21, 0x30, 0x18, 0xa3, 0x66, 0xc0, 0x35, 0x94, 0xee, 0xfe, 0x6b, 0x6e, 0xfe, 0x00,
+	0xc5, 0x3c, 0xab, 0x31, 0xa3, 0x76, 0x56, 0x29, 0xc4, 0x35, 0x9d, 0xaa, 0x9b, 0x9a, 0x3d, 0xfe,
+	0x8c, 0x92, 0xa5, 0x55, 0xfe, 0x63, 0x4d, 0xfe, 0x10, 0xa2, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xe8, 0xa4, 0x56, 0xb0, 0x00, 0xad, 0x12, 0xa3, 0x76, 0x09, 0x38, 0x6e, 0xc1, 0x38, 0x5a, 0xc5,
+	0x51, 0x9c, 0xaa, 0x6e, 0x25, 0xac, 0x22, 0x04, 0x31, 0xc0, 0x51, 0x9c, 0xaa, 0x9b, 0xab, 0x9d,
+	0xa9, 0xc1, 0x6f, 0x7e, 0xc4, 0x6e, 0xc0, 0x05, 0xc0, 0x08, 0x0d, 0xc3, 0x6e, 0xc1, 0x6b, 0x7a,
+	0xc0, 0x6e, 0xc2, 0x26, 0xc1, 0x30, 0xc0, 0x35, 0xcb, 0x3a, 0x7a, 0xc2, 0x04, 0xc0, 0x6e, 0xc7,
+	0x11, 0xc0, 0x09, 0x04, 0x30, 0x21, 0xc0, 0xa3, 0x67, 0x1d, 0xa2, 0x77, 0xc0, 0x9a, 0xbc, 0x95,
+	0xdd, 0xfe, 0x73, 0xf0, 0x36, 0xfe, 0x00, 0x24, 0xfe, 0x29, 0xc8, 0xa5, 0x65, 0xc0, 0x55, 0x29,
+	0xc3, 0x6f, 0xc0, 0x9d, 0x99, 0x9c, 0xaa, 0xaa, 0x43, 0xaf, 0x10, 0xa5, 0x56, 0xfe, 0x63, 0x4d,
+	0x2d, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xec, 0xa3, 0x66, 0xaf, 0x01, 0xae, 0x11, 0x25, 0x0c,
+	0x41, 0xc5, 0x65, 0xc2, 0x35, 0x29, 0x9d, 0x9a, 0x9d, 0x9a, 0x7e, 0xa9, 0x43, 0x09, 0xaa, 0x33,
+	0x2c, 0x6e, 0xc0, 0x9c, 0xaa, 0x9c, 0xaa, 0x9c, 0xaa, 0x51, 0xc0, 0x6e, 0x39, 0x3e, 0x05, 0xc0,
+	0x08, 0xc1, 0x6e, 0xc3, 0x6e, 0xc0, 0x6b, 0x1c, 0x21, 0xc3, 0x26, 0xc2, 0x30, 0x6e, 0xca, 0x3a,
+	0xc0, 0x7a, 0xc3, 0x04, 0x3d, 0x04, 0xc0, 0x09, 0xc2, 0x7e, 0x09, 0xc0, 0x3d, 0x30, 0x21, 0x1c,
+	0x35, 0xa3, 0x67, 0x31, 0xc0, 0x2c, 0x21, 0x95, 0xde, 0x29, 0xfe, 0x19, 0xa8, 0xfe, 0x00, 0x44,
+	0xab, 0x10, 0xa5, 0x76, 0xa2, 0x66, 0x66, 0x56, 0x65, 0x6b, 0xc0, 0x29, 0x35, 0x38, 0x35, 0x9c,
+	0xaa, 0x3e, 0xac, 0x32, 0xad, 0x21, 0xa2, 0x77, 0xfe, 0x63, 0x2c, 0xfe, 0x10, 0xa2, 0x00, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xf0, 0x14, 0xae, 0x01, 0xae, 0x11, 0xa6, 0x55, 0x51, 0x9d, 0x9a, 0x29,
+	0xc0, 0x35, 0x29, 0xc2, 0x5a, 0x66, 0xc0, 0x26, 0x29, 0x21, 0x51, 0x9c, 0xaa, 0xc0, 0x29, 0xab,
+	0x33, 0xaa, 0x32, 0x09, 0x31, 0xc1, 0x15, 0x9c, 0xaa, 0x08, 0x41, 0x65, 0x2a, 0x7b, 0xa2, 0x66,
+	0x7f, 0xc0, 0x12, 0xc2, 0x19, 0xc0, 0x7a, 0xc0, 0x6e, 0xc3, 0x6e, 0xc0, 0x7a, 0x6b, 0x6e, 0xcb,
+	0x3a, 0xc0, 0x7a, 0xc1, 0x04, 0x09, 0xc4, 0x04, 0x35, 0x29, 0x21, 0x1c, 0x21, 0x35, 0x18, 0xa3,
+	0x66, 0xc1, 0x04, 0x34, 0x95, 0xdd, 0xfe, 0x5b, 0x0d, 0x17, 0x37, 0xaa, 0x31, 0xa5, 0x65, 0x02,
+	0x3d, 0x56, 0xc4, 0x3d, 0xc0, 0x51, 0x9c, 0x9a, 0xa3, 0x77, 0xad, 0x21, 0xab, 0x32, 0x9d, 0xaa,
+	0xfe, 0x52, 0xab, 0xfe, 0x08, 0x61, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf5, 0xac, 0x12, 0xae,
+	0x11, 0xa9, 0x34, 0xc0, 0x9d, 0xa9, 0x9d, 0xaa, 0x21, 0x7e, 0xc1, 0x21, 0xc7, 0x51, 0x9d, 0x99,
+	0x9d, 0xaa, 0xa4, 0x66, 0xa8, 0x44, 0xaa, 0x32, 0xa8, 0x55, 0x04, 0x2c, 0x31, 0xc0, 0x2c, 0x9d,
+	0x99, 0x2d, 0x9d, 0xa9, 0x51, 0x56, 0xc0, 0x39, 0x6e, 0x08, 0x0d, 0x6f, 0x7e, 0xc0, 0x6e, 0xc1,
+	0x30, 0xc1, 0x6e, 0xc9, 0x3a, 0x7a, 0xc1, 0x04, 0x09, 0xc1, 0x04, 0x3d, 0xc0, 0x35, 0xc0, 0x26,
+	0x21, 0x1c, 0xc0, 0x21, 0x35, 0x09, 0xa3, 0x67, 0x7e, 0xc0, 0x2c, 0x04, 0x39, 0x95, 0xee, 0x94,
+	0xdf, 0x93, 0xde, 0x37, 0xa6, 0x33, 0xa6, 0x75, 0x02, 0x7b, 0x02, 0x66, 0xc6, 0x38, 0x9d, 0x9a,
+	0x51, 0xa9, 0x32, 0xac, 0x32, 0xa6, 0x55, 0x99, 0xcc, 0xfe, 0x42, 0x08, 0x91, 0xff, 0x66, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xf9, 0xa7, 0x44, 0x14, 0xab, 0x22, 0xa4, 0x66, 0x9d, 0x9a, 0x9d, 0xa9,
+	0x51, 0x6f, 0xc4, 0x15, 0xc1, 0x56, 0x15, 0xc1, 0x0d, 0x51, 0x16, 0x52, 0xa3, 0x76, 0x29, 0xa9,
+	0x33, 0xa8, 0x54, 0x19, 0xa5, 0x65, 0x2c, 0x31, 0xc1, 0x51, 0x09, 0x35, 0x9d, 0xaa, 0x55, 0x56,
+	0x65, 0xc1, 0x6e, 0x7b, 0x0d, 0xc0, 0x6e, 0x7f, 0xc1, 0x26, 0x30, 0xc0, 0x69, 0xc3, 0x26, 0x21,
+	0xc2, 0x1c, 0x12, 0xc1, 0x19, 0x21, 0x2d, 0xa2, 0x77, 0x09, 0x1d, 0x31, 0xc1, 0x2c, 0x09, 0x9a,
+	0xbc, 0x99, 0xbb, 0x97, 0xdc, 0x95, 0xde, 0x94, 0xdf, 0x97, 0xce, 0x17, 0xa7, 0x74, 0xa3, 0x76,
+	0xa2, 0x77, 0x66, 0x02, 0x3d, 0xc5, 0x02, 0x3d, 0x51, 0x0d, 0xa4, 0x66, 0xab, 0x32, 0xa9, 0x43,
+	0x6e, 0x94, 0xfe, 0xfe, 0x21, 0x45, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xc0, 0xa2, 0x77,
+	0xac, 0x12, 0xad, 0x12, 0xa8, 0x44, 0xc0, 0x9d, 0xa9, 0x15, 0x0d, 0x15, 0x6f, 0xc0, 0x15, 0xc0,
+	0x0d, 0xc7, 0x66, 0x51, 0x11, 0x41, 0xc0, 0x25, 0x21, 0xa7, 0x54, 0xa8, 0x44, 0xa6, 0x55, 0xa5,
+	0x65, 0xa4, 0x66, 0xa2, 0x77, 0xa2, 0x77, 0xc3, 0x2c, 0x1d, 0x56, 0x09, 0x56, 0x65, 0x30, 0x5a,
+	0x21, 0x2d, 0x28, 0x21, 0xc1, 0x28, 0xc0, 0x30, 0x35, 0x01, 0x04, 0x09, 0x15, 0x1d, 0x2c, 0x31,
+	0xc3, 0x1d, 0x04, 0x1c, 0x9b, 0xaa, 0x9a, 0xbb, 0x98, 0xbc, 0x97, 0xdd, 0x97, 0xbd, 0x97, 0xbe,
+	0x06, 0x36, 0xa5, 0x75, 0x02, 0x11, 0xc0, 0x56, 0x02, 0x66, 0xc4, 0x02, 0x09, 0x02, 0x52, 0x9d,
+	0xa9, 0x29, 0x01, 0xaa, 0x33, 0xa4, 0x66, 0x99, 0xcc, 0x91, 0xff, 0xfe, 0x08, 0x61, 0x00, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xc5, 0xa6, 0x55, 0x31, 0x24, 0xa6, 0x45, 0x65, 0x9d, 0x9a, 0x9c,
+	0xaa, 0xc7, 0x08, 0x01, 0xc6, 0x56, 0x51, 0x41, 0x9d, 0xaa, 0x51, 0x6f, 0x0e, 0xa5, 0x65, 0xa5,
+	0x66, 0xa6, 0x54, 0xa4, 0x77, 0xa4, 0x66, 0xa4, 0x66, 0xa4, 0x65, 0xa2, 0x77, 0xa2, 0x77, 0xa2,
+	0x77, 0x18, 0x6e, 0xc0, 0x7f, 0xc1, 0x6e, 0xc2, 0x2c, 0xc1, 0x1d, 0xc0, 0x18, 0x09, 0x35, 0x21,
+	0x9d, 0xaa, 0x9d, 0x99, 0x9c, 0xaa, 0x1c, 0x9b, 0xaa, 0x9a, 0xbb, 0x99, 0xbc, 0x99, 0xbc, 0x9b,
+	0x8b, 0x12, 0x1f, 0xa4, 0x86, 0x2e, 0xa2, 0x78, 0x7e, 0x6e, 0x11, 0x66, 0x02, 0xc6, 0x0c, 0xc0,
+	0x02, 0x2e, 0x15, 0xa2, 0x77, 0x3e, 0xa9, 0x44, 0xa5, 0x65, 0x9c, 0xaa, 0x93, 0xff, 0xfe, 0x21,
+	0x04, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xcb, 0x10, 0xac, 0x12, 0xaa, 0x33, 0x1d, 0x65,
+	0x9d, 0x9a, 0x9c, 0xaa, 0x01, 0xc0, 0x0d, 0xc1, 0x66, 0x01, 0xc1, 0x39, 0xc9, 0x55, 0x62, 0x0c,
+	0x41, 0x21, 0x55, 0x42, 0xc0, 0x12, 0x26, 0x3a, 0xa2, 0x87, 0x2a, 0x39, 0xa3, 0x76, 0x6f, 0xc0,
+	0xa3, 0x76, 0xc2, 0x21, 0x15, 0xc0, 0x39, 0x51, 0x09, 0x26, 0x12, 0x33, 0x9c, 0xab, 0xc0, 0xa2,
+	0x66, 0xa1, 0x98, 0xa3, 0x86, 0x26, 0xa2, 0x87, 0x0c, 0x11, 0x16, 0x11, 0xc0, 0x0c, 0x09, 0x69,
+	0xc6, 0x0c, 0x11, 0x0c, 0x3d, 0x51, 0x55, 0x3d, 0xa8, 0x44, 0x1d, 0xa4, 0x66, 0x9d, 0xa9, 0x95,
+	0xee, 0xfe, 0x29, 0x45, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd1, 0x10, 0xab, 0x22, 0x21,
+	0xa5, 0x65, 0x1d, 0x9d, 0xa9, 0x15, 0x9d, 0x9a, 0xc2, 0x01, 0xc0, 0x39, 0xc3, 0x34, 0x69, 0x2a,
+	0xc1, 0x66, 0xc2, 0x2a, 0xc2, 0x25, 0xc0, 0x20, 0x55, 0xc0, 0x02, 0x66, 0x35, 0x29, 0xc0, 0x56,
+	0xc2, 0x29, 0xc1, 0x35, 0x3d, 0x02, 0x0c, 0x11, 0xc0, 0x16, 0xc0, 0x11, 0xc2, 0x0c, 0x09, 0x02,
+	0xc7, 0x09, 0x0c, 0x11, 0x0c, 0x3d, 0x29, 0x1a, 0x29, 0x25, 0xa8, 0x44, 0xa6, 0x55, 0x05, 0x9b,
+	0xba, 0x2d, 0x24, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd7, 0xa6, 0x45, 0xa9, 0x44, 0x3c,
+	0xa7, 0x44, 0x1d, 0x11, 0x35, 0x0d, 0x34, 0x25, 0x2a, 0x2d, 0x6f, 0xc1, 0x34, 0x2d, 0x2a, 0xc0,
+	0x25, 0xc3, 0x20, 0xc0, 0x16, 0xc0, 0x66, 0xcf, 0x0c, 0xc0, 0x09, 0xc0, 0x02, 0xcb, 0x09, 0xc0,
+	0x0c, 0x11, 0x0c, 0x02, 0x66, 0x29, 0x1a, 0x29, 0x20, 0xa7, 0x44, 0x1d, 0xa4, 0x65, 0x31, 0x99,
+	0xcb, 0x95, 0xed, 0x94, 0xee, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xdd, 0x14, 0xa7, 0x45,
+	0xa9, 0x33, 0x0d, 0xa6, 0x55, 0x1d, 0x65, 0x35, 0x9d, 0x99, 0x9d, 0xaa, 0x25, 0x20, 0xc0, 0x25,
+	0xc6, 0x20, 0xc0, 0x16, 0xc0, 0x66, 0xc3, 0x0c, 0x5a, 0xc0, 0x02, 0xc0, 0x09, 0xc0, 0x02, 0xcd,
+	0x09, 0xc0, 0x0c, 0xc0, 0x11, 0x0c, 0x09, 0x3d, 0x56, 0x65, 0x56, 0x29, 0x02, 0x39, 0xa6, 0x55,
+	0xa5, 0x65, 0xa2, 0x77, 0x56, 0x9a, 0xcb, 0x97, 0xcc, 0x95, 0xed, 0x98, 0xcc, 0x00, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xe4, 0x14, 0xa7, 0x44, 0xa8, 0x45, 0xa8, 0x33, 0x35, 0xa3, 0x76, 0x1d,
+	0x55, 0x35, 0x12, 0x9d, 0xaa, 0x51, 0x51, 0x0c, 0xc1, 0x11, 0x16, 0x11, 0x16, 0xc1, 0x11, 0xc3,
+	0x0c, 0x09, 0xc0, 0x0c, 0xc1, 0x09, 0xc3, 0x0c, 0xc6, 0x09, 0x02, 0x3d, 0x56, 0x65, 0x21, 0xc0,
+	0x29, 0x35, 0xa4, 0x66, 0xa4, 0x75, 0xa5, 0x56, 0xa4, 0x66, 0xa3, 0x76, 0xc0, 0x9d, 0x99, 0x99,
+	0xcc, 0x98, 0xcc, 0x97, 0xdc, 0x19, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xed, 0xa5, 0x55,
+	0x29, 0xa7, 0x45, 0xa6, 0x55, 0xa6, 0x55, 0xa3, 0x67, 0x1d, 0xc0, 0x65, 0x41, 0x9d, 0xaa, 0x0d,
+	0x34, 0x20, 0x0c, 0x3d, 0x66, 0x5a, 0x65, 0xc3, 0x6e, 0x35, 0xc0, 0x38, 0x3d, 0x35, 0xc0, 0x2e,
+	0xc0, 0x29, 0xc2, 0x56, 0xc1, 0x7a, 0x29, 0x3d, 0x0c, 0x25, 0xa3, 0x66, 0xa3, 0x77, 0xa3, 0x76,
+	0x1d, 0xa2, 0x77, 0x7a, 0x55, 0x9d, 0x99, 0x9a, 0xcc, 0x99, 0xcb, 0x99, 0xbb, 0x98, 0xcd, 0x00,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf7, 0x14, 0xa4, 0x66, 0xa6, 0x45, 0xa5, 0x65, 0xa5, 0x56,
+	0x01, 0xa4, 0x66, 0x09, 0x11, 0x1d, 0xc1, 0x11, 0x09, 0x65, 0x56, 0x21, 0xc0, 0x12, 0x0d, 0xc1,
+	0x66, 0xc0, 0x0d, 0xc1, 0x15, 0x21, 0x6e, 0x35, 0x09, 0x11, 0x1d, 0x7e, 0x31, 0xc0, 0x25, 0x1d,
+	0x3d, 0x9d, 0x99, 0x2d, 0x9b, 0xba, 0x9a, 0xbb, 0x9a, 0xbc, 0x9c, 0xa9, 0x00, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xc5, 0x6e, 0xa3, 0x77, 0xa3, 0x66, 0xa3, 0x67, 0x3d, 0xa3, 0x67, 0xa2,
+	0x87, 0xa3, 0x67, 0xa2, 0x77, 0xa2, 0x77, 0x6e, 0x15, 0xc4, 0x1a, 0xc0, 0x6b, 0x1a, 0x61, 0x01,
+	0x2d, 0x51, 0x51, 0x9d, 0xa9, 0x9d, 0x9a, 0x9c, 0xba, 0x9d, 0x99, 0x9d, 0xaa, 0x9d, 0x99, 0x00,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xda,
+};
@@ -1,42 +1,67 @@
 #include "text_utils.h"
 #include <cstring>
-#include <cstdio>
+
+// Powers of ten for the supported decimal counts
+static const int32_t pow10Table[] = {1, 10, 100, 1000, 10000};
+#define MAX_FIXED_DECIMALS 4
 
 void clearBuffer(char *buf)
 {
-  for (uint8_t i = 0; i < strlen(buf); i++)
-  {
-    buf[i] = '\0';
-  }
+  memset(buf, 0, strlen(buf));
 }
 
 uint8_t formatValue(char *buf, int32_t value, uint8_t decimal)
 {
-  clearBuffer(buf);
-  snprintf(buf, 22, "%d", value);
-  uint8_t len = strlen(buf);
-
-  if (decimal != 0)
-  {
-    uint8_t target = decimal + 1;
-    uint8_t numLen = len - ((value < 0) ? 1 : 0);
-    while (numLen < target)
-    {
-      for (uint8_t i = 0; i < numLen + 1; i++)
-      {
-        buf[len - i + 1] = buf[len - i];
-      }
-      buf[((value < 0) ? 1 : 0)] = '0';
-      len++;
-      numLen++;
-    }
-    for (uint8_t i = 0; i < decimal; i++)
-    {
-      buf[len - i + 1] = buf[len - i];
-    }
-    buf[len - decimal + 1] = '.';
-    buf[len + 2] = '\0';
-    len++;
+  return formatFixed(buf, value, decimal, 0);
+}
+
+// Format a fixed-point value (value / 10^decimals) as ASCII, right-aligned
+// and space-padded to `width` characters. Digits are produced back to front
+// in a single pass, so there is no shifting and no strlen().
+// buf must hold at least max(width, FORMAT_BUFFER_SIZE) bytes.
+uint8_t formatFixed(char *buf, int32_t value, uint8_t decimals, uint8_t width)
+{
+  char tmp[FORMAT_BUFFER_SIZE];
+  char *p = tmp + sizeof(tmp);
+  bool negative = value < 0;
+  // Work in unsigned so INT32_MIN does not overflow on negation
+  uint32_t v = negative ? (0u - (uint32_t)value) : (uint32_t)value;
+
+  if (decimals > MAX_FIXED_DECIMALS) {
+    decimals = MAX_FIXED_DECIMALS;
+  }
+
+  // Fractional digits, then the point, then at least one integer digit
+  for (uint8_t i = 0; i < decimals; i++) {
+    *--p = '0' + (v % 10);
+    v /= 10;
+  }
+  if (decimals) {
+    *--p = '.';
+  }
+  do {
+    *--p = '0' + (v % 10);
+    v /= 10;
+  } while (v);
+  if (negative) {
+    *--p = '-';
+  }
+
+  uint8_t len = (uint8_t)(tmp + sizeof(tmp) - p);
+  uint8_t pad = (width > len) ? (width - len) : 0;
+  memset(buf, ' ', pad);
+  memcpy(buf + pad, p, len);
+  buf[pad + len] = '\0';
+  return pad + len;
+}
+
+// Convert a float to fixed-point with the given number of decimals, rounding
+// half away from zero
+int32_t toFixed(float value, uint8_t decimals)
+{
+  if (decimals > MAX_FIXED_DECIMALS) {
+    decimals = MAX_FIXED_DECIMALS;
   }
-  return len;
+  float scaled = value * pow10Table[decimals];
+  return (int32_t)(scaled + (scaled < 0 ? -0.5f : 0.5f));
 }
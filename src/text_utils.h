@@ -3,7 +3,12 @@
 
 #include <stdint.h>
 
+// Longest string formatFixed() can produce: sign, 10 digits, point, terminator
+#define FORMAT_BUFFER_SIZE 16
+
 void clearBuffer(char *buf);
 uint8_t formatValue(char *buf, int32_t value, uint8_t decimal);
+uint8_t formatFixed(char *buf, int32_t value, uint8_t decimals, uint8_t width = 0);
+int32_t toFixed(float value, uint8_t decimals);
 
 #endif // TEXT_UTILS_H
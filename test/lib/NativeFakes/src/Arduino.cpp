@@ -0,0 +1,95 @@
+#include "Arduino.h"
+#include <stdarg.h>
+
+uint64_t fakeMicros = 0;
+bool fakeSerialEcho = false;
+HardwareSerial Serial;
+HardwareSerial Serial1;
+EspClass ESP;
+
+static uint32_t randomState = 1;
+
+long map(long x, long inMin, long inMax, long outMin, long outMax) {
+  return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+// Fixed-seed LCG so simulated data repeats run to run
+long random(long max) {
+  if (max <= 0) {
+    return 0;
+  }
+  randomState = randomState * 1103515245u + 12345u;
+  return (randomState >> 16) % max;
+}
+
+long random(long min, long max) {
+  return max > min ? min + random(max - min) : min;
+}
+
+void randomSeed(unsigned long seed) {
+  randomState = seed;
+}
+
+String::String(float value, unsigned char decimals) : String((double)value, decimals) {}
+
+String::String(double value, unsigned char decimals) {
+  char buf[48];
+  snprintf(buf, sizeof(buf), "%.*f", decimals, value);
+  text = buf;
+}
+
+int String::indexOf(char c) const {
+  size_t pos = text.find(c);
+  return pos == std::string::npos ? -1 : (int)pos;
+}
+
+String String::substring(unsigned int from, unsigned int to) const {
+  if (from > to) {
+    std::swap(from, to);
+  }
+  if (from >= text.length()) {
+    return String();
+  }
+  return String(text.substr(from, to - from));
+}
+
+size_t Print::write(const uint8_t *data, size_t size) {
+  return size;
+}
+
+size_t Print::print(long value, int base) {
+  char buf[40];
+  snprintf(buf, sizeof(buf), base == 16 ? "%lx" : "%ld", value);
+  return write(buf);
+}
+
+size_t Print::print(unsigned long value, int base) {
+  char buf[40];
+  snprintf(buf, sizeof(buf), base == 16 ? "%lx" : "%lu", value);
+  return write(buf);
+}
+
+size_t Print::print(double value, int decimals) {
+  char buf[48];
+  snprintf(buf, sizeof(buf), "%.*f", decimals, value);
+  return write(buf);
+}
+
+size_t Print::printf(const char *format, ...) {
+  char buf[256];
+  va_list args;
+  va_start(args, format);
+  int length = vsnprintf(buf, sizeof(buf), format, args);
+  va_end(args);
+  if (length < 0) {
+    return 0;
+  }
+  return write((const uint8_t *)buf, length < (int)sizeof(buf) ? length : sizeof(buf) - 1);
+}
+
+size_t HardwareSerial::write(const uint8_t *data, size_t size) {
+  if (fakeSerialEcho) {
+    fwrite(data, 1, size, stdout);
+  }
+  return size;
+}
@@ -0,0 +1,146 @@
+#ifndef FAKE_ARDUINO_H
+#define FAKE_ARDUINO_H
+
+// Just enough of the ESP32 Arduino core to build the display pipeline on
+// the host. Time is a fake clock the tests drive (FakeClock.h), Serial
+// output is discarded unless fakeSerialEcho is set.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string>
+#include <algorithm>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "FakeClock.h"
+
+using std::min;
+using std::max;
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define PROGMEM
+#define IRAM_ATTR
+#define F(x) x
+#define HIGH 1
+#define LOW 0
+#define SERIAL_8N1 0
+
+#define pgm_read_byte(p) (*(const uint8_t *)(p))
+#define pgm_read_word(p) (*(const uint16_t *)(p))
+#define pgm_read_dword(p) (*(const uint32_t *)(p))
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+inline unsigned long millis() { return fakeMicros / 1000; }
+inline unsigned long micros() { return (unsigned long)fakeMicros; }
+inline void delay(unsigned long ms) { fakeClockAdvance(ms); }
+inline void delayMicroseconds(unsigned int us) { fakeMicros += us; }
+inline void yield() {}
+
+long map(long x, long inMin, long inMax, long outMin, long outMax);
+long random(long max);
+long random(long min, long max);
+void randomSeed(unsigned long seed);
+
+class String {
+public:
+  String(const char *text = "") : text(text ? text : "") {}
+  String(const std::string &text) : text(text) {}
+  explicit String(char c) : text(1, c) {}
+  explicit String(int value) : text(std::to_string(value)) {}
+  explicit String(unsigned int value) : text(std::to_string(value)) {}
+  explicit String(long value) : text(std::to_string(value)) {}
+  explicit String(unsigned long value) : text(std::to_string(value)) {}
+  String(float value, unsigned char decimals = 2);
+  String(double value, unsigned char decimals = 2);
+
+  const char *c_str() const { return text.c_str(); }
+  unsigned int length() const { return text.length(); }
+  void reserve(unsigned int size) { text.reserve(size); }
+  char operator[](unsigned int index) const { return index < text.length() ? text[index] : 0; }
+  String &operator+=(const String &other) { text += other.text; return *this; }
+  String &operator+=(const char *other) { text += other; return *this; }
+  String &operator+=(char c) { text += c; return *this; }
+  String &operator+=(int value) { text += std::to_string(value); return *this; }
+  String &operator+=(unsigned int value) { text += std::to_string(value); return *this; }
+  String &operator+=(long value) { text += std::to_string(value); return *this; }
+  String &operator+=(unsigned long value) { text += std::to_string(value); return *this; }
+  String &operator+=(float value) { return *this += String(value); }
+  bool operator==(const String &other) const { return text == other.text; }
+  bool operator==(const char *other) const { return text == other; }
+  bool operator!=(const String &other) const { return text != other.text; }
+  bool operator!=(const char *other) const { return text != other; }
+  long toInt() const { return atol(text.c_str()); }
+  float toFloat() const { return (float)atof(text.c_str()); }
+  int indexOf(char c) const;
+  bool startsWith(const String &prefix) const { return text.compare(0, prefix.text.length(), prefix.text) == 0; }
+  String substring(unsigned int from) const { return from < text.length() ? String(text.substr(from)) : String(); }
+  String substring(unsigned int from, unsigned int to) const;
+
+private:
+  std::string text;
+};
+
+inline String operator+(const String &a, const String &b) { String s(a); s += b; return s; }
+inline String operator+(const String &a, const char *b) { String s(a); s += b; return s; }
+inline String operator+(const char *a, const String &b) { String s(a); s += b; return s; }
+
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) { return write(&c, 1); }
+  virtual size_t write(const uint8_t *data, size_t size);
+  size_t write(const char *text) { return write((const uint8_t *)text, strlen(text)); }
+  size_t print(const char *text) { return write(text); }
+  size_t print(const String &text) { return write(text.c_str()); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(int value, int base = 10) { return print((long)value, base); }
+  size_t print(unsigned int value, int base = 10) { return print((unsigned long)value, base); }
+  size_t print(long value, int base = 10);
+  size_t print(unsigned long value, int base = 10);
+  size_t print(double value, int decimals = 2);
+  size_t println() { return write("\r\n"); }
+  template <typename T> size_t println(const T &value) { return print(value) + println(); }
+  template <typename T> size_t println(const T &value, int format) { return print(value, format) + println(); }
+  size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+class HardwareSerial : public Print {
+public:
+  void begin(unsigned long, uint32_t = SERIAL_8N1, int8_t = -1, int8_t = -1) {}
+  int available() { return 0; }
+  int read() { return -1; }
+  int peek() { return -1; }
+  void flush() {}
+  void setTimeout(unsigned long) {}
+  size_t readBytes(uint8_t *, size_t) { return 0; }
+  size_t readBytes(char *, size_t) { return 0; }
+  operator bool() const { return true; }
+  size_t write(const uint8_t *data, size_t size) override;
+  using Print::write;
+};
+
+// Print Serial output to stdout (off by default to keep test logs short)
+extern bool fakeSerialEcho;
+extern HardwareSerial Serial;
+extern HardwareSerial Serial1;
+
+class EspClass {
+public:
+  uint32_t getFreeHeap() { return 200 * 1024; }
+  uint32_t getMinFreeHeap() { return 200 * 1024; }
+  uint32_t getMaxAllocHeap() { return 100 * 1024; }
+  uint32_t getHeapSize() { return 300 * 1024; }
+  uint32_t getCpuFreqMHz() { return 240; }
+  uint32_t getCycleCount() { return (uint32_t)(fakeMicros * 240); }
+  void restart() {}
+};
+
+extern EspClass ESP;
+
+#endif // FAKE_ARDUINO_H
@@ -0,0 +1,18 @@
+#ifndef FAKE_CLOCK_H
+#define FAKE_CLOCK_H
+
+#include <stdint.h>
+
+// Host time for millis(), micros() and esp_timer_get_time(). Nothing moves
+// it but the test (and delay()), so frames are reproducible.
+extern uint64_t fakeMicros;
+
+// Modelled time the panel bus has spent sending so far. esp_timer_get_time()
+// adds it, so profiler scopes see the cost of SPI pushes; millis() and
+// micros() do not, so filters and timers are unaffected.
+uint64_t fakeBusMicros();
+
+inline void fakeClockSet(uint32_t ms) { fakeMicros = (uint64_t)ms * 1000; }
+inline void fakeClockAdvance(uint32_t ms) { fakeMicros += (uint64_t)ms * 1000; }
+
+#endif // FAKE_CLOCK_H
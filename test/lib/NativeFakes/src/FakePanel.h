@@ -0,0 +1,29 @@
+#ifndef FAKE_PANEL_H
+#define FAKE_PANEL_H
+
+#include <stdint.h>
+
+// Test hooks into the panel behind the fake TFT_eSPI
+
+struct FakeSpiStats {
+  uint32_t bytes;          // Commands, addresses and pixel data
+  uint32_t transactions;   // Address windows opened
+  uint32_t calls;          // Blocking SPI driver calls (see TFT_eSPI.cpp)
+};
+
+FakeSpiStats fakeSpiStats();
+void fakeSpiReset();
+
+// RGB565, row-major at the current rotation's width and height
+const uint16_t *fakePanelPixels();
+int32_t fakePanelWidth();
+int32_t fakePanelHeight();
+
+// FNV-1a over the framebuffer, for golden frames
+uint32_t fakePanelHash();
+
+// Binary PPM in the same form as the on-device capture (FrameCapture.h),
+// so tools/frame_capture.py --golden can compare the two
+bool fakePanelSavePpm(const char *path);
+
+#endif // FAKE_PANEL_H
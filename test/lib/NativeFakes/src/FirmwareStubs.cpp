@@ -0,0 +1,21 @@
+// Firmware modules the native environment does not build (NVS config
+// store, splash animation) reduced to what the display pipeline calls:
+// every record loads its defaults and nothing is persisted.
+
+#include "ConfigStore.h"
+#include "DisplayConfig.h"
+#include "ChannelBands.h"
+#include "SplashScreen.h"
+
+bool configLoad(ConfigRecordId id) {
+  if (id == CONFIG_RECORD_DISPLAY) {
+    currentDisplayConfig = defaultDisplayConfig;
+  } else if (id == CONFIG_RECORD_BANDS) {
+    channelBands = defaultChannelBands;
+  }
+  return false;
+}
+
+void configMarkDirty(ConfigRecordId id) {}
+
+void showAnimatedSplashScreen() {}
@@ -0,0 +1,22 @@
+#ifndef FAKE_SPI_H
+#define FAKE_SPI_H
+
+#include <stdint.h>
+
+#define VSPI 3
+#define HSPI 2
+
+// The panel bus writes RGB666 pixel bytes into the fake panel's current
+// address window; other buses (SD card) accept and ignore everything.
+class SPIClass {
+public:
+  explicit SPIClass(uint8_t bus = VSPI) : bus(bus) {}
+  void begin(int8_t sck = -1, int8_t miso = -1, int8_t mosi = -1, int8_t ss = -1) {}
+  void writeBytes(const uint8_t *data, uint32_t size);
+  void writePattern(const uint8_t *data, uint8_t size, uint32_t repeat);
+
+private:
+  uint8_t bus;
+};
+
+#endif // FAKE_SPI_H
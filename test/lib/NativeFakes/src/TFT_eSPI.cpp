@@ -0,0 +1,558 @@
+#include "TFT_eSPI.h"
+#include "FakePanel.h"
+
+// Column address, row address and memory write commands per window
+#define SPI_WINDOW_BYTES 11
+#define SPI_BYTES_PER_PIXEL 3
+
+#define PANEL_PIXELS (TFT_WIDTH * TFT_HEIGHT)
+
+// Bus time model behind fakeBusMicros(): bytes at the panel clock, plus a
+// fixed cost for each blocking driver call (bus lock, register setup, wait
+// for completion). The call cost is an estimate for the ESP32 Arduino SPI
+// driver, not a measurement.
+#ifndef SPI_FREQUENCY
+#define SPI_FREQUENCY 27000000
+#endif
+#define SPI_CALL_OVERHEAD_NS 1000
+
+static uint16_t panel[PANEL_PIXELS];
+static int32_t panelWidth = TFT_WIDTH;
+static int32_t panelHeight = TFT_HEIGHT;
+static FakeSpiStats stats;
+static uint64_t busBytes;   // Never reset, so bus time only moves forward
+static uint64_t busCalls;
+
+// Address window for raw pixel writes (setWindow + pushPixels / SPI)
+static int32_t windowX0, windowY0, windowX1, windowY1;
+static int32_t cursorX, cursorY;
+
+static SPIClass panelSpi(VSPI);
+
+static uint16_t swap16(uint16_t value) {
+  return (value << 8) | (value >> 8);
+}
+
+static uint32_t readU32(const uint8_t *p) {
+  return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static void countCalls(uint32_t calls) {
+  stats.calls += calls;
+  busCalls += calls;
+}
+
+static void openWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1) {
+  windowX0 = x0;
+  windowY0 = y0;
+  windowX1 = x1;
+  windowY1 = y1;
+  cursorX = x0;
+  cursorY = y0;
+  stats.bytes += SPI_WINDOW_BYTES;
+  stats.transactions++;
+  busBytes += SPI_WINDOW_BYTES;
+  countCalls(1);
+}
+
+// One pixel into the address window, wrapping like the controller does
+static void streamPixel(uint16_t color) {
+  if (cursorX >= 0 && cursorX < panelWidth && cursorY >= 0 && cursorY < panelHeight) {
+    panel[cursorY * panelWidth + cursorX] = color;
+  }
+  stats.bytes += SPI_BYTES_PER_PIXEL;
+  busBytes += SPI_BYTES_PER_PIXEL;
+  if (++cursorX > windowX1) {
+    cursorX = windowX0;
+    if (++cursorY > windowY1) {
+      cursorY = windowY0;
+    }
+  }
+}
+
+// ---- Test hooks ----
+
+FakeSpiStats fakeSpiStats() {
+  return stats;
+}
+
+void fakeSpiReset() {
+  stats.bytes = 0;
+  stats.transactions = 0;
+  stats.calls = 0;
+}
+
+uint64_t fakeBusMicros() {
+  return (busBytes * 8 * 1000000 / SPI_FREQUENCY) + busCalls * SPI_CALL_OVERHEAD_NS / 1000;
+}
+
+const uint16_t *fakePanelPixels() {
+  return panel;
+}
+
+int32_t fakePanelWidth() {
+  return panelWidth;
+}
+
+int32_t fakePanelHeight() {
+  return panelHeight;
+}
+
+uint32_t fakePanelHash() {
+  uint32_t hash = 2166136261u;
+  for (int32_t i = 0; i < panelWidth * panelHeight; i++) {
+    hash = (hash ^ (panel[i] & 0xFF)) * 16777619u;
+    hash = (hash ^ (panel[i] >> 8)) * 16777619u;
+  }
+  return hash;
+}
+
+bool fakePanelSavePpm(const char *path) {
+  FILE *file = fopen(path, "wb");
+  if (file == nullptr) {
+    return false;
+  }
+  fprintf(file, "P6\n%d %d\n255\n", (int)panelWidth, (int)panelHeight);
+  for (int32_t i = 0; i < panelWidth * panelHeight; i++) {
+    uint16_t color = panel[i];
+    uint8_t r = (color >> 11) & 0x1F;
+    uint8_t g = (color >> 5) & 0x3F;
+    uint8_t b = color & 0x1F;
+    uint8_t rgb[3] = {(uint8_t)((r << 3) | (r >> 2)), (uint8_t)((g << 2) | (g >> 4)), (uint8_t)((b << 3) | (b >> 2))};
+    fwrite(rgb, 1, 3, file);
+  }
+  return fclose(file) == 0;
+}
+
+// ---- SPI ----
+
+// RGB666 bytes (top 6 bits of each) back to RGB565
+static void streamRgb666(const uint8_t *data, uint32_t size) {
+  for (uint32_t i = 0; i + 2 < size; i += 3) {
+    streamPixel(((data[i] & 0xF8) << 8) | ((data[i + 1] & 0xFC) << 3) | (data[i + 2] >> 3));
+  }
+}
+
+// Both are a single driver call however much they send
+void SPIClass::writeBytes(const uint8_t *data, uint32_t size) {
+  if (bus != VSPI) {
+    return;
+  }
+  countCalls(1);
+  streamRgb666(data, size);
+}
+
+void SPIClass::writePattern(const uint8_t *data, uint8_t size, uint32_t repeat) {
+  if (bus != VSPI) {
+    return;
+  }
+  countCalls(1);
+  for (uint32_t i = 0; i < repeat; i++) {
+    streamRgb666(data, size);
+  }
+}
+
+// ---- TFT_eSPI ----
+
+TFT_eSPI::TFT_eSPI(int16_t w, int16_t h)
+    : _width(w), _height(h), _initWidth(w), _initHeight(h), swapBytes(false),
+      glyphs(nullptr), glyphCount(0), maxAscent(0), maxDescent(0), yAdvance(0), ascent(0), spaceWidth(0),
+      textcolor(TFT_WHITE), textbgcolor(TFT_BLACK), textdatum(TL_DATUM), textsize(1) {}
+
+TFT_eSPI::~TFT_eSPI() {
+  unloadFont();
+}
+
+void TFT_eSPI::init() {
+  memset(panel, 0, sizeof(panel));
+  fakeSpiReset();
+}
+
+void TFT_eSPI::setRotation(uint8_t rotation) {
+  bool landscape = rotation & 1;
+  _width = landscape ? _initHeight : _initWidth;
+  _height = landscape ? _initWidth : _initHeight;
+  panelWidth = _width;
+  panelHeight = _height;
+}
+
+void TFT_eSPI::writeBlock(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *colors, uint16_t fill) {
+  // Clip, keeping the source stride for image data
+  int32_t stride = w;
+  int32_t srcX = 0;
+  int32_t srcY = 0;
+  if (x < 0) { srcX = -x; w += x; x = 0; }
+  if (y < 0) { srcY = -y; h += y; y = 0; }
+  if (x + w > _width) w = _width - x;
+  if (y + h > _height) h = _height - y;
+  if (w <= 0 || h <= 0) {
+    return;
+  }
+  openWindow(x, y, x + w - 1, y + h - 1);
+  // A solid fill is one block write; image data goes out pixel by pixel,
+  // three spi.transfer() calls each (TFT_eSPI's tft_Write_16 on the ILI9488)
+  countCalls(colors ? w * h * 3 : 1);
+  for (int32_t row = 0; row < h; row++) {
+    for (int32_t col = 0; col < w; col++) {
+      streamPixel(colors ? colors[(srcY + row) * stride + srcX + col] : fill);
+    }
+  }
+}
+
+uint16_t TFT_eSPI::getPixel(int32_t x, int32_t y) {
+  if (x < 0 || y < 0 || x >= _width || y >= _height) {
+    return 0;
+  }
+  return panel[y * _width + x];
+}
+
+void TFT_eSPI::fillScreen(uint32_t color) {
+  fillRect(0, 0, _width, _height, color);
+}
+
+void TFT_eSPI::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+  writeBlock(x, y, w, h, nullptr, color);
+}
+
+void TFT_eSPI::drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+  drawFastHLine(x, y, w, color);
+  drawFastHLine(x, y + h - 1, w, color);
+  drawFastVLine(x, y + 1, h - 2, color);
+  drawFastVLine(x + w - 1, y + 1, h - 2, color);
+}
+
+void TFT_eSPI::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) {
+  writeBlock(x, y, w, 1, nullptr, color);
+}
+
+void TFT_eSPI::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) {
+  writeBlock(x, y, 1, h, nullptr, color);
+}
+
+void TFT_eSPI::drawPixel(int32_t x, int32_t y, uint32_t color) {
+  writeBlock(x, y, 1, 1, nullptr, color);
+}
+
+uint16_t TFT_eSPI::readPixel(int32_t x, int32_t y) {
+  return getPixel(x, y);
+}
+
+void TFT_eSPI::readRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data) {
+  for (int32_t row = 0; row < h; row++) {
+    for (int32_t col = 0; col < w; col++) {
+      *data++ = swap16(getPixel(x + col, y + row));
+    }
+  }
+}
+
+// Corner arcs, as in TFT_eSPI / Adafruit GFX
+void TFT_eSPI::drawCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t cornername, uint32_t color) {
+  int32_t f = 1 - r;
+  int32_t ddF_x = 1;
+  int32_t ddF_y = -2 * r;
+  int32_t x = 0;
+  int32_t y = r;
+  while (x < y) {
+    if (f >= 0) {
+      y--;
+      ddF_y += 2;
+      f += ddF_y;
+    }
+    x++;
+    ddF_x += 2;
+    f += ddF_x;
+    if (cornername & 0x4) {
+      drawPixel(x0 + x, y0 + y, color);
+      drawPixel(x0 + y, y0 + x, color);
+    }
+    if (cornername & 0x2) {
+      drawPixel(x0 + x, y0 - y, color);
+      drawPixel(x0 + y, y0 - x, color);
+    }
+    if (cornername & 0x8) {
+      drawPixel(x0 - y, y0 + x, color);
+      drawPixel(x0 - x, y0 + y, color);
+    }
+    if (cornername & 0x1) {
+      drawPixel(x0 - y, y0 - x, color);
+      drawPixel(x0 - x, y0 - y, color);
+    }
+  }
+}
+
+void TFT_eSPI::drawRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color) {
+  drawFastHLine(x + r, y, w - r - r, color);
+  drawFastHLine(x + r, y + h - 1, w - r - r, color);
+  drawFastVLine(x, y + r, h - r - r, color);
+  drawFastVLine(x + w - 1, y + r, h - r - r, color);
+  drawCircleHelper(x + r, y + r, r, 1, color);
+  drawCircleHelper(x + w - r - 1, y + r, r, 2, color);
+  drawCircleHelper(x + w - r - 1, y + h - r - 1, r, 4, color);
+  drawCircleHelper(x + r, y + h - r - 1, r, 8, color);
+}
+
+uint16_t TFT_eSPI::alphaBlend(uint8_t alpha, uint16_t fgc, uint16_t bgc) {
+  uint32_t rxb = bgc & 0xF81F;
+  rxb += ((fgc & 0xF81F) - rxb) * (alpha >> 2) >> 6;
+  uint32_t xgx = bgc & 0x07E0;
+  xgx += ((fgc & 0x07E0) - xgx) * alpha >> 8;
+  return (rxb & 0xF81F) | (xgx & 0x07E0);
+}
+
+uint16_t TFT_eSPI::color565(uint8_t r, uint8_t g, uint8_t b) {
+  return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+}
+
+// ---- Raw pixel path ----
+
+void TFT_eSPI::setWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1) {
+  openWindow(x0, y0, x1, y1);
+}
+
+// With swapBytes the data is plain RGB565 values; without, it is already
+// in wire (byte-swapped) order like sprite buffers
+void TFT_eSPI::pushPixels(const void *data, uint32_t len) {
+  const uint16_t *pixels = (const uint16_t *)data;
+  countCalls(len * 3);
+  for (uint32_t i = 0; i < len; i++) {
+    streamPixel(swapBytes ? pixels[i] : swap16(pixels[i]));
+  }
+}
+
+SPIClass &TFT_eSPI::getSPIinstance() {
+  return panelSpi;
+}
+
+// ---- Text ----
+
+void TFT_eSPI::loadFont(const uint8_t *array) {
+  unloadFont();
+  if (array == nullptr) {
+    return;
+  }
+  // VLW header: glyph count, version, size, unused, ascent, descent
+  glyphCount = readU32(array);
+  ascent = readU32(array + 16);
+  int16_t descent = readU32(array + 20);
+  glyphs = new Glyph[glyphCount];
+  spaceWidth = (ascent + descent) * 2 / 7;
+  maxAscent = ascent;
+  maxDescent = descent;
+
+  // 28 bytes of metrics per glyph, then the 8-bit alpha bitmaps in order
+  const uint8_t *metrics = array + 24;
+  const uint8_t *bitmap = metrics + glyphCount * 28;
+  for (uint16_t i = 0; i < glyphCount; i++, metrics += 28) {
+    Glyph &glyph = glyphs[i];
+    glyph.unicode = readU32(metrics);
+    glyph.height = readU32(metrics + 4);
+    glyph.width = readU32(metrics + 8);
+    glyph.xAdvance = readU32(metrics + 12);
+    glyph.dY = (int16_t)readU32(metrics + 16);
+    glyph.dX = (int8_t)readU32(metrics + 20);
+    glyph.bitmap = bitmap;
+    bitmap += glyph.width * glyph.height;
+
+    bool printable = (glyph.unicode > 0x20 && glyph.unicode < 0xA0 && glyph.unicode != 0x7F) || glyph.unicode > 0xFF;
+    if (printable && glyph.dY > maxAscent) {
+      maxAscent = glyph.dY;
+    }
+    if (printable && glyph.height - glyph.dY > maxDescent) {
+      maxDescent = glyph.height - glyph.dY;
+    }
+    if (glyph.unicode == 0x20) {
+      spaceWidth = glyph.xAdvance;
+    }
+  }
+  yAdvance = maxAscent + maxDescent;
+}
+
+void TFT_eSPI::unloadFont() {
+  delete[] glyphs;
+  glyphs = nullptr;
+  glyphCount = 0;
+}
+
+const TFT_eSPI::Glyph *TFT_eSPI::findGlyph(uint32_t unicode) const {
+  for (uint16_t i = 0; i < glyphCount; i++) {
+    if (glyphs[i].unicode == unicode) {
+      return &glyphs[i];
+    }
+  }
+  return nullptr;
+}
+
+// A background equal to the foreground means transparent text
+void TFT_eSPI::setTextColor(uint16_t color) {
+  textcolor = color;
+  textbgcolor = color;
+}
+
+void TFT_eSPI::setTextColor(uint16_t fgcolor, uint16_t bgcolor, bool bgfill) {
+  textcolor = fgcolor;
+  textbgcolor = bgcolor;
+}
+
+int16_t TFT_eSPI::fontHeight() {
+  return glyphs ? yAdvance : 8 * textsize;
+}
+
+int16_t TFT_eSPI::textWidth(const char *string) {
+  int32_t width = 0;
+  if (glyphs == nullptr) {
+    return strlen(string) * 6 * textsize;
+  }
+  while (*string) {
+    uint8_t c = *string++;
+    if (c == ' ') {
+      width += spaceWidth;
+      continue;
+    }
+    const Glyph *glyph = findGlyph(c);
+    if (glyph == nullptr) {
+      width += spaceWidth + 1;
+      continue;
+    }
+    if (width == 0 && glyph->dX < 0) {
+      width -= glyph->dX;
+    }
+    width += *string ? glyph->xAdvance : glyph->dX + glyph->width;
+  }
+  return width;
+}
+
+// Draw one character with its top-left text cell at x,y; returns the advance
+int32_t TFT_eSPI::drawChar(uint8_t c, int32_t x, int32_t y) {
+  bool transparent = textcolor == textbgcolor;
+  if (glyphs == nullptr) {
+    // Placeholder cell: the character code as a 5x7 bit pattern
+    int32_t w = 6 * textsize;
+    int32_t h = 8 * textsize;
+    uint16_t cell[48 * 64];
+    for (int32_t row = 0; row < h; row++) {
+      for (int32_t col = 0; col < w; col++) {
+        int32_t bit = (col / textsize) * 7 + row / textsize;
+        bool on = col / textsize < 5 && row / textsize < 7 && ((c * 2654435761u) >> (bit % 32)) & 1;
+        cell[row * w + col] = on ? textcolor : (transparent ? getPixel(x + col, y + row) : textbgcolor);
+      }
+    }
+    if (w <= 48 && h <= 64) {
+      writeBlock(x, y, w, h, cell, 0);
+    }
+    return w;
+  }
+
+  if (c == ' ') {
+    return spaceWidth;
+  }
+  const Glyph *glyph = findGlyph(c);
+  if (glyph == nullptr) {
+    drawRect(x, y + maxAscent - ascent, spaceWidth, ascent, textcolor);
+    return spaceWidth + 1;
+  }
+  int32_t left = x + glyph->dX;
+  int32_t top = y + maxAscent - glyph->dY;
+  int32_t count = glyph->width * glyph->height;
+  if (count > 0) {
+    uint16_t *pixels = new uint16_t[count];
+    for (int32_t i = 0; i < count; i++) {
+      uint8_t alpha = glyph->bitmap[i];
+      uint16_t bg = transparent ? getPixel(left + i % glyph->width, top + i / glyph->width) : textbgcolor;
+      pixels[i] = alpha == 0xFF ? textcolor : (alpha == 0 ? bg : alphaBlend(alpha, textcolor, bg));
+    }
+    writeBlock(left, top, glyph->width, glyph->height, pixels, 0);
+    delete[] pixels;
+  }
+  return glyph->xAdvance;
+}
+
+int16_t TFT_eSPI::drawString(const char *string, int32_t x, int32_t y) {
+  int32_t width = textWidth(string);
+  int32_t height = fontHeight();
+  switch (textdatum) {
+    case TC_DATUM: x -= width / 2; break;
+    case TR_DATUM: x -= width; break;
+    case ML_DATUM: y -= height / 2; break;
+    case MC_DATUM: x -= width / 2; y -= height / 2; break;
+    case MR_DATUM: x -= width; y -= height / 2; break;
+    case BL_DATUM: y -= height; break;
+    case BC_DATUM: x -= width / 2; y -= height; break;
+    case BR_DATUM: x -= width; y -= height; break;
+  }
+  if (glyphs != nullptr && *string) {
+    // textWidth() counts a negative first offset; the cursor starts after it
+    const Glyph *first = findGlyph((uint8_t)*string);
+    if (first != nullptr && first->dX < 0) {
+      x -= first->dX;
+    }
+  }
+  while (*string) {
+    x += drawChar(*string++, x, y);
+  }
+  return width;
+}
+
+// Rounds half away from zero like TFT_eSPI, then draws as a string
+int16_t TFT_eSPI::drawFloat(float value, uint8_t decimals, int32_t x, int32_t y) {
+  char text[24];
+  snprintf(text, sizeof(text), "%.*f", decimals > 7 ? 7 : decimals, value);
+  return drawString(text, x, y);
+}
+
+// ---- TFT_eSprite ----
+
+TFT_eSprite::TFT_eSprite(TFT_eSPI *tft) : TFT_eSPI(0, 0), tft(tft), buffer(nullptr), colorDepth(16) {}
+
+TFT_eSprite::~TFT_eSprite() {
+  deleteSprite();
+}
+
+void *TFT_eSprite::createSprite(int16_t w, int16_t h, uint8_t frames) {
+  if (buffer != nullptr) {
+    return buffer;
+  }
+  _width = _initWidth = w;
+  _height = _initHeight = h;
+  buffer = new uint16_t[w * h]();
+  return buffer;
+}
+
+void TFT_eSprite::deleteSprite() {
+  delete[] buffer;
+  buffer = nullptr;
+}
+
+void TFT_eSprite::writeBlock(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *colors, uint16_t fill) {
+  if (buffer == nullptr) {
+    return;
+  }
+  for (int32_t row = 0; row < h; row++) {
+    for (int32_t col = 0; col < w; col++) {
+      int32_t px = x + col;
+      int32_t py = y + row;
+      if (px >= 0 && py >= 0 && px < _width && py < _height) {
+        buffer[py * _width + px] = swap16(colors ? colors[row * w + col] : fill);
+      }
+    }
+  }
+}
+
+uint16_t TFT_eSprite::getPixel(int32_t x, int32_t y) {
+  if (buffer == nullptr || x < 0 || y < 0 || x >= _width || y >= _height) {
+    return 0;
+  }
+  return swap16(buffer[y * _width + x]);
+}
+
+void TFT_eSprite::pushSprite(int32_t x, int32_t y) {
+  if (buffer == nullptr) {
+    return;
+  }
+  // Through the panel's clipping and accounting: one window per push
+  uint16_t *pixels = new uint16_t[_width * _height];
+  for (int32_t i = 0; i < _width * _height; i++) {
+    pixels[i] = swap16(buffer[i]);
+  }
+  tft->writeBlock(x, y, _width, _height, pixels, 0);
+  delete[] pixels;
+}
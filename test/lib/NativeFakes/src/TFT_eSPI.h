@@ -0,0 +1,163 @@
+#ifndef FAKE_TFT_ESPI_H
+#define FAKE_TFT_ESPI_H
+
+// Host stand-in for TFT_eSPI driving an ILI9488 in SPI mode. The panel is
+// an in-memory RGB565 framebuffer; everything sent to it is accounted the
+// way the real bus sees it (3 bytes per pixel, 11 bytes of address window
+// commands per transaction), so tests can check frames pixel for pixel and
+// count SPI traffic. See FakePanel.h for the test hooks.
+//
+// Smooth fonts are the real VLW arrays, rendered with the same metrics and
+// datum rules as TFT_eSPI. Without a loaded font, text is drawn as 6x8
+// placeholder cells.
+
+#include <Arduino.h>
+#include <SPI.h>
+
+#define TFT_BLACK       0x0000
+#define TFT_NAVY        0x000F
+#define TFT_DARKGREEN   0x03E0
+#define TFT_DARKCYAN    0x03EF
+#define TFT_MAROON      0x7800
+#define TFT_PURPLE      0x780F
+#define TFT_OLIVE       0x7BE0
+#define TFT_LIGHTGREY   0xD69A
+#define TFT_DARKGREY    0x7BEF
+#define TFT_BLUE        0x001F
+#define TFT_GREEN       0x07E0
+#define TFT_CYAN        0x07FF
+#define TFT_RED         0xF800
+#define TFT_MAGENTA     0xF81F
+#define TFT_YELLOW      0xFFE0
+#define TFT_WHITE       0xFFFF
+#define TFT_ORANGE      0xFDA0
+#define TFT_GREENYELLOW 0xB7E0
+#define TFT_PINK        0xFE19
+
+#define TL_DATUM 0
+#define TC_DATUM 1
+#define TR_DATUM 2
+#define ML_DATUM 3
+#define MC_DATUM 4
+#define MR_DATUM 5
+#define BL_DATUM 6
+#define BC_DATUM 7
+#define BR_DATUM 8
+
+#define TFT_WIDTH  320
+#define TFT_HEIGHT 480
+
+class TFT_eSPI {
+public:
+  TFT_eSPI(int16_t w = TFT_WIDTH, int16_t h = TFT_HEIGHT);
+  virtual ~TFT_eSPI();
+
+  void init();
+  void setRotation(uint8_t rotation);
+  int16_t width() const { return _width; }
+  int16_t height() const { return _height; }
+
+  void fillScreen(uint32_t color);
+  void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+  void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+  void drawRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color);
+  void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color);
+  void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color);
+  void drawPixel(int32_t x, int32_t y, uint32_t color);
+  uint16_t readPixel(int32_t x, int32_t y);
+  // Byte-swapped RGB565, as the real readRect() returns it
+  void readRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data);
+  uint16_t alphaBlend(uint8_t alpha, uint16_t fgc, uint16_t bgc);
+  uint16_t color565(uint8_t r, uint8_t g, uint8_t b);
+
+  void loadFont(const uint8_t *array);
+  void unloadFont();
+  void setTextColor(uint16_t color);
+  void setTextColor(uint16_t fgcolor, uint16_t bgcolor, bool bgfill = false);
+  void setTextDatum(uint8_t datum) { textdatum = datum; }
+  void setTextSize(uint8_t size) { textsize = size ? size : 1; }
+  void setTextPadding(uint16_t) {}
+  int16_t drawString(const char *string, int32_t x, int32_t y);
+  int16_t drawString(const String &string, int32_t x, int32_t y) { return drawString(string.c_str(), x, y); }
+  int16_t drawFloat(float value, uint8_t decimals, int32_t x, int32_t y);
+  int16_t textWidth(const char *string);
+  int16_t textWidth(const String &string) { return textWidth(string.c_str()); }
+  int16_t fontHeight();
+
+  // Raw pixel path used by NativePush
+  void startWrite() {}
+  void endWrite() {}
+  void setWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1);
+  void pushPixels(const void *data, uint32_t len);
+  void setSwapBytes(bool swap) { swapBytes = swap; }
+  bool getSwapBytes() const { return swapBytes; }
+  SPIClass &getSPIinstance();
+
+protected:
+  friend class TFT_eSprite;
+
+  // Every primitive ends here: write a clipped block of pixels (colors is
+  // row-major w*h, or nullptr for a solid fill) and read one back.
+  virtual void writeBlock(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *colors, uint16_t fill);
+  virtual uint16_t getPixel(int32_t x, int32_t y);
+
+  int16_t _width;
+  int16_t _height;
+  int16_t _initWidth;
+  int16_t _initHeight;
+  bool swapBytes;
+
+private:
+  struct Glyph {
+    uint32_t unicode;
+    int16_t height;
+    int16_t width;
+    int16_t xAdvance;
+    int16_t dY;
+    int16_t dX;
+    const uint8_t *bitmap;
+  };
+
+  void drawCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t cornername, uint32_t color);
+  const Glyph *findGlyph(uint32_t unicode) const;
+  int32_t drawChar(uint8_t c, int32_t x, int32_t y);
+
+  Glyph *glyphs;
+  uint16_t glyphCount;
+  int16_t maxAscent;
+  int16_t maxDescent;
+  int16_t yAdvance;
+  int16_t ascent;
+  int16_t spaceWidth;
+
+  uint16_t textcolor;
+  uint16_t textbgcolor;
+  uint8_t textdatum;
+  uint8_t textsize;
+};
+
+class TFT_eSprite : public TFT_eSPI {
+public:
+  explicit TFT_eSprite(TFT_eSPI *tft);
+  ~TFT_eSprite();
+
+  void *createSprite(int16_t w, int16_t h, uint8_t frames = 1);
+  void deleteSprite();
+  bool created() const { return buffer != nullptr; }
+  void setColorDepth(int8_t depth) { colorDepth = depth; }
+  int8_t getColorDepth() const { return colorDepth; }
+  void *getPointer() { return buffer; }
+  void fillSprite(uint32_t color) { fillRect(0, 0, _width, _height, color); }
+  void pushSprite(int32_t x, int32_t y);
+
+protected:
+  void writeBlock(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *colors, uint16_t fill) override;
+  uint16_t getPixel(int32_t x, int32_t y) override;
+
+private:
+  TFT_eSPI *tft;
+  uint16_t *buffer;   // Byte-swapped RGB565, as TFT_eSPI stores 16-bit sprites
+  int8_t colorDepth;
+};
+
+#endif // FAKE_TFT_ESPI_H
@@ -0,0 +1,9 @@
+#ifndef FAKE_ESP_TIMER_H
+#define FAKE_ESP_TIMER_H
+
+#include <stdint.h>
+#include "FakeClock.h"
+
+inline int64_t esp_timer_get_time() { return (int64_t)(fakeMicros + fakeBusMicros()); }
+
+#endif // FAKE_ESP_TIMER_H
@@ -0,0 +1,30 @@
+#ifndef FAKE_FREERTOS_H
+#define FAKE_FREERTOS_H
+
+// Single-threaded stand-ins: native tests run everything on one thread, so
+// mutexes always succeed and tasks are never started.
+
+#include <stdint.h>
+
+typedef void *TaskHandle_t;
+typedef void *SemaphoreHandle_t;
+typedef void *QueueHandle_t;
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef void (*TaskFunction_t)(void *);
+typedef int portMUX_TYPE;
+
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define portMAX_DELAY 0xFFFFFFFF
+#define pdMS_TO_TICKS(ms) (ms)
+#define portTICK_PERIOD_MS 1
+#define tskIDLE_PRIORITY 0
+#define portMUX_INITIALIZER_UNLOCKED 0
+
+#define portENTER_CRITICAL(mux) ((void)(mux))
+#define portEXIT_CRITICAL(mux) ((void)(mux))
+
+#endif // FAKE_FREERTOS_H
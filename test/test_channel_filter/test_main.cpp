@@ -0,0 +1,193 @@
+// Channel filter and deadband: settled steps must reach the panel, noise on
+// a rounding edge must not, and the color band follows the shown value.
+// Traces are replayed at the 100 Hz sample rate.
+
+#include <unity.h>
+#include <stdio.h>
+#include "ChannelFilter.h"
+#include "ChannelBands.h"
+#include "DisplayConfig.h"
+#include "DataTypes.h"
+#include "text_utils.h"
+
+#define SETTLE_SAMPLES 1000   // 10 s, twenty time constants of the slowest EMA
+#define TRACE_SAMPLES 3000    // 30 s of noise
+
+static const uint8_t filteredChannels[] = {
+  DATA_SOURCE_IAT, DATA_SOURCE_COOLANT, DATA_SOURCE_AFR, DATA_SOURCE_ADV,
+  DATA_SOURCE_TPS, DATA_SOURCE_VOLTAGE, DATA_SOURCE_MAP, DATA_SOURCE_FP
+};
+
+static uint32_t nowMs = 1000;
+static uint32_t noiseSeed = 1;
+
+static void setRaw(uint8_t source, float value) {
+  switch (source) {
+    case DATA_SOURCE_IAT: iat = (uint8_t)value; break;
+    case DATA_SOURCE_COOLANT: clt = (uint8_t)value; break;
+    case DATA_SOURCE_AFR: afrConv = value; break;
+    case DATA_SOURCE_ADV: adv = (int)value; break;
+    case DATA_SOURCE_TPS: tps = (int)value; break;
+    case DATA_SOURCE_VOLTAGE: bat = value; break;
+    case DATA_SOURCE_MAP: mapData = (int)value; break;
+    case DATA_SOURCE_FP: fp = (int)value; break;
+    default: break;
+  }
+}
+
+static void sample(uint32_t count = 1) {
+  for (uint32_t i = 0; i < count; i++) {
+    nowMs += FILTER_SAMPLE_MS;
+    updateChannelFilters(nowMs);
+  }
+}
+
+static int32_t shownFixed(uint8_t source) {
+  return toFixed(getDisplayValue(source), getChannelDecimals(source));
+}
+
+// Deterministic noise in [-1, 1]
+static float noise() {
+  noiseSeed = noiseSeed * 1103515245u + 12345u;
+  return ((noiseSeed >> 16) & 0x7FFF) / 16383.5f - 1.0f;
+}
+
+void setUp(void) {
+  for (uint8_t i = 0; i < DATA_SOURCE_COUNT; i++) {
+    setRaw(i, 0);
+    setChannelFilter(i, getChannelFilter(i)); // Defaults, re-primed
+  }
+  noiseSeed = 1;
+  sample();
+}
+
+void tearDown(void) {}
+
+// A one-unit step at the display precision shows once the filter settles
+void test_settled_one_unit_step_shows(void) {
+  for (uint8_t i = 0; i < sizeof(filteredChannels); i++) {
+    uint8_t source = filteredChannels[i];
+    bool tenths = getChannelDecimals(source) > 0;
+    float base = tenths ? 14.0f : 84.0f;
+    setRaw(source, base);
+    sample(SETTLE_SAMPLES);
+    int32_t before = shownFixed(source);
+
+    setRaw(source, base + (tenths ? 0.1f : 1.0f));
+    sample(SETTLE_SAMPLES);
+    TEST_ASSERT_EQUAL_INT32_MESSAGE(before + 1, shownFixed(source), getDataSourceName(source));
+  }
+}
+
+// Settled means exactly on the digit, not a hair below it
+void test_shown_value_snaps_to_display_digits(void) {
+  clt = 84;
+  sample(SETTLE_SAMPLES);
+  clt = 85;
+  sample(SETTLE_SAMPLES);
+  TEST_ASSERT_EQUAL_FLOAT(85.0f, getDisplayValue(DATA_SOURCE_COOLANT));
+}
+
+// The band is evaluated on the shown value, so a one-degree step onto the
+// 95 C edge turns the panel critical
+void test_band_follows_shown_value(void) {
+  clt = 94;
+  sample(SETTLE_SAMPLES);
+  TEST_ASSERT_EQUAL_UINT8(0, getChannelBand(DATA_SOURCE_COOLANT));
+  clt = 95;
+  sample(SETTLE_SAMPLES);
+  TEST_ASSERT_EQUAL_UINT8(1, getChannelBand(DATA_SOURCE_COOLANT));
+}
+
+// A slow ramp shows every digit on the way, in order
+void test_slow_ramp_shows_every_step(void) {
+  clt = 80;
+  sample(SETTLE_SAMPLES);
+  int32_t last = shownFixed(DATA_SOURCE_COOLANT);
+  uint32_t changes = 0;
+  for (uint8_t value = 81; value <= 90; value++) {
+    clt = value;
+    for (int i = 0; i < 200; i++) {
+      sample();
+      int32_t shown = shownFixed(DATA_SOURCE_COOLANT);
+      if (shown != last) {
+        TEST_ASSERT_EQUAL_INT32(last + 1, shown);
+        last = shown;
+        changes++;
+      }
+    }
+  }
+  TEST_ASSERT_EQUAL_UINT32(10, changes);
+}
+
+// Replay a reading that dithers across a rounding edge and count the
+// redraws it would cause, with the default deadband and with none
+static uint32_t countEdgeFlicker(uint8_t source, float center, float amplitude) {
+  setRaw(source, center);
+  sample(SETTLE_SAMPLES);
+  int32_t last = shownFixed(source);
+  uint32_t changes = 0;
+  for (int i = 0; i < TRACE_SAMPLES; i++) {
+    setRaw(source, center + amplitude * noise());
+    sample();
+    int32_t shown = shownFixed(source);
+    if (shown != last) {
+      last = shown;
+      changes++;
+    }
+  }
+  return changes;
+}
+
+static void checkEdgeFlicker(uint8_t source, float center, float amplitude, uint32_t maxChanges) {
+  ChannelFilterConfig config = getChannelFilter(source);
+  uint32_t filtered = countEdgeFlicker(source, center, amplitude);
+
+  ChannelFilterConfig noDeadband = config;
+  noDeadband.deadband = 0;
+  setChannelFilter(source, noDeadband);
+  uint32_t unfiltered = countEdgeFlicker(source, center, amplitude);
+  setChannelFilter(source, config);
+
+  char message[96];
+  snprintf(message, sizeof(message), "%s: %u redraws in %u samples (%u without deadband)",
+           getDataSourceName(source), (unsigned)filtered, (unsigned)TRACE_SAMPLES, (unsigned)unfiltered);
+  TEST_MESSAGE(message);
+  TEST_ASSERT_TRUE_MESSAGE(filtered <= maxChanges, message);
+  TEST_ASSERT_TRUE_MESSAGE(filtered < unfiltered, message);
+}
+
+void test_noisy_trace_redraws(void) {
+  // Integer channels flipping between two values
+  checkEdgeFlicker(DATA_SOURCE_COOLANT, 85, 1, 2);
+  checkEdgeFlicker(DATA_SOURCE_MAP, 60, 1, 2);
+  checkEdgeFlicker(DATA_SOURCE_FP, 300, 1, 2);
+  // AFR and voltage jitter around a x.x5 edge
+  checkEdgeFlicker(DATA_SOURCE_AFR, 14.65f, 0.1f, 6);
+  checkEdgeFlicker(DATA_SOURCE_VOLTAGE, 13.85f, 0.1f, 2);
+}
+
+// The deadband is capped, so even a large setting cannot hold a settled step
+void test_deadband_capped_below_one_unit(void) {
+  ChannelFilterConfig config = getChannelFilter(DATA_SOURCE_COOLANT);
+  ChannelFilterConfig wide = config;
+  wide.deadband = 5.0f;
+  setChannelFilter(DATA_SOURCE_COOLANT, wide);
+  clt = 70;
+  sample(SETTLE_SAMPLES);
+  clt = 71;
+  sample(SETTLE_SAMPLES);
+  TEST_ASSERT_EQUAL_INT32(71, shownFixed(DATA_SOURCE_COOLANT));
+  setChannelFilter(DATA_SOURCE_COOLANT, config);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_settled_one_unit_step_shows);
+  RUN_TEST(test_shown_value_snaps_to_display_digits);
+  RUN_TEST(test_band_follows_shown_value);
+  RUN_TEST(test_slow_ramp_shows_every_step);
+  RUN_TEST(test_noisy_trace_redraws);
+  RUN_TEST(test_deadband_capped_below_one_unit);
+  return UNITY_END();
+}
@@ -0,0 +1,126 @@
+// Display configuration from the EEPROM firmware: the blob it EEPROM.put()
+// at address 10 must import as the layout the user had, with its RGB565
+// panel colours turned into theme roles, and the schema 1 record must
+// widen to the current panel count unchanged.
+
+#include <unity.h>
+#include <string.h>
+#include <TFT_eSPI.h>
+#include "DisplayConfig.h"
+#include "Theme.h"
+
+// The EEPROM firmware's defaultDisplayConfig, colours as it stored them
+static void baselineDefaults(DisplayConfigurationV1 &blob) {
+  static const DisplayPanel panels[8] = {
+    {DATA_SOURCE_AFR, DATA_TYPE_FLOAT, 0, 1, true, "AFR", "", TFT_GREEN},
+    {DATA_SOURCE_TPS, DATA_TYPE_INT, 1, 0, true, "TPS", "%", TFT_WHITE},
+    {DATA_SOURCE_IAT, DATA_TYPE_UINT, 2, 0, true, "IAT", "°C", TFT_WHITE},
+    {DATA_SOURCE_MAP, DATA_TYPE_INT, 3, 0, true, "MAP", "kPa", TFT_WHITE},
+    {DATA_SOURCE_ADV, DATA_TYPE_INT, 4, 0, true, "ADV", "°", TFT_RED},
+    {DATA_SOURCE_FP, DATA_TYPE_INT, 5, 0, true, "FP", "psi", TFT_WHITE},
+    {DATA_SOURCE_COOLANT, DATA_TYPE_UINT, 6, 0, true, "Coolant", "°C", TFT_WHITE},
+    {DATA_SOURCE_VOLTAGE, DATA_TYPE_FLOAT, 7, 1, true, "Voltage", "V", TFT_GREEN}
+  };
+  memset(&blob, 0, sizeof(blob));
+  memcpy(blob.panels, panels, sizeof(panels));
+  memcpy(blob.indicators, defaultDisplayConfig.indicators, sizeof(blob.indicators));
+  blob.activePanelCount = 8;
+  blob.activeIndicatorCount = 8;
+  blob.rpmDisplayMode = 0;
+  blob.showSystemIndicators = true;
+  blob.canSpeed = 500000;
+}
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+// An untouched EEPROM config imports as today's defaults, byte for byte
+void test_baseline_defaults_import_as_defaults(void) {
+  DisplayConfigurationV1 blob;
+  DisplayConfiguration config;
+  baselineDefaults(blob);
+  TEST_ASSERT_TRUE(importLegacyDisplayConfig(blob, config));
+  TEST_ASSERT_EQUAL_MEMORY(&defaultDisplayConfig, &config, sizeof(config));
+}
+
+// A user's edits survive: the splash selection that overwrote panel 0's
+// source, a disabled panel, a swapped slot and 1 Mbps CAN
+void test_user_layout_survives(void) {
+  DisplayConfigurationV1 blob;
+  DisplayConfiguration config;
+  baselineDefaults(blob);
+  blob.panels[0].dataSource = 3;   // splash byte, read as DATA_SOURCE_ADV
+  blob.panels[4].enabled = false;
+  blob.panels[5].dataSource = DATA_SOURCE_RPM;
+  strcpy(blob.panels[5].label, "RPM");
+  blob.canSpeed = 1000000;
+  TEST_ASSERT_TRUE(importLegacyDisplayConfig(blob, config));
+  TEST_ASSERT_EQUAL_UINT8(DATA_SOURCE_ADV, config.panels[0].dataSource);
+  TEST_ASSERT_FALSE(config.panels[4].enabled);
+  TEST_ASSERT_EQUAL_UINT8(DATA_SOURCE_RPM, config.panels[5].dataSource);
+  TEST_ASSERT_EQUAL_STRING("RPM", config.panels[5].label);
+  TEST_ASSERT_EQUAL_UINT32(1000000, config.canSpeed);
+  TEST_ASSERT_EQUAL_UINT8(8, config.activePanelCount);
+}
+
+void test_colours_map_to_roles(void) {
+  static const uint16_t colours[] = {TFT_GREEN, TFT_RED, TFT_YELLOW, TFT_ORANGE, TFT_WHITE, TFT_CYAN, TFT_BLACK, 0x1234};
+  static const uint16_t roles[] = {THEME_NORMAL, THEME_CRITICAL, THEME_WARN, THEME_WARN, THEME_TEXT, THEME_TEXT, THEME_TEXT, THEME_TEXT};
+  DisplayConfigurationV1 blob;
+  DisplayConfiguration config;
+  baselineDefaults(blob);
+  for (uint8_t i = 0; i < 8; i++) {
+    blob.panels[i].color = colours[i];
+  }
+  TEST_ASSERT_TRUE(importLegacyDisplayConfig(blob, config));
+  for (uint8_t i = 0; i < 8; i++) {
+    TEST_ASSERT_EQUAL_UINT16(roles[i], config.panels[i].color);
+  }
+}
+
+// The old firmware never wrote a CAN speed until one was chosen, and
+// treated anything else as 500 kbps
+void test_unset_can_speed_reads_as_500k(void) {
+  DisplayConfigurationV1 blob;
+  DisplayConfiguration config;
+  baselineDefaults(blob);
+  blob.canSpeed = 0xFFFFFFFF;
+  TEST_ASSERT_TRUE(importLegacyDisplayConfig(blob, config));
+  TEST_ASSERT_EQUAL_UINT32(500000, config.canSpeed);
+}
+
+// Erased flash is not a layout
+void test_erased_eeprom_is_rejected(void) {
+  DisplayConfigurationV1 blob;
+  DisplayConfiguration config;
+  memset(&blob, 0xFF, sizeof(blob));
+  TEST_ASSERT_FALSE(importLegacyDisplayConfig(blob, config));
+}
+
+// A schema 1 record already holds theme roles: widened, not remapped
+void test_schema1_record_widens_unchanged(void) {
+  DisplayConfigurationV1 old;
+  DisplayConfiguration config;
+  memset(&old, 0, sizeof(old));
+  memcpy(old.panels, defaultDisplayConfig.panels, sizeof(old.panels));
+  memcpy(old.indicators, defaultDisplayConfig.indicators, sizeof(old.indicators));
+  old.activePanelCount = 8;
+  old.activeIndicatorCount = 8;
+  old.showSystemIndicators = true;
+  old.canSpeed = 500000;
+  upgradeDisplayConfigV1(old, config);
+  TEST_ASSERT_EQUAL_MEMORY(&defaultDisplayConfig, &config, sizeof(config));
+  TEST_ASSERT_TRUE(validDisplayConfig(config));
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_baseline_defaults_import_as_defaults);
+  RUN_TEST(test_user_layout_survives);
+  RUN_TEST(test_colours_map_to_roles);
+  RUN_TEST(test_unset_can_speed_reads_as_500k);
+  RUN_TEST(test_erased_eeprom_is_rejected);
+  RUN_TEST(test_schema1_record_widens_unchanged);
+  return UNITY_END();
+}
@@ -0,0 +1,309 @@
+// Golden-frame tests for the render pipeline on the fake panel: what
+// startUpDisplay() and drawData() put on screen and what it costs on SPI.
+//
+// When a rendering change is intended, the failing test writes the new
+// frame as a PPM next to the build (view it, or diff it against an
+// on-device capture with tools/frame_capture.py --golden) and prints the
+// hash and SPI figures to paste below.
+
+#include <unity.h>
+#include <vector>
+#include "DisplayManager.h"
+#include "ChannelFilter.h"
+#include "HistoryGraph.h"
+#include "NativePush.h"
+#include "Profiler.h"
+#include "DataTypes.h"
+#include "DisplayConfig.h"
+#include "Layout.h"
+#include "FakePanel.h"
+#include "FakeClock.h"
+
+// Default layout with every channel at zero
+#define GOLDEN_STARTUP_HASH 0xE4D495F6u
+#define GOLDEN_STARTUP_SPI_BYTES 1016081u
+#define GOLDEN_STARTUP_SPI_TRANSACTIONS 913u
+
+// Default layout after the cruise values below have settled
+#define GOLDEN_CRUISE_HASH 0x0881A8CBu
+
+// One digit cell of the speed readout
+#define GOLDEN_SPEED_DIGIT_SPI_BYTES 2171u
+
+#define FRAME_MS 10
+#define SETTLE_FRAMES 500 // Ten time constants of the slowest (500 ms) EMA
+#define PROFILE_FRAMES (1000 / FRAME_MS) // One profiler window
+
+static void setCruiseValues() {
+  rpm = 3500;
+  vss = 72;
+  clt = 85;
+  iat = 30;
+  bat = 13.8f;
+  afrConv = 14.7f;
+  tps = 20;
+  mapData = 60;
+  adv = 15;
+  fp = 300;
+}
+
+static void setZeroValues() {
+  rpm = 0;
+  vss = 0;
+  clt = 0;
+  iat = 0;
+  bat = 0;
+  afrConv = 0;
+  tps = 0;
+  mapData = 0;
+  adv = 0;
+  fp = 0;
+}
+
+// One pass of loop(): filters, history, then a frame
+static FakeSpiStats runFrame() {
+  fakeClockAdvance(FRAME_MS);
+  updateChannelFilters(millis());
+  recordHistory(millis());
+  fakeSpiReset();
+  drawData();
+  return fakeSpiStats();
+}
+
+static void settle() {
+  for (int i = 0; i < SETTLE_FRAMES; i++) {
+    runFrame();
+  }
+}
+
+static std::vector<uint16_t> snapshot() {
+  const uint16_t *pixels = fakePanelPixels();
+  return std::vector<uint16_t>(pixels, pixels + fakePanelWidth() * fakePanelHeight());
+}
+
+static void checkGolden(const char *name, uint32_t golden) {
+  uint32_t hash = fakePanelHash();
+  if (hash != golden) {
+    char path[64];
+    snprintf(path, sizeof(path), "frame_%s.ppm", name);
+    fakePanelSavePpm(path);
+    char message[128];
+    snprintf(message, sizeof(message), "%s frame hash 0x%08X, written to %s", name, (unsigned)hash, path);
+    TEST_FAIL_MESSAGE(message);
+  }
+}
+
+// The boot path in setup(): panel init, layout compile, then the dashboard
+static void startDashboard() {
+  prepareDisplay();
+  fakeSpiReset();
+  startUpDisplay();
+}
+
+void setUp(void) {
+  nativePushEnabled = true;
+  setZeroValues();
+  settle();
+}
+
+void tearDown(void) {}
+
+void test_startup_frame_matches_golden(void) {
+  startDashboard();
+  FakeSpiStats spi = fakeSpiStats();
+  checkGolden("startup", GOLDEN_STARTUP_HASH);
+  TEST_ASSERT_EQUAL_UINT32(GOLDEN_STARTUP_SPI_BYTES, spi.bytes);
+  TEST_ASSERT_EQUAL_UINT32(GOLDEN_STARTUP_SPI_TRANSACTIONS, spi.transactions);
+}
+
+void test_cruise_frame_matches_golden(void) {
+  startDashboard();
+  setCruiseValues();
+  settle();
+  checkGolden("cruise", GOLDEN_CRUISE_HASH);
+}
+
+// Once values stop moving, a frame sends nothing at all
+void test_idle_frame_sends_nothing(void) {
+  startDashboard();
+  setCruiseValues();
+  settle();
+  FakeSpiStats spi = runFrame();
+  TEST_ASSERT_EQUAL_UINT32(0, spi.bytes);
+  TEST_ASSERT_EQUAL_UINT32(0, spi.transactions);
+}
+
+// Incremental updates must leave exactly the screen a full redraw draws
+void test_incremental_frames_match_full_redraw(void) {
+  startDashboard();
+  setCruiseValues();
+  settle();
+  std::vector<uint16_t> incremental = snapshot();
+
+  requestLayoutRebuild();
+  runFrame();
+  std::vector<uint16_t> full = snapshot();
+  TEST_ASSERT_EQUAL_MEMORY(full.data(), incremental.data(), full.size() * sizeof(uint16_t));
+}
+
+// The RGB666 push path and TFT_eSPI's pushSprite() give the same pixels
+// and the same bus traffic
+void test_native_push_matches_library_push(void) {
+  nativePushEnabled = false;
+  startDashboard();
+  FakeSpiStats librarySpi = fakeSpiStats();
+  std::vector<uint16_t> library = snapshot();
+
+  nativePushEnabled = true;
+  startDashboard();
+  FakeSpiStats nativeSpi = fakeSpiStats();
+  TEST_ASSERT_EQUAL_MEMORY(library.data(), fakePanelPixels(), library.size() * sizeof(uint16_t));
+  TEST_ASSERT_EQUAL_UINT32(librarySpi.bytes, nativeSpi.bytes);
+  TEST_ASSERT_EQUAL_UINT32(librarySpi.transactions, nativeSpi.transactions);
+}
+
+// A one-digit change pushes one digit cell, nothing else. VSS is not
+// filtered, so the change shows on the next frame.
+void test_one_digit_change_pushes_one_cell(void) {
+  startDashboard();
+  setCruiseValues();
+  settle();
+
+  vss = 73;
+  FakeSpiStats spi = runFrame();
+  TEST_ASSERT_EQUAL_UINT32(1, spi.transactions);
+  TEST_ASSERT_EQUAL_UINT32(GOLDEN_SPEED_DIGIT_SPI_BYTES, spi.bytes);
+  FakeSpiStats after = runFrame();
+  TEST_ASSERT_EQUAL_UINT32(0, after.bytes);
+}
+
+// Sensor noise at cruise, replayed through the whole pipeline: once the
+// filters have settled, jitter of a count or two must not keep the panels
+// redrawing
+void test_noisy_cruise_redraws(void) {
+  startDashboard();
+  setCruiseValues();
+  settle();
+  uint32_t seed = 1;
+  uint32_t redraws = 0;
+  for (int i = 0; i < SETTLE_FRAMES; i++) {
+    seed = seed * 1103515245u + 12345u;
+    int jitter = (seed >> 16) % 3 - 1;   // -1, 0 or +1 count
+    clt = 85 + jitter;
+    iat = 30 - jitter;
+    mapData = 60 + jitter;
+    fp = 300 - jitter;
+    afrConv = 14.7f + jitter * 0.1f;
+    bat = 13.8f - jitter * 0.1f;
+    if (runFrame().bytes > 0) {
+      redraws++;
+    }
+  }
+  char message[64];
+  snprintf(message, sizeof(message), "%u of %u frames redrawn", (unsigned)redraws, (unsigned)SETTLE_FRAMES);
+  TEST_MESSAGE(message);
+  TEST_ASSERT_TRUE_MESSAGE(redraws <= SETTLE_FRAMES / 50, message);
+}
+
+// Profiler averages for one window of moving values, as loop() runs it.
+// The fake bus charges modelled SPI time to esp_timer (FakeClock.h), so
+// the scopes show device-like push cost rather than host CPU time.
+static ProfileReport profileMovingValues() {
+  startDashboard();
+  setCruiseValues();
+  settle();
+  profilerEnabled = true;
+  fakeClockAdvance(1000);
+  profilerUpdate(); // Start a fresh window
+  for (int i = 0; i < PROFILE_FRAMES; i++) {
+    rpm = 3000 + (i * 137) % 2500;
+    vss = 60 + i % 20;
+    fakeClockAdvance(FRAME_MS);
+    updateChannelFilters(millis());
+    recordHistory(millis());
+    PROFILE_CALL(PROF_FRAME, drawData());
+    profilerEndFrame();
+    profilerUpdate();
+  }
+  profilerEnabled = false;
+  return getProfileReport();
+}
+
+// What the native push saves per frame on the same work. Figures are
+// printed for the record; the assertion only pins the direction.
+void test_native_push_frame_time(void) {
+  nativePushEnabled = false;
+  startDashboard();
+  FakeSpiStats libraryStartup = fakeSpiStats();
+  ProfileReport library = profileMovingValues();
+
+  nativePushEnabled = true;
+  startDashboard();
+  FakeSpiStats nativeStartup = fakeSpiStats();
+  ProfileReport native = profileMovingValues();
+
+  char message[200];
+  snprintf(message, sizeof(message), "startup SPI calls %u -> %u; frame avg %u -> %u us, p99 %u -> %u us, spiFlush avg %u -> %u us",
+           (unsigned)libraryStartup.calls, (unsigned)nativeStartup.calls,
+           (unsigned)library.avgFrameUs, (unsigned)native.avgFrameUs,
+           (unsigned)library.p99FrameUs, (unsigned)native.p99FrameUs,
+           (unsigned)library.scopeAvgUs[PROF_SPI_FLUSH], (unsigned)native.scopeAvgUs[PROF_SPI_FLUSH]);
+  TEST_MESSAGE(message);
+  TEST_ASSERT_TRUE(nativeStartup.calls < libraryStartup.calls);
+  TEST_ASSERT_TRUE(native.avgFrameUs < library.avgFrameUs);
+  TEST_ASSERT_TRUE(native.scopeAvgUs[PROF_SPI_FLUSH] < library.scopeAvgUs[PROF_SPI_FLUSH]);
+}
+
+// A user layout past eight panels: with RPM shown digitally the bar's
+// area holds three more, and every panel gets a command and its pixels
+void test_street_layout_past_eight_panels(void) {
+  static const uint8_t extraSources[] = {DATA_SOURCE_RPM, DATA_SOURCE_VSS, DATA_SOURCE_TRIGGER};
+  currentDisplayConfig.rpmDisplayMode = 1;
+  for (uint8_t i = 0; i < sizeof(extraSources); i++) {
+    DisplayPanel &panel = currentDisplayConfig.panels[DISPLAY_BAR_SLOTS + i];
+    panel = currentDisplayConfig.panels[1];
+    panel.dataSource = extraSources[i];
+    panel.position = DISPLAY_BAR_SLOTS + i;
+    snprintf(panel.label, sizeof(panel.label), "%s", getDataSourceName(extraSources[i]));
+  }
+  currentDisplayConfig.activePanelCount = DISPLAY_MAX_PANELS;
+  TEST_ASSERT_TRUE(validDisplayConfig(currentDisplayConfig));
+
+  startDashboard();
+  const CompiledLayout &layout = getCompiledLayout();
+  uint8_t panels = 0;
+  for (uint8_t i = 0; i < layout.count; i++) {
+    TEST_ASSERT_NOT_EQUAL(WIDGET_RPM_BAR, layout.commands[i].type);
+    if (layout.commands[i].type == WIDGET_PANEL) {
+      panels++;
+    }
+  }
+  TEST_ASSERT_EQUAL_UINT8(DISPLAY_MAX_PANELS, panels);
+
+  setCruiseValues();
+  settle();
+  std::vector<uint16_t> incremental = snapshot();
+  requestLayoutRebuild();
+  runFrame();
+  TEST_ASSERT_EQUAL_MEMORY(fakePanelPixels(), incremental.data(), incremental.size() * sizeof(uint16_t));
+
+  currentDisplayConfig = defaultDisplayConfig;
+  startDashboard();
+}
+
+int main(int argc, char **argv) {
+  fakeClockSet(1000);
+  setupDisplay();
+
+  UNITY_BEGIN();
+  RUN_TEST(test_startup_frame_matches_golden);
+  RUN_TEST(test_cruise_frame_matches_golden);
+  RUN_TEST(test_idle_frame_sends_nothing);
+  RUN_TEST(test_incremental_frames_match_full_redraw);
+  RUN_TEST(test_native_push_matches_library_push);
+  RUN_TEST(test_one_digit_change_pushes_one_cell);
+  RUN_TEST(test_noisy_cruise_redraws);
+  RUN_TEST(test_native_push_frame_time);
+  RUN_TEST(test_street_layout_past_eight_panels);
+  return UNITY_END();
+}
@@ -0,0 +1,306 @@
+// JsonWriter output (escaping, nesting, numbers, overflow), plus a host
+// benchmark and allocation soak against the String concatenation the web
+// handlers used before. The host has no ESP heap to fragment, so the soak
+// counts what each request asks of the allocator instead: a writer that
+// never allocates cannot fragment maxAllocHeap. The fake String is a
+// std::string, whose short-string buffer hides most of the temporaries an
+// Arduino String allocates, so the String figures are a lower bound and
+// only the allocation counts are asserted.
+
+#include <unity.h>
+#include <chrono>
+#include <limits.h>
+#include <new>
+#include <stdlib.h>
+#include <string.h>
+#include <Arduino.h>
+#include "JsonWriter.h"
+#include "DisplayConfig.h"
+
+#define SOAK_REQUESTS 10000
+#define JSON_TEST_BUFFER 2048
+
+// ---- Host allocator tracking ----
+
+struct AllocStats {
+  uint32_t allocations;
+  uint64_t bytes;        // Total requested
+  int64_t live;          // Outstanding bytes
+  int64_t peakLive;
+};
+
+static AllocStats allocStats;
+static bool allocTracking = false;
+
+// Size header in front of every block, so delete knows what it frees
+#define ALLOC_HEADER 16
+
+void *operator new(size_t size) {
+  uint8_t *block = (uint8_t *)malloc(size + ALLOC_HEADER);
+  if (block == nullptr) {
+    throw std::bad_alloc();
+  }
+  *(size_t *)block = size;
+  if (allocTracking) {
+    allocStats.allocations++;
+    allocStats.bytes += size;
+    allocStats.live += size;
+    if (allocStats.live > allocStats.peakLive) {
+      allocStats.peakLive = allocStats.live;
+    }
+  }
+  return block + ALLOC_HEADER;
+}
+
+void operator delete(void *ptr) noexcept {
+  if (ptr == nullptr) {
+    return;
+  }
+  uint8_t *block = (uint8_t *)ptr - ALLOC_HEADER;
+  if (allocTracking) {
+    allocStats.live -= *(size_t *)block;
+  }
+  free(block);
+}
+
+void operator delete(void *ptr, size_t) noexcept {
+  operator delete(ptr);
+}
+
+static void startAllocTracking() {
+  memset(&allocStats, 0, sizeof(allocStats));
+  allocTracking = true;
+}
+
+static AllocStats stopAllocTracking() {
+  allocTracking = false;
+  return allocStats;
+}
+
+static uint64_t nowNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// ---- /getDisplayConfig both ways ----
+
+// The handler body before JsonWriter
+static String displayConfigString() {
+  String json = "{";
+  json += "\"panels\":[";
+  for (int i = 0; i < DISPLAY_MAX_PANELS; i++) {
+    if (i > 0) json += ",";
+    json += "{";
+    json += "\"enabled\":" + String(currentDisplayConfig.panels[i].enabled ? "true" : "false") + ",";
+    json += "\"dataSource\":" + String(currentDisplayConfig.panels[i].dataSource) + ",";
+    json += "\"graph\":" + String(currentDisplayConfig.panels[i].dataType == DATA_TYPE_GRAPH ? "true" : "false") + ",";
+    json += "\"gauge\":" + String(currentDisplayConfig.panels[i].dataType == DATA_TYPE_GAUGE ? "true" : "false") + ",";
+    json += "\"position\":" + String(currentDisplayConfig.panels[i].position);
+    json += "}";
+  }
+  json += "],";
+  json += "\"indicators\":[";
+  for (int i = 0; i < DISPLAY_MAX_INDICATORS; i++) {
+    if (i > 0) json += ",";
+    json += "{";
+    json += "\"enabled\":" + String(currentDisplayConfig.indicators[i].enabled ? "true" : "false") + ",";
+    json += "\"indicator\":" + String(currentDisplayConfig.indicators[i].indicator) + ",";
+    json += "\"position\":" + String(currentDisplayConfig.indicators[i].position);
+    json += "}";
+  }
+  json += "]";
+  json += "}";
+  return json;
+}
+
+// The handler body now
+static void displayConfigJson(JsonWriter &json) {
+  json.beginObject();
+  json.beginArray("panels");
+  for (int i = 0; i < DISPLAY_MAX_PANELS; i++) {
+    const DisplayPanel &panel = currentDisplayConfig.panels[i];
+    json.beginObject();
+    json.addBool("enabled", panel.enabled);
+    json.addInt("dataSource", panel.dataSource);
+    json.addBool("graph", panel.dataType == DATA_TYPE_GRAPH);
+    json.addBool("gauge", panel.dataType == DATA_TYPE_GAUGE);
+    json.addInt("position", panel.position);
+    json.endObject();
+  }
+  json.endArray();
+  json.beginArray("indicators");
+  for (int i = 0; i < DISPLAY_MAX_INDICATORS; i++) {
+    const IndicatorConfig &indicator = currentDisplayConfig.indicators[i];
+    json.beginObject();
+    json.addBool("enabled", indicator.enabled);
+    json.addInt("indicator", indicator.indicator);
+    json.addInt("position", indicator.position);
+    json.endObject();
+  }
+  json.endArray();
+  json.endObject();
+}
+
+static char buffer[JSON_TEST_BUFFER];
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+// ---- Output ----
+
+void test_escapes_strings(void) {
+  JsonWriter json(buffer, sizeof(buffer));
+  json.beginObject();
+  json.addString("q\"k", "say \"hi\"");
+  json.addString("path", "C:\\log");
+  json.addString("ctl", "a\nb\tc\x01\x1f");
+  json.addString("utf8", "23\xc2\xb0" "C");
+  json.addString("null", NULL);
+  json.endObject();
+  TEST_ASSERT_EQUAL_STRING("{\"q\\\"k\":\"say \\\"hi\\\"\",\"path\":\"C:\\\\log\","
+                           "\"ctl\":\"a\\u000ab\\u0009c\\u0001\\u001f\","
+                           "\"utf8\":\"23\xc2\xb0" "C\",\"null\":\"\"}", json.c_str());
+  TEST_ASSERT_FALSE(json.overflowed());
+}
+
+void test_nests_with_commas(void) {
+  JsonWriter json(buffer, sizeof(buffer));
+  json.beginObject();
+  json.beginArray("empty");
+  json.endArray();
+  json.beginObject("o");
+  json.endObject();
+  json.beginArray("a");
+  json.addInt(NULL, 1);
+  json.beginArray();
+  json.addBool(NULL, true);
+  json.addBool(NULL, false);
+  json.endArray();
+  json.beginObject();
+  json.addUInt("n", 2);
+  json.endObject();
+  json.endArray();
+  json.addString("last", "x");
+  json.endObject();
+  TEST_ASSERT_EQUAL_STRING("{\"empty\":[],\"o\":{},\"a\":[1,[true,false],{\"n\":2}],\"last\":\"x\"}", json.c_str());
+  TEST_ASSERT_EQUAL_size_t(strlen(json.c_str()), json.length());
+}
+
+void test_nests_to_max_depth(void) {
+  JsonWriter json(buffer, sizeof(buffer));
+  for (int i = 0; i < JSON_MAX_DEPTH; i++) {
+    json.beginArray();
+  }
+  for (int i = 0; i < JSON_MAX_DEPTH; i++) {
+    json.endArray();
+  }
+  TEST_ASSERT_EQUAL_STRING("[[[[[[[[]]]]]]]]", json.c_str());
+  TEST_ASSERT_FALSE(json.overflowed());
+
+  JsonWriter deeper(buffer, sizeof(buffer));
+  for (int i = 0; i <= JSON_MAX_DEPTH; i++) {
+    deeper.beginArray();
+  }
+  TEST_ASSERT_TRUE(deeper.overflowed());
+}
+
+void test_numbers(void) {
+  JsonWriter json(buffer, sizeof(buffer));
+  json.beginArray();
+  json.addInt(NULL, INT32_MIN);
+  json.addInt(NULL, -7);
+  json.addUInt(NULL, UINT32_MAX);
+  json.addUInt(NULL, 0);
+  json.addFloat(NULL, 14.7f, 1);
+  json.addFloat(NULL, -0.05f, 1);
+  json.addFixed(NULL, 1234, 2);
+  json.endArray();
+  TEST_ASSERT_EQUAL_STRING("[-2147483648,-7,4294967295,0,14.7,-0.1,12.34]", json.c_str());
+}
+
+// Writes past the end are dropped; the buffer stays terminated inside size
+void test_overflow_is_flagged_and_terminated(void) {
+  char small[16];
+  memset(small, 'x', sizeof(small));
+  JsonWriter json(small, 10);
+  json.beginObject();
+  json.addString("key", "a long value");
+  json.endObject();
+  TEST_ASSERT_TRUE(json.overflowed());
+  TEST_ASSERT_EQUAL_size_t(9, json.length());
+  TEST_ASSERT_EQUAL_STRING("{\"key\":\"a", small);
+  TEST_ASSERT_EQUAL_INT('x', small[10]);
+}
+
+void test_exact_fit_does_not_overflow(void) {
+  char exact[8];
+  JsonWriter json(exact, sizeof(exact));
+  json.beginArray();
+  json.addInt(NULL, 12345);
+  json.endArray();
+  TEST_ASSERT_EQUAL_STRING("[12345]", exact);
+  TEST_ASSERT_FALSE(json.overflowed());
+
+  JsonWriter none(exact, 0);
+  none.addInt(NULL, 1);
+  TEST_ASSERT_TRUE(none.overflowed());
+}
+
+// The rewritten handler sends exactly what the String version did
+void test_matches_string_handler(void) {
+  JsonWriter json(buffer, sizeof(buffer));
+  displayConfigJson(json);
+  TEST_ASSERT_EQUAL_STRING(displayConfigString().c_str(), json.c_str());
+}
+
+// ---- Benchmark and soak ----
+
+void test_bench_and_soak_against_string(void) {
+  uint32_t sink = 0;
+
+  startAllocTracking();
+  uint64_t start = nowNs();
+  for (int i = 0; i < SOAK_REQUESTS; i++) {
+    sink += displayConfigString().length();
+  }
+  uint64_t stringNs = nowNs() - start;
+  AllocStats stringAlloc = stopAllocTracking();
+
+  startAllocTracking();
+  start = nowNs();
+  for (int i = 0; i < SOAK_REQUESTS; i++) {
+    JsonWriter json(buffer, sizeof(buffer));
+    displayConfigJson(json);
+    sink += json.length();
+  }
+  uint64_t writerNs = nowNs() - start;
+  AllocStats writerAlloc = stopAllocTracking();
+  TEST_ASSERT_TRUE(sink > 0);
+
+  char message[200];
+  snprintf(message, sizeof(message),
+           "/getDisplayConfig x%d: String %.2f us, %u allocs, %u bytes/request; JsonWriter %.2f us, %u allocs",
+           SOAK_REQUESTS, (double)stringNs / SOAK_REQUESTS / 1000,
+           (unsigned)(stringAlloc.allocations / SOAK_REQUESTS), (unsigned)(stringAlloc.bytes / SOAK_REQUESTS),
+           (double)writerNs / SOAK_REQUESTS / 1000, (unsigned)writerAlloc.allocations);
+  TEST_MESSAGE(message);
+  TEST_ASSERT_EQUAL_UINT32(0, writerAlloc.allocations);
+  TEST_ASSERT_TRUE(stringAlloc.allocations > 0);
+  TEST_ASSERT_EQUAL_INT32(0, (int32_t)stringAlloc.live); // Churn, but no leak
+}
+
+int main(int argc, char **argv) {
+  initializeDisplayConfig();
+
+  UNITY_BEGIN();
+  RUN_TEST(test_escapes_strings);
+  RUN_TEST(test_nests_with_commas);
+  RUN_TEST(test_nests_to_max_depth);
+  RUN_TEST(test_numbers);
+  RUN_TEST(test_overflow_is_flagged_and_terminated);
+  RUN_TEST(test_exact_fit_does_not_overflow);
+  RUN_TEST(test_matches_string_handler);
+  RUN_TEST(test_bench_and_soak_against_string);
+  return UNITY_END();
+}
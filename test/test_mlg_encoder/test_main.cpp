@@ -0,0 +1,180 @@
+// MLG export round trip: encode a header and a run of records the way
+// /log.mlg does, then parse the bytes back with the same checks as
+// tools/mlg_dump.py (offsets, field table, block type, rolling counter,
+// checksum) and compare the scaled values against the records.
+
+#include <unity.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "MlgEncoder.h"
+#include "DataLogger.h"
+#include "DisplayConfig.h"
+
+#define TEST_RECORDS 300     // Past one counter wrap
+#define TEST_RATE_MS 10      // 100 Hz
+#define TEST_START_MS 123456
+#define TEST_TIMESTAMP 1760000000u
+#define TEST_INFO "MAZDUINO Display log 7, 100 Hz"
+#define MLG_FIXED_HEADER 22
+
+static uint8_t buffer[4096 + TEST_RECORDS * MLG_BLOCK_SIZE];
+
+static uint16_t getU16(const uint8_t *in) {
+  return (uint16_t)(in[0] << 8 | in[1]);
+}
+
+static uint32_t getU32(const uint8_t *in) {
+  return (uint32_t)in[0] << 24 | (uint32_t)in[1] << 16 | (uint32_t)in[2] << 8 | in[3];
+}
+
+static float getF32(const uint8_t *in) {
+  uint32_t bits = getU32(in);
+  float value;
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+// Record i: every channel moves, some negative, AFR and voltage use
+// their two decimals
+static void makeRecord(LogRecord &record, uint32_t i) {
+  record.timeMs = TEST_START_MS + i * TEST_RATE_MS;
+  for (uint8_t c = 0; c < DATA_SOURCE_COUNT; c++) {
+    record.values[c] = (int16_t)((int32_t)i * (c + 1) - 100 * c);
+  }
+  record.values[DATA_SOURCE_RPM] = (int16_t)(800 + i * 20);
+  record.values[DATA_SOURCE_AFR] = (int16_t)(1470 + (i % 50) - 25);
+}
+
+// Encode the header and TEST_RECORDS blocks; returns the total size
+static size_t encodeLog() {
+  size_t length = mlgWriteHeader(buffer, sizeof(buffer), TEST_TIMESTAMP, TEST_INFO);
+  uint8_t counter = 0;
+  for (uint32_t i = 0; i < TEST_RECORDS; i++) {
+    LogRecord record;
+    makeRecord(record, i);
+    length += mlgWriteBlock(buffer + length, record, TEST_START_MS, counter++);
+  }
+  return length;
+}
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+void test_header_layout(void) {
+  size_t headerSize = mlgWriteHeader(buffer, sizeof(buffer), TEST_TIMESTAMP, TEST_INFO);
+  TEST_ASSERT_EQUAL_size_t(mlgHeaderSize(TEST_INFO), headerSize);
+  TEST_ASSERT_EQUAL_MEMORY("MLVLG\0", buffer, 6);
+  TEST_ASSERT_EQUAL_UINT16(1, getU16(buffer + 6));
+  TEST_ASSERT_EQUAL_UINT32(TEST_TIMESTAMP, getU32(buffer + 8));
+  uint16_t infoStart = getU16(buffer + 12);
+  uint32_t dataBegin = getU32(buffer + 14);
+  uint16_t fieldCount = getU16(buffer + 20);
+  TEST_ASSERT_EQUAL_UINT16(1 + DATA_SOURCE_COUNT, fieldCount);
+  TEST_ASSERT_EQUAL_UINT16(MLG_FIXED_HEADER + fieldCount * MLG_FIELD_SIZE, infoStart);
+  TEST_ASSERT_EQUAL_UINT32(headerSize, dataBegin);
+  TEST_ASSERT_EQUAL_STRING(TEST_INFO, (const char *)buffer + infoStart);
+
+  // Record length matches the field types: U32 time plus S16 channels
+  TEST_ASSERT_EQUAL_UINT16(MLG_RECORD_SIZE, getU16(buffer + 18));
+  TEST_ASSERT_EQUAL_UINT16(4 + 2 * DATA_SOURCE_COUNT, getU16(buffer + 18));
+}
+
+void test_field_table_matches_channels(void) {
+  mlgWriteHeader(buffer, sizeof(buffer), TEST_TIMESTAMP, TEST_INFO);
+  const uint8_t *field = buffer + MLG_FIXED_HEADER;
+  TEST_ASSERT_EQUAL_UINT8(4, field[0]);   // U32
+  TEST_ASSERT_EQUAL_STRING("Time", (const char *)field + 1);
+  TEST_ASSERT_EQUAL_STRING("s", (const char *)field + 35);
+  TEST_ASSERT_EQUAL_FLOAT(0.001f, getF32(field + 46));
+  TEST_ASSERT_EQUAL_INT8(3, (int8_t)field[54]);
+
+  for (uint8_t i = 0; i < DATA_SOURCE_COUNT; i++) {
+    field = buffer + MLG_FIXED_HEADER + (1 + i) * MLG_FIELD_SIZE;
+    const LogChannel &channel = getLogChannel(i);
+    char name[35];
+    memcpy(name, field + 1, 34);
+    name[34] = '\0';
+    TEST_ASSERT_EQUAL_UINT8_MESSAGE(3, field[0], getDataSourceName(i));   // S16
+    TEST_ASSERT_EQUAL_STRING(getDataSourceName(i), name);
+    TEST_ASSERT_EQUAL_STRING(channel.unit, (const char *)field + 35);
+    TEST_ASSERT_EQUAL_FLOAT(powf(10.0f, -channel.decimals), getF32(field + 46));
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, getF32(field + 50));
+    TEST_ASSERT_EQUAL_INT8(channel.decimals, (int8_t)field[54]);
+  }
+}
+
+// Too small a buffer writes nothing rather than a truncated header
+void test_header_needs_room(void) {
+  memset(buffer, 0xAA, 64);
+  TEST_ASSERT_EQUAL_size_t(0, mlgWriteHeader(buffer, mlgHeaderSize(TEST_INFO) - 1, TEST_TIMESTAMP, TEST_INFO));
+  TEST_ASSERT_EQUAL_UINT8(0xAA, buffer[0]);
+}
+
+// Every block parses back to the record it came from
+void test_blocks_round_trip(void) {
+  size_t length = encodeLog();
+  uint32_t dataBegin = getU32(buffer + 14);
+  TEST_ASSERT_EQUAL_size_t(dataBegin + TEST_RECORDS * MLG_BLOCK_SIZE, length);
+
+  const uint8_t *block = buffer + dataBegin;
+  for (uint32_t i = 0; i < TEST_RECORDS; i++, block += MLG_BLOCK_SIZE) {
+    LogRecord expected;
+    makeRecord(expected, i);
+    uint32_t elapsedMs = i * TEST_RATE_MS;
+
+    TEST_ASSERT_EQUAL_UINT8(0, block[0]);
+    TEST_ASSERT_EQUAL_UINT8((uint8_t)i, block[1]);
+    TEST_ASSERT_EQUAL_UINT16((uint16_t)(elapsedMs * 100), getU16(block + 2));
+
+    const uint8_t *record = block + 4;
+    uint8_t sum = 0;
+    for (uint16_t b = 0; b < MLG_RECORD_SIZE; b++) {
+      sum += record[b];
+    }
+    TEST_ASSERT_EQUAL_UINT8(sum, record[MLG_RECORD_SIZE]);
+
+    TEST_ASSERT_EQUAL_UINT32(elapsedMs, getU32(record));
+    for (uint8_t c = 0; c < DATA_SOURCE_COUNT; c++) {
+      TEST_ASSERT_EQUAL_INT16(expected.values[c], (int16_t)getU16(record + 4 + 2 * c));
+    }
+  }
+}
+
+// What a viewer shows: raw value times the field scale
+void test_scaled_values(void) {
+  encodeLog();
+  const uint8_t *block = buffer + getU32(buffer + 14) + 25 * MLG_BLOCK_SIZE;
+  const uint8_t *afrField = buffer + MLG_FIXED_HEADER + (1 + DATA_SOURCE_AFR) * MLG_FIELD_SIZE;
+  const uint8_t *rpmField = buffer + MLG_FIXED_HEADER + (1 + DATA_SOURCE_RPM) * MLG_FIELD_SIZE;
+  float afr = (int16_t)getU16(block + 4 + 4 + 2 * DATA_SOURCE_AFR) * getF32(afrField + 46);
+  float rpm = (int16_t)getU16(block + 4 + 4 + 2 * DATA_SOURCE_RPM) * getF32(rpmField + 46);
+  float seconds = getU32(block + 4) * getF32(buffer + MLG_FIXED_HEADER + 46);
+  TEST_ASSERT_FLOAT_WITHIN(0.0005f, 14.70f, afr);
+  TEST_ASSERT_EQUAL_FLOAT(1300.0f, rpm);
+  TEST_ASSERT_FLOAT_WITHIN(0.0005f, 0.25f, seconds);
+}
+
+// A corrupted byte is caught by the block checksum
+void test_checksum_catches_corruption(void) {
+  encodeLog();
+  uint8_t *block = buffer + getU32(buffer + 14) + 7 * MLG_BLOCK_SIZE;
+  block[4 + 5] ^= 0x10;
+  uint8_t sum = 0;
+  for (uint16_t b = 0; b < MLG_RECORD_SIZE; b++) {
+    sum += block[4 + b];
+  }
+  TEST_ASSERT_NOT_EQUAL(sum, block[4 + MLG_RECORD_SIZE]);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_header_layout);
+  RUN_TEST(test_field_table_matches_channels);
+  RUN_TEST(test_header_needs_room);
+  RUN_TEST(test_blocks_round_trip);
+  RUN_TEST(test_scaled_values);
+  RUN_TEST(test_checksum_catches_corruption);
+  return UNITY_END();
+}
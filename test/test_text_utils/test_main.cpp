@@ -0,0 +1,205 @@
+// formatFixed()/toFixed() edge cases, plus host benchmarks of the formatter
+// against snprintf() and of DigitRenderer against the full-sprite
+// drawFloat() redraw it replaced. Benchmark figures are printed; only the
+// direction of the win is asserted, since host timings vary.
+
+#include <unity.h>
+#include <chrono>
+#include <limits.h>
+#include <stdio.h>
+#include <string.h>
+#include "text_utils.h"
+#include "DigitRenderer.h"
+#include "DisplayManager.h"
+#include "Config.h"
+#include "NotoSansBold36.h"
+#include "FakePanel.h"
+#include "FakeClock.h"
+
+#define BENCH_FORMAT_CALLS 200000
+#define BENCH_SWEEP_PASSES 20
+
+// Same box geometry as drawDataBox()
+#define BOX_X 200
+#define BOX_Y 120
+#define BOX_WIDTH 80
+#define BOX_HEIGHT 40
+
+static volatile uint32_t benchSink;
+
+static uint64_t nowNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static void checkFormat(const char *expected, int32_t value, uint8_t decimals, uint8_t width = 0) {
+  char buf[FORMAT_BUFFER_SIZE];
+  uint8_t len = formatFixed(buf, value, decimals, width);
+  TEST_ASSERT_EQUAL_STRING(expected, buf);
+  TEST_ASSERT_EQUAL_UINT8(strlen(expected), len);
+}
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+void test_format_int32_limits(void) {
+  checkFormat("-2147483648", INT32_MIN, 0);
+  checkFormat("2147483647", INT32_MAX, 0);
+  checkFormat("-21474836.48", INT32_MIN, 2);
+  checkFormat("21474836.47", INT32_MAX, 2);
+  checkFormat("-214748.3648", INT32_MIN, 4);
+}
+
+void test_format_zero_at_each_precision(void) {
+  checkFormat("0", 0, 0);
+  checkFormat("0.0", 0, 1);
+  checkFormat("0.00", 0, 2);
+  checkFormat("0.000", 0, 3);
+  checkFormat("0.0000", 0, 4);
+}
+
+void test_format_negatives(void) {
+  checkFormat("-5", -5, 0);
+  checkFormat("-0.5", -5, 1);
+  checkFormat("-0.05", -5, 2);
+  checkFormat("-1.23", -123, 2);
+  checkFormat("-40", -40, 0);
+}
+
+void test_format_clamps_decimals(void) {
+  checkFormat("1.2345", 12345, 4);
+  checkFormat("1.2345", 12345, 7);
+}
+
+void test_format_width_padding(void) {
+  checkFormat("   42", 42, 0, 5);
+  checkFormat(" -4.2", -42, 1, 5);
+  checkFormat("13.8", 138, 1, 4);
+  // Never truncates a value wider than the field
+  checkFormat("12345", 12345, 0, 3);
+}
+
+// Every value and precision agrees with printf's rounding of the same number
+void test_format_matches_snprintf(void) {
+  char buf[FORMAT_BUFFER_SIZE];
+  char expected[32];
+  static const int32_t scales[] = {1, 10, 100, 1000, 10000};
+  for (uint8_t decimals = 0; decimals <= 4; decimals++) {
+    for (int32_t value = -20000; value <= 20000; value += 7) {
+      formatFixed(buf, value, decimals);
+      snprintf(expected, sizeof(expected), "%.*f", decimals, (double)value / scales[decimals]);
+      TEST_ASSERT_EQUAL_STRING(expected, buf);
+    }
+  }
+}
+
+void test_to_fixed_rounds_half_away_from_zero(void) {
+  TEST_ASSERT_EQUAL_INT32(1, toFixed(0.5f, 0));
+  TEST_ASSERT_EQUAL_INT32(-1, toFixed(-0.5f, 0));
+  TEST_ASSERT_EQUAL_INT32(0, toFixed(0.4999f, 0));
+  TEST_ASSERT_EQUAL_INT32(0, toFixed(-0.4999f, 0));
+  TEST_ASSERT_EQUAL_INT32(-40, toFixed(-40.0f, 0));
+}
+
+// Readings that are not exact in binary still land on the shown digit
+void test_to_fixed_readings(void) {
+  TEST_ASSERT_EQUAL_INT32(138, toFixed(13.8f, 1));
+  TEST_ASSERT_EQUAL_INT32(147, toFixed(14.7f, 1));
+  TEST_ASSERT_EQUAL_INT32(-123, toFixed(-1.23f, 2));
+  TEST_ASSERT_EQUAL_INT32(1235, toFixed(1.2345f, 3));
+  TEST_ASSERT_EQUAL_INT32(12346, toFixed(1.23456f, 4));
+  TEST_ASSERT_EQUAL_INT32(12346, toFixed(1.23456f, 9));
+}
+
+void test_bench_format_fixed_vs_snprintf(void) {
+  char buf[FORMAT_BUFFER_SIZE];
+  uint32_t sink = 0;
+
+  uint64_t start = nowNs();
+  for (int32_t i = 0; i < BENCH_FORMAT_CALLS; i++) {
+    sink += formatFixed(buf, i - BENCH_FORMAT_CALLS / 2, 1);
+  }
+  uint64_t fixedNs = nowNs() - start;
+
+  start = nowNs();
+  for (int32_t i = 0; i < BENCH_FORMAT_CALLS; i++) {
+    sink += snprintf(buf, sizeof(buf), "%.1f", (i - BENCH_FORMAT_CALLS / 2) / 10.0f);
+  }
+  uint64_t printfNs = nowNs() - start;
+  benchSink = sink;
+
+  char message[128];
+  snprintf(message, sizeof(message), "formatFixed %.1f ns/call, snprintf %.1f ns/call",
+           (double)fixedNs / BENCH_FORMAT_CALLS, (double)printfNs / BENCH_FORMAT_CALLS);
+  TEST_MESSAGE(message);
+  TEST_ASSERT_TRUE(fixedNs < printfNs);
+}
+
+// The pre-DigitRenderer value box: the whole sprite, redrawn with drawFloat()
+static void drawFloatBox(float value) {
+  spr.loadFont(AA_FONT_LARGE);
+  spr.createSprite(BOX_WIDTH, BOX_HEIGHT);
+  spr.fillSprite(TFT_BLACK);
+  spr.setTextDatum(TC_DATUM);
+  spr.setTextColor(TFT_WHITE, TFT_BLACK, true);
+  spr.drawFloat(value, 1, BOX_WIDTH / 2, 5);
+  spr.pushSprite(BOX_X, BOX_Y);
+  spr.deleteSprite();
+}
+
+// A voltage-like sweep, 11.0 to 14.9 V in 0.1 V steps, both ways
+static int32_t sweepValue(uint32_t step) {
+  uint32_t phase = step % 78;
+  return 110 + (phase < 39 ? phase : 77 - phase);
+}
+
+void test_bench_digit_field_vs_draw_float(void) {
+  char valueText[FORMAT_BUFFER_SIZE];
+  uint32_t steps = BENCH_SWEEP_PASSES * 78;
+
+  fakeSpiReset();
+  uint64_t start = nowNs();
+  for (uint32_t i = 0; i < steps; i++) {
+    drawFloatBox(sweepValue(i) / 10.0f);
+  }
+  uint64_t floatNs = nowNs() - start;
+  FakeSpiStats floatSpi = fakeSpiStats();
+
+  DigitField field;
+  initDigitField(field, BOX_X + BOX_WIDTH - 2, BOX_Y + 5, 4, 36, BOX_WIDTH - 4, AA_FONT_LARGE, TFT_WHITE, TFT_BLACK);
+  fakeSpiReset();
+  start = nowNs();
+  for (uint32_t i = 0; i < steps; i++) {
+    formatFixed(valueText, sweepValue(i), 1);
+    drawDigitField(field, valueText);
+  }
+  uint64_t digitNs = nowNs() - start;
+  FakeSpiStats digitSpi = fakeSpiStats();
+
+  char message[160];
+  snprintf(message, sizeof(message), "drawFloat %u B/update %.1f us, DigitRenderer %u B/update %.1f us",
+           (unsigned)(floatSpi.bytes / steps), (double)floatNs / steps / 1000,
+           (unsigned)(digitSpi.bytes / steps), (double)digitNs / steps / 1000);
+  TEST_MESSAGE(message);
+  TEST_ASSERT_TRUE(digitSpi.bytes * 2 < floatSpi.bytes);
+  TEST_ASSERT_TRUE(digitNs < floatNs);
+}
+
+int main(int argc, char **argv) {
+  fakeClockSet(1000);
+  setupDisplay();
+
+  UNITY_BEGIN();
+  RUN_TEST(test_format_int32_limits);
+  RUN_TEST(test_format_zero_at_each_precision);
+  RUN_TEST(test_format_negatives);
+  RUN_TEST(test_format_clamps_decimals);
+  RUN_TEST(test_format_width_padding);
+  RUN_TEST(test_format_matches_snprintf);
+  RUN_TEST(test_to_fixed_rounds_half_away_from_zero);
+  RUN_TEST(test_to_fixed_readings);
+  RUN_TEST(test_bench_format_fixed_vs_snprintf);
+  RUN_TEST(test_bench_digit_field_vs_draw_float);
+  return UNITY_END();
+}
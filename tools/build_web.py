@@ -0,0 +1,78 @@
+#!/usr/bin/env python3
+"""Minify and gzip web/index.html into src/WebUI.h.
+
+Runs as a PlatformIO pre-build script (extra_scripts in platformio.ini) and
+can be run by hand. The header is committed; it is only rewritten when the
+page changes, so unchanged builds do not recompile the web server.
+
+Minification is deliberately conservative: indentation, blank lines, HTML
+comments and whole-line // comments are dropped, line breaks are kept so
+the inline JavaScript never depends on automatic semicolon insertion.
+
+The ETag is a hash of the compressed bytes, so it changes exactly when the
+served page does.
+
+    python tools/build_web.py
+"""
+import gzip
+import hashlib
+import os
+import re
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO/SCons
+    ROOT = env.subst("$PROJECT_DIR")  # noqa: F821
+except NameError:
+    ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+
+SRC = os.path.join(ROOT, "web", "index.html")
+OUT = os.path.join(ROOT, "src", "WebUI.h")
+
+
+def minify(html):
+    html = re.sub(r"<!--.*?-->", "", html, flags=re.S)
+    lines = []
+    for line in html.splitlines():
+        line = line.strip()
+        if not line or line.startswith("//"):
+            continue
+        lines.append(line)
+    return "\n".join(lines) + "\n"
+
+
+def render(gz, etag, raw_len, min_len):
+    lines = [
+        "// Control page, gzip of the minified web/index.html",
+        "// Generated by tools/build_web.py - do not edit",
+        "#ifndef WEB_UI_H",
+        "#define WEB_UI_H",
+        "",
+        "#include <Arduino.h>",
+        "",
+        "// %d bytes source, %d minified, %d gzipped" % (raw_len, min_len, len(gz)),
+        "#define WEB_UI_GZ_LEN %d" % len(gz),
+        "#define WEB_UI_ETAG \"\\\"%s\\\"\"" % etag,
+        "",
+        "static const uint8_t webUiGz[WEB_UI_GZ_LEN] PROGMEM = {",
+    ]
+    for i in range(0, len(gz), 16):
+        chunk = gz[i:i + 16]
+        lines.append("\t" + ", ".join("0x%02x" % b for b in chunk) + ("," if i + 16 < len(gz) else ""))
+    lines += ["};", "", "#endif // WEB_UI_H", ""]
+    return "\n".join(lines)
+
+
+def main():
+    raw = open(SRC, encoding="utf-8").read()
+    small = minify(raw).encode("utf-8")
+    gz = gzip.compress(small, 9, mtime=0)  # mtime=0 keeps the output reproducible
+    etag = hashlib.sha256(gz).hexdigest()[:16]
+    text = render(gz, etag, len(raw.encode("utf-8")), len(small))
+    old = open(OUT).read() if os.path.exists(OUT) else None
+    if text != old:
+        with open(OUT, "w") as f:
+            f.write(text)
+        print("wrote %s (%d -> %d bytes, ETag %s)" % (os.path.normpath(OUT), len(small), len(gz), etag))
+
+
+main()
@@ -0,0 +1,72 @@
+#!/usr/bin/env python3
+"""Fail the build when firmware.bin no longer fits its OTA slot with headroom.
+
+Runs as a PlatformIO post script (extra_scripts in platformio.ini). The slot
+size is read from the env's partition table (the first app partition), the
+headroom from the env's custom_firmware_headroom option. PlatformIO's own
+check only fails once the image no longer fits at all; by then an OTA
+update that grows the image a little has nowhere to go.
+
+Can also be run by hand against a built image:
+
+    python tools/check_firmware_size.py .pio/build/esp32dev/firmware.bin dual_ota.csv 0x20000
+"""
+import os
+import sys
+
+DEFAULT_HEADROOM = 0x20000
+
+
+def parse_size(text):
+    text = text.strip().upper()
+    scale = 1
+    if text.endswith("K"):
+        text, scale = text[:-1], 1024
+    elif text.endswith("M"):
+        text, scale = text[:-1], 1024 * 1024
+    return int(text, 0) * scale
+
+
+def app_slot_size(csv_path):
+    with open(csv_path) as f:
+        for line in f:
+            line = line.split("#", 1)[0].strip()
+            if not line:
+                continue
+            fields = [field.strip() for field in line.split(",")]
+            if len(fields) >= 5 and fields[1] == "app":
+                return fields[0], parse_size(fields[4])
+    raise ValueError("no app partition in %s" % csv_path)
+
+
+def check(image_path, csv_path, headroom):
+    """Returns an error message, or None when the image fits."""
+    size = os.path.getsize(image_path)
+    name, slot = app_slot_size(csv_path)
+    limit = slot - headroom
+    print("Firmware: %d bytes, %s slot %d bytes, limit %d (%.1f%% of slot, %d bytes left)"
+          % (size, name, slot, limit, 100.0 * size / slot, limit - size))
+    if size > limit:
+        return ("firmware.bin is %d bytes, over the %d byte limit (%s slot 0x%x minus 0x%x headroom)"
+                % (size, limit, name, slot, headroom))
+    return None
+
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO/SCons
+
+    def after_bin(source, target, env):
+        headroom = parse_size(env.GetProjectOption("custom_firmware_headroom", str(DEFAULT_HEADROOM)))
+        error = check(target[0].get_abspath(), env.subst("$PARTITIONS_TABLE_CSV"), headroom)
+        if error:
+            sys.stderr.write("Error: %s\n" % error)
+            env.Exit(1)
+
+    env.AddPostAction("$BUILD_DIR/${PROGNAME}.bin", after_bin)  # noqa: F821
+except NameError:
+    if __name__ == "__main__":
+        if len(sys.argv) not in (3, 4):
+            sys.exit(__doc__)
+        error = check(sys.argv[1], sys.argv[2], parse_size(sys.argv[3]) if len(sys.argv) == 4 else DEFAULT_HEADROOM)
+        if error:
+            sys.exit("Error: " + error)
@@ -0,0 +1,153 @@
+#!/usr/bin/env python3
+"""Compress a 480x320 splash image into the Q565 format used by
+src/CompressedImage.cpp and write it as a C header.
+
+Q565 is a QOI-style stream of RGB565 pixels (true colour, not byte-swapped):
+
+    header  "Q565", width u16 LE, height u16 LE
+    00iiiiii                    INDEX  colour from the 64-entry cache
+    01rrggbb                    DIFF   r/g/b each -2..1 from the previous pixel
+    10gggggg rrrrbbbb           LUMA   g -32..31, r-g and b-g -8..7
+    11llllll (l < 62)           RUN    previous pixel repeated l+1 times
+    11111110 hi lo              RGB    literal colour
+    cache index = (r*3 + g*5 + b*7) % 64, previous pixel starts at 0x0000
+
+Input can be an existing raw header (const uint16_t array of RGB565 values,
+as produced by image2cpp) or any image Pillow can open.
+
+    python tools/compress_splash.py my_logo.png -n custom
+    python tools/compress_splash.py old_raw_image.h -n custom
+"""
+import argparse
+import os
+import re
+
+WIDTH, HEIGHT = 480, 320
+
+
+def load_raw_header(path):
+    text = open(path).read()
+    body = text[text.index("{") + 1:text.rindex("}")]
+    return [int(v, 16) for v in re.findall(r"0x[0-9a-fA-F]+", body)]
+
+
+def load_image(path):
+    from PIL import Image
+    img = Image.open(path).convert("RGB").resize((WIDTH, HEIGHT))
+    return [((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3) for r, g, b in img.getdata()]
+
+
+def cache_index(c):
+    return ((c >> 11) * 3 + ((c >> 5) & 63) * 5 + (c & 31) * 7) % 64
+
+
+def encode(pixels, width, height):
+    out = bytearray(b"Q565")
+    out += width.to_bytes(2, "little") + height.to_bytes(2, "little")
+    cache = [0] * 64
+    prev = 0
+    run = 0
+    for c in pixels:
+        if c == prev:
+            run += 1
+            if run == 62:
+                out.append(0xC0 | 61)
+                run = 0
+            continue
+        if run:
+            out.append(0xC0 | (run - 1))
+            run = 0
+        i = cache_index(c)
+        if cache[i] == c:
+            out.append(i)
+        else:
+            cache[i] = c
+            dr = (c >> 11) - (prev >> 11)
+            dg = ((c >> 5) & 63) - ((prev >> 5) & 63)
+            db = (c & 31) - (prev & 31)
+            if -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+                out.append(0x40 | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2))
+            elif -32 <= dg <= 31 and -8 <= dr - dg <= 7 and -8 <= db - dg <= 7:
+                out.append(0x80 | (dg + 32))
+                out.append(((dr - dg + 8) << 4) | (db - dg + 8))
+            else:
+                out += bytes([0xFE, c >> 8, c & 0xFF])
+        prev = c
+    if run:
+        out.append(0xC0 | (run - 1))
+    return out
+
+
+def decode(data):
+    """Reference decoder, used to verify the output round-trips."""
+    width = int.from_bytes(data[4:6], "little")
+    height = int.from_bytes(data[6:8], "little")
+    pixels = []
+    cache = [0] * 64
+    prev = 0
+    pos = 8
+    while len(pixels) < width * height:
+        b = data[pos]
+        pos += 1
+        if b == 0xFE:
+            c = (data[pos] << 8) | data[pos + 1]
+            pos += 2
+        elif b >= 0xC0:
+            pixels.extend([prev] * ((b & 0x3F) + 1))
+            continue
+        elif b < 0x40:
+            c = cache[b]
+        elif b < 0x80:
+            r = (prev >> 11) + ((b >> 4) & 3) - 2
+            g = ((prev >> 5) & 63) + ((b >> 2) & 3) - 2
+            bl = (prev & 31) + (b & 3) - 2
+            c = (r << 11) | (g << 5) | bl
+        else:
+            dg = (b & 0x3F) - 32
+            b2 = data[pos]
+            pos += 1
+            r = (prev >> 11) + dg + (b2 >> 4) - 8
+            g = ((prev >> 5) & 63) + dg
+            bl = (prev & 31) + dg + (b2 & 15) - 8
+            c = (r << 11) | (g << 5) | bl
+        cache[cache_index(c)] = c
+        pixels.append(c)
+        prev = c
+    return pixels
+
+
+def write_header(path, name, data, width, height):
+    with open(path, "w") as f:
+        f.write("// '%s', %dx%dpx, Q565 compressed (%d bytes, raw %d)\n" % (name, width, height, len(data), width * height * 2))
+        f.write("// Generated by tools/compress_splash.py - do not edit\n")
+        f.write("const uint8_t splash_%s_q565[] PROGMEM = {\n" % name)
+        for i in range(0, len(data), 16):
+            f.write("\t" + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",\n")
+        f.write("};\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("input", help="raw RGB565 header or image file")
+    parser.add_argument("-n", "--name", required=True, help="image name, e.g. mercy")
+    parser.add_argument("-o", "--output", help="output header (default src/splash_image/<name>_q565.h)")
+    args = parser.parse_args()
+
+    if args.input.endswith(".h"):
+        pixels = load_raw_header(args.input)
+    else:
+        pixels = load_image(args.input)
+    if len(pixels) != WIDTH * HEIGHT:
+        raise SystemExit("expected %d pixels, got %d" % (WIDTH * HEIGHT, len(pixels)))
+
+    data = encode(pixels, WIDTH, HEIGHT)
+    if decode(data) != pixels:
+        raise SystemExit("round-trip check failed")
+
+    output = args.output or os.path.join("src", "splash_image", "%s_q565.h" % args.name)
+    write_header(output, args.name, data, WIDTH, HEIGHT)
+    print("%s: %d -> %d bytes (%.1f%%)" % (output, len(pixels) * 2, len(data), 100.0 * len(data) / (len(pixels) * 2)))
+
+
+if __name__ == "__main__":
+    main()
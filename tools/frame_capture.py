@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+"""Grab a screen capture from the dash over serial and optionally compare it
+against a golden frame.
+
+The firmware dumps the panel when it receives 'c' (debug build), see
+src/FrameCapture.h for the wire format.
+
+    pip install pyserial
+    python tools/frame_capture.py /dev/ttyUSB0 -o street.ppm
+    python tools/frame_capture.py /dev/ttyUSB0 -o now.ppm --golden street.ppm
+
+Exits with status 1 when the capture differs from the golden frame.
+"""
+import argparse
+import sys
+
+import serial
+
+
+def read_frame(port, baud, timeout):
+    with serial.Serial(port, baud, timeout=timeout) as ser:
+        ser.reset_input_buffer()
+        ser.write(b"c")
+        while True:
+            line = ser.readline()
+            if not line:
+                raise RuntimeError("timed out waiting for FRAME_BEGIN")
+            if line.startswith(b"FRAME_BEGIN"):
+                break
+        _, width, height, spi_bytes, spi_transactions = line.split()
+        width, height = int(width), int(height)
+        header = b"".join(ser.readline() for _ in range(3))
+        size = width * height * 3
+        pixels = ser.read(size)
+        if len(pixels) != size:
+            raise RuntimeError("short frame: %d of %d bytes" % (len(pixels), size))
+        return header + pixels, width, height, int(spi_bytes), int(spi_transactions)
+
+
+def load_ppm(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    # P6\n<w> <h>\n255\n
+    parts = data.split(b"\n", 3)
+    width, height = (int(v) for v in parts[1].split())
+    return parts[3], width, height
+
+
+def compare(capture, golden):
+    pixels, width, height = capture
+    golden_pixels, golden_width, golden_height = golden
+    if (width, height) != (golden_width, golden_height):
+        print("size mismatch: %dx%d vs golden %dx%d" % (width, height, golden_width, golden_height))
+        return False
+    diff = 0
+    box = [width, height, -1, -1]
+    for i in range(0, len(pixels), 3):
+        if pixels[i:i + 3] != golden_pixels[i:i + 3]:
+            diff += 1
+            x, y = (i // 3) % width, (i // 3) // width
+            box = [min(box[0], x), min(box[1], y), max(box[2], x), max(box[3], y)]
+    if diff:
+        print("%d pixels differ, bounding box (%d,%d)-(%d,%d)" % (diff, *box))
+        return False
+    print("matches golden frame")
+    return True
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("port")
+    parser.add_argument("-b", "--baud", type=int, default=115200)
+    parser.add_argument("-o", "--output", default="frame.ppm")
+    parser.add_argument("--golden", help="PPM to compare against")
+    parser.add_argument("--timeout", type=float, default=60)
+    args = parser.parse_args()
+
+    data, width, height, spi_bytes, spi_transactions = read_frame(args.port, args.baud, args.timeout)
+    with open(args.output, "wb") as f:
+        f.write(data)
+    print("saved %dx%d frame to %s" % (width, height, args.output))
+    print("last frame SPI: %d bytes in %d transactions (0 = profiler off)" % (spi_bytes, spi_transactions))
+
+    if args.golden:
+        capture = (data.split(b"\n", 3)[3], width, height)
+        if not compare(capture, load_ppm(args.golden)):
+            sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,43 @@
+#!/usr/bin/env python3
+"""Generate the fixed-point sine table used by src/ArcGauge.cpp.
+
+The table holds one quarter wave, sin(0..90 degrees) in half-degree steps,
+scaled to Q14 (16384 = 1.0). ArcGauge folds every other angle onto it.
+
+    python tools/gen_trig_table.py
+"""
+import math
+import os
+
+STEPS = 180          # Half-degrees per quarter turn
+SCALE = 1 << 14      # Q14
+
+OUT = os.path.join(os.path.dirname(__file__), "..", "src", "TrigTable.h")
+
+
+def main():
+    values = [int(round(math.sin(math.radians(i / 2.0)) * SCALE)) for i in range(STEPS + 1)]
+    lines = [
+        "// Quarter-wave sine, half-degree steps, Q14 (16384 = 1.0)",
+        "// Generated by tools/gen_trig_table.py - do not edit",
+        "#ifndef TRIG_TABLE_H",
+        "#define TRIG_TABLE_H",
+        "",
+        "#include <stdint.h>",
+        "",
+        "#define TRIG_QUARTER_STEPS %d" % STEPS,
+        "#define TRIG_SHIFT 14",
+        "",
+        "static const int16_t sinQuarterTable[TRIG_QUARTER_STEPS + 1] = {",
+    ]
+    for i in range(0, len(values), 12):
+        chunk = values[i:i + 12]
+        lines.append("\t" + ", ".join("%5d" % v for v in chunk) + ("," if i + 12 < len(values) else ""))
+    lines += ["};", "", "#endif // TRIG_TABLE_H", ""]
+    with open(OUT, "w") as f:
+        f.write("\n".join(lines))
+    print("wrote %s (%d entries)" % (os.path.normpath(OUT), len(values)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,113 @@
+#!/usr/bin/env python3
+"""Check and dump a MegaLogViewer binary log (.mlg, MLVLG version 1) as
+downloaded from the dash at /log.mlg?n=<log>.
+
+Verifies the header, the field table and every data block (type, rolling
+counter, checksum), then prints a summary or writes the scaled values as
+CSV. See src/MlgEncoder.h for the layout the firmware writes.
+
+    python tools/mlg_dump.py log00001.mlg
+    python tools/mlg_dump.py log00001.mlg --csv log00001.csv
+
+Exits with status 1 when the file is malformed.
+"""
+import argparse
+import csv
+import struct
+import sys
+
+FIELD_SIZE = 55
+FIELD_TYPES = {0: "B", 1: "b", 2: "H", 3: "h", 4: "I", 5: "i", 6: "q", 7: "f"}
+
+
+class MlgError(Exception):
+    pass
+
+
+def parse_mlg(data):
+    """Return (header dict, fields, rows of scaled values)."""
+    if len(data) < 22 or data[:6] != b"MLVLG\0":
+        raise MlgError("not an MLVLG file")
+    version, timestamp, info_start, data_begin, record_len, field_count = struct.unpack(
+        ">HIHIHH", data[6:22])
+    if version != 1:
+        raise MlgError("unsupported format version %d" % version)
+
+    fields = []
+    for i in range(field_count):
+        entry = data[22 + i * FIELD_SIZE:22 + (i + 1) * FIELD_SIZE]
+        if len(entry) != FIELD_SIZE:
+            raise MlgError("field table truncated")
+        ftype, name, units, style, scale, transform, digits = struct.unpack(">B34s10sbffb", entry)
+        if ftype not in FIELD_TYPES:
+            raise MlgError("field %d has unknown type %d" % (i, ftype))
+        fields.append({
+            "type": FIELD_TYPES[ftype],
+            "name": name.split(b"\0")[0].decode("ascii"),
+            "units": units.split(b"\0")[0].decode("ascii"),
+            "scale": scale,
+            "transform": transform,
+            "digits": digits,
+        })
+    record_format = ">" + "".join(f["type"] for f in fields)
+    if struct.calcsize(record_format) != record_len:
+        raise MlgError("record length %d does not match the fields" % record_len)
+    if not 22 + field_count * FIELD_SIZE <= info_start <= data_begin <= len(data):
+        raise MlgError("bad info/data offsets")
+    info = data[info_start:data_begin].split(b"\0")[0].decode("ascii", "replace")
+
+    rows = []
+    pos = data_begin
+    expected_counter = None
+    while pos < len(data):
+        if pos + 4 + record_len + 1 > len(data):
+            raise MlgError("block at %d truncated" % pos)
+        block_type, counter, _stamp = struct.unpack(">BBH", data[pos:pos + 4])
+        if block_type != 0:
+            raise MlgError("block at %d has type %d" % (pos, block_type))
+        if expected_counter is not None and counter != expected_counter:
+            raise MlgError("block at %d: counter %d, expected %d" % (pos, counter, expected_counter))
+        expected_counter = (counter + 1) & 0xFF
+        record = data[pos + 4:pos + 4 + record_len]
+        if sum(record) & 0xFF != data[pos + 4 + record_len]:
+            raise MlgError("block at %d: checksum mismatch" % pos)
+        raw = struct.unpack(record_format, record)
+        rows.append([(value + f["transform"]) * f["scale"] for value, f in zip(raw, fields)])
+        pos += 4 + record_len + 1
+
+    header = {"version": version, "timestamp": timestamp, "info": info, "record_len": record_len}
+    return header, fields, rows
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("log", help=".mlg file")
+    parser.add_argument("--csv", help="write scaled values to this CSV file")
+    args = parser.parse_args()
+
+    with open(args.log, "rb") as f:
+        data = f.read()
+    try:
+        header, fields, rows = parse_mlg(data)
+    except MlgError as e:
+        print("%s: %s" % (args.log, e), file=sys.stderr)
+        return 1
+
+    print("%s: %s" % (args.log, header["info"]))
+    print("%d fields, %d records" % (len(fields), len(rows)))
+    for f in fields:
+        print("  %-10s %-5s x%g" % (f["name"], f["units"], f["scale"]))
+    if rows:
+        print("duration %.3f s" % (rows[-1][0] - rows[0][0]))
+
+    if args.csv:
+        with open(args.csv, "w", newline="") as f:
+            writer = csv.writer(f)
+            writer.writerow(["%s (%s)" % (fl["name"], fl["units"]) for fl in fields])
+            for row in rows:
+                writer.writerow(["%.*f" % (fl["digits"], v) for fl, v in zip(fields, row)])
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())